@@ -44,7 +44,6 @@
 // void aid_DNN_init();
 // void aid_DNN_delet();
 // void aid_DNN_run(float* in_data, q7_t* out_data);
-int inputdata_preprocess(float* in_data, q7_t* out_data);
 
 
 #endif
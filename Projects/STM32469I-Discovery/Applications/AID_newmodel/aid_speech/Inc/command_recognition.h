@@ -36,6 +36,34 @@ int AwakenDestory(void);
 // return 0  success; other : failed
 int AwakenBuffMicData(short *data, int len);
 
+//mfcc frames between two runs of the speech model: 2, 4 or 8 [default], 20 ms each.
+//A shorter hop detects sooner and costs more cpu. Call before AwakenInit
+// return 0 success; other : hop not supported
+int AwakenSetHop(int frames);
+
+//frames of the Microphone seen by the voice activity gate, and the ones it kept from
+//the feature extraction and the model
+// return 0 success
+int AwakenGetVadStat(unsigned int *frame_num, unsigned int *skipped_num);
+
+//samples of the Microphone and mfcc frames dropped because the task after them fell behind
+// return 0 success
+int AwakenGetDropStat(unsigned int *mic_samples, unsigned int *mfcc_frames);
+
+//batches the speech model took to catch up when it fell behind, and the runs in them:
+//only the last run of each graph in a batch is scored
+// return 0 success
+int AwakenGetCatchUpStat(unsigned int *batch_num, unsigned int *run_num);
+
+//threshold of the first stage of the cascade, out of 128: the speech model only runs
+//after it scored this or more. Lower misses fewer keywords and saves less
+// return 0 success
+int AwakenSetCascadeThreshold(int threshold);
+
+//runs of the first stage of the cascade, and of the speech model behind it
+// return 0 success
+int AwakenGetCascadeStat(unsigned int *run_num, unsigned int *speech_model_num);
+
 //input data from Speaker for AEC
 //data: point to input data
 //len:  data length(unit: short)
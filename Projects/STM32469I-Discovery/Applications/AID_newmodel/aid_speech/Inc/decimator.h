@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Inc/decimator.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Stereo to mono 16 kHz to 8 kHz decimation of the mic dma buffer
+  ******************************************************************************
+  */
+
+#ifndef _DECIMATOR_H_
+#define _DECIMATOR_H_
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// 39 tap half-band low pass: flat within 0.01 dB up to 3.2 kHz, -59 dB from 4.8 kHz.
+// Only the even input samples meet non zero taps besides the center one, so an output
+// costs DECIM_EVEN_TAPS multiply-accumulates
+#define DECIM_EVEN_TAPS 20
+#define DECIM_ODD_DELAY (DECIM_EVEN_TAPS / 2) // the center tap, in odd samples
+
+// outputs computed per pass over the scratch lines
+#define DECIM_CHUNK 64
+
+// the filter history, kept from one dma block to the next
+struct decimator
+{
+    q15_t even[DECIM_EVEN_TAPS - 1 + DECIM_CHUNK];
+    q15_t odd[DECIM_ODD_DELAY + DECIM_CHUNK];
+};
+
+void decimator_init(struct decimator *d);
+
+// channel 0 of frame_num interleaved stereo frames at 16 kHz, low passed and decimated
+// to frame_num / 2 mono samples at 8 kHz. frame_num must be even. Return the sample number
+int decimator_stereo_to_mono(struct decimator *d, const q15_t *stereo, int frame_num, q15_t *mono);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_DECIMATOR_H_
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Inc/kws_score.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Score smoothing and wake up logic behind the speech model
+  ******************************************************************************
+  */
+
+#ifndef _KWS_SCORE_H_
+#define _KWS_SCORE_H_
+
+#include <stdbool.h>
+
+#include "cnn.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// The decode task of command_recognition.c and the replay tools of Scripts both score the
+// outputs of the speech model through here, so the tools wake up where the board does.
+
+#define WINDOW_SIZE 3           // in runs of each graph of the speech model
+#define MISS_THRESHOLD 2        // runs under the threshold, per output and graph, before a new wake up
+
+// the runs the move nodes of the graph take to fill up, with zero outputs until then
+#define GRAPH_WARMUP_RUNS 12
+
+// mfcc frames between two runs of the speech model: a divisor of CONV_DATA_LEN. A run always
+// takes CONV_DATA_LEN new frames, the move nodes keep the ones before: with a shorter hop,
+// CONV_DATA_LEN / hop graphs of the model take turns, each on its own runs, which overlap the
+// runs of the others by CONV_DATA_LEN - hop frames
+#define MIN_HOP_FRAMES 2
+#define MAX_PHASE_NUM (CONV_DATA_LEN / MIN_HOP_FRAMES)
+
+// the scores of the last runs of the speech model, smoothed: the last WINDOW_SIZE runs of each
+// graph, so a shorter hop smooths over the same time
+struct kws_score
+{
+    int smoothed_score[OUT_DIM];
+    q7_t output_buf[WINDOW_SIZE * MAX_PHASE_NUM][OUT_DIM];
+    int output_write_ptr;
+    int size;
+    int phase_num;              // the graphs taking turns, each output counts as one of them for the misses
+    int miss_times;
+    bool wakeup_flag;
+};
+
+void kws_score_init(struct kws_score *s, int phase_num);
+
+// output: the OUT_DIM scores of a run of the speech model.
+// Return the id of the keyword it woke up on, 0 for none
+int kws_score_push(struct kws_score *s, const q7_t *output, int threshold);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_KWS_SCORE_H_
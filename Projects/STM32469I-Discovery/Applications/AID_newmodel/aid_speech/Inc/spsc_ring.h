@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Inc/spsc_ring.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Single producer, single consumer byte ring
+  ******************************************************************************
+  */
+
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// One task writes, one task reads, no lock.
+//
+// The producer reserves a contiguous span with spsc_ring_acquire(), fills it in place and
+// publishes it with spsc_ring_commit(). The consumer gets a contiguous window of the committed
+// bytes with spsc_ring_peek(), reads it in place and drops its head with spsc_ring_release(),
+// so overlapped windows (a 32 ms frame every 20 ms) are not copied at all.
+//
+// Spans and windows never wrap: the ring is followed by a mirror of its first max_span bytes,
+// so a span or a window is at most max_span bytes.
+
+#define SPSC_RING_WAIT_FOREVER 0xffffffffu
+
+struct spsc_ring;
+
+// how a side blocks and is woken: futex on the index, a semaphore...
+// Without it, spsc_ring_peek() and spsc_ring_acquire() do not wait.
+struct spsc_ring_notify
+{
+    // *index (&ring->head after a commit, &ring->tail after a release) has moved, and
+    // the other side may be waiting on it
+    void (*wake)(struct spsc_ring *ring, volatile uint32_t *index);
+    // block until *index may have moved from seen, timeout in ms: 0 when woken, -1 on timeout
+    int (*wait)(struct spsc_ring *ring, volatile uint32_t *index, uint32_t seen, uint32_t timeout);
+};
+
+struct spsc_ring
+{
+    uint8_t *buf;            // size + max_span bytes
+    uint32_t size;           // a power of 2
+    uint32_t max_span;
+    volatile uint32_t head;  // bytes committed, written by the producer only
+    volatile uint32_t tail;  // bytes released, written by the consumer only
+    volatile uint32_t producer_waiting; // the other side calls notify->wake only when set
+    volatile uint32_t consumer_waiting;
+    const struct spsc_ring_notify *notify;
+    void *notify_arg;
+};
+
+// size must be a power of 2, max_span at most half of it: a producer waiting for room and
+// a consumer waiting for data never block each other. Return 0 or -1
+int spsc_ring_init(struct spsc_ring *ring, uint32_t size, uint32_t max_span,
+                   const struct spsc_ring_notify *notify, void *notify_arg);
+void spsc_ring_free(struct spsc_ring *ring);
+
+// both sides must be stopped
+void spsc_ring_reset(struct spsc_ring *ring);
+
+uint32_t spsc_ring_data_len(const struct spsc_ring *ring);
+uint32_t spsc_ring_free_len(const struct spsc_ring *ring);
+
+// producer: a span of len bytes, NULL if there is no room after timeout ms (0: do not wait)
+void *spsc_ring_acquire(struct spsc_ring *ring, uint32_t len, uint32_t timeout);
+void spsc_ring_commit(struct spsc_ring *ring, uint32_t len);
+
+// producer: copy all of data in, or nothing. Return 0, or -1 if there is no room
+int spsc_ring_write(struct spsc_ring *ring, const void *data, uint32_t len);
+
+// consumer: a window on the next len committed bytes, NULL if they are not there after timeout ms
+const void *spsc_ring_peek(struct spsc_ring *ring, uint32_t len, uint32_t timeout);
+void spsc_ring_release(struct spsc_ring *ring, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_SPSC_RING_H_
@@ -2,8 +2,28 @@
 #define __TENGINE_TASK_H__
 
 #include "tengine_c_api.h"
+#include "tengine_aot.h"
+
+// set to 1 to run the speech model from its aot plan, Src/tiny_aot_plan_generated.c of
+// Scripts/aot_plan_gen.c: no graph is created or prerun at boot, each graph of the speech model
+// is an arena bound to the plan in flash. Generate the plan again when the model changes
+#ifndef AID_AOT_PLAN
+#define AID_AOT_PLAN 0
+#endif
 
 graph_t tengine_lite_init(graph_t graph) ;
 void tengine_lite_release(graph_t graph) ;
 
+graph_t tengine_lite_init_instance(void) ;
+void tengine_lite_release_instance(graph_t graph) ;
+
+graph_t tengine_lite_init_stage1(void) ;
+void tengine_lite_release_stage1(graph_t graph) ;
+
+#if AID_AOT_PLAN
+aot_graph_t tengine_lite_init_aot(void **arena) ;
+void tengine_lite_release_aot(void *arena) ;
+int tengine_lite_aot_input_shift(void) ;
+#endif
+
 #endif
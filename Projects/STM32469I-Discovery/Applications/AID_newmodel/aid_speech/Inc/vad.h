@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Inc/vad.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Energy and zero crossing voice activity gate in front of the mfcc
+  ******************************************************************************
+  */
+
+#ifndef _VAD_H_
+#define _VAD_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// The gate looks at each new frame shift of pcm. While it is closed the mfcc and the model
+// do not run; at least the last VAD_PREROLL_FRAMES frames are held back, and go through the
+// mfcc first when it opens, not to clip the start of a keyword. Frames are dropped a run of the
+// model at a time, so a run starts on the frames it would have started on without the gate:
+// up to VAD_PREROLL_FRAMES + run_frames - 1 are held. It stays open VAD_HANGOVER_FRAMES after
+// the last speech frame, which covers the history of the model: when it closes, the model has
+// seen silence, as it would have without the gate. It only closes on a run of the model.
+
+#define VAD_PREROLL_FRAMES 4    // 80 ms, 220 ms at most with runs of 8 frames
+#define VAD_HANGOVER_FRAMES 50  // 1 s
+
+#define VAD_SPEECH_DB 9         // above the noise floor: speech
+#define VAD_FRICATIVE_DB 4      // above the noise floor with a high zero crossing rate: s, sh, f
+#define VAD_FRICATIVE_ZCR 90    // zero crossings per 256 samples
+#define VAD_MIN_RMS 8           // quieter is never speech, whatever the floor
+
+struct vad
+{
+    int32_t noise_floor;        // log2 of the frame energy, q8
+    int32_t hangover;
+    uint32_t run_frames;        // frames of a run of the model
+    uint32_t emitted;           // frames let through, mod run_frames on closing
+    uint32_t held;              // frames held back, in front of the next one
+
+    // stats
+    uint32_t frame_num;
+    uint32_t skipped_num;       // frames that never went through the mfcc
+    uint32_t open_num;
+};
+
+// warmup_frames: the gate stays open for the first frames, which the model needs before
+// its outputs mean anything. The frames before are not there to be held back later
+void vad_init(struct vad *v, uint32_t run_frames, uint32_t warmup_frames);
+
+// samples: the new shift of the next frame, the held back frames are in front of it.
+// Return the frames, oldest first from the held back ones to this one, to run through
+// the mfcc now: 0 when the gate is closed. *release is the frames the caller can drop
+int vad_push_frame(struct vad *v, const int16_t *samples, int num, int *release);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_VAD_H_
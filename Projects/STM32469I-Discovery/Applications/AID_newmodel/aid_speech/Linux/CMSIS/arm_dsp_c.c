@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/CMSIS/arm_dsp_c.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   CMSIS-DSP real ffts in portable C
+  ******************************************************************************
+  * Both take the N real samples as N / 2 complex ones, do a radix-2 complex fft
+  * on them and split the result into the N / 2 + 1 bins of the real fft. As in
+  * CMSIS-DSP, the q15 one halves every stage and the split, so its output is
+  * scaled down by N.
+  ******************************************************************************
+  */
+
+#include <stdlib.h>
+
+#include "arm_math.h"
+
+static int valid_len(uint32_t len)
+{
+    return len >= 4 && len <= ARM_RFFT_MAX_LEN && (len & (len - 1)) == 0;
+}
+
+static void bit_reverse(void *data, int num, int elem_size)
+{
+    char tmp[sizeof(int32_t) * 2];
+    char *p = data;
+
+    for (int i = 1, j = 0; i < num; i++)
+    {
+        int bit = num >> 1;
+
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            memcpy(tmp, p + i * elem_size, elem_size);
+            memcpy(p + i * elem_size, p + j * elem_size, elem_size);
+            memcpy(p + j * elem_size, tmp, elem_size);
+        }
+    }
+}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+    if (!valid_len(fftLen))
+        return ARM_MATH_ARGUMENT_ERROR;
+
+    S->fftLenRFFT = fftLen;
+    for (int k = 0; k < fftLen / 2; k++)
+    {
+        S->twiddle[2 * k] = (float32_t)cos(2 * M_PI * k / fftLen);
+        S->twiddle[2 * k + 1] = (float32_t)sin(2 * M_PI * k / fftLen);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+    int n = S->fftLenRFFT;
+    int m = n / 2;
+    float32_t z[ARM_RFFT_MAX_LEN];
+
+    memcpy(z, p, sizeof(float32_t) * n);
+    bit_reverse(z, m, sizeof(float32_t) * 2);
+
+    // W_len^k is W_n^(k * n / len)
+    for (int len = 2; len <= m; len <<= 1)
+    {
+        int step = n / len;
+
+        for (int i = 0; i < m; i += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                float32_t wr = S->twiddle[2 * k * step], wi = -S->twiddle[2 * k * step + 1];
+                float32_t *a = z + 2 * (i + k), *b = z + 2 * (i + k + len / 2);
+                float32_t tr = b[0] * wr - b[1] * wi, ti = b[0] * wi + b[1] * wr;
+
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+
+    // X[k] = (Z[k] + Z*[m - k]) / 2 - j W^k (Z[k] - Z*[m - k]) / 2
+    pOut[0] = z[0] + z[1];
+    pOut[1] = z[0] - z[1];
+    for (int k = 1; k < m; k++)
+    {
+        float32_t zr = z[2 * k], zi = z[2 * k + 1];
+        float32_t cr = z[2 * (m - k)], ci = -z[2 * (m - k) + 1];
+        float32_t er = (zr + cr) / 2, ei = (zi + ci) / 2;
+        float32_t odd_r = (zi - ci) / 2, odd_i = -(zr - cr) / 2;
+        float32_t wr = S->twiddle[2 * k], wi = -S->twiddle[2 * k + 1];
+
+        pOut[2 * k] = er + odd_r * wr - odd_i * wi;
+        pOut[2 * k + 1] = ei + odd_r * wi + odd_i * wr;
+    }
+}
+
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag)
+{
+    if (!valid_len(fftLenReal) || ifftFlagR)
+        return ARM_MATH_ARGUMENT_ERROR;
+
+    S->fftLenReal = fftLenReal;
+    S->ifftFlagR = ifftFlagR;
+    S->bitReverseFlagR = bitReverseFlag;
+    for (uint32_t k = 0; k < fftLenReal / 2; k++)
+    {
+        S->twiddle[2 * k] = (q15_t)__SSAT((int32_t)lround(cos(2 * M_PI * k / fftLenReal) * 32768), 16);
+        S->twiddle[2 * k + 1] = (q15_t)__SSAT((int32_t)lround(sin(2 * M_PI * k / fftLenReal) * 32768), 16);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+void arm_rfft_q15(const arm_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst)
+{
+    int n = S->fftLenReal;
+    int m = n / 2;
+    q31_t z[ARM_RFFT_MAX_LEN];
+
+    for (int i = 0; i < n; i++)
+        z[i] = pSrc[i];
+    bit_reverse(z, m, sizeof(q31_t) * 2);
+
+    for (int len = 2; len <= m; len <<= 1)
+    {
+        int step = n / len;
+
+        for (int i = 0; i < m; i += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                q31_t wr = S->twiddle[2 * k * step], wi = -S->twiddle[2 * k * step + 1];
+                q31_t *a = z + 2 * (i + k), *b = z + 2 * (i + k + len / 2);
+                q31_t tr = (b[0] * wr - b[1] * wi) >> 15, ti = (b[0] * wi + b[1] * wr) >> 15;
+
+                b[0] = (a[0] - tr) >> 1;
+                b[1] = (a[1] - ti) >> 1;
+                a[0] = (a[0] + tr) >> 1;
+                a[1] = (a[1] + ti) >> 1;
+            }
+        }
+    }
+
+    // the split of arm_rfft_fast_f32(), with one more halving: Z holds X / m, the output X / n
+    for (int k = 0; k <= m; k++)
+    {
+        int a = k % m, b = (m - k) % m;
+        q31_t zr = z[2 * a], zi = z[2 * a + 1];
+        q31_t cr = z[2 * b], ci = -z[2 * b + 1];
+        q63_t er = zr + cr, ei = zi + ci;
+        q63_t odd_r = zi - ci, odd_i = cr - zr;
+        q63_t wr = k < m ? S->twiddle[2 * k] : -32768, wi = k < m ? -S->twiddle[2 * k + 1] : 0;
+
+        pDst[2 * k] = (q15_t)__SSAT((q31_t)((er * 32768 + odd_r * wr - odd_i * wi) >> 17), 16);
+        pDst[2 * k + 1] = (q15_t)__SSAT((q31_t)((ei * 32768 + odd_r * wi + odd_i * wr) >> 17), 16);
+    }
+
+    // the other half of the spectrum, as CMSIS-DSP gives it
+    for (int k = m + 1; k < n; k++)
+    {
+        pDst[2 * k] = pDst[2 * (n - k)];
+        pDst[2 * k + 1] = (q15_t)__SSAT(-pDst[2 * (n - k) + 1], 16);
+    }
+}
@@ -0,0 +1,108 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/CMSIS/arm_math.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   The part of CMSIS-DSP the app uses, in portable C for the host build
+  ******************************************************************************
+  * Same names, types and results as CMSIS-DSP, within rounding: the app and
+  * tengine-lite build unchanged against it. ARM_MATH_DSP is not defined, so the
+  * app takes its plain C paths instead of the SIMD intrinsics.
+  ******************************************************************************
+  */
+
+#ifndef _ARM_MATH_H
+#define _ARM_MATH_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+typedef float float32_t;
+typedef double float64_t;
+
+typedef enum
+{
+    ARM_MATH_SUCCESS = 0,
+    ARM_MATH_ARGUMENT_ERROR = -1,
+    ARM_MATH_LENGTH_ERROR = -2,
+    ARM_MATH_SIZE_MISMATCH = -3,
+    ARM_MATH_NANINF = -4,
+    ARM_MATH_SINGULAR = -5,
+    ARM_MATH_TEST_FAILURE = -6
+} arm_status;
+
+#define PI 3.14159265358979f
+
+// the longest real fft of the host build
+#define ARM_RFFT_MAX_LEN 1024
+
+static inline int32_t __SSAT(int32_t val, uint32_t sat)
+{
+    int32_t max = (int32_t)((1u << (sat - 1)) - 1);
+    int32_t min = -max - 1;
+
+    return val > max ? max : (val < min ? min : val);
+}
+
+static inline uint32_t __USAT(int32_t val, uint32_t sat)
+{
+    int32_t max = (int32_t)((1u << sat) - 1);
+
+    return val > max ? (uint32_t)max : (val < 0 ? 0 : (uint32_t)val);
+}
+
+static inline uint32_t __CLZ(uint32_t val)
+{
+    return val ? (uint32_t)__builtin_clz(val) : 32;
+}
+
+// the twiddles are cos and sin of 2 * pi * k / fftLenReal, for k < fftLenReal / 2
+typedef struct
+{
+    uint16_t fftLenRFFT;
+    float32_t twiddle[ARM_RFFT_MAX_LEN];
+} arm_rfft_fast_instance_f32;
+
+typedef struct
+{
+    uint32_t fftLenReal;
+    uint8_t ifftFlagR;
+    uint8_t bitReverseFlagR;
+    q15_t twiddle[ARM_RFFT_MAX_LEN];
+} arm_rfft_instance_q15;
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+
+// forward only: p[0] is the real part of bin 0, p[1] the one of bin fftLen / 2, then re, im of bins 1 to fftLen / 2 - 1
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag);
+
+// forward only: re, im of all the fftLenReal bins, scaled down by fftLenReal
+void arm_rfft_q15(const arm_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst);
+
+static inline arm_status arm_sqrt_f32(float32_t in, float32_t *pOut)
+{
+    if (in >= 0.0f)
+    {
+        *pOut = sqrtf(in);
+        return ARM_MATH_SUCCESS;
+    }
+
+    *pOut = 0.0f;
+    return ARM_MATH_ARGUMENT_ERROR;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_ARM_MATH_H
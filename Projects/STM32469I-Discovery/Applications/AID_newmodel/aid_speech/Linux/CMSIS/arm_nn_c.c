@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/CMSIS/arm_nn_c.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   CMSIS-NN fully connected, relu and softmax in portable C
+  ******************************************************************************
+  */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+arm_status arm_fully_connected_q7(const q7_t *pV, const q7_t *pM, const uint16_t dim_vec, const uint16_t num_of_rows,
+                                  const uint16_t bias_shift, const uint16_t out_shift, const q7_t *bias, q7_t *pOut,
+                                  q15_t *vec_buffer)
+{
+    for (int i = 0; i < num_of_rows; i++)
+    {
+        int ip_out = ((q31_t)(bias[i]) << bias_shift) + NN_ROUND(out_shift);
+
+        for (int j = 0; j < dim_vec; j++)
+            ip_out += pV[j] * pM[i * dim_vec + j];
+
+        pOut[i] = (q7_t)__SSAT((ip_out >> out_shift), 8);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+void arm_relu_q7(q7_t *data, uint16_t size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+    }
+}
+
+// 2 based: the inputs are log2 of the likelihoods, the ones 8 or more below the max count as 0
+void arm_softmax_q7(const q7_t *vec_in, const uint16_t dim_vec, q7_t *p_out)
+{
+    q31_t sum = 0;
+    q15_t base = -257;
+
+    for (int i = 0; i < dim_vec; i++)
+    {
+        if (vec_in[i] > base)
+            base = vec_in[i];
+    }
+
+    base = base - 8;
+
+    for (int i = 0; i < dim_vec; i++)
+    {
+        if (vec_in[i] > base)
+            sum += 0x1 << __USAT(vec_in[i] - base, 5);
+    }
+
+    // (1 << 20) / sum
+    int output_base = 0x100000 / sum;
+
+    for (int i = 0; i < dim_vec; i++)
+    {
+        if (vec_in[i] > base)
+            p_out[i] = (q7_t)__SSAT((output_base >> __USAT(13 + base - vec_in[i], 5)), 8);
+        else
+            p_out[i] = 0;
+    }
+}
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/CMSIS/arm_nnfunctions.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   The part of CMSIS-NN the app uses, in portable C for the host build
+  ******************************************************************************
+  * The conv and the max pool are the ones of Src/, the others are in arm_nn_c.c:
+  * the reference code of CMSIS-NN, bit exact with its SIMD versions.
+  ******************************************************************************
+  */
+
+#ifndef _ARM_NNFUNCTIONS_H
+#define _ARM_NNFUNCTIONS_H
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define NN_ROUND(out_shift) ((0x1u << out_shift) >> 1)
+
+arm_status arm_convolve_HWC_q7_nonsquare(const q7_t *Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                         const uint16_t ch_im_in, const q7_t *wt, const uint16_t ch_im_out,
+                                         const uint16_t dim_kernel_x, const uint16_t dim_kernel_y,
+                                         const uint16_t padding_x, const uint16_t padding_y, const uint16_t stride_x,
+                                         const uint16_t stride_y, const q7_t *bias, const uint16_t bias_shift,
+                                         const uint16_t out_shift, q7_t *Im_out, const uint16_t dim_im_out_x,
+                                         const uint16_t dim_im_out_y, q15_t *bufferA, q7_t *bufferB);
+
+void arm_maxpool_HWC_q7_nonsquare(q7_t *Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                  const uint16_t ch_im_in, const uint16_t dim_kernel, const uint16_t padding,
+                                  const uint16_t stride, const uint16_t dim_im_out_x, const uint16_t dim_im_out_y,
+                                  q7_t *bufferA, q7_t *Im_out);
+
+arm_status arm_fully_connected_q7(const q7_t *pV, const q7_t *pM, const uint16_t dim_vec, const uint16_t num_of_rows,
+                                  const uint16_t bias_shift, const uint16_t out_shift, const q7_t *bias, q7_t *pOut,
+                                  q15_t *vec_buffer);
+
+void arm_relu_q7(q7_t *data, uint16_t size);
+
+void arm_softmax_q7(const q7_t *vec_in, const uint16_t dim_vec, q7_t *p_out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif //_ARM_NNFUNCTIONS_H
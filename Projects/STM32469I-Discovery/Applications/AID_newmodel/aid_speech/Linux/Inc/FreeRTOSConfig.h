@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/Inc/FreeRTOSConfig.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   FreeRTOS configuration of the host build, on the POSIX port
+  ******************************************************************************
+  * The tasks of the app keep the priorities of the board. Each one is a pthread:
+  * the stack depths are in words of 8 bytes and no less than PTHREAD_STACK_MIN.
+  ******************************************************************************
+  */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+#include <assert.h>
+
+extern uint32_t SystemCoreClock;
+
+#define configUSE_PREEMPTION           1
+#define configUSE_IDLE_HOOK            0
+#define configUSE_TICK_HOOK            0
+#define configCPU_CLOCK_HZ             ( SystemCoreClock )
+#define configTICK_RATE_HZ             ( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES           (  8 )
+#define configMINIMAL_STACK_SIZE       ( ( uint16_t ) 4096 )
+#define configTOTAL_HEAP_SIZE          ( ( size_t ) ( 4 * 1024 * 1024 ) ) /* unused by heap_3 */
+#define configMAX_TASK_NAME_LEN        ( 16 )
+#define configUSE_TRACE_FACILITY       1
+#define configUSE_16_BIT_TICKS         0
+#define configIDLE_SHOULD_YIELD        1
+#define configUSE_MUTEXES              1
+#define configQUEUE_REGISTRY_SIZE      8
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_RECURSIVE_MUTEXES    1
+#define configUSE_MALLOC_FAILED_HOOK   0
+#define configUSE_APPLICATION_TASK_TAG 0
+#define configUSE_COUNTING_SEMAPHORES  1
+#define configGENERATE_RUN_TIME_STATS  0
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#define configSUPPORT_STATIC_ALLOCATION  0
+
+#define configENABLE_BACKWARD_COMPATIBILITY 0
+
+/* the POSIX port picks the next task in C */
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES             0
+#define configMAX_CO_ROUTINE_PRIORITIES   ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS             1
+#define configTIMER_TASK_PRIORITY    ( 2 )
+#define configTIMER_QUEUE_LENGTH     10
+#define configTIMER_TASK_STACK_DEPTH ( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet       1
+#define INCLUDE_uxTaskPriorityGet      1
+#define INCLUDE_vTaskDelete            1
+#define INCLUDE_vTaskCleanUpResources  1
+#define INCLUDE_vTaskSuspend           1
+#define INCLUDE_vTaskDelayUntil        1
+#define INCLUDE_xTaskDelayUntil        1
+#define INCLUDE_vTaskDelay             1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+
+#define configASSERT( x ) assert( x )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,23 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/Inc/cmsis_os.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   The CMSIS-RTOS names the app uses, on the FreeRTOS API
+  ******************************************************************************
+  * The CMSIS-RTOS layer of Middlewares/Third_Party/FreeRTOS reads the Cortex-M
+  * registers: the host build takes the FreeRTOS API directly.
+  ******************************************************************************
+  */
+
+#ifndef _CMSIS_OS_H
+#define _CMSIS_OS_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+typedef TaskHandle_t osThreadId;
+
+#define osDelay(ms) vTaskDelay(pdMS_TO_TICKS(ms))
+
+#endif //_CMSIS_OS_H
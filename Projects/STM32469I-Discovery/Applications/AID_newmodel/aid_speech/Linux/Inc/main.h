@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/Inc/main.h
+  * @author  OPEN AI LAB Audio Team
+  * @brief   What the app takes from main.h, without the board
+  ******************************************************************************
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+
+// the mic dma buffer of the board: the host feeds a half of it at a time
+#define AUDIO_IN_PCM_BUFFER_SIZE                   4*2304 /* buffer size in half-word */
+
+// 1 MHz: the perf clock of the host counts us
+extern uint32_t SystemCoreClock;
+
+int tprintf(const char * str, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Linux/Src/host_main.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   The mic of the board, from a wav file, for the host build
+  ******************************************************************************
+  * The mic task takes the place of hardware_record_task() of test.c: the file,
+  * resampled to 16 kHz, comes in stereo blocks of half the dma buffer, goes
+  * through the decimator and into AwakenBuffMicData(), as on the board.
+  *
+  * At speed 1 a block comes every 144 ms, as the dma gives them; at speed x,
+  * x times faster, the mic ring drops what the record task has not taken.
+  * At speed 0 the blocks come as fast as the mic ring takes them, with no drop.
+  * Then one second of silence flushes the last runs, and the wake ups, the
+  * drops and the time of the run are printed.
+  *
+  * Usage: aid_speech [-x speed] [-t threshold] [-h hop] [-s silence_s] <16 bit pcm wav>
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "cmsis_os.h"
+#include "main.h"
+#include "command_recognition.h"
+#include "cnn.h"
+#include "mfcc.h"
+#include "vad.h"
+#include "decimator.h"
+#include "spsc_ring.h"
+#include "tengine_c_api.h"
+#include "wav_load.h"
+
+#define MIC_FREQ (SAMP_FREQ * 2) // the decimator halves the rate of the mic
+#define MIC_BLOCK_FRAMES (AUDIO_IN_PCM_BUFFER_SIZE / 4) // stereo frames in a half of the dma buffer
+#define MIC_BLOCK_SAMPLES (MIC_BLOCK_FRAMES / 2)
+#define MIC_TASK_PRIORITY 6 // above the tasks of the app, as the dma interrupt
+
+// the rings of command_recognition.c, for the pace of speed 0 and the end of the run
+extern struct spsc_ring mic_fifo;
+extern struct spsc_ring mfcc_fifo;
+extern volatile bool mfcc_ready;
+
+uint32_t SystemCoreClock = 1000000;
+
+static const char *wav_path;
+static double speed = 1;
+static int threshold = 90;
+static int hop = CONV_DATA_LEN;
+static double silence_s = 1;
+static int ret = 0;
+
+static volatile int fed_samples = 0; // at 8 kHz
+static int wakeup_num = 0;
+
+static double get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static uint32_t host_perf_clock(void)
+{
+    return (uint32_t)(uint64_t)get_time_us();
+}
+
+int tprintf(const char *str, ...)
+{
+    va_list args;
+    int num;
+
+    va_start(args, str);
+    num = vprintf(str, args);
+    va_end(args);
+
+    return num;
+}
+
+int show_on_lcd(char *info)
+{
+    return printf("%s", info);
+}
+
+static void on_wakeup(int id)
+{
+    wakeup_num++;
+    printf("wake up %d: keyword %d, %.2f s of the mic fed\n", wakeup_num, id, (double)fed_samples / SAMP_FREQ);
+}
+
+static void wait_us(double until_us)
+{
+    double now = get_time_us();
+
+    if (until_us > now)
+        vTaskDelay(pdMS_TO_TICKS((until_us - now) / 1000));
+}
+
+static void feed_block(struct decimator *d, const int16_t *pcm, double *next_us)
+{
+    static int16_t stereo[MIC_BLOCK_FRAMES * 2];
+    static int16_t mono[MIC_BLOCK_SAMPLES];
+
+    for (int i = 0; i < MIC_BLOCK_FRAMES; i++)
+    {
+        stereo[2 * i] = pcm[i];
+        stereo[2 * i + 1] = pcm[i];
+    }
+
+    int sample_num = decimator_stereo_to_mono(d, stereo, MIC_BLOCK_FRAMES, mono);
+
+    if (speed > 0)
+    {
+        *next_us += 1e6 * MIC_BLOCK_FRAMES / MIC_FREQ / speed;
+        wait_us(*next_us);
+    }
+    else
+    {
+        while (spsc_ring_free_len(&mic_fifo) < sample_num * sizeof(int16_t))
+            vTaskDelay(1);
+    }
+
+    AwakenBuffMicData(mono, sample_num);
+    fed_samples += sample_num;
+}
+
+static void mic_task(void const *argument)
+{
+    int sample_num = 0;
+    int16_t *wav = load_wav(wav_path, MIC_FREQ, 1.0f, &sample_num);
+    struct decimator *d = malloc(sizeof(struct decimator));
+
+    if (wav == NULL || d == NULL)
+    {
+        printf("cannot load %s\n", wav_path);
+        ret = -1;
+        goto quit;
+    }
+
+    decimator_init(d);
+    set_perf_clock(host_perf_clock, SystemCoreClock / 1000);
+
+    if ((hop != CONV_DATA_LEN && AwakenSetHop(hop) < 0) || AwakenInit(on_wakeup, threshold, 5) != 0)
+    {
+        printf("AwakenInit failed\n");
+        ret = -1;
+        goto quit;
+    }
+
+    // the data is dropped until the decode task has loaded the graph
+    while (!mfcc_ready)
+        vTaskDelay(10);
+
+    int silence_num = (int)(silence_s * MIC_FREQ);
+    int16_t *pcm = calloc(sample_num + silence_num + MIC_BLOCK_FRAMES, sizeof(int16_t));
+    double start_us = get_time_us();
+    double next_us = start_us;
+
+    memcpy(pcm, wav, sizeof(int16_t) * sample_num);
+    for (int pos = 0; pos < sample_num + silence_num; pos += MIC_BLOCK_FRAMES)
+        feed_block(d, pcm + pos, &next_us);
+
+    // the record task keeps up to a window of frames, the decode task less than a run
+    for (int i = 0; i < 1000; i++)
+    {
+        if (spsc_ring_data_len(&mic_fifo) < MIC_BLOCK_SAMPLES * sizeof(int16_t) &&
+            spsc_ring_data_len(&mfcc_fifo) < NUM_MFCC_COEFFS * CONV_DATA_LEN)
+            break;
+        vTaskDelay(1);
+    }
+
+    double time_us = get_time_us() - start_us;
+    unsigned int frame_num, skipped_num, mic_drops, mfcc_drops, batch_num, batch_runs;
+
+    AwakenGetVadStat(&frame_num, &skipped_num);
+    AwakenGetDropStat(&mic_drops, &mfcc_drops);
+    AwakenGetCatchUpStat(&batch_num, &batch_runs);
+    AwakenDestory();
+
+    printf("%s: %.2f s of audio in %.2f s (%.1fx real time), %d wake ups\n", wav_path,
+           (double)fed_samples / SAMP_FREQ, time_us / 1e6, fed_samples * 1e6 / SAMP_FREQ / time_us, wakeup_num);
+    printf("vad: %u of %u frames skipped\n", skipped_num, frame_num);
+    printf("dropped: %u mic samples, %u mfcc frames; caught up %u runs in %u batches\n", mic_drops, mfcc_drops,
+           batch_runs, batch_num);
+
+    free(pcm);
+quit:
+    free(d);
+    free(wav);
+    fflush(stdout);
+    vTaskEndScheduler();
+    vTaskDelete(NULL);
+}
+
+int main(int argc, char *argv[])
+{
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-x") == 0)
+            speed = atof(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-t") == 0)
+            threshold = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-h") == 0)
+            hop = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-s") == 0)
+            silence_s = atof(argv[arg + 1]);
+        else
+            break;
+    }
+
+    if (arg + 1 != argc)
+    {
+        printf("usage: %s [-x speed] [-t threshold] [-h hop] [-s silence_s] <16 bit pcm wav>\n", argv[0]);
+        return -1;
+    }
+
+    wav_path = argv[arg];
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    if (xTaskCreate((TaskFunction_t)mic_task, "mic", configMINIMAL_STACK_SIZE * 2, NULL, MIC_TASK_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("mic task create error\n");
+        return -1;
+    }
+
+    vTaskStartScheduler();
+
+    return ret;
+}
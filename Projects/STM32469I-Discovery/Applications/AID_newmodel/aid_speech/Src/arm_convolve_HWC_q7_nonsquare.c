@@ -335,11 +335,7 @@ arm_status arm_convolve_HWC_q7_nonsquare(const q7_t * Im_in,
     int       conv_out;
     int       in_row, in_col;
 
-    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
-    {
-        /* check if the input dimension meets the constraints */
-        return ARM_MATH_SIZE_MISMATCH;
-    }
+    /* no constraint on the dimensions, as in the code above: the first conv of the model has one input channel */
 
     for (i = 0; i < ch_im_out; i++)
     {
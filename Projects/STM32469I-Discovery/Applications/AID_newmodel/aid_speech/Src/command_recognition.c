@@ -9,51 +9,93 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
 
 #include "cmsis_os.h"
 #include "main.h"
 #include "command_recognition.h"
 #include "cnn.h"
 #include "mfcc.h"
+#include "kws_score.h"
+#include "spsc_ring.h"
+#include "vad.h"
 #include "tengine_c_api.h"
 #include "tengine_task.h"
 
-#define PREPROCESS_LEN_BYTE (320)
-#define WINDOW_SIZE (3)
+// set to 1 to print the mfcc time and the per node perf stats of the graph.
+// With MFCC_COMPARE set in mfcc.h, the other mfcc pipeline also runs on every frame
+// and its time and distance to the one in use are printed too
+#define AID_PERF_STAT 0
+#define AID_PERF_STAT_PERIOD 100 // in runs of the graph
+
+// set to 0 to run the mfcc and the graph on silence too
+#define AID_VAD 1
+
+// set to 1 to run the speech model only when the first stage of tiny_stage1_graph_generated.c
+// scored cascade_threshold or more in the last CASCADE_HOLD_RUNS runs. The first stage is
+// distilled from the speech model by Scripts/stage1_distill.c; distill it on the keywords and
+// other speech of the product before turning the cascade on
+#define AID_CASCADE 0
+#define CASCADE_HOLD_RUNS 6
+
+#if AID_CASCADE && AID_AOT_PLAN
+#error "the first stage of the cascade runs as a graph, in the tengine AID_AOT_PLAN leaves out"
+#endif
+
+// when it wakes, the speech model catches up on the runs it missed, up to the ones its outputs
+// depend on: then it scores as if it had run on every run. Measured with Scripts/cascade_replay.c
+#define FEATURE_HISTORY_RUNS (GRAPH_WARMUP_RUNS + 2)
+
+// when the decode task falls behind the mfcc, each graph of the speech model takes up to
+// MAX_CATCH_UP_RUNS of its runs at once: the move nodes go over every one of them, the layers
+// after them and PostProcess() only over the last one, see run_speech_model_chunks()
+#define MAX_CATCH_UP_RUNS 8
+
+#if AID_CASCADE
+#define FEATURE_WINDOW_RUNS (FEATURE_HISTORY_RUNS + 1)
+#define FEATURE_RING_BYTES 4096
+#else
+#define FEATURE_WINDOW_RUNS (MAX_CATCH_UP_RUNS + 1)
+#define FEATURE_RING_BYTES 2048
+#endif
+#define FEATURE_WINDOW_BYTES (FEATURE_WINDOW_RUNS * NUM_MFCC_COEFFS * CONV_DATA_LEN)
+
+// the longest mic window: the frames the voice activity gate holds back, then a frame
+#if AID_VAD
+#define MIC_WINDOW_BYTES (((VAD_PREROLL_FRAMES + CONV_DATA_LEN - 1) * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN) * 2)
+#else
+#define MIC_WINDOW_BYTES (MFCC_FRAME_LEN * 2)
+#endif
 
 // threshold for CallBack
 int awaken_threshold = 90;
 
+// threshold of the first stage, out of 128
+int cascade_threshold = 24;
+
+// the hop of the next AwakenInit()
+static int hop_frames = CONV_DATA_LEN;
+
 //for record_task
 #define MFCC_LEN (NUM_FRAMES * NUM_MFCC_COEFFS)
-char pcm_buf[320 * 2];
-float mfcc_buf[NUM_MFCC_COEFFS];
-float mfcc_buf_test[NUM_MFCC_COEFFS] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0};
+q7_t mfcc_buf[NUM_MFCC_COEFFS];
 
 volatile bool run_flag = false;
 volatile bool record_stop_flag = false;
 volatile bool decode_stop_flag = false;
 volatile bool need_pause = false;
 volatile bool mfcc_ready = false;
+volatile bool feature_format_ready = false;
 
-//fifo
-typedef struct
-{
-    char *fifo_buf;                  // = NULL;
-    volatile unsigned int read_ptr;  // = 0;
-    volatile unsigned int write_ptr; // = 0;
-    unsigned int fifo_max_len;       // = 0;
-    unsigned int need_len;
-    SemaphoreHandle_t fifo_sem;
-} FIFI_WITH_SEM;
+// the model was trained on the mfcc with the coefficients after the first one doubled:
+// fraction bits of each coefficient on top of the ones of the graph input tensor
+static const int8_t feature_frac_bits[NUM_MFCC_COEFFS] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+#if INPUT_FEATURE_DIM_W != NUM_MFCC_COEFFS
+#error "the mfcc frames are the rows of the graph input"
+#endif
 
 int show_on_lcd(char *info);
-void Fifo_Init(FIFI_WITH_SEM *fifo, int max_len);
-void Fifo_Free(FIFI_WITH_SEM *fifo);
-int Fifo_Write(FIFI_WITH_SEM *fifo, char *data, int len);
-int Fifo_Read(FIFI_WITH_SEM *fifo, char *data, int len, int shift_len);
-void Fifo_Reset(FIFI_WITH_SEM *fifo);
-int Fifo_Data_Len(FIFI_WITH_SEM *fifo);
 
 AwakenCallback call_back = NULL;
 void aid_record_task(void const *argument);
@@ -64,40 +106,104 @@ char *aid_record_task_name = "aid_record_thread";
 char *aid_decode_task_name = "aid_decode_thread";
 static char info[100];
 
-FIFI_WITH_SEM mic_fifo;
+// pcm of the mic, read a frame at a time; q7 mfcc frames, read CONV_DATA_LEN at a time behind
+// the history of the cascade
+struct spsc_ring mic_fifo;
 #if USE_WEBRTC_AECM
-FIFI_WITH_SEM spk_fifo;
+struct spsc_ring spk_fifo;
 #endif
-FIFI_WITH_SEM mfcc_fifo;
+struct spsc_ring mfcc_fifo;
 volatile bool spk_isopen = false;
 
+#if AID_VAD
+static struct vad vad;
+#endif
+
+// stats: mic samples and mfcc frames dropped on a full ring, the runs of the speech model
+// taken in catch up batches and those batches
+static volatile uint32_t mic_drop_num = 0;
+static volatile uint32_t mfcc_drop_num = 0;
+static volatile uint32_t catch_up_run_num = 0;
+static volatile uint32_t catch_up_num = 0;
+
+#if AID_CASCADE
+// stats: runs of the first stage and of the speech model
+static volatile uint32_t cascade_run_num = 0;
+static volatile uint32_t speech_run_num = 0;
+#endif
+
+// the consumer of a ring blocks on a binary semaphore given by every commit.
+// Producers do not wait: a full ring drops what is written
+static void ring_wake(struct spsc_ring *ring, volatile uint32_t *index)
+{
+    if (index == &ring->head)
+        xSemaphoreGive((SemaphoreHandle_t)ring->notify_arg);
+}
+
+static int ring_wait(struct spsc_ring *ring, volatile uint32_t *index, uint32_t seen, uint32_t timeout)
+{
+    TickType_t ticks = timeout == SPSC_RING_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+
+    return xSemaphoreTake((SemaphoreHandle_t)ring->notify_arg, ticks) == pdTRUE ? 0 : -1;
+}
+
+static const struct spsc_ring_notify ring_notify = {ring_wake, ring_wait};
+
+static int Ring_Init(struct spsc_ring *ring, uint32_t size, uint32_t max_span)
+{
+    SemaphoreHandle_t sem = xSemaphoreCreateBinary();
+
+    if (sem == NULL)
+        return -1;
+
+    if (spsc_ring_init(ring, size, max_span, &ring_notify, sem) < 0)
+    {
+        vSemaphoreDelete(sem);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void Ring_Free(struct spsc_ring *ring)
+{
+    vSemaphoreDelete((SemaphoreHandle_t)ring->notify_arg);
+    spsc_ring_free(ring);
+}
+
 int AwakenInit(AwakenCallback cb, int threshold, int task_priority)
 {
     tprintf("start AwakenInit\n");
 
     call_back = cb;
     awaken_threshold = threshold;
-    Fifo_Init(&mic_fifo, 8192);
+    // a window is the frames the gate holds back and a new one, or all the frames of a run
+    if (Ring_Init(&mic_fifo, 8192, MIC_WINDOW_BYTES) < 0 ||
 #if USE_WEBRTC_AECM
-    Fifo_Init(&spk_fifo, 4096);
+        Ring_Init(&spk_fifo, 4096, MFCC_FRAME_LEN * 2) < 0 ||
 #endif
-    Fifo_Init(&mfcc_fifo, 4096);
+        Ring_Init(&mfcc_fifo, FEATURE_RING_BYTES, FEATURE_WINDOW_BYTES) < 0)
+    {
+        tprintf("awaken fifo create error\n");
+        return -1;
+    }
 
     run_flag = true;
+    feature_format_ready = false;
     record_stop_flag = false;
     decode_stop_flag = false;
 
     if (xTaskCreate((TaskFunction_t)aid_record_task, aid_record_task_name, configMINIMAL_STACK_SIZE * 2, NULL, 5, NULL) != pdPASS)
     {
         tprintf("aid_record_thread create error\n");
-        return NULL;
+        return -1;
     }
     tprintf("aid_record_thread create success\n");
 
     if (xTaskCreate((TaskFunction_t)aid_decode_task, aid_decode_task_name, configMINIMAL_STACK_SIZE * 4, NULL, 5, NULL) != pdPASS)
     {
         tprintf("aid_record_thread create error\n");
-        return NULL;
+        return -1;
     }
 
     tprintf("aid_decode_thread create success\n");
@@ -114,7 +220,7 @@ int AwakenFillBuffer(void)
     // for quit decode task
     for (int i = 0; i < 98; i++)
     {
-        Fifo_Write(&mfcc_fifo, temp_buf, NUM_MFCC_COEFFS);
+        spsc_ring_write(&mfcc_fifo, temp_buf, NUM_MFCC_COEFFS);
     }
     return 0;
 }
@@ -124,8 +230,13 @@ int AwakenDestory(void)
 {
     run_flag = 0;
 
-    short junk_data[160];
-    AwakenBuffMicData(junk_data, 160);
+    // a whole window, for the record task to wake up
+    short junk_data[MFCC_FRAME_LEN];
+    memset(junk_data, 0, sizeof(junk_data));
+    for (int i = 0; i < MIC_WINDOW_BYTES / sizeof(junk_data) + 1; i++)
+    {
+        AwakenBuffMicData(junk_data, MFCC_FRAME_LEN);
+    }
 
     while (record_stop_flag == false)
     {
@@ -136,11 +247,11 @@ int AwakenDestory(void)
         vTaskDelay(100);
     }
 
-    Fifo_Free(&mic_fifo);
+    Ring_Free(&mic_fifo);
 #if USE_WEBRTC_AECM
-    Fifo_Free(&spk_fifo);
+    Ring_Free(&spk_fifo);
 #endif
-    Fifo_Free(&mfcc_fifo);
+    Ring_Free(&mfcc_fifo);
     tprintf("Awaken destroy done!!!\n");
     return 0;
 }
@@ -151,7 +262,12 @@ int AwakenBuffMicData(short *data, int len)
     if (mfcc_ready)
     {
         //show_on_lcd("AwakenBuffMicData!!!\n");
-        return Fifo_Write(&mic_fifo, (char *)data, len * 2);
+        if (spsc_ring_write(&mic_fifo, data, len * 2) < 0)
+        {
+            mic_drop_num += len;
+            return -1;
+        }
+        return 0;
     }
     else
     {
@@ -160,12 +276,67 @@ int AwakenBuffMicData(short *data, int len)
     }
 }
 
+int AwakenGetVadStat(unsigned int *frame_num, unsigned int *skipped_num)
+{
+#if AID_VAD
+    *frame_num = vad.frame_num;
+    *skipped_num = vad.skipped_num;
+#else
+    *frame_num = 0;
+    *skipped_num = 0;
+#endif
+    return 0;
+}
+
+int AwakenGetDropStat(unsigned int *mic_samples, unsigned int *mfcc_frames)
+{
+    *mic_samples = mic_drop_num;
+    *mfcc_frames = mfcc_drop_num;
+    return 0;
+}
+
+int AwakenGetCatchUpStat(unsigned int *batch_num, unsigned int *run_num)
+{
+    *batch_num = catch_up_num;
+    *run_num = catch_up_run_num;
+    return 0;
+}
+
+int AwakenSetHop(int frames)
+{
+    // the history of the cascade is kept for the runs of one graph
+    if (run_flag || frames < MIN_HOP_FRAMES || frames > CONV_DATA_LEN || CONV_DATA_LEN % frames != 0 ||
+        (AID_CASCADE && frames != CONV_DATA_LEN))
+        return -1;
+
+    hop_frames = frames;
+    return 0;
+}
+
+int AwakenSetCascadeThreshold(int threshold)
+{
+    cascade_threshold = threshold;
+    return 0;
+}
+
+int AwakenGetCascadeStat(unsigned int *run_num, unsigned int *speech_model_num)
+{
+#if AID_CASCADE
+    *run_num = cascade_run_num;
+    *speech_model_num = speech_run_num;
+#else
+    *run_num = 0;
+    *speech_model_num = 0;
+#endif
+    return 0;
+}
+
 int AwakenBuffSpkData(short *data, int len)
 {
 #if USE_WEBRTC_AECM
     if (mfcc_ready)
     {
-        return Fifo_Write(&spk_fifo, (char *)data, len * 2);
+        return spsc_ring_write(&spk_fifo, data, len * 2);
     }
     else
     {
@@ -188,284 +359,220 @@ int AwakenSpkSwitchNotify(bool is_open, int sample_rate)
     else
     {
         spk_sample_rate = 0;
-        Fifo_Reset(&spk_fifo);
+        spsc_ring_reset(&spk_fifo);
     }
 #endif //USE_WEBRTC_AECM
     return 0;
 }
 
-void PostProcess(int *score)
+// the wake up of the scores of a run, if any, to the callback and the lcd
+void PostProcess(struct kws_score *score, const q7_t *run_output)
 {
-#define MISS_THRESHOLD (2)
-    static long wakeup_times = 0;
-    static int miss_times = 0;
-    static bool wakeup_flag = false;
+    int j = kws_score_push(score, run_output, awaken_threshold);
 
-    for (int j = 1; j < OUT_DIM; j++)
+    if (j == 0)
+        return;
+
+    if (call_back == NULL)
+    {
+        show_on_lcd("callback function is NULL\n");
+        return;
+    }
+
+    (*call_back)(j);
+
+    char output[32] = {0};
+    int value = score->smoothed_score[j];
+    switch(j)
     {
-        if ((score[j] > awaken_threshold))
+        case 1:
         {
-            miss_times = 0;
-            if (!wakeup_flag)
-            {
-                wakeup_flag = true;
-                wakeup_times++;
-
-                if (call_back == NULL)
-                {
-                    show_on_lcd("callback function is NULL\n");
-                    return;
-                }
-                
-                (*call_back)(j);
-                
-                char output[32] = {0};
-                switch(j)
-                {
-                    case 1:
-                    {
-                        show_on_lcd("Xiaozhi is here.\n");
-                        break;
-                    }
-                    case 2:
-                    {
-                        show_on_lcd("Dakai Chuanglian.\n");
-                        break;
-                    }
-                    case 3:
-                    {
-                        show_on_lcd("Guanbi Chuanglian.\n");
-                        break;
-                    }
-                    case 4:
-                    {
-                        show_on_lcd("Dakai Kongtiao.\n");
-                        break;
-                    }
-                    case 5:
-                    {
-                        show_on_lcd("Guanbi Kongtiao.\n");
-                        break;
-                    }
-                    case 6:
-                    {
-                        show_on_lcd("Jiare Moshi.\n");
-                        break;
-                    }
-                    case 7:
-                    {
-                        show_on_lcd("Zhileng Moshi.\n");
-                        break;
-                    }
-                    case 8:
-                    {
-                        show_on_lcd("Jiangdi Wendu.\n");
-                        break;
-                    }
-                    case 9:
-                    {
-                        show_on_lcd("Tiaogao Wendu.\n");
-                        break;
-                    }
-                    case 10:
-                    {
-                        show_on_lcd("Kaiqi Saofeng.\n");
-                        break;
-                    }
-                    case 11:
-                    {
-                        show_on_lcd("Qidong Kongtiao.\n");
-                        break;
-                    }
-                    default:
-                        sprintf(output, "Score id %d is %d.\n", j, score[j]);
-                    show_on_lcd(output);
-                }
-            }
+            show_on_lcd("Xiaozhi is here.\n");
+            break;
         }
-        else
+        case 2:
         {
-            miss_times++;
-            if ((miss_times > MISS_THRESHOLD * OUT_DIM) && (wakeup_flag))
-            {
-                wakeup_flag = false;
-            }
+            show_on_lcd("Dakai Chuanglian.\n");
+            break;
+        }
+        case 3:
+        {
+            show_on_lcd("Guanbi Chuanglian.\n");
+            break;
+        }
+        case 4:
+        {
+            show_on_lcd("Dakai Kongtiao.\n");
+            break;
+        }
+        case 5:
+        {
+            show_on_lcd("Guanbi Kongtiao.\n");
+            break;
+        }
+        case 6:
+        {
+            show_on_lcd("Jiare Moshi.\n");
+            break;
+        }
+        case 7:
+        {
+            show_on_lcd("Zhileng Moshi.\n");
+            break;
+        }
+        case 8:
+        {
+            show_on_lcd("Jiangdi Wendu.\n");
+            break;
         }
+        case 9:
+        {
+            show_on_lcd("Tiaogao Wendu.\n");
+            break;
+        }
+        case 10:
+        {
+            show_on_lcd("Kaiqi Saofeng.\n");
+            break;
+        }
+        case 11:
+        {
+            show_on_lcd("Qidong Kongtiao.\n");
+            break;
+        }
+        default:
+            sprintf(output, "Score id %d is %d.\n", j, value);
+        show_on_lcd(output);
     }
 }
 
-void Fifo_Init(FIFI_WITH_SEM *fifo, int max_len)
+#if AID_PERF_STAT
+struct mfcc_time
 {
-    fifo->fifo_max_len = max_len;
-    fifo->read_ptr = 0;
-    fifo->write_ptr = 0;
-    fifo->need_len = 0;
-    fifo->fifo_buf = calloc(max_len, sizeof(char));
-    fifo->fifo_sem = xSemaphoreCreateCounting(3, 0);
-}
+    const char *name;
+    uint32_t count;
+    uint32_t min_time;
+    uint32_t max_time;
+    uint64_t total_time;
+};
 
-void Fifo_Free(FIFI_WITH_SEM *fifo)
-{
-    vSemaphoreDelete(fifo->fifo_sem);
-    free(fifo->fifo_buf);
-}
+static struct mfcc_time mfcc_time = {MFCC_FIXED_POINT ? "q15" : "f32"};
 
-int Fifo_Data_Len(FIFI_WITH_SEM *fifo)
+static void record_mfcc_time(struct mfcc_time *t, uint32_t used_time)
 {
-    return (fifo->write_ptr - fifo->read_ptr);
-}
+    uint32_t base = get_perf_clock_base();
 
-void Fifo_Reset(FIFI_WITH_SEM *fifo)
-{
-    fifo->read_ptr = 0;
-    fifo->write_ptr = 0;
-}
+    if (t->count == 0 || used_time < t->min_time)
+        t->min_time = used_time;
+    if (used_time > t->max_time)
+        t->max_time = used_time;
 
-int Fifo_Write(FIFI_WITH_SEM *fifo, char *data, int len)
-{
-    int len1, len2;
-    if (Fifo_Data_Len(fifo) + len > fifo->fifo_max_len)
-    {
-        return -1; //pull whole data to fifo, or discrad it
-        len = fifo->fifo_max_len - Fifo_Data_Len(fifo);
-    }
-    len1 = len + (fifo->write_ptr & (fifo->fifo_max_len - 1));
-    if (len1 <= fifo->fifo_max_len)
-    {
-        len1 = len;
-        len2 = 0;
-    }
-    else
-    {
-        len1 = fifo->fifo_max_len - (fifo->write_ptr & (fifo->fifo_max_len - 1));
-        len2 = len - len1;
-    }
-    if (len1)
-    {
-        memcpy((fifo->fifo_buf + (fifo->write_ptr & (fifo->fifo_max_len - 1))), data, len1);
-    }
-    if (len2)
-    {
-        memcpy(fifo->fifo_buf, data + len1, len2);
-    }
-    fifo->write_ptr += len;
-    if (Fifo_Data_Len(fifo) >= fifo->need_len)
+    t->total_time += used_time;
+    t->count++;
+
+    if (t->count >= AID_PERF_STAT_PERIOD * CONV_DATA_LEN && base != 0)
     {
-        xSemaphoreGive(fifo->fifo_sem);
+        /* the clock counts cycles when set up by the decode task */
+        printf("mfcc %s: %u frames, min %u avg %u max %u us, avg %u ticks\n", t->name, (unsigned)t->count,
+               (unsigned)(t->min_time * 1000ULL / base), (unsigned)(t->total_time / t->count * 1000 / base),
+               (unsigned)(t->max_time * 1000ULL / base), (unsigned)(t->total_time / t->count));
+        t->count = 0;
+        t->max_time = 0;
+        t->total_time = 0;
     }
-    return 0;
 }
 
-int Fifo_Read_Ex(FIFI_WITH_SEM *fifo, char *data, int len, int shift_len, int wait_forever)
+#if MFCC_COMPARE
+static struct mfcc_time mfcc_other_time = {MFCC_FIXED_POINT ? "f32" : "q15"};
+
+static void compare_mfcc(const int16_t *pcm, const q7_t *mfcc)
 {
-    int len1, len2;
-    fifo->need_len = len;
-    while (len > Fifo_Data_Len(fifo))
-    {
-        int ret = xSemaphoreTake(fifo->fifo_sem, wait_forever);
+    static int max_diff = 0;
+    static uint32_t mismatch = 0;
+    static uint32_t count = 0;
+    float other[NUM_MFCC_COEFFS];
+    q7_t other_q7[NUM_MFCC_COEFFS];
+
+    uint32_t start_time = read_perf_clock();
+#if MFCC_FIXED_POINT
+    MFCC_mfcc_compute_f32(pcm, other);
+#else
+    MFCC_mfcc_compute_q15(pcm, other);
+#endif
+    MFCC_quantize_q7(other, other_q7);
+    record_mfcc_time(&mfcc_other_time, read_perf_clock() - start_time);
 
-        if (ret != pdTRUE)
-        {   //timeout
-            if (wait_forever != portMAX_DELAY)
-                return -1;
-        }
-    }
-    len1 = len + (fifo->read_ptr & (fifo->fifo_max_len - 1));
-    if (len1 <= fifo->fifo_max_len)
-    {
-        len1 = len;
-        len2 = 0;
-    }
-    else
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
     {
-        len1 = fifo->fifo_max_len - (fifo->read_ptr & (fifo->fifo_max_len - 1));
-        len2 = len - len1;
-    }
-    if (len1)
-    {
-        memcpy(data, fifo->fifo_buf + (fifo->read_ptr & (fifo->fifo_max_len - 1)), len1);
+        int diff = abs(mfcc[i] - other_q7[i]);
+
+        if (diff > max_diff)
+            max_diff = diff;
+        if (diff != 0)
+            mismatch++;
     }
-    if (len2)
+
+    if (++count >= AID_PERF_STAT_PERIOD * CONV_DATA_LEN)
     {
-        memcpy(data + len1, fifo->fifo_buf, len2);
+        printf("mfcc q15 vs f32: q7 max diff %d, %u of %u features differ\n", max_diff, (unsigned)mismatch,
+               (unsigned)(count * NUM_MFCC_COEFFS));
+        max_diff = 0;
+        mismatch = 0;
+        count = 0;
     }
-    fifo->read_ptr += shift_len;
-    return 0;
-}
-
-//Read len byte data but only add read_ptr for shift_len
-//some data may be readed more then one time
-int Fifo_Read(FIFI_WITH_SEM *fifo, char *data, int len, int shift_len)
-{
-    return Fifo_Read_Ex(fifo, data, len, shift_len, portMAX_DELAY);
-}
-
-int Fifo_Read_Nosem(FIFI_WITH_SEM *fifo, char *data, int len)
-{
-    return Fifo_Read_Ex(fifo, data, len, len, 5); //2ms
-}
-
-static signed char convert_mfcc_to_char(float mfcc_f)
-{
-	float feature_tmp = mfcc_f;
-	feature_tmp = round(feature_tmp);
-	if(feature_tmp > 127)
-	{
-		feature_tmp = 127;
-	}
-	if(feature_tmp < -128)
-	{
-		feature_tmp = -128;
-	}
-	//convert to char
-	return feature_tmp; 
-}
-
-int inputdata_preprocess(float* in_data, q7_t* out_data)
-{
-	char input_data_count = 0 ;
-	for(int i=0; i<CONV_DATA_LEN; i++)   
-	{
-
-		for(int j=0; j<INPUT_FEATURE_DIM_W; j++)
-		{
-			if(j==0)
-			{
-				out_data[input_data_count*INPUT_FEATURE_DIM_W+j] = convert_mfcc_to_char(in_data[i*NUM_MFCC_COEFFS+j]);
-			}
-			else
-			{
-				out_data[input_data_count*INPUT_FEATURE_DIM_W+j] = convert_mfcc_to_char(in_data[i*NUM_MFCC_COEFFS+j]*2);
-			}
-			
-		}
-		input_data_count++;
-
-	}
-	return 0 ;
 }
+#endif
+#endif
 
 void aid_record_task(void const *argument)
 {
     MFCC_init();
-    int pcm_head = 0;
+#if AID_VAD
+    // the last graph of the speech model starts CONV_DATA_LEN - hop frames after the first one
+    vad_init(&vad, CONV_DATA_LEN, GRAPH_WARMUP_RUNS * CONV_DATA_LEN + CONV_DATA_LEN - hop_frames);
+#endif
+
+    // the q7 format comes from the graph input, which the decode task loads
+    while (run_flag && !feature_format_ready)
+    {
+        vTaskDelay(10);
+    }
 
     mfcc_ready = true;
     while (run_flag)
     {
-        Fifo_Read(&mic_fifo, pcm_buf + pcm_head, PREPROCESS_LEN_BYTE, PREPROCESS_LEN_BYTE);
+        // the frames overlap: each one is read in place, and only the shift is dropped
+#if AID_VAD
+        int held = vad.held;
+        const int16_t *window = spsc_ring_peek(&mic_fifo, (held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN) * 2, SPSC_RING_WAIT_FOREVER);
+        int release;
+        int frame_num = vad_push_frame(&vad, window + held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN - MFCC_FRAME_SHIFT,
+                                       MFCC_FRAME_SHIFT, &release);
+#else
+        const int16_t *window = spsc_ring_peek(&mic_fifo, MFCC_FRAME_LEN * 2, SPSC_RING_WAIT_FOREVER);
+        int release = 1;
+        int frame_num = 1;
+#endif
 
-        pcm_head += PREPROCESS_LEN_BYTE;
-        if (MFCC_FRAME_LEN * 2 <= pcm_head)
+        for (int i = 0; i < frame_num; i++)
         {
-            unsigned long start_time = xTaskGetTickCount();
-            MFCC_mfcc_compute((int16_t *)pcm_buf, mfcc_buf);
-
-            memmove(pcm_buf, pcm_buf + MFCC_FRAME_SHIFT * 2, pcm_head - MFCC_FRAME_SHIFT * 2);
-            pcm_head -= MFCC_FRAME_SHIFT * 2;
+            const int16_t *frame = window + i * MFCC_FRAME_SHIFT;
+#if AID_PERF_STAT
+            uint32_t start_time = read_perf_clock();
+#endif
+            MFCC_mfcc_compute_q7(frame, mfcc_buf);
+#if AID_PERF_STAT
+            record_mfcc_time(&mfcc_time, read_perf_clock() - start_time);
+#if MFCC_COMPARE
+            compare_mfcc(frame, mfcc_buf);
+#endif
+#endif
 
-            Fifo_Write(&mfcc_fifo, (char *)mfcc_buf, NUM_MFCC_COEFFS * sizeof(float));
+            if (spsc_ring_write(&mfcc_fifo, mfcc_buf, NUM_MFCC_COEFFS) < 0)
+                mfcc_drop_num++;
         }
+
+        spsc_ring_release(&mic_fifo, release * MFCC_FRAME_SHIFT * 2);
     }
 
     show_on_lcd("record_task quit!\n");
@@ -480,7 +587,7 @@ record_quit:
     // for quit decode task
     for (int i = 0; i < 99; i++)
     {
-        Fifo_Write(&mfcc_fifo, (char *)mfcc_buf, NUM_MFCC_COEFFS * sizeof(float));
+        spsc_ring_write(&mfcc_fifo, mfcc_buf, NUM_MFCC_COEFFS);
     }
     MFCC_delete();
     record_stop_flag = true;
@@ -488,65 +595,263 @@ record_quit:
     vTaskDelete(aid_record_thread);
 }
 
+// a graph of the speech model: a tengine graph, or an arena bound to the aot plan
+#if AID_AOT_PLAN
+typedef aot_graph_t speech_graph_t;
+#else
+typedef graph_t speech_graph_t;
+#endif
+
+#if AID_PERF_STAT && !AID_AOT_PLAN
+static int perf_run_count = 0;
+static graph_t perf_graph = NULL; // the first graph of the speech model
+#endif
+
+// post_process: 0 when the output is off, the speech model still refilling its move nodes
+static void run_speech_model(speech_graph_t graph, const void *features, int input_size, struct kws_score *score,
+                             bool post_process)
+{
+#if AID_AOT_PLAN
+    int size;
+
+    /* the input of the plan is in its arena */
+    memcpy(get_aot_input_buffer(graph, &size), features, input_size);
+
+    /* nn inference */
+    run_aot_graph(graph);
+#else
+    /* the q7 frames are the rows of the input tensor, bound in place */
+    set_tensor_buffer(get_graph_input_tensor(graph, 0, 0), (void *)features, input_size);
+
+    /* nn inference */
+    run_graph(graph, 1);
+#endif
+
+#if AID_PERF_STAT && !AID_AOT_PLAN
+    if (graph == perf_graph && ++perf_run_count == AID_PERF_STAT_PERIOD)
+    {
+        dump_graph_perf_stat(graph, 0);
+        do_graph_perf_stat(graph, GRAPH_PERF_STAT_RESET);
+        perf_run_count = 0;
+    }
+#endif
+
+    if (!post_process)
+        return;
+
+    /* process result */
+#if AID_AOT_PLAN
+    PostProcess(score, get_aot_output_buffer(graph, &size));
+#else
+    PostProcess(score, get_tensor_buffer(get_graph_output_tensor(graph, 0, 0)));
+#endif
+}
+
+// chunk_num runs of a graph at once, features holding them one after the other: the move nodes
+// go over every one of them, the layers after them and PostProcess() only over the last one
+static void run_speech_model_chunks(speech_graph_t graph, const q7_t *features, int input_size, int chunk_num,
+                                    struct kws_score *score)
+{
+#if AID_AOT_PLAN
+    /* the plan has no stream chunks: each run goes through the whole model */
+    for (int i = 0; i < chunk_num; i++)
+        run_speech_model(graph, features + i * input_size, input_size, score, i == chunk_num - 1);
+#else
+    set_graph_stream_chunks(graph, chunk_num);
+    run_speech_model(graph, features, input_size, score, true);
+    set_graph_stream_chunks(graph, 1);
+#endif
+}
+
 void aid_decode_task(void const *argument)
 {
-    graph_t graph = NULL;
-    int smoothed_score[OUT_DIM] = {0};
-    q7_t output_buf[WINDOW_SIZE][OUT_DIM] = {0};
-    float mfcc_data[NUM_MFCC_COEFFS * CONV_DATA_LEN] = {0};
-    int output_write_ptr = 1;
+    speech_graph_t graph = NULL;
+    speech_graph_t graphs[MAX_PHASE_NUM] = {NULL};
+#if AID_AOT_PLAN
+    void *arenas[MAX_PHASE_NUM] = {NULL};
+#endif
+    int hop = hop_frames;
+    int phase_num = CONV_DATA_LEN / hop;
+    int phase = 0;
+    struct kws_score score;
 
+    kws_score_init(&score, phase_num);
+
+#if AID_AOT_PLAN
+    /* the speech model from its plan, a graph of a shorter hop per arena */
+    for (int i = 0; i < phase_num; i++)
+    {
+        graphs[i] = tengine_lite_init_aot(&arenas[i]);
+        if (graphs[i] == NULL)
+            goto TENGINE_ERR;
+    }
+    graph = graphs[0];
+#else
     /* tengien lite initial, and load graph */
     graph = tengine_lite_init(graph);
+    graphs[0] = graph;
+
+    /* the other graphs of a shorter hop, with their own move nodes */
+    for (int i = 1; i < phase_num; i++)
+    {
+        graphs[i] = tengine_lite_init_instance();
+        if (graphs[i] == NULL)
+            goto TENGINE_ERR;
+    }
+#endif
+
+#if AID_CASCADE
+    graph_t stage1_graph = tengine_lite_init_stage1();
+    if (stage1_graph == NULL)
+        goto TENGINE_ERR;
+
+    tensor_t stage1_input_tensor = get_graph_input_tensor(stage1_graph, 0, 0);
+    const char *stage1_output = get_tensor_buffer(get_graph_output_tensor(stage1_graph, 0, 0));
+    int history = 0;    // runs in front of the current one in the ring
+    int missed = FEATURE_HISTORY_RUNS + 1;
+    int hold = 0;
+#endif
+
+#if AID_PERF_STAT
+    /* the perf clock is the DWT cycle counter */
+    set_perf_clock(NULL, SystemCoreClock / 1000);
+#if !AID_AOT_PLAN
+    do_graph_perf_stat(graph, GRAPH_PERF_STAT_ENABLE);
+    perf_graph = graph;
+#endif
+#endif
 
     /* set point of input data */
+#if AID_AOT_PLAN
+    int input_size;
+
+    get_aot_input_buffer(graph, &input_size);
+#else
     tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
     int input_size = get_tensor_buffer_size(input_tensor);
-    char *input_buf = (char *)malloc(input_size * sizeof(char));
-    if (set_tensor_buffer(input_tensor, (void *)input_buf, input_size) < 0)
+#endif
+    if (input_size != NUM_MFCC_COEFFS * CONV_DATA_LEN)
     {
-        printf("set input tensor buffer failed\n");
+        printf("input tensor size %d is not %d mfcc frames\n", input_size, CONV_DATA_LEN);
         goto TENGINE_ERR;
     }
 
-    /* set point of output data */
-    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
-    char *output = get_tensor_buffer(output_tensor);
+    /* the mfcc stage quantizes to the input tensor: its scale is 1 << fraction bits */
+    int input_shift = 0;
+    int8_t frac_bits[NUM_MFCC_COEFFS];
+
+#if AID_AOT_PLAN
+    input_shift = tengine_lite_aot_input_shift();
+#else
+    float input_scale = 1.0f;
+    int input_zero_point = 0;
+
+    if (get_tensor_quant_param(input_tensor, &input_scale, &input_zero_point, 1) == 1)
+    {
+        while ((1 << input_shift) < input_scale)
+            input_shift++;
+    }
+#endif
+
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        frac_bits[i] = feature_frac_bits[i] + input_shift;
+
+    MFCC_set_q7_format(frac_bits);
+    feature_format_ready = true;
 
     while (run_flag)
     {
-        /* get input audio data */
-        Fifo_Read(&mfcc_fifo, (char *)mfcc_data, NUM_MFCC_COEFFS * CONV_DATA_LEN * sizeof(float), NUM_MFCC_COEFFS * CONV_DATA_LEN * sizeof(float));
+#if AID_CASCADE
+        /* get input features: the history, then the current run */
+        const q7_t *features = spsc_ring_peek(&mfcc_fifo, (history + 1) * input_size, SPSC_RING_WAIT_FOREVER);
 
-        /* preprocess input data */
-        inputdata_preprocess(mfcc_data, (q7_t *)input_buf);
+        set_tensor_buffer(stage1_input_tensor, (void *)(features + history * input_size), input_size);
+        run_graph(stage1_graph, 1);
+        cascade_run_num++;
 
-        /* nn inference */
-        run_graph(graph, 1);
+        if (stage1_output[1] >= cascade_threshold)
+            hold = CASCADE_HOLD_RUNS;
 
-        /* process result */
-        for (int i = 0; i < OUT_DIM; i++)
+        if (hold > 0)
         {
-            output_buf[output_write_ptr][i] = output[i];
+            /* past the history, the first runs only refill the move nodes of the speech model */
+            int catch_up = missed < history ? missed : history;
+
+            for (int i = history - catch_up; i <= history; i++)
+            {
+                run_speech_model(graph, features + i * input_size, input_size, &score,
+                                 missed <= FEATURE_HISTORY_RUNS || i == history);
+                speech_run_num++;
+            }
+
+            missed = 0;
+            hold--;
         }
+        else
+        {
+            missed++;
+        }
+
+        if (history < FEATURE_HISTORY_RUNS)
+            history++;
+        else
+            spsc_ring_release(&mfcc_fifo, input_size);
+#else
+        /* the runs of each graph waiting in the ring: the one of graphs[phase] starts first, the
+           one of the graph taking the last turn CONV_DATA_LEN - hop frames later */
+        int overlap_size = (CONV_DATA_LEN - hop) * NUM_MFCC_COEFFS;
+        int pending = ((int)spsc_ring_data_len(&mfcc_fifo) - overlap_size) / input_size;
+
+        if (pending < 2)
+        {
+            /* get input features: the last CONV_DATA_LEN frames, the first hop of them are done with */
+            const void *features = spsc_ring_peek(&mfcc_fifo, input_size, SPSC_RING_WAIT_FOREVER);
+
+            run_speech_model(graphs[phase], features, input_size, &score, true);
+            phase = (phase + 1) % phase_num;
 
-        output_write_ptr = (output_write_ptr + 1) % WINDOW_SIZE;
-        for (int i = 0; i < OUT_DIM; i++)
+            spsc_ring_release(&mfcc_fifo, hop * NUM_MFCC_COEFFS);
+        }
+        else
         {
-            for (int j = 0; j < WINDOW_SIZE; j++)
+            /* behind: each graph takes its next chunk_num runs at once, in its turn, and only
+               the output of the last one is scored */
+            int chunk_num = pending < MAX_CATCH_UP_RUNS ? pending : MAX_CATCH_UP_RUNS;
+            const q7_t *features = spsc_ring_peek(&mfcc_fifo, chunk_num * input_size + overlap_size, SPSC_RING_WAIT_FOREVER);
+
+            for (int i = 0; i < phase_num; i++)
             {
-                smoothed_score[i] += output_buf[j][i];
+                int p = (phase + i) % phase_num;
+
+                run_speech_model_chunks(graphs[p], features + i * hop * NUM_MFCC_COEFFS, input_size, chunk_num,
+                                        &score);
             }
-            smoothed_score[i] /= WINDOW_SIZE; //(WINDOW_SIZE + 1); //WINDOW_SIZE
-        }
 
-        PostProcess(smoothed_score);
+            catch_up_num++;
+            catch_up_run_num += chunk_num * phase_num;
+
+            spsc_ring_release(&mfcc_fifo, chunk_num * input_size);
+        }
+#endif
     }
 
 TENGINE_ERR:
+#if AID_AOT_PLAN
+    for (int i = 0; i < phase_num; i++)
+        tengine_lite_release_aot(arenas[i]);
+#else
+    for (int i = 1; i < phase_num; i++)
+    {
+        if (graphs[i] != NULL)
+            tengine_lite_release_instance(graphs[i]);
+    }
+#if AID_CASCADE
+    if (stage1_graph != NULL)
+        tengine_lite_release_stage1(stage1_graph);
+#endif
     tengine_lite_release(graph);
+#endif
     run_flag = false;
-    free(input_buf);
 
     printf("aid_decode_thread quit!\n");
     decode_stop_flag = true;
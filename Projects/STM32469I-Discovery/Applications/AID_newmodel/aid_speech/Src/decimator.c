@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Src/decimator.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Stereo to mono 16 kHz to 8 kHz decimation of the mic dma buffer
+  ******************************************************************************
+  */
+
+#include <string.h>
+
+#include "decimator.h"
+
+// the even taps of a kaiser (beta 6) windowed half-band sinc, in q15. They sum to 0.5,
+// the center tap is the other 0.5. Symmetric, so the order does not matter.
+// The words are the pairs __SMLAD takes
+static const union
+{
+    q15_t q15[DECIM_EVEN_TAPS];
+    uint32_t word[DECIM_EVEN_TAPS / 2];
+} even_taps = {{
+    -8, 35, -89, 187, -349, 606, -1015, 1721, -3246, 10350,
+    10350, -3246, 1721, -1015, 606, -349, 187, -89, 35, -8,
+}};
+
+void decimator_init(struct decimator *d)
+{
+    memset(d, 0, sizeof(*d));
+}
+
+// y[n] = sum(h[2j] * x[2n - 2j]) + x[2n - 2 * DECIM_ODD_DELAY + 1] / 2:
+// even[i .. i + DECIM_EVEN_TAPS) are the even samples up to x[2n], odd[i] the center one
+static void decimate_chunk(const q15_t *even, const q15_t *odd, int num, q15_t *mono)
+{
+    for (int i = 0; i < num; i++)
+    {
+        const q15_t *x = even + i;
+        int32_t sum = (int32_t)odd[i] << 14;
+
+#if defined (ARM_MATH_DSP)
+        // the window is not word aligned every other output, which the M4 loads as they are
+        for (int j = 0; j < DECIM_EVEN_TAPS; j += 2)
+            sum = __SMLAD(*__SIMD32(x + j), even_taps.word[j / 2], sum);
+#else
+        for (int j = 0; j < DECIM_EVEN_TAPS; j++)
+            sum += (int32_t)x[j] * even_taps.q15[j];
+#endif
+
+        mono[i] = (q15_t)__SSAT((sum + (1 << 14)) >> 15, 16);
+    }
+}
+
+int decimator_stereo_to_mono(struct decimator *d, const q15_t *stereo, int frame_num, q15_t *mono)
+{
+    const int even_hist = DECIM_EVEN_TAPS - 1;
+    int out_num = frame_num / 2;
+
+    for (int done = 0; done < out_num;)
+    {
+        int num = out_num - done < DECIM_CHUNK ? out_num - done : DECIM_CHUNK;
+
+        // channel 0 of two stereo frames: an even and an odd sample
+        for (int i = 0; i < num; i++)
+        {
+            d->even[even_hist + i] = stereo[4 * i];
+            d->odd[DECIM_ODD_DELAY + i] = stereo[4 * i + 2];
+        }
+
+        decimate_chunk(d->even, d->odd, num, mono + done);
+
+        // the history of the next chunk
+        memmove(d->even, d->even + num, even_hist * sizeof(q15_t));
+        memmove(d->odd, d->odd + num, DECIM_ODD_DELAY * sizeof(q15_t));
+
+        stereo += 4 * num;
+        done += num;
+    }
+
+    return out_num;
+}
@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Src/kws_score.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Score smoothing and wake up logic behind the speech model
+  ******************************************************************************
+  */
+
+#include <string.h>
+
+#include "kws_score.h"
+
+void kws_score_init(struct kws_score *s, int phase_num)
+{
+    memset(s, 0, sizeof(*s));
+    s->output_write_ptr = 1;
+    s->size = WINDOW_SIZE * phase_num;
+    s->phase_num = phase_num;
+}
+
+int kws_score_push(struct kws_score *s, const q7_t *output, int threshold)
+{
+    int id = 0;
+
+    for (int i = 0; i < OUT_DIM; i++)
+    {
+        s->output_buf[s->output_write_ptr][i] = output[i];
+    }
+
+    s->output_write_ptr = (s->output_write_ptr + 1) % s->size;
+    for (int i = 0; i < OUT_DIM; i++)
+    {
+        int sum = 0;
+
+        for (int j = 0; j < s->size; j++)
+        {
+            sum += s->output_buf[j][i];
+        }
+        s->smoothed_score[i] += sum / s->phase_num;
+        s->smoothed_score[i] /= WINDOW_SIZE;
+    }
+
+    // output 0 is the filler
+    for (int j = 1; j < OUT_DIM; j++)
+    {
+        if (s->smoothed_score[j] > threshold)
+        {
+            s->miss_times = 0;
+            if (!s->wakeup_flag)
+            {
+                s->wakeup_flag = true;
+                id = j;
+            }
+        }
+        else if (++s->miss_times > MISS_THRESHOLD * OUT_DIM * s->phase_num && s->wakeup_flag)
+        {
+            s->wakeup_flag = false;
+        }
+    }
+
+    return id;
+}
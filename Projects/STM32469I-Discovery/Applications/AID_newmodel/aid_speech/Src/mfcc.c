@@ -28,17 +28,57 @@
 #include "stdlib.h"
 
 static int32_t frame_len_padded = 0;
+static float *center_frequencies_ = NULL;
+static float *band_mapper_ = NULL;
+static float *weights_ = NULL;
+static int start_index_ = 0;
+static int end_index_ = 0;
+static int8_t q7_frac_bits[NUM_MFCC_COEFFS]; // see MFCC_set_q7_format()
+
+#if !MFCC_FIXED_POINT || MFCC_COMPARE
 static float * frame = NULL;
 static float * buffer = NULL;
 static float * mel_energies = NULL;
 static float * window_func = NULL;
 static float * dct_matrix = NULL;
 static arm_rfft_fast_instance_f32 * rfft = NULL;
-static float *center_frequencies_ = NULL;
-static float *band_mapper_ = NULL;
-static float *weights_ = NULL;
-static int start_index_ = 0;
-static int end_index_ = 0;
+#endif
+
+#if MFCC_FIXED_POINT || MFCC_COMPARE
+// q15 pipeline: block normalized frame, q15 window and fft, integer magnitude,
+// log2 from a table and a DCT in integer, scaled by ln(2) so the output matches the float one
+#define DCT_Q15_SHIFT 17
+#define LOG2_Q 16
+#define LOG2_TABLE_BITS 7
+#define LOG2_OF_FLT_MIN -126
+#define MFCC_LN2 0.69314718055994530942
+
+static int32_t fft_bits = 0; // log2(frame_len_padded)
+static q15_t * frame_q15 = NULL;
+static q15_t * buffer_q15 = NULL; // complex, frame_len_padded bins
+static q15_t * window_q15 = NULL;
+static q15_t * weights_q15 = NULL;
+static int8_t * band_mapper_q15 = NULL;
+static int16_t * dct_matrix_q15 = NULL;
+static uint64_t * mel_energies_q15 = NULL;
+static int32_t * mel_log2 = NULL;
+static arm_rfft_instance_q15 * rfft_q15 = NULL;
+
+// log2(1 + i / 128) in q15
+static const uint16_t log2_table[(1 << LOG2_TABLE_BITS) + 1] = {
+  0, 368, 733, 1095, 1455, 1811, 2166, 2517, 2866, 3212, 3556, 3897,
+  4236, 4573, 4907, 5239, 5568, 5895, 6220, 6543, 6863, 7182, 7498, 7812,
+  8124, 8434, 8742, 9048, 9352, 9654, 9954, 10253, 10549, 10843, 11136, 11427,
+  11716, 12004, 12289, 12573, 12855, 13136, 13415, 13692, 13968, 14242, 14514, 14785,
+  15055, 15322, 15589, 15854, 16117, 16379, 16639, 16898, 17156, 17412, 17667, 17921,
+  18173, 18424, 18673, 18921, 19168, 19414, 19658, 19901, 20143, 20383, 20623, 20861,
+  21098, 21334, 21568, 21802, 22034, 22265, 22495, 22724, 22952, 23179, 23404, 23629,
+  23852, 24075, 24296, 24517, 24736, 24955, 25172, 25388, 25604, 25818, 26031, 26244,
+  26455, 26666, 26876, 27084, 27292, 27499, 27705, 27910, 28114, 28318, 28520, 28722,
+  28922, 29122, 29321, 29520, 29717, 29914, 30109, 30304, 30498, 30692, 30884, 31076,
+  31267, 31457, 31647, 31836, 32024, 32211, 32397, 32583, 32768,
+};
+#endif
 
 static inline float InverseMelScale(float mel_freq) {
   return 700.0f * (expf (mel_freq / 1127.0f) - 1.0f);
@@ -48,14 +88,9 @@ static inline float MelScale(float freq) {
   return 1127.0f * logf (1.0f + freq / 700.0f);
 }
 
-void MFCC_init()
+#if !MFCC_FIXED_POINT || MFCC_COMPARE
+static void init_f32()
 {
-
-  // Round-up to nearest power of 2.
-  frame_len_padded = pow(2,ceil((log(MFCC_FRAME_LEN)/log(2))));
-  
-  //printf("frame_len_padded: %d\n", frame_len_padded);
-  
   frame = (float*)calloc(frame_len_padded, sizeof(float));
   buffer = (float*)calloc(frame_len_padded, sizeof(float));
   mel_energies = (float*)calloc(NUM_FBANK_BINS, sizeof(float));
@@ -65,6 +100,64 @@ void MFCC_init()
   for (int i = 0; i < MFCC_FRAME_LEN; i++)
     window_func[i] = 0.5 - 0.5*cos(M_2PI * ((float)i) / (MFCC_FRAME_LEN));
 
+  //create DCT matrix
+  dct_matrix = MFCC_create_dct_matrix(NUM_FBANK_BINS, NUM_MFCC_COEFFS);
+
+  //initialize FFT
+  rfft = (arm_rfft_fast_instance_f32 *)calloc(1, sizeof(arm_rfft_fast_instance_f32));
+  arm_rfft_fast_init_f32(rfft, frame_len_padded);
+}
+#endif
+
+#if MFCC_FIXED_POINT || MFCC_COMPARE
+static inline q15_t float_to_q15(double v)
+{
+  return (q15_t)__SSAT((int32_t)floor(v * 32768 + 0.5), 16);
+}
+
+// the tables of the q15 pipeline are made from the float ones
+static void init_q15()
+{
+  int32_t num_fft_bins = frame_len_padded/2;
+
+  fft_bits = 31 - __CLZ(frame_len_padded);
+  mel_energies_q15 = (uint64_t*)calloc(NUM_FBANK_BINS, sizeof(uint64_t));
+  mel_log2 = (int32_t*)calloc(NUM_FBANK_BINS, sizeof(int32_t));
+
+  frame_q15 = (q15_t*)calloc(frame_len_padded, sizeof(q15_t));
+  buffer_q15 = (q15_t*)calloc(frame_len_padded * 2, sizeof(q15_t));
+
+  window_q15 = (q15_t*)calloc(MFCC_FRAME_LEN, sizeof(q15_t));
+  for (int i = 0; i < MFCC_FRAME_LEN; i++)
+    window_q15[i] = float_to_q15(0.5 - 0.5*cos(M_2PI * ((float)i) / (MFCC_FRAME_LEN)));
+
+  weights_q15 = (q15_t*)calloc(num_fft_bins+1, sizeof(q15_t));
+  band_mapper_q15 = (int8_t*)calloc(num_fft_bins+1, sizeof(int8_t));
+  for (int i = 0; i < num_fft_bins+1; i++) {
+    weights_q15[i] = float_to_q15(weights_[i]);
+    band_mapper_q15[i] = (int8_t)band_mapper_[i];
+  }
+
+  // ln(mel) = ln(2) * log2(mel): the DCT takes the log2 values directly
+  float * dct = MFCC_create_dct_matrix(NUM_FBANK_BINS, NUM_MFCC_COEFFS);
+  dct_matrix_q15 = (int16_t*)calloc(NUM_FBANK_BINS*NUM_MFCC_COEFFS, sizeof(int16_t));
+  for (int i = 0; i < NUM_FBANK_BINS*NUM_MFCC_COEFFS; i++)
+    dct_matrix_q15[i] = (int16_t)floor(dct[i] * MFCC_LN2 * (1 << DCT_Q15_SHIFT) + 0.5);
+  free(dct);
+
+  rfft_q15 = (arm_rfft_instance_q15 *)calloc(1, sizeof(arm_rfft_instance_q15));
+  arm_rfft_init_q15(rfft_q15, frame_len_padded, 0, 1);
+}
+#endif
+
+void MFCC_init()
+{
+
+  // Round-up to nearest power of 2.
+  frame_len_padded = pow(2,ceil((log(MFCC_FRAME_LEN)/log(2))));
+  
+  //printf("frame_len_padded: %d\n", frame_len_padded);
+
   //create mel filterbank implement in tesnorflow 
   //commit 775f42a845353ea8525bc54a2ddb5852acf3c6eb
 
@@ -124,23 +217,45 @@ void MFCC_init()
     }
   }
 
-  //create DCT matrix
-  dct_matrix = MFCC_create_dct_matrix(NUM_FBANK_BINS, NUM_MFCC_COEFFS);
-
-  //initialize FFT
-  rfft = (arm_rfft_fast_instance_f32 *)calloc(1, sizeof(arm_rfft_fast_instance_f32));
-  arm_rfft_fast_init_f32(rfft, frame_len_padded);
-
+#if !MFCC_FIXED_POINT || MFCC_COMPARE
+  init_f32();
+#endif
+#if MFCC_FIXED_POINT || MFCC_COMPARE
+  init_q15();
+#endif
+#if MFCC_FIXED_POINT && !MFCC_COMPARE
+  // only the q15 copies are used from now on
+  free(center_frequencies_);
+  free(band_mapper_);
+  free(weights_);
+  center_frequencies_ = band_mapper_ = weights_ = NULL;
+#endif
 }
 
 void MFCC_delete()
 {
+  free(center_frequencies_);
+  free(band_mapper_);
+  free(weights_);
+#if !MFCC_FIXED_POINT || MFCC_COMPARE
   free(frame);
   free(buffer);
   free(mel_energies);
   free(window_func);
   free(dct_matrix);
   free(rfft);
+#endif
+#if MFCC_FIXED_POINT || MFCC_COMPARE
+  free(frame_q15);
+  free(buffer_q15);
+  free(window_q15);
+  free(weights_q15);
+  free(band_mapper_q15);
+  free(dct_matrix_q15);
+  free(mel_energies_q15);
+  free(mel_log2);
+  free(rfft_q15);
+#endif
 }
 
 float * MFCC_create_dct_matrix(int32_t input_length, int32_t coefficient_count)
@@ -159,10 +274,11 @@ float * MFCC_create_dct_matrix(int32_t input_length, int32_t coefficient_count)
 
 
 
+#if !MFCC_FIXED_POINT || MFCC_COMPARE
 // Compute the mel spectrum from the squared-magnitude FFT input by taking the
 // square root, then summing FFT magnitudes under triangular integration windows
 // whose widths increase with frequency.
-void MFCC_mfcc_compute(const int16_t * data, float * mfcc_out) 
+void MFCC_mfcc_compute_f32(const int16_t * data, float * mfcc_out)
 {
 //printf("enter MFCC_mfcc_compute\n");
   int32_t i, j, bin;
@@ -234,3 +350,174 @@ void MFCC_mfcc_compute(const int16_t * data, float * mfcc_out)
   }
 //printf("finish mel MFCC_mfcc_compute\n");
 }
+#endif
+
+#if MFCC_FIXED_POINT || MFCC_COMPARE
+static inline uint32_t isqrt32(uint32_t v)
+{
+  if (v == 0)
+    return 0;
+
+  // newton from above: the first guess is a power of 2 not below the root
+  uint32_t x = 1u << ((33 - __CLZ(v)) / 2);
+  uint32_t y = (x + v / x) / 2;
+
+  while (y < x) {
+    x = y;
+    y = (x + v / x) / 2;
+  }
+
+  return x;
+}
+
+// sqrt(re^2 + im^2) with 8 fraction bits; small bins are normalized first not to lose them
+static inline uint32_t bin_magnitude(int32_t re, int32_t im)
+{
+  uint32_t power = (uint32_t)(re*re) + (uint32_t)(im*im);
+
+  if (power == 0)
+    return 0;
+
+  int32_t shift = __CLZ(power) / 2;
+  uint32_t root = isqrt32(power << (2 * shift));
+
+  return shift >= 8 ? root >> (shift - 8) : root << (8 - shift);
+}
+
+// log2 in q16, linear between the table entries
+static inline int32_t log2_q16(uint64_t v)
+{
+  uint32_t hi = (uint32_t)(v >> 32);
+  int32_t msb = hi ? 63 - __CLZ(hi) : 31 - __CLZ((uint32_t)v);
+  uint32_t mant = (uint32_t)((v << (63 - msb)) >> 32); // leading one at bit 31
+
+  uint32_t idx = (mant >> (31 - LOG2_TABLE_BITS)) & ((1 << LOG2_TABLE_BITS) - 1);
+  uint32_t frac = (mant >> (15 - LOG2_TABLE_BITS)) & 0xffff;
+  int32_t lo = log2_table[idx];
+  int32_t frac_log = lo + (((log2_table[idx + 1] - lo) * (int32_t)frac) >> 16);
+
+  return (msb << LOG2_Q) + (frac_log << (LOG2_Q - 15));
+}
+
+// log2 of the mel energies of the frame in mel_log2, in q16
+static void mel_log2_q15(const int16_t * data)
+{
+  int32_t i;
+  int32_t sum = 0, max_abs = 1;
+
+  // a dc offset only reaches bins 0 and 1 through the hann window, which are not used
+  // from start_index_ 2 on, but it would take the range the normalization below gives
+  // to the other bins
+  for (i = 0; i < MFCC_FRAME_LEN; i++)
+    sum += data[i];
+
+  int32_t mean = start_index_ >= 2 ? sum / MFCC_FRAME_LEN : 0;
+
+  // block normalization: the frame is scaled up to the full q15 range before the fft
+  for (i = 0; i < MFCC_FRAME_LEN; i++) {
+    int32_t v = data[i] - mean;
+    if (v < 0)
+      v = -v;
+    if (v > max_abs)
+      max_abs = v;
+  }
+
+  // -1 when the offset takes a full scale frame out of q15
+  int32_t norm = (int32_t)__CLZ(max_abs) - 17;
+
+  for (i = 0; i < MFCC_FRAME_LEN; i++) {
+    int32_t v = data[i] - mean;
+    v = norm >= 0 ? v << norm : v >> -norm;
+    frame_q15[i] = (q15_t)(v * window_q15[i] >> 15);
+  }
+  memset(&frame_q15[MFCC_FRAME_LEN], 0, sizeof(q15_t) * (frame_len_padded-MFCC_FRAME_LEN));
+
+  // the q15 rfft scales down by frame_len_padded, and the output holds the whole spectrum
+  arm_rfft_q15(rfft_q15, frame_q15, buffer_q15);
+
+  memset(mel_energies_q15, 0, sizeof(uint64_t)*NUM_FBANK_BINS);
+
+  for (i = start_index_; i <= end_index_; i++) {
+    uint32_t spec_val = bin_magnitude(buffer_q15[i*2], buffer_q15[i*2 + 1]);
+    uint64_t weighted = (uint64_t)spec_val * weights_q15[i];
+    int channel = band_mapper_q15[i];
+    if (channel >= 0)
+      mel_energies_q15[channel] += weighted;
+    channel++;
+    if (channel < NUM_FBANK_BINS)
+      mel_energies_q15[channel] += ((uint64_t)spec_val << 15) - weighted;
+  }
+
+  // back to the scale of the float path: 15 bits of weight, 8 of magnitude,
+  // 15 of the q15 input less the ones the fft scaled down, and the normalization
+  int32_t log2_offset = (15 + 8 + 15 - fft_bits + norm) << LOG2_Q;
+
+  for (i = 0; i < NUM_FBANK_BINS; i++) {
+    if (mel_energies_q15[i] == 0)
+      mel_log2[i] = LOG2_OF_FLT_MIN << LOG2_Q;
+    else
+      mel_log2[i] = log2_q16(mel_energies_q15[i]) - log2_offset;
+  }
+}
+
+// coefficient i, with DCT_Q15_SHIFT + LOG2_Q fraction bits
+static inline int64_t dct_q15(int32_t i)
+{
+  int64_t sum = 0;
+
+  for (int32_t j = 0; j < NUM_FBANK_BINS; j++)
+    sum += (int64_t)dct_matrix_q15[i*NUM_FBANK_BINS+j] * mel_log2[j];
+
+  return sum;
+}
+
+// the same features as MFCC_mfcc_compute_f32(), without float until the 10 outputs
+void MFCC_mfcc_compute_q15(const int16_t * data, float * mfcc_out)
+{
+  mel_log2_q15(data);
+
+  for (int32_t i = 0; i < NUM_MFCC_COEFFS; i++)
+    mfcc_out[i] = (float)dct_q15(i) * (1.0f / ((uint64_t)1 << (DCT_Q15_SHIFT + LOG2_Q)));
+}
+#endif
+
+void MFCC_mfcc_compute(const int16_t * data, float * mfcc_out)
+{
+#if MFCC_FIXED_POINT
+  MFCC_mfcc_compute_q15(data, mfcc_out);
+#else
+  MFCC_mfcc_compute_f32(data, mfcc_out);
+#endif
+}
+
+void MFCC_set_q7_format(const int8_t * frac_bits)
+{
+  memcpy(q7_frac_bits, frac_bits, sizeof(q7_frac_bits));
+}
+
+void MFCC_quantize_q7(const float * mfcc, q7_t * out)
+{
+  for (int32_t i = 0; i < NUM_MFCC_COEFFS; i++) {
+    float v = floorf(mfcc[i] * (float)(1 << q7_frac_bits[i]) + 0.5f);
+    out[i] = (q7_t)(v > 127 ? 127 : (v < -128 ? -128 : v));
+  }
+}
+
+void MFCC_mfcc_compute_q7(const int16_t * data, q7_t * out)
+{
+#if MFCC_FIXED_POINT
+  mel_log2_q15(data);
+
+  // straight from the DCT sums: one rounding shift per coefficient
+  for (int32_t i = 0; i < NUM_MFCC_COEFFS; i++) {
+    int32_t shift = DCT_Q15_SHIFT + LOG2_Q - q7_frac_bits[i];
+    int64_t v = (dct_q15(i) + ((int64_t)1 << (shift - 1))) >> shift;
+    out[i] = (q7_t)(v > 127 ? 127 : (v < -128 ? -128 : v));
+  }
+#else
+  float mfcc[NUM_MFCC_COEFFS];
+
+  MFCC_mfcc_compute_f32(data, mfcc);
+  MFCC_quantize_q7(mfcc, out);
+#endif
+}
@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Src/spsc_ring.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Single producer, single consumer byte ring
+  ******************************************************************************
+  */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "spsc_ring.h"
+
+// the data must be in place before the index that publishes it, and read after it.
+// A full barrier orders an index against the waiting flag of the other side
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+// armcc 5: a single core, a barrier keeps both the compiler and the bus in order
+#define full_barrier() __dmb(0xf)
+
+static inline uint32_t load_acquire(const volatile uint32_t *p)
+{
+    uint32_t v = *p;
+    __dmb(0xf);
+    return v;
+}
+
+static inline void store_release(volatile uint32_t *p, uint32_t v)
+{
+    __dmb(0xf);
+    *p = v;
+}
+#elif defined(__GNUC__)
+#define full_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static inline uint32_t load_acquire(const volatile uint32_t *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(volatile uint32_t *p, uint32_t v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+#else
+#include <intrinsics.h>
+
+#define full_barrier() __DMB()
+
+static inline uint32_t load_acquire(const volatile uint32_t *p)
+{
+    uint32_t v = *p;
+    __DMB();
+    return v;
+}
+
+static inline void store_release(volatile uint32_t *p, uint32_t v)
+{
+    __DMB();
+    *p = v;
+}
+#endif
+
+int spsc_ring_init(struct spsc_ring *ring, uint32_t size, uint32_t max_span,
+                   const struct spsc_ring_notify *notify, void *notify_arg)
+{
+    if (size == 0 || (size & (size - 1)) || max_span == 0 || max_span > size / 2)
+        return -1;
+
+    ring->buf = calloc(size + max_span, 1);
+    if (ring->buf == NULL)
+        return -1;
+
+    ring->size = size;
+    ring->max_span = max_span;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->producer_waiting = 0;
+    ring->consumer_waiting = 0;
+    ring->notify = notify;
+    ring->notify_arg = notify_arg;
+
+    return 0;
+}
+
+void spsc_ring_free(struct spsc_ring *ring)
+{
+    free(ring->buf);
+    ring->buf = NULL;
+}
+
+void spsc_ring_reset(struct spsc_ring *ring)
+{
+    ring->head = 0;
+    ring->tail = 0;
+}
+
+uint32_t spsc_ring_data_len(const struct spsc_ring *ring)
+{
+    return load_acquire(&ring->head) - load_acquire(&ring->tail);
+}
+
+uint32_t spsc_ring_free_len(const struct spsc_ring *ring)
+{
+    return ring->size - spsc_ring_data_len(ring);
+}
+
+// wake the other side only when it said it waits: either it sees the index just stored,
+// or the index side sees its flag
+static inline void wake(struct spsc_ring *ring, volatile uint32_t *index, volatile uint32_t *waiting)
+{
+    if (ring->notify == NULL)
+        return;
+
+    full_barrier();
+
+    if (load_acquire(waiting))
+        ring->notify->wake(ring, index);
+}
+
+// until *index moves far enough from other for need bytes of data (head) or room (tail)
+static int wait_index(struct spsc_ring *ring, volatile uint32_t *index, volatile uint32_t *waiting,
+                      uint32_t other, uint32_t need, uint32_t timeout)
+{
+    int ret = 0;
+
+    if (timeout == 0 || ring->notify == NULL)
+        return -1;
+
+    store_release(waiting, 1);
+    full_barrier();
+
+    for (;;)
+    {
+        uint32_t seen = load_acquire(index);
+
+        // data: head - tail, room: size - (head - tail)
+        if ((index == &ring->head ? seen - other : ring->size - (other - seen)) >= need)
+            break;
+
+        if (ring->notify->wait(ring, index, seen, timeout) < 0)
+        {
+            ret = -1;
+            break;
+        }
+    }
+
+    store_release(waiting, 0);
+
+    return ret;
+}
+
+void *spsc_ring_acquire(struct spsc_ring *ring, uint32_t len, uint32_t timeout)
+{
+    if (len > ring->max_span)
+        return NULL;
+
+    if (ring->head - load_acquire(&ring->tail) + len > ring->size &&
+        wait_index(ring, &ring->tail, &ring->producer_waiting, ring->head, len, timeout) < 0)
+        return NULL;
+
+    return ring->buf + (ring->head & (ring->size - 1));
+}
+
+void spsc_ring_commit(struct spsc_ring *ring, uint32_t len)
+{
+    uint32_t pos = ring->head & (ring->size - 1);
+    uint32_t end = pos + len;
+
+    // the part of the span past the end was written on the mirror: it belongs at the start
+    if (end > ring->size)
+        memcpy(ring->buf, ring->buf + ring->size, end - ring->size);
+
+    // and what lands in the mirrored start is copied on the mirror, for the windows that wrap
+    if (pos < ring->max_span)
+        memcpy(ring->buf + ring->size + pos, ring->buf + pos, (end < ring->max_span ? end : ring->max_span) - pos);
+
+    store_release(&ring->head, ring->head + len);
+
+    wake(ring, &ring->head, &ring->consumer_waiting);
+}
+
+int spsc_ring_write(struct spsc_ring *ring, const void *data, uint32_t len)
+{
+    const uint8_t *src = data;
+
+    if (spsc_ring_free_len(ring) < len)
+        return -1;
+
+    // only this side adds data, so the room checked above is still there
+    while (len)
+    {
+        uint32_t span = len < ring->max_span ? len : ring->max_span;
+
+        memcpy(spsc_ring_acquire(ring, span, 0), src, span);
+        spsc_ring_commit(ring, span);
+
+        src += span;
+        len -= span;
+    }
+
+    return 0;
+}
+
+const void *spsc_ring_peek(struct spsc_ring *ring, uint32_t len, uint32_t timeout)
+{
+    if (len > ring->max_span)
+        return NULL;
+
+    if (load_acquire(&ring->head) - ring->tail < len &&
+        wait_index(ring, &ring->head, &ring->consumer_waiting, ring->tail, len, timeout) < 0)
+        return NULL;
+
+    return ring->buf + (ring->tail & (ring->size - 1));
+}
+
+void spsc_ring_release(struct spsc_ring *ring, uint32_t len)
+{
+    store_release(&ring->tail, ring->tail + len);
+
+    wake(ring, &ring->tail, &ring->producer_waiting);
+}
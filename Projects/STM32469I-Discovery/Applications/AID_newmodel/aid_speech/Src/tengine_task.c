@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include "tengine_task.h"
 
 extern int tprintf(const char * str, ...);
@@ -7,6 +8,14 @@ static const struct tiny_graph* tiny_graph;
 extern const struct tiny_graph* get_tiny_graph(void);
 extern void free_tiny_graph(const struct tiny_graph*);
 
+#if AID_AOT_PLAN
+extern const uint32_t tiny_aot_plan[];
+#endif
+
+static const struct tiny_graph* tiny_stage1_graph;
+extern const struct tiny_graph* get_tiny_stage1_graph(void);
+extern void free_tiny_stage1_graph(const struct tiny_graph*);
+
 /* Private functions ---------------------------------------------------------*/
 static void log_func(const char* info)
 {
@@ -51,4 +60,98 @@ void tengine_lite_release(graph_t graph)
     destroy_graph(graph);
     free_tiny_graph(tiny_graph);
     release_tengine();
-}
\ No newline at end of file
+}
+
+// one more graph of the speech model of tengine_lite_init(), with its own move nodes
+graph_t tengine_lite_init_instance(void)
+{
+    graph_t graph = create_graph(NULL, "tiny", ( void* )tiny_graph);
+    if(graph == NULL)
+    {
+        printf("create graph from tiny model failed\n");
+        return NULL;
+    }
+
+    if(prerun_graph(graph) < 0)
+    {
+        printf("prerun graph failed\n");
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    return graph;
+}
+
+void tengine_lite_release_instance(graph_t graph)
+{
+    postrun_graph(graph);
+    destroy_graph(graph);
+}
+
+// the first stage of the cascade, in the tengine of tengine_lite_init()
+graph_t tengine_lite_init_stage1(void)
+{
+    tiny_stage1_graph = get_tiny_stage1_graph();
+
+    graph_t graph = create_graph(NULL, "tiny", ( void* )tiny_stage1_graph);
+    if(graph == NULL)
+    {
+        printf("create graph from tiny stage 1 model failed\n");
+        return NULL;
+    }
+
+    if(prerun_graph(graph) < 0)
+    {
+        printf("prerun stage 1 graph failed\n");
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    return graph;
+}
+
+void tengine_lite_release_stage1(graph_t graph)
+{
+    postrun_graph(graph);
+    destroy_graph(graph);
+    free_tiny_stage1_graph(tiny_stage1_graph);
+}
+
+#if AID_AOT_PLAN
+// the speech model from its plan, in an arena of its own: the graphs of a shorter hop take one
+// each. *arena goes to tengine_lite_release_aot()
+aot_graph_t tengine_lite_init_aot(void** arena)
+{
+    int arena_size = get_aot_arena_size(tiny_aot_plan);
+    aot_graph_t graph;
+
+    *arena = NULL;
+    if(arena_size < 0)
+    {
+        printf("the aot plan does not match the tengine of the app\n");
+        return NULL;
+    }
+
+    *arena = malloc(arena_size);
+    graph = bind_aot_graph(tiny_aot_plan, *arena, arena_size);
+    if(graph == NULL)
+    {
+        printf("bind aot graph to %d bytes failed\n", arena_size);
+        free(*arena);
+        *arena = NULL;
+    }
+
+    return graph;
+}
+
+void tengine_lite_release_aot(void* arena)
+{
+    free(arena);
+}
+
+// fraction bits of the q7 input of the plan
+int tengine_lite_aot_input_shift(void)
+{
+    return (( const struct aot_plan* )tiny_aot_plan)->input_shift;
+}
+#endif
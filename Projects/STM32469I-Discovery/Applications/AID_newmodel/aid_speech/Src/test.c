@@ -11,6 +11,7 @@
 #include "cmsis_os.h"
 #include "waveplayer.h"
 #include "waverecorder.h"
+#include "decimator.h"
 
 FATFS USBH_FatFs;
 USBH_HandleTypeDef hUSBHost;
@@ -40,19 +41,15 @@ void stereo_to_mono(const uint16_t* src_audio,int samples_per_channel,uint16_t*
     }
 }
 
-void stereo_to_mono_with_resample_16_to_8(const uint16_t* src_audio,int samples_per_channel,uint16_t* dst_audio) 
-{
-    for (int i = 0; i < samples_per_channel/2; i++) 
-    {
-        dst_audio[i] = src_audio[4 * i];
-    }
-} 
-
 static void hardware_record_task(void const *argument)
 {
   show_on_lcd("Enter Hardware_record_task......\n");
 
   uint16_t *one_channel =(uint16_t *)malloc(AUDIO_IN_PCM_BUFFER_SIZE/8 * sizeof(uint16_t));
+  // keeps the low pass history from one dma half buffer to the next
+  struct decimator *mic_decimator = (struct decimator *)malloc(sizeof(struct decimator));
+
+  decimator_init(mic_decimator);
 
   /* Configure the audio recorder: sampling frequency, bits-depth, number of channels */
   if(_AUDIO_REC_Start() == AUDIO_ERROR_NONE)
@@ -63,7 +60,7 @@ static void hardware_record_task(void const *argument)
       /* Check if there are Data to write to USB Key */
       if(_BufferCtl.wr_state == BUFFER_FULL)
       {			
-        stereo_to_mono_with_resample_16_to_8(_BufferCtl.pcm_buff + _BufferCtl.offset, AUDIO_IN_PCM_BUFFER_SIZE/4, one_channel);
+        decimator_stereo_to_mono(mic_decimator, (q15_t *)(_BufferCtl.pcm_buff + _BufferCtl.offset), AUDIO_IN_PCM_BUFFER_SIZE/4, (q15_t *)one_channel);
         AwakenBuffMicData((short *)one_channel, AUDIO_IN_PCM_BUFFER_SIZE/8);
         //_BufferCtl.fptr += byteswritten;
         _BufferCtl.wr_state =  BUFFER_EMPTY;
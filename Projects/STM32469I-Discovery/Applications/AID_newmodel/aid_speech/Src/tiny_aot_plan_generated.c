@@ -0,0 +1,4773 @@
+/* generated by save_aot_plan(), do not edit */
+
+#include <stdint.h>
+
+const int tiny_aot_plan_size = 152464;
+
+const uint32_t tiny_aot_plan[38116] = {
+    0x544f4154, 0x000d0004, 0x0000001c, 0x0000001b, 0x00025390, 0x000005a0, 0x00000400, 0x00000960,
+    0x0000002c, 0x0000036c, 0x0000060c, 0x00000106, 0x00000000, 0x00000001, 0x00000000, 0x00000000,
+    0x00000050, 0x00000050, 0x000000a0, 0x00000000, 0x00000300, 0x00000008, 0x0000000a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00010307, 0x00030002, 0x00020004, 0x00000006, 0x00000000,
+    0x0000000a, 0x0000000a, 0x00000002, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00040106, 0x00000000, 0x00000005, 0x00000000, 0x000000b0,
+    0x00000180, 0x00000240, 0x000003c0, 0x00000001, 0x00000300, 0x00000008, 0x0000000a, 0x00000000,
+    0x00000004, 0x00000000, 0x00000000, 0x00050307, 0x00070006, 0x00020008, 0x00000007, 0x00000000,
+    0x00000008, 0x00000001, 0x00000002, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00080106, 0x00000000, 0x00000009, 0x00000000, 0x00000480,
+    0x000000a0, 0x000000f0, 0x00000190, 0x00000000, 0x00000300, 0x00000008, 0x0000000a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00090307, 0x000b000a, 0x0002000c, 0x00000008, 0x00000000,
+    0x00000004, 0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x000c0106, 0x00000000, 0x0000000d, 0x00000000, 0x00000620,
+    0x00000090, 0x00000090, 0x00000120, 0x00000000, 0x00000300, 0x00000008, 0x0000000a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000d0307, 0x000f000e, 0x00020010, 0x00000008, 0x00000000,
+    0x00000003, 0x00000001, 0x00000002, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00100106, 0x00000000, 0x00000011, 0x00000000, 0x00000750,
+    0x00000040, 0x000001c0, 0x00000200, 0x00000000, 0x00000300, 0x00000008, 0x0000000a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00110302, 0x00130012, 0x00030014, 0x00000008, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00140302, 0x00160015, 0x00020017, 0x00000008, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00170302, 0x00190018, 0x0000001a, 0x00000008, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x001a0104, 0x00000000, 0x0000001b, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000550, 0x00000001, 0x00000008, 0x0000000a, 0x00000001,
+    0x00000104, 0x00000000, 0x00000001, 0x00000010, 0x0000000a, 0x00000001, 0x00000104, 0x00000000,
+    0x0000000a, 0x0000000a, 0x00000001, 0x00000060, 0x00000004, 0x00002580, 0x00000060, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x000003c0, 0x00000001, 0x00000004, 0x00000001, 0x00000060,
+    0x00000104, 0x00000000, 0x00000001, 0x00000008, 0x00000001, 0x00000060, 0x00000104, 0x000025e0,
+    0x00000008, 0x00000001, 0x00000060, 0x00000050, 0x00000004, 0x000115e0, 0x00000050, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x000003c0, 0x00000001, 0x00000001, 0x00000001, 0x00000050,
+    0x00000104, 0x00000000, 0x00000001, 0x00000005, 0x00000001, 0x00000050, 0x00000104, 0x00011630,
+    0x00000004, 0x00000001, 0x00000050, 0x00000048, 0x00000004, 0x00017030, 0x00000048, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00000190, 0x00000001, 0x00000002, 0x00000001, 0x00000048,
+    0x00000104, 0x00000000, 0x00000001, 0x00000003, 0x00000001, 0x00000048, 0x00000104, 0x00017078,
+    0x00000003, 0x00000001, 0x00000048, 0x00000040, 0x00000004, 0x0001a678, 0x00000040, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00000200, 0x00000001, 0x00000001, 0x00000001, 0x00000040,
+    0x00000104, 0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x00000200, 0x00000104, 0x0001a6b8,
+    0x00000040, 0x00000200, 0x00000000, 0x00000000, 0x00000002, 0x000226b8, 0x00000040, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00000200, 0x00000001, 0x00000040, 0x00000000, 0x00000000,
+    0x00000102, 0x000226f8, 0x00000080, 0x00000040, 0x00000000, 0x00000000, 0x00000002, 0x000246f8,
+    0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000080,
+    0x00000000, 0x00000000, 0x00000102, 0x00024778, 0x0000000c, 0x00000080, 0x00000000, 0x00000000,
+    0x00000002, 0x00024d78, 0x0000000c, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000080,
+    0x00000001, 0x0000000c, 0x00000000, 0x00000000, 0x00000102, 0x00000540, 0x00000001, 0x0000000c,
+    0x00000000, 0x00000000, 0x00000102, 0x0dfe03df, 0x18fcfe1a, 0x06ddfb00, 0x1227fdf2, 0x080e14f7,
+    0xecf90a00, 0x06ef081e, 0x01020cfd, 0x0805fc02, 0x13fdef0c, 0xfe05fb08, 0xf30403f4, 0x000c03f6,
+    0xf4e3fe07, 0x00faf40d, 0x0009060d, 0xfe08f7e1, 0x0c0bf105, 0xf7ee0512, 0xf4fbff03, 0x0afffd0b,
+    0xfefe03f5, 0xf50b02fb, 0x00020df2, 0x00030203, 0x05f9f70a, 0x07edeb0a, 0xf70ffdfc, 0xec0c10ee,
+    0x0dfbf8e6, 0x11e7000f, 0xf1e6030d, 0x030b0aef, 0x121c02ef, 0xfae5f2ee, 0xf6f30d08, 0xf401180e,
+    0x110201fc, 0x0a0ae1fa, 0x00f0fa1f, 0xf1010cf7, 0xfd1f02f6, 0x02f7f807, 0xf4f10502, 0x000cfd1b,
+    0x150c00eb, 0xff13fde9, 0xfded071c, 0x0ddf200b, 0xf60ff508, 0xfffb06f3, 0x13f6f8f9, 0x06fbfcf4,
+    0xed04ff01, 0xfb040401, 0xf60bfafd, 0xf217f00f, 0xea05ef0c, 0xf918f105, 0xef0df817, 0xee04e108,
+    0xea1dfd23, 0xee08e814, 0xfa26f4fd, 0xf213f017, 0xf8f8fc06, 0xed0dfb0a, 0x10fb0010, 0xfa0200fe,
+    0xf70ef705, 0xfe050505, 0xfd08f8fa, 0xda04f902, 0xe508ea05, 0xe6f3f301, 0x05090308, 0x04130fe1,
+    0xf510f0f6, 0xfffa10fe, 0x0ce7ec0b, 0x15f2ec11, 0xf4f9f522, 0xed0c1bed, 0xfc2216ef, 0x2200f6f6,
+    0x04f2f809, 0xfa040906, 0xfb0607f8, 0x10fbf9f9, 0x05f403ff, 0xff0404fe, 0x050c04f0, 0x09fff7ff,
+    0xeef90407, 0xfbf30df9, 0x08fc03fa, 0xf9fe02fa, 0x01d511fa, 0x0901fe03, 0xff0c13fd, 0x09f9fffd,
+    0x0eee0cfa, 0x01ff0ff9, 0xe608fb07, 0xcb3eb246, 0x15ed05fe, 0x6bb01ff1, 0x000006ca, 0x31dc0efd,
+    0x79a818e3, 0xef07fa04, 0xe614eb1c, 0xfe01b944, 0xef0201fe, 0x0008f313, 0x0005fd01, 0x0ef3fa06,
+    0xfe0100f0, 0xeb0eec09, 0xf324ce34, 0xf70202fe, 0x0ef7f411, 0x0101eb05, 0x0df10afb, 0x19ef07f9,
+    0x0dfa01fd, 0xf4fa000d, 0xfcfaef08, 0x0d0b19fe, 0xf4efedf5, 0x0607fafc, 0xebe91019, 0xfbf8ede6,
+    0x091f0f04, 0xe6ebe90e, 0x0f0500f7, 0x0116080c, 0xfefcdce6, 0xf30102f4, 0xef04141a, 0xecfcf804,
+    0x1817f6f7, 0x03070925, 0xece2f8fe, 0x23100ae4, 0xf403140c, 0xffd2ebd0, 0x0b0f30ff, 0xfff4db0d,
+    0x2b0f091c, 0xfeef0102, 0xf2fff4e2, 0xfa000a03, 0xfbe1fff3, 0x1320f10a, 0xf8f5f703, 0xf4ff04f7,
+    0xeffc1a25, 0xfcf4f9fc, 0x132803ee, 0x05f9f300, 0x0ef108fb, 0xf6ff1a18, 0x0403ffff, 0x181611f2,
+    0xf3fbf6fd, 0x0cf5fb00, 0xfeff080a, 0xfb0102ff, 0x0afe0a00, 0xf509ff01, 0xee0ae806, 0xf6fe02f1,
+    0xee05f8fa, 0xf1e8f009, 0xf9e6070f, 0x02f110e8, 0x0105f8e8, 0xdcfaf002, 0xf20b151b, 0xec16edd9,
+    0x281bef12, 0xebdd1830, 0x06250714, 0x03060ef5, 0x18ebf307, 0xebf91918, 0x091415f9, 0x11f10cea,
+    0xf6e9e7ed, 0x02051712, 0xe50806e0, 0x130ae6f9, 0xf1f4fa15, 0xf3f10107, 0xfe0dfb04, 0x0c07ef0d,
+    0xf703f501, 0xfe07fbff, 0x0f01f007, 0x0dfc07fc, 0x0800f2f6, 0x09fbf803, 0xfa050bfe, 0xfd06fef6,
+    0x0c0508f1, 0xfbf1080f, 0xf9f60b04, 0x13140a0b, 0x0e02f604, 0xff05d2ff, 0xfd121306, 0xcb130bfe,
+    0x0bf5e7f1, 0x0d050b23, 0xe1f00313, 0x0605f1f0, 0x2c03020d, 0xe8fbfcf9, 0xfd03f1f3, 0x090923fc,
+    0xeffbf406, 0x09fa0203, 0x04fb05fa, 0xfaf80003, 0x0303fff8, 0xefe219fc, 0x02feda25, 0xf90901f5,
+    0x23c462dd, 0x06fefe02, 0xec2405f2, 0x01052ed8, 0x19f015f8, 0x2af704de, 0xeb09fc00, 0x031fe610,
+    0x0100c622, 0x01f90afc, 0xe4fcf8fc, 0x07000001, 0xe31307fb, 0x03fe4f05, 0x020ef9ff, 0xe5d92ddc,
+    0x11f8fe01, 0x15f90ce7, 0xfb04ea04, 0xea17ec0b, 0x0a22ce20, 0xff08f0fd, 0x110f07fa, 0x00fbeb11,
+    0x04effc00, 0xedfc0412, 0xf60a07ef, 0x180d0ef8, 0x13e1f701, 0xfaf7f314, 0xedfd050b, 0xf70d11ee,
+    0x16f101fa, 0x030afd0d, 0x11fcf5ed, 0x1118f806, 0xfcdaef1a, 0xdfff150f, 0xe01817ff, 0x0e0e0fdc,
+    0x10f8df14, 0x18f6f311, 0xfb03f806, 0x03070b00, 0xe70f1807, 0x0ff703f4, 0xf90304ef, 0x251aff06,
+    0xfbf2ff14, 0xf6050b11, 0x091f170b, 0x1f03f9f9, 0x02eaed06, 0xf7011b20, 0x01112cf1, 0x2a0ff9dd,
+    0x21ebed07, 0xeae21012, 0xf70b15fe, 0x14f90eed, 0x0beee9f2, 0xf1fd0808, 0xe30214f3, 0x0b07f9e7,
+    0x06f2e209, 0xe3eff008, 0xe7070704, 0x05020b00, 0xfc05f6fa, 0xff04e80b, 0xf00e1405, 0x0301060b,
+    0x0d03f40e, 0x0d1001fa, 0xf0f5eefb, 0xfe0b03fb, 0xe5071112, 0xe8dee8dc, 0x0c0efef8, 0xf3e5000f,
+    0x12edeaee, 0x0f100205, 0xf6000100, 0xf6f2ffe5, 0x0d1e1007, 0xe4fd0005, 0x08ebecde, 0x0c111b1a,
+    0xf2f7021a, 0x120bfaf5, 0x28111315, 0xfcfefb02, 0xfd140408, 0x0405080a, 0xfe0701fa, 0xf4030404,
+    0xf507ef1b, 0x0f0805f8, 0xf501fc03, 0x06f80004, 0xf0fa0a1f, 0x070504f5, 0x051aff07, 0x02d5f3f5,
+    0xfd0e06fe, 0xf806060b, 0x03fd03fe, 0x03f9fa05, 0x020a0104, 0xf5fbfdf8, 0x0c03fafc, 0xf9fb0105,
+    0xedf7fbf6, 0xff090c07, 0xfffb0003, 0x0805f3f1, 0xfe03ff06, 0x01f9fff6, 0xfe04f603, 0xf6faf904,
+    0xf3fd07f7, 0x12eb01f3, 0x1fedd40c, 0x00012214, 0xd8eff60c, 0xfe282eff, 0xd01a040b, 0x3a11fbdc,
+    0x0506d904, 0x0cf5d914, 0xdadf231d, 0xf2fd0102, 0xef1f0e0e, 0x04fee9df, 0x0e1808f1, 0xfcefe708,
+    0x17f3fffe, 0xe2021209, 0xfd040002, 0x07021af1, 0x0904ebfe, 0x1afef7ff, 0xe2f20706, 0xfefdfc01,
+    0x03100e07, 0xfffce0e9, 0x0116f0d5, 0x060203fe, 0xf307f803, 0xf5eb0415, 0x07080bfd, 0x0314050c,
+    0xfefaf7ed, 0x08e50703, 0x0902030c, 0x080102f6, 0xfefc03fe, 0xf9fb0d0c, 0xfd08ffff, 0x080a00ec,
+    0x01f8fc05, 0xffeafd0a, 0xfa0d0606, 0x050b02fd, 0x06fffaf1, 0xfcfc0601, 0xf8f50c0f, 0x040405ff,
+    0x0709fc02, 0x07fff8f5, 0xfcfcff02, 0x05100706, 0xfef5e6f9, 0x0c060b03, 0xe8e61706, 0xfffbfae4,
+    0x00f0f6fa, 0xe70a331a, 0xdbfaf9ed, 0x6861fad6, 0xe1f5011f, 0xfbf2e4fc, 0x1712161a, 0x06021c16,
+    0xc3d5f317, 0x081c0900, 0xf70b1b05, 0x1cebe1cd, 0x0f03fb00, 0xfdfd0403, 0x0103fff9, 0x08fdfeff,
+    0xf7f70519, 0xfafb05eb, 0xfa080efc, 0xfbf9f2fa, 0xf6070fff, 0x00fef900, 0x11f4f805, 0xe9080901,
+    0x01ff05f7, 0x090c05f8, 0x0603e010, 0x03eaff04, 0xe612f91d, 0xfb0c09f9, 0xf527fef6, 0xfbfafa04,
+    0xfafdf704, 0x0efcff12, 0xfa00f9f3, 0x01f0f007, 0xf7f727fa, 0xf60d03f4, 0x29f907d3, 0x08f5f402,
+    0xffdb0018, 0xf91116f2, 0x020f04f6, 0xfef200f0, 0x09fcfa06, 0x18fcfbf9, 0x1226e4fd, 0xf2fbf205,
+    0xce0a2401, 0xf2040539, 0x2afdef06, 0x0b2ace00, 0x010bf9fd, 0xdc041df1, 0xf2f71901, 0xf8f00a06,
+    0x09dd0e09, 0x0a00f3fa, 0x2b0ae4fb, 0xf40cf0e0, 0xdd0702fe, 0xe1f032fc, 0x08fc1307, 0x2ef0ea0d,
+    0x1405faf1, 0xeb1204fc, 0xebf91df2, 0x0afb13f6, 0x1bf6f109, 0x10faf3f4, 0xf7f2fdde, 0xfbf0fbf8,
+    0xffdcfbf6, 0xfbfffcf8, 0xff00f7fc, 0x0300fd1c, 0x04fb0102, 0xff13fc00, 0x06fa0b03, 0x01030403,
+    0x0a0904ff, 0xff0902fe, 0x0004ff03, 0x0301fd0a, 0x07010403, 0xf904fc05, 0x06f90606, 0xfd0c0809,
+    0x0000ff00, 0x00050201, 0x01000004, 0x05fc0301, 0x01020305, 0x04060c05, 0x09090105, 0xfa060d00,
+    0xffeaecf4, 0x1701e708, 0xe9eaed0e, 0xf40af9f3, 0xea04fefe, 0xff0a16fb, 0xdbff0913, 0x1bfaf007,
+    0x2f200d16, 0xfc12d7fd, 0x0d1cf8fa, 0xf5fd2b1d, 0xf6f9140b, 0x1bedfc03, 0x11fc0601, 0xea0af70d,
+    0x0f0103d8, 0x021a0dee, 0xffd4e104, 0xffeb0805, 0xef050211, 0x0404efe5, 0xff0cf6fa, 0xfef6f60d,
+    0xede8020f, 0x0405fefc, 0xf61305f2, 0xf8efe4f3, 0x04f40e11, 0xf0faec11, 0x1217fbf0, 0xf60d0b07,
+    0xf201f1f8, 0x0b03020f, 0x02f412ff, 0x06f90110, 0x12f4f807, 0x050f0b00, 0xf8f5f7e8, 0x0a1006f2,
+    0xefe7030a, 0xfcfdf6e8, 0x08fc0e17, 0x01eef6e8, 0x0611f1fc, 0xfafc0606, 0xf5fc0cf5, 0xff120009,
+    0x0fff0f0d, 0xfef1fe12, 0xfa03f603, 0x0a00fff8, 0xfff50500, 0xfafe02fa, 0x181503d9, 0x0901fdff,
+    0xfaf8fd09, 0xfdfd1618, 0x07020bfd, 0xfdf5f91c, 0xf001ff08, 0xf3230201, 0x0508ebe1, 0x06f5fa01,
+    0xe1eef922, 0xfe03fbf9, 0x0b18fe04, 0xf3fdee08, 0xf805f2fb, 0x091109ed, 0xf8fe0206, 0xfed5fc00,
+    0x04020ffd, 0x01070a02, 0x0402fdff, 0x02fd0709, 0xf903fe0a, 0xfd0ffd02, 0x050af001, 0x0401fdfd,
+    0xe211ff03, 0x01000dfe, 0xfaf802f9, 0x1bf1e121, 0x02f00303, 0xe042fee5, 0x070310e1, 0xf3dc08ef,
+    0x11d9f547, 0x0c020903, 0xf943edde, 0x0afd0ede, 0xf0ef0a0c, 0x07e5072f, 0x070bff00, 0x0a09ec02,
+    0xfa0005f3, 0xfd0efc07, 0xfdf305f7, 0xf5040e04, 0xed000c06, 0x1b04f5f1, 0x02fee4f2, 0xefef0904,
+    0xe8f423fd, 0x1603ff09, 0x24fbfbf8, 0xf81cfbfa, 0xfa0504f1, 0x08fd08ff, 0xf5e7f80d, 0xe001f7fb,
+    0x04031604, 0xfe07f806, 0x1b0cdaff, 0xff0906f0, 0xe2ff0b01, 0xfffe0807, 0x0303f90b, 0x08fae4fd,
+    0x0004fbf9, 0xea031203, 0xfdf90804, 0x0910ff12, 0xfa0409fe, 0xf711f8e6, 0xf90100fb, 0xf0d00c22,
+    0x05f801f9, 0x2133f4fd, 0x00e5efd7, 0xf7fa0201, 0xf5001826, 0xfc08f7dd, 0xf5fb02f7, 0xf2ed002e,
+    0x08fdf60d, 0x0244d5d7, 0xfc110700, 0xd9d30a05, 0x08150c32, 0x070903f5, 0x0609f0e2, 0x00f10915,
+    0x06f9fe06, 0x0810fdee, 0xf70306ff, 0x02f30e0e, 0x000a0704, 0x0312140e, 0xf9ea01f9, 0x1310e3e9,
+    0xffe9fb1d, 0xe4edeef9, 0xeb100109, 0x0a0dffe4, 0x0306070b, 0xf9f4ecff, 0x060204fd, 0x03000004,
+    0x05f0fc0a, 0xfbfbfc0e, 0x080c17fd, 0x0f10fe00, 0x11f2f601, 0x02fd0209, 0xf50a1108, 0x0207fef3,
+    0x0907f3f7, 0xfbebeae5, 0x10071911, 0xeddf030f, 0x021900f1, 0x09fe1307, 0xe7f4f600, 0x17e8ebf8,
+    0xfa0511f8, 0x09ffe6ff, 0x000614e1, 0xef0bfa08, 0xfdef21f6, 0xf004f419, 0x28ecf912, 0xff08fb0b,
+    0x000af500, 0xec092aea, 0xf9fde71e, 0x24e90408, 0xec1bd816, 0x020400fe, 0xd6151ff6, 0x03f9e719,
+    0x0cef0402, 0xf720e31a, 0x02f6fdfd, 0xec1909ff, 0xfc040513, 0xff0bfffe, 0xff06ed09, 0x00fb1403,
+    0x04fefcf4, 0xfd0604fa, 0xf7fd03fc, 0x01fb09fe, 0x2301cb09, 0x0201fe01, 0xbdf5fcfe, 0x09f73b0b,
+    0x03fb070d, 0x1c13f3e0, 0xfe1001fe, 0x31f50a06, 0x0906e107, 0x01fe0101, 0xcbef2e0d, 0xfdfd1118,
+    0x0c11f6f6, 0x1215deee, 0xf4f8fdfc, 0xfbf90107, 0xf5f80003, 0x0503f608, 0xf0000a03, 0xf80ffcf9,
+    0xf31b0209, 0xf300fd0a, 0x010f030d, 0x0a1becff, 0xfb00f0f6, 0x04d4fd0a, 0xf3f00619, 0xfc08f102,
+    0xeb0b34cb, 0xf4fefe01, 0x38e701fe, 0x041bedec, 0xfdfa01f3, 0xf9e5120e, 0x0bf7f91f, 0xf02ef7f8,
+    0xf8140be7, 0xf8fd13fb, 0x10fadb26, 0x09080a05, 0xde1bf9f7, 0x11f90d0c, 0xf7fcff06, 0x0c11f013,
+    0xf9060af6, 0xff02fa06, 0xf608f00c, 0xf600f413, 0xe10cfd0f, 0xf515fb08, 0xf11504fa, 0xed12e500,
+    0x08fd081c, 0xe0fee41a, 0x0217f415, 0xe8150efe, 0xec12f2fe, 0x0902040c, 0xfe0ced08, 0xfc0eec0f,
+    0xfbf8fc01, 0xf1010510, 0xfefefe08, 0x0a0f04f1, 0xfa09f608, 0x01eff6fb, 0xf4080e01, 0xf5faf609,
+    0x0efc02f8, 0xf910fc00, 0x06ea1fff, 0xf9fefcea, 0x33f8f800, 0x04fc0cdb, 0xfbfdfafc, 0x09d80df6,
+    0xf8081813, 0xdaf7f60e, 0x1b2401f0, 0x070f0711, 0xee21cd01, 0x08050a0f, 0xe4070a09, 0xf0f0e32f,
+    0x0fff02f9, 0xeb2bfd0b, 0xf6fbe7ec, 0x000800fb, 0xedf8fe18, 0x00fafdfc, 0x090a0104, 0x00fdf1fe,
+    0x070403ff, 0xf2fe09f6, 0xfa040bff, 0x15fcf401, 0x0e21f3f5, 0xfefb0bcf, 0x0be6060f, 0x32f2c92e,
+    0xde120cfc, 0xc7e13fef, 0x10042047, 0x1421d0f7, 0xd65c0cba, 0xeee00b09, 0x4be4e827, 0xfa05c409,
+    0xd80622f5, 0xeace3207, 0x2207f6fe, 0xfc11eef8, 0xfdfd0ee8, 0xf508f909, 0x0909f109, 0x080102fe,
+    0xff08f901, 0xfb03f207, 0x0cf60a01, 0x0cee0100, 0x0e00f7fc, 0x0af7f908, 0xf2fb0e0f, 0x030e0503,
+    0x05fc0a05, 0x0601ebf7, 0xed011226, 0xf0f2fcf3, 0xfd1b2d19, 0x1d0bd7d6, 0x252a06fd, 0x0fced8e8,
+    0x150d1e30, 0xe8c4e206, 0xdc145119, 0xc7dc0c11, 0x2d4010de, 0xff06e1fa, 0x2011ede6, 0xe9ecdf23,
+    0x0cf8fdff, 0xe7fd140f, 0x01fefbf1, 0x00fc0905, 0x08fbfe02, 0xf6f4fa02, 0xeffc161a, 0xfc03fafe,
+    0x1912fff1, 0xfffafbfa, 0x0ffdfe02, 0xf80b0609, 0xfa08fdf7, 0x0f0e0ffc, 0x04f9fff8, 0xfff7fc07,
+    0x02f80400, 0x02080d04, 0xf800f7f8, 0x0d0408fa, 0xf80008fe, 0x05fff402, 0x07f70507, 0xe8f0021a,
+    0x130bfc0a, 0x032905f0, 0x0a08cbce, 0x03fe1c06, 0xd6daf91d, 0x03001f00, 0xfff6fef4, 0x0bfbf72d,
+    0xf2fb0116, 0x011fe61e, 0xf71622d6, 0xd936f605, 0x0ac826dc, 0xf610f512, 0x39c3f214, 0x0400dcf3,
+    0x1ce5f70c, 0xca2209de, 0x060812ef, 0xde061ada, 0x19efe225, 0x10e80df5, 0x0713e71d, 0x03f210f9,
+    0xfb1ffaff, 0x03030d01, 0x0207fcfc, 0xfff1fe15, 0xfe030600, 0x020a010b, 0xfd0201fa, 0xe604f603,
+    0xfe11050c, 0xe5041102, 0x0624da08, 0x000cfe18, 0xe30fe3ff, 0xf00e0c31, 0xf9fdf40a, 0xfe0cfe09,
+    0xfef9fbec, 0x240916fe, 0xfae0f7f3, 0x1efdfcf6, 0xeeda3809, 0x05f602e5, 0x2af90cfe, 0x1af6f1d8,
+    0x04010af5, 0xfaf002f7, 0x12fd1102, 0xf4e90103, 0x0906fdf9, 0x0b01f516, 0x02f8f9ea, 0xf10d0306,
+    0xf3f8fa02, 0xec160217, 0x03ff0c03, 0xf51ef9e4, 0x15f3f219, 0x10d809fe, 0xfb02e018, 0x0bff07f6,
+    0xe90718d8, 0x06f2f8fd, 0x1ef208fd, 0xf1fdf9f4, 0xfefbfdfb, 0x04f00311, 0xf70904ee, 0xf72afcfc,
+    0x08f40be7, 0xf6fef604, 0x12e4f120, 0xfff717f4, 0xf815f802, 0x11f618ef, 0xfc0704ff, 0x080cfe06,
+    0x050803f9, 0xfdf2efd8, 0x0ffe08f5, 0xf3f90509, 0x01f7f6f4, 0xfe02f804, 0xfbf8fdff, 0xf6fcfdff,
+    0xfc0101fe, 0xfe04fcfd, 0xfefa0100, 0x03030005, 0xfe020202, 0x0303fcfd, 0x05020102, 0x04fcfffe,
+    0xfe010507, 0x00020405, 0x0304faff, 0x06fc0107, 0xfb0002fe, 0x060a080c, 0xfb00fb02, 0x0810fdfe,
+    0x06020806, 0x0b01fd07, 0xf701f004, 0x0713160b, 0xf6fd0cfd, 0x181a0802, 0xf803fd1b, 0x0d0902fc,
+    0xe7fe1c18, 0x0406effe, 0x11110a0c, 0xf8ece9ed, 0x0610060a, 0xe4ef0007, 0x0203e4ee, 0xff0cfe07,
+    0xe5f7e2e9, 0xfefbfff9, 0xe6f4ff0b, 0xfbfb03f4, 0xfc01fd00, 0xfbf2f0ff, 0x08fe02ff, 0xfdf7f6ff,
+    0x00fc00f8, 0xf80d09f5, 0x050b10f3, 0xf40501fe, 0x06fc0efc, 0x00fc0a17, 0x11fffb00, 0x09170df0,
+    0xf0f70904, 0x0e000f03, 0x0a0d0213, 0x05f2e6e1, 0xf8011c1b, 0xf8ddf712, 0x0e1e0a04, 0xec0ef5ed,
+    0x010704f8, 0x08fbf717, 0x080ffe02, 0xeef4fb04, 0x13f40d04, 0xf5fc0d0e, 0xf1f4e9f2, 0x181a05f3,
+    0xf0e8f102, 0xf5f1e7ec, 0xf2fc1b11, 0xf9e9f2fb, 0x0ded10d8, 0xfccf0fd7, 0x06faecd0, 0xf6fcf90a,
+    0xe0edd6d3, 0xfb06090e, 0xfc08f309, 0x07080407, 0xfd09fffc, 0x070aff16, 0xfcf5fb01, 0x0311ff04,
+    0xfc0528fb, 0x05fa08f6, 0x080d09fe, 0x02fafe03, 0xff070003, 0xfdffe6f4, 0x07fd0102, 0xfcf4fafe,
+    0x0309fa06, 0x080f090c, 0xf402060c, 0x12120004, 0xff12200a, 0x00060c0a, 0xf509f0fd, 0x0a0cf304,
+    0xfefef2eb, 0xfff4e7f4, 0x01e9eb05, 0x12f0f807, 0xd6d8171b, 0x02152107, 0x173c280b, 0x182aebdf,
+    0x22041103, 0x1104f3f0, 0x0ffbee0e, 0xedd9e412, 0xe9f01a11, 0xedea12fb, 0x0d0ef3ea, 0x01fdf4f3,
+    0x0af9fdfc, 0x07010507, 0x04fc00fc, 0xf302fdfb, 0xff040fff, 0x04fb05fd, 0xe1ff0d08, 0xee011608,
+    0xfc0df4fc, 0x192800d6, 0xfff6e6ed, 0x31dfe602, 0xedd9fd34, 0xf1e91007, 0xcf043020, 0x0c171be8,
+    0x033d06ec, 0x1c13d8cb, 0x0605f90a, 0xfbdbea18, 0xf8f4052c, 0xf3f3fe08, 0xf51c13f8, 0x040805f0,
+    0x1001f8eb, 0xfdfbf90a, 0xfbfd0404, 0x010b0700, 0x0201fd03, 0x0401f501, 0xfef60405, 0xf6fc01fe,
+    0x11fbec24, 0xfafcde12, 0x1efed427, 0xe333f1e3, 0xfa10faff, 0xc40e33d3, 0xfa043a01, 0xf7db2def,
+    0x55bbdf37, 0x2ee70004, 0x151ecd0a, 0x020104c8, 0xe12a00f7, 0xd9f436ed, 0xe7060000, 0x11df0b10,
+    0x03ffca24, 0x10f9fffd, 0x0b0bf7f7, 0x020101ff, 0xfe0604fb, 0x0301f90a, 0x050304f7, 0x0204fc09,
+    0x0f0000fe, 0xec13f900, 0x02fe0ce7, 0xe9021101, 0x0fe1fa10, 0x0a02ff02, 0x1209dd0c, 0xfe06fee1,
+    0xe7160000, 0xf2f82bf0, 0xf3fefe04, 0x24e5fb12, 0xfd02eb18, 0x1402ec02, 0xf32616e1, 0xf4040101,
+    0xfbf41df6, 0x00fdfc18, 0x13f1fb06, 0xff0ef600, 0x020100ff, 0xed0f11f9, 0xfaff06fd, 0x0a000201,
+    0x00f9f70c, 0xe4e8f600, 0x16231c09, 0xecfc0003, 0x2a0ae3db, 0xfc122d1f, 0xffdff002, 0x22142503,
+    0xf401f000, 0x09060ff9, 0x04f8080d, 0x17fdf4fe, 0xfc060ffc, 0xf2fd10fc, 0xfff71100, 0x0b0bf2f8,
+    0x1117f9fe, 0xededfaf8, 0x0b030a05, 0xf9fc101c, 0x0504eee3, 0x161c1906, 0xf1d8e7ff, 0x0f01f9f8,
+    0xe5fb241a, 0x05fcf6d4, 0x1df9fffb, 0x01f9e5fe, 0xfd062001, 0xd9f517f7, 0x130bfb02, 0x16fafa06,
+    0x06fce7f5, 0xfbfd07fb, 0xfbf4130c, 0xfef4f310, 0xfe1000ff, 0xed0703fc, 0xfcf904f4, 0x1304f610,
+    0x0af3f205, 0xf306f9fa, 0xee022006, 0xfc0206fc, 0x1a09f7f8, 0x1a07eef3, 0xf9ee0104, 0xe3eb150a,
+    0x03040bfd, 0x130602f2, 0x0503eff5, 0xfefdfcf6, 0xfdf90207, 0xf9f706fc, 0xf901fdfa, 0x0a07fd0a,
+    0xff00fbf4, 0x0f01f8fc, 0x01fb0e07, 0xfcf5fc08, 0x04fcff0b, 0xfb0bff03, 0x01fc00f9, 0x0107fdf7,
+    0xf904fa0d, 0xf6edf4ee, 0xfa070a0e, 0x00fffd07, 0x0e0ef9fe, 0xeef5fb03, 0xf6e4efef, 0xfaf80c11,
+    0xf4f9f0f4, 0x0b19fee8, 0x0e0afb04, 0x161a0e27, 0xf4f60b04, 0x0d080106, 0x1506ed09, 0xfe07e4e0,
+    0xdff70707, 0xf3ef0405, 0xf902fe0b, 0xde05fedf, 0x02fd101e, 0x22e7e7fc, 0x222fd402, 0xe7fefff7,
+    0xec0320f5, 0x03f31214, 0x2100f6f6, 0xf9fb0cf6, 0xf9ff01fa, 0x1af51f13, 0xfb03ebe9, 0x15250402,
+    0xf1f40601, 0x0f04020a, 0xf7020b10, 0xff04f700, 0x10fa100c, 0x05150f03, 0x0a0e0910, 0x0a00eb1c,
+    0x0f0c0f0e, 0x11fc030e, 0x0e040300, 0x00fb060b, 0x050d0304, 0xf80912ff, 0xf80a1dfc, 0x02090310,
+    0xfb09f6fe, 0x02130108, 0x04f6f3fe, 0x07040009, 0xf503fb04, 0xf6fc05f9, 0xf3e5f9f0, 0x0511f411,
+    0xf909f7f9, 0xf7deeee2, 0x01f0f5fd, 0xf6fcf7fc, 0xe3e5f9e4, 0xd8efe0df, 0x0af804f1, 0x09faff0a,
+    0xeffcf90b, 0x031f13f6, 0xfd0c07fd, 0x0ff3dd1b, 0x030e0517, 0xe2190706, 0x0d02fff6, 0x180a0306,
+    0xf01103e8, 0xf3f60eef, 0x29e6130c, 0x07e7e91c, 0x0f05f1e5, 0xeb062901, 0xeff9f5eb, 0x070dfbf6,
+    0xee00ffef, 0xf3ec0014, 0x0decfa08, 0x111eee00, 0xfe02fcee, 0xf70109fc, 0x02f81111, 0x0feff5ec,
+    0x05090b06, 0xf6d60000, 0x090209f9, 0xfd040803, 0xfc02ff07, 0x070dfdfa, 0x0201f50a, 0xfe00f800,
+    0xfe0a0dfb, 0x01040702, 0x03f3fcf9, 0x02040506, 0xfc030403, 0xfe00fefc, 0x00030308, 0x00f7f9fe,
+    0x010906f5, 0xf9010106, 0xfbfd00fa, 0xf903030f, 0x00fbf5fd, 0x040df9fd, 0xeff9f605, 0xfffef5f6,
+    0xff00050b, 0x04fe0202, 0x010e13ff, 0x0602020d, 0x0bff0905, 0x05110702, 0xf8070800, 0x05020214,
+    0x0cfd0714, 0x0216ff09, 0x020509fe, 0x14000703, 0x0bfef20e, 0xf90806f2, 0xf1011705, 0x00ecf8fd,
+    0x2101f8fd, 0xf4f504e8, 0xf5fffaef, 0x04e70d0a, 0xebeeecf4, 0x0601f2ef, 0xf0f70ee1, 0xe3e0f2db,
+    0x04d01adc, 0xfee8faf6, 0x10fc0817, 0x04fe02fa, 0xfe1efce4, 0xf8f21aff, 0x01ec0b02, 0x170cf414,
+    0x0002f7e9, 0xf60b0bfa, 0xfee91419, 0x0a01fb02, 0xff1af2ff, 0xfb01fef0, 0x04fb0d07, 0x0ef7ee0d,
+    0x0505fc00, 0xea0208f6, 0x01000a01, 0x06f9f804, 0x0203ef00, 0xf103fe02, 0xf50104f6, 0x01020004,
+    0xfbf5f2ff, 0x0200f0fe, 0xecedfb05, 0x2805040a, 0x0607e407, 0xf3ffefe7, 0xe3093c09, 0xfcf10e01,
+    0x2f0adff4, 0x09fdeb05, 0xdef005fb, 0xf4013b00, 0x0c010109, 0x2801e4f5, 0xf909f701, 0xf5f71202,
+    0xfefe1bfe, 0x1012f700, 0xf9fbf603, 0x03f704fe, 0x00fb0c11, 0x0303f4f9, 0x0110fff6, 0xf2f500ff,
+    0xf6fc0c18, 0x16ffff03, 0x0d19f9fa, 0xff03f6ef, 0xfbfff502, 0xebeafd07, 0xf304fcfc, 0xff02fa05,
+    0xfdfcecf1, 0xfb06fe05, 0xf5f6fb00, 0xfc0c0dfc, 0xf903fe05, 0x19f30502, 0x03fe0df6, 0x0c04f602,
+    0x15ed20f0, 0x00f80bfa, 0x10f61104, 0x04f811f7, 0x0f1e08f6, 0x0406fdfd, 0x030700ff, 0xef080f2d,
+    0xfffefd01, 0x09f00ef8, 0xfefaf7ff, 0xfbf7f603, 0x0af80300, 0x2fe719f0, 0xfc033cc1, 0x05030103,
+    0xcb2c01ee, 0xf10bff01, 0x9a60c618, 0x02fde438, 0x27f504f5, 0x2ccb4abd, 0xfe05fffd, 0xed18f403,
+    0x0101df11, 0x0ff908fb, 0x010012ec, 0xfffc0102, 0xfafa0300, 0xfe002de8, 0xef08fc04, 0xd6170417,
+    0x02ffff00, 0x06e217f8, 0x01011cec, 0xea0afe02, 0xef14f319, 0xfe00f106, 0xfff90f12, 0xef07fffe,
+    0x0c080708, 0xf8f9fdf8, 0x1b0eef00, 0x03f903ff, 0xe402f4f7, 0x04ff220f, 0xf6ec0308, 0x1808ecfa,
+    0x05050005, 0x02fcf9f7, 0x0305fffc, 0x030b0702, 0xe7f41cfd, 0x05fefafe, 0x1e000914, 0xf6fee2eb,
+    0x0c1303fd, 0xf0f31b00, 0xfc01f6fe, 0x0efd0809, 0xf9f602fb, 0x03fdf803, 0x0f060404, 0x29050319,
+    0xffff1ff1, 0x0d1f1611, 0x0f041d14, 0x060901fd, 0x05110210, 0x00fef800, 0x0a150802, 0x1cf803fe,
+    0xfff90300, 0x0ffd0d0b, 0xff01f305, 0xfcf500fa, 0xfe09f211, 0xff020301, 0x0bf6f9fe, 0x05000204,
+    0x00fd05fb, 0x06f0f8ef, 0x0d050903, 0x0c03ff00, 0x13fe0dec, 0x1600260f, 0x1bf72215, 0x0a07f5fc,
+    0xfa14f300, 0x06f7fe2b, 0xfd070c02, 0x140cfa01, 0xf5fc0bf8, 0xf6f808f3, 0xfffb45ee, 0x11efe101,
+    0x2d00f6fc, 0xdfff0109, 0xeff61a01, 0x0007080f, 0x0d18e5f9, 0x2701d9fc, 0xfef30004, 0xf7e9ef2c,
+    0x01052816, 0xfd1205f2, 0x1c27faf2, 0x0ef9ff04, 0x01deec17, 0x0003f612, 0xf5011900, 0xdbf911ed,
+    0x1405fcfb, 0x01f70f1a, 0xf902fa01, 0x0109fffc, 0x130afd03, 0xfef7f70e, 0xfb0fe7e6, 0xfc0f051b,
+    0xead7f8ed, 0x061b0c10, 0xede0060d, 0x0f0b04ea, 0x0d060223, 0x23fff0ef, 0x162f04f0, 0xfbf511f9,
+    0xfef92203, 0x0df8090e, 0x0ff6fdf4, 0x05f20002, 0xfc0b03fa, 0x041001ef, 0xfbf406fe, 0x03fc0115,
+    0xff1a0ff6, 0x0513f004, 0xf4f524ef, 0xeb040203, 0x1ddf0b1e, 0x0b08ec04, 0x1017f104, 0xe91a05cb,
+    0x01061301, 0xebd51304, 0x0eedfb2a, 0x0ee90802, 0x0e1be101, 0x12fe09dc, 0xe81ffde4, 0xf9ec12fa,
+    0xeeeb10fc, 0x11e8fb2a, 0x08fdfc04, 0x0822eff4, 0xf31207eb, 0xed0306fe, 0xfdf2ff1c, 0xfffafe0f,
+    0xfb13f40b, 0xfb0903ee, 0xfbfaff14, 0xfa0afefe, 0x011804fb, 0x01060302, 0x0209f70b, 0x00fe000c,
+    0xf0070505, 0xf5110002, 0x0103fe04, 0x0101f703, 0xfe07f70e, 0xff00fdfa, 0xfd0a0000, 0xf9f9050c,
+    0x01040402, 0x0d0504fb, 0x07fcf8fa, 0x08f705fc, 0xfb0103fc, 0xfffa06fc, 0xf7f108d5, 0x0af10406,
+    0x0dd807fd, 0x0a04f3ec, 0x08fe0de9, 0x05f9f208, 0x0ef5fa0b, 0xfa010901, 0xf0030800, 0x0efd06e7,
+    0x0b0d0903, 0xfbdbdcfa, 0x14000ff2, 0xd1020d10, 0x14eaf6dc, 0xff0b1500, 0xf3e9d618, 0xfa0402f4,
+    0xef22fcfb, 0x02fc08fc, 0x03f3e509, 0x0c0e0410, 0xedff0100, 0x0cff0ffa, 0x00fa1817, 0x0e09fcf5,
+    0x101907f3, 0xfdf80ffc, 0xfcfe0c0e, 0x04f70e09, 0x060508fe, 0x090dfa0a, 0x09fff613, 0xf6000e00,
+    0xf418f709, 0x11f6fefd, 0xfbf606f6, 0xf4010f0a, 0x2bef14f9, 0x0a1cefed, 0x0bfdf100, 0xe6e63cea,
+    0xf502ff08, 0x3ee20204, 0xf605ebe9, 0x01050203, 0xf1f92ce2, 0x0601f0fc, 0x15e7f7fa, 0xf003fdff,
+    0xf0fdfe01, 0x0d03f8f3, 0xfefcfe08, 0xf602fa01, 0x020b0f04, 0x05f210fa, 0x05faf102, 0x10f90c17,
+    0xf400fdf1, 0x05140aee, 0xf9fc0602, 0x06f4f602, 0x0afffd08, 0xff0400fb, 0xf7fd03ea, 0x01010502,
+    0xf3fa070e, 0x0401fcf7, 0x1407010e, 0x02f4f6f3, 0xfc1bfd04, 0xfa0d10f7, 0xfc02fef4, 0x14f0ff1e,
+    0xffecfe14, 0x0117fd05, 0xfb1f13fb, 0xf60d01f4, 0x080cf604, 0xf4010420, 0x0cf9f0de, 0x070a0907,
+    0xf8f40a04, 0x0f06fcf3, 0x09fe020a, 0xf7f2fbf9, 0x0a0812fa, 0x02fe0104, 0x08fbf6f9, 0x05ffffff,
+    0xfe010502, 0xfcfa04f4, 0x0cfd00fb, 0xfe01ffff, 0xfaf8ff08, 0x00080ffa, 0xf508f60b, 0xfff9f2f7,
+    0xf4110407, 0xedfffafb, 0x0412fe1d, 0xf4eef3fe, 0x0a2ef808, 0xf0f0fd1c, 0xfe05fbe8, 0xeff40600,
+    0xf3fbedee, 0x0006f2f1, 0x0bfafb04, 0xe9fcf60f, 0x190efe06, 0x09011912, 0x0506f5fe, 0xfb291312,
+    0xfdfe0416, 0x17170706, 0x1b08111a, 0x00061920, 0x0b070e11, 0xfaff0810, 0xf9090404, 0x090af707,
+    0x050309fa, 0x10150904, 0x03070500, 0x09f409ff, 0x17fd15fd, 0xfaf70711, 0xece5e2e1, 0xf7f1e4f3,
+    0xfd06fbff, 0x010af802, 0xfc070af9, 0x04fd0204, 0x0af616f5, 0x12f70002, 0x1ee51dea, 0x04060ef2,
+    0x27e723ee, 0x10f422d6, 0x28e70704, 0x17d925e8, 0x080209fb, 0x12f11ef4, 0xfe0909e7, 0x0dfd07fd,
+    0xf2fb0302, 0x01f5fb11, 0xfe0ff907, 0xfe10f306, 0xf502f3fe, 0xeb1afa15, 0xfafdfb0c, 0x0c0805f2,
+    0x0bfb0107, 0x1a20f901, 0x0404fbf1, 0xfa0c00f0, 0xf9f51a07, 0xf1e20508, 0x0ae7ff0e, 0x0e0ef90d,
+    0x090ceadd, 0x0422f9e0, 0xe0fa2704, 0xdef40e06, 0x1fe30f13, 0x0c01f019, 0x0c00d51a, 0x0526f9f0,
+    0xe92308ed, 0xebfb0cfe, 0xfdf41612, 0x0403f10e, 0x110afa00, 0x00f3f9f6, 0x11fafc09, 0xf8ff0104,
+    0x030bfff5, 0x0eff11f9, 0xf6f4fdf9, 0xfcf1eff4, 0xecea0105, 0xf0f2fd0d, 0xfc08ed02, 0x0814ecf9,
+    0xe712f3f8, 0xe802fb0e, 0x01111510, 0x010bf51a, 0x1004f607, 0x07100624, 0x050cfb0b, 0x132efeff,
+    0xfc0b1904, 0xfcf80d03, 0x1b051a2c, 0x05fe110e, 0x0d14f3fa, 0x1507110a, 0x08f1fd01, 0x0418040a,
+    0xfa042205, 0x040e2101, 0x30030f17, 0xf6ff030c, 0x0104f801, 0x0f100f0c, 0x0201ebfa, 0x0c0afbf9,
+    0xe6f0130f, 0xf8f509fe, 0x160c02fd, 0x09f8edff, 0x07fef8fc, 0xfd050508, 0xfa04fcef, 0xf90406fb,
+    0xebec110a, 0xfff506fb, 0x1d0ff903, 0xfe01f5ff, 0xf3fdfafb, 0x030a100b, 0xf5f90300, 0x0ffbeae1,
+    0x0d060a15, 0xebdef903, 0x161a0ff5, 0xfb061006, 0xe505fc01, 0x2be5081d, 0xf4001ce5, 0x2e0ae213,
+    0xf2f215d9, 0x0a1bf803, 0xfcdd14d4, 0xf802cc2f, 0xf2d32bfb, 0xf031e420, 0x19ed00fc, 0xe019faf8,
+    0x03fa0f24, 0xf50809f2, 0xfd13f605, 0xfbf50802, 0xea0cfc06, 0xff0028f0, 0xff12f4f4, 0x1ff3e90a,
+    0xf9fe0bfb, 0x0c1bea06, 0x0c0306e6, 0xf10303fe, 0x00d51716, 0xff0ffb01, 0x000502ff, 0xfb0307fd,
+    0xfc00fd0c, 0x08010d09, 0xf70701ff, 0x12f90b02, 0x09fdf705, 0x0cfaf00b, 0xf90c1205, 0xe50607ff,
+    0x14020af6, 0x0800f80a, 0x04f4ec07, 0x040413fc, 0xf6fe0603, 0x01f9f2f1, 0x0901f702, 0xfef7f3fa,
+    0xf9f4fef4, 0x02f80f00, 0xfdfcfff6, 0xf6070df8, 0xfa0cf6fd, 0x140bf318, 0x0a161405, 0x0d0c1b07,
+    0x0e04fd02, 0x24121e10, 0xfb051d15, 0x28060a02, 0x1e13141d, 0x07010c14, 0x191810ff, 0x1218230a,
+    0xfc0103ff, 0x190a0702, 0xfefe081e, 0x03f7ee03, 0x16100f06, 0xeef6f2ff, 0xf4fff8f7, 0xeaff09fb,
+    0xf9f4f2fc, 0x0af2f4ec, 0xf4eceffd, 0xe2eeebe7, 0xf7fb03ed, 0xebddf3e9, 0xfcf1ecf1, 0xfc05fa06,
+    0x0f0410fa, 0xef09fa1b, 0x1112f80c, 0xff120008, 0xf606f600, 0xffff0809, 0x06f3f308, 0x031307ee,
+    0xe10dfefe, 0xfef119e7, 0xeb00060d, 0x0af3f711, 0xed00ee01, 0x2c02f414, 0xfa1efa0a, 0x0607e9dd,
+    0xfe132416, 0xe2d80e16, 0x102dfff8, 0x0508050c, 0x1f01e6e5, 0x0207d105, 0xfef60002, 0xcdf81407,
+    0xfb100afe, 0xf914f1dd, 0x16f9fbff, 0xe8db001d, 0x01150304, 0x04040af8, 0x1207fa04, 0xed05fa10,
+    0x1a2504e0, 0xfb060c02, 0x03d5dc0e, 0x0a072833, 0xed0901fc, 0x090e02f0, 0x0efb07fe, 0x0c0a0efb,
+    0xf6f5eaf7, 0x16fd05fd, 0xecfe0a0d, 0xfcfafc00, 0x0c120801, 0xf7fcf4fd, 0x0101f8fe, 0xf7f60916,
+    0xf605fbf4, 0xfe0df211, 0x05f509fa, 0xe114fdfe, 0x16ebf616, 0xfb07f8f2, 0xf20fea12, 0xfaf317eb,
+    0xfd09f601, 0x05fbf7ff, 0xf2f807ee, 0x04f90f02, 0x04ecfcfb, 0x12fcf8fb, 0xeefd18ff, 0xfc06fbfc,
+    0x0b0210fa, 0xfc0ded01, 0x03fff513, 0xf9040bfb, 0xf715ff19, 0x0af604ed, 0x0e1bfc03, 0x02dffe03,
+    0xfe0502f6, 0x09061007, 0x18eee7fd, 0x08eedbe5, 0xea0104f6, 0xf2ecf2da, 0x17ff011f, 0xd2d6f304,
+    0x193e0be9, 0xf702ff16, 0x03f3e6e6, 0x020c271b, 0x111803fd, 0xf8e8fb0c, 0x0ef9ed02, 0x0613203a,
+    0xf2fee0de, 0x141f09f8, 0x05f2040a, 0x05fbec01, 0xfc140700, 0xfb03fb06, 0xfafe0303, 0x020a110c,
+    0x0207fffd, 0x170a0506, 0x03050600, 0xede90210, 0x040bfeff, 0x1f0b0401, 0xfdfaf0f6, 0xf4020af9,
+    0x0b211ff4, 0xf5ee07f9, 0xecdfe7f5, 0x17021d35, 0xf3f9f40a, 0x1a1ec8f4, 0x0b1c0d04, 0xde050901,
+    0xf5fc0df7, 0x120b1708, 0xfcdf0405, 0x0af3eb04, 0x18080e0c, 0xf4fff1e7, 0x0303fcf4, 0xf1f51109,
+    0xf50101fc, 0x0409fd00, 0x0002f4fc, 0xfc0400fd, 0xf4f9faf8, 0xf3fd26f9, 0xf1f9e8f7, 0x1614f6f8,
+    0xf4fefdd9, 0x1609f0f1, 0x25e3ed0c, 0xf6f71409, 0xf0fe0e1b, 0xe512361c, 0x05100300, 0x302301fd,
+    0x0007d409, 0xef0503f6, 0xe30a0b33, 0x10ee0b0d, 0x1533ebf3, 0x090ddb23, 0xe0f008fb, 0xd6120d0e,
+    0x00fd0a08, 0x09eee308, 0x0200fb21, 0x08090af9, 0x1d310aec, 0xfcf3f5fe, 0x030dff04, 0xf406fe00,
+    0x0302f7f1, 0x030b0602, 0xf7fcff08, 0x05fafef4, 0x0a110d0a, 0xfbf6f906, 0x0305f7f2, 0x0313150e,
+    0xf0f5f9fa, 0x1010fbff, 0xf5030010, 0xfe04eff9, 0x0106080d, 0xfc00fb00, 0x040302fc, 0x000600ff,
+    0x05fb0104, 0xfff6fc00, 0x0c060006, 0xfa0702f5, 0x02fa02fb, 0x07f80306, 0x24f413fb, 0xfa0509f9,
+    0x19f40703, 0x040611ec, 0xfe060507, 0xf8e619fc, 0x010eff0c, 0x1102f605, 0x060ff1ec, 0xeefc050b,
+    0xf3f7ff05, 0xff150c0a, 0xf206f702, 0x120df2ff, 0xfa050114, 0xfb05f405, 0x04081508, 0xf4070906,
+    0x06060007, 0xff0fff01, 0x05fdfa02, 0x03f901f5, 0x0a00fb06, 0xfeed13f4, 0x040402fd, 0xf8ff0709,
+    0xecfcf0f8, 0x050dfdeb, 0xf7fbf904, 0xf7e9f1fc, 0x05040809, 0x0101f9ff, 0x0907e600, 0xfcfe0805,
+    0xedff0305, 0x02060702, 0x02f8fdfc, 0x0402ee05, 0x00fbfc04, 0xee0afef6, 0xfb0900fe, 0x03f70202,
+    0xfdfaf404, 0x0300fefb, 0xf9fe00f9, 0x07fefcf4, 0x04fa0703, 0x02edf8fc, 0x030a0efa, 0xfff8f901,
+    0xfceeeaff, 0x01ecfd09, 0xec03fb07, 0x1719e6e2, 0xf9fcfcec, 0xdfe6f505, 0xfde92c26, 0x0005faf5,
+    0x2c14dcef, 0x00f903f4, 0xe1050e02, 0x03081700, 0x0afafb00, 0x0bebf01a, 0xfd090613, 0x0a1601f7,
+    0x091ffaea, 0xfafb0c05, 0xfbf50f0b, 0x0f020e0d, 0x0b0000fd, 0x050febfd, 0x04060008, 0xee0708fe,
+    0x03040e06, 0x010bfbcd, 0xfcfb0303, 0xfbf9fd01, 0xfc0e0208, 0x040303fc, 0x00f6fd0c, 0x0803ff0c,
+    0xf41bff04, 0x07f9fbf6, 0xfd001207, 0xf803f80f, 0x080d0df1, 0x00fa01fe, 0x09f5fa08, 0x03f90a01,
+    0xff0404f8, 0xfe03fffe, 0x02fc02fc, 0xfb0600fe, 0x02ff01fa, 0x03fcfa06, 0x0301fa04, 0xf309fd08,
+    0x00fcfd01, 0xfa060601, 0xfd02f7fe, 0x0b01fd15, 0xf102f415, 0xfc0c0013, 0xf71402f7, 0x0119eb0a,
+    0x0102fdfb, 0xde18fd10, 0x08ef0109, 0xfefe0700, 0xfef8e310, 0x120609f6, 0xef060bf5, 0x09fe03f5,
+    0x0ef40500, 0xfffe0cfa, 0x02020df6, 0x1fe808f3, 0x0df2f802, 0x03f8f804, 0xf20f1be9, 0xef0609f8,
+    0x0e020100, 0xfefff40e, 0x0605ee00, 0xec0604d7, 0x07fb1510, 0xfd17ff0f, 0x1219e105, 0xfe1205f7,
+    0xf101fc0f, 0x03f8030e, 0x00fe0111, 0xf800fd05, 0xff0b08fd, 0x080500fd, 0xfe06f0fd, 0xf802ff09,
+    0xf6ff0aff, 0xffff0301, 0x0dfef903, 0x0000f601, 0xfe01fcfa, 0xf80509fc, 0xfbf204f7, 0x08040103,
+    0x07f9f803, 0x0500f8f5, 0xf905fefe, 0xf1f701f6, 0xfb0502fa, 0x0aeffc04, 0x04fdf705, 0xf00b0815,
+    0xe80ffeeb, 0x141b06fb, 0xffe3ebff, 0x00020113, 0xe8e92c1b, 0x0418f6de, 0x2d0cfb09, 0xffe1fded,
+    0xfa010e05, 0xf9fa1302, 0x10f6fe08, 0x01fffc01, 0x0f03fd05, 0xfb010210, 0x0704fdf6, 0xf80afefc,
+    0xfb060701, 0xf60206fb, 0x050204fe, 0xfb02f80c, 0xfd01040b, 0x1203120f, 0x12e7e80b, 0x0a1307fd,
+    0xe2f21806, 0x05f30cfc, 0x0b0dff07, 0xff18f2e9, 0xf507ff00, 0x0fe5f60d, 0x0505fc1e, 0xe4fbf904,
+    0xfd2324ee, 0x020bf00e, 0x1afae3e9, 0xf8fc0310, 0xf0e70709, 0xfd030601, 0x020300f3, 0x0b0e05f7,
+    0xfff4f902, 0x0e05f4e6, 0xf1090615, 0xe7d2fefa, 0x03140e0d, 0x0705f60c, 0x05f604ee, 0x06fb01fd,
+    0x05f20612, 0xfffd0af2, 0x0c10fcff, 0x0bf008f9, 0x01fa05f4, 0x0efc15fd, 0xfcfc0ff1, 0x03f9fff7,
+    0x08f50303, 0xf8fa02fc, 0x04030bf8, 0x05f60af8, 0x14f204f6, 0xff01fc09, 0x0401fdff, 0x050605fd,
+    0xfcf6f9fb, 0xf9fbfafe, 0xf9fa0d08, 0xf4f9f7ff, 0xf01704fc, 0xf816f715, 0xfb11070a, 0x05f4f9fa,
+    0xf8030bf9, 0xfbff0603, 0x08f907f7, 0xfb0eec03, 0x09fb02fa, 0xe2070105, 0xfcfdfe0b, 0xf319fb01,
+    0x0a04f303, 0xe218f701, 0x12f8f314, 0xf8041be8, 0xfa05d32a, 0x24d238e2, 0xdb26fc05, 0x46dc0af1,
+    0x000520c4, 0x10e4ee12, 0x0fd53ce7, 0x0af50301, 0x17f81af5, 0x0201feee, 0x19fc14ea, 0xf309f701,
+    0xf70202ff, 0x060ff011, 0xef01fdfc, 0xf41cf015, 0xfb081212, 0xf030daf4, 0x0b07fe19, 0xe3fd020b,
+    0x100df82d, 0x0307fcfb, 0x0201fc07, 0xeafe18ff, 0x150f08f9, 0x14f004d4, 0x09f6f5fc, 0x0bc82108,
+    0xf70103e0, 0x240203fc, 0xf9e70dde, 0xff0308fd, 0x0efc07f8, 0x0205f0f8, 0xf5f7fd00, 0xf5050a0b,
+    0xfa0405ff, 0x0f0311f9, 0xef070bfc, 0x07ed010b, 0x0efa1502, 0x0509f606, 0x12fcf302, 0xf60706fc,
+    0xf00e0006, 0xfafb11f6, 0xfff804fb, 0x0ff3f607, 0x08fbef08, 0xfd00f5fd, 0xef080bfa, 0xf5fb12fc,
+    0x0401fe00, 0x0900f404, 0x06fef601, 0xf3fefd03, 0xf6050905, 0xf5fe0203, 0x0a0ff204, 0xfb05f106,
+    0xf304f7f8, 0xf005090a, 0x16f7f3f0, 0xf91918ff, 0xe9e3150b, 0xfe0611fa, 0x20031a2e, 0xfef7ebf5,
+    0x251ae503, 0xf30519ff, 0xe807f2f3, 0x0b0a1cf7, 0xf4ee0205, 0x06e8fd0f, 0x0c06f709, 0x0a0df5ff,
+    0xf302ece6, 0xfa040909, 0xe3fa0efe, 0x0908f1f6, 0x07fafa09, 0xf3e9f2f5, 0xfb0d160d, 0xf8fafaff,
+    0x120ae8f5, 0xfc020311, 0xe0f4e6f0, 0xe911f1fd, 0xf5fde6ff, 0x17f70fea, 0x2d0329ee, 0x41e9ed00,
+    0xfbdb0b15, 0xf2250606, 0xed0efde1, 0xe620f8e6, 0x0b3df2da, 0x21fbf602, 0x2fdc40f5, 0x03f42b13,
+    0xea2ad822, 0x183af6b1, 0x1ff8f0f4, 0xc8161003, 0x01dbf5fe, 0x180ce118, 0x10fc23f6, 0x0fe5eb08,
+    0xe52b0811, 0x1cfff82f, 0xf03004e4, 0x00040504, 0x03021415, 0x01060c0a, 0x00fbff0f, 0xfe09fc0f,
+    0x030302fb, 0xfbf90706, 0x12f507f0, 0xf40af90a, 0x0b050a0e, 0x01fc030a, 0x0e1007f7, 0xfcf60500,
+    0x0a06f602, 0xfdf7050a, 0x0dfaf303, 0x0bfc0206, 0xf1050603, 0xfaf60413, 0x0c0a0003, 0xfffb0401,
+    0xf6010cf8, 0xfe080b10, 0x00ff04fc, 0xfd080602, 0x04001004, 0x09020d09, 0xfafaf714, 0xf205f718,
+    0x07000b01, 0xfb010504, 0x1501fdf6, 0xf305faf5, 0x01020509, 0xf1fdfd05, 0x0a0811fb, 0xfffdfb01,
+    0x0903faff, 0x00f8f606, 0x0600fcfa, 0x08f6fd0c, 0xf9060001, 0x04fd0206, 0x0e04ff06, 0x05faf9fe,
+    0xf9fb06fa, 0xfd0a0704, 0x05040002, 0xf70203fa, 0xf9fefeff, 0x07faffff, 0x00f7f408, 0xe501f51a,
+    0x07fc0405, 0x000308f7, 0x0c03f4f9, 0xfd0010e6, 0x00fafe06, 0xf1ff0100, 0x05030cfd, 0x0a02ff01,
+    0x02fa01fd, 0x03fe0102, 0x010600ef, 0x02f5ff01, 0x01fffe02, 0xf800fb03, 0x0bff0108, 0x03f9f7f8,
+    0xfcf7ffff, 0xfb0808f7, 0x02fdfa01, 0xf9fd01f7, 0xf3fc01fe, 0xf6fcfb02, 0x05f601f6, 0xe9fbe509,
+    0x0a0c0103, 0x060104e7, 0xfb02f0fc, 0xf40014ef, 0x03f6ee00, 0xf701faff, 0xfcf702fb, 0x0c06ff06,
+    0xf8fc01fb, 0x030304f7, 0xfd01fefa, 0xfdfa04fb, 0xff090002, 0xf304f8fe, 0x0400fd07, 0xf8faf9fe,
+    0xfaee0401, 0xfdf808f1, 0xfcfcf9fd, 0x00f801fb, 0xf7fdfbfe, 0xe90ffe08, 0x020005fa, 0xf9fdf502,
+    0x090b03ff, 0x03fb01e8, 0xea00f2fb, 0xf40008f3, 0x08fdeb00, 0x0302fa0a, 0xf7fb01fa, 0x0efe0707,
+    0x00ffff01, 0x04050bee, 0xfb030500, 0xf6060bff, 0xfc030001, 0xec03f5fe, 0xff04fb07, 0xf1fcff0a,
+    0xfe000400, 0x00040701, 0x01fcfafc, 0x07fdfe00, 0xfd02fe03, 0xf207000b, 0x02020cfe, 0xfe0302ff,
+    0x00ff07fe, 0x05f903f3, 0xed0100fd, 0xeefc03f1, 0x07fef4ff, 0x00faf50a, 0xf3ffff04, 0x0d010008,
+    0x02ff0002, 0x05050bf4, 0x04ff0b06, 0xfe070b07, 0xf90404fe, 0xf203f807, 0x0a07f705, 0xfcfbf809,
+    0xfe05fb03, 0x020b03fe, 0x08fefa06, 0x08ff0102, 0xfe040309, 0xf702fa11, 0x00030907, 0xfd0205f7,
+    0xfef80702, 0x00fb0101, 0xfa01fffe, 0xf5fc05fe, 0x05faf80a, 0xf5f6f805, 0xfbf8f6fc, 0x10060307,
+    0x00fe0004, 0x070806ff, 0x0af30bfc, 0xfe0006ff, 0x00f900fc, 0xf801ff11, 0xfd02f003, 0x08fafbfd,
+    0x0e02f905, 0x020d01fb, 0x11010109, 0xfa0300ff, 0x0007010b, 0xf7f6ff0b, 0x03fd0802, 0xf203f4f6,
+    0xfef30cfb, 0x02fb0108, 0xffff0108, 0xebfcfbfe, 0x08f9f700, 0xf1fcfb05, 0xfdf3f5f6, 0x0d0004ff,
+    0xfb04feff, 0x040302fe, 0x05e70af5, 0xf8f60400, 0x08f2fdf8, 0xf503070d, 0xf7fef1fe, 0x10fa0ff6,
+    0x1002f307, 0x0102fefa, 0x09010205, 0x0604f302, 0xff07f1e5, 0x07f2f804, 0xfff70803, 0x18e3ecf7,
+    0x01faff09, 0x0308faff, 0xf8fdf9f5, 0xf8ffede8, 0x0912f0f8, 0xf3f706e7, 0x10fd14e5, 0xf1020dff,
+    0x05f9020b, 0x0e0ddbff, 0x1aebfe07, 0xf30dfd03, 0x02f80007, 0x12fee9f5, 0x050f0600, 0x06f804fc,
+    0x06030107, 0x09070312, 0xf20df901, 0x0202f4fc, 0xf4fdedd5, 0xffeff6ff, 0xfcf70105, 0x17e4e1e9,
+    0x00ef0402, 0x02faecf4, 0xf6feeaef, 0xfcffdcd1, 0x0410eaf1, 0xf0f3fbec, 0x07fd10db, 0xf0030901,
+    0xfffcf911, 0x030bd505, 0x10e80306, 0xf3070102, 0x03f0fa03, 0x0c00e6f3, 0xfe0901ff, 0x01fbfef1,
+    0x0307f905, 0x07fdff0a, 0xf706f2fe, 0x02fffdfc, 0xf5faecdb, 0xfaf7f501, 0xfdf10006, 0x0deaeeec,
+    0x02f20900, 0x01f9e200, 0xfafff0f5, 0xfffbdbd5, 0x0007edf4, 0xedfbf1f3, 0x020409df, 0xf7000605,
+    0xff01fe0c, 0xff08d4fd, 0x0de60706, 0xfa0304ff, 0xfcf6f9fe, 0x0500e4ff, 0xf608fafb, 0x06fdfff3,
+    0x02faf504, 0x05fe00ff, 0xf3fef4fa, 0x02fe0105, 0xf5faf3e3, 0xfdfef704, 0x02f60801, 0x13edf2f0,
+    0x06f803fa, 0x00fef1fe, 0x0200f9f8, 0xfcfae5dd, 0x020bf4f0, 0xf2f8f1f5, 0x050a09e3, 0xf7020907,
+    0x0006fc0f, 0xfd07dbfe, 0x08e9fc00, 0xf4030501, 0xfbf7fffd, 0x0600e102, 0xf609ff01, 0x09ff01f8,
+    0x02f8f706, 0x07070109, 0x0003fa01, 0xfb020304, 0x02f8f1e8, 0xfffafa04, 0x03f906f6, 0x17f0f6f3,
+    0xff0005f8, 0xff02f5fd, 0xfdfefe04, 0xf7fdf3de, 0x030ef4fa, 0xfdf6f5fe, 0x04070ae6, 0xfc070f03,
+    0xfe07040b, 0xfd06d8fb, 0x0eedfcfd, 0xf0fd05ff, 0xfdfffbfe, 0x0a01e806, 0xfa0b0000, 0x090200fd,
+    0x02fef709, 0x0301fe0b, 0xf8ff0501, 0x01000004, 0xf9faf7e7, 0x0604fdfa, 0x02fa09f0, 0x11f6fafb,
+    0x06fd0602, 0xfdfffcf4, 0x0502fe07, 0xfbfdfbe7, 0x0811fef9, 0x02f3f7f9, 0x060c0ef7, 0xff001404,
+    0xfe0aff09, 0x0404e2f3, 0x09f8fb02, 0xf30004f8, 0xfefffa01, 0x0e03f0fc, 0xfe0afe01, 0x0502ffff,
+    0x0000010b, 0x0800fd0d, 0xfc050b03, 0xfb03ff00, 0xf2f7f6f0, 0x0004fef3, 0x03f908f4, 0x0df4fcf9,
+    0x09fd0704, 0xfefbfaf9, 0xff040507, 0x02fff7f4, 0x041000f1, 0x08f6fcfb, 0x000412f8, 0xf4040906,
+    0x020a0107, 0x0803e8f4, 0x0dfbfb06, 0xfc0303fc, 0x00fd0207, 0x0d07f5fa, 0x070300fe, 0x05010101,
+    0xfffa0008, 0x0b01fc09, 0xf6050e03, 0xf60906fc, 0xf4f6f5f7, 0x0208fffa, 0x06fd0df2, 0x17f6fcfb,
+    0x0efb0a02, 0x04fbfe01, 0x06040805, 0xff01f9f9, 0x021bfdf8, 0x0cf5f9fd, 0x040212fe, 0xf6080804,
+    0x020d1209, 0x180be206, 0x13fb0002, 0xfc03050a, 0x09fe0900, 0x01faf1f4, 0x09070afd, 0x070003f8,
+    0xf5f8020b, 0x0303fa07, 0xf7050003, 0x0df70105, 0x030307fc, 0x090ef800, 0x0bff03eb, 0x060602ff,
+    0x0a16f10b, 0x0cff0405, 0xe905f701, 0xfafdfafe, 0x00fff102, 0x0601fb00, 0x00fdfe07, 0xfb0801fa,
+    0xf9010605, 0x0b0702fb, 0x0ef9fa08, 0x0607fdf0, 0xf311f5f2, 0x000501f6, 0x00f900fd, 0x01fb0307,
+    0xe90107fe, 0x00030501, 0x020ff1f0, 0x0af70100, 0xfa0505fe, 0x030afffe, 0x05fcfee7, 0x0902fefd,
+    0x0e0dfaff, 0x08010406, 0xeb04e906, 0xfafef103, 0xff02e006, 0x0405fefa, 0x0409fefd, 0x0506fffc,
+    0xfd040604, 0x070908fd, 0x0bf7f304, 0xfb05f6f0, 0xf70bfbfb, 0xfb03fbf9, 0x01fef8f9, 0xff02fe03,
+    0xf3000301, 0x00ffff05, 0x010fe7f9, 0xf7f500fa, 0x01030206, 0xfe0d00f9, 0x00fa02e9, 0x060201f9,
+    0x0806f9fc, 0x03050604, 0xe204e70d, 0xfafef5ff, 0xfb04e404, 0x02050304, 0xff0ffdf0, 0x12fbfc01,
+    0xfe000303, 0xfe0706f6, 0x00f8f407, 0xf502f9fb, 0xfd08fbfd, 0xff07f3f9, 0x0100fcf9, 0xff0701f7,
+    0x01fe08ff, 0x060101fe, 0x0609e2f8, 0xecf3fb02, 0xfe020702, 0x01120302, 0x00fe03fb, 0x020103fd,
+    0x0209fbfc, 0xff030608, 0xdb04e411, 0xfcfdff0b, 0xff07edfc, 0x0009fe00, 0xfd0dfee2, 0x0bfbfd01,
+    0x00050604, 0x010502f5, 0xfbf4f709, 0x00fefd00, 0xfd09fefa, 0x0404e5fd, 0x09f107ff, 0x0006ff02,
+    0xf9fc0efd, 0x06fefe04, 0x0701e6f8, 0xf9f3000a, 0x02010c03, 0xfe070408, 0xfd02080a, 0x04fd01fd,
+    0xff09fffd, 0xfa010705, 0xe106e110, 0xfffefe0c, 0xfd09f8f7, 0x02050400, 0x010800ed, 0x01f9fa00,
+    0x01050403, 0x020003fb, 0xf6f0f907, 0x02fdfdf8, 0xf91103f6, 0x0a05df08, 0x0cf60808, 0x0002fdfe,
+    0xf5010dfb, 0x07fbf805, 0x030ae2f9, 0x06f2ff04, 0x03ff00fb, 0x02060107, 0xf9030109, 0x01f800fc,
+    0xfa0608ff, 0xfa00030a, 0xeb09e80a, 0xf504fd08, 0xfd0af5f7, 0x02fe06fe, 0x060bfdfa, 0x00fe02ff,
+    0x04040903, 0x01f904fe, 0xfdfcfd02, 0x08f8fbff, 0xfa0f05fa, 0x0203e708, 0x09f90803, 0x01ff01fe,
+    0xf2ff0d00, 0xfff3fe04, 0xfb0cdffb, 0x10ed0306, 0x04fff402, 0x03050600, 0xfa060002, 0xfa01fdf9,
+    0x010904fd, 0x00000502, 0xf807f60f, 0xfa05f909, 0x0201f9f8, 0x020306fd, 0x0805f901, 0xfafbfffb,
+    0x03ff0bfd, 0xfcf30bfe, 0x0007fffc, 0x01f800fc, 0xf9110202, 0xfc06f304, 0x02f8030e, 0xf9fc00fb,
+    0xfdf70b03, 0xfaf40102, 0xfa0ae7fa, 0x17e50301, 0x05fefd06, 0x020908fb, 0xef03fff9, 0xf903fafa,
+    0x040d05fe, 0x00f904fd, 0xff01f90e, 0xfc07fc0a, 0xfd0401f1, 0x07ff0601, 0x0202fd02, 0xf5f4fbff,
+    0x01fdf8fc, 0xfdf00805, 0xf610fdf8, 0xffff05f5, 0xfc12fd05, 0x05090205, 0xfdfcfe0a, 0xf3f700f8,
+    0xf1f20b04, 0x03fe03ff, 0xfb08ecfa, 0xfefc0bfb, 0x0b01fefc, 0x01070000, 0xfefcfc07, 0xf906feed,
+    0xfd0efef7, 0x00f4fbfd, 0xfef20207, 0x0bfffaf9, 0xfff7fef7, 0xf9010001, 0xfbfdfa06, 0x0501ff0f,
+    0x09faf4f5, 0xfff8040b, 0x0302fefa, 0x0cfef7ff, 0x0503fff7, 0x00fa01ff, 0xf602fb04, 0xf6fafe01,
+    0xfb0500fd, 0xfbfff8fe, 0x05fbf0f6, 0x040704ff, 0x09020202, 0x040cfb04, 0x00fbfafc, 0xfa05fef5,
+    0xfc20f4fa, 0x00f7fcf9, 0x05f3060c, 0x0afdfe02, 0x01f505ff, 0xf701f902, 0xfbfff701, 0x0d05ff13,
+    0x00f600f4, 0x07f8000a, 0x04fafc03, 0x0701f004, 0x02f7f8f8, 0x00000203, 0xf5fbfd04, 0xfcfefd03,
+    0x0406ff01, 0xfd09f501, 0x0500f8fa, 0x0813f700, 0x05ff0501, 0xff13f502, 0x0304fdfb, 0xfdfd02fe,
+    0x0324fefa, 0x08f501fc, 0x03f5ff0c, 0x07050109, 0x03f40606, 0xfa01f7fe, 0xf704f6fc, 0x0a08000f,
+    0xfbf20ff1, 0x04fa0a0a, 0x05feff0b, 0x0204f402, 0x06faf400, 0xf70104fd, 0xfc0003fe, 0xfd0a0504,
+    0x0607f705, 0x0107fa02, 0x01000201, 0x0b16f903, 0x0800040a, 0xfe0bf4fe, 0xfcfefc09, 0xf9f902fc,
+    0x0d1a07f8, 0x0ff700f7, 0x00f60109, 0x00fcff11, 0x05f40805, 0x010d0200, 0xf805f9fe, 0x04040107,
+    0x00f611f1, 0x00f90b16, 0x0801090c, 0x08090106, 0x0701030c, 0xf9040201, 0xfa00f800, 0x08190a03,
+    0x0802fb09, 0x060a02f8, 0x01ff070c, 0x0d0efc04, 0x1008fd12, 0xfb0204f4, 0xf3fcf716, 0xf50002fd,
+    0x0b0f08f9, 0x0ff4fdfd, 0xf6fe0509, 0x07fbff13, 0x09f60806, 0xf90f0efd, 0xfa04fb02, 0xfbff0000,
+    0x02f904f2, 0x04f61318, 0xfd030704, 0x0e040a06, 0x03040c13, 0x060207fb, 0xf7fbf407, 0x0f1d0903,
+    0x05090105, 0x000409f3, 0xfdff0608, 0x10fdfc03, 0x0a0d0712, 0xfa020cfa, 0xf9fdf70f, 0xe9fb0301,
+    0x060906f5, 0x0afef9fc, 0xfd00000c, 0x0af7fd05, 0x04f403fe, 0xfafd0afd, 0xfe02fb03, 0xf4fcfbff,
+    0x08fef9f7, 0x08f40f19, 0xfc040208, 0x10fe0404, 0xfd0b0b0c, 0x0d010afa, 0xf300f806, 0x0a150a04,
+    0x06040802, 0xfa020af4, 0x0cfdff03, 0x0ef5fb02, 0x040b0f0a, 0x010507fe, 0xf800f104, 0xdffc06f8,
+    0xff0e02f6, 0x03fbfa02, 0xfe00000a, 0x10f6ff03, 0x06ee03fb, 0xfefe0101, 0xfc05f704, 0xf701f605,
+    0x0bfdf7f9, 0x04fb0c1d, 0xf803fc06, 0x14f8fd07, 0xfe040206, 0x050303f9, 0xfd02fd06, 0x02040102,
+    0x09fd0900, 0xfafd08f8, 0x06f9fc02, 0x05fa03fd, 0x060506fd, 0x0309fefc, 0x0201ecff, 0xe3fe04f9,
+    0x020ffcfb, 0xfff9f3fe, 0xfd000007, 0x07fbfe07, 0x04e402fc, 0x02fbfff6, 0xfffaf403, 0x0700f807,
+    0x07fcfbf7, 0xfbf50a16, 0xf903fc06, 0x06f6fffe, 0x050b00fd, 0xf60206f8, 0xfcfbfb03, 0xfcfff8f7,
+    0x05f309ff, 0xf8fe06f8, 0xfcf8fa05, 0x0b050801, 0x03050303, 0xf50507ff, 0x05020802, 0x08fcfc02,
+    0xfe000502, 0xfbf6fa04, 0xf8fafefd, 0x0ff40e02, 0x060203fd, 0xf71500f7, 0x0bf50002, 0x0300f3fc,
+    0xfa09fb03, 0xfbfbff00, 0x0bffee07, 0xfd0200fa, 0xf4ff03f9, 0xff00faf5, 0x050c0800, 0x00fd0100,
+    0xfd08f20c, 0xfc040003, 0xf80e0c09, 0x06fdf900, 0x06fc0200, 0xff0203fe, 0x0808fa04, 0x08f7fe09,
+    0xf9010202, 0xfafef207, 0xf7fff9fa, 0x14f806fa, 0x040203ff, 0x031d00eb, 0x05fe0806, 0x01fff7fe,
+    0xf902ff05, 0xfdfe0502, 0xfa05f004, 0x0107fcff, 0xfcfd05fb, 0xfb02f5f9, 0x02fb0cff, 0xfcfefe05,
+    0x0006f404, 0xfcf80304, 0xfe060801, 0xfb00f6fa, 0x02f9fffc, 0x00fa03f4, 0x08fefcfb, 0x0701fc04,
+    0xf2010206, 0xfb06f307, 0x05ffeeee, 0x19f80cf3, 0x00fcf307, 0x0f1002ed, 0x0607060b, 0xfb00fffb,
+    0xf2040201, 0x04040107, 0xfb0e0002, 0x0300ff01, 0xfdf801fd, 0x0002f8f0, 0xfdeb0313, 0xf3000302,
+    0xfc02f502, 0xff0000fe, 0xfe01f8fe, 0xfe05fcff, 0xf9faf9ff, 0xfbf406f9, 0x06f900f3, 0x030df704,
+    0xf2040b03, 0x0104fdf5, 0x1302e2eb, 0x19f910e7, 0xfe00f502, 0x0ff803f6, 0xf6010916, 0xfb0513fc,
+    0xf60400fd, 0x0207fb08, 0x011603f6, 0x00fa00f8, 0xfafa0003, 0x07fefcf1, 0xfdeffa0d, 0xf8fe0505,
+    0xf7f7f6fe, 0x020801fd, 0xfbffeaf7, 0x01070402, 0xf7fdfbf7, 0x08fc020c, 0xfef3faec, 0xfd0cfefb,
+    0xf0040cff, 0xf703fefc, 0x1003e2f0, 0xfff91ae0, 0x0102f8fe, 0x01e8fdfc, 0xf1fc0e19, 0x050407fb,
+    0xeffdfff9, 0x080bf90c, 0xfe1307f0, 0xf6fe00fc, 0x0108fe03, 0x05fff6fc, 0xfcfef707, 0x04fb0909,
+    0xfcf106fe, 0x0b0e05f8, 0xfb00f1f6, 0x00000107, 0xfafcfcf8, 0x0c0a0211, 0xf8f6f8f2, 0xf90701f8,
+    0xf2030803, 0xf9fb0008, 0x1907f602, 0xe2fd0de7, 0x030201fa, 0xf9e9fafb, 0xee000807, 0x0e0102fd,
+    0xebff02f9, 0x0807f50c, 0xfe0c06f3, 0xf70004fe, 0x0502fa00, 0xfb03ee0a, 0xfb07f707, 0x02fef907,
+    0x03fa0bfe, 0x0d0d00e3, 0xfcf8f4f9, 0xf4fcfaff, 0xf8f60300, 0x0605040c, 0xe4f5fa05, 0x001103f0,
+    0x030d0403, 0x00ffff0a, 0x0c08f511, 0xf40201ed, 0x08f5fffc, 0xf9f0fe02, 0xf208f903, 0x0f061201,
+    0xf1fd07f5, 0x0b01f805, 0xfef90bf1, 0x04020b05, 0xfd00fd07, 0xf905f312, 0xf900f507, 0x0108fffd,
+    0x040109fe, 0x0b0af8f9, 0xfff9ff01, 0xeffff905, 0x00020809, 0xfa08090d, 0xebff0404, 0x040efdf7,
+    0x0a0508fd, 0x04050209, 0x0809ff0e, 0xfd0905fc, 0x06f4fdfe, 0xfdfa050b, 0xf305f809, 0x0e030a05,
+    0xe9fb0efd, 0x0bfafb0a, 0x00f80aef, 0x06fe0f01, 0x05000107, 0x0308fb09, 0xf9feff10, 0xfe0d09f8,
+    0x0602feff, 0x0606f904, 0xfc01fa03, 0xfbfbff02, 0x030903fb, 0x0a03ff03, 0x07ff0006, 0x08f8ff0d,
+    0xfefbfd07, 0xff0df2fb, 0x0809fff3, 0x070a02fd, 0xfb08f80a, 0x02ff00e6, 0x07ff1ef6, 0x0ef5f1fe,
+    0x08fa0308, 0x1003ffef, 0x030c02fa, 0xf3ecf513, 0x01f5fe01, 0x06040a04, 0x09000201, 0xf7fdfd01,
+    0xf701fb00, 0xf7f7fe01, 0x030af5ff, 0xfdf903fe, 0xfafefafd, 0x0104f9fc, 0x0c04fbfd, 0x09fc010e,
+    0x00fdfe13, 0x020afbfc, 0x080405f4, 0x0b0412ed, 0xfd07fc08, 0x04faffee, 0x09f82201, 0x0efdf100,
+    0xfcf30406, 0x04fef8f3, 0xfd0900f3, 0xf2f1f70d, 0xfbf6ff05, 0x06fc0dfc, 0x01f6fcff, 0xf5fef4fe,
+    0xf3fef4fc, 0xfdf9fd03, 0x1110fb03, 0xfffb08f9, 0xf0faf8fa, 0xf807faf6, 0x0e05fef8, 0x0302f8fe,
+    0x0403fc0d, 0x010a03f1, 0xf4fd00f9, 0x0a020eec, 0x0506fefc, 0x0003fc00, 0x0af21d03, 0x0501fe00,
+    0xeff204fe, 0x00fffefa, 0xfe03fdf7, 0xe6f5fd01, 0xf1fe0503, 0x04fb09ff, 0xf6fefef9, 0xfcfd01f8,
+    0xf5faf6fd, 0xfefffd00, 0x0e05fefe, 0x080403e5, 0xee02f3f7, 0xeffaf6f7, 0x0500faf4, 0x02f2eff8,
+    0x0407fa02, 0x040609e9, 0xdefcf1fe, 0xf5fd0cf2, 0x0403f5f7, 0x0913f705, 0x00f10ef8, 0xfbfb0301,
+    0xf6f8fcff, 0xff0207f0, 0x0204feff, 0xebfd09fe, 0xf7000203, 0x00fc01f3, 0xfdff04fe, 0xfdff0afa,
+    0xf2f6f300, 0xfffc02fe, 0x0602fc04, 0x03fefaef, 0xf402eff6, 0xf6fff9fa, 0x07fdfbeb, 0xfdecf5fb,
+    0x020200fb, 0x030309ed, 0xf403f8fe, 0xf0fa07f5, 0x0001faef, 0x040ef905, 0xfdf704ec, 0xf5f90b01,
+    0x02fffdfa, 0xfffffcf5, 0x0afefa05, 0xfa040a03, 0xfe0305fe, 0xf8fffbf9, 0xff0508fb, 0x030306fb,
+    0x02fef801, 0x0100fffd, 0xfa00fd06, 0xf902f6f8, 0x0004f6f6, 0x04f90100, 0x0301fdf1, 0x01f8fd02,
+    0xfd0000fb, 0xfffe0cf3, 0x030801fa, 0xf5f6fcfd, 0xfffd04f8, 0x0501fe09, 0xfffb07eb, 0xfbfc0702,
+    0x0509fdf9, 0x0107fa03, 0x0c03fe0a, 0xf5060402, 0x03010801, 0xfe00fffa, 0xff040501, 0x0602fd04,
+    0x08050002, 0x0505fefc, 0xf501fb05, 0xff02ff02, 0x04fe06fd, 0x08f8fffb, 0x070201f6, 0x09f90200,
+    0xf8fa0300, 0x02f70ff0, 0x000201fd, 0xfdf4fbf6, 0x02f804f9, 0xfffb050d, 0x02f904f7, 0xfefbfe05,
+    0xfe08f9f5, 0xfd05fbfc, 0x0502fa03, 0xef0902fb, 0xfe090500, 0xff03fc0c, 0x03ff0c05, 0x0600ef08,
+    0x050b0803, 0x0908ff05, 0xf8040000, 0x0a010702, 0x01fa04ff, 0x06f3fdfa, 0x0a0506fe, 0x0701fe04,
+    0xf8fe0800, 0xfdf80def, 0x08fb050d, 0x03f7fef7, 0x0b0005fe, 0xfffd0311, 0x07fa0efc, 0xf801fe0a,
+    0x000dfbf7, 0xfd11f7f9, 0x0608fa03, 0xf50603ec, 0x0104fe04, 0xfe00f20e, 0x04fafb08, 0x07fff106,
+    0x09070c06, 0x0e080308, 0x020afefd, 0xfe02ff02, 0x060301f7, 0xf80103f9, 0x000406f4, 0x01f908f0,
+    0xf8fb0104, 0x08020205, 0xff000205, 0xfa09fb11, 0x07ff0400, 0xf3fb0813, 0x04fbf5f8, 0xff0108fe,
+    0x00120afb, 0x06f1f509, 0x02fffb02, 0x00fefb08, 0xfaf401ff, 0x03fefef1, 0xfc15feff, 0xfa0206fb,
+    0x03fc0200, 0xf2f70108, 0xeaf5f801, 0xfcfff703, 0x0500fafb, 0xfb0e0303, 0x000801fc, 0x090107f4,
+    0x030303f9, 0xfcfefb04, 0xfffbfa01, 0xfe09ff19, 0x05050802, 0xfa010519, 0x0900faf3, 0x10070400,
+    0xfe0b07ff, 0x05f1f50d, 0x10000803, 0xfefffb07, 0xfaf20803, 0x04fbfbee, 0x070f08f5, 0xfcff05f6,
+    0x0ffefe01, 0xfb01ffff, 0xfc01fd02, 0x0103effd, 0x0802fefe, 0xfd0cfe05, 0x05090302, 0x04fefc0d,
+    0x030101f8, 0xf6f90307, 0xfbfdfdea, 0xfbfd0103, 0x03030100, 0xfe02090a, 0x00ff04ee, 0x130206ff,
+    0xfd02fd05, 0xfd00f205, 0x08000308, 0xf8fcf806, 0xf8fb0504, 0x0bff02e9, 0x0cfe0df2, 0xfb0103f8,
+    0x06000002, 0xfaff05fe, 0x05fbf7f9, 0x0600faf7, 0xfa0209f6, 0xfefeff10, 0x0cf90302, 0x04f5f21a,
+    0xfdfaf9fc, 0xf8f80704, 0xf800f9dd, 0x03fcf4f2, 0x04fffbf7, 0xfcf00de9, 0xfc0e18f8, 0x15f9fe02,
+    0x00faff05, 0xfe0ff0f0, 0x0605f705, 0xf2f5f9fc, 0xf806f804, 0x030108e5, 0x02fc00f3, 0xfd000209,
+    0x02090400, 0xfcf5fff8, 0x0002f3f1, 0xfffc0702, 0xf5fc0fed, 0x0702f913, 0x08e904f8, 0x08f4fa12,
+    0xfdfbfb00, 0xfefd0502, 0xf605fbe2, 0x0603f4e7, 0xfe0cf8ef, 0xfef706ea, 0xfe091f08, 0x0ef9fb02,
+    0xfbfd0306, 0x0111f4dd, 0x040cfc03, 0xeaf800f9, 0xfb06f308, 0xfb03faec, 0xfc02f8fc, 0xf6ff011a,
+    0x040908fe, 0xfefdfe03, 0x03fff8f0, 0xfaff0207, 0x01f503e5, 0x0b0ffb11, 0x06f6030d, 0x07fd0205,
+    0x02f50206, 0x0502fd0a, 0x0108fbf3, 0xf904f4f1, 0xfc0f04f4, 0x020301f9, 0xfc011608, 0x07f80004,
+    0xfbf80408, 0x010cf2e0, 0x020805ff, 0xf5fe07fe, 0x00f8f30b, 0x0106f714, 0xfdfcef08, 0xfd030010,
+    0x02fb02fd, 0x05fd0001, 0x0b0303f3, 0xf60a0108, 0x00f410e2, 0x0a0cf508, 0xfcf7fd08, 0xf40206f1,
+    0x03f60510, 0x0508fc02, 0x0405f5fc, 0xf002f6f1, 0xf204fafe, 0xfa04fdfd, 0xfff40206, 0x07f50105,
+    0xfff10005, 0x0201e9ec, 0xfe0405fa, 0x010201fc, 0xfff2fe0c, 0xfe03f923, 0x01fcf30d, 0x010a03fc,
+    0x06f2fbfc, 0x07fa05f9, 0x130205f6, 0xfd050204, 0x03f808e7, 0x0a00f8fb, 0xfefcf5fe, 0xf90504fa,
+    0x02f3040a, 0x060c03f8, 0x01fdfa01, 0xf2fdf8e9, 0xeef0f303, 0xf9030001, 0x0116fdfd, 0xf9f700f9,
+    0x03f7fff2, 0x07ffe8fc, 0xf90205f3, 0x0604fbf2, 0xfff70505, 0x08fdfb19, 0x00fefa0b, 0x0806faf8,
+    0x10f900fd, 0xfcf7faeb, 0x0cfb0301, 0x04f9fbf4, 0xec010600, 0x04080109, 0x060c0fff, 0xfd090ffb,
+    0x01fc0bfa, 0xf1f7fb05, 0x00f80004, 0x030c171f, 0xfb080aec, 0x05f2f61e, 0x0afef3fc, 0x07fc1b02,
+    0xed160404, 0x01f203f2, 0x071304f4, 0xfbf302f0, 0xf8f7fa08, 0x17ea04f8, 0x090406eb, 0x05fef1fa,
+    0x0a0af3fe, 0xf6f8f103, 0xfff803ed, 0x0503fbf6, 0xeb06fdfe, 0xfa010908, 0xfa1908eb, 0xfdfd01f3,
+    0x08f507ff, 0xfbf9f102, 0xf3f500fe, 0x050ef21a, 0xfa0a0df6, 0xfbe9f30f, 0xfaebf701, 0x10f81cfe,
+    0xf80cfbff, 0x01f10207, 0x0c1008f9, 0x0ffcf8fb, 0xf5f1ff0a, 0x07eb08ee, 0x07000af6, 0xfcfef4ea,
+    0x0800f805, 0xf4f2f5fe, 0xf5f300fb, 0x0407f8f8, 0xf00cfaff, 0xfe020701, 0xf31800ec, 0xf40204fa,
+    0x07feff03, 0x00f80202, 0xfafc03fb, 0xf603f4ff, 0xfc070902, 0xfef2f800, 0xf7f4fd00, 0x0ffd08fa,
+    0x07fffbfe, 0x07f7fd18, 0x0b000106, 0x04fcf201, 0x02f30404, 0x0ffafbed, 0xfaf60707, 0xf7fc05f4,
+    0xf8fffc06, 0xf9fb01f7, 0xf4f3f30e, 0x0f0bfdef, 0xf20605fa, 0x0902fe05, 0x031003fb, 0x0408f703,
+    0xfc0cf9fa, 0xfefa0f02, 0x06010001, 0xfefcf4f3, 0xff0008fa, 0x04fc08f0, 0xfa080401, 0x0c02f0ff,
+    0x0ceefe02, 0x02ffff0c, 0x12f6000d, 0xf0faf605, 0x00000002, 0x0202fafd, 0xf8fbee0a, 0xf8fb0300,
+    0xff010203, 0x000803f6, 0xf500f90b, 0x0400fbfb, 0xff020604, 0x0dfdfafe, 0x09070209, 0x1000f314,
+    0xf30cfcf4, 0xfe030801, 0x15fe0c02, 0x0ffafcec, 0xfeff04fa, 0x090813f1, 0xfc08fd06, 0x0afff1fe,
+    0x04f10004, 0x000610f3, 0x0704030d, 0xe3fefa00, 0xff0afe03, 0x010c09fb, 0xf90df901, 0xfcfc0106,
+    0xfe02fd00, 0x060a010b, 0xf802f9fb, 0x08f7ff01, 0x09fb0a0c, 0x02faf801, 0x09010213, 0x0cfdf913,
+    0xf609f9f3, 0xf6fa02fc, 0x19020afb, 0x0e05f9f5, 0xfcfe07fa, 0x050f06f5, 0xfdfdfa00, 0x01f6f302,
+    0xfef6fd06, 0xf60b0de5, 0x01020500, 0xeefbf8f7, 0xfe09f30b, 0xfb090600, 0xfa0705f3, 0xf9030000,
+    0xfc000400, 0x01fa000b, 0xfdfff6f9, 0xfbf90407, 0x02f50306, 0x05fdffff, 0x0400fe1d, 0x0801fd0a,
+    0xf904fdf9, 0xfb0afdf4, 0x150206f9, 0x0403f8fe, 0x020302f5, 0xff06fb00, 0x03f8f7fe, 0x00faf704,
+    0x0305f80a, 0x010d06ea, 0x04f408fd, 0x0503fefe, 0xfa05fc01, 0x0208020f, 0xfcf603ee, 0xff0309fa,
+    0xfa00f8fc, 0x00fb0204, 0x1001fdff, 0x09fc05ff, 0xfcfafe02, 0x0404f900, 0xfefef715, 0xfa050103,
+    0xf909fdf4, 0xfa0cfcf8, 0x080402fe, 0x0101fa04, 0xfe0503f8, 0xf905f801, 0xfdf8f604, 0xfefd0003,
+    0x0107fe0a, 0xfc0df9f1, 0xfdf5fc01, 0x0b03f703, 0xfa0405fc, 0x0609f91a, 0xfaf200f7, 0x01fcfafd,
+    0xfcfdfafc, 0x01f10006, 0x15060402, 0x00f8f901, 0xfff506f6, 0x07f81008, 0xfc05fa0d, 0x0006fe03,
+    0x00fb0502, 0x0511fd01, 0x0d0208f2, 0xff02f9f1, 0xf5fdf50c, 0x06f703fb, 0xfbfe0702, 0xfc010309,
+    0x04faf001, 0x01fd04ea, 0x0204fdfc, 0x00fffbf1, 0xf505f904, 0x050bff03, 0xf40c0501, 0xf9f70a05,
+    0xffeef512, 0xfd060d02, 0xfb0afff7, 0xfbf903ff, 0xfef708f9, 0x0cf70700, 0x03070601, 0xfa0600fd,
+    0xfe030404, 0x020fff00, 0x0c0300eb, 0xfefc01ec, 0x0104ff05, 0xfdf40201, 0xfd021403, 0xfaf7ff09,
+    0x07fcfc04, 0x05030af4, 0x000903f8, 0x0e05faff, 0xf7fbfafe, 0x03070509, 0xf107020a, 0xfef80706,
+    0xfbf2f010, 0x04090800, 0x0a15f5fb, 0x00010dfb, 0xf4fe0100, 0x0efefdff, 0x000a03ff, 0xf70501f4,
+    0xfc060608, 0x0010010c, 0x0d00fbfb, 0xff0309f8, 0x0603f903, 0xecf5fe05, 0x00f71304, 0xfdfff808,
+    0xf9f5fc04, 0x02000007, 0x050408f4, 0x0f03fbfb, 0xfaf6fcfd, 0x02fefd13, 0xfc02ff06, 0x01fdf707,
+    0xf7eafe09, 0x040c00ff, 0x0710fbfc, 0xf7fe01f5, 0xf0fafc03, 0xfefd00fc, 0xfe00fa02, 0xf40402fb,
+    0x06f90102, 0x03100a0d, 0x04fbfbfa, 0xfc0301f1, 0x00fdf105, 0xfcff0100, 0x03ec07ff, 0xf5020903,
+    0xf8fbfa01, 0xfffafff8, 0x09f604f8, 0x050400fd, 0xfefaff01, 0x03fe0112, 0xfe000100, 0x020300fe,
+    0x00f6ef02, 0xff00ff04, 0xf904fafd, 0xf500feed, 0x01fef509, 0xf9f70af5, 0xf1f7f8ff, 0xedf8fff7,
+    0x0dfb00fe, 0x0a0efa0e, 0xfafefbfb, 0xf106fef3, 0x01eff1fd, 0x060a0002, 0xfef7fd04, 0xfb0d1100,
+    0xfdfafef6, 0xfdf805fd, 0x0ff606fe, 0xfeff0204, 0x03fc0206, 0x09fbfc10, 0xfeff0400, 0x010005f4,
+    0x00f6f700, 0xfbf9fbfa, 0xf301fafe, 0xf7fff6fa, 0x0502ff05, 0xfbf806fa, 0xf7f8fff0, 0xf6f7fafe,
+    0x09f40400, 0x0a08fa07, 0xf3fff7fc, 0xf901fdfa, 0x02f9f6fa, 0x0204fbfb, 0x0200fc01, 0xff0502fe,
+    0x050201fa, 0xfff70aff, 0x07f00502, 0x01010006, 0x03fd0409, 0x0d03faff, 0x01f2fdf9, 0x060000f5,
+    0x0104fef9, 0xfffafc01, 0xf908fafb, 0xfa02fcf7, 0x0605f90d, 0x03fa0cfd, 0x06f50afe, 0x11fdf501,
+    0x05f607fe, 0x05110a01, 0xef0105ff, 0x020203ff, 0xfff1f6f4, 0x060c0d00, 0x02fefa05, 0xf70b02f2,
+    0xfe0503f5, 0xfef814fd, 0x07e7030c, 0xf0fcfffc, 0x04050508, 0x0202f30d, 0xfdf5f8fb, 0x0dfc01f9,
+    0x061608f7, 0xfd07f901, 0xe70cfc04, 0xfa0301fa, 0x0f04f514, 0x04f50ef4, 0x07f406f3, 0x23eef702,
+    0xfaf800f9, 0xfc0a0909, 0xe90707f0, 0x02fa0903, 0xfd07fff9, 0x060819f5, 0x08f6fc00, 0xf70b0ff7,
+    0x01070ef1, 0xfdf910fa, 0x01df0108, 0xe603fd05, 0x0c0d09fd, 0xf7fefd0d, 0x00faf9ff, 0x13f50106,
+    0xfb1913f0, 0x000afffd, 0xda11f607, 0xfb000801, 0xfa03ffe9, 0x0c0302f9, 0x09100217, 0x06f9fef4,
+    0x0ef50401, 0x050ffeea, 0xfff3fef6, 0x0705f8f8, 0x0806fdfa, 0x12fb01fd, 0x130507fb, 0xfe01f900,
+    0xf405f6ff, 0x0007e0ef, 0x01ff0102, 0xfcfe1601, 0xf7f0f70f, 0x17fb040e, 0xf200fcf6, 0x030509fa,
+    0x09020afe, 0x01f0fbf1, 0x06f416fb, 0xfc0502fd, 0xf306fee7, 0x13f7fef7, 0xff0cfa03, 0x00fb05f4,
+    0x10fcfcff, 0x0301fae2, 0xf5f2f6ec, 0xfc04f0e9, 0x060a01f8, 0x0e000003, 0x09f809f9, 0xfafdfefc,
+    0xfcf9fffa, 0xfafbdcfb, 0x01fffd00, 0x00fd1400, 0xf7f4fa0d, 0x0a000708, 0xf4fafbfc, 0xfb03fbf4,
+    0x01f906fe, 0x06f2faf2, 0x01f409ff, 0x090302fb, 0xfb09fff0, 0x11fef305, 0xff01f7fa, 0x0003fcfd,
+    0x070301fe, 0x04fef4e9, 0xe9f8f9f8, 0xff02fdea, 0x060aff02, 0xfff9ff05, 0x02f301fa, 0xfbfffbfc,
+    0x00f5fffc, 0xfdfee00a, 0x0204fffe, 0x05fe05f9, 0xfcf10208, 0x0a000d07, 0xfafefc01, 0xfc03edf6,
+    0x02f90900, 0x07fbf9f5, 0x02020906, 0x0e00fcfc, 0xf007fef8, 0x0707ef09, 0xf9f6f9f7, 0xff0dfb09,
+    0xfaf9ff01, 0xfe08ff03, 0xf801fb01, 0x0dfe07f3, 0x000901f9, 0xf6ea0508, 0xf9f8fafe, 0x0cff0301,
+    0x01fb01ff, 0x0103e202, 0x04090101, 0xfdfbfcf2, 0x03f70303, 0x05021206, 0x07020000, 0x0503ebfd,
+    0x01f90c01, 0x08f8fefc, 0x030a0604, 0x07fefbfc, 0x0001fffe, 0xf407ecff, 0xf9fd02f6, 0xf406fb08,
+    0xf601fa05, 0xf60c030a, 0x0c000206, 0x0c02fe00, 0x0006fef9, 0xfa050702, 0xfaf3f5fe, 0x0df60d04,
+    0xf4f80101, 0x0607eff3, 0x040b05f5, 0xf7fbf0f7, 0x01effc06, 0x0a021601, 0x06040afd, 0x0102fdfc,
+    0x03fa0804, 0x04f7fe02, 0x060a07fd, 0x03fcf4ff, 0x01fdfdf4, 0x0102f0f7, 0x010209f6, 0x03000105,
+    0xfdf8f801, 0xf707080a, 0x0e04000e, 0xfa03fa03, 0x0006fcfa, 0x040b08ff, 0xfaf7f6f1, 0x12fe0308,
+    0x00080304, 0x0408f1fc, 0x04ff00f6, 0xf5f6ecfb, 0x00f6f903, 0x02030c01, 0xf80008fa, 0x000004f8,
+    0x0604f905, 0xfd000408, 0x070702fe, 0xfc02effa, 0xfaf8f3f0, 0xfe00f7ff, 0x06ff04f6, 0x01fafe03,
+    0xfe00fbfd, 0xf906060a, 0x0a010f06, 0xf70604fe, 0x000702f8, 0x05050503, 0xf30202ef, 0x0df90902,
+    0x0405fe04, 0x0406f6f1, 0x02fffcfe, 0x03fcf403, 0x01fdf007, 0x080300fc, 0x00000805, 0xfbfe08f8,
+    0x06fefb05, 0xf9090505, 0x0801ff03, 0xfefff8f6, 0xf2f6f0ee, 0xfafbfbff, 0x05fe01f3, 0x03fb0004,
+    0xfd0005fb, 0xfdfe0f08, 0x00031405, 0xfb0f07f9, 0xfc0503fa, 0xfc080403, 0xf20a06f6, 0x03f40400,
+    0x0afffc05, 0x0403eff0, 0x030df600, 0x0bf8f900, 0xff07ef06, 0x0003f9f9, 0x09040a06, 0xfef90401,
+    0x03f90807, 0xf306050a, 0xfb08fcfd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x03070706, 0x0501f5fe, 0xfd040415, 0x01fdfe06, 0x04140305,
+    0x100f0905, 0xfc08fefa, 0xf6fefa07, 0x0a0a0a01, 0xfe05fc00, 0x0307f314, 0xf301f802, 0x01f9f800,
+    0x06fbfb00, 0x03f3f304, 0xf90b0501, 0x020bf7f7, 0xfa050cf7, 0xff00f704, 0x140903fb, 0x0405fe0a,
+    0x0609fbfc, 0xf9fe0203, 0xfb071404, 0xf3040108, 0x00fff601, 0x02020413, 0xf70007fd, 0x04010002,
+    0x050b02ff, 0x01fcf9fa, 0xfff90212, 0x0d0c0103, 0xff0305fa, 0xf707fa07, 0xfafd0104, 0xfdf90400,
+    0x05ff0303, 0x0cedf7fb, 0xf001fcfc, 0xfc07fdfd, 0xfa0308f7, 0xf9fffbf3, 0x07ff0af4, 0x05fdff0f,
+    0x0703fbfd, 0xfbfa08fb, 0xf3fc0bfa, 0xebfdf50c, 0xff01fdfd, 0x0bf603ff, 0xf0060cee, 0x02020002,
+    0xf807fbf7, 0xf9f2fd01, 0xfeff0e05, 0x0709f40c, 0x03000506, 0x01f800f4, 0xfd07f6ff, 0x07fd0702,
+    0x00030605, 0x10fcfaff, 0xfdf7f902, 0xf6fcffff, 0xf70008f9, 0x0001faee, 0xfef915f7, 0x00fafb0f,
+    0xfefe0bfe, 0xf9e20b02, 0x0103fb05, 0xf3fffc05, 0xf3fc04ff, 0x0cec00fb, 0xfef407f7, 0x04faf90f,
+    0x0001f8fc, 0xf4fdfaf4, 0x02050ef0, 0x0203e810, 0x0307060d, 0x01ed0be8, 0xff0fff02, 0x00fcfaff,
+    0x03fe070b, 0x0b06fa0c, 0x0200eafd, 0xfaf10402, 0xf8f60af9, 0x0602fcf3, 0xf6fe0afd, 0xfffcfd06,
+    0xeffe1502, 0xfdea0b06, 0x0707ef0a, 0xfa0001ff, 0xfafd0ef6, 0x0b0afffe, 0x06f40300, 0x07fdfa02,
+    0x08fb020c, 0x020704ee, 0xfb0905f2, 0xedfce801, 0x090b0307, 0xf8f301e1, 0x000006f8, 0xf7f6f600,
+    0x00fdff08, 0x0211f708, 0x01fff1fc, 0xfdf40308, 0xf8010ff7, 0x0a0a06fe, 0xee01f302, 0xfd01ff00,
+    0xeef31006, 0x00000506, 0x0305fb06, 0x03000bf4, 0xf90003f9, 0x0c16fe03, 0x07f2f612, 0x04fbf9f4,
+    0x0e060507, 0x100003f7, 0xf1080404, 0xeaf6f4fd, 0x040804f8, 0xf504fe03, 0x01db06eb, 0xf1f8fff5,
+    0xfff7fc01, 0xfb0dfc03, 0x0200fefb, 0xfc000808, 0x06020efd, 0x0108090a, 0xf905f307, 0xfa0500f0,
+    0xfff80107, 0x01fc08f9, 0xfe030e04, 0x090006f6, 0xff01fafe, 0xfc080004, 0xfcfef00b, 0xf7fdfbf5,
+    0x0b0b01fb, 0x0bf9fbf9, 0xf905fc16, 0xebf90200, 0xfd04fdf5, 0xf009f913, 0x00e901ed, 0xfdf705f7,
+    0x09fdfcff, 0xf901f30a, 0x06fe04fc, 0x14070907, 0x0af303ff, 0x0206030f, 0x0701ff00, 0x000600ef,
+    0x02fff906, 0x02f9fdf6, 0x02fb0ffb, 0x0703fdf9, 0x0405f300, 0x0003f505, 0xf404f200, 0xf10406f9,
+    0x000af7f4, 0xfff8fee7, 0x0001f614, 0xf1f308ff, 0xf9f9f1ff, 0xfb03fa15, 0xfef705f0, 0x09000702,
+    0x0608f9f5, 0xf6fdf10f, 0x070104f9, 0x0d0600fc, 0xfdf5f5f6, 0x0206f908, 0x08f505fd, 0xfc03fefa,
+    0x010dfa05, 0x03f3fd01, 0x0b000cfd, 0xf1fffd07, 0xfe000002, 0xfe0803f3, 0x06fd07f3, 0xfafe05fe,
+    0xfbedfbf6, 0x01f404f9, 0x02031002, 0xfa050421, 0xfafb12f6, 0x04080109, 0xf5f7f7f3, 0x08090c0d,
+    0x01090907, 0x130009f6, 0xf5eefb0a, 0xf8060af7, 0x0af8fd00, 0x080bfef6, 0xfff3fefb, 0x020107f6,
+    0xf5feff03, 0x09fafc03, 0xf7eb000e, 0x01fef509, 0xf9fefa02, 0xf90909fc, 0x04fc06f4, 0xfe0002f8,
+    0xfff3fff6, 0x01fb0b02, 0x030014fe, 0xf1040330, 0xfffc10f5, 0xfe010c0a, 0xf8fdf7e7, 0xfc001007,
+    0xfd070504, 0x0ffb02ef, 0xfcf00000, 0xf20006f9, 0x08e8fe01, 0x000afaf3, 0xffee03f6, 0xff0200f0,
+    0x00fffd05, 0x07feff10, 0xedecfb06, 0x0701fb03, 0xeffff600, 0xff010a0a, 0xf600fcf1, 0xf703fbf0,
+    0x04020af8, 0x02f707ff, 0x010603f3, 0xee040120, 0x02fe05fb, 0x02f00802, 0xff0003ed, 0xfcf60e03,
+    0xfc05fa00, 0x070204f6, 0x01fd0402, 0xf6fe04fb, 0x00edffff, 0xf20400fa, 0xf9fc05ef, 0x000002f5,
+    0xf7fffd09, 0x06010204, 0xeef1ff02, 0xfe0cfdf2, 0xea0401fe, 0x01f6050d, 0xf606fc05, 0xf000fafa,
+    0x090508ff, 0x06fb0400, 0x0506feea, 0xfbfffb04, 0x08ff0003, 0xfcf004fc, 0xfef90afb, 0x04f70d01,
+    0xf7fe03ff, 0xfef804f7, 0xfd070400, 0xeeff0004, 0xf8f7fdfe, 0xfd03fc03, 0xfa02ff03, 0xffff03f9,
+    0xfaf40208, 0x02fe0103, 0xedf902fe, 0xf908fff2, 0xf60210ff, 0x05fffc09, 0xf308fe0c, 0xf00001f8,
+    0x07020203, 0x0606fd00, 0x030100f8, 0x04f908f7, 0x0afc00ff, 0xfdf40002, 0xfd041005, 0x01ffff01,
+    0x00fb05ff, 0xfbf504f5, 0xf70b02fb, 0xf700fe04, 0xf4040100, 0xf704ff14, 0xfd020004, 0x00fcfa06,
+    0x00f20104, 0xff0203ff, 0xffff04fe, 0xfd0502f2, 0xfa011005, 0x0202fb01, 0xf70a0813, 0x04fd02fc,
+    0xfffffe03, 0x020bf804, 0x08fd0200, 0x00000dfa, 0x06fefafe, 0x01030bff, 0xfe050405, 0x00080303,
+    0x05f90204, 0xf3f403fb, 0x010402fe, 0x06fffb06, 0xf60afd03, 0x01ff0517, 0xfeffff05, 0x02faf807,
+    0xfcfffe01, 0xff070504, 0x070ffe01, 0xf4fd05f0, 0x00020f04, 0xf702fcf9, 0x00020212, 0x0cf9fffe,
+    0xfdfbfb07, 0xfd0dfb02, 0x06fdf6fe, 0x08010bf7, 0x00fcfb00, 0x050b0cfe, 0x03010404, 0x0009f801,
+    0x08fefcff, 0xfbf901fd, 0xff04fcfe, 0x03fc0504, 0xf7080100, 0x06fc030e, 0x0600f8fc, 0x05faf7fb,
+    0xf90601fb, 0xff060504, 0x03100702, 0x00fa08fd, 0xfc020404, 0xf90402f4, 0xfe00060d, 0x0af20401,
+    0x02fdfe02, 0x0107fafe, 0x0400f5fc, 0x07fc04fb, 0xfbf804f7, 0x0a110d00, 0x00fd01fe, 0xf600f701,
+    0x02fffff9, 0x03f007fa, 0xf8fffef9, 0x07030205, 0x000502fc, 0x05f50115, 0x0008fc03, 0x00fc01fa,
+    0xf10906f8, 0xfc0804fa, 0x030c0d03, 0x0404fdfb, 0xfc0af9ff, 0x010404f6, 0x0108f90f, 0x01020905,
+    0xfa070501, 0xfbfff602, 0xf4030cfc, 0x0107f205, 0x070212fc, 0x0d0108fd, 0x0c03fb0b, 0x01f9f909,
+    0x08010702, 0x0100f7fb, 0xf40bff0e, 0xfbfcfbfb, 0xfa090e06, 0x16fcf212, 0xf4010b04, 0x090df60b,
+    0x04f1fd07, 0x0e0c02ff, 0x03fffcfe, 0x0b0404f5, 0xff0904fa, 0xf5f704fa, 0x0407f511, 0xfe080300,
+    0xfa070403, 0x040bf004, 0xff0600ec, 0x0afaef07, 0x09040b03, 0x11f80501, 0x00faff0b, 0x05fefe06,
+    0x05f90302, 0x0806f0fd, 0xf910010c, 0x0cfbfbff, 0xf4060a07, 0x1cfef806, 0xf602fb02, 0xfd15f402,
+    0xfef30403, 0x0c0bfffc, 0x04fb04f9, 0x05040af3, 0xff0708f2, 0xf1fbfe04, 0x0003f40d, 0xff090902,
+    0xf8020401, 0x010ef301, 0x0602f8e7, 0x0cfef801, 0x0400fdfe, 0x04f50202, 0xf4f9010a, 0xfbff0600,
+    0xfdf3fdfa, 0x0200f001, 0xfd120cfd, 0x14f5f5fc, 0xfe070809, 0x12ff0104, 0xf807faf7, 0xfc16fc08,
+    0xf1f20303, 0x090900f9, 0xfff7fbf7, 0xff040efa, 0x0302f8ef, 0xfd05f907, 0xfe04f60f, 0xf80905fc,
+    0xf403fffe, 0xf807f0f9, 0x09fbfbf6, 0x090000ed, 0x05fa020c, 0xfcf10203, 0xeb010301, 0x000506f7,
+    0xfcf1f8f4, 0x00fcee02, 0x030d07f2, 0x17f7f9ff, 0x09050506, 0x0bfd090a, 0xfe0af8ff, 0x0611edfd,
+    0xf8010102, 0x0406faf2, 0xfcfffdf4, 0x03ff0b06, 0xfb01fcf3, 0x020ff904, 0xef02f60a, 0xef040afe,
+    0xf808fe04, 0xf300f6fb, 0x07fcff13, 0xf60607ec, 0x01f20b0d, 0xfefd040a, 0xf303fdf4, 0x0701fdf2,
+    0xfdf6f3ee, 0xfb00e806, 0x0107fdf0, 0x17f8f704, 0x0d07fcfd, 0x07f41311, 0x0807f901, 0x0a09f4f1,
+    0xff090200, 0xf802f3e3, 0xffff03f6, 0x05f60607, 0xfcf803e9, 0xfd14f8ff, 0x0205ff05, 0xf7000102,
+    0xfd0cfc03, 0xf500f9ff, 0x05fe0415, 0xf80506ee, 0xf9f90b0c, 0x08fd020a, 0xf9fffff1, 0x00fafbf6,
+    0xfef7f7ee, 0xf900eaff, 0xff0df1f7, 0x0f00fd02, 0x08f9f8f4, 0xfdf6090f, 0x0206fa04, 0x0002fef4,
+    0x070304fe, 0xf6fff2ec, 0x04fb08fe, 0x02f501fd, 0x06f701e7, 0xfa01f501, 0x0afe0a06, 0xfafbfbf8,
+    0x010d0306, 0xfd01fcfa, 0xfe01090b, 0xfb0800ef, 0xfced0b0b, 0x0201020b, 0xf7050608, 0x0001f5f7,
+    0x01f9fff3, 0xf703e906, 0xfe0df1f4, 0xfc060303, 0x000500f3, 0xfcf9050a, 0x0401ff08, 0xf7ff03f9,
+    0x0705feff, 0xef0001f5, 0x0201fe02, 0x05fcfdfc, 0x09fbfef4, 0xfefefa08, 0x0e000302, 0x0100fd05,
+    0x020d0501, 0xfe03fef2, 0xfe080bff, 0x020802f1, 0x00f30206, 0xff01020b, 0xfd010509, 0xf302fef9,
+    0x03fb03ff, 0xfc01e9ff, 0xfa06f0f8, 0xf4fd09f9, 0xfc090ff0, 0xfd0803fd, 0x070103fa, 0xf6fefbf9,
+    0x0109fefe, 0xf1010afc, 0x03fffbfb, 0xf5fe0406, 0x0f0106fe, 0x06fe020c, 0x02fc08f4, 0xfc0efc11,
+    0xf3f7f602, 0xeffc0503, 0xf906f50b, 0xfdfe0a0f, 0xff01fef9, 0x0102fb0f, 0xf3f6f907, 0x0501fd01,
+    0x01080208, 0xfffff7fe, 0xebf7fa00, 0xf900f902, 0xfa1203ea, 0xf40bfc0d, 0x02f502fd, 0x03f0f713,
+    0x01030cfc, 0xf9030804, 0x01020afa, 0xeeff0408, 0x02000304, 0x0500060c, 0xfcf808fc, 0xfc110520,
+    0xf5f7fcfa, 0xf1030006, 0x0106f70d, 0xef021f19, 0xf600fefa, 0x0efefe0c, 0xf3f9faff, 0x0a04f805,
+    0x0504fa05, 0xf8f9faf8, 0xf0fdfcfb, 0xfbfcf808, 0xf80c01f9, 0x0601fe04, 0x02fb05f6, 0xf7f8e815,
+    0x010406fa, 0xf90a02ff, 0xfdfc05f3, 0xf6fffa06, 0xe803f202, 0xfc020402, 0xfb0102f7, 0xf50b0b1d,
+    0xf4f90803, 0xfa080209, 0x03060406, 0x000b1e18, 0xf7fd0600, 0x19fe030b, 0xf8fb0508, 0x0304f404,
+    0x07faf801, 0xf9f5f6f8, 0xf41205fe, 0xfdf8fdfc, 0x03f7fc08, 0x10fb02f9, 0x01fd07f8, 0xf7ffe80c,
+    0x0400f4f9, 0xfc09fffa, 0x07f4fdef, 0xff05f803, 0xda05fa04, 0xf90102f3, 0x030901ed, 0xf3070b09,
+    0xfdea080d, 0xff07000a, 0xfa030402, 0x05041011, 0xf7000800, 0x23fafe00, 0xf8f80714, 0xf802f500,
+    0x02edf8ff, 0xfcf1f8f7, 0xfa0e0601, 0xfdf8fef9, 0xfd00fe09, 0x13f806ee, 0xfdfc0bff, 0xf504fa00,
+    0x09fbeffa, 0x0106fd00, 0x04f3fef4, 0x11030402, 0xe702fffc, 0xf7fe01fb, 0x060a06f2, 0xf8fe0305,
+    0x02f20307, 0x09030303, 0xf8fb06fb, 0x0306f806, 0xf90208ff, 0x0ef3fffe, 0xf8ff030f, 0xf2fefd00,
+    0x04f00403, 0x00f7fcfe, 0xfc0300fe, 0x0afd01fa, 0xf40bfe0a, 0x14fd09ea, 0xfc010dff, 0xfa020004,
+    0x06f6fcff, 0xfff8fcf9, 0x00f7feff, 0x15050efe, 0xf6fdfff9, 0x0802ff05, 0x04fe0b04, 0xfefbfa03,
+    0x03f9fc02, 0x07030efa, 0xf9f90bfa, 0x0303fe04, 0xf80207f6, 0x02f200fd, 0xf903fc0a, 0xf5fbfa00,
+    0x04f5fb04, 0x04fef9f7, 0xff00fdff, 0x0cf9fe08, 0xfc0e0203, 0x050006f2, 0xf7040607, 0xf807030a,
+    0x04f40203, 0x00f304f7, 0x0b000205, 0x05000803, 0xfbfff9f6, 0x020c0303, 0x02fe0607, 0xf1faff06,
+    0x02fff603, 0x05fd11fb, 0xf6f909ff, 0x0100fe06, 0xfffe0afd, 0xfff1fc02, 0x0afaf700, 0xfb02f702,
+    0x02fd0100, 0xfffff5f9, 0xfd01f8fd, 0x08fd0302, 0xfcfe0603, 0x03fc07f9, 0xf9010905, 0x030b0704,
+    0x08f20205, 0x02fafff3, 0x040008ff, 0x070407fe, 0xfffafcfc, 0xfe0b02ff, 0x04fd0a00, 0xf3030f09,
+    0x0306f60a, 0x03f30700, 0xfff703fc, 0x01020007, 0x03f80506, 0xfdf7fbff, 0x0ff8fb02, 0x0400fa04,
+    0xfe0003fe, 0xfc03f6fb, 0xfd03f8f9, 0x00030903, 0xf4ff0c07, 0x03fc08fa, 0x00010b02, 0x010e010a,
+    0x0ef7f705, 0x02f9fdf1, 0x02ff0a03, 0x08fa06f5, 0x0cf804f9, 0xf0eefef9, 0x05fd0ff9, 0x0203f3fe,
+    0xfe0af605, 0x12f803f9, 0x08f7fcff, 0xfc01080e, 0x030008f8, 0xfb0dfd03, 0x04fdfd01, 0xf80614fa,
+    0xfa09060a, 0xf902fe0b, 0x02f80805, 0x00fa05fa, 0xf90500ff, 0xf904fdfb, 0xfc030dff, 0x06fb080a,
+    0xfdff03fb, 0xfcfdf807, 0x01020304, 0x04fa00fa, 0x0b04ecf8, 0xf9ebffde, 0x0af802f5, 0x06f3fffd,
+    0xfe0af4f3, 0x05f1f8f6, 0xfe0100f1, 0xf200f509, 0x080b05f8, 0xf30702f4, 0x04f7f801, 0xf3180af9,
+    0xfd05020a, 0xf6f3fc08, 0x07ef0409, 0xeb03f607, 0xf70cfcfe, 0xf5fffbfd, 0xf90b03f7, 0x08fa0100,
+    0x03fa00fa, 0x0002fe0a, 0xf6fff0f7, 0xf201f201, 0x030befff, 0x0a0904f7, 0x0bfffbf8, 0x0df9fa0f,
+    0xf2e6f800, 0xfaf606f9, 0xf40c04fb, 0xe9f1ff0a, 0x090705fa, 0xeb04f8e3, 0x0403fffc, 0x0a09fb08,
+    0x07010102, 0xfd0af3e9, 0xf6f5f60a, 0xd701f506, 0x020500fd, 0x06fd00f2, 0xfbf304f8, 0x06fbfa02,
+    0x09f803ff, 0x03ec0303, 0xf20bf4fa, 0x0af8f4fe, 0xf707fcfe, 0x02110203, 0x0b0c03fe, 0x040f010b,
+    0x0a03fb03, 0x00000cfb, 0xfe0b0906, 0xfffd0207, 0xfe0c01f6, 0x1114fd03, 0x021300f8, 0xfbfbf509,
+    0x0002ff03, 0x0017f9e9, 0xf508f704, 0xff0502ea, 0x02f10807, 0x08fefce4, 0x0efcf7f4, 0x0900fc08,
+    0x01020704, 0x070d0000, 0x06051405, 0x01f9f302, 0x0000fefa, 0xfe07050f, 0x07fcf6fb, 0x100201ff,
+    0x160afd04, 0x0df707f7, 0xecff0100, 0x0702fa01, 0xf914f802, 0x231f070b, 0xfaff0e07, 0xe5fffc00,
+    0xf801fb0c, 0x020afaed, 0x070e03fc, 0x120011fd, 0xfe020c0a, 0x0c0100fd, 0x0807effd, 0x0504050d,
+    0xfc010306, 0x0803fc05, 0x08fb07fe, 0x0bfe07fe, 0xf7fcebff, 0x0def010f, 0xeaf4e0fc, 0xfaecf3fb,
+    0x06040702, 0x08f6eefd, 0xf6fdf9f8, 0x1001e2f0, 0xfe140901, 0x00ecf8fa, 0xf4f71308, 0xedfe06f8,
+    0x03f404fe, 0x04f6f200, 0x040402f8, 0x06fe0a06, 0x06fb0504, 0x0902f801, 0xf4fd0208, 0xf7fc03fc,
+    0xfd03fc0a, 0x000005f9, 0x03f5faf2, 0x0a0207f5, 0x1201fd02, 0x0e12fb0d, 0xdf0106f4, 0xcbfa03fc,
+    0xfd0201ff, 0xf9fefe03, 0x02f3f81b, 0x0200f9e7, 0x04f407fb, 0xecf6f7fb, 0xf402fefb, 0xf902f604,
+    0x09fc04f0, 0x05ee0201, 0xf702fef9, 0xfc010005, 0x01fcfd01, 0xfb05f2f9, 0xfded010a, 0xfcfd0314,
+    0xfaf70006, 0x00f410f2, 0xf8fcfa0d, 0x08030603, 0x0afdfeff, 0x01060008, 0xea0116fc, 0xfdfbffff,
+    0x050ff90a, 0x0405fefc, 0x01fe03ff, 0x0f0203fc, 0x04f0ff02, 0xf8f6f9f8, 0xf901f503, 0xf802ff0d,
+    0x0403fd02, 0x01f4010c, 0xfb050902, 0xf9ff040e, 0x00090208, 0xf90902f9, 0x00fb0afb, 0x01fcff05,
+    0x0503fd06, 0x03f01000, 0x06060410, 0xf80af705, 0x0b06080a, 0xfafc0312, 0xfbfb0709, 0x01fef502,
+    0xfa0b01f5, 0xfffb0007, 0x00faf3fc, 0x0209f702, 0x0006fb04, 0xfafcf6ff, 0x03fc0004, 0x06fb07fb,
+    0x04fcfa07, 0x010706fe, 0x10070a05, 0x01fcfcfe, 0xfc02fc07, 0x01050408, 0x0510fb05, 0xf4f60603,
+    0x0e080205, 0x01f80504, 0xfa030d06, 0xf307f708, 0x0b03000d, 0xfcf9050d, 0xf8fb0a0d, 0x05fdf101,
+    0xf80704f8, 0x00000113, 0x05fdfb02, 0xf908ef0a, 0xfd07020b, 0xebfc04f5, 0x07f8fb02, 0xfef809fe,
+    0x0300fe07, 0xff050700, 0x05090103, 0x02faf500, 0x01f9f908, 0x05050008, 0x040dfc08, 0xf6fbfe01,
+    0x0b07fb09, 0xfdec090a, 0xf20afffa, 0xf803f708, 0x0302f803, 0xfbf80301, 0xf9fd0d0c, 0x09faf1fe,
+    0xfef90003, 0x0000030a, 0x0bfaf10a, 0xf902ee11, 0xfa08fc05, 0xeaf305f2, 0x0bf9f907, 0xfaf7fffe,
+    0xfe03f509, 0xfe060d08, 0xfa02f208, 0xfefafa00, 0xffecfc05, 0x0003fc02, 0x02040505, 0xf6faeef4,
+    0x0e09f105, 0x04f1090d, 0xf80bf3fb, 0x0104f802, 0x03fbf404, 0xfbfa0600, 0xf8f808fe, 0x0cf4fbf9,
+    0x0302f800, 0x05fefa06, 0x0bfcef07, 0xee02f40b, 0xf70bf505, 0xeff60800, 0x0901f901, 0xfef8ff02,
+    0xfc02fc07, 0xf9020712, 0xfdfeec0a, 0x02000202, 0xffebfc09, 0xfbfff2ff, 0x03040706, 0xf4ffe7f3,
+    0x12ffe702, 0x03f6030e, 0xfd07f7fc, 0x090206fd, 0x02f7fa05, 0x00fe01f9, 0xfafb0703, 0x04f605f5,
+    0x0608fa02, 0x040100fe, 0x0a02f202, 0xfcfdf80a, 0xf704ec08, 0xfa000308, 0x03030001, 0x02fef604,
+    0xfefbff03, 0xff01030b, 0xfcfbf505, 0xff060706, 0x0004ff03, 0x02fff7ff, 0x01070802, 0xf5fff3fa,
+    0x07f6f501, 0x07ff0305, 0x0006f7fb, 0x02030bfe, 0x07fff902, 0x07ff01fd, 0x03020707, 0xfcfe04fa,
+    0x08080000, 0x00040902, 0x0301f703, 0x03fefe03, 0xfc00ef03, 0x0406fd06, 0x010cfc04, 0xfcfef505,
+    0xfcf303ff, 0xff000bff, 0xfefffe04, 0xfb040a04, 0x030c0103, 0xfffffbfa, 0x00fd0bfd, 0xfafff3fe,
+    0x06faf5fe, 0x04070300, 0x0204fafd, 0xfb030b04, 0x10010a08, 0x04ff0601, 0x02fdff0b, 0x040000ff,
+    0x05050503, 0xf6060dfc, 0xf903fc00, 0x0ff8fbf9, 0xfefdf100, 0x040309fe, 0x03100302, 0xfafafa00,
+    0xfaf908f7, 0x03041801, 0xf9fdfbf9, 0xed060906, 0x060f0202, 0xf902f901, 0x0df904fc, 0xfcfd0a07,
+    0xff06fefb, 0x040200fb, 0xfefdf7fc, 0x0c000907, 0x0f031003, 0x09ff06f4, 0x05f3fb0a, 0x01fafaf5,
+    0xf702020c, 0xf00105ef, 0xfa00fa02, 0x0ff4fbf9, 0x0402ff02, 0x07ff0a02, 0x01fc0809, 0xf5f90108,
+    0xf9fd06f3, 0x01030d02, 0xfb0000fb, 0xf0110407, 0x01040606, 0x010af911, 0x0bf3ebfa, 0xfbfb0c02,
+    0xf70806fc, 0x0b0400f6, 0x0000f6fb, 0xf905fdfc, 0xf804f404, 0xf6f90af2, 0x0b010502, 0xfafef2f5,
+    0xfb0c0afe, 0xea0c09fc, 0xfeffe90a, 0xfafd001b, 0x00faf2fa, 0xf7fefe16, 0x08f2fb03, 0xfcff0201,
+    0x0300f6f3, 0xfc0e0d04, 0x07ff0501, 0xff0107f9, 0x00fb0206, 0xfb01000a, 0xf8010d12, 0x0809f2ee,
+    0xf6f9030a, 0xfaf70501, 0xebfeffef, 0xf407fbfe, 0xfc07ff05, 0xe90209f7, 0x0afd03f6, 0x07fdfaf2,
+    0x050b0cff, 0xee05faf2, 0x03f8f103, 0xf7060d29, 0xfc06fdf6, 0x0803fe15, 0x06f00003, 0xf1fcfb01,
+    0x0805f7f9, 0x010508f5, 0x07fa0f00, 0x04020403, 0x05f50704, 0x0001eb03, 0xfdf20a0d, 0x0409f7e8,
+    0xf905f207, 0xfd070001, 0xeb02fef9, 0xf900f7f9, 0xf7ff0e0a, 0xe9fe0209, 0xff02f9f9, 0x0afcee02,
+    0x01060d04, 0xf3feeaf9, 0x01f8edfb, 0xf802fc28, 0xff06f8f6, 0x060d070a, 0x02f3fbfe, 0xf10004fe,
+    0x0b00f003, 0x00070bf3, 0x0bf90af5, 0x0402fd06, 0x06f60001, 0x0501db00, 0x03ec0ff9, 0x0804f201,
+    0xfe0df407, 0x02070204, 0xf5fdf6f7, 0xf8fcf7f0, 0xfcfc0c06, 0xf9f3020c, 0x02fdfefc, 0x0503ea05,
+    0xf7130303, 0xf205f9f2, 0xf2fef4f6, 0xfa01f504, 0x0301f4f8, 0x050e00fc, 0xfaebf8f6, 0xfbfe06ff,
+    0x0bf8f403, 0x030a16f4, 0x05f609f1, 0xf2020201, 0x01fffa04, 0x0006eefe, 0x04f00dfc, 0x0601fb0f,
+    0x080ff705, 0x000305fc, 0xf8f7eeeb, 0xf7fffff4, 0x03fa0303, 0xfef60109, 0xfdef00ff, 0x0504ea07,
+    0xee18f3fe, 0xe509fcee, 0xea04f5f7, 0xfafeede7, 0x0400eaf0, 0x030e05f8, 0xfefc00fb, 0x0b0303ff,
+    0x01fef202, 0x030b13fe, 0xfde701ed, 0xeffe06f6, 0xff04f606, 0xf6fdf403, 0xfdea03fa, 0x03fef41e,
+    0x1206f905, 0x05fd04fc, 0xf902f2f8, 0xf5ff0302, 0x09fd0004, 0x06f9060a, 0x02e90205, 0x0e05f404,
+    0xf40ffc01, 0xe908f6fe, 0xf50bf4fd, 0x05ffe9f7, 0x04fff6f4, 0xfc0707f7, 0xfdfbfe03, 0x0904f704,
+    0xf903f403, 0x040a0d02, 0xfee5fff6, 0xf10108f9, 0x01f1f401, 0xf9faf514, 0x03ee0afe, 0xfc01fd17,
+    0x1b00ebfd, 0x06f801ff, 0x0106f601, 0xeffd0505, 0x0a03ffff, 0x030704f8, 0x03e70015, 0x0f09feff,
+    0xf6fdfc09, 0xfb0af005, 0xfc0dfe01, 0x0107f3f0, 0xff03f8fc, 0xf90e05f8, 0x00f3f900, 0x07030303,
+    0xe9fe01ff, 0x000a01f9, 0xfee9f6f4, 0xfb0909fb, 0x06e7fbf9, 0x00f5f220, 0xfff206f9, 0xfd00f706,
+    0x16f9f1fa, 0x06fbf5fa, 0x0c09f604, 0x0408ff00, 0x030cfafe, 0xfe0906fc, 0x04eb0313, 0x080602fe,
+    0xfdf8fc07, 0xf908f3f4, 0x0404fafe, 0x030bf8ef, 0xf606f9fb, 0xfb040602, 0xfc01f3ff, 0xf90702fe,
+    0xecff0706, 0x040605f8, 0xfdf0f0ff, 0x02fe03fa, 0x08eafdfa, 0x03f8f317, 0xf7fd0202, 0xfcfff3fd,
+    0x0301effb, 0x0403edfc, 0x10fefa04, 0xf106f8ff, 0x0dfff302, 0x060003fd, 0x0604031a, 0x03fef905,
+    0xf9fc000d, 0xff04fc08, 0xf9050c0a, 0xfcfe0703, 0x00fe01fc, 0x0810fbfe, 0xf6fafcfb, 0x060006fe,
+    0x0b0900fe, 0xfa03fa07, 0xfffa09fb, 0xfe0301f5, 0x03050104, 0xfdfbfe08, 0x09030308, 0x0406fd04,
+    0x0a040af8, 0x0509fbfa, 0xfc03fffe, 0xfb00f8ff, 0x01f7f700, 0x03fafffa, 0x060a010c, 0x06fafcfc,
+    0xfb05fe0e, 0xff02fe00, 0xfb020b0e, 0xeefdfc09, 0xf900f5fa, 0x0710fcfb, 0xf7f707f1, 0x010004fe,
+    0x0009fcfa, 0xfb02f904, 0x00f501fc, 0xf20506fa, 0xfaf90305, 0x00fbf7fe, 0x01f90603, 0x05fe00fb,
+    0x020706fb, 0x010af1fc, 0xff050401, 0xff020702, 0xfaf9fe01, 0x00f8fdf2, 0x030602f9, 0x08fc02f9,
+    0x04000008, 0xfd03fff8, 0xfb060d13, 0xee05f20b, 0xfc0504f8, 0xf40f0303, 0xf8fb08ec, 0xfbfa0300,
+    0xff070301, 0x0004fdff, 0x01f200fd, 0xf80309fc, 0xfc050202, 0xfb02f6fd, 0x00f20401, 0x07fa0af6,
+    0x060509f9, 0x02fcf901, 0x00090807, 0xff0105fe, 0xeef9f3fc, 0x040000fa, 0xfe04fef1, 0x03fbfff6,
+    0x00fc07f6, 0x00f8f1f6, 0xfb040d0a, 0xf707f605, 0x020807f2, 0xf7f9fb0b, 0xf8f805ed, 0x02000605,
+    0x0206fe00, 0x0302f6fd, 0x0af3040c, 0xfd040afd, 0xff000503, 0xf709f603, 0xfdfe0201, 0x01fa09d4,
+    0x05fb0dff, 0x03f6fa04, 0xfd020712, 0xff0107ff, 0xeffff3f8, 0x02fb04f6, 0xf105fcfa, 0xf807f401,
+    0xfdfb0cf8, 0xfcf8defc, 0xfe0503ec, 0xfa09f9f6, 0x070b0bf6, 0xfdeaf30d, 0x09f507fb, 0x04fd000b,
+    0x06040302, 0xfffdfc04, 0x08fe060f, 0x09ff0106, 0x03fe0300, 0x0109f600, 0x06fd0005, 0x08fdfbd7,
+    0x02f70501, 0xfefcff01, 0xfffdf802, 0x000105f9, 0xf601f4f6, 0xf904feff, 0xebfd00ff, 0xf704f7fc,
+    0xfc040bf7, 0x02fcd7ff, 0x0204fee2, 0xf908fdfd, 0x08070b02, 0x01f9f10c, 0x0ffafe02, 0x04ff0307,
+    0xff090400, 0x01f60101, 0x0d06ff04, 0x0402fd04, 0x05fa0800, 0x03080900, 0x0cfe0003, 0x05fd07e2,
+    0x08fa0005, 0x03030402, 0xf1f7fff9, 0x02ff0005, 0x0100f900, 0xf70407fe, 0xe9f60506, 0x03fb020c,
+    0xff0d05f8, 0x0008e6f9, 0x020200ef, 0x0009fb0c, 0x05090902, 0x0208f815, 0x0c07fa00, 0x020101ff,
+    0xf2070603, 0x06f9010c, 0x0c07fef3, 0xfc01f704, 0x06f807ff, 0x0003f7f8, 0x0bfe0203, 0x03fa05e5,
+    0x0b0afd07, 0x06090a09, 0xf50703f3, 0x0af4feff, 0xfd0301ff, 0xee0a0300, 0xdbff0806, 0x06fcff02,
+    0xfc1806fb, 0xf408faf6, 0xfefdf7f3, 0xfb04f50b, 0xfc0c0afe, 0xfe0c0314, 0x0208f9ff, 0xfe010102,
+    0xf301f903, 0x07eaff05, 0x07fd00f7, 0xfb04f9ff, 0xfefe0407, 0x02fdf5fe, 0x05031201, 0xfaf2f6f2,
+    0x09020107, 0x0e0b0c0e, 0xf8fd01f4, 0xef00e808, 0xff00fe02, 0xf4f10607, 0xf6f70cf3, 0xfcf9ed08,
+    0x0508f6f9, 0xf8ff04ee, 0xfafb0cfc, 0xfd05070e, 0x06000800, 0x080800f3, 0xfff500f4, 0xfa0509fc,
+    0xfd070405, 0x010800f7, 0xf5fb06ff, 0xf401fbfe, 0xf6effb01, 0xff0200e4, 0xfff4feed, 0x0b0704ee,
+    0x000feffd, 0x03fffeff, 0xf7fa08fe, 0xe50aef04, 0xfe04f708, 0xf7ed0605, 0xf00507fb, 0x05fbeffb,
+    0xf8fcfa04, 0xfc04ffff, 0x00ff07fb, 0xf806fe13, 0x040710fc, 0x06fe01ef, 0xfef3fff4, 0xf20403fe,
+    0x03050305, 0xf9f9fefb, 0xe9050503, 0xf40101fd, 0x01ec0006, 0x05030bf3, 0xfaf2faff, 0x0905f9f4,
+    0xf608f401, 0x03fffc05, 0xf8f30706, 0xe909f207, 0xfb05ff04, 0xf6f80403, 0xfa010704, 0x0408f9f6,
+    0xf3fa020d, 0xf90a0408, 0x03fe05f9, 0x0708fa11, 0x030b15f5, 0x04fa04ed, 0xfe070701, 0xf7f900fd,
+    0x02060308, 0xfdfafdf8, 0xe002fb04, 0xf7030203, 0xfdf70004, 0x060204fa, 0x02ecf504, 0xfe01030c,
+    0x03f6fd04, 0x04fdfd0b, 0xfef5f60a, 0xf301f3ff, 0xfa05fef9, 0xf0050103, 0x03f40305, 0x00fc000b,
+    0xfc000805, 0x05050006, 0xfc05fafb, 0xf7070500, 0x00070ff5, 0x08fa05f5, 0xfa0f0707, 0x06fd00ff,
+    0x01030803, 0xfefd00fe, 0xef03f701, 0xf6010100, 0x01ff0107, 0x03080cfe, 0xfa01f602, 0x0102070a,
+    0x09f2fe08, 0x03f90001, 0x03030307, 0x13fdfcfc, 0xf303f9f7, 0xfa09fff7, 0x06f3fdfa, 0x00f80501,
+    0x070a0207, 0x10fefef5, 0xf606ec02, 0xfb0104f1, 0x040afaf4, 0xff0802fc, 0xf6fc0303, 0xf9030203,
+    0xf2fcfd02, 0x050305fe, 0xf8ff08fe, 0xf80107fa, 0xf8f60101, 0x060808f7, 0xf10ffbfa, 0x04ff0500,
+    0x04f70008, 0x05fcfbf5, 0x04100204, 0x10fdfcfc, 0xf009fef9, 0x01fe02fb, 0x0af6f8f8, 0x04fc0404,
+    0x09080204, 0x0cf7f9ee, 0xfa08fffe, 0x00fd04f6, 0x0105faf8, 0x0404fe0b, 0xfbfe0600, 0xfc060702,
+    0xfa00fb03, 0x070305fe, 0x02020e03, 0xf9f806f7, 0xf9f50103, 0x05060001, 0xfefd04f8, 0x0bf9fcfc,
+    0xfd00ff06, 0xfffafcf9, 0x030afefc, 0x12fffe02, 0xfa02fffd, 0x0302fdff, 0x06fef507, 0x030000fb,
+    0x061007f5, 0x03fceef6, 0xf9fd03fb, 0xf00305fe, 0xfe06fc04, 0x0705ff08, 0x0305fef9, 0x04020805,
+    0x0103fa05, 0x0806f5f8, 0x060007ff, 0x03f804fb, 0xfef0fd03, 0xff000709, 0xf7020f02, 0xfefaf9fa,
+    0xf4fa0204, 0x02fff9fb, 0x00070cf6, 0x1cf5fbfb, 0xf3f6fcfd, 0x020700ff, 0x09fef512, 0xfff80206,
+    0x07160401, 0xfb05fafd, 0xfff900fb, 0xfb050707, 0xf904ff00, 0x05040a0d, 0x020d04fc, 0x08fe040b,
+    0x0300f8f9, 0xff00f605, 0x07020501, 0x07fd00f7, 0xf8f9f407, 0x0fff0a1a, 0xf702030d, 0xf5fb0403,
+    0xf6f90e05, 0x0706f7f8, 0x02fe0ef6, 0x02f9fafa, 0xfd04f700, 0xfd06f901, 0x01f8fafa, 0xf6effc08,
+    0xfdedf302, 0xfc010712, 0xf20805fd, 0xfb03fe12, 0x05fafcf5, 0xfef4fffa, 0x04fd01f8, 0xf6ff00fc,
+    0xf80a04fb, 0x0c0209f8, 0x0efef906, 0x01fd0704, 0x0800fcfc, 0xfd090aff, 0xfb0a04f3, 0x09f60bff,
+    0x03ff0207, 0xfd020bf9, 0xf50ffd08, 0xfdfcf8fa, 0xf304e502, 0x01f900fa, 0xf7f5fbfb, 0xf2f4ea01,
+    0x01f3fefe, 0x01fff40b, 0xf702f4ee, 0xfb05fc0a, 0x0001f4f2, 0xf9effefc, 0x04fdfdfc, 0xf5010600,
+    0xfc0d00fe, 0x0aff0cfc, 0x10f9fb02, 0x04f6070a, 0x08f802fd, 0xff0102fc, 0x000cfbf6, 0x030008f0,
+    0xfd020108, 0xfc0501fe, 0xf50bfd0a, 0x04ff01f9, 0xf303e5ff, 0xf8fffcf2, 0xeff4ff01, 0xf7f5edfc,
+    0x050a00fa, 0x02ffe5f6, 0xfc01e3f5, 0x030500fc, 0xff08fbf0, 0xeff3fafd, 0x06fbf603, 0xf5000202,
+    0x03050301, 0x04fd0cf8, 0x11fbfffa, 0x00f60600, 0x05f60500, 0xfffffefc, 0x0008fdfc, 0x020209f2,
+    0x0103030a, 0xfe06faf7, 0xf1ff0004, 0x010505fb, 0xf301f4fd, 0xfe08f8f9, 0xf9fa070c, 0x01faf800,
+    0x060200fd, 0x0602edfc, 0xfe01f3f7, 0x0d0802f6, 0x000900f9, 0xf7f9fa01, 0x01fdfe08, 0xf604f8fb,
+    0x00040805, 0x04ff0cf9, 0x110101fa, 0x06fc02fe, 0x03f80105, 0xfbfd0404, 0x030bfd02, 0xfd04fefb,
+    0x07050707, 0x0100fdfc, 0xfa000101, 0x01ff0b03, 0xff00f902, 0xf701fefc, 0xfcfe0401, 0x0304fdfe,
+    0x050301f6, 0x0604f6fe, 0xfe03fffa, 0x0409fbfc, 0xff080303, 0x0200f903, 0x0007ff07, 0xf904fff8,
+    0x02fe0b02, 0x05040900, 0x160008fb, 0x08fe02fe, 0x00fa020b, 0xfcff0307, 0x080c01f5, 0xfe08fffa,
+    0x02030503, 0x06fdfafe, 0x01fb06fa, 0xf60606fc, 0x0800f50c, 0xec03fffb, 0xfdff04fa, 0x1101fa05,
+    0x02fef7f7, 0x0706f503, 0xfd06fefa, 0x0706f60c, 0x000b0107, 0x05040403, 0x02040204, 0x0109fdef,
+    0x01fe0e02, 0x07010806, 0x10f906fa, 0x08f8fcfc, 0x02020405, 0x02ff0404, 0x0b0301f2, 0x000dfdf7,
+    0xfe080600, 0x04fbfb02, 0xf9f8fcf8, 0xf50706fe, 0x0dfef504, 0xe60502f1, 0x040203e6, 0x1503fe04,
+    0x02f6f1f7, 0x0505f2fe, 0xf904f5f8, 0x0504f40f, 0x05050106, 0x0a0202fe, 0x02ff0203, 0x0500f5ee,
+    0x02fa06ff, 0x08070410, 0x0c0307fa, 0x01f8f8fa, 0xff000401, 0x0206f9f9, 0x0800fffb, 0xfe0d00f2,
+    0x01090102, 0x03f9ff03, 0xf3f5f0f4, 0x03fa09f7, 0x10fafafe, 0xf40d0aeb, 0x01feffd6, 0x1209f3ff,
+    0x0217eaf5, 0x0104f8e8, 0xef03fafd, 0x0b02fd05, 0x060502fb, 0x0e050200, 0x00ff030d, 0x01f5f8f8,
+    0x03f5effc, 0x03050906, 0x09060efb, 0x01fffff8, 0xfe05fffc, 0xf30bf1fd, 0x00fe01fd, 0xfa02fff9,
+    0x0d070602, 0x0cff08ff, 0xf1f7fafb, 0xea0102ea, 0xfe00feff, 0x05fdfef8, 0x01f804f4, 0xff120013,
+    0xfef60b1b, 0xf306010a, 0xfcf9ee1c, 0x04fefd00, 0xfef9f8fd, 0xfa0301fb, 0xf5fbfc00, 0x0203f803,
+    0x03f80503, 0x060106fc, 0x070501fe, 0x01f7fd16, 0x02f7ff0d, 0xfaf4f504, 0x0af9fbff, 0x0b05f81b,
+    0xe9f90bf6, 0xf9f00814, 0x0d05ffed, 0xf4fa07e2, 0xf7fdfcfa, 0xf60bf9f3, 0x02f902ea, 0x0a0e0304,
+    0xf6f9051c, 0xf0020608, 0x0ef9ee27, 0x0902f9fb, 0x03fef6fc, 0x010bfaf4, 0xf5ff0001, 0x05030b03,
+    0x05f40401, 0x02030cf1, 0x100502f8, 0xeafcff02, 0xfef6fc06, 0xfff0fbf9, 0x06f5f1f8, 0x0b02f10d,
+    0xf90a0afe, 0xffff0112, 0x0b0407f9, 0xf6fafcf6, 0xf5ff06ff, 0xf30af5f2, 0x0bfa05f9, 0x0dff06ed,
+    0xfafdfb0b, 0xfaf90a16, 0x0ffa0622, 0xf602f810, 0x0505f90e, 0x071108f6, 0xff11f9f9, 0xf5ff03fd,
+    0x06fc0203, 0x050503f4, 0x08f80100, 0xeafd07f9, 0xfcf90402, 0x00f6fefa, 0x05f9f7f3, 0x0bfdfae4,
+    0x0806fd01, 0x0100fd01, 0xfd030bf8, 0xf705fb01, 0xf8030504, 0xf8020503, 0x01f705fe, 0x03f402f1,
+    0xfb0402ef, 0xf8f30305, 0x020013e9, 0xf206f51e, 0x030a0a0e, 0x1f010cf9, 0x0dfff5e4, 0xedfe0701,
+    0x0108ff03, 0x03fcf8f1, 0xf7f80510, 0xecfc0401, 0x02f30104, 0x0403f9f9, 0xff0907fd, 0x05fffae2,
+    0x01fdf804, 0x0200f7fc, 0xfdfcf6f8, 0xfd0bfe07, 0xf805fa03, 0xf5fd0907, 0xf8f701ff, 0x0006fef7,
+    0xf60306f1, 0xf2effd00, 0xee0b00ea, 0x0709f322, 0x030c0d0a, 0x22f903f9, 0x19eefeeb, 0xf0fdfdff,
+    0x0106ff01, 0xfcf2fcf7, 0xeafeff0f, 0xeffefe01, 0xfffa0202, 0x0a0601f2, 0x0505110d, 0xfa0003e9,
+    0xfc01f904, 0x001e0202, 0x0002ea02, 0x030bff01, 0xf804fefc, 0xf00204f9, 0x030cfc00, 0x010701f8,
+    0x03f205fb, 0xfbfd07f5, 0xf204fef2, 0x0708f607, 0x050d0bfd, 0x10ebfdfe, 0x0afd090e, 0xfcfaf202,
+    0x030303ff, 0x01ff04fc, 0xf407fd06, 0xfd01fdfd, 0x060504fe, 0x060a08f0, 0x020afd11, 0xfc0409ec,
+    0xf8040006, 0xfd1e09fd, 0x0300f007, 0x1a06fdfe, 0xeffa09f5, 0xed0303ef, 0x0113f6f9, 0x05f908f8,
+    0x05effc06, 0x0801fbef, 0xf6fd02f3, 0xf601f6f8, 0x060d06f9, 0xf9e70202, 0xf50d1317, 0x03fcf703,
+    0xfbf60100, 0x00faf4fb, 0xfc080102, 0x0a04fff5, 0x050108fc, 0x070e11f1, 0xee0af20d, 0xfa0000fb,
+    0x0707f904, 0x081105f8, 0x0310fa0a, 0x13fffbfb, 0xf6f704f5, 0xed08fff4, 0xfc11ec02, 0x01f108f7,
+    0x0901f802, 0x0ffcf3ec, 0xf0fc03f9, 0xf4f901f6, 0x01fc02f1, 0xf4f40107, 0xf3111608, 0x02fc0002,
+    0xfcfbfff3, 0x0af3f501, 0xff00fded, 0x0f03fef9, 0x02f70cfa, 0xfb0f0af5, 0xe807fafe, 0xfb010100,
+    0xfafcf102, 0x070204f1, 0xf8090808, 0xfef70ee0, 0xf7fff901, 0xfff2fc07, 0xe8f9ed1d, 0xdcf9010b,
+    0xfe0b0c0d, 0x030d0c06, 0x0900fcf9, 0xf700f3fe, 0xe8ed0703, 0x0406020b, 0xf5f00400, 0x02ff0bff,
+    0x0101fce5, 0xf7f40af3, 0xfb0007fe, 0xd2f20604, 0xf5060203, 0xfd070511, 0x05fa1005, 0x0010080e,
+    0x01e0041b, 0xfff703e2, 0xfef50eff, 0xfaf905ef, 0xf702f3fa, 0xfdf10310, 0xebf40015, 0xe001ff06,
+    0x07050604, 0x010804fc, 0x0604fef8, 0xfb02f206, 0xf5f20401, 0x090bf807, 0xfaf80006, 0x09fc09fc,
+    0x0505feeb, 0x00fe0dec, 0xf9080706, 0xe7f808fc, 0xfbfd0403, 0xfa070004, 0xfdfc0804, 0x050c0309,
+    0x04e1f511, 0x0002fff0, 0xfff20701, 0xfe0101fd, 0xfc03f809, 0xfbf70407, 0xf6fd06ff, 0xf500fe09,
+    0x06000501, 0xff05fff9, 0x0305faf4, 0x0104fb0d, 0xfeff02fd, 0x0902030b, 0xfffe0309, 0x05ff0800,
+    0x070303f7, 0x050304ef, 0x050d0204, 0xf0fe07fa, 0x02f60702, 0x0003ff02, 0x05fbff04, 0x05040001,
+    0xfdf6fb0b, 0xff11fffe, 0xfbfd0706, 0x06fb04fb, 0xfd00f607, 0x02f9090a, 0xf602fffe, 0x0400fd01,
+    0x02fb0500, 0x0206fff6, 0xfc0205f8, 0x0100fe0b, 0x00fd05fb, 0x0aff070c, 0xfcf60507, 0x08000b00,
+    0x03fe00fc, 0x040206f0, 0x0a0c0501, 0xe9fd06fa, 0xfefe0400, 0xfd050508, 0x08ff0304, 0xff0302ff,
+    0xfdf8fe0a, 0xfb12fe08, 0xfa030800, 0x07fe07f5, 0x01fbfffd, 0x07f50700, 0xf90803fd, 0xfefff809,
+    0xfef80105, 0x020ff9fb, 0xfa0506f6, 0x0302fffc, 0xfef9fbf2, 0x0afc020e, 0x05fc0603, 0x0a020efb,
+    0x01fc03f8, 0x050700f0, 0x190602fc, 0xf7f806fc, 0xf40303fd, 0x0202ff10, 0x050706fd, 0xfefdfd04,
+    0xfdf80609, 0xf810ff0c, 0xf80206f7, 0xf9fafd02, 0x02fb0601, 0x02fa0304, 0xf90605f9, 0xfdfff809,
+    0xfaef0106, 0x0009fc00, 0xff0001fe, 0x0003fdfa, 0x03fdfff5, 0x02fcfdfe, 0x03f80503, 0x06f90201,
+    0xfcfdfdfb, 0x040701f3, 0x0c03fffd, 0x000004fd, 0xf80100f8, 0x06050205, 0x080003fe, 0x00f7fa08,
+    0xf7fc0501, 0xfafbff0d, 0xf80203fa, 0xfdfdff01, 0x03fdff04, 0x03f80f01, 0x020608f6, 0x0afcf409,
+    0xfffa0703, 0x0212fe07, 0xff040afe, 0x0104fefb, 0x0700fff7, 0x01fb0005, 0x06ff0902, 0x09020000,
+    0x02fdfcff, 0x070e01fc, 0x0902fff9, 0xfcfc06fd, 0xfbff03f5, 0xfdfffd12, 0x060502fd, 0xfbf6f8fd,
+    0xff050400, 0xf500ff0a, 0xf4fe0003, 0x0dfd0af7, 0x01fdff08, 0x01fb12fe, 0x040203ff, 0x12fff103,
+    0x04040804, 0xfb1b0303, 0xf00d0a00, 0x050b03fc, 0x1000fef8, 0x0500050a, 0x0d040b02, 0x030b06f2,
+    0x08fafdfc, 0x0808ffff, 0x0f040700, 0xf1fc0600, 0x070904f7, 0xfafcfc1e, 0x0a09fff5, 0xfbf2fb01,
+    0x000a0302, 0xf10b080b, 0xf5fe0000, 0x04f70805, 0xf3fc00f4, 0x040afcfd, 0x0df30d00, 0xfefb01f6,
+    0xf4fc00fe, 0x04f8f8f9, 0xfd010afc, 0xfe01fcf8, 0x0afd0802, 0xf9fb0101, 0x030e0107, 0xfeff07fd,
+    0x03010a03, 0x0311f6e1, 0xf900fd06, 0xe8fdfff8, 0x080b01ff, 0x00ff0d03, 0xfdfdf4f9, 0x0d0800f7,
+    0x040801f9, 0x0601fd06, 0xfb04fd05, 0x06fa0505, 0xf6fe00fc, 0x0a09fc00, 0x07f30005, 0x00edfcf9,
+    0xfeff00ee, 0x0004fcfb, 0xf50009fa, 0xf907000c, 0xff0107ff, 0xff020000, 0x000d01f9, 0xf0000003,
+    0xfa040306, 0xff08f9e7, 0xf4fcff02, 0xeefafff2, 0x08fefefd, 0xfdff0205, 0xf4faedfd, 0x0607ffff,
+    0xfe05fafb, 0x0803fb0a, 0x07020b02, 0x01fa05fe, 0xfbfdfef8, 0x0b01fe08, 0xf9f7fe07, 0xfeeefafd,
+    0x000e00f7, 0xfd0dfafd, 0xfefbfaf0, 0xf70f0812, 0xfa010dfb, 0x080bfd09, 0x060c05ed, 0xf804fc00,
+    0xfa07f8ff, 0xfd08fbf9, 0xf8f905fc, 0xfff507f9, 0x09f3f804, 0x01f9fa0d, 0xf600f30a, 0x0205fc08,
+    0xfdfcfcff, 0x0208ff0c, 0x03f903fe, 0x05fd01fe, 0x0900fef6, 0x010ff806, 0xf9fff50f, 0xfd04f605,
+    0x000904fc, 0xfb09f5ff, 0xfdfbf8f9, 0xff0f07fc, 0xfe0208f9, 0x0205f401, 0x090002ef, 0x05ff0300,
+    0x0002f6fb, 0x0108f9fa, 0x04f5fbfc, 0xfcfa05ff, 0x06f1f701, 0x00f9fb01, 0xfd05fa05, 0x01060010,
+    0xf9fa00ff, 0xfe01030b, 0xf5f90800, 0xfcfffffb, 0x0afffff3, 0xfa08fc08, 0x00fffa01, 0xfe01fd0c,
+    0x0202ff04, 0xfe09f9fe, 0x02fbfdf4, 0x020e09f1, 0xfb0404ff, 0x0209f3fc, 0x00fffdff, 0x0afbfe03,
+    0xfd02f7fe, 0x030afef5, 0x0006f1f9, 0xf7ff01fe, 0x01e9fc02, 0xfffdf8f5, 0x0308fb05, 0xf903ff09,
+    0xf7f70601, 0xf7090303, 0xf4fe09fb, 0xfbfbfafb, 0x0efb05f8, 0x0106fb02, 0x06fc0405, 0x0704fd10,
+    0x0306fb08, 0xff05fbfb, 0x040006ec, 0xf80807ed, 0xff05fd05, 0xfe08f204, 0xfd0008fb, 0x08f4f900,
+    0xfcfbfa04, 0xff08ffeb, 0x0208fdf9, 0xf00205ff, 0xfdf3f704, 0xfc0300f8, 0x000705fb, 0xf500fd03,
+    0xf5010702, 0xfd0801fd, 0xfefe11fd, 0xf7fef60a, 0x06fa0803, 0x0506ff04, 0x04020907, 0x0c0afb0e,
+    0x050afd00, 0xff0afaf6, 0x030407e4, 0xf5ff0ff1, 0xfc0afd04, 0x0509f9fa, 0xf9fe12f7, 0x02f9fffe,
+    0x05fefa09, 0x0205f1ee, 0x0701fefb, 0xf1fe0301, 0xfcfcfb02, 0x020403fa, 0x03030f01, 0xf9fcf8f6,
+    0xf4040603, 0xf90b03f8, 0x05090a01, 0xf8fef00e, 0x06f50f00, 0x06050305, 0xfd08130e, 0x0904fc04,
+    0x0201fefa, 0x020af8ef, 0xff0602ef, 0xf7fa02f3, 0xfd0f03fe, 0x0310f3f4, 0xf9ff12f8, 0x02f2fd07,
+    0x0cfefc0d, 0xf70afcf2, 0x01fdf8ff, 0xfc0405ff, 0xfe01ef01, 0xff08ffff, 0x08fe1001, 0xf4fdf5fa,
+    0xfafd0300, 0x000901f7, 0x000a01fe, 0xf904f2f2, 0x02020006, 0xfef10303, 0x020402fc, 0xf5fef408,
+    0x0808f5ff, 0x010d09fa, 0x070cfe05, 0x00000200, 0xf7fffe0c, 0x07fffff8, 0x07030502, 0x06f203f5,
+    0x00060cfa, 0x0405fe09, 0xfefdfbfd, 0x12fa0304, 0xf603ff07, 0xf704fc00, 0x04020902, 0xf9ff07f7,
+    0x03fb06ff, 0xfbf70ef8, 0x03ff020e, 0x0302f3ed, 0x12fc010b, 0x01f50904, 0x0700000c, 0xf8fff409,
+    0x0706f3ff, 0x08110300, 0xfa0801fe, 0x04f00408, 0xf9f7f709, 0x050105fe, 0x000000ff, 0x01020cfb,
+    0x020102f4, 0xfc080a05, 0x02fff6ff, 0x19f10508, 0xf7fe0009, 0xff040406, 0x0eff0afe, 0xf4fb040b,
+    0xfafb04fc, 0xf8030e00, 0x00fbfa00, 0x02fef7e6, 0x01fd0603, 0xfdfc0b00, 0x03050614, 0xfa05f51d,
+    0x04fbf90b, 0x060d0808, 0xeb030b01, 0x13ec020b, 0xf6f4f7f9, 0x020401f5, 0xfaf90a05, 0xfd050dfe,
+    0x020503f9, 0xff0e0df4, 0x0102f9f4, 0xf4f50601, 0xfdf60502, 0xfffe07f4, 0x0b01fff7, 0x01fcff13,
+    0xf9fcfafe, 0xfdfd0b06, 0xfeff0202, 0xf0fcfbfd, 0xfa000106, 0xfcfe0300, 0x07f70c11, 0x0400f40f,
+    0x00000109, 0x02f9020a, 0xfe000107, 0x08fffeff, 0xfffdfef2, 0x0414fcf2, 0x00f80806, 0x03fafffd,
+    0xfe0000ff, 0x000c0fe7, 0xfa0405f1, 0xe0fd0af7, 0x06ed0602, 0xfc0001e1, 0x0603f9f4, 0x05fe0005,
+    0xf005fd01, 0x0201fd03, 0x09040700, 0xe1fc000d, 0xfa04fc00, 0x01fc0108, 0x00fa0404, 0x10fcf3fe,
+    0xfdfe04fc, 0xfee8f303, 0x0e000606, 0xfd05f4f5, 0x060c03f8, 0x0a1600f4, 0xff0804fa, 0x01fe02fa,
+    0xf9060205, 0x06fefee8, 0xf5f407f7, 0xe9000bf7, 0x0ae90104, 0xfd03f403, 0xfe00f5fd, 0x030104f4,
+    0xf2fefc05, 0x0303f506, 0x090205fd, 0xef03fe08, 0xf407f6fd, 0x0306070f, 0xf4fff500, 0x0b03f9f3,
+    0x08fc0200, 0x00ede9fe, 0x05fe010c, 0xfc09f3f0, 0x0714fff9, 0x0e020401, 0x0804faf5, 0xfdf100fd,
+    0xf8fd0305, 0x03f2fbf3, 0xf4ef0a00, 0xf60303fb, 0xfef4ff05, 0x0604ea08, 0xf901fb03, 0xfc0103f1,
+    0xf8f6f10a, 0x0500f211, 0x09fc0200, 0x0307feff, 0xec07f7fc, 0xfd0707fd, 0xe8fcf2f1, 0xf6070a01,
+    0x0af90002, 0x08f8f7fd, 0xfafc010f, 0xf805edf7, 0x0011fdfe, 0x1cf6000f, 0x0cf60105, 0xfafefd08,
+    0xfafbf703, 0x01e904fc, 0xf3f1fe0a, 0xfffc0000, 0xf9000505, 0x0009ef08, 0xf304f70c, 0xfe040603,
+    0x0beef80b, 0x05fbfb08, 0x0c040201, 0x14fffe03, 0xef03fffa, 0xf70c00f8, 0xef0100fd, 0xf6fe1107,
+    0x09f6fe06, 0x0dfd01fa, 0xf7fafd07, 0x0501fa04, 0xf90804fc, 0x0afb020c, 0x03f70012, 0xfefe010f,
+    0xfef6ff03, 0x05ecfbfa, 0xf0fef40d, 0xf7fffe00, 0x01021008, 0x0205f604, 0xf302ff09, 0xfe050a01,
+    0x0bf3ff10, 0x03f6fd04, 0xfe090508, 0x04ff03f9, 0x0ef90402, 0x10fa010f, 0xfdfef01c, 0xfdfd071b,
+    0x0809f6f9, 0x00150605, 0xfe0b07f3, 0x00fb0007, 0xfef10402, 0xf8f60802, 0x08fc00f6, 0xf306fafb,
+    0x0f02fef5, 0x02f3fd14, 0xfafa09f8, 0x0603fa10, 0x02ff04f8, 0x00ff0107, 0xfdfe05fb, 0x02050afa,
+    0xfbfa0e02, 0xf5fa0f06, 0xec0306fa, 0x030304f7, 0x0702ed0b, 0x07fafe0b, 0xfafcf211, 0xef060212,
+    0xf6ff000e, 0xfb160412, 0xf6080809, 0x00f2fb09, 0xfef40301, 0xf5f60001, 0x0afe06f5, 0x070ff4fd,
+    0x05fefcf9, 0xfff2fefd, 0xf90602f9, 0x0403f60c, 0xfa0802fb, 0x04f3ffff, 0x04ff05fb, 0xfc05f70d,
+    0x020911ff, 0xf9f30600, 0xf505f9fc, 0xfe050def, 0xfefdf40a, 0x00fd03f5, 0xfdff0c08, 0xff0b0707,
+    0xf3f8071c, 0xfb0bff0c, 0x00ff0707, 0x01faec05, 0xf9f6f609, 0xfa04fa05, 0x06ff120a, 0x1203fa04,
+    0xf8f5fcfa, 0xfafd0300, 0xf808f7f9, 0xf80201fe, 0x00f70102, 0xfaf305f2, 0x05f008f7, 0xfdfff90b,
+    0x021405fd, 0xfaed00fd, 0x05fefd00, 0xec05fdfd, 0x02fcff00, 0xf8f808fc, 0x070017fb, 0x1900fefd,
+    0xfaf00914, 0xff00fb07, 0x00f60011, 0x02fff201, 0xfd04f90c, 0x021603f9, 0x04030504, 0x05f8f802,
+    0xf1fffe08, 0xf90b05f5, 0xf501f5f7, 0xf1030dfa, 0xfeecfd03, 0x02f80df4, 0x0af6fff8, 0xff0207f6,
+    0x0010fcf9, 0xfcfaf909, 0x09fe0cfb, 0xf004f104, 0x0d020dfe, 0x00f800fe, 0x070012f4, 0x12fc00ea,
+    0xfcf402fd, 0xfb07f6fa, 0xfff8ff02, 0xfa05ff02, 0x0515f908, 0x060f0cfc, 0x0406fefe, 0xfff8fb0a,
+    0xf900ff0d, 0x050508fc, 0xfc02fd04, 0xf40605fc, 0xfff10204, 0xfc00fffe, 0x0b0200f9, 0xfffb0ce6,
+    0xfe09f2fe, 0x040af909, 0x05ff0af7, 0xf800f707, 0x01ff0600, 0x06030005, 0x07040304, 0xff01fef7,
+    0x01f80504, 0xfd0cf901, 0x04feff01, 0xee0100fd, 0x0212fe08, 0x070407f9, 0x06fcfcee, 0xf900f602,
+    0x02f90a09, 0x04040001, 0xfd020605, 0xfe0200ff, 0xf8f7fefe, 0x02fffafd, 0xff06030a, 0x06fb08f1,
+    0xfcf9fc06, 0x0107f700, 0x03f704fb, 0x00f10000, 0xf60004fc, 0x0400fd05, 0x0106fe08, 0xee060201,
+    0x02fb0703, 0xfc05ff01, 0x04fef703, 0xef0702f5, 0xf91000fe, 0x0df20502, 0x02fa01f2, 0x0102f901,
+    0x05f400ff, 0xfbfefd01, 0xf90201fc, 0x00fdfcfc, 0xfafbfdf8, 0xfffff0fb, 0xfefdfb06, 0x08fb02fb,
+    0x05ef010c, 0x030903fd, 0x00fdfcfa, 0x09f1ff04, 0xfbf112fc, 0x0cfd0201, 0x0002fb09, 0xf1fefafd,
+    0x04fdff00, 0xf90003f0, 0x0000f508, 0xec0403f7, 0xf60c0304, 0x04f1fe00, 0xf7ff01f6, 0x01fffd0a,
+    0x07f7f4fd, 0xf6020a0a, 0xfefcf6f2, 0x02fb06f9, 0xf5f3fe05, 0xfd050003, 0xf9fff808, 0x00fcf7fd,
+    0x03ec0110, 0x070607f6, 0x1203fdfd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00faf7f5, 0x0700f9fa, 0x090e0605, 0xfcec040a, 0x03f0fd02,
+    0x0e0cfdf4, 0x0900fdf4, 0x00fb00f6, 0x03f8ea09, 0xfaf505f6, 0x011504f5, 0x0ff5f3f8, 0xfd0b05fd,
+    0x0904f8f8, 0x040201f4, 0x05f5f802, 0x07f608fc, 0x04f902fd, 0xfffdecf1, 0x070910ff, 0xf8fa14fe,
+    0xf812f0f8, 0x0304fafa, 0xf604fcf7, 0x02fdf9f8, 0x0808f3ff, 0x0602030e, 0xfae4ff06, 0x01f4f7fb,
+    0x0712fafb, 0x0afef4f6, 0x040000f5, 0xf6fbec09, 0xfff509f3, 0xf40e01f4, 0x03eff9ef, 0xf60903fb,
+    0x12fdf6fa, 0x0200ffff, 0x08f6fcf8, 0x06fc0b00, 0x05f705fd, 0xfc00f6f6, 0xf80705f9, 0xf4fa0dfe,
+    0xf80d04f8, 0x0706faf4, 0xf2f8fbf3, 0xf7fa03f9, 0x07070000, 0x0b12040a, 0xf4f8fdfb, 0xff0ffdff,
+    0xff1601fa, 0xfdfcfafc, 0x0a06f904, 0x0100f8f4, 0x00f704fa, 0xf1f9fc03, 0x03fb07fe, 0xff0703fd,
+    0x0bfbfcfb, 0x03020204, 0x090606f6, 0x000701ff, 0x07ff0700, 0x03fc01ff, 0xf905f7fb, 0xf9f8f106,
+    0xfe0705fc, 0xfefef9f9, 0xfdf9fefe, 0xf6fd07f9, 0x05080a07, 0x0d0d0106, 0xf406050b, 0x0217fcf8,
+    0xfb0f01fc, 0xf300fd00, 0x0405f708, 0x14fffbf6, 0x01fa02fd, 0xfa0bfe00, 0x07fe0f15, 0x04090605,
+    0xfbfc00fc, 0x000506f6, 0x040b0bfe, 0xf80efe0a, 0x06070304, 0x05fd05fe, 0x09fefaf4, 0xfdfde904,
+    0x0a0101fe, 0x03f7fefe, 0x0a01fd05, 0xf9fc0603, 0x0c050c00, 0x0efcf9f9, 0xf50c0e05, 0x0711fefd,
+    0xf800fafd, 0xedfefcff, 0x0100f906, 0x09fdf802, 0x01fefc02, 0xff1206fc, 0x03fe1314, 0x05030605,
+    0xeafeff05, 0xff0309f4, 0x010408fc, 0xf00ffa06, 0xff070300, 0x03fc00f6, 0x06fdfef3, 0x03ffef03,
+    0x06fffa01, 0x04ef0406, 0x0b06f206, 0x01fdfe04, 0x010201fc, 0x04f8fff8, 0xfa080c06, 0x0efe01fb,
+    0xfafbfbf2, 0xf6fbf9fb, 0xf301f809, 0xfcfef606, 0x0402f503, 0xfe140400, 0xfff50805, 0xff02f907,
+    0xf1fcf90b, 0x03070aee, 0xf6f804fc, 0xed080005, 0xfd02ff03, 0x02fffe02, 0xfdfb02f0, 0x02fdfeff,
+    0x04fdff08, 0x01070a09, 0x0a04f803, 0x0002f901, 0xfc03fd02, 0x01ee0100, 0x010a0607, 0x0602fdfd,
+    0xfbfd00f6, 0x06f9fd02, 0xff06fb01, 0xf305fc0e, 0x000efdff, 0x0a010dff, 0xfdfc08f3, 0xfe020403,
+    0xf7feff0c, 0xff08ffeb, 0xf1f70403, 0xf8060108, 0xf801fb01, 0x0804fcf9, 0xfffdfef7, 0xfcfbfd00,
+    0xfcf8ff0a, 0x0416080e, 0x0703fb04, 0x020efafa, 0xf4050507, 0x04f50007, 0xff01020e, 0xf9030201,
+    0xfd0dff02, 0x0df90004, 0x080e0207, 0xfd01ff0a, 0x000b0800, 0x08f507fc, 0x000401fa, 0xff07040c,
+    0xf700000f, 0x0307ffed, 0xf307040b, 0xfc0a0305, 0xf8ffec07, 0x080af8fa, 0xfd050007, 0xf7f9fb0b,
+    0x03f6fb0b, 0x0201060a, 0x0700fa07, 0x00f7f7fe, 0x01fafeff, 0xf6f90004, 0x0a03fffd, 0x050af703,
+    0xfe08f905, 0x0308fa12, 0xfb050006, 0xfcfe030e, 0x02f3f200, 0x070201f3, 0xf9ef0107, 0x09070cfe,
+    0x05f70100, 0x020d0e01, 0xf303fa03, 0xf5fdf7f0, 0xff08fd01, 0xfa0b0cfc, 0xed0004fb, 0x070a040b,
+    0xfb0b04ff, 0xfcfd030a, 0x0003fcf9, 0x06f60500, 0xfdfef7f8, 0xf4fffefd, 0x0f0a01fd, 0x1201fafe,
+    0xfdfff10a, 0x06f9040f, 0xf9040709, 0x00fe0008, 0x02f8f2ff, 0x0d0500ff, 0xfdf1ff04, 0x0afdf7fd,
+    0x02020405, 0xff0802fe, 0xedfdfb07, 0xf6fdf8fd, 0x01fefffc, 0xfa0a0804, 0xf4fafb01, 0x0d040505,
+    0xfe0c07fa, 0xffff000c, 0x0008fbff, 0x0afc0900, 0xf202fa03, 0xf8fa00f3, 0x1309fff6, 0x12f4f9f9,
+    0xfcf0fa01, 0xfd00ff08, 0xfe0003ff, 0xf5ff0205, 0x03fafff9, 0xfbf00603, 0x05edfffb, 0xfa0508f9,
+    0xfe09fd04, 0xfe0000fe, 0xf5f5fd08, 0xfc0100fc, 0x05060101, 0xfd07ff0b, 0xfbf9fc03, 0x0c0507fa,
+    0xef0a06fd, 0x0206fb0b, 0xfe07fbfc, 0x13f90300, 0xf203fc06, 0x0302ffee, 0x0804f9fa, 0x08eff800,
+    0xfcf7fb01, 0xf602fa01, 0x02fffcf3, 0xe602f90b, 0x07ff04ee, 0xf7ea01fe, 0x07f2f5f4, 0xfe0a01ff,
+    0xf90cfa03, 0x0004fafe, 0xfaee0307, 0x14fe05fa, 0x05fe0cfd, 0x0403eafb, 0xeef70101, 0x0c0206f0,
+    0xf80309fb, 0x020afe09, 0xf7fffd00, 0x02050302, 0xfa020802, 0x03fb00fd, 0xfdf7fbf1, 0x06f7faf9,
+    0x05fbfef6, 0xf402faff, 0x0102f901, 0xec07f60e, 0x03fc00ff, 0x00f901f7, 0x0ffcf4f3, 0x04090501,
+    0x02030202, 0xfd0b03fc, 0xf7fc02fb, 0x04fc0cfa, 0x04f906fd, 0x01fdeff4, 0xf3fe01ff, 0x080403fe,
+    0x010009fe, 0x00010007, 0xf8f6fd02, 0x010404fa, 0x020205fe, 0xfa010007, 0xfcfc01fc, 0x01fffff9,
+    0x06fcfdf8, 0x04fb0601, 0xff06fa03, 0xf008fa07, 0x0100fd06, 0x060204f6, 0x02fef7f9, 0x0cfd0100,
+    0x04fc0403, 0xfe0d03ef, 0xf6f9fcfd, 0xf7fa0701, 0x09f508fa, 0xfbfbf3f7, 0xf8f80008, 0xff060502,
+    0x02ff0300, 0x02fb0202, 0x09f50d02, 0xfa030100, 0x070109ff, 0xfaff020c, 0x01ffff02, 0xfc060105,
+    0x08f6fffe, 0x09fd0bf1, 0xf206f80d, 0xf40b0905, 0xff03fd08, 0x070c06fc, 0xfb0200f2, 0x11fe00fe,
+    0x09fc0208, 0x010606ec, 0xf5f5f7ff, 0xebf80407, 0x0cf70901, 0x00fdfbf5, 0xfafcff03, 0x0202fb06,
+    0x03050002, 0x02fc06fe, 0x0cfc0c04, 0x0600f508, 0x03fe1904, 0x01000213, 0x04000518, 0xf70609fc,
+    0x09ecf70b, 0x0df703ed, 0x0003fa05, 0xf0050103, 0xfd05ff0d, 0x020303fc, 0xf80405f7, 0x0ef70909,
+    0x05fdff0b, 0xfd0d06f2, 0xf6feef01, 0xed020302, 0xfdf20003, 0x0506fdf5, 0x07f60004, 0x0401f90b,
+    0x0dfd0107, 0x0cfa0303, 0x12060501, 0xfef70708, 0xfefa0100, 0xffff030b, 0x090303ff, 0x05fdfdff,
+    0x0efffd06, 0xfffb0dfa, 0x0f040502, 0xf60b0307, 0xf3000a07, 0x000af7f7, 0xfef40302, 0xfd07f703,
+    0x06fe0a0e, 0xf503fbea, 0xf80401f5, 0xfef7fd03, 0xff00ecfb, 0x0008fd04, 0xf6020606, 0xfdfe03fc,
+    0xf901fd01, 0xff0308fc, 0xffff0005, 0xfbf90006, 0xfa0203fe, 0x03020310, 0x05fe060e, 0x01fcf901,
+    0x030d0506, 0xffff0bf8, 0x050503fd, 0xf4070b04, 0xf803080b, 0x0205fcf7, 0xfdf90afd, 0xfb04fffa,
+    0x09000b08, 0xf60100ed, 0xf700fafc, 0x00fa02ff, 0x0bf9eeff, 0xfe04030c, 0xfd060402, 0x01fcfd05,
+    0xfbfd0304, 0xfd0103fe, 0xfd020603, 0xfdfcf704, 0xf805fe07, 0x0405010a, 0x02fe060d, 0xfc03f402,
+    0xfd0c0303, 0xff0005f9, 0x0102fef6, 0xf6fa1003, 0xf9050d09, 0x01fc02fb, 0xf9f80ff9, 0xfe01fef8,
+    0x04030705, 0x02fe09f6, 0xff03fbff, 0xfe04fe01, 0x09f7f0fd, 0x05040400, 0xff0c0101, 0x00faf801,
+    0x00000308, 0xfc0500f6, 0x06fd0007, 0xf505fe00, 0xf0050106, 0xfc02ff07, 0xfb060211, 0x020bf8fa,
+    0xf8ff0609, 0x000200fe, 0x0dfffef7, 0xf9f704fb, 0xfa030908, 0xfef80800, 0xff0008f9, 0x02fb00f4,
+    0x03030b02, 0x05f00bff, 0x0000fd00, 0x000501fd, 0x11f7f0fd, 0x03fe0302, 0x06090000, 0x00f9fb01,
+    0x05ff0009, 0xfb0401f1, 0x0af70008, 0xff03fcfc, 0xf404020d, 0xfe0000ff, 0xf706ff0c, 0x050102f7,
+    0xf40bfc0c, 0x0401fafd, 0x16fbf9ff, 0xfcfafdf3, 0xfb050a01, 0xf4f30304, 0xfb04fe04, 0xfafb0202,
+    0x00000000, 0x01ef1003, 0x0501fcfe, 0x0f09fafb, 0x06fbf300, 0x07010602, 0x0305fffa, 0xfef70302,
+    0x07fc0205, 0x000403f6, 0x05f60206, 0xfa05fcfa, 0x0700fd0b, 0x0709fe00, 0xf2030401, 0xfa0103f6,
+    0xf605fa07, 0x0503f802, 0x0ffafc00, 0xfbfdf2fa, 0xf9fb0104, 0xf601fb04, 0xfdfefa04, 0xfcfb0a04,
+    0x00ff01fd, 0x02f60c09, 0x070500fd, 0x0c00fcfa, 0xfdfff4ff, 0x06fc0afa, 0x030207f9, 0x04f605ff,
+    0x04f20402, 0xfcfd00f4, 0x07f702fb, 0x0702fdfe, 0x0501f908, 0x060601fc, 0xf70400fc, 0xfc020101,
+    0xf8130600, 0x0305fdfd, 0x0cfcfa04, 0xfcf9f308, 0xf5fbfe07, 0xf2fcfb07, 0x09fbfffd, 0xfef90501,
+    0x0301fbf9, 0xfdfb0b0a, 0x0702fefb, 0x0201fbf9, 0xf4fcf508, 0x0cf90a02, 0xff0806fb, 0x07f7fdfc,
+    0x07ed0500, 0x00fbf7f7, 0x03fa04f7, 0x1bf50001, 0xfef4fd02, 0x030507f9, 0xf801f00e, 0x03f907ff,
+    0xfc1f0f0c, 0x020900f3, 0x06f90102, 0x00f7fb08, 0xfd0801ff, 0xf503050a, 0x0efa0504, 0xfcfa040b,
+    0x03ffe7f2, 0xf5eb0909, 0x0705ff02, 0x060bfcf3, 0xef01f30f, 0x11000a11, 0xfb09fef6, 0x01f101fc,
+    0x11ee0004, 0x160beff8, 0x05ed08ef, 0x0f06fc05, 0x06fdfff3, 0x0efc0df6, 0x05000aea, 0x0bff00f1,
+    0x03fff80f, 0x02f60204, 0xfef7f8fa, 0xe802f701, 0x0900fe05, 0xf407fafc, 0x0706f602, 0xf508ff06,
+    0xf9050300, 0x0e01f4f9, 0xece1ee09, 0xef0411fc, 0xf0fafa03, 0x00f5faea, 0xfbe5fafd, 0x03fc0efe,
+    0xf7fd10f2, 0x05000902, 0xfc0c03e7, 0x19fc000a, 0x100007f0, 0x12f80afe, 0x03f60af1, 0x060300fe,
+    0x0e0afffe, 0xfc020dfe, 0xfef408f3, 0xdd05f105, 0x0605fcf6, 0xe20bfffd, 0x0bfef5f0, 0xf1030000,
+    0x050a0105, 0x0e03f7fa, 0x02eae704, 0xfb0114fc, 0xf8fdf60c, 0x0202f2ff, 0x09f8fa01, 0xfdfc17fb,
+    0xf40411fd, 0x040600ff, 0xfe03fbf1, 0x0af5fe0a, 0x240206f6, 0x14010808, 0xfff1ff0e, 0x0807ef0f,
+    0x030ffef8, 0xf70514fd, 0xfff50af0, 0xe9fdf00b, 0xfa07ffee, 0xdf01fd00, 0x05f4f3ef, 0xf9fe0afb,
+    0x0d0500ff, 0x0601f3fe, 0x04f5f401, 0xfcfa0dfb, 0x01f4f805, 0x0307ed00, 0x0dfef7f8, 0xfb0109f7,
+    0xf70a0a04, 0x0208f401, 0xfa00f7fa, 0x00fbfa05, 0x1101fa03, 0x14ff0305, 0xfbf4fc0f, 0xf00af819,
+    0xf706fffe, 0xf90a1307, 0x04f502ef, 0xfa05f80b, 0xf900fdf1, 0xecf4fbfd, 0x05faf1f5, 0x06fd04f8,
+    0x0eff01f8, 0x0104f902, 0x0005f907, 0x00fb01ff, 0x03ecfa03, 0xf805f4fd, 0x05fffdf8, 0x0002fbfb,
+    0x00080808, 0xfb05f3f6, 0xe7f6f303, 0xfbfafdfc, 0x05fff6fe, 0x030f080c, 0xf9ff000a, 0xe910fe0a,
+    0xf2fffe03, 0x01060307, 0x13fcfdf6, 0xffff0304, 0x03fdfcf5, 0xf7f6f7fd, 0x01fef6fc, 0x02fdf8fe,
+    0x00f8f8f6, 0xfc020006, 0x010a0700, 0x0103f6ff, 0xfbf3fd00, 0xfd02f600, 0xfaff0cf7, 0x020202fd,
+    0xff020e06, 0xfb03fdf1, 0xf0f5f203, 0xf30100fb, 0xf9fffdf7, 0xfffd0808, 0xfbfd0906, 0xfd060002,
+    0xfbee0103, 0x0304ff0b, 0x0e02f9ec, 0x020602fa, 0xff01f704, 0x00f8fafb, 0x00fe0706, 0x07fff805,
+    0x00f9f600, 0xf904fd0e, 0x000902fc, 0xf7fffbfb, 0x04f60309, 0x03fffb00, 0xf9fe14fd, 0x000308fe,
+    0xf8ff0d04, 0xfe0505f2, 0x04fcff04, 0xf50404fe, 0x00fc00fd, 0xf3fd040e, 0xfbfe0a08, 0x09fcfc08,
+    0x03fa03fe, 0x00050107, 0x100703ff, 0xf906f3f0, 0xfe0bfe06, 0xf9fffff4, 0x030111ff, 0x0301ff03,
+    0x00f8f506, 0xfa030204, 0x010f03f8, 0xf001ff04, 0x01070000, 0x07fb0308, 0xfd000cff, 0x0004f7fc,
+    0x00040701, 0x030606fc, 0x0503fe03, 0xf4fefdfd, 0x07fb0707, 0xf4fe050c, 0x01f90a0f, 0x0bfdf704,
+    0x02ff0704, 0xf802090a, 0x0a060f0b, 0x0107f9fe, 0xfe090105, 0xf2020002, 0x000a0bfc, 0x0607fa06,
+    0xfff6fb0a, 0xfbfe0700, 0x0112fcf1, 0xf9fffa00, 0xfb02f4fd, 0x00fd08ff, 0x02010a04, 0xfdfff208,
+    0x06fffcff, 0x04fc060e, 0x040705fa, 0xf1fc010a, 0x000ff80b, 0x02fe04f9, 0x0d0a09e4, 0x060c04f9,
+    0xf308f50b, 0x06f909fe, 0xf10d03fe, 0xfcf4040f, 0x0f0e03fa, 0x10fd0c14, 0x06fcf90b, 0xffedfefa,
+    0x0616ee07, 0x030001e6, 0xec0dfefe, 0xe506f809, 0x0310fdf2, 0x0b010806, 0x070ef2fc, 0x0ff1f006,
+    0x08fd19f1, 0x02030c02, 0xf8070efa, 0xed02f809, 0x0afffd09, 0x0905feff, 0x0b0904ec, 0x0b0e0df8,
+    0x030df605, 0xfbf905fe, 0xf9fb07fa, 0x07f8fd01, 0xff1001f6, 0x150a0413, 0x03fef913, 0x05eee9fe,
+    0x0010ef06, 0xff0302eb, 0xed02ecf5, 0xedfa0207, 0xfdfcfaf9, 0x0afbf905, 0x00eeeefc, 0xfbee0808,
+    0xfd0907f0, 0x04040403, 0x070118fa, 0xf706ed07, 0x0cf602fe, 0x0101f506, 0x05fc02f0, 0x0bfc0bfa,
+    0x0d0b02f7, 0xfdee03ff, 0x02eff901, 0xfefcf700, 0xf40ffef8, 0x0b14fdfb, 0xf9fdeb08, 0xfef9f1fe,
+    0xfb05fd06, 0xf9fff3f8, 0xfbfce6ef, 0xfef806f8, 0xfbf105f8, 0x02fcf204, 0xf9f9fcfa, 0xf8f71509,
+    0xf70af3fb, 0x02f7f508, 0x080118fe, 0xfcfff707, 0x13f801fb, 0x03fcf308, 0xfcfff4f7, 0x01f5fbfc,
+    0x0a0e02f5, 0xfdf9fef8, 0x00f7fdfc, 0xfefef600, 0xf30501fb, 0x0419f6f6, 0xfafcf904, 0xfbfafafc,
+    0x0afc0300, 0xfd00f403, 0x0100f4ed, 0x07fe0bf5, 0xf20005f9, 0xf904e8fa, 0xecf007fc, 0xf5fe14fd,
+    0xf104eefe, 0x04faeaff, 0x01fe08fe, 0xfafefbff, 0x110101fc, 0xf9f7f206, 0xfa00f8ed, 0xf4fefdff,
+    0x080808fb, 0xfbf5ff02, 0x03fffbfa, 0x03fb090c, 0xf50100fd, 0x0519f4f9, 0x00f60301, 0xf0fdfbfd,
+    0x09f80cfa, 0xfcfff404, 0xf506fdef, 0xff0507fa, 0xf8fe0107, 0xf902f5f4, 0xf6f40b04, 0xfc02fefc,
+    0xf3f9f4fe, 0x00fdf4f9, 0xfafafefb, 0xf9ffffff, 0x23050301, 0xfef2fcfd, 0xfc09fbf2, 0xf508fd0f,
+    0xff0400fc, 0x02fe0aff, 0x0607fafd, 0x06f50d13, 0xfff7ff04, 0x0b14f400, 0x05fb0b09, 0xfcf80406,
+    0x06fb02fa, 0x00fcfb00, 0xf50a06fd, 0xf1010203, 0xf8ffff01, 0x02fefffd, 0xfcfb1afe, 0x0305ee02,
+    0xfaf4ffff, 0x030202fa, 0x01f7fdfb, 0xfc03f808, 0x180303fb, 0x08edfb02, 0xf80003f1, 0xff05f710,
+    0xfcfefcf8, 0x02ff0b03, 0x0306fefb, 0xfdfb060d, 0x00fb010d, 0x0317fbfa, 0x01fe0008, 0x01fe0108,
+    0xf9fc00fd, 0xfe01fefd, 0xf806ff02, 0xf801fd02, 0x00ee03f8, 0x00ff00fa, 0x08f913fd, 0x010bf7ff,
+    0x02fc05fe, 0x000509ff, 0x02fa08fb, 0xfc02f9ff, 0x130602fa, 0xff00fefd, 0xfbf304f9, 0x09ffff08,
+    0xf605f4fc, 0xfafe0b04, 0x09fefffc, 0xf603040a, 0xfffe0707, 0x0715fcfd, 0xfbfd0500, 0xfefe070d,
+    0xf402ff08, 0xfd0002fb, 0xfefefbf9, 0x0800fd02, 0xfef308fb, 0xfdfefdf7, 0x00011003, 0xff13f205,
+    0xfbfffd02, 0x020b0505, 0x030200fb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x08060306, 0xf00ae8f8, 0xf5f200e4, 0x0d1301ff, 0x0606f516,
+    0xffe9f0fa, 0x041304f5, 0xfa041504, 0x05ff0c01, 0x060c0403, 0x180504f5, 0x0400f403, 0x05f5fd04,
+    0xfefa0507, 0xff08f4fa, 0x0202f406, 0xf7f1fd0a, 0x00060413, 0xf8f4f4fb, 0x02fa04fb, 0xfefe11fe,
+    0xf6020c01, 0xf70601fa, 0xfc02fc09, 0x0c02faf5, 0xe905f2f4, 0xf7e102e6, 0x1116faf8, 0x06eef110,
+    0x04ddef04, 0x020e08ea, 0xf5020c06, 0x0502fff9, 0xfe09f806, 0x11fd01f1, 0xf601f402, 0x02f409fc,
+    0xfc000103, 0xf907f90b, 0x00fef506, 0xf3ec05fa, 0xfe000209, 0xeafefff8, 0xf4f903f8, 0xfdfe18f2,
+    0xf4020904, 0xf80301fe, 0xf405fb02, 0x0503f5f2, 0xe207fdf5, 0x05df00ed, 0x110202f7, 0xfaf9e8fb,
+    0x01e5fc01, 0xfd0002f0, 0x0a00ff00, 0x0005fdfe, 0x000ef304, 0x01f102f7, 0xfe06fcfc, 0x01ec08f7,
+    0x0a00fa06, 0xf507f609, 0xfb0204fe, 0xf7f20509, 0x01fb02ff, 0xef0609f2, 0xf1f8fdfe, 0x000004ec,
+    0xfcf40505, 0xfeff04fb, 0xfbfef5fc, 0x00fff9f7, 0xec09fdfe, 0x0700fe05, 0x0ffb00f9, 0xef01eefc,
+    0xfff50703, 0xf0fa06ee, 0xfdfdfe0a, 0xf90407f7, 0xfd0f0100, 0xfaf70302, 0x09fdfbfb, 0x0af0fefe,
+    0x1100f905, 0xf301f8ff, 0xff030d06, 0xf8fafe08, 0x09fd0300, 0xfb0306f6, 0x03f9f606, 0x0201eeee,
+    0x05ed0605, 0x0602fcee, 0xfc00f700, 0xf509faf5, 0xf8040508, 0xf913ff0a, 0x08fe0900, 0xf705fcfc,
+    0x00060402, 0xf5f9fff6, 0xfcfcf803, 0xff010afb, 0x030f08fe, 0xfcff0407, 0x0af7fef8, 0x05f20002,
+    0x0802f505, 0xf703fef9, 0xfefc0902, 0x04fffc04, 0x0cf30203, 0x0205fefb, 0x0df9000b, 0xff01f802,
+    0x08ff0008, 0x06fefef4, 0x020202f4, 0xfd0101f3, 0x03fe0701, 0xfc07fe01, 0xfc010e00, 0x020303fa,
+    0x05000302, 0x000b0500, 0xfefff1f9, 0x01fefeff, 0x030a05ff, 0x05070c0f, 0xfd000300, 0xf8fb0601,
+    0xfefe0206, 0xfe0506fd, 0x000509fa, 0x02f9ffff, 0x08fcff03, 0x0705fcff, 0x07fc030b, 0xfe03020e,
+    0x02fc000a, 0x030408fc, 0x0807ff01, 0xfdff07f7, 0x00f707fb, 0xfd06fc03, 0xf7040203, 0xf20105f9,
+    0x02f30305, 0x0a0c0307, 0xfe05fcfe, 0x02fdfffe, 0x030502ff, 0x01f80703, 0xfb0b0d07, 0xf1f0fc02,
+    0xf9fa03fe, 0x05ff04fd, 0xf80608f8, 0xf7fe01f4, 0x06000007, 0xf406ff06, 0x04fbf706, 0x0202ff17,
+    0xfa02fc08, 0x02fa0aff, 0x08090202, 0x03fb0afb, 0x01f80e06, 0xf809ff02, 0xf50a0202, 0xf00203f9,
+    0x07fe0109, 0x0bfefffe, 0x02010001, 0xfb03fefd, 0xfdfe0105, 0xfe000600, 0xf6fe0a07, 0xebf1fd05,
+    0x01fcf9fd, 0x050101f9, 0xfa0a0af4, 0xf206fff4, 0xfc00ff09, 0xfa08060c, 0x0afff709, 0xfd06fd12,
+    0xfff6fd04, 0x04fc01f9, 0x10090306, 0x0b07edf5, 0xf90ffa09, 0xf80101eb, 0xfff903f2, 0x0a00faff,
+    0xf7e8ff04, 0x0cfff604, 0xf4010704, 0xf701fffc, 0x0dfd0504, 0xf30007f7, 0x0703f501, 0xfd050dfc,
+    0xfc08ff02, 0x0a07fdfd, 0x03fcff05, 0x0403ee00, 0x0df808fe, 0xf007f4ed, 0xfbfaf806, 0x0a0108f9,
+    0x12fa02f6, 0xf90204fd, 0xfa07ee0f, 0x0a0df0f7, 0xebfffa00, 0xf90702f7, 0x0204fdf7, 0x14f801f6,
+    0xf6eefcfe, 0x0300ee03, 0xf6030506, 0x03fbf6fa, 0x08fffb01, 0xf4f80cf4, 0x0004f808, 0x020a0efb,
+    0xff050101, 0x08fcfc02, 0x05050106, 0xf803f302, 0x0a0205f5, 0xfa00f2e9, 0xf800f703, 0x12fefd00,
+    0x0808fefb, 0xf8ff04fc, 0xfb08f200, 0x0405ecfa, 0xeffffc00, 0x010002ff, 0x0103fa09, 0x10fb04f4,
+    0xf4f2fc00, 0xfd02f901, 0xfd0601ff, 0x0bf7eaf1, 0x0000f2fe, 0xf8fe07f9, 0xff02f800, 0x0c040900,
+    0x01fff904, 0xfd0300fd, 0x02fd0707, 0xfc01ff01, 0x0105fff9, 0x01f9f7f6, 0x0204f9f7, 0x130102ff,
+    0x0e08fafe, 0xfbfc08fd, 0x000702f7, 0xfa09f204, 0x03fb07ff, 0xfdff0109, 0x02fd0304, 0x11000804,
+    0xf7f0fcf2, 0xf6f7fefc, 0x1303fff9, 0x02fef8f8, 0xff04ed0b, 0xf90304fc, 0xfc09fb04, 0x1005fb02,
+    0x00ff0005, 0xf607fbea, 0xe805f506, 0xf7fffc00, 0xfbfdf4f9, 0xfdfdf9ef, 0x040005ff, 0x0e0402ff,
+    0xfd0803f2, 0xfdfa0801, 0x030308fb, 0xfbfbf108, 0x0ef50f08, 0xf900040f, 0x07ff05fb, 0x02070a10,
+    0x04f1f3f2, 0xf5e9fafe, 0x1006f8f4, 0xfafd08f8, 0x0407ee0a, 0xfcff03f2, 0x030e000c, 0x0bffef07,
+    0xf8fffa08, 0xf20e06e4, 0xe10af503, 0xf0fcf6f9, 0xf5fef603, 0xfe03fefa, 0xfef80206, 0x0002fc01,
+    0xf5ff08f2, 0x00eb0401, 0x03000305, 0xfffcf408, 0x00f51106, 0xf7090110, 0x07fe0302, 0x05060117,
+    0x0a0bfaf4, 0xfff9ff0a, 0x0a00f9f8, 0x01050dfe, 0xff07f607, 0xffff07fc, 0xfd0e1006, 0x0bf80207,
+    0xfdfe0207, 0xfb0e12e1, 0xea15fcf7, 0xf4f402fb, 0xf3f3f80b, 0x010407f4, 0x00fcfc00, 0xf800ff06,
+    0xf900f6fe, 0x02fcff09, 0x09010b06, 0x0bfc020a, 0x0dfd0ffd, 0xfb010907, 0xfc01fc1b, 0xf5fefa0b,
+    0x0a0f01fe, 0x0dfd0200, 0x06f9ecf5, 0xfefd05ff, 0xfb08f707, 0x0a070306, 0xfa061803, 0x02f80505,
+    0xf9fb0106, 0xfc030ce5, 0xf40afff9, 0xf9ff0ef7, 0xfcf8ff09, 0x070308fb, 0xee0001f9, 0xfbf80706,
+    0xf4fef20a, 0x07f9ff06, 0x0d020800, 0x20f10202, 0xfdff1402, 0xfff80610, 0xfafe0413, 0xefff0104,
+    0x0a06fe01, 0x0cf9fa06, 0xfcf0f1f6, 0xf6fffffb, 0x020bfc0b, 0x0509f4fc, 0xfd010eff, 0xfff40507,
+    0xfe00020c, 0xf6070ee9, 0xfc05fdfc, 0xfc060df3, 0xfaf5000d, 0x080c07fb, 0xf5fe01ff, 0xf9ea0304,
+    0xf9fcef08, 0x0cf30004, 0x11fc0802, 0xff010106, 0x16f3f4fc, 0xfdf9fb01, 0xfdf90f11, 0x0606f0fc,
+    0x080605f1, 0x04fffe03, 0xfbfdfc02, 0x07fdfb0f, 0xff00f3f2, 0x0518f5fd, 0x09fef801, 0x0dfffe00,
+    0xfa13fbfb, 0x080c07fc, 0xfafdfefb, 0xf6041000, 0x000201f9, 0x02fcf7ff, 0x02f900f8, 0x0bf91004,
+    0x030b05f3, 0xf603f504, 0xfdfbfef8, 0xfe04f90b, 0x23f3fafc, 0x03fd000b, 0xf9eefe04, 0x0e03f402,
+    0x060afdee, 0x00f4effa, 0xf8fcfd01, 0xfd01fc09, 0x0005f5ea, 0xf91fe900, 0xfb03f1fc, 0x0104fefb,
+    0xfc0bfd02, 0x070afd0b, 0xfcf404fa, 0xfefb11f0, 0xfa0207fc, 0xfc03eb06, 0x00f8fdff, 0x04f912ed,
+    0xf90efaf2, 0xfff8e505, 0xff02f801, 0x0006030e, 0x23fdf0f9, 0xf2f50109, 0xe6faeffc, 0xfc07ebfc,
+    0x02fffdf9, 0x08fdeefc, 0xfd04fd00, 0xfc03f9f1, 0x020601ee, 0xf410e806, 0xf9fcf3f9, 0x06f9fcfb,
+    0x02ff00fc, 0x0100ed11, 0xfe000a0b, 0xfcfc00f7, 0xfdfe04f9, 0xf803f3fd, 0xfcfdf705, 0xfffb01ed,
+    0xfc0002fa, 0x01f9f4fe, 0xecfffe02, 0xfd010a07, 0x1903f905, 0xf1fa06fe, 0xf10afefb, 0xed11fb0e,
+    0x00f90002, 0x06fb0901, 0xffffff11, 0x030304fc, 0x05f300f9, 0xf604ec11, 0x02fffd04, 0x0afa0503,
+    0x0500fcf9, 0x0200f7fc, 0xfe05060d, 0xf4fbf002, 0x03fc09fc, 0xf30305ff, 0xf5f80403, 0xfefff407,
+    0xfcf308fa, 0xf6f604e6, 0xedfcf8fb, 0xf300ffff, 0x060202fe, 0x00fd0207, 0xfd07090b, 0xf5120211,
+    0xf9ff0507, 0x02fd0500, 0xfdfe0607, 0x07fc010b, 0x06f5ff00, 0xfa0afb0a, 0x04f60107, 0xfefb030d,
+    0xfdff00fe, 0x010503f3, 0xfc05fc01, 0xe6fef502, 0x09f309fc, 0xf70404f5, 0xf8f40ffd, 0xfb02fe0a,
+    0x04f5fbfe, 0xfffb0ef7, 0x03fc03fb, 0x00fdf304, 0xf603fd03, 0x00f9fc05, 0x08fe0a0c, 0x0902fd07,
+    0xfbfcfc06, 0xfaff0500, 0xf9000402, 0x01f80106, 0x0508050f, 0xfe0b02fe, 0xfefb07f6, 0xf9fafc08,
+    0xff040209, 0x040801f6, 0xf5fffd00, 0xe6fe01fa, 0x01f50b02, 0xff02f9ee, 0x00fc08f4, 0xfb030606,
+    0x0909f603, 0x02040bfe, 0x09fd0301, 0x0005fd01, 0xe7060803, 0x00f5ff07, 0x07fd0505, 0x06fff6fd,
+    0xfa030800, 0xfbfc0501, 0xfc06fd05, 0x02010204, 0x00110b04, 0x03050507, 0x020107fc, 0xf8fefa04,
+    0x0006080f, 0x050605fa, 0xf5fafe08, 0xf3060303, 0x000109fe, 0x0006f4f8, 0x0704fef9, 0xf6010307,
+    0xfc01f808, 0x010f1007, 0x0704f605, 0x0b090406, 0xf4071500, 0x02fa0103, 0x0509fe05, 0xfafffbf7,
+    0x04060902, 0x0a05fd01, 0x030dfd05, 0xfbf80bfd, 0xf60e080f, 0x09fa020b, 0x01010702, 0xfafd0104,
+    0xfeff0312, 0x00070005, 0xfcfefeff, 0xf90704fe, 0xfd0101fd, 0x0608f000, 0x0901f006, 0xee00fc08,
+    0xf9f8f40c, 0x00110905, 0x0a08f40c, 0x0705f501, 0xfa0ef8ff, 0x0611fd0a, 0xf7f4fffb, 0x01040207,
+    0x06fa0cf6, 0x02fcff0e, 0x01000806, 0x030c03f0, 0x0c0cf801, 0xf0fef000, 0x0800eef5, 0x06f4fdfc,
+    0x0800fb06, 0x0104eff2, 0x03fef908, 0xfc050f00, 0x0502020f, 0x03feebf6, 0x03ff03fc, 0xfc01f7fa,
+    0x070cfbfa, 0xf5fef502, 0xf409f912, 0x020a00fc, 0xf504effe, 0x0107fdfb, 0x0103ff05, 0xf2faff10,
+    0xf2f70cfa, 0xf90304fc, 0x0b03060a, 0x080b04f2, 0x020aef0d, 0xfafcee03, 0x0310f6ee, 0x11f8f9f9,
+    0x0afbff08, 0x0005f2ec, 0x01fafa06, 0x02fe0305, 0xfe00010c, 0xff04ec03, 0x07031500, 0xf5fcf5f7,
+    0xfb08fff9, 0xf101fcf8, 0xfc0cec0c, 0x010100fa, 0xfdfdf1ef, 0xf109f8f2, 0x0b090112, 0xee01f713,
+    0xf3f90502, 0xf30901f1, 0x130302fe, 0x0b060101, 0xff09f914, 0xfdfff4f9, 0x020df8fa, 0x0d06f4fc,
+    0xfbf00601, 0xfa03fbf8, 0x04f7fd04, 0x02faf7ff, 0x02000004, 0xfd09f902, 0x0ffb1bff, 0xf0f8fef7,
+    0xf5ff0700, 0xee0505f8, 0x00feecf9, 0x0af902f7, 0x07eef7e8, 0xfbfbfbf7, 0x1301061a, 0xf6f9ef11,
+    0xfb02fa06, 0xfb0affeb, 0x010503fd, 0x07ff020b, 0x0204fd0d, 0xf3fffafb, 0x0604f307, 0x0506f500,
+    0xf3fb06ff, 0xfc0009f5, 0x08fafa04, 0xf6fcf8fb, 0x02070203, 0xf00a0e03, 0x06f81103, 0xf7fc0505,
+    0xf2ef0efd, 0xf7040cf9, 0x00edf2f8, 0xfff705f8, 0x07f200f8, 0x0102f807, 0x0a020817, 0x0200f509,
+    0xfe1200ff, 0x0408fcf9, 0xe60607ff, 0x01fd020f, 0x000400f6, 0xf60eff07, 0x07f8f500, 0xf70aff03,
+    0xfc0708fc, 0xfdff0af4, 0x0c050401, 0x00fffff8, 0x03050105, 0xfe0609fb, 0xfaf7fefb, 0xfa00ff11,
+    0xf9f10e02, 0x00030703, 0x03f6f5f6, 0xfefc08fd, 0xf9020200, 0xfe02f80b, 0x01040312, 0x0002f807,
+    0xf8080204, 0x0504faf8, 0xe2010102, 0xfefb0902, 0xf705fbef, 0x050dff06, 0xfef6f800, 0xfb0d0605,
+    0x020903fd, 0xffff05fb, 0x07ff0205, 0xfe010602, 0x07040204, 0x03ff03f9, 0xfdf6f907, 0xf803f818,
+    0xfa010101, 0x05fb0105, 0x03fcf9fb, 0x02fc04fd, 0xf0060302, 0xfcfcfa09, 0x000ffd13, 0x0307f3ff,
+    0xf7060303, 0xf902f9fb, 0xe701fefd, 0xfbf80a09, 0xf408fde7, 0x0d0f0500, 0xfcfb0105, 0xfa050a03,
+    0x030601f9, 0x06fe0701, 0x0bfb0bfe, 0xf704fd04, 0x03020406, 0x02fd0eff, 0xf7fff706, 0xfe01f920,
+    0x0502fd05, 0x0dfef5ff, 0x0802fdff, 0x02fb0704, 0xfa05fffc, 0xeffbfd00, 0x0103030b, 0x0702fbfd,
+    0xf2040000, 0xeefdfaf7, 0xf6faf9ff, 0xfff90602, 0xf507fef8, 0x0d0605fb, 0xf8fefb07, 0xf6fe0404,
+    0xfc0402fe, 0x04030400, 0x06ff06fd, 0xf4fef700, 0xf9010306, 0xfffd0bfe, 0x0004ef07, 0xff00fb1c,
+    0x0406fd04, 0x11faf3fb, 0x070806f7, 0x06fa0a01, 0xfbfa0bfd, 0xfefd0111, 0x02f8e915, 0xe30003f9,
+    0xf50af7fd, 0xf6fe0208, 0x0cfff707, 0x06fbff13, 0xf9ec05ff, 0xec0907ff, 0xf410eafd, 0xfffff603,
+    0xf90008f6, 0x03fcfb0a, 0xfd0001f8, 0x17f3f904, 0xf608fdeb, 0xfeff0602, 0xff01ecf2, 0xfbe4fafa,
+    0x05f8f5f9, 0xf70100f0, 0x0ef80200, 0x040300fc, 0xffff04fd, 0xfd04ff1b, 0x02f4eb0f, 0xe400fef7,
+    0xfc10fc04, 0xfa03f806, 0x04fff70d, 0x0104070e, 0xfdf1fe01, 0xe7fb0206, 0xf608e4f8, 0x0403eefe,
+    0x000100f7, 0x03fa0111, 0x03ff01fc, 0x1eecfb02, 0xfb0efff7, 0x00fb040b, 0x0306ecf2, 0xfbedff04,
+    0x09fbf6fd, 0xf80601f8, 0x0aef0500, 0x0308fef3, 0x03ff06fa, 0x03090015, 0xfb05f40e, 0xe604f2fb,
+    0xfc140405, 0x0401f6fb, 0x0c03f508, 0x060907fc, 0x03eefc02, 0xed03fa04, 0xf7fee7fd, 0x0909f90b,
+    0x0c0000fb, 0x01fc0307, 0x0509ff06, 0x13f5fe00, 0xff0dfef7, 0x05f901ff, 0x0004fcfb, 0xfcf0fb04,
+    0x080100fd, 0x010203f8, 0x0cfe0702, 0x0404fbf4, 0x07fe0b05, 0x0705f70a, 0xf90cfc0c, 0xe006f906,
+    0x0108fe02, 0x08fcf1f6, 0x0f02fe05, 0x0a0706f6, 0x03e9030c, 0xf308f400, 0xf900e906, 0x0d0bfa0d,
+    0x07f9fffa, 0xfefc04fd, 0x060cf708, 0x0503fdfd, 0xfa0afef8, 0x09fb07ef, 0xfc080105, 0xfceafe00,
+    0xfffefe00, 0xfffbfff5, 0x07010402, 0x03f70204, 0x01fb0115, 0x02fdfe02, 0xf407fe0b, 0xfa000103,
+    0x0408fefb, 0x0afcf3fa, 0x04060406, 0xfbfe08f5, 0x07ed080c, 0xf906ff03, 0xf603f809, 0x050df80c,
+    0x04fc09f8, 0x08f70104, 0x080c000e, 0x05050503, 0xfa09fff6, 0x04f70ef4, 0xfe08fd02, 0xfbf600f2,
+    0x0108fb03, 0xfe0100f9, 0x02fffd08, 0x0af50706, 0xf803040f, 0xff030106, 0xfb08f614, 0xff050504,
+    0x070b00f9, 0x0cfafdfd, 0xff090b0b, 0xfb030305, 0x0af40d08, 0xf3f80606, 0xfb0df804, 0xfd0ff10f,
+    0x01fc09fd, 0x06f80506, 0x0703ff08, 0x0f0704ff, 0x01090001, 0x05fb11fe, 0x0101fdfa, 0xf8eb01e5,
+    0x110bfc04, 0xfc03fb02, 0x04f8f809, 0x0b060bff, 0xf508000b, 0xfefcfc05, 0x0308fd11, 0xf7060401,
+    0x090afbf1, 0x0afa06f9, 0xf70a0108, 0xff02fe11, 0x10f1070d, 0xf7f60707, 0xfe0afa02, 0xff0bf905,
+    0x02ff08f8, 0x06050507, 0x0407fb06, 0x16010602, 0x080b060c, 0x0afc0ef9, 0x0efbfcfb, 0xfee308e7,
+    0x0e0d0402, 0xfa030302, 0x02f6f50b, 0x020c0af9, 0x00090404, 0x08fffd05, 0x04050012, 0xf5080001,
+    0x0a1300f0, 0x0cfc06f3, 0xf5090e06, 0x0509000b, 0x02e9060c, 0xfdfd030a, 0xfd06eb08, 0x070c04f2,
+    0x05fb08fa, 0x08020805, 0x050cff09, 0x180309ff, 0x090d0307, 0x16ff09f4, 0x09fa00f9, 0xfcd710f6,
+    0x05100b04, 0xf70307f8, 0x01fdf208, 0xfd03fbfd, 0xfa05f1e3, 0x0a01f0fd, 0x00fd04fc, 0x01fdf809,
+    0x000bfa03, 0x0608fbf8, 0x03f602fd, 0x06fefff6, 0xff08ff00, 0x0206f6fd, 0x04030e02, 0x09f903f9,
+    0x03fe0307, 0x080dd7e3, 0xfffc01f9, 0xfbf9ff04, 0xfb0101fa, 0x0705f502, 0x030a0108, 0x04fb0203,
+    0x04ff09fb, 0xfa0800fb, 0xfb03fd09, 0x03fdfefd, 0xf302f3da, 0x0df4f2fd, 0x02ff01fc, 0x09f9f611,
+    0x0002fafe, 0x010905fa, 0x03f7fd04, 0x09fe04fd, 0xfb09f701, 0x0809f8fd, 0x02020bfb, 0x06f80401,
+    0x04020409, 0x030ad9e0, 0xf6f7fdf9, 0xeef4fefc, 0xff0000f8, 0x0408f80c, 0x02000205, 0x04f8000b,
+    0xf70304fc, 0xfa05fe01, 0xff01f8fc, 0x09f7fa00, 0xeafef6dc, 0x00fbf1fb, 0x05fe04f5, 0x09f7fc0b,
+    0xfe03f704, 0x020a04fc, 0xfffbfc08, 0x07ff0703, 0xff0cf1f5, 0x0f04f405, 0x04fc04f9, 0x0bfb0105,
+    0x0407ff0b, 0x040cdddc, 0xfd01fefb, 0xeef800fa, 0x01fdfefa, 0x0507f608, 0x00000402, 0x04f9fd0d,
+    0xf90101fe, 0x00030105, 0xfbfef8f1, 0x05f5fc00, 0xe9fd00d8, 0xf901f1fb, 0x06fc09f6, 0x0b0101fd,
+    0xfd09ff04, 0xfe05f905, 0xfdf9fe07, 0x08080909, 0x0212fbee, 0x0bfff40d, 0x08f801fc, 0xfffd0008,
+    0x070afd08, 0x0602dbd9, 0x040604fd, 0xf00501fd, 0xfcfbfefb, 0x0506f502, 0xfc0402fb, 0x01fbfc0a,
+    0x03030700, 0x0502020c, 0xfdfa04f0, 0xf4fc0001, 0xf2f9fadd, 0xf70aeeff, 0xff000700, 0x07070aef,
+    0xff0d04fe, 0xfcfff405, 0xfffbf609, 0x090b0504, 0x050efef0, 0x09fbf305, 0x08f90402, 0x01040a06,
+    0xfe07fe05, 0x0800d7eb, 0x090009fc, 0xf207fc03, 0x01f5fcfe, 0x0402f204, 0xfafe01fc, 0x00fff702,
+    0x00020304, 0x0500fe09, 0x03fe00fe, 0xfcfc02ff, 0xf8fc04d9, 0xf906e902, 0xfd01060d, 0x01fdfff6,
+    0x0605fe01, 0xfffdfefe, 0x04f9f9ff, 0xfe06f8f8, 0x0305fbfa, 0x01f4f6ff, 0x05fd0af9, 0x00fb0806,
+    0x03fefafe, 0x0201d5fe, 0x08f80601, 0xf703f404, 0xfdfafd02, 0xff03e406, 0xfdfa07fb, 0x0002fdfb,
+    0xfd09fc04, 0x06fcff04, 0x0301fd01, 0xfc04ff01, 0xfeff0bd5, 0x05fce208, 0xfc000904, 0x04f4fa05,
+    0x07fd0101, 0x040206fe, 0xfdfbfbfa, 0xfb01f2f1, 0x0602f1f8, 0xfcf5fdfd, 0x02fd07eb, 0x06fe0506,
+    0x03ff0102, 0xfe05d1f6, 0x04f400ff, 0x03fef803, 0xfdfc0301, 0xfe03e5ff, 0xfff70bf3, 0x0302fefe,
+    0x0409fe03, 0x09f90106, 0xfc05f5fc, 0xf701fffe, 0xfa000adc, 0x0afbe806, 0xfbfc0d06, 0x08f4fe0c,
+    0x030401fd, 0x03040bf8, 0xfafefd03, 0xf604f8f5, 0x0701f9f3, 0xfcfcfffb, 0x09fd09f4, 0x09030002,
+    0x0701070a, 0x0402d6e6, 0x02f80500, 0x00faff09, 0x0104f8fc, 0xff01e8f7, 0x02fd08f3, 0x0c0305fa,
+    0x00050307, 0x03020408, 0xf703f1fe, 0xf1fbec03, 0x0e02f40d, 0x01050806, 0xfbfcfe12, 0x0811010c,
+    0x0d00ff04, 0x02150a02, 0xf60e0004, 0x02010603, 0x0a05ea09, 0xf810fdff, 0x00f5f8fd, 0x150600fc,
+    0x00f902fc, 0x09f61013, 0xf6fcf407, 0xf5040503, 0x09f8fc01, 0xfb09f5f4, 0x07fe1403, 0xf6fcff04,
+    0x0efef209, 0x0003f705, 0x0003f5fd, 0xee04f1fd, 0x03fbec04, 0xf9f80404, 0xf7fbfc11, 0x04060501,
+    0x04fbfc02, 0xff14fb02, 0x0b09fdfc, 0x04ff080a, 0x08fff101, 0xf70c06f8, 0x07f805f9, 0x09fd09fd,
+    0xfb070101, 0x06f31707, 0xf2e8fe10, 0xf705fe0f, 0x08f5fdff, 0xfe08f0f0, 0x06fd16fe, 0x01fafefa,
+    0x07fcfd07, 0xf90200fe, 0xfb06eef7, 0x0306faf7, 0xf100fb03, 0xf001fef9, 0xfefcff01, 0x03f70c05,
+    0x03fcff02, 0xfe0cfcfa, 0x030c02f5, 0x00fb0305, 0x0204f403, 0xfdf905f7, 0x05fd08fb, 0x0bff07fd,
+    0x0000fb03, 0x05f80dfd, 0xf8eeff0b, 0xf204000a, 0x05fefcfe, 0xfa0bfcf5, 0x05041200, 0x04fd04fc,
+    0x07f3ff05, 0xfc0009fa, 0xfc06e6fa, 0x0801fdfd, 0xf6010203, 0xfe0a04fe, 0x10fa0803, 0x06fb0e0b,
+    0xfe0101ff, 0xfd0b04fc, 0xfc0d00ff, 0xf6f20806, 0xfd08fb02, 0xf70307f7, 0x0aff03fe, 0x0efef9fe,
+    0x0603f309, 0x06040feb, 0xf5fafc02, 0xe6fffc08, 0x00f6fd00, 0xfe0500f5, 0x05000306, 0x020302fb,
+    0x05ff0200, 0x010208f5, 0xfb04effc, 0xfcffee01, 0xf5ff0905, 0xf90c0106, 0x0f03050d, 0x07fe070a,
+    0xf9050002, 0x010209fd, 0x00ff06ff, 0x01f10712, 0xf409f7f4, 0x0c110b04, 0x0afbfdfd, 0x03fff9fb,
+    0x0003fc06, 0xfd0614e4, 0xf804fb00, 0xfafc0606, 0xfcf8fd00, 0x02ff01ef, 0x0bf8fdfc, 0xfe06fe02,
+    0xfe0901fe, 0x07f90503, 0xf9fffd03, 0xfcfef502, 0x07000905, 0xf90a040b, 0x0ffd0311, 0x0803fdff,
+    0xfc05fe03, 0xfc050b05, 0x0cf80104, 0x10f5021c, 0xfe0cf9ee, 0x14130d09, 0x03040502, 0x00fc02fc,
+    0xfd02fa03, 0x000910f3, 0xf902fef7, 0x03f60605, 0xf700fffb, 0x04fd05f8, 0x0bf9f5fa, 0xff040406,
+    0x000601fe, 0x0afb030a, 0x02fd0603, 0xfe00ff07, 0x0afefe07, 0xfd000508, 0x08feff0b, 0xf903f1f8,
+    0xf7000008, 0xfd0103ff, 0x17f3f9fe, 0x16effa0b, 0x0006fdf9, 0x090e0ff9, 0xfbf3040b, 0xfff1fcfd,
+    0x0806fbf8, 0xfc050ef2, 0xfc0702f7, 0xfffb05f8, 0xff020600, 0x02010dfd, 0x02fefbfa, 0x0b00fdfc,
+    0xfdfffd01, 0x08fff4fc, 0x02fb0402, 0x00f7f805, 0xfff903ff, 0xfd06fdfb, 0x0402feff, 0xf002f2f8,
+    0xf7f7ff08, 0xfff7fafd, 0x0bf1fd00, 0x0de003fb, 0x02fe09f8, 0xfc0107f5, 0xfff5fe06, 0x02f50104,
+    0x030bfaeb, 0xf3060ff5, 0xfb0602f4, 0xfa0104f0, 0x02f108fc, 0x09070b01, 0xfaf7f300, 0x0c03f700,
+    0xfef6f704, 0x0df6eaf0, 0xfff909ff, 0x0df50d05, 0xfefc01fd, 0x1006fc0e, 0x0b08fe10, 0xfd060006,
+    0xf1120109, 0xe00801ff, 0x02fc09ff, 0x0ffefe05, 0xfdff0df6, 0x040bf602, 0x0f0b0409, 0x0b04f805,
+    0xef01f606, 0xfb0efcf9, 0x020103f5, 0x0df101f8, 0xed04f807, 0x04fc04fe, 0x010005f7, 0xfc03f70d,
+    0xf9f4fef5, 0xfc01f5fe, 0x0b030af8, 0x00f809fe, 0x0efefbf9, 0x0efdfd0a, 0x0504fa0a, 0x03fbf4fe,
+    0xf91fffff, 0xf30000fe, 0xfefdfffc, 0x15f7fe07, 0xfe0409f7, 0x0c0ffc03, 0x12000115, 0x050cf700,
+    0xf2fc0200, 0xf70afcf5, 0xff03fbeb, 0x08f901fe, 0xf309fa03, 0xfafaff02, 0x08000403, 0xfc06000b,
+    0xfcfd01fc, 0xfcfcf3fe, 0xfdf70bfd, 0xf2fcfdf9, 0x04fdf1f4, 0x0afbf8f9, 0x02f80201, 0x09edf906,
+    0xf507ff01, 0xf80202f6, 0xfe00f6ee, 0x06f60405, 0x0001f9f7, 0x0afef8fd, 0x06fe0503, 0x0b05fffd,
+    0xfdfd0300, 0xfa02fee7, 0xf4f8f4fc, 0xf6f50aff, 0xff01f704, 0xfefd02f3, 0xfaf71200, 0xf4fff711,
+    0xf301fcfe, 0xf903fafd, 0xf6f8f7ff, 0xfd01f8fc, 0xfe04f5f1, 0x0cf9fefd, 0x02f80a01, 0xf8fa00f4,
+    0x02fbfb04, 0xfdfc0bee, 0xfd01f6f3, 0xfcfeff08, 0xfefaf6f4, 0x08fef4f5, 0x0005fefa, 0x00f90601,
+    0x0b0704fd, 0x000705e0, 0xf0fcf9fc, 0xf4f614f3, 0x07f8fa03, 0x010202eb, 0xf7f40efb, 0xfcfbff08,
+    0xff07f7ff, 0xfc04fbf4, 0xfbfef9fd, 0x0403f508, 0x000703f9, 0x0401fc06, 0x08fa0601, 0x0bfb01fa,
+    0x0ffefa06, 0x05f80beb, 0xfc02f9fd, 0xfe00fe05, 0xfc06fcfc, 0x02fffc01, 0xf707fefc, 0xf7fd08fd,
+    0x0b0c0809, 0x070ffefe, 0xfb070305, 0xf7ff0df3, 0x09040106, 0x02050dfc, 0xff0201fe, 0xfdfa02fd,
+    0xfe090801, 0x020afdfa, 0x03070206, 0x0102fb09, 0x010c02fc, 0x0003ff0d, 0x08fef804, 0x07f8f800,
+    0x070ffe02, 0x070207d9, 0xf006f3ef, 0xfc0008f8, 0xff11f2fd, 0xfae8ff05, 0xfafd0aff, 0x00010ffb,
+    0x03080907, 0x0806f30d, 0x06080908, 0xfb0303f6, 0xff040608, 0xfd030205, 0x08fcfa05, 0xfcf7fdf5,
+    0x01ff0b08, 0x01fdfcfe, 0xfe01fa01, 0xfcfefef5, 0x07050cfc, 0x0d02ff0f, 0x000afe13, 0xf2fcec10,
+    0x00070709, 0x020b07f2, 0xef04fbf7, 0xf90201f1, 0xfd02fe01, 0xf5f1fcf9, 0xfa0009fe, 0x06fb07fb,
+    0x0aff0902, 0x09050505, 0x01ff0b08, 0x0102fe09, 0xf804fffb, 0xfd04f8fb, 0x02fafb01, 0x03fdf70d,
+    0xfaf80609, 0x00fc03f7, 0x02f4faf7, 0xfaf502fb, 0x03000503, 0x0901ef08, 0xfd030813, 0xedfff00e,
+    0xfe02fc04, 0xf9080ff4, 0xfe04fe03, 0x09fe03f3, 0xfff402fe, 0xf8fcfcf8, 0xf70a0201, 0x04fd0100,
+    0x0cff05fe, 0x000506fb, 0x070d020c, 0x05fdfffa, 0xf8070004, 0x0005f9fc, 0x0afb06f8, 0x0400f80c,
+    0x05f30109, 0xfdfa04ff, 0x0cf2f6f9, 0xecfff603, 0x090a0403, 0xf9fefb04, 0x0dfd0f04, 0x0ef5fa04,
+    0x04f3ecfa, 0xfafff700, 0xf4090dfb, 0xfafa0407, 0x111af903, 0x0a031afb, 0x0cfc0300, 0x00f803fb,
+    0x0016ff0a, 0x060105f8, 0xedf6fcfb, 0xec07040f, 0x00030604, 0x04030003, 0x0d020404, 0x14fa060e,
+    0x000a07fc, 0x03080c12, 0x010808fb, 0xec0001fa, 0x09010200, 0xf709f701, 0x0f00fafb, 0x06f2fe06,
+    0xfbfdeafd, 0xf703f7fb, 0xfc0009fd, 0xfffc0003, 0x030ffefe, 0x07030c02, 0x00fe0509, 0xf9fc0105,
+    0xfb0cfd05, 0xfbfd0900, 0xfa00f8fb, 0xf6fa00f8, 0x030104ff, 0xfbfff801, 0x0b0005fc, 0x06ff0114,
+    0xf80903f9, 0x03030305, 0xff040dfa, 0xf601f8f9, 0x03ff0605, 0xfa05fe00, 0x00f8f902, 0xfa00fe0c,
+    0xf8fff806, 0xfe08fe00, 0x0afe0103, 0x07fdfdfc, 0xf9030104, 0x0408fffa, 0xfc000307, 0xf9fffc0e,
+    0xfd05ff00, 0xfafd0601, 0xfb0204f8, 0xfcf9fff4, 0x04020afe, 0xfd04f3ff, 0x00ff0704, 0xff04fc18,
+    0xfdfa03f9, 0x030400fa, 0x030600fd, 0xfc00ff02, 0x03020200, 0xfcfcfe07, 0x01fdfd02, 0xf901f60e,
+    0xfd050300, 0x0000f503, 0x0bfe07ff, 0x05f60101, 0xfc03fd03, 0x0c0af7f9, 0x0200020a, 0xfa01fd03,
+    0xfefa05fd, 0xfefb01fb, 0xff0103fb, 0xf8fffffa, 0x06fa0ff9, 0x0101f7fd, 0xfdfe0e00, 0x0308fe0b,
+    0xfef7fff8, 0x00ff00f9, 0xfe01fb00, 0xfb05fe08, 0x03010106, 0xf9fa0502, 0x03ff0009, 0xfc00f80b,
+    0x00030407, 0x0400f50c, 0x06fa0303, 0x07fe04fc, 0xfb00fdfc, 0xfe05fffa, 0x03fafa08, 0xfc01ff04,
+    0xfdfc04fe, 0xfcfb0dff, 0xfcfefcf7, 0xfa04fdf9, 0x01f40afe, 0x0000f7fb, 0xfdfe08fa, 0x0109fb09,
+    0xfffdfdfc, 0xfff9fbf9, 0x0102fcff, 0xf705fa05, 0x03fd0601, 0xfdf906fb, 0x0201050d, 0x0007fc09,
+    0xfb0006ff, 0x01fcf60a, 0x000107fc, 0x02000404, 0x030200ff, 0x0000fdfd, 0x06fc0006, 0xfd00fffb,
+    0xfc010700, 0xfdfa0803, 0xfb01f9f9, 0x0206fefe, 0x00ef0303, 0x06fef3fc, 0x00fc04fe, 0x0607fd02,
+    0xfefefdfd, 0xfff7fcfa, 0x0906f805, 0xfa05fd03, 0x05000203, 0xfff90c00, 0x08010b0a, 0xfe04f409,
+    0x04040403, 0xfa0c05fe, 0xfbfe00ff, 0xfb05060a, 0xfefb00fa, 0x030400fb, 0x0801fdfe, 0xfcfb0500,
+    0x020407fe, 0x02fd1304, 0x01fefc07, 0xff01ff02, 0xfbf30004, 0x0300fc04, 0x08010403, 0x0502fd01,
+    0xf802fe02, 0xfd0000fa, 0x010a0402, 0x0701fd01, 0xfc06f408, 0xfc0109fd, 0x08fa09fc, 0x05fbf709,
+    0x080f05fe, 0xfb0c06fa, 0xfc0005f8, 0xf80404fe, 0xfefdfcf8, 0x03010103, 0x05030003, 0x03f90a00,
+    0x05010100, 0x06f90c09, 0x07fe0103, 0xfef8fc03, 0xfffafffa, 0xfcfdfd09, 0x0705ffff, 0x03fd03f9,
+    0xfd03fe07, 0xf91003f8, 0xfe09feff, 0xf7f7f9fc, 0xfb04f304, 0xfdfd0309, 0x0d010ff6, 0x0f02f706,
+    0x0109fe06, 0xfb020902, 0x030504ff, 0x0af50409, 0x03170f07, 0x01f5180b, 0x0bfa000c, 0x07faffee,
+    0xfd070908, 0x0303fdef, 0xf20e01f6, 0xeafa090e, 0x06ff0afa, 0x0c0311ed, 0x1afc0601, 0x00fdfe05,
+    0x020d0906, 0xfb090609, 0x00f60bfe, 0xfbfdfbff, 0xfdfcf9fe, 0xff07030a, 0x02fe02fa, 0x07fbfbfd,
+    0x000c0808, 0xf9faf5f5, 0xfffa03fa, 0x0cfeff07, 0xff110cff, 0xfe000404, 0x02f2fa0e, 0x0dfb00f9,
+    0x01090308, 0x04fbfdf9, 0xf30604fe, 0xf90007f4, 0x08f204f6, 0x08f806f4, 0x0ef8fcfb, 0x0204fe0a,
+    0x0409fb04, 0x0002f806, 0x01f80201, 0xf4fffa07, 0xfdfcf6fd, 0xfa090406, 0xfc0905f7, 0xfffdfff2,
+    0xfd0709fd, 0xf8fff5f6, 0x04f905f8, 0x02fefc10, 0xfd0b05fc, 0x03fdfe0a, 0xf9f4fb06, 0x0200f603,
+    0x00050105, 0x03ed0008, 0xf60003fd, 0x030301f8, 0x06fbfef2, 0x00fa01f8, 0xff000401, 0x04030609,
+    0x0809f00a, 0x0102f803, 0xff02ff04, 0x01fdf501, 0x07fcf1fd, 0xf50002fc, 0x05fe06f6, 0xfff901f4,
+    0xfd0505fd, 0x01f7fdfc, 0xfdfe05f3, 0x02fdfeff, 0x040901f8, 0xfffb03ff, 0xf8f9f305, 0xf0f801fa,
+    0x02fbfe02, 0x08ef0504, 0xfb000104, 0xfe020204, 0x070400f6, 0x00fcfcf8, 0xfcfa0303, 0x02010305,
+    0x0304f606, 0x00f5fdff, 0xf5faf007, 0x0801f702, 0x0300f808, 0x00fdffff, 0x04fd01f5, 0xfd0001fb,
+    0x050c0106, 0x08f40701, 0xfd020907, 0x02fdf5fc, 0x030005fa, 0xfcfe05f5, 0xfaf7ee07, 0xffff0500,
+    0x03f5fe04, 0x02f802fc, 0xf9010105, 0xf70305fb, 0x0306fefd, 0xf701feff, 0xf7faff01, 0xff00ff04,
+    0xf9fffd05, 0x08fd02fe, 0xfa05f3fb, 0x0402fd08, 0x0208fc00, 0xf9f8fd03, 0x0b0104f5, 0x060003fd,
+    0x060502fe, 0x04f00901, 0xff00fe04, 0x0100f7fc, 0x01040500, 0xfe01fff4, 0xfffced08, 0xff0005f9,
+    0xfdf80108, 0x03010101, 0xfe020501, 0xf6f40200, 0x0405fef9, 0xfe0102f7, 0xf7fc05ff, 0x03fa0300,
+    0x02030305, 0x00f20502, 0x0400fefc, 0xff04000d, 0x020afc03, 0xfdfd0d08, 0x0b0005fe, 0x060200fd,
+    0x03f80201, 0x00f00bf8, 0xf701fd01, 0x0402f907, 0x03040802, 0xfeff01f7, 0x07fef803, 0x05fffef6,
+    0xff010706, 0x030805f1, 0xf8fefe04, 0xf1f303fd, 0x00fefbfa, 0xfafe00fb, 0xeffb09fd, 0x04f704fa,
+    0xffff0106, 0xfdf50501, 0x04f901fb, 0xfbe6f915, 0x00000ffb, 0x06ff1301, 0xfcfe04f9, 0xfafc05fd,
+    0x05eb050d, 0x02ef07fb, 0xfafffd06, 0x0100030f, 0x0a0d0ffd, 0x00fd02f4, 0x08fd050e, 0xffedfe18,
+    0xff02ee08, 0xec030ad8, 0xe5fcf101, 0xeb0806f4, 0xf7fff903, 0x0a11fffd, 0xf3fa0301, 0xf5ed0104,
+    0x0ef5f209, 0x17f104f9, 0x06fb0200, 0xfd06fefa, 0xf910fdf5, 0x00f20008, 0x05020cfb, 0x0806ff06,
+    0x07040402, 0x05050bfd, 0xfa0e0305, 0xf8fefa04, 0x0a170401, 0x00f51503, 0x00000cff, 0x04f509f6,
+    0x0a090b11, 0x1007f1ef, 0xf903fefd, 0xf1fc040e, 0x07040e00, 0x0202fff8, 0x1a04f9fc, 0x03fef904,
+    0x0a0d14ff, 0xf909080e, 0x03fbff0a, 0xf403fb01, 0xf605fbf4, 0x02fefe0c, 0x020106f3, 0x060206ff,
+    0x000504fe, 0x010304fe, 0xf90a0504, 0x0001f704, 0x030b0602, 0xfefc0805, 0xf9fc0600, 0x06ff04fe,
+    0x0307090d, 0x0701f2fe, 0xf802fd03, 0xf5ff0304, 0x060703fc, 0xf6ff01fa, 0x0cfcf900, 0x0002f805,
+    0x05070600, 0xfd00ff09, 0xff03fd06, 0xfefdf903, 0xfa01f7ff, 0xfe04010a, 0xfefe02f9, 0xfd020807,
+    0xfe0dfffd, 0xfd0504fc, 0x0205fe05, 0x03000304, 0xfc050602, 0x05fa0206, 0xf8f90205, 0x06020803,
+    0x0301070a, 0x03010202, 0xf7000002, 0xf7010200, 0xfe07fdf9, 0xfcfffdfc, 0x02fc0101, 0xfe030100,
+    0xfb02fb01, 0x000003ff, 0xfc07fefe, 0x00fef801, 0x0103f400, 0xfa030408, 0x080002fb, 0x05050502,
+    0x0309fffe, 0x04010afa, 0xfe07fc03, 0x07ff0503, 0xfd090401, 0x06000807, 0x00fb0006, 0x030408fc,
+    0xff000506, 0x09010103, 0xf5020203, 0xf2000304, 0x0106fdf7, 0xfefd02fa, 0x06fc00fe, 0xfe0000fd,
+    0xfa0402ff, 0x00090103, 0xf902fbff, 0x04fff902, 0x08020007, 0xfb030308, 0xff0402fd, 0xfffe0a02,
+    0x030cfcfe, 0x00fc08fa, 0x0402f905, 0x07feff00, 0xf90106fd, 0x05fe0402, 0xfcfcf806, 0x04fc0303,
+    0xfdfafd06, 0x020207fb, 0xecfb0203, 0xff0202fe, 0xfe03fefc, 0xfe04fdfb, 0x05fa0203, 0xfdfdfffe,
+    0xf6fefa00, 0x04fc0400, 0xfa0000fe, 0x0900fe07, 0x0900fd07, 0x00000309, 0x010309f7, 0x03fc09fd,
+    0x060d01ff, 0x02ff0303, 0xfe04fafe, 0x03fe020a, 0xfc0301fb, 0x03040803, 0x01fffc02, 0x050500fd,
+    0x00fc0405, 0x050103fd, 0xf5fd0402, 0xf5f90400, 0x000402fa, 0xfe02fefe, 0x05f705ff, 0x05fa0603,
+    0xf901fb00, 0xfdf90603, 0xf9fd0102, 0x08fb0109, 0x06fefd06, 0x01060c0b, 0xfa02fdfc, 0x04ff04fe,
+    0xff050000, 0x00fc0003, 0x0303f6fb, 0x02fcfe0f, 0xf90504f8, 0x090208fc, 0x05f8fffe, 0x04f600fc,
+    0x00fefa01, 0x030210ee, 0xf7fa0b01, 0xeaf406fa, 0x0104ff03, 0xfd010200, 0xfbfc02f9, 0x04f40506,
+    0xfdf8fc05, 0xfbfe06ff, 0xf7fb0402, 0x02e6fa0d, 0x00f41606, 0x060b12fd, 0xf401f800, 0xfafa0a00,
+    0x01f4ff04, 0x00f309f8, 0x0cfaf300, 0xfbfdfe07, 0xfc1308fb, 0x06f907f2, 0x07f2fefd, 0xfee0fe1a,
+    0x01fcd502, 0xf20413de, 0xe5fdfc06, 0xf6fdfef3, 0xec00fd11, 0x081305fc, 0xfbfffffd, 0xfdf1fa07,
+    0xfeeffdfb, 0x1cf304fd, 0xf3000a06, 0x01fff404, 0x0006fb02, 0xf80203ff, 0xfdfcffef, 0xfffafeff,
+    0xfa00fdfd, 0x0a0afefc, 0xf8030505, 0xfc0efc00, 0x090306fd, 0xf9fc05f7, 0xfffefef7, 0xff0103fe,
+    0xff040907, 0x00fafefe, 0xfcfc0701, 0xf204fa08, 0xfbfa0209, 0x03070400, 0x01080f0c, 0x0206f107,
+    0x07fc01ff, 0x0601030a, 0xfc04fdf3, 0xf101f903, 0xfc04f107, 0x020500f9, 0x03ff02fd, 0x0ef8fd06,
+    0xfbf60200, 0xfb06ff03, 0xf2020703, 0xfbfb0302, 0x070b07f7, 0x0a05faf2, 0x06f905f9, 0x0efdef05,
+    0x0a0f0209, 0xfa0202f3, 0xf6fe00ff, 0xed01fc08, 0x0001f907, 0x0c01020c, 0x010c07fe, 0xfefef60a,
+    0x09060204, 0x04f90104, 0xfffe09f9, 0xf0fbf003, 0x0104f2fe, 0x030906f3, 0x0303010c, 0x09070310,
+    0xfdef0502, 0xeefffbff, 0xf9031f11, 0x01e40108, 0xfd0805f8, 0x161afdf3, 0x17050600, 0x0af6ea01,
+    0xfe11fd03, 0xf80901ed, 0xf106f70b, 0xeef8ff05, 0x01f3f308, 0x1502f60c, 0xfffe02f2, 0xfbfefd01,
+    0x0c050b06, 0xfceefffe, 0x020012f8, 0xfcf2f2fc, 0x0002f6fa, 0xfefefeec, 0x060d0514, 0x0b0502fd,
+    0x02f4fc00, 0xf003faf2, 0x07f91502, 0x18deec0c, 0xfa09fff6, 0x272300ff, 0x110c0004, 0xfde8f501,
+    0xfd09f800, 0xfd0effe4, 0xfe0b0009, 0xfef7fef9, 0xfbeaf604, 0x1103f10e, 0x00f4f3de, 0xfffe03fe,
+    0xef010207, 0xfdfafa02, 0xfff210fe, 0x0cfdf9fd, 0xfb07f5f2, 0xf90001f0, 0x0a050005, 0x01fc0cf4,
+    0x02f90303, 0xfe06f4f5, 0x0bf6f3f3, 0x1bf9d308, 0xff11f3f5, 0x01fb0604, 0x0504080e, 0xdbf30002,
+    0xfdfbf905, 0xff07f9e8, 0x0810ffff, 0x0efaf7f8, 0x00f7f708, 0x0d01fc09, 0xf3f0f4f1, 0x02fcfc01,
+    0xf2f6f803, 0x01fcfd09, 0xfaf40bff, 0xfc02fd00, 0xf609f8ee, 0x0109fcf8, 0x0a05f502, 0xfbf1fdf0,
+    0xfcfa07fd, 0x0e01f4fc, 0x1afdf7fa, 0x0f04d8ed, 0xfb090309, 0xdee506fd, 0xfb03040d, 0xe102fdf5,
+    0x03f4f9f9, 0xfdfdf4ff, 0x0417fcfb, 0x16fef4fc, 0x04f3f806, 0x07ff0e0d, 0xeffbf101, 0x04fef3f8,
+    0xfdf4fd01, 0x09f9fd00, 0xf9fc0901, 0xf809fb00, 0xf50701f3, 0xfc05effc, 0xef00f102, 0xf8fef6f5,
+    0x020906fb, 0x15fff3fe, 0x11fbf608, 0x0605efe6, 0xfffc0713, 0xe6e90800, 0xfc0705fa, 0xf502fcfa,
+    0x07fafdea, 0x03f7ef0a, 0x011c0001, 0x1100f6fd, 0x01f1f807, 0x04f91809, 0x00fef715, 0x040002ed,
+    0xfffdfd01, 0x08f6fff6, 0x030a0b04, 0xff090506, 0xf90208fd, 0xf40beffc, 0xe9f6fc0c, 0xfe05faf5,
+    0x050d09f9, 0x0bfefb07, 0x06fafc06, 0xfc0807ed, 0xfeea0809, 0xf3020f01, 0xfd0e02f3, 0xf4fc0300,
+    0xfef6fbe3, 0x08f2fb18, 0x02130bff, 0x1a04fc00, 0x04f2f506, 0x00ff1413, 0xfe01010d, 0x030112f7,
+    0x04ff0304, 0x04f701f5, 0x080a0a09, 0xf3fdfbfa, 0x02fef804, 0xfdfb04f3, 0x070909db, 0x09fdfa04,
+    0x09e70500, 0x08f80efa, 0xfe0006f9, 0x01011107, 0x11010802, 0x02f108f5, 0x0408050c, 0xfa0405fe,
+    0x0a0b0700, 0x0201ff07, 0xf50b00ff, 0xffff000b, 0x0b08fcff, 0x00f201de, 0x0ffcf80d, 0x05030604,
+    0x020a0ffb, 0xf20a0b00, 0xfc02ff09, 0xf404fff7, 0xf100ff06, 0x01fbfee6, 0x0a160cea, 0x0a030000,
+    0x01ddfd09, 0x04f90afa, 0xf9fd04f7, 0xfdf51607, 0x0901fffe, 0x01f003f9, 0xfb03080d, 0xef0603ff,
+    0x07080604, 0xfdfd0811, 0x0207fdff, 0xfe000202, 0x0908fc00, 0xf8ef07f5, 0x0f02f105, 0x0800fc01,
+    0xfc100701, 0xf0060401, 0x000dfc06, 0x020607fe, 0xf005fe09, 0xfdf5fce7, 0x09090ef2, 0x09fffefd,
+    0x02eff80a, 0x08f502f5, 0xf2fe0203, 0xfbf60700, 0x050005f9, 0x00eafefb, 0xf8ff0206, 0xe9fb02ff,
+    0x0208f905, 0xf6ff0705, 0x0205fbff, 0xfa020000, 0x08060001, 0xfbfa05fe, 0xfe08f70e, 0xff01fff7,
+    0xf20a0302, 0xf40601fc, 0x020df704, 0x0402070e, 0xfa080506, 0x03f504fd, 0x0c061002, 0x0c020200,
+    0x05f5f503, 0x01ea03f4, 0xf3010708, 0xf7fa0302, 0x010a05f8, 0x09f8fbff, 0x0102fefa, 0xf7ff02f9,
+    0x050ef60a, 0xff0407f8, 0x01fbf5fe, 0xf0fffdff, 0x070705fe, 0x06fe01f1, 0xfa03fb05, 0x000000ef,
+    0xf80b04fd, 0xf70202fe, 0x040706ff, 0x0bfb0711, 0x05030b05, 0xfef10906, 0x07ff0813, 0x08fefe09,
+    0x02f10000, 0x00ef05f4, 0xfcfc010e, 0xf701fc13, 0xff0900fa, 0x0801fb03, 0x0302fcf1, 0xfffb03fc,
+    0x070af505, 0xf90407f8, 0xfcfaf900, 0xf8fd0000, 0x00feffff, 0x0304fdf2, 0xff04fbff, 0xfd0601f4,
+    0xf60f00fe, 0xfafc00fe, 0x09fe06f6, 0xf9fd0110, 0x0e030802, 0x09f50b0c, 0xfcfb0110, 0x0400f9fe,
+    0x01ec05ff, 0x00ff04ee, 0x06fbfb01, 0xf607f410, 0xf90c01f5, 0x0302f5fb, 0x02fd06fb, 0x06f507fe,
+    0x0a01f701, 0x00011308, 0x00fafd01, 0x01fd0505, 0x01faff04, 0x0209f8ee, 0xfcfcf8f7, 0xfa0600f6,
+    0xf808fd05, 0xfff7feff, 0x07fafbf9, 0x01fa0506, 0x08ff0a06, 0x12080b0b, 0xfbfcfd04, 0xf0faf50a,
+    0xfbf80302, 0xfc0205ef, 0xf8fefa08, 0x020bf501, 0xfd05fdf2, 0xfcfcf7f6, 0x02fdff0f, 0x0df1fe01,
+    0x06fafafe, 0xfb03190c, 0x01ff0805, 0x04fc0a09, 0xff03ff05, 0x020cfbf8, 0xfcf9fbf8, 0xfb04fdfa,
+    0xfcfdfb09, 0x03f7fffc, 0x0df6f7fb, 0x09fb0ffc, 0xfdfd0fff, 0x0d0e0605, 0xfefff909, 0xf3fef504,
+    0xf60400fe, 0xf50806f2, 0xfb02f913, 0xf906f9fb, 0xfa05faf5, 0xf6fff103, 0x000d0612, 0x0bf2ff03,
+    0xf7f9f400, 0xfb0f130e, 0xfe02130b, 0x05f50203, 0xf80c040a, 0x0913edfc, 0xfef8f4fa, 0x03fefa07,
+    0xfff6fa0b, 0xfef90cf9, 0x13f6f3fe, 0xfd060602, 0x1209fd15, 0xfef60b01, 0xfefffcf8, 0x0308f9ff,
+    0x0e06fbff, 0x0f020400, 0x040c0705, 0xfb03f8fb, 0xfc0505fe, 0xff0a0af8, 0x0304f800, 0xf9f4f7fa,
+    0x0903000a, 0xf6ff1708, 0xf4fe05f9, 0xfefb0a02, 0x08010e00, 0xe803fe0d, 0xf809f9ff, 0x0b030dfc,
+    0x02ff1000, 0x0008fc04, 0xfe090a06, 0x06ff090c, 0x1600ff17, 0xfdf90708, 0xfcf8f7fe, 0x030204f2,
+    0x0b0efdf6, 0x070603fe, 0xf7040203, 0xf903f7f7, 0xfc0609fb, 0xf4060406, 0xf9fdf405, 0xf6fbfbf8,
+    0x0afffb0a, 0xeff20a05, 0xf7fb0502, 0x07fd04f8, 0x07010700, 0xec05f611, 0xf401f403, 0x07030ef2,
+    0x00050cfa, 0xfe0dfd05, 0xf9090606, 0x18f80404, 0x0efe060f, 0x03fe0705, 0xf401fafd, 0xf9060cfd,
+    0x02f603f5, 0x010bfbfe, 0xf107fef3, 0xfcfdf9fb, 0xf7000605, 0xf4f60205, 0xfbe9fc03, 0xfbfdfdfa,
+    0x06fdf706, 0xf7f11604, 0xfd000004, 0x03fcf1f8, 0xff0300f3, 0xf500f902, 0xf903fdfc, 0x0303faf8,
+    0xf9fe05ff, 0xf9fd0406, 0xf8070100, 0x11f8ff07, 0xfcfdfb0c, 0x06fa05fd, 0xfd0103f6, 0xfe0e0c09,
+    0xfcf506fd, 0x0207fa01, 0x0002fd00, 0x02f5ffff, 0xf600000a, 0xf0f50001, 0xfdec0401, 0x11fb0003,
+    0x0501f508, 0xfefb18fd, 0xf9fdfa02, 0xf7f8f1f9, 0xfdff01e3, 0xf002fdfa, 0xfc0205fa, 0xfc00edfc,
+    0x060bfffe, 0xfbfb0501, 0xfb060404, 0x07fdfc03, 0xf101fd13, 0x00fd01f3, 0x030003f0, 0x030a1108,
+    0xf8f708fe, 0xfafbf8fc, 0x0600ff00, 0x00f5fc09, 0xf706fa08, 0xf706050a, 0x00f90dfe, 0x14eefd06,
+    0xfe04f30d, 0xf4fc11f8, 0xf6fefffa, 0xf8f5f8f8, 0xfdf607e7, 0xec0100f1, 0x02030dec, 0xfffff4fd,
+    0xfc0dfefe, 0x02fc050f, 0x080bfd05, 0xfbfbfe04, 0xf3010515, 0x010504fb, 0x05fd07f5, 0xfb0308ff,
+    0xfaf20cf8, 0xfdfafaf3, 0x0802f9fd, 0x05ff0500, 0xfe06fc01, 0x010b0506, 0x0005fefa, 0x08eb0203,
+    0x0002f60a, 0xf3020ef0, 0xf90101f9, 0xf8f805fd, 0xfafa0ef1, 0xebfe02f7, 0x010003f3, 0x0102faf8,
+    0xfc01fd02, 0x01fb0403, 0x05070603, 0xfafb01fe, 0xfb050a16, 0x040e0709, 0xfdff0206, 0xecff00f6,
+    0x01fc09fd, 0x03f700fa, 0x0003f506, 0x010a01ff, 0x010b0103, 0x06100203, 0x030afcfb, 0x0cf00200,
+    0xfc03fd08, 0xeb0312f5, 0xfe01f602, 0x03f90308, 0xf6fb08fc, 0xf3fb0304, 0xf8f8f9fb, 0xf902fbfe,
+    0xfffbff07, 0x06ff0206, 0x07040606, 0xfffd01fc, 0xfb040c0f, 0x060b0407, 0xfa08fdfe, 0xdc0101fd,
+    0x04f5020b, 0x05f8fefe, 0x0704f703, 0xfd0afcfb, 0x0204060b, 0x030bfffd, 0x0207fcfc, 0x09f1010a,
+    0xfdfffb08, 0xec0011ff, 0x0100f102, 0x07f90509, 0xeafc02fc, 0xf9fcfc01, 0xf3f7f6ff, 0xf806fd00,
+    0x08f5f70e, 0x0bf5000a, 0x0f010609, 0xfaf8f206, 0xfdfdfe06, 0x091501fd, 0x07060807, 0x05020d00,
+    0xfb010502, 0x01fafd04, 0x0af5f6f5, 0x060605f5, 0x06050dfc, 0x000fff01, 0xf9030206, 0xf302ec03,
+    0x0302fb0a, 0x050100ea, 0xfd08fb0b, 0xeffdf5f9, 0xfd04f702, 0x09fd0b08, 0xfb1204fa, 0x00f3f406,
+    0x03fffb00, 0x01f60505, 0xfe0706fe, 0x04f3f401, 0x0005f405, 0xfd1805f5, 0x090f020d, 0x010414fd,
+    0xfd0d0200, 0xfafbfb01, 0x07fa02fb, 0x1503fc03, 0x01080cf7, 0x08190005, 0xfd060d0f, 0xe3fffb02,
+    0xfe00fc0a, 0x0a0302e5, 0x0401f707, 0xf0f8fbf6, 0xf600fd04, 0x09f90a05, 0x040afff3, 0xfcf6f404,
+    0x00fdfafa, 0x06f6fc0a, 0x050507fe, 0x0afcff01, 0xf505ecf9, 0xf317fefc, 0x060af600, 0x01f80af5,
+    0xfe08fdfe, 0xfd01f8fe, 0xfcfa0ffc, 0x1300ef00, 0xfa0b0af4, 0x0c0b0503, 0xfcfd060e, 0xda020800,
+    0xf5000007, 0x07fe07e8, 0x0504f802, 0xf5f801fa, 0xf810fd00, 0xfd030803, 0x0803fff6, 0x02f30207,
+    0xf7fafbfc, 0x03f0fb09, 0xfd0a05fb, 0x12ff04f4, 0xdf02f8f5, 0x0201fcfd, 0xfafcf6ec, 0xf3f0f9f5,
+    0xf80b02ff, 0x0603eef4, 0x01f8ffff, 0x0afaf1fe, 0xfa0308f1, 0x04f704ff, 0x00f20005, 0xf40108fe,
+    0xf7fcfff7, 0x06fa05e1, 0x05f7fc06, 0xfcf8fc02, 0x0402fe01, 0xf7080400, 0x00f80609, 0xfdf5e806,
+    0xf2fc08fd, 0xfff300fe, 0xf709f2f6, 0x0a0008fa, 0xfeffff02, 0x0200fd05, 0xf2f507f0, 0xf4f9f7f5,
+    0xfd0bfd01, 0x0900f0fb, 0xfdfbfaff, 0xfffb0504, 0xf6f90cfb, 0x04fbfdf8, 0x0bf700ff, 0x0206fa03,
+    0x0002faf8, 0x00fd05ef, 0xfa050504, 0xfafffe04, 0x0908fd0a, 0xfc0006fd, 0x03fc0704, 0xf8fce90a,
+    0xfbfd07fe, 0xfef206fb, 0xf509f0ed, 0x03fc080c, 0x03000008, 0x080305ff, 0xfdfe07fb, 0x050201fc,
+    0xfa12fd02, 0x0201f806, 0x00f5f8fb, 0xfb010dfe, 0xf8fd0bfc, 0x0400fd02, 0x0afa03fa, 0x050afe01,
+    0xfb0200fa, 0x08fd0b08, 0xfd0b08fc, 0x04fa010a, 0x060afa0e, 0x03f70b04, 0x070002f1, 0xfa00f309,
+    0x03000afe, 0xfef401f9, 0x01fffdee, 0x08f70dfa, 0x03fdff01, 0x04070dfe, 0x020200fd, 0x0cfdfffb,
+    0xfc0a0107, 0xf5f90408, 0xfdf0f402, 0xfc070506, 0xfc020b02, 0x030006fa, 0x070204fe, 0x03080101,
+    0x00020afc, 0x03ffff09, 0x021007fc, 0xf7000106, 0xfb01f711, 0x01f40005, 0x0dfcf5f1, 0xf100fe0b,
+    0xfd010902, 0x01f4fef9, 0x0301fbed, 0x11f10bed, 0xfefbf602, 0x080e09f3, 0x02fc01fc, 0x0bf8fefb,
+    0xfb10fe0c, 0xf0fe07fc, 0xffecf601, 0xf9070001, 0xf90202fb, 0x03f807fc, 0x000404fc, 0x07ff080b,
+    0x0102fbfc, 0x08000802, 0x000d05fb, 0xf306fc05, 0xf605f41a, 0xfffafe00, 0x09fef7f9, 0xeffb0307,
+    0xf707ff04, 0x08fa04f7, 0x0102f6ef, 0x07e7f504, 0x0a060208, 0x09fb010d, 0xfef4fc1f, 0xfd00080a,
+    0x0d06f908, 0x050bfdff, 0xfe00f803, 0x08fd02f8, 0xffff04f5, 0xf80301ff, 0xff06f4ff, 0x0df8010f,
+    0x030af3fe, 0xff060c11, 0x01030309, 0x05f60304, 0xf8fef90b, 0x03010806, 0x08fb03fd, 0xfbfc0000,
+    0x0103fffa, 0xfc060a06, 0x030107f5, 0xfff3fdf9, 0x0403f90d, 0x02f0fb01, 0xf8eff81c, 0x04fbfd0b,
+    0x00e5f900, 0x0908f506, 0xfe00fc01, 0x020004ec, 0xfcfd03f8, 0xf605fffa, 0xfe06f1e7, 0x02f9fb06,
+    0x0a0eedff, 0x00050b19, 0x01f3010c, 0x0af4fc04, 0xf8f8f503, 0x06ff0003, 0x08fcffeb, 0x0005fbfb,
+    0x0306fd01, 0xf2090804, 0xfaf0f4f8, 0xe7ff04fc, 0xf0fffd08, 0x02ea07f9, 0xf4fdfb08, 0x07fa0a00,
+    0xfdbaf003, 0x0a04effe, 0x0300f9f9, 0x0c0105df, 0x02fdfdf2, 0xf80ef9fa, 0x0009ebea, 0x01fef20e,
+    0x0d06f2fe, 0xff021607, 0x05f1040a, 0x08f8f802, 0xfbf4fd05, 0x0604ed03, 0xfefefbf7, 0xff01fef7,
+    0x0208fe00, 0xed090402, 0xfbe1f306, 0xd50d09fa, 0xfcfefafe, 0xf3030300, 0xff0705eb, 0xfbf90c03,
+    0xfdece101, 0xfc03f1fa, 0x080700f9, 0xfb0804df, 0x0003fcff, 0xff06f9f3, 0xfd03faf9, 0x04fff80c,
+    0x0400fc05, 0xff0712f1, 0xfffcfe01, 0x06f6f6fb, 0x0007060e, 0x0006f401, 0xf3f801ff, 0xf5fd09f8,
+    0x050002fe, 0xe8fb0004, 0x06e6060b, 0xdb0800ff, 0x0afffe01, 0xef0d0804, 0x07100deb, 0xfd070603,
+    0x05fff803, 0xfb03fd02, 0xff0808ff, 0x050604fa, 0xfe03ff04, 0x030402f7, 0xf501070a, 0xfcf70604,
+    0xf3ff0505, 0x000614ee, 0xfc08faf6, 0xfef9f9f8, 0x0109020b, 0xfb070507, 0x02f6fd02, 0xf9f2f8fd,
+    0x09fdfffc, 0xedfa0308, 0x06e80b06, 0xe4f6fc00, 0x0b01f801, 0xf8080405, 0x0c07070a, 0x05fb0205,
+    0x04080b03, 0x0601ff01, 0xfe070c05, 0x070403fd, 0xfd0bf90b, 0x07010902, 0xf8010408, 0xfdfd06fc,
+    0xe7fe0a08, 0x04010bf6, 0xfd04f800, 0xfcf6fbfc, 0xfd06ff00, 0xf90403fb, 0x080005fd, 0x02f6fe02,
+    0x0b05fcff, 0xf4f9010c, 0x04f407fd, 0x09f40100, 0xfd03f708, 0x00070105, 0x06010107, 0x06f90002,
+    0x00040b01, 0x0e00ffff, 0x01050501, 0x0103f7ff, 0x000bfa03, 0x00050701, 0xfe00fff3, 0xfcfc08ef,
+    0xf3050909, 0x02030aeb, 0xfe01fe03, 0xfbf9fefe, 0x0001ff09, 0xf606fdff, 0x0003fefd, 0xfffe0505,
+    0x0b0aff06, 0xf6f80608, 0xfcfbffff, 0x19f5fc05, 0xfc000402, 0x0907fc06, 0x03fb010d, 0xfcfcfff9,
+    0xff02fc01, 0x09fe0100, 0x0500f506, 0xf903fcfa, 0x040a00ff, 0xeff5fff4, 0x0101f9f6, 0xfff70403,
+    0x0407ff07, 0xfd0308ef, 0xfbff0206, 0xf4fef7f7, 0xfd01030d, 0xf80dfcfc, 0xfcf8f90a, 0xf80005ff,
+    0x0407fc08, 0xf6fa0603, 0x00f3fb02, 0xfb080502, 0x0bfffcf7, 0xfc150101, 0x05fb0310, 0xf9f904fc,
+    0x0204f9fc, 0xf90d0bf8, 0x070704ff, 0x07000306, 0xf2fbfa06, 0x04f906fb, 0x02070afd, 0xf1fb0500,
+    0x0d14fefa, 0x0107fb12, 0x1002f106, 0x09000604, 0x050bfff8, 0x01fafb11, 0x01fcf907, 0x03fa0d00,
+    0xfa0f0504, 0x060007fd, 0xff00f813, 0x030701ff, 0x07fef6f9, 0x01000bf8, 0x04fdf90e, 0xf1000102,
+    0x0107fff8, 0x020d0afb, 0xfb080df9, 0x0afd0107, 0xf1faedfc, 0xfdfcfe04, 0xfd070108, 0xf6fd08fe,
+    0x040cfaef, 0xfb0bf902, 0x0a0cf500, 0xf2fd0c02, 0xfb09fafb, 0xfdfe0901, 0x0a01f8f8, 0x01ff0a01,
+    0xf80bff00, 0x01fd0cfa, 0xf606f6fb, 0xfaff01fe, 0x1800f8ff, 0xfbed0cef, 0x08f90d11, 0x0108f40b,
+    0xfaf209f4, 0x000303f6, 0xf903f9fb, 0x0df8f8fe, 0xf8f6f4ef, 0xfb1af603, 0x03070514, 0x03f509ff,
+    0x000cfdf0, 0xfe06fef4, 0x010efef4, 0xe0fe0d06, 0xfc05fbf6, 0xf9fc13f3, 0x100301fa, 0x0302f7f7,
+    0xf410fc00, 0xfe000df4, 0xfb08fbfd, 0xfefcfe13, 0x0a00f3f4, 0xf9f904fe, 0x01f80c14, 0x1501ecf6,
+    0xfef80bfc, 0xf9f1fbf6, 0xf202eb05, 0xfd05f801, 0x07f8fae9, 0xf428f603, 0xfafefef8, 0x05f4fefd,
+    0xf5030101, 0xfdfbf5e7, 0xfefafef0, 0xe5030efb, 0xf8f7f6f6, 0xfc000406, 0x0bf504f8, 0x0003f5f2,
+    0xfc14f900, 0xfe06fef5, 0x0003fb00, 0x0b02fb0f, 0xfcfaefe7, 0xf5faf515, 0x04fd001a, 0x12f9fbf4,
+    0xff0706ef, 0xf4f9edf3, 0xeaffed02, 0xfd060301, 0x0e06fef1, 0xff11fb04, 0xfc04f7f0, 0x03f703f9,
+    0xf5fe020d, 0xfff3eadf, 0xfef0fbf4, 0xee020302, 0xf3f6faff, 0xf706f005, 0x01f303ff, 0xf601fb04,
+    0x0c0afb02, 0x030dff0f, 0x040bfdf8, 0xff00fa00, 0xee02f4ed, 0xf8fff813, 0xf5fbf107, 0xf6ff08ee,
+    0x01140cfc, 0xf305fef9, 0xddfff8fc, 0xf00409fb, 0x090b04f1, 0x1401070e, 0xfb0604f8, 0xfff9fafe,
+    0x01f9f905, 0x00fff0e6, 0xf3fbf5f3, 0x03040206, 0xfa00fe03, 0x0006e701, 0xfcfbff0b, 0xfd010117,
+    0x0cf6fe03, 0x040c0008, 0x00fdf9f9, 0xf8fdfefc, 0xf4030401, 0xf4f7f50c, 0xfdfcf607, 0xef010401,
+    0xf80e0508, 0xf10c05fe, 0xf1fdf4f3, 0xff0604f4, 0x020704fb, 0x15f70308, 0xfc03040a, 0xf706fa03,
+    0xfef9fd02, 0x0001f2ed, 0xf50506f8, 0x0001020a, 0x030bfdfe, 0xff09eafd, 0xf700f906, 0xff01071b,
+    0xfcf8ff04, 0xff0d03f9, 0x0300f9fc, 0x06f30500, 0xfcf503f7, 0x02fbfafe, 0xfdfcf004, 0xff030d08,
+    0xf60a0210, 0xf6080201, 0xff02fbf6, 0x0ffd03f2, 0xfefefd01, 0x0bfb0309, 0xfcfe0012, 0x0404fb06,
+    0xf7f1fe01, 0xfd06fef7, 0x00060ffc, 0xf7010004, 0x0a0ff4fb, 0x0204f702, 0xfb04eefd, 0xffff0511,
+    0xeef2f804, 0xfc0603fa, 0xfafe0003, 0x06f002fc, 0xfff901e0, 0x0404e704, 0x0602060f, 0x0403ff01,
+    0x0006fe0b, 0x0706ff07, 0x0cfbfcfa, 0xfd04fdff, 0xfe0e0405, 0xfefb0305, 0x03010cfc, 0xfff70405,
+    0x0506fb03, 0x0307cff3, 0x060b0807, 0x00000808, 0xfdfd0505, 0x0c05ff03, 0xfc020601, 0xfd03f503,
+    0xfc090203, 0x04040105, 0x02fefcf8, 0x01f506fc, 0xf7fb01d1, 0x0106dc04, 0x05020314, 0x08030700,
+    0xf80ffa0f, 0xfafffbff, 0x06f6fcfa, 0xff0601fb, 0xff090500, 0xfcfafc0a, 0xfbf812fe, 0xfdf90102,
+    0xfe03f903, 0x04ffc8fa, 0x010d08ff, 0xfb08fb01, 0x01020104, 0x07040305, 0x02fc09fa, 0xf805f608,
+    0xfc0a0505, 0x03030008, 0x00ff00fa, 0x04f800fe, 0xf5fcffcd, 0x010bdf04, 0x03010211, 0x03010400,
+    0xfa12fc0a, 0xf8fdfef5, 0x03f8fcf9, 0xfb0503f4, 0x020501fd, 0x0306f805, 0xfef90cfc, 0x00f700fb,
+    0xfd06f9fe, 0x02ffc7fe, 0x02060202, 0x0408f9f7, 0x0203fcfe, 0x09fffa00, 0x07f80afa, 0xfe01fc02,
+    0x0315fe04, 0xfffffe07, 0xfe0200fb, 0x12f3f7ff, 0xfbfeffcc, 0xfe02e1fd, 0x05f8040a, 0xfef904fb,
+    0x0006fc09, 0xfdfc02f3, 0x08fefbfd, 0xfb0002f1, 0x0303fdfe, 0x0905fefc, 0x000103f0, 0xfef500fe,
+    0xff09f8fe, 0x020bcbfb, 0x00f80006, 0x050701f7, 0xfcf9f8fe, 0x0701fa00, 0x06f70702, 0x00f6ff07,
+    0x0c13fd04, 0x02040102, 0xfe03fdfc, 0x0efaf9fe, 0x020503d1, 0xfefed604, 0x0afafd03, 0x09f3fefd,
+    0xfd050307, 0xfc0908f7, 0x08fffbfc, 0x02fffdf7, 0xff01f9f8, 0x060003f9, 0x000400f0, 0xfdf80001,
+    0x0606fb01, 0x000fccfb, 0xfef402fe, 0xfe0102fd, 0xf8f7f9fc, 0x0402fdfb, 0x02fc0604, 0xfff2ff02,
+    0x020d0002, 0xfe050205, 0xfd02f8f6, 0x0cfd01ff, 0x0604ffd4, 0x0600d909, 0x0afbfd01, 0x0ef9fbfe,
+    0xf80f060c, 0xf60d04fe, 0x0afcfdfa, 0x0100faf8, 0xfc02fefa, 0x04fb01f7, 0x050401f1, 0x04f70103,
+    0x0807fbff, 0xfe0ccffa, 0xfef700ff, 0xfd00fcfd, 0xfbf6faff, 0x0306fb01, 0x02000307, 0xf8f3f801,
+    0xfe070201, 0x0106fd09, 0x0102f9f6, 0x0b01fd00, 0x02fdffd3, 0xfd03db0a, 0x04fefa00, 0x0dfbfafe,
+    0xf915020a, 0xfa070404, 0x0bfa01ff, 0x0206fdf6, 0xff0302f9, 0x03fafefb, 0x020308ef, 0x0cf20102,
+    0xff0afcfb, 0x0007c9fc, 0x00fafcfd, 0x0200f900, 0x01f9f5fe, 0x0206f603, 0x05000205, 0xfbf90105,
+    0x0404fd01, 0x0008f906, 0xfc03f7ef, 0x070bfefe, 0xfdfb01d9, 0x000be105, 0x07010208, 0x0bfc0300,
+    0xfa14fe0c, 0x0401ff0b, 0x04fafe01, 0xff0001f8, 0x01040502, 0x03fbffff, 0xff0009f7, 0x0bf60100,
+    0xfb0d02ff, 0x0904d600, 0x0102ff05, 0x0a04fbfc, 0x04f7f2fd, 0x0403f9ff, 0x02020307, 0x0401000a,
+    0x0908ff00, 0x0006fa01, 0xfe07f9f3, 0x0cff0407, 0xf607f40a, 0x0907f9ff, 0x09fd04f7, 0x08000207,
+    0xfe06fcec, 0x09f8fff5, 0xfbfef807, 0xfd0508fa, 0x0007f8f6, 0xfef5fa07, 0xfcfefb0d, 0xf7f6fcf8,
+    0xfb01010b, 0x0afffbec, 0x0cf4fefe, 0xf7f4fbea, 0x0310f3f9, 0x08f7fcfa, 0xf90e04f4, 0x0afff8fc,
+    0xf8ff06ed, 0xf801f603, 0xf5fe0401, 0x0001fd08, 0xf701f406, 0x0307f7fb, 0x03fc0002, 0x0bfd0113,
+    0x08fb06f9, 0x0efcf9fc, 0x0afcfbff, 0xfffc0af0, 0xf70af606, 0x13f3f502, 0xf804fe10, 0x04f9fefe,
+    0x02ff090b, 0x0700fde9, 0xfffaf704, 0xf1f206f1, 0xfe010001, 0x02f408fc, 0xfa090ef1, 0xfffe0304,
+    0xf70d01ee, 0xfc02f703, 0xfc05030f, 0xfa08e706, 0xee03f100, 0xfafd00f8, 0x08effefb, 0x09fffd12,
+    0x0ef1f60b, 0x11fbfa06, 0x17070405, 0x0cf800f4, 0xfd0ff710, 0x1200f8fc, 0xfa110805, 0x08f4fbfb,
+    0x07f9030c, 0x060c05ef, 0xfa08f309, 0xeef00afc, 0x03f80e02, 0xfcfc0af4, 0xf7f809f6, 0xfcff0d03,
+    0xf51003f8, 0xff12fc08, 0x0107fb10, 0x0b09f7fd, 0xe90201fd, 0xf5f20103, 0x07f7fa05, 0x01fc0009,
+    0x0bf80117, 0x03f4fbe7, 0xff0805fb, 0x02fbfbf2, 0xfb0f070b, 0x08fdfc03, 0xf8131fff, 0xfdecfe00,
+    0x09f1fe08, 0x0406fdf6, 0xff05fb0f, 0xfcff0807, 0x01030e06, 0xf80202f4, 0xf2f302fb, 0xfdff0ef7,
+    0xecfcfa02, 0x0e16fcfb, 0x0606fb09, 0x0b0702ed, 0xe8030c02, 0xfbf40812, 0xfdfafb05, 0xf300f4fe,
+    0xfc07010d, 0xf2edfd01, 0xe50100f4, 0x00f904ed, 0x020f1202, 0xf3fdfd09, 0xfd061e01, 0x02ed0600,
+    0xfef10106, 0xfc0efef6, 0x09080401, 0x03070009, 0x00080a07, 0x040403fb, 0x03f8f612, 0x02ff00f3,
+    0xf4ebfb05, 0x09010af3, 0x06fc01fc, 0x050208ef, 0xf4ff08fd, 0xfa070003, 0xe209ff0d, 0xe6fb04f8,
+    0xf6010004, 0xfbf20100, 0xfcfcf2f9, 0xf8fa06f4, 0xfe090e0b, 0xf80c0806, 0x04f20cf8, 0x0bf41107,
+    0x00fbfb00, 0xf90205ef, 0x05fa05fb, 0x0e08fc04, 0x00030400, 0x0500ed02, 0x1202fb01, 0xfc04f506,
+    0xfeeafb07, 0x07fe0cf5, 0x07f700f9, 0xfdff09f1, 0x00fa01fa, 0xf905fff8, 0xdb0b0006, 0xeef5fff8,
+    0xf4f5fb05, 0x00ff0cf6, 0x0cfefa0a, 0xfafb01f5, 0xf9000306, 0xf90b080a, 0x02fc04f7, 0xfffc0e08,
+    0xfdfdfdfc, 0xf6fbff06, 0xffe701fb, 0x060402ff, 0xf70902fc, 0xfafcf20a, 0x13fdfdff, 0xfa02f90a,
+    0x0401f807, 0x03f90c02, 0xfdf7f9f8, 0x06fd06fe, 0xfefff1fb, 0xf1fc05fa, 0xecfffdfe, 0xf6fafcfa,
+    0xf7fb05f4, 0xfe0010f9, 0x0702070c, 0x01fc040d, 0xfdff02fb, 0x0600050f, 0xfb0706fe, 0xfcfc080b,
+    0xff09f7f8, 0xf8fdfc0f, 0xf6f303fe, 0x050c0605, 0xea05fc00, 0xef01fb05, 0x0b02f8fd, 0xfffffa00,
+    0x0209fc0a, 0x06050007, 0xfffffbfe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xfef703ff, 0xfd06fdf9, 0x04060610, 0x08f001e3, 0x070c0c02,
+    0xf70602fc, 0xfb02050b, 0xf9f9fc05, 0xff0201ee, 0x100400f2, 0xfcf5080c, 0x000600f9, 0xfa0700f2,
+    0xf9f80409, 0xff04faf2, 0x0505f3ff, 0xedff0402, 0xfc00fefa, 0x07f80311, 0xfffff5f3, 0x04f3fafa,
+    0xf8010ff1, 0xfb0d0e06, 0xfe080800, 0xf7fdf404, 0xf8090202, 0xff100217, 0x05f402eb, 0x08010afe,
+    0x060d0ef4, 0x07020204, 0xfef3fc04, 0x090a09ff, 0x0809fef2, 0x05effd10, 0x020302f5, 0xfc0903fc,
+    0xfe00ff08, 0x01fff3f0, 0xf8fffbf9, 0xfafcfe00, 0xfffb0cfd, 0x03fa040a, 0xfd03fdfd, 0xfefafafc,
+    0xfd0703f4, 0xff110605, 0xff0312f9, 0xf609e805, 0xf60bffff, 0xff0e0119, 0xfafdfdf6, 0x01f617f4,
+    0x04fd0500, 0x06f4f603, 0xf6f006f6, 0xfb0a0c08, 0x080907fb, 0x10effd07, 0x00fe06f3, 0x04fa0e02,
+    0xf7fffb06, 0x00fee9ee, 0xf8f60bf9, 0xfbfafffc, 0xfcf80c08, 0x07fe06f6, 0xfa010000, 0xfe02010e,
+    0x080df8fb, 0xfd00fcfb, 0x000006f8, 0x0007ee03, 0xea07fef5, 0xfff0ff0d, 0xf605fbee, 0xf3fb0801,
+    0x01fb030a, 0xfdebef0f, 0xf7f50cf6, 0xfd08fcf5, 0xfe061000, 0x0ff402f2, 0x01fd13f8, 0x04fb02ff,
+    0x00fffd02, 0x00fbeaf1, 0x01f90101, 0x04fefefc, 0xf3f6fe0e, 0x10fefbfb, 0xf8fb0211, 0x02fff90b,
+    0x0109fc08, 0xfeeffbfb, 0x0706fb02, 0x0dfbfaff, 0xf2fffefb, 0xfdf8f801, 0xf813fcf2, 0xf6f800fc,
+    0x00f8f70a, 0xf801ef06, 0x00fe18fc, 0x0906f201, 0xff060f06, 0x04f501ec, 0xfdfa0afc, 0x05fdf602,
+    0x00fbff02, 0x07feeffc, 0x03fcfe08, 0x01fdf704, 0xfcfdf101, 0x16080af3, 0xf8eef716, 0xfaf6f90c,
+    0xf9fe0703, 0xfff701fd, 0x0101f607, 0x1101fdf5, 0xfcf8f5f9, 0x0806f4f9, 0x070cf8fa, 0x01eff8f3,
+    0xfeffec0d, 0x00100002, 0x0e001901, 0x06f6f406, 0xfa040500, 0xf7edfff1, 0xf50afb02, 0x0404f906,
+    0x00fb0100, 0x0300f50e, 0x0a0206ff, 0xf9fef203, 0xfafef901, 0x09080dfc, 0xf7f40801, 0xf0f70105,
+    0xf5f20905, 0x00fb0308, 0xfbfffe00, 0x0700fbf9, 0x04fcedfc, 0xfe07f8f7, 0x0a0801fd, 0x07eef2fd,
+    0xfc0efb04, 0x09030502, 0x01fd0414, 0xfaecfc05, 0xf804f7f3, 0xf3faf706, 0xf9f2edf5, 0x0403f903,
+    0x000305fe, 0xff04ffff, 0xfc000ffc, 0xf402fc02, 0x01f3ff09, 0x060a14f4, 0xf6fb0af3, 0xf6020108,
+    0xfef4f504, 0x04fcfa01, 0xfafd08fa, 0xfbfcf101, 0x0100ecfb, 0xff0afefd, 0x080005ff, 0xfef6fdfb,
+    0x070ffa04, 0x0ff80901, 0x05f50008, 0xeff0010a, 0xf7fc04f1, 0x07fef60d, 0x02ebf2f3, 0x0dff0206,
+    0x021afcfa, 0xfd0101f8, 0xfafe0504, 0xfb110700, 0x0af10312, 0x0e0911ec, 0xfdfe07f4, 0xfd070003,
+    0xff04f906, 0x0f01f2f5, 0xf7ef0701, 0xf9f4faff, 0x0a14f705, 0x04f80102, 0x05f80c16, 0x11fff307,
+    0xf803eaff, 0x0307fafd, 0x0801ffff, 0x01f902f7, 0x0917fdf1, 0x07ff14f4, 0x0bfeff03, 0xfafbf6ef,
+    0x0c0ffe0a, 0x0b08f8e7, 0x0bfae0f7, 0xecf40006, 0x080813e9, 0x0ef805f2, 0x1110faf6, 0x04d3fbfa,
+    0x09060fec, 0xfc040003, 0xff0403f2, 0xf6faf100, 0xfe01f000, 0xff09fb04, 0x07000209, 0x0e000404,
+    0xfa06f6fb, 0xf4fefc06, 0x13fe0200, 0x03fbfffc, 0xfd10fdf4, 0x0dfe08fd, 0x02fdf602, 0x06fcf3fc,
+    0xff05fa08, 0x0102f1ee, 0x0605ebf9, 0xf4f6fafb, 0xfffdf2e9, 0x07f8fff3, 0x0605f8f9, 0x00f100f8,
+    0x0607fced, 0x00f9f9fd, 0x020109f8, 0xf5fdfafc, 0xf1faf3f4, 0xf90af502, 0x0105ff03, 0x05020a06,
+    0x04fa00fe, 0xf7fcfb05, 0x160000ff, 0x0702f6fe, 0xfd0700fd, 0x08fefe04, 0xfdfdffff, 0x0604feff,
+    0xf8fffe02, 0x0301eef2, 0x0700fcfb, 0xf6f8f9fc, 0xf5fbe6f1, 0xfff9fafe, 0xfbfefefc, 0x050703fc,
+    0x0700fdf7, 0xfffcf4fa, 0x00fe03f8, 0xf7fc01ff, 0xeefef8f1, 0xfd03f201, 0xfe09fbff, 0x050407f8,
+    0xfff80400, 0x00fdfdfe, 0x05020004, 0xfd06fffd, 0xfe040200, 0x08fbfe05, 0xfbff0803, 0xfd00fdf6,
+    0xfefa03fe, 0xfffdedf6, 0x0501fcfd, 0xfafcfdf8, 0xf406f0f8, 0x00fc0402, 0xf5fffffe, 0x060501fa,
+    0x02f903ff, 0x01fbf4fb, 0xfffaf902, 0xf9fc0400, 0xf701faf4, 0x00f6f301, 0xfb0a01fb, 0x020201fe,
+    0x02f30304, 0x03fa0503, 0xfa02fffc, 0x0104fffb, 0xff000400, 0x04fb0209, 0xfbfd0608, 0xfa0200f5,
+    0xfbf6fefc, 0xf800f506, 0x0303fcff, 0xfa0000fd, 0xf809fcfa, 0xfc010dff, 0xfa000302, 0x08fb0100,
+    0x01f70303, 0x0100faf5, 0xfbfdf602, 0xfef800ff, 0x01fdfd00, 0x05f5f804, 0xfd020003, 0x07070008,
+    0xf9fdfefd, 0x02fa05fe, 0x0404fa07, 0x0805fcfa, 0x03ff01fb, 0xfef80001, 0x01fdfd07, 0x0202fcf6,
+    0x02fefbfc, 0xfafef703, 0x0007f800, 0xef01ffff, 0xf90302fb, 0x03000e06, 0x01010306, 0x01f7fe02,
+    0x03fcff07, 0x01fd00fc, 0x02fdfc01, 0xf2fdfd07, 0x01f9fd00, 0x03f1fa06, 0xf70801fd, 0x0506020b,
+    0xfdf4feff, 0xff0303fc, 0x080601f9, 0x02070006, 0x04fbff02, 0x03fb0005, 0x0002f905, 0x090e0002,
+    0xfbfe02fd, 0x01fefc03, 0xff03fc01, 0xf709fa02, 0xf702fffe, 0x070605ff, 0x02fc0701, 0xfbf20102,
+    0x03ff0207, 0x04fe0105, 0x0000fdfe, 0xf9010205, 0xfffafd06, 0x01fa000b, 0xfc090405, 0x050cfd0c,
+    0xfdfb03fe, 0xfb060307, 0xfe030bfa, 0x0309050b, 0x07fc0107, 0x03fdfe05, 0x0101fa06, 0x071200f9,
+    0xfa000a06, 0x0506fd02, 0x050701fd, 0xfe09fe09, 0xfa010103, 0x110500f7, 0x00ff0cfe, 0xfbf70206,
+    0xfe00ff0c, 0xfb06040c, 0x0002f9ff, 0x000802f6, 0xfe0103fb, 0x04030004, 0x07f8f6ff, 0x00f70403,
+    0xf502f3fc, 0x02fe0302, 0xfeff0501, 0xfd010404, 0x0cfcfbfd, 0x04070c09, 0x080fedf9, 0x020501f8,
+    0xfafffbfb, 0xfe080406, 0xf9fc00fc, 0x08f8fc00, 0xf8fbfdef, 0xfa0000ff, 0xf502fb05, 0x0f01fb05,
+    0x0d070df1, 0xf7fb0400, 0xff02f7ff, 0x030201fd, 0x00f803fa, 0x0200f901, 0x08ff0300, 0x06fa0cfd,
+    0xff04f9fe, 0x04ff0103, 0xfdfb0501, 0x02010800, 0x03f900f7, 0x02090903, 0x0011f8fb, 0xfd00fdfa,
+    0xfb05feff, 0x000efdff, 0x03fb02fe, 0xfef801f8, 0xfa0400f2, 0x03ff02ff, 0xff01ee03, 0x0d05f504,
+    0x0d040bf3, 0xf6fc0007, 0x01ff01ff, 0x01020508, 0x08f80500, 0x0102fa0d, 0x0300060a, 0x07ff03fd,
+    0x01ff08fc, 0x030101fb, 0x09000108, 0x000106fe, 0xf900ff01, 0xfd04faf8, 0xfc01feff, 0x0103fff8,
+    0xfcfffe07, 0xfa06040d, 0x050103fe, 0xf7fc07ef, 0xf8ff00fc, 0x02000705, 0x0207f805, 0x050600fb,
+    0x030206f7, 0xfbfaf703, 0x02fc0602, 0x0202010c, 0x05f80106, 0x00ff020c, 0x03fb0706, 0x11050404,
+    0x06010200, 0x08f5fdf4, 0x05ff0206, 0xfb0304fd, 0xfe06fd00, 0xfafdf5fc, 0x020101fc, 0xffff01f5,
+    0xfe03fe07, 0x00070910, 0xfcff02f9, 0xfffa02fa, 0xf905fa00, 0x060206fd, 0xf901fb00, 0x0305fffd,
+    0x040904f8, 0xfcfdf70a, 0x03f907fa, 0xfef6000c, 0x05f9020d, 0x08f80609, 0xfef805fe, 0x0908ff02,
+    0x00fcfd02, 0x00f2f8f8, 0xfefd0811, 0xfa0303ff, 0x0205ff03, 0xfafdf8fd, 0xfff6fefe, 0x0df901fc,
+    0x0204f608, 0xff010a06, 0xf5fafefb, 0x00fcfeff, 0xf9f8f903, 0x040403f6, 0xf501fffc, 0xfe05fa02,
+    0x0805f9fb, 0x04eafa0a, 0x0bff0501, 0xfffafd0c, 0x09fd0809, 0x01f90407, 0xfefe0404, 0x0707fefc,
+    0x04f5fb05, 0x02f4fef7, 0x0cfd0409, 0xfa060305, 0x01080006, 0xfe02fe05, 0x00fb0102, 0x09f00600,
+    0x0602fa04, 0x05fd0400, 0xf6feffff, 0xf5020302, 0x05f4fefe, 0xff0109f8, 0xfcfe03f9, 0xfb06ff00,
+    0x0bf9fb01, 0x04e4fe05, 0x09f90e02, 0x0303fe09, 0x01041206, 0x00010602, 0xf40f04fa, 0xfb03010a,
+    0x03f6fc04, 0x00f201f3, 0x02fef413, 0xf3070900, 0x02060109, 0xfafd040d, 0xff060105, 0x0df50303,
+    0x02fd0209, 0x01fc11f9, 0xf802fffe, 0xf704ff00, 0xfff6fb02, 0xfe00fbfa, 0x010004fd, 0xf802f903,
+    0x07ecf40e, 0x04ee040f, 0x0c0007fb, 0x03fcf207, 0xff091209, 0x040404fe, 0xf31102f8, 0xf0fb0107,
+    0x02f5fb0b, 0xf8f80cfa, 0xfefdf214, 0xfc020a02, 0x08080602, 0xfc03ff0c, 0xf805fc0a, 0x04f2fe13,
+    0x03f6ef0a, 0xfdf91aee, 0xf208f909, 0xfd0bfef6, 0xf8f6f805, 0x110803fe, 0x08fd07f9, 0xf404fb08,
+    0x09ecec15, 0x10e80a10, 0x180302fb, 0xfffffdf9, 0xfcf7fafe, 0xf9fdffef, 0x050d03fb, 0x020700fb,
+    0x12f5fcfc, 0x040306fc, 0xf90c0503, 0xfe070108, 0x0bf3f6fb, 0x01faf906, 0x02050003, 0xfb070cf7,
+    0x0a0b09f9, 0x08f51202, 0x05ff0712, 0xfc0700f4, 0x1106fb05, 0xff070200, 0xfe0101fb, 0xfd0304f7,
+    0x040d0b02, 0xf4f80808, 0xf406ebfc, 0x03faf902, 0x04fd1109, 0x05fb09f6, 0x0a0c11f7, 0x07fdfbec,
+    0xffebfffc, 0xfdfcf3f1, 0xf702f6fc, 0x0904f50b, 0x05fef5fc, 0xeefa0307, 0x0109f6fb, 0xf40607fe,
+    0x0b09fb02, 0x04ff1106, 0x0cf50115, 0x060603fe, 0x05040002, 0x0104fffa, 0x060501fe, 0xfb01feff,
+    0x0c0a0afd, 0xfd050808, 0xfa06f0f1, 0xfcfbfa0b, 0x05fd0e0e, 0x02ff06fe, 0x07031405, 0x1402fd00,
+    0xedfa0ff9, 0xf8fcf0f4, 0xf501f206, 0xfafe06fd, 0x0401f404, 0xeffa090b, 0x0103f0f6, 0x050a0401,
+    0x0503fd09, 0x020b1000, 0x09f10407, 0x0707f70f, 0xfef902ff, 0x0305f601, 0x0604fb02, 0x0102f103,
+    0x010700fc, 0x01010b06, 0x0914f307, 0xf5f5fa07, 0x04030408, 0xf6060406, 0x0b050707, 0x19010004,
+    0xf9030803, 0xf501f9f6, 0x0106fa05, 0xfff70af5, 0x000df202, 0x06090a0d, 0x0a02ecfd, 0x050702ff,
+    0xfc07fe0b, 0xfd0610f6, 0x08fafb06, 0x0a03f403, 0xfcf40103, 0x0503fbf7, 0xfffefcff, 0x03fffffd,
+    0xfb0e06fa, 0x0407080b, 0x09060905, 0xfcfff903, 0x0b05fdfe, 0xecfdfc07, 0x06ff010d, 0x0ef0f809,
+    0x050007ff, 0xfe0dfa00, 0x0702f501, 0xfffd0004, 0x0405f007, 0x0a090508, 0x0107f603, 0xf70c0a01,
+    0xeefe0704, 0xfd0105ff, 0x02050406, 0x16f90000, 0x02070210, 0x0402fbed, 0xfef805fe, 0x040112fd,
+    0xfd0903fc, 0x02090b07, 0x02ff0bff, 0x0606fb01, 0xf706f5fd, 0xf9f8030c, 0xfefbfafd, 0xffebeefd,
+    0x090702fe, 0x01f601fb, 0x0104f8fc, 0xfbfbee05, 0x0704ff0d, 0x03fe00fd, 0xfdfffff8, 0xf7020406,
+    0xfbfe04fd, 0xfc0003fd, 0xf90100fd, 0x06fd0cff, 0x0204010b, 0xf504ffe6, 0xfffa0204, 0xfffd0ffa,
+    0xff080503, 0x02f20400, 0x00f60203, 0x0405fafa, 0x0206f9f4, 0xf7070605, 0x03f504ef, 0xf0ebf3f3,
+    0x0b0a03fe, 0x05e3f8f8, 0xfbfefef6, 0x02f8f4f4, 0x09010402, 0xf5f8f8f2, 0x03f7fbf5, 0x03000009,
+    0x080305fd, 0x03fa0200, 0xf2fd0100, 0xf4030d02, 0xf8f60004, 0xfc07fbdd, 0xfdf6fa08, 0x01fc00fd,
+    0x02070001, 0x09ec03f4, 0xfefbfb02, 0xf70d00fb, 0x0801f6f9, 0xf201000b, 0x02030cf4, 0xf9f1f2f2,
+    0x040700fc, 0x03e7fcf6, 0x05fcf601, 0x09fcf9ed, 0x02fff7ff, 0xf4fbf7f3, 0xfdf8f8fa, 0x0608fa05,
+    0xfe070808, 0x07fcfb10, 0x0202ffff, 0x01030403, 0xf9f9ffff, 0x0305f2da, 0x01f9fd06, 0x0107fbfc,
+    0xf604fa0a, 0x0ae8fffe, 0x07030100, 0xf30008f9, 0x02020d02, 0x010200fb, 0x030302ed, 0xfd0208f8,
+    0xfff00dfb, 0xffefff00, 0xfefbfd0a, 0x00040805, 0xfbfd03ff, 0xfcfc0409, 0x00fffdfe, 0x01fc0efc,
+    0xf0070000, 0xfc000608, 0x0800fd06, 0xfe000b06, 0xf7140bfb, 0xfcfa080a, 0x0612fffc, 0xfd08fcf3,
+    0xfefcfd00, 0xfffd06fe, 0xfb0607ff, 0xecfefbf9, 0x03090a05, 0xfd070502, 0x020301f1, 0x0208ffff,
+    0x01eb05f8, 0xfbf7f9f9, 0xf8f7f90d, 0x010c060b, 0xf90200fd, 0xffff020c, 0x0008fa03, 0x0bfc0afa,
+    0xf4020b07, 0xfe020103, 0x01f8ff08, 0x00fb0afe, 0xfd0707fa, 0xf8fa05fb, 0x050701ff, 0xff04ecfd,
+    0x0200f8fa, 0x03f8060a, 0x030000fa, 0xf502fafc, 0xfe0e0105, 0x01ff020c, 0xfc01fe0a, 0xfe05ed0a,
+    0xfc00fcf8, 0x00f9fafd, 0xfaf8ff05, 0xf907010e, 0x010806fd, 0x0a030a00, 0x0209f3ff, 0x0afe05fc,
+    0x00000303, 0xfe0c03fc, 0xfffe0306, 0x020406fe, 0xf9f80601, 0xfa01feed, 0x04fe01f9, 0xf9ffebfc,
+    0xfffffffe, 0x03040109, 0x04fefef5, 0xf20304f7, 0xff0cff0f, 0x05fc0406, 0xfcf9fefe, 0xff12eb13,
+    0xfb0cff00, 0x05fa0906, 0xf6fc0903, 0xfd010804, 0xff090ffc, 0x06fe04fe, 0x01ff07fc, 0x0cf805ff,
+    0x01f90307, 0x020d08f6, 0xff010100, 0x000702fa, 0xf7fd00f4, 0xfc04fbeb, 0x0b03fcfe, 0xf6fdef09,
+    0x03f50501, 0xfe07ff11, 0x0afef8f9, 0x02010bfd, 0xfe010611, 0x06fff8ff, 0xfefcfffd, 0xfd0af30a,
+    0xfb02fcf9, 0x02fa0810, 0x050408ff, 0xf8fff70f, 0xfd0c0a04, 0x05fe00fd, 0x01fc0f01, 0x0bf50602,
+    0xf9f4fd02, 0xfd040701, 0x0102ffff, 0xfd0afdf9, 0x0303fbfc, 0x00090008, 0x0904fb01, 0xf5fcf20a,
+    0x06f6fc04, 0xfc020410, 0x0c06fc02, 0x01000803, 0xf4f5080f, 0x08fbfbfa, 0xfc01fafc, 0xff0300fa,
+    0x020202f9, 0xff090113, 0x0e06f90b, 0xf6fcfc0f, 0xfd07ff0d, 0xfef9ff00, 0xf5fc09ff, 0x09f3fd00,
+    0xfcf9fcff, 0xfffc030a, 0xfef805fb, 0x050cfc01, 0x04fbfbf8, 0xf909fd12, 0x09fb04fe, 0xf001fd00,
+    0x07f3fd01, 0xf8ee080a, 0x0d0df706, 0x0b030501, 0xfdf610fe, 0x01fafef1, 0xfd01fa04, 0xfa0307ee,
+    0x01f80400, 0xfd0c0007, 0x0604f709, 0xedfc02fd, 0xfaf7f10f, 0xf7f1fd02, 0xf90606f7, 0x09f6fdff,
+    0xfbf9f9f0, 0xfdf40218, 0xfbf201f4, 0x070b00fa, 0xf7f003ff, 0xf804fd1c, 0xfffb0100, 0xf700f4f8,
+    0x0bf7fc00, 0xf9ec05fe, 0x110df802, 0x02020103, 0x04f604f5, 0x01ff05fb, 0x0500f708, 0xf3000efa,
+    0x07fa07fe, 0x040600f7, 0xf500f9f8, 0x01f308f8, 0xf7eded0a, 0xfdfa0300, 0x00040a03, 0x0c00f4fe,
+    0xfffcf8e6, 0xfef3fd0c, 0xf7fafbf1, 0x070800fe, 0xfcf908f6, 0xfdfdff14, 0xfc03fbfa, 0xfafaf8fc,
+    0x01fc0001, 0xfbfcfdf4, 0x0908f703, 0x080eec03, 0x03f50df8, 0x02fb0cf6, 0x09fe0cf9, 0xfc0109fe,
+    0x0bf605fd, 0x0b00f9fe, 0xfefefffd, 0xfafb02fe, 0x09f9f700, 0x03ef01ee, 0x04f8fffd, 0xfc000400,
+    0x1001fe02, 0x0315fc06, 0x09eef808, 0xfa060a00, 0xfb06f902, 0xfd05f4fa, 0x06fa03ff, 0x06fd05f2,
+    0x09feefff, 0xfc040605, 0xf009e8fd, 0x0207f009, 0xfc0208f9, 0x01f80702, 0x0af90902, 0x08fdfe09,
+    0x01f401fc, 0x07fe0105, 0xfc03f805, 0xfaf4fa08, 0x0d00ec01, 0x0beefaf6, 0x05faf7fa, 0xfa010302,
+    0x08ff0003, 0x0413fcfa, 0xfffffafa, 0xeafc0502, 0xf6fafc00, 0xfe02f903, 0x0004fb04, 0xff00fdf5,
+    0x0003f9fe, 0x03080203, 0xf608f2fe, 0xfe00ff07, 0xf8fc060b, 0x02fc0618, 0x09fd0107, 0x0e040109,
+    0xf9050805, 0xfd030913, 0x0600fc08, 0xfbf5fc1a, 0x0c040003, 0x0bf700fe, 0x0908fcf8, 0x00f8f0fd,
+    0x0906fe05, 0x0102faf1, 0xe40703fa, 0xf1f8feff, 0x00e8fb03, 0x0901fd03, 0xfa0aeefe, 0x0401ec02,
+    0x060109fe, 0x030c00f8, 0x00000300, 0xfffbfe08, 0xf9f60313, 0xfa050313, 0x07010308, 0x0c0c0af4,
+    0x010a1001, 0xfb060c15, 0xfbfdf813, 0xfdfb0017, 0x0c050d0a, 0x0bfb0606, 0x04090bfc, 0xeb03f4f8,
+    0xf50f09fd, 0x02e7fef4, 0xeb0c02f3, 0x0f0002f7, 0x02f400fb, 0x10fe0007, 0xff07f202, 0x06fff80f,
+    0x10fc0201, 0x030001f9, 0x02fc0e01, 0x03fffa02, 0xf9fdf40d, 0x040303ff, 0xfdfaf703, 0x08fa09f3,
+    0xff070600, 0xff070b0c, 0xf4fdf6fc, 0xff07f506, 0x02040906, 0xf5f005fa, 0xfbfb0000, 0xdf0efff9,
+    0xf90505fa, 0xfee8fa07, 0xf8f8f9f6, 0x180603f6, 0x0cfb0307, 0x0dfcf9fc, 0xfdf6f707, 0x09fe0412,
+    0x14fcfe01, 0xfff704f8, 0x03fefa09, 0x070900e5, 0xf800f7fc, 0x0af102f8, 0xef00fafc, 0xfdf4fff5,
+    0xfbfe00fd, 0xf5020b01, 0xf201f10e, 0x0007f7e1, 0xfffefe02, 0xeaf709fc, 0xf60c01f9, 0xff0c02ff,
+    0x01fefff7, 0x05030004, 0xf7ebf9fb, 0x0804fefb, 0x0fef0a0f, 0x0201ee00, 0xf8f2060a, 0x01fdfe0a,
+    0x00fd00fd, 0xfdfa0bf7, 0x0300f60d, 0xf60802db, 0xfa04fef5, 0xfef902fb, 0xfc040900, 0xf7f7f7fd,
+    0xfd01fc01, 0xf6f809fa, 0xf3040509, 0xff050af0, 0xf5030104, 0x02f3f9fc, 0x010cf9f5, 0x11030208,
+    0x05f9f305, 0x040b01f4, 0xfb06ff06, 0xeaf6fafe, 0x02f3050f, 0xfc02fafc, 0x04fd0505, 0xf9fc0003,
+    0xfaf704fc, 0xfcf907fa, 0x0500ff02, 0xf0f6f4fd, 0x00fb13fb, 0xf8feff00, 0x03ff130b, 0xfaf4f909,
+    0x06eefd0d, 0x02e906eb, 0xf907fe0c, 0xf7090104, 0xfc14020f, 0x0b00f0f8, 0x060000fa, 0x15ed0811,
+    0x03fbf513, 0xf610fce9, 0x0700fa04, 0xf0ff0007, 0xedf9fb10, 0x0805090a, 0x07060307, 0xecfef801,
+    0xfef1fffd, 0x0df0fe03, 0x02fc000b, 0xef03f0fd, 0xff00fff6, 0xfcfafd06, 0xf8f3f909, 0xff12fbfd,
+    0xfcff0efb, 0xff0d0600, 0x0902f5fd, 0x0003fff3, 0xf9fb0306, 0xeffdf9f8, 0xfc0dfafb, 0x0afefafc,
+    0xfafef9fd, 0x0003f705, 0xf9fef6f1, 0x05fdf7fb, 0x0df90603, 0xf5fe01fa, 0x01f6fdfd, 0xf2fcf608,
+    0x0cfd0204, 0xfcfb03fe, 0xfd01fb00, 0xe204ecff, 0xfc0302ed, 0x01edf402, 0xfbf70409, 0xfc08fbfd,
+    0xff0008f6, 0x00fffdfe, 0x0304ecfc, 0xfef904f8, 0xfef7fc02, 0xf20300fa, 0xfa13f8f5, 0x1204f9fe,
+    0xf9040602, 0x0701f8ff, 0xfdfafaf7, 0x0500f4fd, 0x07ff01f5, 0xf80502fb, 0x07f804ff, 0x01fbf905,
+    0x07fcf706, 0x01fd01fb, 0x000cfb04, 0xec00ef01, 0xfd0200f4, 0xf4f1010b, 0xfbfc0d0e, 0x0001f3fd,
+    0x050f07f4, 0x0304f600, 0xf902fb06, 0xfcf40c07, 0xfef3f900, 0xfaff0002, 0xfc0bf7fd, 0x0c0b02fb,
+    0xfb040300, 0x02fefc09, 0x00010f03, 0x0a03f901, 0x0501fef9, 0xff01f900, 0x03ff0100, 0x05fdfd01,
+    0x0503f403, 0x000e02fc, 0x0402fbff, 0xf3fff7fe, 0xfd08fcfb, 0xfaed0407, 0xf4fb0010, 0x040af604,
+    0x070403f3, 0x01fcff06, 0xfd01ff09, 0x01f1010c, 0x04fcfe03, 0xf7fe0903, 0xfffdf8f8, 0x08050dfd,
+    0x0506f7ff, 0xfa01f416, 0x01fc07ff, 0x02010105, 0x0904faf8, 0xfefffbfc, 0x0502fbef, 0x0a0400fd,
+    0x0603ee03, 0x010a0a03, 0x04fafb06, 0x00fff2fe, 0x0306ff01, 0xfeec070e, 0xfcfb0111, 0x02010002,
+    0xfcfd01f9, 0xfcf902fc, 0x0a01f204, 0x09f8fafe, 0x07f8fe00, 0xef01fefd, 0xfd02fef0, 0x0f090500,
+    0x06fffafd, 0xfb02f9fa, 0x03ff0304, 0xfc040304, 0x03fefef6, 0xfd0204f5, 0x0afcf7f9, 0x0203fa00,
+    0x0605eb02, 0xfffc0701, 0x05ffff02, 0xf6fbed09, 0x08fe12fe, 0xfd07fc04, 0xffff040b, 0xfc0209fe,
+    0xf30a0102, 0xfdfcfff7, 0x0e02fa09, 0x07030efc, 0xfef203ff, 0xf707fdfe, 0xfb09feed, 0x0205ff00,
+    0xfffdfefd, 0xfefcfdf0, 0x0506edf9, 0xf507fdf9, 0xf9f3fffb, 0xfd0604ea, 0x0806f504, 0xfc02fc06,
+    0x0a00f2ff, 0x0af80401, 0x03fc0407, 0xe7f7f411, 0x11f91001, 0xfe0cf7fe, 0x030c071a, 0x000f0e03,
+    0xf80001fe, 0x01fa05f7, 0x0f030a05, 0x090b1300, 0xfeed0c00, 0x050b0914, 0x000a0bfc, 0xf600fffc,
+    0xf30607fa, 0xfdf800f7, 0xfe08080a, 0xf00b03f6, 0xf8fdfd01, 0x040214f7, 0x070af8f9, 0x03060c03,
+    0x0605ec00, 0x0a060101, 0x09fc0f03, 0xf902f80d, 0x0a000d04, 0xfd01f8ff, 0x050bfd1e, 0xff141206,
+    0x0aff0304, 0x07020afa, 0x04030cfe, 0x0904100b, 0xfcf0110e, 0x08fd0e0a, 0x03011007, 0xf6f610f7,
+    0x010f09fb, 0xf7f4fdfc, 0xfa050d0c, 0xf5050cf2, 0xfafdfb05, 0x01011807, 0x0a09fdf6, 0x0c061204,
+    0xff04f4fd, 0x040a0601, 0x07fd110b, 0xfdfa03f9, 0x07fcf6fd, 0x0af90104, 0xf2f8ff0f, 0xfefcf900,
+    0x0408fefa, 0x070300fc, 0xfd06fefd, 0x04060202, 0xfa00f2f7, 0xfd0afb02, 0xfdf80109, 0x0a0301fe,
+    0x02ff06fc, 0x0afef900, 0x02fe01f5, 0xf80500fc, 0xf903f906, 0x0306f2f1, 0x030bfc01, 0xfa04f904,
+    0x00070204, 0xfefbfbfd, 0xf9fe02fe, 0xfaf103f9, 0x08faf502, 0x03ebfd09, 0xe8fb0706, 0xff00f0fe,
+    0xf70c06f9, 0xfd06fb05, 0x09fd07fe, 0x0c070900, 0xf4fefff3, 0xfe0901f7, 0xfcf6fc0f, 0x0b0706fc,
+    0xfd020502, 0x02fd0004, 0xfefffbf2, 0xef02ff02, 0xfafcf501, 0xff03f0f7, 0xfc0509f6, 0x00000405,
+    0x0307fa03, 0xfb04f604, 0xfbf702ff, 0xfc0203f7, 0x0a00f2fe, 0x00f3feff, 0xf0000704, 0x07fcf406,
+    0xf50003f7, 0xf001f502, 0x0e02fff9, 0x05080905, 0xf302f700, 0xfc0202f2, 0xfafb0006, 0x0f0b05fe,
+    0xf901ff05, 0x01fd0004, 0x0102faf3, 0xf1fbfb07, 0xfc01f800, 0x0101fcfd, 0xfc0010f1, 0x03000203,
+    0xfcfdfb03, 0xff01f50e, 0x00faf7fc, 0xff0c04f1, 0xfe03faff, 0x0510ff01, 0x0600040f, 0x04f7f223,
+    0xfb01fe01, 0xf5010101, 0x0e03ff06, 0xff0706fe, 0xfa05f3ff, 0x0007fbf8, 0xfd060701, 0x19070604,
+    0xfdfdfe09, 0x050b00f3, 0x0102fbfd, 0xf3f40702, 0x00feff06, 0x0103fa04, 0xfcfd15ed, 0x01ff060c,
+    0xf5f70101, 0x05fbfb0e, 0xfa04f401, 0xfe0bfff5, 0xf0ff0cfe, 0xfc1e030b, 0x0d010512, 0xfef6fe22,
+    0x0b07f00a, 0x05fa03f4, 0x11050805, 0xfa0a02fc, 0xf807fc00, 0x160ffcf8, 0x00fd06f6, 0x05fff802,
+    0x03fcf502, 0x040b03d6, 0x0206ff09, 0x02ea14fd, 0x02ff0509, 0xfd01fefb, 0xfa040bfa, 0xf702010e,
+    0xf4fb0503, 0x0606f6fd, 0xf3050808, 0x09fb02f8, 0x01ff01fc, 0xf910040f, 0x04f7ff1e, 0xfef4010d,
+    0x0f12f80a, 0x13faf2f0, 0xfe0106fc, 0x0005f9fc, 0xfa080afc, 0x201a06fd, 0x04e71203, 0xf0ffefef,
+    0x02f6f9ff, 0xfd0002d7, 0x0a070d07, 0x06ff1609, 0xfe060405, 0xfa01010e, 0xf907f608, 0xe9010105,
+    0xfdfd0a04, 0x0d05f4f3, 0xf4021803, 0x05fc0c04, 0x0604ee03, 0xfefcfefd, 0xf6fbed0d, 0xf9fc0ded,
+    0x06fdfef8, 0x0301eef3, 0x0dfdfd00, 0x00fdf7f4, 0xf90609fb, 0x050903f7, 0x09f913fe, 0xe907f1ec,
+    0x03f5fdf8, 0x00eef305, 0x04030aff, 0x08fe0808, 0xfc05fd00, 0xf9f90309, 0x0201f50d, 0xf0fe01fa,
+    0xfffa06ff, 0x0502faea, 0xf7000c00, 0x0aff0afe, 0x1206fd01, 0x0d01faf4, 0xef0afe01, 0xf40513f9,
+    0xedf303f8, 0xe90cfefc, 0x0bfd0116, 0x0c02eced, 0xf1ea01ef, 0xf8f709fa, 0x0a1102fe, 0xf50af8f5,
+    0x01fd01e8, 0x03f7fe0a, 0xfb06fc07, 0x13fdf4fd, 0x0201fcf7, 0xf2fafe08, 0x00f4f808, 0xf8f50104,
+    0x0e0301fb, 0xfafffdf2, 0xfb02ff03, 0xf804fd03, 0x00fafbf1, 0xff0806f5, 0x16fc02fb, 0x0205f8fd,
+    0xf6f8f901, 0xfc0503f2, 0xfa060609, 0x06f00106, 0x0306f90e, 0xfcfd0003, 0xff05010b, 0x09fd02fd,
+    0xfe0d0607, 0x0811f4f5, 0xfc01f9ff, 0xf8fa07fc, 0xfdfb010b, 0x0006ff04, 0x09f5fdfc, 0xffff0305,
+    0xff000af9, 0xfefe0400, 0xffee0efd, 0xfafffbfd, 0xf7fef5ef, 0x020601f7, 0x0ff5f802, 0x05fef1f4,
+    0xfaf9f7ff, 0xfcfb06f9, 0x04fe0a12, 0xfdf7feff, 0xf509fefe, 0xfa070203, 0xf9fdfd07, 0x02fb0eff,
+    0xf90afd03, 0xfe10f0fb, 0x0304fdfe, 0xf90005fc, 0xfbfa0207, 0xfc030214, 0x00f1f2fd, 0xfefbf307,
+    0xf8fc03fd, 0x0400fbff, 0xf9f509fc, 0xf703f901, 0xf202f0f9, 0xfcfe0102, 0x05f0ff01, 0x09fef2fa,
+    0xf800fbf9, 0xfaf201fb, 0x0afd000f, 0xfbfc00f6, 0xf50cfff6, 0xfefc0002, 0xf3f90101, 0x01fd10fe,
+    0xf606f201, 0xfb08e8fe, 0x100c03ff, 0xf401fff8, 0x02f8ff08, 0xff03f40b, 0xf9fafafe, 0x01fcf2f9,
+    0xf9fdf8fe, 0x08faefff, 0xfcfc01f3, 0x0401f8fc, 0xf403f9fb, 0xf5fcfe00, 0xfaf70202, 0x0702fdfe,
+    0xf40205f7, 0xf7f5fef9, 0x0e01fd0b, 0xf70003f8, 0xfb0a03f3, 0xfefefa04, 0xf8f30cf5, 0xfdfc0ffe,
+    0xf702fefd, 0xf802e7f7, 0x0f0d08fe, 0xf604fc00, 0x08f6fe0c, 0x0803f504, 0xfb02fc05, 0x00fef8ff,
+    0x01fefc00, 0x02fdf5fd, 0x00fa07f1, 0x0505fb03, 0xf7fdfbef, 0xfafcf303, 0xf4fc0aff, 0x0808fcf9,
+    0xfd0406f9, 0xfeff01fe, 0x0d06f002, 0xf90100f4, 0x0207fffa, 0x04f5ff0b, 0xf8f40bf9, 0xfaff0a03,
+    0xf6fd0601, 0xfafeeef9, 0x080200f9, 0xfe010003, 0x0af8fd09, 0x0403f703, 0x0003fe0b, 0x0001fc00,
+    0x0904fa03, 0x03000103, 0xfffc03fa, 0x02fefe0a, 0xfafbf8e5, 0xfcfff101, 0xf6f90105, 0x090201f1,
+    0x07fe06fc, 0x000406fe, 0x0505f0fd, 0xfc0304eb, 0x0405fd00, 0xfff1ff0a, 0xfdef09f8, 0xfdfe0c06,
+    0xffff0201, 0xfcfceb04, 0x050201fe, 0xfd030b01, 0x03fa0308, 0x0101f809, 0x0304fe07, 0x0003faff,
+    0x0a03f706, 0x04020207, 0x01fe04fc, 0xff04040c, 0xf9fdfeec, 0x00fff601, 0xf2f803f7, 0x0506faf0,
+    0x0af50201, 0x0405fd03, 0xfd04f207, 0xef0c00e6, 0x05070105, 0xfef4fd08, 0xfcf4fff8, 0x01fc0609,
+    0x01000204, 0xfdf7e7ff, 0x00fc0200, 0xfdfe0b04, 0x02020709, 0x0100f909, 0x010507fd, 0x0004f4ff,
+    0x1000fd07, 0x05fc0508, 0xfc0b01fb, 0x0500030b, 0x030307fb, 0x060cfb02, 0xf6fa0dfa, 0xff0101f8,
+    0x0cf707fa, 0x03020103, 0x0304fc0d, 0xee15fef0, 0x02040001, 0xfdf8f80c, 0xff01fafe, 0x06f90210,
+    0x02fefd0d, 0xfefbe707, 0xf8fb05ff, 0x05000608, 0xff030608, 0x0901fb0a, 0x01040d02, 0xfa05f901,
+    0x05fd0607, 0x06fb070b, 0x06120003, 0xf9f8fbfc, 0xf50c07e2, 0xfd0de10a, 0x08f1ffd8, 0x00041103,
+    0x0500eef5, 0xff10040a, 0x0301f00a, 0x0902fdf9, 0x000300f5, 0xf6fbfc08, 0x0604f8f8, 0xfcfbfde6,
+    0x0d03eeff, 0xff08dcfa, 0xfdfcf709, 0x11fa05f8, 0xf5fdf5ec, 0xfafeec05, 0x0703fef2, 0x0506fb01,
+    0xf6020101, 0xf1fa0302, 0xfe0ffbfe, 0x00fb07fc, 0xfc0a02e9, 0x0400e502, 0x01f301d5, 0x00010a04,
+    0xff0de5f4, 0xff0bfd08, 0x0100f306, 0x0b04f8f7, 0xfd03fdf9, 0xecfaf806, 0x0803f1ef, 0xfeffecf2,
+    0x1007effe, 0x0006dbfd, 0x0601fb0a, 0x15fafafd, 0xfffdf9dc, 0x03ffed08, 0x0804fbf8, 0x030ffc00,
+    0x02060503, 0xf1fbfeff, 0xfb0bf6f4, 0xf6f805fc, 0xfc0503f1, 0x0b06edfb, 0x00f805d3, 0x00020c00,
+    0xf71aeef6, 0xfa08fc02, 0x04feef07, 0x0603fef9, 0xfe03fefb, 0xf7fcf803, 0x03fcf9f8, 0x09fcefeb,
+    0x0a05f7ff, 0xfffcdbf8, 0x0102f602, 0x09f7f6ff, 0x0202f9cd, 0x0600f406, 0x02fb00fc, 0x011bfbfe,
+    0x0c040002, 0xf3f702fe, 0xf609f8eb, 0xeafafe00, 0xf40307e8, 0x0b00f103, 0x020205d5, 0xff0408f8,
+    0xf811fafe, 0xf7090702, 0x08fff30d, 0x060404fd, 0xfd040305, 0x00fcf8fe, 0x0704fc00, 0x08f7f2e7,
+    0x0204fdff, 0x0002daf2, 0xf80aeef8, 0x04fefbfe, 0x00f9f7cb, 0x00010110, 0x00f70302, 0xfc1ef906,
+    0x0f030400, 0xfdfc0203, 0xf60a02f4, 0xf9fbfc03, 0xf30704e8, 0x01fbf108, 0x090a02e3, 0xfa0f09f7,
+    0x0907f8fc, 0xf9080904, 0x0900f708, 0x00040309, 0xfc0603ff, 0x0f02ff05, 0x07070501, 0xfdf9fddf,
+    0xfd0003fe, 0x0201d6ee, 0xf509f1f3, 0x070303fc, 0xfd04f1db, 0xfa00060f, 0xfbfe06ff, 0xfd1bf707,
+    0x050102ff, 0x02000104, 0xfd08fff7, 0xffff00fe, 0xf80affe6, 0xfef9f90b, 0x0b0701ed, 0x020808fd,
+    0x08fdf7fd, 0xfe090808, 0x0902f9ff, 0xf6050303, 0xfe08fb03, 0x0dfbfe06, 0x070afefa, 0xf7fdffda,
+    0xff0104fd, 0x0303e0f7, 0x0008fafd, 0x0b020000, 0xfffdf4e7, 0xf9fe050c, 0xfb0805fc, 0xfd0dfb0b,
+    0xfd000101, 0x02080207, 0x0109fffa, 0x02fe03fe, 0xf90efbe4, 0xfbfef203, 0x07fd02e9, 0xfb0009f5,
+    0x030cf1fb, 0x00ff0106, 0xfe04f3fa, 0xf10b04fb, 0x020af9f8, 0x04f3fe0a, 0x0701ffed, 0xfefef5d5,
+    0x0e0405ff, 0x0103d2f6, 0xff0101fd, 0x1000fd02, 0xfdfcf300, 0xf4060003, 0xf807fff9, 0xf8fdfe0a,
+    0x0205fe06, 0xfdff0406, 0x0107fcee, 0x14f402fe, 0xf309f6e2, 0x01fee702, 0x06f302ea, 0xfbff0ff1,
+    0x0725e100, 0xfcfffe00, 0xfb07ecff, 0xf30305f9, 0x0709f2f5, 0x06fbf908, 0x07ebffea, 0xfff9fbd1,
+    0x0f06fc00, 0x0203d1f7, 0xff0100fa, 0x08fbfdf6, 0xfafff1fd, 0xef0bfc02, 0xf906f801, 0xf1da0300,
+    0xf506f90a, 0xfafb05fd, 0x010bfdec, 0xf300e5fb, 0xf80604f5, 0x000703fe, 0x0dfa0108, 0x00f200fc,
+    0xfcebe602, 0x04faf9f4, 0xf509ea03, 0xff050f09, 0x01fffcfc, 0xf408fbee, 0x0808f0ef, 0xff06eb06,
+    0xf4f80202, 0xff0703fc, 0xf4fcfc06, 0xf4fcfc02, 0x12ea01ff, 0xfc0608fa, 0xf70d0704, 0x01fbf9fe,
+    0x0207f202, 0x01fe05f9, 0xfd0204ff, 0xfafcedfe, 0x010303fb, 0xfe0c0503, 0x08020110, 0x02fd0401,
+    0xfff4ee06, 0x06fff702, 0xf400ee07, 0x03090902, 0x030204fd, 0xfd0bfbf9, 0x09fdf0fb, 0xfc02fb02,
+    0x00f90102, 0xfa07fcf9, 0xfb0607ff, 0xf803fb01, 0x03f0fd03, 0x0afc09fc, 0x010b0a07, 0x0401fb06,
+    0x0101fbfd, 0x05fffe07, 0x010307ff, 0x05fe00ff, 0x02fd0807, 0xfb11f907, 0x0505f810, 0xfb0a030c,
+    0x07fefb07, 0x0704fc04, 0xfbfeeb04, 0x0e0605f8, 0x0b0309f6, 0x0112fe01, 0xfe020408, 0xf6fdff03,
+    0x07fa0205, 0xfd0afbf4, 0x011106fd, 0xf703fc05, 0x0007fe04, 0x09fb0bff, 0x0e0501fd, 0xfb000708,
+    0xfbfdffff, 0x0103fe08, 0x020307fb, 0x0e0007f7, 0x0002010a, 0xfd12f9fe, 0x09faf606, 0xf6ff01ff,
+    0x05fbfc0f, 0x0409fffc, 0xfcfce402, 0x06fefef0, 0x0b05fffe, 0x0312fd06, 0xf9fa0f0a, 0xf3fcfdfd,
+    0xfaf20605, 0x000901f2, 0x050e05f1, 0xf707fc01, 0x0507fc05, 0x0bff0903, 0x0903fef1, 0xfc010103,
+    0xf7feff01, 0xfd02fd01, 0x030b0efc, 0x090604f7, 0x0201f4ff, 0x0313f1fd, 0x09f5fa07, 0xf3fd02f7,
+    0xff02f90c, 0x0105fcf6, 0xecfee402, 0x06f80af7, 0x0a03fb02, 0x0514f405, 0xf7f30705, 0xf40109ff,
+    0x00fa0405, 0x010006f7, 0x050b02f7, 0xff0400fa, 0x0706fcff, 0xfa010c05, 0xfd04f3fa, 0xfc000406,
+    0xf7050201, 0xfa04fb03, 0x030608f9, 0x090c02f3, 0xfb04f0ff, 0x0114fb02, 0x09fef701, 0xecf10bff,
+    0xfe09f901, 0xfd03fbfe, 0xf000e0ff, 0x04fefff3, 0x05ffef06, 0xfd0dfd04, 0xf4f90907, 0xfc060c00,
+    0x02fbfefd, 0x06000cfe, 0x070fff00, 0x04fffcf5, 0x070900fd, 0xfb01ff05, 0xf50506f9, 0x00feff09,
+    0x01fefc00, 0xf802faf7, 0x050501f6, 0x090e06f3, 0xfa01fe03, 0x090f00fd, 0x0606f501, 0xf7fe0801,
+    0xfd0afe06, 0xf502f6f9, 0xdcffe6fa, 0xf302f8f1, 0x04f8fb02, 0xf6fefff9, 0xf4f80006, 0x07f90104,
+    0x06ff01f7, 0x08fc0df7, 0x0905ff0b, 0xfef6fef3, 0xfd07fffd, 0xfd04e707, 0xf7fafcfc, 0x01fef905,
+    0x04030802, 0xfcfd01ee, 0x0b00f3ff, 0x0c0806fb, 0xf3fa06fe, 0x081404fb, 0xff08f605, 0xf5ff0203,
+    0xfb1608fe, 0xf201faf8, 0xdef7ea05, 0xfafb07ed, 0xf9fb00f8, 0xfb0202f7, 0xfef7fd00, 0x12f9ff0c,
+    0x0402fcf1, 0x05fe10fc, 0xfe00030a, 0xfcf8f8fc, 0xfa0afd0b, 0x0008e407, 0xfbf2fdff, 0xfb06fb01,
+    0x0f020b00, 0x09f8fdf1, 0x09f702f9, 0x04f8fb0f, 0x0bfdfd10, 0x0cff0c05, 0x0202ff11, 0x0107f506,
+    0xfe090302, 0x03110701, 0x00ee0ef8, 0x08070c0e, 0xffff0902, 0xfe06f809, 0xfefd0708, 0x09fe0304,
+    0xfa010002, 0x07ff13f9, 0x05000100, 0x01f6f3fe, 0xf2fceaf9, 0xff010004, 0x07000305, 0xfdfcfe03,
+    0xfa09fd00, 0xf4050400, 0x07f905f0, 0xfffcfe06, 0x00fdfd11, 0x05f909fe, 0x0101fb15, 0x0402fb0b,
+    0xf6020405, 0x090a01f8, 0x05f001f4, 0x02050904, 0xff0100ff, 0xfc02fb01, 0xfefe0204, 0x04fd06fe,
+    0xfc000002, 0x070015f3, 0xfff503fe, 0xfbf8f1fd, 0xf5fdf3f9, 0x0101ff01, 0x03fd0505, 0xf9fcfe09,
+    0xf308ff00, 0xf60b05fd, 0xf7faf9ec, 0xfdfffe02, 0x00fa050f, 0x03ff07fe, 0x0503ff0a, 0xff04f608,
+    0xf900fd0c, 0x080401fb, 0x08f003f9, 0xfc060901, 0x00ff02fb, 0xfe09fc01, 0xff06fc03, 0xfcfdfe01,
+    0xf8feff00, 0x030214f7, 0xfffa0201, 0xfafbf2f7, 0xeffbfc01, 0x02040001, 0x01fd060b, 0xfa01ff08,
+    0xfd01ff00, 0xfa0403f9, 0xf6f8f7f1, 0x0501fe00, 0x01fcff0d, 0x070009fd, 0x0603fe06, 0x0303f809,
+    0xfb0afb05, 0x0402fdff, 0x0cf0fc02, 0xfb060b01, 0x01ff0000, 0x020cfe0c, 0xfe06ff02, 0xfcfc0100,
+    0xfb0101ff, 0x060218f2, 0xfff90101, 0xf6f9f7f6, 0xf2f7f901, 0x08050400, 0x03030309, 0x0001fd02,
+    0xfe01fd00, 0xfc02fffa, 0xfcfdfae9, 0x0cfffbff, 0xfefd050b, 0x06fe10fe, 0x0800ff09, 0x0402f30a,
+    0xf505fe06, 0xff04ff00, 0x06eefe03, 0x01020707, 0xff01fffe, 0x030e040a, 0x01050008, 0xfd010307,
+    0xfd0200fe, 0x070317f0, 0x02fa0505, 0xf6fdf4f7, 0xedf9f802, 0x0203ff05, 0x0900fd08, 0x0002fd07,
+    0xfe03fefe, 0xff0401ff, 0xfafefae4, 0x04fdf801, 0x02fd080e, 0x0c030efc, 0x0901fe0b, 0x0201f608,
+    0xf600fd08, 0xff01fb03, 0x01eb0108, 0xf7000c08, 0xfcff05fe, 0x07100b03, 0xfc060202, 0xfdfe0606,
+    0xfe0205fc, 0x060112f5, 0xf9fb0402, 0xedfff6fa, 0xf2f5f501, 0x00030202, 0x04fc0307, 0xfc01ff05,
+    0xf803fdfe, 0xff02fefd, 0xfcfafbe8, 0x0ff9fa01, 0xf9fb070f, 0x030813fd, 0x05fefc0b, 0x05fbf508,
+    0xf612fc09, 0x0004fc02, 0x03e50001, 0xfcfe0708, 0xf8fe06f4, 0x0c120afe, 0xf9030406, 0xfafa0709,
+    0x020404f9, 0x050219fd, 0xfd000405, 0xf0fefbf9, 0xf6faf202, 0x0005fa04, 0xfffbfb06, 0xfd00ff06,
+    0xfe03fd01, 0x030af9f8, 0xfffaf9f1, 0x21f3fb02, 0xf5f60c0f, 0x040815f3, 0x01faf516, 0x03faf705,
+    0xf515fc07, 0x0308fff4, 0x02dc04f6, 0x02ff0408, 0xf90002f7, 0x07090802, 0xf8ff0808, 0xf9fa0a0d,
+    0x0000fef8, 0x02ff1802, 0x03fd0c07, 0xfc05fef9, 0xf0fef603, 0x070aff07, 0xfc04f505, 0xfffcf806,
+    0xfd03ff02, 0x0c16f8f1, 0xfef701f8, 0x17050109, 0x03f5f3e7, 0x0004f8f8, 0xfcfc1304, 0x02f6f805,
+    0x06f4fb05, 0x17f6fd02, 0x0703f70e, 0xfd03eeec, 0x0a0a0408, 0xf21efd06, 0xff02fdfb, 0x00f8f601,
+    0x03ff0406, 0x0bfeeaf1, 0x01f9fc02, 0xf3fb0100, 0xf4f80402, 0x0104fa01, 0xfefc06f8, 0xff02f3f0,
+    0x07fafaff, 0x01f80506, 0xfbf8ff02, 0x140105f9, 0x02fe00e4, 0x02fef602, 0xfb000403, 0x09f1fbff,
+    0xfef8fa00, 0xff00fa04, 0x01fbfa02, 0xfc0ff0ec, 0x0d0a04fd, 0xe60a0713, 0xfdfe00ef, 0xfdfbfffb,
+    0xfdfa0109, 0x01f1e8fa, 0x00eb0aff, 0xf4fe0104, 0xf6fb0702, 0x0402f508, 0xf6f802f6, 0xfc00f9ef,
+    0x08f40303, 0x06f6050c, 0xfd06fcfc, 0xff070af8, 0xeb0607e5, 0xf8effd10, 0xf4fffcff, 0xfcf8faed,
+    0xfc0300f1, 0x0306f900, 0xfb00f8f9, 0x010bfbfb, 0x0b070701, 0xf3dc0310, 0x03f108e4, 0x0b0208fa,
+    0x0100fe01, 0x02f2eaff, 0xfae20b00, 0x0101ff02, 0xfff80603, 0x0401eb0b, 0xfcfe02fe, 0x020000f5,
+    0x0ef4fc07, 0x01f30207, 0xfb07f8f6, 0x07f60bfe, 0xf00f08f5, 0xf2fefdff, 0xef01fcf1, 0xf70805f8,
+    0x04fa0603, 0x0207f705, 0xea0201fd, 0xed0311ee, 0x00020e05, 0xf7f9ff07, 0x0cf207e6, 0x17fc0204,
+    0x020500fb, 0x00ffebfd, 0xf0ddfd0c, 0xed0bff06, 0x00fffc03, 0x02feee05, 0xf6fdfc00, 0x0a040109,
+    0x1b02fc04, 0x03eb04f7, 0xf10600fd, 0xf6f40002, 0xfe0a06fb, 0xf50500f6, 0x0103fdf2, 0x01fd0907,
+    0x09eff90c, 0x0afefd01, 0xf9030c01, 0xf4f709ef, 0xfd080906, 0x130f05ec, 0x090610ef, 0x0ceef50b,
+    0xfd08fd01, 0x000900f8, 0xe9f8f813, 0xdf0c0200, 0x0400f8fe, 0xfb01f3f4, 0xfff4f2fc, 0x0c050408,
+    0x08020204, 0x00eb07f7, 0xfd080306, 0x0602f0fe, 0x040003fb, 0xfafb07f2, 0x090bfdf8, 0x08f602f7,
+    0x0af2f103, 0x07f6fef9, 0x020400f8, 0x03f301ff, 0xfc0df7fc, 0x191406fc, 0x01010dfa, 0x00eceb08,
+    0x0401f506, 0x0013eff6, 0xe5f9fa12, 0xe5fb08f6, 0xfff90303, 0x0204f6f6, 0x04e9f0f2, 0x03040bfc,
+    0xfc1006ff, 0xffe807fa, 0xfb060307, 0x110d0103, 0x02f603f6, 0x04fc04fb, 0x120af808, 0x0808fef6,
+    0x06f10609, 0x02fafb00, 0x1afffcf3, 0x10fb01f9, 0xff10edff, 0x0d01feed, 0xfe000d01, 0x05f0f202,
+    0x00f70004, 0x0213e8f1, 0xf70909ff, 0xe9f100fa, 0xfd040606, 0x0704f4fc, 0x01e8eaf9, 0xfb0204fc,
+    0xf80004fb, 0xfff1020e, 0xfdfafb0d, 0x14060205, 0xfdf301f0, 0xfe0605f9, 0x0e14fa06, 0xfe0806fc,
+    0x04f10b16, 0x03fff108, 0x1304f6fa, 0x0bf4fcf4, 0x0216f5fd, 0xfbf1f8f5, 0x01fb1104, 0x07fdf803,
+    0x08f70400, 0x060bee00, 0x01110600, 0xfdfaf8f2, 0xf6ff0307, 0x0f09fc12, 0xf2f2e503, 0xfd000303,
+    0xf0f9f7fe, 0x08fffd0b, 0x07fc070a, 0x0907f6fe, 0xfc050a02, 0xf005fbfc, 0x0cf60a06, 0x04f60802,
+    0x0007f6f0, 0x08f903f1, 0xef090310, 0x08f30b2c, 0xfc04fff6, 0xff080108, 0x0100eeef, 0x07020104,
+    0x0c060d0b, 0x030f06f5, 0xf6f0fb02, 0xf5f7030c, 0x06effdf4, 0x04040512, 0x0600fb08, 0x04faf9ff,
+    0x01fffbf7, 0x0715fd03, 0xfffb0c00, 0x08fdf108, 0xf7fe0b05, 0xea06fcff, 0x04fe0613, 0xfffe0aff,
+    0xeafcfdf4, 0x030a04f4, 0xe5010024, 0x04f81549, 0xf90308f7, 0xf807051a, 0x01fdefe2, 0x06061602,
+    0xfc101404, 0x07fe01f0, 0xf5e50400, 0x01fef707, 0xffeffafd, 0x04fff802, 0x030603f7, 0x0a05f700,
+    0xfb07eefb, 0x0407f50c, 0x02ff09f9, 0x00fbf70d, 0x00fc0400, 0xea010706, 0xfb070a01, 0x010004f8,
+    0xedf806ff, 0xfe03fff9, 0xebfb051d, 0xf9fd1134, 0x04021005, 0xf0030417, 0xefecfeea, 0xf3fe22fd,
+    0xfb150400, 0x08f3f9f8, 0xf4f10f05, 0x0502eff9, 0xf7f600f9, 0xf801ec01, 0x010714fe, 0x090b01fa,
+    0xf309fc05, 0x03f8f30b, 0xfcfd02f9, 0x0603fe09, 0xfd01fd00, 0xf9f30306, 0xec0306f5, 0xf90107f5,
+    0xfbf50204, 0xfff6fc01, 0xfbfafef8, 0xf5ff030a, 0x06ff0d07, 0xfdf3060d, 0xf0f90502, 0xeffd0efa,
+    0xfd03f5fc, 0x01e7fc09, 0xf80c070a, 0x0b03fcf5, 0xee020001, 0x0001ee06, 0xf5f90d08, 0x0105fdf1,
+    0xf7010309, 0x00f80000, 0xf906fefa, 0x130602fa, 0xfa09f204, 0x0cf90004, 0xf70705f2, 0xf80707ff,
+    0x06fef90d, 0xfcfe0b06, 0x0a0001f7, 0x01fef4f5, 0x08fc0604, 0xfef601fe, 0xf801020a, 0xf3fefffc,
+    0xf6f7fb01, 0x00e7fb09, 0xfe08ff08, 0xfffc05f7, 0xf50f0200, 0x0a04f60a, 0xf2fffe0f, 0x0000f7f6,
+    0xfffbff01, 0xfef60afa, 0xf30bfd01, 0x0e0a04f9, 0x0102fc06, 0x03fefb01, 0xfc0504fa, 0xf9050706,
+    0x0001fc01, 0xfefd0c07, 0x11ff0503, 0x08fbfbee, 0x02fd0008, 0xf9f306fb, 0x02080009, 0xfbfefb00,
+    0xf5f5f7fc, 0x01ea020a, 0x0209ff03, 0xfafb05fb, 0xfb0afe0a, 0x08010206, 0xf808050b, 0xf8fbf7f9,
+    0x04fb0002, 0xfcf505f8, 0xfc05f201, 0x09fe0504, 0x0ffdfefc, 0x020401fd, 0xff09040e, 0x00ff000e,
+    0x0002fd03, 0xfb050301, 0x12fc02fe, 0x05f8f9f7, 0xfcfcfd0a, 0xf7f508fb, 0x0802fb09, 0xfcfcffff,
+    0xfcfdfdf7, 0x02f7080d, 0x0003f9fe, 0x00f806f9, 0x0109ff08, 0x02fc1105, 0xfe0003ff, 0xfbfd02fd,
+    0xfffe02fc, 0xfdec02fb, 0xf700f4fe, 0x07f2090e, 0x08fcf800, 0x030404fa, 0xfc090012, 0x03000207,
+    0x09070703, 0xf7040002, 0x09ff01f7, 0x00fcf2fb, 0xfdf20203, 0xfe0000fc, 0x08fd0104, 0xfefcf800,
+    0xfe06f8f9, 0x04f60911, 0x0301f0f6, 0x0a020afd, 0x040409ff, 0x06fc0806, 0xfcfd0702, 0xfefb0202,
+    0xff0204fc, 0xfbf8fefe, 0xfefef9fe, 0x0b01fa07, 0x0407fe01, 0x000c040e, 0x0801010b, 0x02f904fb,
+    0x05120504, 0xf6fafcf8, 0xf9f10505, 0x13ff03fe, 0x05fa0607, 0xfb070209, 0x0cf9e8fc, 0x0200f500,
+    0xfd0300fe, 0x04020cfd, 0x10f603f9, 0x06fffc05, 0xf4fd02ff, 0xfd0000ea, 0x0305fe08, 0xfee7fdfc,
+    0x0807fa03, 0xfdfcfcf8, 0xfffc0708, 0x0206f906, 0x0401fd03, 0xf808090a, 0x03030616, 0xfef902fe,
+    0x02130605, 0x04fff6f8, 0xfaf70101, 0x06020005, 0x01fd0800, 0xff0804fe, 0x03fae4f9, 0xfa0b05fc,
+    0x0804fcfb, 0xfcfb0b04, 0x06eff7fb, 0x05ff0301, 0xeefbfbfb, 0xfdf9f8ef, 0x06f70310, 0x00f014f9,
+    0xfd0a0200, 0xf907faf9, 0xf7fb0301, 0x00fef803, 0xfdfef707, 0xf0040a0d, 0x07010403, 0x03f4fd00,
+    0x0417fb09, 0x09f9f9f6, 0x06f800fa, 0x0afbef05, 0x07fefefc, 0xfdfb04f8, 0xf9fdfd01, 0xf30303f6,
+    0x0a04fefe, 0xfdfe05ff, 0x08fef5fe, 0x07080a02, 0xfb10fafb, 0xfbfb06eb, 0xfe00fb05, 0x05fc11fd,
+    0x030c1202, 0x0100f8fa, 0xf5fcfb05, 0xfb00f805, 0xfafefa11, 0xfc00ff10, 0x01fe0204, 0xf90afdf1,
+    0x06140101, 0x06effef8, 0x0ef6fb01, 0x10fdeaf8, 0x09fafd03, 0xededfbfa, 0xf1fa0816, 0xfbfc01f8,
+    0x08ff04fe, 0xff0209f9, 0x04060505, 0x05100402, 0x080cf8fd, 0xfbfe10eb, 0xf705f6f8, 0x02000700,
+    0x0800050a, 0x03fff6f3, 0x03fefdff, 0x020b0108, 0x0300030d, 0x0304fa12, 0xfd020303, 0xf710f4fa,
+    0x0514fdfa, 0x00ec04f2, 0x0bf5f90a, 0x1afae5ee, 0x02f7020b, 0xeff5effb, 0xf2f30426, 0x12fff4f4,
+    0xfcf8ff01, 0x050603fb, 0x01060904, 0x070dfb0c, 0x0e03fff9, 0x080216f6, 0xfa03faff, 0x00fdf702,
+    0x06f70409, 0x06ecfcf0, 0x0dfdf809, 0x030b070b, 0x03fc050a, 0xff0b000b, 0xf9feff0b, 0xfd09f600,
+    0x0310fef6, 0xf1fd0100, 0x01ff000e, 0xfdf9f0f1, 0xfdfbfa0e, 0xecfdfb00, 0xf9f8fd0f, 0x1703e900,
+    0xfd03f800, 0x090808fa, 0xfaf80902, 0x0501fa06, 0xf8fc01fb, 0x01040906, 0x02f6f7fd, 0x01f5fdfc,
+    0x05f9fb07, 0x07f004f7, 0x0bf8f907, 0xfb0b0503, 0xfbfd0404, 0xf806050f, 0xf7fffb0d, 0x07fdf6fa,
+    0xfa11fefb, 0xf30c0006, 0x01ff0413, 0xf301f9ff, 0xfd03ff03, 0xf9020804, 0xfffdf0fa, 0x1306f4ff,
+    0x0104fc02, 0x05000300, 0xfbf6080a, 0x05fefe0a, 0xeff304ff, 0x010af6ff, 0xfbf801f7, 0xfef40501,
+    0x05fff609, 0x0afe08fe, 0x000401ff, 0xfefaf9fd, 0xf503020a, 0xf5080406, 0xf0fff70c, 0xfafffd00,
+    0xf70b02ff, 0x0e0afb06, 0x07fd020e, 0x03fefc0b, 0xf80807f9, 0x06091000, 0x01f8f2f3, 0x04fff907,
+    0xfef8f8fe, 0x07f80201, 0xfcf30d08, 0x0a050101, 0xfffafffc, 0x060df802, 0xf2ff00ff, 0xfef00306,
+    0x04f4f407, 0x110704fc, 0xfb05ff06, 0xfdfdf3f8, 0x0bf7ebfb, 0xffe6fff0, 0x06f60012, 0x00f80415,
+    0xfbf2f202, 0xf90ffcf4, 0x0701f3f5, 0xf609f5fd, 0xfcf8f804, 0xf40108ed, 0x0cf8f0f2, 0x0d08fc01,
+    0x06fdf403, 0x04f7f705, 0xffebeeff, 0x0e06fa09, 0x0af2f4fd, 0xf5fd05ff, 0xf8ff14fd, 0xe603fffd,
+    0xf7e90202, 0x01f906fc, 0xf506f4eb, 0xfd02fbf3, 0xeffbf8f4, 0x000607fe, 0x0c00f70b, 0xfcfc0923,
+    0xf6f4f609, 0xf6fefcf1, 0xeb04e810, 0xf5fafb00, 0xfbfcfafc, 0xf208fbed, 0x06faf7f2, 0x0f07fa03,
+    0x07fbfcfc, 0x0107f3ea, 0xfaf9fb00, 0xf302f507, 0x01fdfaff, 0xf8f803fb, 0xfefa0df9, 0xf306ff04,
+    0x02ee0afc, 0x04fb0201, 0xf8fcf7f3, 0xfc03fee8, 0xfdfc02f7, 0xfb100707, 0x0904fdfe, 0x02090307,
+    0xf706fd14, 0xf70103fd, 0xe206f920, 0x01fe05f3, 0xf6fff9f9, 0xff1f0007, 0x01070302, 0x0ff700ff,
+    0xf7f504f5, 0x0c11fcf0, 0xfd07fdf4, 0xfafef8fc, 0x0103fffd, 0xfaf40100, 0x0df8fcf9, 0xfc02f60a,
+    0xfefd0efe, 0x05ffff07, 0xfbf9090c, 0xfffc00ee, 0xf9fb11fc, 0xfa06ff08, 0x06f8f8f1, 0x1400f4fa,
+    0x0212fd11, 0x00fc07f5, 0xf802091a, 0x03fffbff, 0xfe0c05f7, 0x131a0a07, 0xf90a100c, 0xfb0107fc,
+    0xecf5fe01, 0x0a0ffcfe, 0x030503f7, 0x02f9f8f3, 0xfe0401fb, 0xf8010403, 0x0f0df7ff, 0x09fafd0e,
+    0x00030502, 0x09fdfb07, 0xfff9060a, 0x0901ffee, 0xf5fe03fa, 0x0afc0101, 0xfffafaf6, 0x09eff300,
+    0x0013ff04, 0x00fcfe04, 0x08000210, 0xfefbf5f9, 0xfe0e06fb, 0x091404fe, 0xfe0b0f0a, 0xf30806fc,
+    0xfcfb04fc, 0x0800f802, 0x090303fa, 0xf8f604f8, 0x05ff01fc, 0xf60c0803, 0x0a03f8fd, 0x08fefbf6,
+    0x0008f803, 0x0000ff03, 0xfefffa03, 0x0300fef5, 0x04ff02fc, 0xfafffbf5, 0xf5fc06fb, 0xfc00fb00,
+    0xfe0b06f7, 0xfd03fb02, 0x0800000e, 0x02fefdfb, 0xfb0208fc, 0x0704fef9, 0x03fdf9fd, 0xeefbf604,
+    0x040302f9, 0x02fe0702, 0xfef9fd04, 0xf5f100fc, 0xfdfdf600, 0xfa0afbfa, 0x05ff03ff, 0xf9fdfb0d,
+    0x04fefc05, 0x000c04fe, 0xfcfd01fe, 0x0401fc03, 0x10fbf3fc, 0xf1fbfdfd, 0xf8ff1102, 0xfdfff8fb,
+    0x031002f1, 0x0cfbf501, 0xfdfe0008, 0x0dfdfb03, 0xfafe0201, 0x0afff9fd, 0x03fcfd0a, 0xedf60509,
+    0x02060302, 0x02fa0afb, 0xf206fe05, 0xeff503fe, 0xfefeff03, 0xfe090bf4, 0x03070607, 0xff00fe0a,
+    0xfef3fe03, 0x070f06ff, 0x050e0a0a, 0x0e000007, 0x09fc0a01, 0xecf90203, 0xfd010b0e, 0x0df5fdfe,
+    0x0f0bfafc, 0x14fef3ee, 0xf9fcfd01, 0x01fafe07, 0xff0bfc0a, 0x0804fcfe, 0x0105fdfa, 0xf3ff0009,
+    0x0504010d, 0x0b04fdf3, 0x00060111, 0xecfd03fd, 0xfafc0404, 0xfd000af9, 0x041207ff, 0xff05fb0e,
+    0x0500fd09, 0x0b0a0313, 0x070b0708, 0x0afe05ff, 0xfcfaf903, 0xfd03fef8, 0xf4f8fe0e, 0xfaeff4fd,
+    0xfdfe0201, 0xf900f3ff, 0x0bfbf6f4, 0xfa07f6f3, 0x03fe00fb, 0x0105f303, 0x0400fd06, 0xf304fb01,
+    0x02f8f304, 0xfd0010f0, 0x08fe09ff, 0x03f803f4, 0x0200f009, 0x0302f405, 0xeffdfe03, 0xfc0803f4,
+    0xeff4ee08, 0xfcfbfef8, 0xfefcf1fd, 0x09050401, 0x09fcff03, 0x00faffff, 0xfbff070d, 0x02f9f803,
+    0x02050201, 0xfc05f500, 0x11feeff7, 0xfe07fdf7, 0x0605fa01, 0x0204f906, 0x06000110, 0xfa05fefe,
+    0x0400fb06, 0x000119fd, 0x05060602, 0x02fd04fb, 0x0302fa0a, 0x02010006, 0xf3010705, 0xfe0403f9,
+    0xf8f9f805, 0xfc010303, 0x0101f5fd, 0x08040009, 0x0aff0203, 0x02fd0201, 0x01fc0509, 0x05fef907,
+    0x07050401, 0x0104fcf8, 0x0cfef3f2, 0x0006fffb, 0x0507f704, 0x00040301, 0x07fd0011, 0xff050505,
+    0x01fffd08, 0x03011801, 0x09090502, 0xff0407fc, 0x00fdfc07, 0x080105fd, 0x04030304, 0xfd00fcf6,
+    0xfef90406, 0x02050603, 0x0501fdfc, 0x0904ff03, 0x07010404, 0xfffa0401, 0xfffe0108, 0xfefdfc0a,
+    0x070605fc, 0x020102f7, 0x03fcf7f3, 0x0406fffa, 0x0604fc04, 0x03ff0409, 0x02fc010b, 0xfe080404,
+    0xfefffe07, 0x01021b00, 0x0307fffd, 0xfc0604fc, 0x01fef704, 0x0afe03fc, 0x0206ff05, 0xfafbfdf8,
+    0xfefa0407, 0x03010101, 0x05fefaf9, 0x0b000001, 0x06fb0a04, 0xfefd0302, 0x00ff0311, 0xfbfa0208,
+    0xff0605fd, 0xfbfe05f2, 0x05fcf8f8, 0x0502fffe, 0x0604fafe, 0x03040606, 0xfdfa0107, 0xfe02010c,
+    0xfefef807, 0x010417f3, 0x03010000, 0xfd0a00fb, 0xfdf9f602, 0x0301fdfd, 0x0001ff03, 0xfcf9feff,
+    0x01f60406, 0x0afb00ff, 0x09fbfcfe, 0x00020402, 0x04fb020a, 0xfb06fe07, 0x0101070d, 0xfafc040a,
+    0xfefa03ff, 0xfa030600, 0x0dfc00f9, 0xfe000303, 0x0602f900, 0x01020406, 0xfa010500, 0x0506010b,
+    0xfbfe0206, 0x040714f0, 0x06fbfb02, 0xf70000fc, 0x02f9fa01, 0xfffffa01, 0x00fe0204, 0x00f802fe,
+    0x00f6fe08, 0x0300ffff, 0x06f6ffff, 0xfdfe08ff, 0x03fc040c, 0x000a060a, 0x0108010d, 0xf8fe030b,
+    0xfcfc0603, 0xfe0607fe, 0x18fdfefb, 0xfd00fd08, 0x0802fcfe, 0x07020504, 0xfafe0a03, 0x0001040e,
+    0xfafefe04, 0x040518ea, 0x01fd00ff, 0xfdfd0afd, 0x04fafb05, 0x0603fe03, 0xfbfd01fd, 0x00f50104,
+    0xfdf3fd0a, 0x08fbfc01, 0x0df402fe, 0x17f20402, 0x01f71b06, 0x00060dfe, 0xfd05fc11, 0xf7f80407,
+    0xfb00060e, 0xf7ff0bf4, 0x19f501fa, 0xfe02f701, 0x0b0d08fa, 0xfefd0403, 0xfcfd0905, 0xfef4ff20,
+    0xfdfdea04, 0xf70023e9, 0xf6fd0205, 0x0c0d0bf2, 0xf8f8f411, 0x1512fb03, 0xf9fefc02, 0xfbf2fe09,
+    0xfef3f909, 0x1ffbfd00, 0x0ff70300, 0x0c03f6ff, 0xf2fffa03, 0xff1105fb, 0xfef3f7f8, 0x0dfdfa05,
+    0xf2f6ef02, 0xfd07ed03, 0xfffef9f8, 0xfef00000, 0xfbf8fcf9, 0xfc09f2f5, 0x08fa0001, 0x040ff501,
+    0x00fd0207, 0x11f8fd07, 0x10f00cfd, 0xfaefeff6, 0xfaf2f701, 0xf3f9f2fe, 0xf5fdf4ef, 0xf8f3fcfc,
+    0x0209fbf3, 0x080b0401, 0xf409f9f3, 0x0c04fcfe, 0xf100f000, 0xff1008f7, 0x01f307e1, 0x1403f000,
+    0xf7f1f3fd, 0x07feeff4, 0xfdf9f8f7, 0x03fa0404, 0xfd05f9fb, 0x0103faf8, 0x09fdff06, 0x070eef06,
+    0x03fd0008, 0x0ffb0401, 0x0bec0ef9, 0xf5ebf0f4, 0xfbfafa05, 0xf6f6fcf1, 0xfafef2ff, 0xf8fc02fb,
+    0x0d1100ed, 0x0801fe03, 0xf205fbf3, 0x0e03fe01, 0xe802f407, 0xf50a0cf1, 0x0bfc05da, 0x1300f6ff,
+    0xf0e9eafc, 0x09f9edf5, 0xf5fafbf8, 0x02f80310, 0x0307fc03, 0x00fc0100, 0x0bfafc04, 0x090cf70a,
+    0xfffefe0b, 0x0e030afd, 0x06f00efa, 0xf2fbf6f6, 0xfdfbfb11, 0xf1f9fcf6, 0xfd00f003, 0xfcfff8fb,
+    0x1410fdeb, 0x0b020005, 0xf1fdfaf5, 0x1201f303, 0xee03fb01, 0xf91008fb, 0x09fd08e2, 0x14020101,
+    0xf6faf600, 0x06f8f7fc, 0x03fcfffa, 0xfffd0605, 0x030afe00, 0x01ff0300, 0x03010305, 0x070bf20e,
+    0x0200fe0b, 0x0908fdf9, 0x03f40cfc, 0xf5fff4f4, 0xfc00f910, 0xfdf6fbfd, 0xfb01f400, 0xfe02f3fd,
+    0x100efceb, 0x0bfdff07, 0xfffa09fa, 0x0bfaf205, 0xfd00ff06, 0xfc070c01, 0x08f904e2, 0x1105ff05,
+    0xff00fcff, 0x07fe04fe, 0x0e03f702, 0xfdfa00fd, 0x050c02fa, 0x0a0607fb, 0x00020508, 0x0003f80d,
+    0xf903f808, 0x0609fffd, 0xfcf805fc, 0xf6fcfef7, 0xfbfef909, 0x08f7f9fb, 0xff0300f7, 0x0001f904,
+    0x0b0bfced, 0x08fbff0a, 0x02fe03fa, 0x09faf305, 0x0800ffff, 0x01000b0b, 0x04fd02f5, 0x12feff05,
+    0x070208fd, 0x070103f6, 0x10fff903, 0xfdfefd03, 0xfa0cfffe, 0x0a0904ff, 0xfc010102, 0xfefcf40d,
+    0xf702fc07, 0x07060104, 0xf3f6fefb, 0xfefc03f2, 0xf9fefc03, 0x05f6f501, 0x03fe05f5, 0x01fc050b,
+    0x0b0afcf3, 0x0b00010e, 0x08020bfd, 0x08faf809, 0x06fefd03, 0x06fb060c, 0x00feff06, 0x02fcf906,
+    0xfe040dfa, 0x07fe03fb, 0x07fffe03, 0xf8fbfa07, 0xf60905fc, 0x060205fd, 0xfdf406f9, 0xfff4f709,
+    0xf505fb06, 0x030507f9, 0xeefc01f5, 0xfffe04fc, 0xfb04f4f7, 0x0cfbfa01, 0x05fe0dfc, 0xfcf8fb0d,
+    0x0705fb00, 0x00f70507, 0x07000801, 0x01ebeb07, 0xfff60702, 0x06010b0d, 0xfcfa0015, 0xf7030205,
+    0xfafe0b00, 0xf1fb020a, 0x0efbfc08, 0x01fbf804, 0xf80706ff, 0xfffffcf7, 0xf9fb0103, 0x00f2f513,
+    0xfd04f908, 0xff03fef9, 0xec02fdf2, 0x06ff00fd, 0xf8fcf0fa, 0x0d000007, 0x00fa0a01, 0xfdf3fa13,
+    0xf7fef800, 0x00f80d06, 0x0d050a02, 0xfc00fdf8, 0xf4f4e5f8, 0xf105feef, 0x0701fcf2, 0xfd07f5f8,
+    0xedebffff, 0xfbfdfd09, 0x06fd060f, 0x0df0f906, 0x0703fef5, 0xfef9f8ff, 0xf50bf215, 0xfcfffe06,
+    0xf10002fe, 0x0006f8ef, 0x05030203, 0xf4fef3eb, 0x0110fefa, 0x02080107, 0xfcfb02fd, 0x0bfa02f7,
+    0xf5f10af5, 0xfeeefd08, 0xf80002fd, 0x08ff01f0, 0xe9fef5f5, 0xff08fcf3, 0x0404f802, 0xfef7fbf7,
+    0xffea020b, 0x0603ff03, 0xfefa0113, 0x0502e913, 0x0204fef1, 0xfaf4fd03, 0x0107ff11, 0xfb02fbfa,
+    0xf40302fd, 0x030400fa, 0x08fffb0b, 0x060202f9, 0xfc080506, 0xfc01030b, 0xfe08fafd, 0x03fbfaea,
+    0x05f500fb, 0xfcf3f601, 0xf6040400, 0x0209fffa, 0xf40008ff, 0x04fe01fc, 0xf604f405, 0x00f502fb,
+    0x100203ff, 0x0c07f8fa, 0x09fbfb09, 0xf60cf511, 0x000502fd, 0xfcfcfa0c, 0x1305fef9, 0x0001fbfb,
+    0x060602f6, 0xfffdf809, 0x0cfafc03, 0x08040705, 0xf6fa0802, 0xf903fd08, 0x050b0102, 0xfffc01df,
+    0x0af6fbff, 0xfffbfc04, 0xf90a0702, 0x0303fdf3, 0x08fd06fa, 0xfdf80708, 0xf708030f, 0xfbf5f700,
+    0x0f0c08ef, 0x08fff9eb, 0x06fef809, 0xf8090e07, 0x020203fe, 0x0afefe08, 0x1603fcf0, 0x050503fb,
+    0x0dfb00fc, 0x00f2fd03, 0x05ed01fe, 0xf4ff0a00, 0xf9f003fa, 0xfe01f6fc, 0x0305040b, 0xf90304f0,
+    0x0afafd03, 0xfb01ff00, 0xfc040204, 0x0600f9f8, 0x0aff02ff, 0xfff4ff17, 0xff0b1215, 0xfafbf70c,
+    0x050b08f5, 0x01f2fcf2, 0xfbff02fd, 0x00fe0af8, 0x09fb0400, 0x0705f600, 0x05fcfcfd, 0x0803fc00,
+    0x06fb05fc, 0x05f805f9, 0xfbeffffc, 0xe50103fe, 0xfefc01f4, 0x00fffaee, 0x00fd080b, 0xfe000403,
+    0x0600fb05, 0x000407fd, 0xfa04fa01, 0x09f50101, 0x09ff050e, 0xfdf0fd12, 0xf6f90e0c, 0x0ffdfc13,
+    0xf5fafff9, 0x01f303fa, 0x000203ef, 0x01fef9ec, 0x04020200, 0xfffdfdff, 0xfc060901, 0x0001fe05,
+    0xfcff0007, 0x0503fef6, 0xf4fcfbfe, 0xe6020100, 0xfc07fbf9, 0x02fe04ec, 0xf3f50afa, 0x06010105,
+    0x070d0105, 0x00fa0903, 0xfe020002, 0x02ff0e0c, 0x0703090a, 0x06fb020a, 0xfced0c08, 0x09020110,
+    0xfdf80304, 0x09f80303, 0x0a0602ef, 0xf602e5e5, 0x0708fd06, 0xf4f4fbfc, 0x000a0e0b, 0xf5fe0608,
+    0xf605030d, 0x0602f8fa, 0xfa06faf4, 0xf7010404, 0x001001fe, 0x01fd05f5, 0xf9fafdfa, 0x00010703,
+    0xff0efa02, 0x01070b08, 0x090b0305, 0x02050906, 0x00060d05, 0x0cfc00fd, 0xfeea1211, 0x0002f902,
+    0x05040107, 0x0304fffa, 0x030c0cfc, 0xfc0ce6e6, 0xfb0bfc09, 0xecf7f7fd, 0x02090104, 0xf5000305,
+    0xfb080716, 0xfe08fefc, 0x0909f7f2, 0x01fd0407, 0xff0e03fe, 0x0803000a, 0xfafcfbfd, 0xef00fffd,
+    0x0101ef07, 0xfd06070b, 0x0b080305, 0x0d0508f8, 0xf7060b00, 0xfd05f500, 0x0e05fd11, 0xfbfc1012,
+    0xfaf7090a, 0xfcfdfe0a, 0x1a00fff7, 0xfffb07fc, 0xf90e0afb, 0x18fff80b, 0xff02070c, 0xf5f2fa02,
+    0x09fcf70a, 0x0009fd05, 0x0c080bf9, 0x080105f6, 0xf8080408, 0x0f03000e, 0x030202f6, 0x02040b01,
+    0xfbf3ff06, 0x0b0ffcf9, 0x0ffa09fe, 0x0c0a08ed, 0xee0309fd, 0xfe01f104, 0x05ffea0c, 0xeef60814,
+    0x02000101, 0x03fcfd06, 0x0afcfffa, 0xfefc02f5, 0xf40c0501, 0x1701f80e, 0xfbf1000f, 0xf4f503f9,
+    0x01f800fb, 0xfe02000b, 0x0c080df4, 0x000004f6, 0xfb060404, 0x08030a10, 0x0d05fffd, 0x01070af8,
+    0x00eafa07, 0x07fafbfc, 0x04ed0fe9, 0x080308fe, 0xf7fe0001, 0x03edf4fe, 0xf300e803, 0xe5f7030a,
+    0xfbf505f5, 0x04030007, 0xfdf7fd07, 0xfdfef804, 0xf2fd0704, 0x05000006, 0xfeed0104, 0x00fc0eea,
+    0xfefd04e8, 0x04f5f904, 0x020008f3, 0xf200fbf5, 0x00fdf8fe, 0x01fefe0d, 0x0c020502, 0x0205fefd,
+    0x05e9fd04, 0x00faf8f0, 0xfaee00f2, 0xf4f708fe, 0xfef8fdfe, 0x05fff7f3, 0xd90cfc00, 0xee0afdfb,
+    0xf0dc08f6, 0xfe0b0007, 0x01f7fe07, 0xf5fff8fe, 0xf5f40501, 0xf6f8ff01, 0xfaf90df4, 0x04ff04f4,
+    0x02070be9, 0x04f00008, 0xf9fd01ff, 0xf1fdf5f0, 0x02faf7fa, 0x02faf20d, 0x02f901fd, 0x04fefa12,
+    0xfeeffe05, 0xf3fbfcfc, 0xf8f400fd, 0xecff02f8, 0xf4f5fafb, 0x0b09fff1, 0xef060af2, 0x07fff9fd,
+    0xfcfcfbfc, 0x010efd05, 0x08fdfd07, 0xf0040300, 0xfaf5fbf9, 0xfaf903fd, 0xfc0508f5, 0x05000607,
+    0x030404fc, 0x0103fd12, 0xfafffb04, 0xfbf9f9f2, 0x0502fff9, 0xf7fefd03, 0x03f70bf9, 0xfff80205,
+    0xfcf5ff03, 0xf7ff0006, 0x0105030a, 0xf607fdf6, 0xf2f7fcf7, 0x060304ed, 0x03fb0ef6, 0x0efdff04,
+    0x0905f6ff, 0x0001f506, 0x030500f4, 0xf6010af4, 0x0501f806, 0x070006fd, 0x090003ed, 0x00fd080c,
+    0xf9020109, 0xfd0bfc06, 0xff08f90d, 0xfefd04fb, 0x03fb0afc, 0xfa05fcfd, 0x020a04fd, 0x07f8fbff,
+    0xfcfcfd03, 0xf904070d, 0xfa0dfc09, 0x010af7f7, 0xfafff9ff, 0xfcfe01f2, 0x10f808fa, 0x06fffe05,
+    0x0efefa04, 0x09f9efff, 0x050c07fd, 0xfb0508ec, 0x0a06fc0c, 0x0906fbff, 0x0c09fcec, 0xfff8fb03,
+    0x0308fc09, 0x030efbf3, 0x0304030c, 0xfffb040d, 0xfffb0901, 0xfb07fefe, 0x070e0104, 0x0701f9f4,
+    0xf804fd02, 0xfbff050d, 0xf808fc06, 0x0c00fafb, 0x03feffff, 0xf3fc01f4, 0x04fd0309, 0xfdfbf303,
+    0x0aff04fd, 0x00faf0fb, 0x0e06ff00, 0xf10b01f6, 0x0b03fa0b, 0x020cf801, 0x0c1500f0, 0x03f2f901,
+    0x0dfef604, 0x0107fbfd, 0x07010606, 0x09fe020f, 0xf9f3ff01, 0xfc06fe07, 0x0a060205, 0x00fff5ef,
+    0x0004fc02, 0x0003040f, 0xf6040201, 0x0d0300fe, 0x0e0801fc, 0xfbedfd04, 0xfbf2000e, 0x0004f4ff,
+    0xfef10205, 0xfef8ff04, 0x01fd04fc, 0xf409f606, 0x02f30705, 0xf00c07ff, 0x0600f709, 0x06040002,
+    0xfe0106ff, 0xfa00f5fa, 0xfd070703, 0x0202fefa, 0x0b08f8f8, 0xf8fc05fe, 0x0304fc03, 0x07faf900,
+    0x01fe01f9, 0x04f608ff, 0x05fe02fb, 0x02020309, 0x11fb0bfa, 0x02f20003, 0x00f70501, 0xfc02f308,
+    0x05fdfeff, 0x00f402fd, 0x0500fafd, 0xef07f9f7, 0x07f80510, 0xee06ff02, 0x030bf001, 0x0705fe05,
+    0x02010400, 0xfd01f8fa, 0xfdfff9fd, 0x03040406, 0x0a09fb02, 0xfd020b00, 0xfefdff06, 0xf8fbfc01,
+    0x03ff06fb, 0x01fc02fc, 0x08fa0706, 0x03fd0205, 0x09fa0cf5, 0xfafcfe03, 0x00020404, 0x01f90012,
+    0x0b0402ff, 0x07ff01ef, 0x0004fcfb, 0xf2fe0ff2, 0x01fd040f, 0xf6fdfc05, 0x020bf302, 0x000cf901,
+    0x04030502, 0x02f8f8fb, 0x01060200, 0x0b090004, 0x080105fd, 0xfeff0c00, 0x0505fd0b, 0xfb0100f9,
+    0xfe0904fe, 0x020b04fc, 0x070a0206, 0xff020204, 0xf5080bfa, 0xfc0402f7, 0x0711f40f, 0xfdf30812,
+    0x09fd0201, 0x050707fc, 0x0807faf9, 0x01001ffe, 0x05030b0b, 0x00f40509, 0x0514ff01, 0xf208fb01,
+    0x01020200, 0xffeef703, 0xfe100207, 0x1206fc04, 0x03010906, 0x01000cfb, 0x0f06fafb, 0x030102e3,
+    0x05020901, 0x021106ff, 0xfb06fbff, 0xfd02fefb, 0xec0d0aff, 0xfa00f9f7, 0x0611ee11, 0xeefa0818,
+    0xfff40102, 0x020e0507, 0x06fcfafc, 0x08010906, 0x06fc0c0b, 0xfc000705, 0x040b0302, 0xdffdfafe,
+    0x06fd00f6, 0x00eff8fa, 0xf8160308, 0x0803ff08, 0xff060a00, 0x0b0505fc, 0x0a07ff03, 0x08fefce9,
+    0x01fc0901, 0xfa1104f2, 0xf802fafe, 0x0ffefffb, 0xfe0503ff, 0xf5fbfef8, 0xfc0af50d, 0xf3ff0506,
+    0xfafc0500, 0x0004ff05, 0x04f7fcfe, 0x0005fc09, 0x02fc0b0f, 0x02070901, 0xfe07fef4, 0xeffbf706,
+    0x09faf9f8, 0xfeedfbf7, 0xf909fc04, 0x0202fd01, 0xfc0005fe, 0x0b050305, 0x05040304, 0x0501faef,
+    0xfbfe0cfe, 0xfe0803f0, 0x0006fefb, 0xfffe07fe, 0x08ff04fa, 0xfdf7ff06, 0x0704f816, 0x05fefe03,
+    0xfc0cfdff, 0xfd05fc01, 0x03f302ff, 0x0804f804, 0xfefd0107, 0xf808fd03, 0xfffefbf8, 0xfb02f501,
+    0x08ff06fe, 0xfff5fbfb, 0xfb09faff, 0x01fb01fd, 0x0302fefc, 0x08ff0106, 0x04fff804, 0x0300fcf1,
+    0xf70401fe, 0xfc0103fb, 0x040101f5, 0x0cf803ff, 0x06f9fef8, 0x01ff0207, 0x0502f71c, 0x0b030003,
+    0xfa0ffffd, 0xfa07feff, 0x05f8fb01, 0x02faf705, 0xfd0801fb, 0xfb02fe08, 0x02020100, 0xfc03f8fe,
+    0x03fa03fa, 0xfbecfef9, 0xfa0b0000, 0x030004f8, 0x0bfff9fc, 0x04fd040a, 0x04fdfafa, 0x01fefff8,
+    0x0009feff, 0xfffffe00, 0x08f405f7, 0xfd06fdfd, 0xf702fffa, 0x0414fa02, 0x080502fd, 0xf50908fd,
+    0xf922ff02, 0xfcf701f9, 0xf1feef0c, 0x0b1310f8, 0x10f608fe, 0x030f06fc, 0xfcfef6ff, 0x05f7ee05,
+    0x0303f7fc, 0xff0005fc, 0xed04fe11, 0xfdfdf9f4, 0xfe04f7f0, 0xfe030401, 0xff01fd02, 0x02d9ec07,
+    0x00fa0502, 0xfcf4f801, 0xfefafaf5, 0x07020301, 0xfc07f907, 0x070ffc04, 0x090c01fc, 0xf80a05f8,
+    0x04260805, 0x03f80e05, 0xedfe0312, 0x0b051400, 0x07f70dfa, 0x161a0b07, 0xfdf40507, 0x00f8ec00,
+    0xfa04f6fe, 0x00ff0903, 0xf7030115, 0x03fafff8, 0x010afcf9, 0x00020114, 0xfd010404, 0x04d7f70f,
+    0xfef80501, 0x00f7f506, 0x0302fef5, 0x1aff05ff, 0xff09f604, 0x0c07010c, 0x030efd08, 0xfd0b0206,
+    0x012305fa, 0x06fc0d06, 0xeffa0c0a, 0x00f80510, 0x03fc12fa, 0x12110b07, 0x00f00608, 0xfef8faff,
+    0xfa03f302, 0x07f70009, 0xfaff010f, 0x01fd0506, 0x030cff09, 0x0701ff13, 0x09020205, 0x01d70010,
+    0xfafd0dff, 0xfff8fd06, 0x0608fe03, 0x1604fffe, 0xf5050104, 0x09eefa02, 0xff07eb09, 0xea020603,
+    0xfe1101fd, 0x02f80707, 0x08fa0b04, 0xfbf6f017, 0xfffc120a, 0x10fd0d01, 0x04fcf507, 0x01fcfe00,
+    0x0301f6fb, 0x05fd030c, 0xfb0001ff, 0x03fb0506, 0x05fc0109, 0x02030a0e, 0x06f6ff0f, 0xffe0090a,
+    0xfdff09fe, 0xfaf70cff, 0x0107fb06, 0x0702fdf2, 0x02fcff00, 0xfe050009, 0xeffef805, 0xe1fcfff7,
+    0xfe1300fd, 0x00fbff07, 0x0bfb04fa, 0xe9fbf906, 0xfbf31203, 0x0502fefb, 0xff02edf3, 0x0302f90c,
+    0x03fdfcf3, 0x00fb0304, 0xf80104f8, 0x00f7ff01, 0x01fb030c, 0x01000403, 0x03f5f80a, 0xfce60607,
+    0xfdf10300, 0xf5f707f5, 0xfbf7ff03, 0xf90501f6, 0x10f7fcff, 0xfe020507, 0xf7fcfc0d, 0xeefdfff3,
+    0x0810fcfa, 0xfd02fe02, 0x0601fa02, 0xf80103f6, 0xfbf40a04, 0xf50a01fc, 0xfc02f0fa, 0x0103fb0c,
+    0x01fb07fa, 0xfffc04fb, 0xfefe06f8, 0xfdfbff03, 0x02030205, 0xfcfe0501, 0xfc00fe03, 0xfef20802,
+    0x02f8f8fe, 0xfaf801ef, 0x01fc0200, 0x020102fc, 0x0efd0002, 0xfb07090b, 0xf901f215, 0xfc01fefd,
+    0x0407f7ff, 0xfc00fe03, 0x00000203, 0xfd0401f5, 0x02fd0607, 0xf50700fc, 0xff05f5f9, 0xfcfcf805,
+    0x04fc07fd, 0xfcfe0300, 0x04ff0500, 0xff0503fe, 0x04fcfe0f, 0xff000404, 0xfdfffcfb, 0x01f401fc,
+    0x04f8f702, 0xfbfb00fb, 0x05f8fe00, 0x0a04fffb, 0x03fcfdfe, 0x02020306, 0xf703f109, 0xfd01fc06,
+    0x0306feff, 0x0101fe03, 0x00fdf905, 0x02fffbf7, 0x04fa0708, 0xfb0303fd, 0xfd04ebf7, 0x04f8f409,
+    0x0aff00fc, 0xfdfb09fd, 0x01ff0608, 0xfafefc01, 0xfcf9f60b, 0xfc05fdfe, 0xfef6f7fc, 0x00e1fffb,
+    0x0afbf702, 0x02fd0002, 0x06faf904, 0x0a0d13fd, 0xf70002fc, 0x000bfdf4, 0x0504faf6, 0x09f01204,
+    0xf605fa08, 0x0301f105, 0x080107f2, 0x0500f5fb, 0x06f810fe, 0xf9fa03ff, 0x04f4fefa, 0xfa0df904,
+    0xfefe0001, 0x07f90906, 0x0be60205, 0xfc00f606, 0x06f5fbfb, 0xf6020905, 0xf902fa02, 0xfcfcf802,
+    0x00f502fd, 0x07f70b06, 0xf300f906, 0x09011001, 0xf3fd090d, 0xff0e02f3, 0x06020cfe, 0x05fb1000,
+    0xfc0b0306, 0xf903ee00, 0x02ff00ee, 0x0aff0903, 0x09fb0f00, 0xf4f50606, 0x05030eff, 0x0a0cf605,
+    0xfe01fb07, 0x04f802f6, 0x0af4f900, 0xfdfcfa07, 0xfbfcfcff, 0x00fe1206, 0xf706fc03, 0x04fff801,
+    0x0dfe01f9, 0x0200ff01, 0xf7fbf9ff, 0xf9fe06fe, 0x02fb0610, 0xfe120201, 0x0801070e, 0x0d0b0b00,
+    0xfe080902, 0xf6ffedfe, 0x06fffded, 0x0cfd0bf9, 0x07ff06fd, 0x02fb0103, 0x05030a06, 0x0c08ff04,
+    0xfdfefe07, 0x00f604f1, 0x08f2fefd, 0xf2000007, 0xf9fdf7fb, 0x04fe0fff, 0xff08fefe, 0x0903f7fe,
+    0x0f0101ff, 0x0502fc00, 0x00f503fc, 0xf4fff7fe, 0x01fb0504, 0x04090306, 0x01010709, 0x0e060bfd,
+    0x05f90401, 0xf3fdf401, 0x06fef1ef, 0x0bfbfef0, 0xff02fdfd, 0x0f080804, 0x00fd0305, 0x0505ff05,
+    0xf2fdf904, 0x00020aeb, 0xf9ebf0f5, 0xf5020509, 0xfef5f3fe, 0x0dfa02ee, 0x02f80001, 0x080305fa,
+    0x0e0ffffe, 0x0509fd04, 0xfff401fc, 0x03fdf3ff, 0xff000002, 0x06040a08, 0xfbfb08f3, 0x06fe10fb,
+    0x05fcf201, 0xf9fdf504, 0x0200f7f5, 0x06fffaeb, 0xff00f1f3, 0x0e050a07, 0xfcf7fef5, 0x00f80304,
+    0xf600f204, 0x01fc0bf1, 0xfae6eef8, 0xfffc0c05, 0x02f3f700, 0x12ff01f2, 0xf7fa0500, 0x07fc0ffa,
+    0xfd0dffff, 0x06050601, 0x00f9ff00, 0x0b000801, 0x0005fdfd, 0x0508060c, 0xfef807f0, 0xfffe0df8,
+    0x0408fe00, 0xfefbf4ff, 0xff0000f4, 0x05ff00f1, 0xf801fdeb, 0x05fd0801, 0xfbf7fef7, 0xf9fd0405,
+    0x0406fc02, 0x07f40c00, 0x03eaf8f8, 0x04f70dff, 0x05f7f402, 0x05fc06f7, 0xfd010100, 0x01f80f04,
+    0xfd090600, 0x0301fffc, 0xf9f60609, 0xfffc03fc, 0x03060003, 0x0d05fd11, 0xfcfffd09, 0xf4f803fa,
+    0x040b0507, 0x04fffdf7, 0x00fe05fc, 0x060102f1, 0xfdfd0af6, 0xfdf4fcf7, 0xfbfe0005, 0xfdfb0100,
+    0x0a0108ff, 0x09f50cfc, 0xfef702fe, 0xf9000905, 0x08f9f706, 0x020407fc, 0x05040200, 0xfaf40d04,
+    0x00050f09, 0x0002f8f4, 0xf6f70907, 0x06f4f9ff, 0x01080f02, 0x0f0fff04, 0xfb00020f, 0xf6f701ff,
+    0x09060106, 0x080506f5, 0xf600fbff, 0x060304fd, 0x01fd07f4, 0xfcfff9f5, 0xf8ee0008, 0x02ef0005,
+    0x06fa0402, 0x00f916f4, 0xfaf8040a, 0xef0604fc, 0x0404f90e, 0x04110cfb, 0xfe040a06, 0xeef6100c,
+    0xfe04ff0a, 0x06fffdf2, 0xf4f90001, 0x02fe08ff, 0xfd06fffd, 0x09fc0afd, 0x06f701fe, 0x04ff0700,
+    0xf3f8ff11, 0x03080105, 0xfd00f50c, 0xfa08f901, 0x110600f8, 0xf4fdfdfe, 0x0b06fc08, 0xfff8f8fb,
+    0x01fbff02, 0x0905fa04, 0xfd0f03fd, 0xfefbfbf8, 0xfd0bfcf8, 0x0500fd07, 0xfffafdff, 0x080004f7,
+    0x02f71100, 0x010304fc, 0x0a0105fb, 0x03f90404, 0xfe010201, 0x08fc0610, 0xfff6f40d, 0x03f90900,
+    0xf70ffc0e, 0xfe08f808, 0x07faf00b, 0x0005fc00, 0x090606fc, 0xed040600, 0xf9fffd1a, 0xfefbf7f9,
+    0x00000704, 0x0c00f506, 0xfd0502fd, 0x05f9f4fa, 0x0012fbf4, 0x07f9fe09, 0x0300fffe, 0x070409fe,
+    0xfef903fd, 0xff050103, 0x06031202, 0x01fd06fc, 0x0cfffe00, 0x07f30116, 0xfce9f80c, 0xf9f8020c,
+    0xfe24fa05, 0xfe00fa07, 0x06f9f8fd, 0x03f8fe04, 0xfe020504, 0xf40703f9, 0xfaf9001e, 0x000afcf7,
+    0xfffd0604, 0x02fc0100, 0xf802fdfa, 0x04f4f502, 0x041ffdf8, 0xf600fd02, 0x06f90503, 0xff040606,
+    0x00f8fbfb, 0xfd1103ff, 0xfb0b11fe, 0xf6f2eff9, 0x10010201, 0x0704ff04, 0x02ea0911, 0xfbf80911,
+    0xff02f807, 0x0008ff00, 0xf900ff01, 0x06e80801, 0xf9f4fd00, 0x001e00fb, 0xfd070813, 0x0108fb00,
+    0xf8f90400, 0xfd0b0fef, 0xeffbeef9, 0xfcf505f4, 0xff0cfffe, 0xfc01fbee, 0x06f6ff06, 0xfe01f71d,
+    0x1102fdff, 0xfdfa08f6, 0xff0dff06, 0xedf3d6fb, 0x0aff0302, 0xf301fb00, 0x06fe090d, 0x090403f8,
+    0xf913ef06, 0xfd0b00fd, 0xf90513fe, 0x0de9030b, 0xf4fa01f7, 0x101d0bfb, 0xf8070d04, 0xf9030303,
+    0x00020001, 0x04080be7, 0xe5fcf100, 0xfaff0af0, 0xfdf0ff03, 0xfa02f8fd, 0x10fef406, 0x05fdf41b,
+    0x0610ecff, 0x03010403, 0x0b04fdfd, 0x0b0df8f9, 0xfbfdf300, 0xeafe02fd, 0x090e0306, 0x14040ae5,
+    0xf70800ff, 0x000201fe, 0xfd0100e8, 0x09fd0001, 0xf90a02f9, 0x0e0508f7, 0xf1f21409, 0xf3040703,
+    0xf8fffc05, 0xff0306ef, 0xf7040104, 0xfc0906f0, 0x01e80307, 0x0502fcf7, 0xfefff111, 0x0602fe0f,
+    0xf80df3fc, 0x08f2f207, 0x0d06faf9, 0x0c0ffffa, 0xe100f305, 0xfaff02f7, 0x050cf2fa, 0xf80209f0,
+    0xfbfb0b06, 0xfbf8ffff, 0x0f03f8ec, 0xfefbf3e4, 0xfe06fa00, 0xeadcfbf5, 0xf9ee0e0a, 0x07f80b00,
+    0xf6fbff00, 0x0003f6f5, 0x090908fe, 0x050b03f0, 0x08edff02, 0x040800fa, 0xebfbf21c, 0x01fffbe5,
+    0xf6f903fe, 0x0cf3f7fc, 0x0c01f9f2, 0x040501fd, 0xe6fffc03, 0xfe08fc06, 0xeefffff5, 0xea08fef1,
+    0x03f20909, 0xfef7fffe, 0x0bfaf70b, 0x0afee8df, 0x0401fcfa, 0xf0e8f2fd, 0x02f20608, 0x0ffdfdfe,
+    0x00fd01f9, 0xf707ff04, 0x001202f8, 0x0b050305, 0x040301f9, 0x030cfefb, 0xe9fcf00e, 0xfc00f7eb,
+    0x02f00102, 0x0cf2faf5, 0x04f4fa01, 0xf302fefe, 0xff09fffe, 0x03f804ff, 0x08fa05ed, 0x05fcf7fb,
+    0x07f6f6fc, 0x0e02fdfc, 0xf903f0f8, 0xfd01fff7, 0x0b05f90b, 0xfff104f3, 0x020006fd, 0x02fd03fe,
+    0xf4fc0005, 0xff0ffcfd, 0x0cfa0503, 0xf9fc0303, 0x03f70103, 0xfffafe01, 0xfbf3ea04, 0xf1f6f5f5,
+    0x06f90afb, 0x0002fff6, 0x00fcf105, 0xe507f909, 0xf908f807, 0x02fe02ff, 0x060a04f7, 0x0d10ff11,
+    0xe7fffd04, 0xf9060508, 0x0a05f604, 0xfdf710ea, 0x0907030b, 0x02f402e9, 0x04030702, 0x10f6fc02,
+    0xf6fdfb03, 0x000dfafb, 0xfe0906fe, 0xf3fff000, 0xfff30704, 0x08fd01fd, 0xfef7df0b, 0xf6fcf2fa,
+    0xfc030ffb, 0xfe1304f8, 0x0c010600, 0xf104fc05, 0xf7fffe0d, 0xf404fefb, 0x0a100801, 0x11100c13,
+    0xf1050100, 0xf5ff050b, 0x1704f50b, 0xfdfe0def, 0xfa09070f, 0x1a070409, 0x0a0bfbff, 0x05f5f8fe,
+    0xf807fe02, 0xf805fbf9, 0xf71105fe, 0xf6f9f4ff, 0x05f90408, 0x0afffa07, 0x0d07ed01, 0xfd0406fa,
+    0xfc09f700, 0x020e0801, 0x0a030e03, 0x0100f801, 0xfaf5fefc, 0xef03fbfe, 0x060bfe06, 0x17ed110a,
+    0x080101ff, 0xff01fcfd, 0x02fbf30b, 0xf9030303, 0xf808f805, 0x2513040e, 0xf3fa01ff, 0xe6ff0df9,
+    0x0009fa07, 0xfbfdfbfc, 0x03fe0603, 0x03f401ef, 0xfc100306, 0x02fef810, 0x01fd00f8, 0x030116f7,
+    0xfe09f404, 0x0302fd0c, 0x06fc0b05, 0x1207fafe, 0xedf800f1, 0xfde502f6, 0x0207f7f6, 0x04dfedf9,
+    0x07fffdf9, 0x0ffaf3f5, 0x0500f708, 0xf9ffed08, 0xfd06fb01, 0x09ebfe04, 0xf5edfdf5, 0xecfa1af6,
+    0x0dfffdfe, 0x00fef4fb, 0x08f000fd, 0x05f807fd, 0xff08060b, 0xef01f604, 0xf7fb0a0a, 0x03fd0ae4,
+    0xf705fb03, 0x02f6f602, 0xf8fd02fc, 0x0e00fbf9, 0xfff501ee, 0x01f808ff, 0xfc0504ed, 0xe5f9f9f8,
+    0x050107f4, 0x07e9ebf2, 0x1101f000, 0xf7ff02ff, 0xfdf7f8f9, 0x01f5f509, 0x0bf3fdef, 0xfa00fcfe,
+    0x1400fbf6, 0x07fff6f4, 0xfdfb07f8, 0xf60600fd, 0xfe080706, 0xf804f700, 0xfbf80707, 0xfffffafa,
+    0x03030600, 0x0cf6f9f5, 0xfbf300fb, 0xfef70203, 0x07fb08f9, 0xfb010607, 0xf8fe0901, 0x0b0a04f0,
+    0x07050bf4, 0xfde9faf0, 0x0706fcea, 0x10fa03f6, 0x00f7f8fc, 0xf700f501, 0x08020304, 0x0004f606,
+    0x040503fe, 0x0b04f5f4, 0xf30305fe, 0xe906fe01, 0x02050502, 0x00fef9ff, 0x07fffc0d, 0x02fefd06,
+    0x0bf90102, 0x11f901fa, 0x04fa04f9, 0xfaf40301, 0x06f506f8, 0xf5f409fa, 0xfa0004ff, 0x160800eb,
+    0xff02fff8, 0xf9fdf4ed, 0x0502f6f4, 0x0cf60402, 0x0106f4f8, 0xff0bfefd, 0x0a08090a, 0xfa03f705,
+    0xf80900fe, 0x0ffff104, 0xf7010705, 0xeb00fc01, 0x03fb080f, 0xfdfcedf7, 0x08fbfb04, 0x03ff0400,
+    0x0407fb03, 0x12f5020a, 0xfb0005fe, 0xff05f5f9, 0xf1040007, 0xf6ee0604, 0xfdf5000b, 0xf0050206,
+    0xf6f0f8f3, 0xfa010305, 0xfb010003, 0xfc01fe19, 0xfcf40502, 0xfcfb08ef, 0xfbfbf2fc, 0x030104f8,
+    0x000601fd, 0xfc03090d, 0xf7fcfafb, 0xf6faf700, 0x010203fc, 0xec0504f0, 0xfefaf7f5, 0xfcff0605,
+    0xf7f8fd06, 0xff0005f9, 0xf9ff0607, 0x02fff6fa, 0xfc020108, 0x00f80608, 0xfbf90608, 0xf10503fb,
+    0xf8ecf1f3, 0x00060304, 0x01000601, 0x0705f41d, 0xfff30300, 0xf9f703ee, 0xfb08ed0d, 0x03ff00fc,
+    0x020703fe, 0xfdff0ffc, 0xfc05fcf7, 0xf2f0fafa, 0xfefe00f4, 0xf20b06f7, 0xfb05e7f5, 0x0102fe06,
+    0xf6f20206, 0x02fe05fa, 0xfd02040d, 0xffff0104, 0x06ff0713, 0x07f70103, 0x00fb0500, 0xfa0efc01,
+    0xfef5f4fd, 0x05060906, 0x06ff0200, 0x090cfb20, 0x05f60005, 0xf9f7fcf5, 0xfd02f414, 0xf60302f9,
+    0xff0a0703, 0xf9ff13fc, 0x000603fa, 0xf9f8fff7, 0x00fdfff0, 0xf7050c01, 0xfa0cf2f7, 0xff03f904,
+    0xf3fd0306, 0x030400ff, 0x00ff0701, 0x07fb0907, 0x0e01040c, 0x01f9ff04, 0xfdf90603, 0xfa0cfe09,
+    0x0505f2fe, 0x0b0705fe, 0xfe020502, 0x0a070a19, 0x02fc07fd, 0xf7fefb05, 0x06faf815, 0xf902fdfc,
+    0x010205ff, 0xf9f71403, 0xfd0502f8, 0xf5fa04f8, 0x0303fdf5, 0xfb040a06, 0xf90ffb02, 0xfe02fc06,
+    0xf8fc0805, 0xff0b0601, 0xfdff08fb, 0xfdff0307, 0x1301040e, 0x0206050b, 0x01030b0b, 0x03040010,
+    0x0100f9fd, 0x040008fb, 0xfeff05fe, 0x08030e0d, 0xfcfa0203, 0xfa03fc07, 0x0202fb15, 0xf501fd02,
+    0x060105fe, 0xfdf81606, 0xfbfe00fb, 0xfcf9fcfa, 0x0803fef3, 0xfa010503, 0x04fe0204, 0xfb05f805,
+    0xfd020a05, 0xfd0208fd, 0xfd0004f4, 0xfff8fb04, 0x0d030312, 0xff03040b, 0xfffb0c0a, 0x0105f612,
+    0xfa0dfc00, 0xfefe06f8, 0xf8fdff03, 0x00ff0b10, 0xf5f80101, 0x030801fe, 0x0306fb0a, 0xfffb040a,
+    0x03fffb01, 0xfffe1afc, 0xfbfcf7f8, 0xf9fdffff, 0x0a0506f7, 0xfdfe0202, 0x07fc03fe, 0xfa09f309,
+    0x01030c01, 0x03010201, 0x040106f4, 0xfbfd00fd, 0x04020410, 0xf8fa080b, 0xfdfc0a0f, 0x0500f815,
+    0xfb09f702, 0x00fd0302, 0x01fe0507, 0xf5020119, 0xf8f7fc11, 0x000c06fe, 0xfe03f9fe, 0x01050a03,
+    0xfd000303, 0x000111f8, 0xf9f9f4fb, 0x00f70101, 0x0b0508f9, 0x03fcff01, 0xfdfb11f9, 0x0109f608,
+    0xfc0e01fd, 0xfffe0204, 0xfb0108fb, 0xfa060700, 0xfc070811, 0xf9f90809, 0xffff0b1b, 0xf200fe0e,
+    0xfffef8fd, 0x0bfc0002, 0x04ff05fd, 0xec090319, 0xf9eefe15, 0x0301fcf9, 0x0408fcfc, 0x00070ef8,
+    0xfd051107, 0x0bfc09f9, 0xfbfaf5fd, 0xfcfa0606, 0x0b0909f8, 0x12fa0203, 0xf1f20efd, 0xff0df808,
+    0xff0803fa, 0xfcfdff01, 0xf7080dfb, 0x0105ff04, 0x01fb03fa, 0xfe010006, 0x0bf6fcfc, 0xf5fe070a,
+    0xfbeaf205, 0xf6f20509, 0x0009fd12, 0xfdf80a03, 0x09fafefb, 0xfd0b0000, 0x030bec03, 0x1202f60a,
+    0x03fd0a02, 0xf20efafa, 0xf0fbfbfe, 0xfa0905f5, 0xfa03060a, 0x0107060c, 0xfbff00f4, 0x08f4f4fd,
+    0x01fd04f8, 0x0c00fdff, 0x05030cf7, 0x08ff0708, 0x00fc02fc, 0xf7f7fd0b, 0x06f2f60e, 0xfffa0315,
+    0x08fefb0c, 0xf7f6000a, 0x03feff22, 0x02f70e09, 0xfb02060a, 0x0b15f80c, 0x0004f20d, 0x0bfef503,
+    0x07000a03, 0xfb0ff802, 0xfbff00f4, 0x0601fef9, 0xf6f7ff0c, 0x02020612, 0x0efdf5f9, 0x01f8fcfa,
+    0xfd040afc, 0x0503fcf9, 0x05fb16f7, 0x1801ff01, 0xfaf801f5, 0xecfe0116, 0x00f7ec17, 0x0bf3fa18,
+    0x0813070b, 0xfb03f802, 0x06f9fe1f, 0x04fe0d12, 0xf901050a, 0x051ff807, 0xfbfe0205, 0xf7ff02fb,
+    0xfe070801, 0x05fff807, 0xfe0008ef, 0x07f707fc, 0xfbfefc01, 0x0808000b, 0x0efdf2fb, 0xf6fb06f9,
+    0xff020802, 0x01fe02fe, 0xfbee13f5, 0x10fefafb, 0x06f600f5, 0xfbf6fe09, 0xf70dfd18, 0xf7f0010a,
+    0x06120c11, 0x00fff301, 0x07f2fe11, 0x0403fe0e, 0xf9f60405, 0xf00ff404, 0xf9ff0e02, 0xf00c04f4,
+    0x0706fdf8, 0x08f4fe07, 0xf6fa09fc, 0xfafb07fa, 0x0200f9fc, 0xf407f1fa, 0xf7fcfaff, 0xf5fa000c,
+    0x0d030701, 0xfff909ff, 0xf4e603f4, 0x0101f8ff, 0x0afd0a01, 0x0f09f909, 0xed0d0b0d, 0xeeff0508,
+    0xfd0d0a04, 0xfff4f200, 0x0ef0fff9, 0xf6040a03, 0x00ec03f8, 0xe800f304, 0x00fc02fa, 0xf10cfefe,
+    0x0d0300fc, 0x08fc08f9, 0xeffe0504, 0xe3fe08f9, 0x0200f4fe, 0xfa03f1f2, 0xef030704, 0xfdfaf30d,
+    0x09fc06fd, 0x03ec0e05, 0xfafce807, 0xf704f902, 0x06010b04, 0x0409fcfe, 0xfb0c09fd, 0xfd07ff0d,
+    0x00ff0401, 0x03f7f402, 0x0bf801e8, 0x09040300, 0xfffbffec, 0xf0fefd0b, 0x02f8f605, 0x00fdfa06,
+    0x0dfafc02, 0xfcf602f7, 0xef02fd08, 0xe50005f9, 0x03fff001, 0x0a02ffef, 0xf00509fe, 0x00000203,
+    0xfdfe0d00, 0x06f70308, 0x0909f00d, 0x020c0302, 0x070b0401, 0x030a0703, 0x05fbfb03, 0x06f8fc0a,
+    0x0101fa0b, 0x0700fbfe, 0x0806fef5, 0x0603fff8, 0x0406f7f9, 0xf3fa06fb, 0x05fff50a, 0xf8fdfc02,
+    0xfffdf807, 0xfcf908ff, 0xfb0201ff, 0xfbf6fd0a, 0x0cfdf905, 0x12fcfff0, 0xfbfb04f9, 0x000005ff,
+    0xfb020903, 0x010a0108, 0x0604f40e, 0x0e0f05f7, 0x060b1500, 0x060c0208, 0xffebf310, 0xfdfafd00,
+    0xfc02fa0c, 0x0205fd01, 0x01120102, 0x03fdfeef, 0x0904f6fe, 0xfafffbef, 0xfb0bf2fe, 0xfff3f904,
+    0xfdfbfc04, 0xff03ff08, 0xf7f3fafd, 0x07f9f90a, 0x06020011, 0x0efffbf5, 0xfef0fd00, 0xf8fbf901,
+    0xfdfffe04, 0x03fdff00, 0x0100fe09, 0xbc1744c4, 0x0a1330eb, 0x22fb1401, 0x14f4dbfe, 0x2a0a2a04,
+    0x63231517, 0xf7fc0a1a, 0x36040bf4, 0x1d1030fd, 0x0d36b80f, 0x1d27521d, 0x10faea3b, 0x30ff1c06,
+    0xe86029f9, 0xe0170ce0, 0x061b4e1e, 0xe60d0d1c, 0x10140d07, 0xf0d4c701, 0xdeda0813, 0xf10bfa11,
+    0xf3e3f900, 0x0800e2ee, 0x30fe030d, 0x10f7ebea, 0x1cfbeef8, 0xeb00f202, 0x15e0ef07, 0xeffdf900,
+    0x17faebe2, 0xfeff1b11, 0x17e9f602, 0xf1eef909, 0xf1fe0500, 0xe512f20e, 0x02261004, 0xdaef1200,
+    0x090b0119, 0x0a04f704, 0x24fb2dfd, 0xe219dd0d, 0xf2ecfbf7, 0x13000df3, 0x2df9f8f2, 0xf8f7f3f7,
+    0xff0ee406, 0xf700e1ec, 0x13bfeefb, 0x03f30600, 0x10f902e6, 0x0a06fb12, 0xf9f3eefd, 0xf0ebe7ff,
+    0xf1091400, 0xf500f307, 0x0116051c, 0xf9eafe08, 0x09ff101c, 0x16f5f117, 0x20fe24e8, 0xf113f0db,
+    0xf3f7fd00, 0x1d0011f3, 0x0ff0e6f4, 0x0afef60d, 0xfc0ded01, 0x1200f4f6, 0x05d8fdfd, 0x10ee0c00,
+    0xfaf1ffe9, 0x0c04f716, 0xf30aedeb, 0x01f3f407, 0x0103fe00, 0x05e6e9ea, 0xe00e1134, 0x0feafb09,
+    0x05ed1203, 0x100d020c, 0x271004ce, 0x07f909e5, 0xfb01f9f1, 0x170013eb, 0x050deafc, 0x07e5f30a,
+    0x0d080802, 0x210008f5, 0x0f0dffed, 0x0bf7ef00, 0xf7f206f2, 0xf7e9fd09, 0xf30cfbf2, 0x051009fe,
+    0xf406fa00, 0x05fee4f3, 0xe50cfc2f, 0x01ebe5f9, 0x0ee10cfe, 0xf80100ff, 0x070affd2, 0xf3fefdf6,
+    0x15fff2eb, 0x0d00f4ef, 0x02f3e4fd, 0xd71e05f0, 0x1ff6e905, 0xf000fe0e, 0x0bf308f4, 0x06f6ed00,
+    0xee1f0016, 0x160f190e, 0xfcf4ecf1, 0x0cfee9fb, 0xf9181100, 0xf803fff0, 0x06030d1c, 0x084af400,
+    0x0396eff9, 0x020af005, 0xeff9280a, 0xffeb0703, 0x12f106ed, 0xfd0001f4, 0x03ffe4f1, 0xef1511fd,
+    0x0ff9dc00, 0xfa00ff09, 0x0af5f6f3, 0x0a0add00, 0xef11f703, 0xfafc0011, 0xfaeae9e9, 0x090420f9,
+    0xf211f100, 0x05fef1f1, 0xff05fff3, 0x010defff, 0x0bf008df, 0xfefaf301, 0xf90bf3fe, 0x00f80000,
+    0x18effdfa, 0xfd000fe7, 0xf909baeb, 0x07ed0d08, 0xfdfecc03, 0xf7000614, 0x0506f6f8, 0x1119f100,
+    0x0a0302fb, 0xfdfefa06, 0xf6120b0b, 0xeffa0fff, 0x0503fb00, 0xeefbf3f4, 0xf10e0607, 0x00edf1fa,
+    0x0af60eff, 0xfcf30bef, 0x06fdf406, 0xe501ecf7, 0x1824f51e, 0x04000aef, 0x05121810, 0x06fdfa11,
+    0xf7fefff8, 0xf5000c25, 0xfafcfc05, 0x1c070300, 0x19feeb12, 0x05f8f300, 0x1e2c1020, 0x0ef1000b,
+    0x2004fb00, 0xe1e3fcfb, 0x0107f4fb, 0x010229fd, 0x0fde18eb, 0xef0605e7, 0x0de5e205, 0xd7030d1f,
+    0xeeee2022, 0x0c00f809, 0x1cf415ff, 0x08fe13f0, 0xf104e401, 0x0800e40c, 0xcfe80405, 0x04000b00,
+    0x20e9dc07, 0xed02fa00, 0x1beefafb, 0x07fc06fe, 0xf301e800, 0x08fcf9de, 0x0a17fb0c, 0x08f60122,
+    0xe5190125, 0xe22fe902, 0x0803fb11, 0xedf40513, 0xff02fefb, 0xf700ea10, 0x17cf03fb, 0x02e410ea,
+    0xfe04e90b, 0xfc00f308, 0xddf71404, 0x17fae100, 0xeff6f0f9, 0xf50204fb, 0x130aeaf1, 0x0d000801,
+    0xff06fa00, 0xee1af60a, 0x03ea05ed, 0x0ef60a01, 0xf919f927, 0xfa1cf307, 0x07f7eceb, 0x02faf602,
+    0x13eceac1, 0xf700de0b, 0x0afaf8ff, 0x06f214fe, 0xfa05f804, 0xf600f1fb, 0xf6f20c10, 0x0105ed00,
+    0xe907f71d, 0xf8ef17fe, 0x050af404, 0xf80f131a, 0x0a1bff00, 0x05050bfd, 0x050909e9, 0x060ffa05,
+    0xf514f7f3, 0xef08f4f1, 0xf6f1ec00, 0xfd0aeef3, 0x06edd7da, 0xe200fa08, 0x1feff40f, 0x060c11e7,
+    0xff05ed04, 0x0400f40f, 0xf40aff09, 0x06180600, 0x0313eaf8, 0xf9e50c03, 0x000b0b10, 0x04f10408,
+    0x180ff000, 0x06f917fa, 0x020b0ef6, 0x0d2ffb00, 0xf22b04f5, 0xf510f6f7, 0x0fef0518, 0xe1eddaef,
+    0xf8e2f8f5, 0xf100ece5, 0x171610fa, 0x0615e6de, 0x09acddee, 0xec000909, 0x24e1f30e, 0x07f10f00,
+    0x1619da0a, 0xfa082300, 0x2e030a1e, 0x1beb09fe, 0xfb230000, 0xe2370320, 0xf7f805fa, 0xfdf51cf5,
+    0xf226f1fb, 0x1103fd1e, 0x15e93205, 0xe6f8a6ee, 0x02ece3f4, 0x01001201, 0xd6fce3fc, 0xf6000eee,
+    0xf6fa02ff, 0x2300fded, 0x11e2fa12, 0xf7c91000, 0x08f91703, 0xfbfd0411, 0xfef0e2f0, 0x18f90b05,
+    0xf3100700, 0xe7f906f8, 0xef0c03ee, 0x03f30fff, 0x20e604fb, 0x07df1016, 0xfcf036ce, 0xfa0ff1d2,
+    0xfbf6e6f8, 0x19001b13, 0xf1dcfaef, 0xfdf3fc06, 0x000105fb, 0x2600fd06, 0xeffa0609, 0x0cdb2600,
+    0x02fa0ee8, 0x00e7f321, 0xe7f8ebe4, 0x06f81709, 0x01eff500, 0xe8fff7f1, 0xef040afd, 0x19060605,
+    0x1cea11ef, 0xfbf5f90b, 0xf618ccd8, 0x040212e9, 0xf31506fc, 0x02000d01, 0x05ff13e8, 0xf4e61911,
+    0xed060efc, 0x0b000d1a, 0xe8040add, 0x14dd0200, 0xf40c02ed, 0xf1eefa12, 0x070af5e0, 0x150911f1,
+    0x18f90b00, 0xf7fcf6f3, 0x01fe0b0e, 0xfe12f302, 0x13e91203, 0xfb03f40d, 0xff00d6fd, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfede2200,
+    0xfff50c2c, 0x0800d9db, 0x1dede2f6, 0x29d9d81c, 0xeefdfde0, 0xfc0009ed, 0xefe0eefe, 0x12ce0900,
+    0x230fdf0a, 0x0a0b0005, 0x0302de45, 0xf7031304, 0xd0110e00, 0xf4fbefdb, 0xfcfde310, 0xdd0b2410,
+    0xe29d0cfd, 0xd50effd7, 0x0bf2fa10, 0xe80ffb07, 0xfcf1fd28, 0x2100fdfb, 0x12de19f6, 0x02ecd804,
+    0xf301f700, 0xd1001207, 0xf10411ef, 0x0bfc1800, 0x0cf6fb01, 0xfe100600, 0x1312f721, 0x0c0205f5,
+    0xf7fcfe00, 0xf7f301f6, 0x0500f4fd, 0xe4010af3, 0xebea0b07, 0xe309e6e9, 0xf4eaf712, 0xeb0ccc02,
+    0x04f3f624, 0x1b00fc0b, 0xefeef0f4, 0xf2f40bf4, 0xf80302ff, 0xe8002008, 0xf80516ee, 0xfa1f0a00,
+    0xf41006fe, 0x02f814e8, 0xfef1e60c, 0x13ef0afa, 0xfa0dfe00, 0x090604e6, 0xf0000cf6, 0xe803edf9,
+    0x02fd171d, 0xfdeff711, 0x00f8e41c, 0xfc08e7f4, 0x0409e90b, 0x0a000a0a, 0xe0fbda08, 0x00040ef5,
+    0x080f1708, 0xf4000009, 0xff0b0bf3, 0x03110900, 0xbf0204ff, 0xe3cf0b06, 0xf1fdede0, 0x1cf40514,
+    0xf10c0000, 0x0ee8f5fb, 0xee001607, 0x16f4f700, 0x101301f2, 0x17ccff10, 0x0006ebee, 0x00f12402,
+    0x111c05f0, 0xfa0016ff, 0xfa06f5f4, 0x0a07f4f7, 0x24f4ecfd, 0xf6000df6, 0x1e15f0f2, 0x02100200,
+    0xf3140010, 0x0a0f1408, 0xf71ef4f0, 0x0122f00b, 0xec2a1000, 0x100aef00, 0x06ef0a03, 0x00f710ef,
+    0x06e7f1ec, 0x09e7f401, 0xce0efd03, 0xf60dfe09, 0x0f16f4f2, 0x0a000402, 0x01f8f6ec, 0x0c04fa07,
+    0x0cf10002, 0x08000202, 0x0e16040a, 0x0a0a1100, 0xf605f70d, 0x0304000f, 0xfd14edeb, 0xfc1b0c07,
+    0xf6031c00, 0x0f0d0900, 0x02e70804, 0x080210ff, 0x0afffaf5, 0x02030003, 0xf11308f2, 0xfe01fe02,
+    0xf926fef2, 0xff00fffc, 0xfb06f8f7, 0x0bfa0105, 0x0c0300fc, 0x090008fa, 0xf4060505, 0x01031300,
+    0xf00ef2ff, 0xfff9ef0b, 0xf80df0ea, 0xfc2a0d03, 0x02fb0700, 0x0a0a01fd, 0x03db0800, 0x050106f8,
+    0x0a0400ff, 0xf6050402, 0x03150ef7, 0xfbf01bfb, 0xfb1a0e01, 0xf900fffd, 0x04031e03, 0x00f902fe,
+    0x0e07f4e9, 0x00000507, 0x03fdfe07, 0x0bfc0b00, 0xf22bf203, 0xf102fcff, 0xfe0df6ee, 0xfb36f9fd,
+    0xf1150f00, 0xf910fe05, 0x04e80bea, 0xfc070fe1, 0x11f1f3f5, 0xf6fafb05, 0xf71316f7, 0xee10e9f0,
+    0x2efffe05, 0xcb00faf1, 0x33060d0a, 0xee0b16da, 0x0bd005ee, 0xee00f802, 0xffe9f0d7, 0x13f8f900,
+    0x2a2efae7, 0xfbf320fb, 0x01f31402, 0x2ae4feeb, 0xfc1bf700, 0xea0e030c, 0xe8081b01, 0x04060804,
+    0x25200ffb, 0x17ea1854, 0x04e917fd, 0xfafde6fe, 0x41dafc0e, 0x120009d1, 0x110ee2f5, 0x00f814fe,
+    0xf8f40a04, 0x0000ffe9, 0xffedf8e5, 0x05bed300, 0xfff311c6, 0x02080df3, 0x01fef005, 0x0007e9f8,
+    0xf1024000, 0xeb0bfddf, 0xe6fbf7ff, 0xef06fff5, 0x04c00804, 0x09e8002c, 0x15ed0413, 0xf6d40edd,
+    0x06d408ff, 0x2e0013e4, 0xd604f1ee, 0x1afedf00, 0x0006fa09, 0xf500f11b, 0xebfbfbf3, 0xfc08e200,
+    0x00eb0ceb, 0x100df004, 0xfe02fa0d, 0xedf9fe12, 0xef033100, 0xeafe130c, 0xfc01e9e4, 0x0c21fa04,
+    0xf7f10a04, 0xf41ce311, 0x0408fb12, 0xf6fd07f7, 0xe6da0fe1, 0x1e0003e4, 0xd9ecc8e0, 0xf8cee413,
+    0x0ef4fbf7, 0xe900fc07, 0xeb01ff18, 0xe8f02f00, 0xf316de17, 0x16e7e80e, 0xf60cfae4, 0xebf93909,
+    0xf202e500, 0xf40efb09, 0xd1f413e7, 0x06ebd710, 0xf1e31002, 0xf529eae4, 0xea0e11e6, 0xcf14bef9,
+    0x1e18fd05, 0x0800e90a, 0xf2fed90a, 0x09f82115, 0xff11021b, 0x0600f1f5, 0xecf21a14, 0xf9fd0100,
+    0xf3ed08f8, 0xeaecdd1a, 0x0afcfa05, 0x06d0fb09, 0x08eb0300, 0x06061303, 0x1a271406, 0x241e102e,
+    0x150620f7, 0x0613f4f2, 0xfa07051c, 0xdb16ecec, 0x1b18fbfe, 0xfe000404, 0x0bfff807, 0x08061915,
+    0xfd02fffd, 0xfe00f8fb, 0xf1121413, 0x0a090a00, 0x03090a01, 0x01fa0114, 0xff010915, 0x0fdefd15,
+    0xfdf10500, 0xff0e0700, 0x101e07fd, 0x05130211, 0x0e0a0d00, 0xfe1ff5f8, 0x02fd0b1c, 0xef04fdf6,
+    0x0d270dfb, 0xf7000f0b, 0x0f17f603, 0xf70a0209, 0x0102f3fa, 0xf800f8f8, 0xfe0f0d08, 0x02180100,
+    0x0a0701ff, 0xfffa0f03, 0x050f0e16, 0x04eff311, 0xfdfa0c00, 0x04ff0cfd, 0x0b10fbf6, 0x1018f902,
+    0x000e0000, 0x0407fffb, 0x01fb0d0e, 0xf5fd1403, 0x091f0c06, 0xf300f817, 0x0e08df12, 0xe209f90d,
+    0x0407f9f7, 0xf400ef05, 0x03fdf7f2, 0xfc050200, 0x0bf300f1, 0xf7eb04f4, 0x01f7fbef, 0x04f9ff0d,
+    0xf8f10a00, 0x0de10d06, 0x140af9ee, 0x2009e8f6, 0x0207fafb, 0x050909f4, 0xfe0515ff, 0xe10be5f1,
+    0xfae40fcd, 0x0a00d4e5, 0xe7e0e1fe, 0xf80ebee0, 0x18f02df9, 0xf0001909, 0x18ee1613, 0x11d8f800,
+    0xe1f808e8, 0x0309140a, 0x2a02e707, 0xf70501ff, 0xf9091900, 0xe6fa0be9, 0xf0e7140a, 0xfd1af60e,
+    0xfbecf130, 0xeffff40c, 0x07ec2ae2, 0xf6f7fde5, 0xf8f7e0d3, 0x0500fbf9, 0x05e5fafb, 0x0c06d8e8,
+    0x180b2011, 0x0d0016ff, 0x07ea0d00, 0xf2f40100, 0xf60504ef, 0xf3fb0a1f, 0xeef1e011, 0x06fc040c,
+    0xfb010800, 0xf8eb08ef, 0xe4f70703, 0xfcff06fc, 0x03e41216, 0xf1f1f0f3, 0xdff9e30a, 0x01f7f7f9,
+    0xfbfc0dd9, 0xfc002616, 0xf1fbeef7, 0x1efff6f1, 0x08090d03, 0x19001504, 0xe51109f6, 0xfef0f900,
+    0xf106f1fe, 0xfbff000d, 0xf4f60903, 0x1005ebfb, 0x0103fe00, 0x01fa07ee, 0xfbff02f0, 0xf2ff05fc,
+    0xf9030efa, 0x0a0b00f7, 0x01ffe814, 0xef03f80b, 0x0bf4fef5, 0xf900220f, 0xeb0be6f6, 0x0bfe1508,
+    0xf710150a, 0x0a000c0b, 0xf12908f1, 0xf6ebfe00, 0xe5fffe12, 0xf2f4ff0e, 0xf30914ec, 0x0af6f913,
+    0x080efd00, 0xfef000f6, 0xf4fc00e7, 0xfd28ea05, 0xff1605f6, 0x13fcfc03, 0x09faf904, 0xf8f614f8,
+    0xfbebfb0a, 0xff000228, 0xe21c2b01, 0xfffd160a, 0x12cb02f1, 0xf0000106, 0x180f0705, 0x1a0ceb00,
+    0xf0040aeb, 0x05001a12, 0xf503000b, 0x0cfb0c06, 0x140d0600, 0xebfcf7f1, 0x10f30cf3, 0xfde7f6ff,
+    0xe5fdfdcc, 0xf8e40bd2, 0x2afcffe7, 0xedf604fb, 0xf6fef0fc, 0x0a00f101, 0x170d1ff6, 0x0f07030a,
+    0xfbf90dff, 0xed00041a, 0xf90bf50c, 0x19070200, 0x13000105, 0x08fdf909, 0x03120e0d, 0x0df71205,
+    0xfd010600, 0xd8eb020a, 0x150dfb0d, 0x0300f60a, 0xe4f7fed5, 0xfdff04de, 0x23eff60d, 0xf907dcf6,
+    0x0cfbf6e3, 0x0800ea14, 0x40f2f2f4, 0xfbfc0ef9, 0x16eafddd, 0xfb00f315, 0xfefe01ff, 0xffe00100,
+    0xf807d7f7, 0x1104f8fd, 0xefeff018, 0xfefc09eb, 0xf80e1700, 0xfc160d18, 0xf8f801f1, 0xf70def00,
+    0x0dd40e27, 0xfdf6f7e1, 0x00ef11e5, 0x03f4d20c, 0xf2f0f0ed, 0x0b00fbd7, 0x24ffd3e4, 0xedebeaf8,
+    0xfcfcc50b, 0x0600dffc, 0x0cf6fefa, 0x0ad30400, 0xf10a1eea, 0x1812fe0f, 0xecf8d8ea, 0xd6070a08,
+    0xf6030600, 0xf702ebf8, 0xe1181d1c, 0x08e609f4, 0x09c40b37, 0x0eebdf25, 0x0e0d08d1, 0xa6130d0c,
+    0x0be801f5, 0x0200f404, 0xfbf4f5f9, 0x0d09f803, 0xfbf60516, 0x050004f5, 0x060d05fa, 0xfd0efd00,
+    0xfaf21ef7, 0x0e0f07fd, 0x0cfe05f6, 0xfaeafc0c, 0xfbe80200, 0xfc00f607, 0x07fdf900, 0x2707f8f8,
+    0x0b15ff00, 0x100e0504, 0x09fb05f0, 0xbd0a1502, 0x09fa0409, 0x06000102, 0xfdf9f9f8, 0x0afdfd08,
+    0xf4fb0e14, 0x0500f8f7, 0xf91700fd, 0x0304fb00, 0xf9f320ff, 0x020408fc, 0x0dfe02f8, 0xf8f90105,
+    0x00ee0500, 0x0502f008, 0x08060003, 0x1f05f9fb, 0x0b12fdff, 0x0310fe04, 0x08fcf9fa, 0xb50d1304,
+    0x00f90609, 0xfd00f505, 0x01eef8fc, 0x09000108, 0xf2ff0311, 0x0400fefb, 0xf906fef9, 0x0307fe00,
+    0xf6f01bff, 0x04fc06f9, 0x13f502fa, 0xf5f1ff0e, 0xf5f3f100, 0xfef9f101, 0x1011fd08, 0x1e07f805,
+    0x0919fc02, 0xff14fa06, 0x07fefef8, 0xa319fd0e, 0xfbdc0cf0, 0x0600ec08, 0x05e4f902, 0x0b10f90a,
+    0xfafc0522, 0xf50008f6, 0xf70c1cff, 0x0800fb00, 0xf4da2007, 0x241803fe, 0x24edf9f6, 0xfed4fb1d,
+    0xf4e00a00, 0xf70df9fc, 0x1915f904, 0x1f00fd1d, 0x08170c0a, 0x102e050b, 0x0afa0df7, 0xf7fbfc06,
+    0x0ef7f9f3, 0xef00e707, 0xe00312e7, 0x26f3f308, 0x0e03bf0e, 0x12001238, 0x23000d04, 0x2fe40000,
+    0xdd0e010c, 0x121d13ee, 0xe209edd5, 0xe7fd2bdf, 0xee053400, 0xd8f3e5fb, 0xf1fe0414, 0x0625d121,
+    0xfbc309e7, 0xe503f9e5, 0xebf6fae9, 0xf5120401, 0xe201fbeb, 0xee00e8eb, 0x08f704df, 0x1209df02,
+    0xf1f325f0, 0xf0001a2e, 0xcbeef804, 0x26071100, 0xe8e4030e, 0x01f0f3f0, 0xe3f0cefa, 0xeef246ed,
+    0xe906f500, 0xd6f0e905, 0xeaff05fe, 0x1409cf08, 0xf0e1071a, 0xe2eff104, 0x0beaffe5, 0xe8f1f8f0,
+    0x0bf0f31f, 0xff00e6f3, 0x17e4eefe, 0x15ffe001, 0x00022ffd, 0xe100f9fc, 0x05040c06, 0xfe010400,
+    0xfaedecfc, 0x05f20002, 0x03fbf63a, 0x00f00b0a, 0x0803f000, 0xdfe2fff0, 0x06f604fe, 0x01fa0ff7,
+    0xeffa0211, 0xe7ee0205, 0xfeee09f9, 0xf201de02, 0xf7e9dc2d, 0x0b000210, 0x0ce01af7, 0x18f9edfc,
+    0xf115251a, 0xfb0003c5, 0xe6fc06e3, 0xdd1bdc00, 0x0bf5f7f1, 0xeae21214, 0x1605f559, 0x1104f90a,
+    0xf0ed1100, 0xff03eaf0, 0x03ebdfe4, 0xeae84afb, 0xf31b05fb, 0xe01bec11, 0xff06fa2a, 0xfa10eefe,
+    0xedf6fa12, 0xee00250f, 0x04f2e901, 0xdefd3707, 0xcef9f0f7, 0xff0003d8, 0x1bf520e9, 0xf0d60500,
+    0xf106feed, 0x1ef4fde7, 0xfd0a0be7, 0x3b0f0ef6, 0xeb07e500, 0xf7e40712, 0xe513fcd7, 0x10142afc,
+    0xfcc60dfa, 0x08f4f0fc, 0x07e002f9, 0x03faf313, 0x0ee90ffa, 0xf000fff9, 0xd703fefd, 0xf5e508f1,
+    0xf10e18d8, 0xfe00edec, 0xebf703e8, 0xd814fb00, 0x07f8dbfc, 0x0f0af7dc, 0x0fdcdff9, 0xf420e3fd,
+    0xddf1fd00, 0xfefd01f5, 0xf90ff0ef, 0xdff8e805, 0xe2e004f4, 0xdbf5e312, 0xdae8f7f4, 0xf50c0be3,
+    0xf1eee101, 0xf100e7f0, 0xf505fe10, 0x23f800f7, 0x44090403, 0x0200eb05, 0xfcf4e8ff, 0xf6fef900,
+    0x07f519fe, 0x020301fe, 0x0ef2f100, 0xfcf801ec, 0x04f20500, 0xf73c14f6, 0x14fe1338, 0xf9f6f1fb,
+    0xdd09fcf2, 0xd407e00f, 0x121ae709, 0xf0f7f41c, 0xcc12f2dd, 0x11000cef, 0xfd00e902, 0x2af0f3f4,
+    0x2dffe60d, 0xfa0007f2, 0xf9f7ee18, 0xfbf5fd00, 0xf0060e01, 0xe006260b, 0xdf0bd8f2, 0x06df08ea,
+    0xcff70000, 0xee6309f5, 0x04f91d16, 0xdffd2401, 0xf4d5f8de, 0x05faf40a, 0x1f19db0a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0817ecf5,
+    0x0417fce6, 0x420021f7, 0xf01be8fa, 0x22121d05, 0x0ef41b0b, 0x02000e04, 0x08e51616, 0xfd192e00,
+    0xf608f2dc, 0x07e60a0a, 0xd012f906, 0x3dedf4f2, 0x0c092500, 0xf5f01b04, 0x02050b09, 0x08da21f1,
+    0x11001011, 0x20f70f09, 0x0ff2f6e7, 0xfc23d3f4, 0xf0fc17f2, 0x2d001a0d, 0xfd080df5, 0x1307ff16,
+    0x0ff5f800, 0xee00fde5, 0x1afd0107, 0xf0fc0a00, 0xfa07ede5, 0x07ef08fb, 0xf5fef208, 0x33f7dcf4,
+    0x00051900, 0xfcf209f1, 0xfbfefd18, 0xfc0e06f4, 0xd80900f3, 0xfc07f702, 0xecfcdefc, 0xf917cff8,
+    0xe8eb2af6, 0xf1000f0b, 0xfcf8f3f6, 0x14fbfa12, 0x0a07e3f8, 0x0200cec8, 0x00f908ec, 0xf3d3fc00,
+    0xfd01ff07, 0x05f1ffc5, 0x02f8e210, 0x120de5de, 0xfb080c00, 0xf908fabf, 0xf416eb00, 0xcdfa0006,
+    0xfced03e7, 0xebf1f60f, 0xd6f505ea, 0xeadffff5, 0x05e927f1, 0xe9001c06, 0x02f9dffd, 0x0c11fa14,
+    0x041102f9, 0x1d00fdee, 0x030209c1, 0xeadfe400, 0xf7ef0d02, 0x0801f5d2, 0xfcf7e7e6, 0xfd07eff5,
+    0xf40e0900, 0xfd00f6da, 0xf738e5ef, 0x0f010b08, 0xd61afc07, 0x0f0f0d02, 0xecee1fe4, 0xeed9fd1a,
+    0xdaff080c, 0x0700c633, 0x011400e9, 0x09efec04, 0x1fb0f906, 0xf80004fb, 0x0cf611f9, 0xfe22e300,
+    0xf206d336, 0x06e61910, 0xcaf5fef5, 0x2bdafcf3, 0x03271500, 0xfefc1e0c, 0xf700fafa, 0xeaeb1af8,
+    0x06020cf1, 0x1afef21b, 0xdbfdef03, 0xdaffd113, 0x140b0f02, 0x0d00fd11, 0xfd03e4d2, 0x03d915f5,
+    0xfddf12f9, 0xe600eef5, 0x0f0808f8, 0x0c10e100, 0xfb18091f, 0x090d0a09, 0xfbf3ddf7, 0x180df301,
+    0xf8090a00, 0xf40307f4, 0xfaf811f2, 0x02f2f4fc, 0x11ec0006, 0xff04d81c, 0x02fce213, 0xf0fbe5f8,
+    0xf7dd0e01, 0xfa00f102, 0xfbefe6f5, 0xf4f1f602, 0xf8fe0df4, 0xfd00f3ff, 0xeae503f1, 0xe8f50a00,
+    0xec14fedb, 0x1110fbff, 0x0a0601f6, 0xe917ef00, 0x03f9f000, 0xfb0bf7f2, 0xfd090f08, 0x04f20212,
+    0xdde605f4, 0x0b03dff8, 0xfb0c03ff, 0x00f2f8f5, 0x020e00f9, 0xff00ebdc, 0x1f07f213, 0x13da0915,
+    0xf30a07f6, 0xf200f200, 0xf9eb030e, 0x04ed1700, 0xe50203ea, 0x130400f8, 0xf2dbfae1, 0xfefa24e1,
+    0xe3f6f200, 0x060ce5fe, 0x111a0435, 0xff110712, 0xe8010a0a, 0x1307fc07, 0xed001dfe, 0xf90fe606,
+    0xfbdff600, 0x1900f6eb, 0x05fbf6fa, 0x0ee6ea1a, 0x07fbe90a, 0xed00fbfc, 0x11e6f50c, 0x06e2fa00,
+    0xed2201f9, 0x15151714, 0xf50ef901, 0xf3f20900, 0xe00b2a00, 0xdaf6d7da, 0xf505fbf1, 0x0001000f,
+    0x27d807f2, 0xedeee6e6, 0xf601f4f2, 0x08f2fdfd, 0x2d41fced, 0x0e00e6dc, 0x02fce7f3, 0x06d63ef0,
+    0xfb06f9ea, 0x04002012, 0xf0fbf00f, 0xfcf30900, 0x0509f8fc, 0x0702030a, 0xf2fdfbfa, 0xf7030ff7,
+    0xe1fee000, 0xe90bf00b, 0xeff60308, 0xf3f11407, 0x1dd60e2a, 0x0b17e705, 0x00f1f5ec, 0xee03edf6,
+    0x1b30f9e5, 0x0100edec, 0x1204f801, 0xfafa2de8, 0xf601ff08, 0xfc00060c, 0xf5f8f4f3, 0x041e0d00,
+    0x0303e7fd, 0x10eefe06, 0xeefbf40a, 0x05f4f0f5, 0xfafff200, 0xf0fb0d07, 0xf5fb1a1c, 0xf7ec01fc,
+    0x10ebfe16, 0x0f01ec07, 0x0efffaf9, 0xe90cc8e5, 0xe522eaee, 0x1e000c20, 0xebf90014, 0x03040a15,
+    0x080ff706, 0xdd000807, 0xd6e713df, 0xdc1dec00, 0xfaf90dff, 0xe5be100e, 0xfce8e308, 0x1200f7d7,
+    0xfbef0600, 0xf4ef29b6, 0xf511010e, 0x0ff0ebed, 0xedf7f0d2, 0xfdfb0122, 0x00fc02dd, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02edd6ee,
+    0x3de0dff1, 0x1b00fdfa, 0xe3020e1b, 0xfe070503, 0x060810fd, 0xd900edee, 0x09dc12f4, 0x17d3ee00,
+    0xe11bf41f, 0x071904ec, 0x0803f4f2, 0xf600e226, 0x04244a00, 0xe1ee16fd, 0xdf090f0b, 0xe92c03f3,
+    0x08f00bde, 0xf3def113, 0x0ef11dec, 0xf2db06f2, 0x1e01f900, 0x16000906, 0xf4f906fd, 0x09f3f107,
+    0xe90bd7f3, 0xee00e5fb, 0xe4dd0ee7, 0xf9e3fd00, 0xf2e50c0b, 0xff09fb02, 0xf901fafc, 0x0107e114,
+    0xe9f6ef00, 0xfadb1100, 0xf30ffdf4, 0x070e0000, 0x10f605f5, 0xfb11d9f5, 0xf4f5e7f2, 0x03071003,
+    0xdb090bf6, 0xed00f9fa, 0x1504daf0, 0xfafef50c, 0x000b0ae7, 0xe600f813, 0x010f0af3, 0xc4021b00,
+    0x000bf5fb, 0x00e5050a, 0xfef705f7, 0x00ee24ee, 0x07ffdf00, 0x12050df8, 0xf50a0ef8, 0xfc02fcfa,
+    0x03fb080a, 0x0f19f5df, 0x08030ffb, 0xf7fc060f, 0xfe16f2e9, 0x0a000bf7, 0x09fff005, 0xf1ee1c0c,
+    0x000e1008, 0x01001e29, 0xf7f10b16, 0xe2ddff00, 0x0f11020a, 0x04e908f6, 0x0603ebfd, 0x06f612ec,
+    0x01efeb00, 0xef1410ec, 0xf911fd03, 0x15f00305, 0x0cf50808, 0xf0fb0dea, 0x01111ffe, 0xed06cd0c,
+    0xf0f90915, 0x020004f8, 0x24cfefe5, 0xe002fad7, 0x05fef7fe, 0xf30006f6, 0x310ff5f9, 0x1c0d0300,
+    0xd8fef5ff, 0x0c0f141d, 0x2a00ec07, 0x1bf8fbeb, 0xfc20fb00, 0xe802ecdd, 0x0ee81b06, 0x05ec01fe,
+    0x03ea0316, 0x09f2df14, 0x06fa1620, 0xf212e7f2, 0xf4ece5fa, 0x0000f9fa, 0x1eddedf2, 0xfbf603f8,
+    0xf507e1f1, 0xfd000106, 0x03fbf903, 0x23dcd600, 0xe10d0903, 0xfaf50512, 0x170ce6f6, 0x05fb070b,
+    0x110c0300, 0xf4fcfdce, 0xf6081908, 0x05d8fdf8, 0xf3e105f3, 0x10e7f903, 0xf504ea36, 0xfdfbfaee,
+    0xfceef1fc, 0x0500f205, 0x2204ec12, 0xf8040408, 0xeb03f1eb, 0xf6000e27, 0xd9fbf504, 0x18fde100,
+    0xed1a0008, 0xfceefd00, 0xf4fd0500, 0x040d1a08, 0x010cfa00, 0xfb06fbf7, 0xf4070d08, 0xe80ef5fb,
+    0xe8e10cf1, 0x01f101f6, 0x0000f519, 0xf9fbe8fd, 0x1b10ee0c, 0x01000905, 0x0df10114, 0x091f0e17,
+    0xea0c0e06, 0xec001315, 0xcd0508f4, 0x11000600, 0xe81b03fd, 0xfaeefce9, 0xfb061f13, 0x0cec0a03,
+    0x10010000, 0xf3f4f9f3, 0x0c1116fe, 0x03081109, 0x03db0b04, 0xffe2fc05, 0xf5eb02fb, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf505fee6,
+    0x10f0fbf5, 0xf5000704, 0x3df4140d, 0xf01e02ed, 0x12a1ea0b, 0xf200f9fd, 0xf6f90103, 0xfc200400,
+    0x0e13ebfb, 0x18ff11fb, 0x24fb0af5, 0x17e40afa, 0x010e0400, 0x0717ff14, 0xf9ee11f5, 0x0f0a11df,
+    0x0508f408, 0x0e0ef714, 0x0dfa270a, 0xffeeef03, 0x17eddfef, 0x0800e500, 0x0aed0ce8, 0x01f10f10,
+    0x0a02e108, 0xfa00f1f5, 0x0efcef03, 0x0102f100, 0xf8fdf5e5, 0x0d06f81e, 0xfff605db, 0x0bf501fc,
+    0x04f41700, 0xf9f8fcf1, 0xf9f8fefe, 0xe81503f8, 0x04fbfcf8, 0x07fff718, 0x14fd18f6, 0x04f603e9,
+    0xf60dd8f9, 0x0200f8f2, 0x200ce5ff, 0x00c7fe00, 0x0f09c3da, 0x0200d2cb, 0x1904fa0c, 0x1cf9f600,
+    0xff00fe05, 0x0514f60a, 0xe406e3ea, 0xd10fe70c, 0xefe43200, 0xfe0810f0, 0xe50cfbfc, 0xf12a040c,
+    0xedfb07e3, 0xfff804ed, 0xfe0702f6, 0x02f5fee9, 0xf701fdfe, 0xfe00eeca, 0x18fff5e9, 0xedfce3ec,
+    0x12dc0ac9, 0xfe000b36, 0x0c1f16f7, 0x2d0a1700, 0xfafd0a08, 0x061508f0, 0xe121dec5, 0xec160a06,
+    0xe9fe1600, 0xea02e6f5, 0xf20e03f9, 0xfc12ed1b, 0xf7100f29, 0xf607f2d3, 0xe9eae9ee, 0xf2e0fa16,
+    0xf5e72500, 0x0f0022fd, 0x091f13e2, 0x11110403, 0x0bdee6f1, 0xe900fafd, 0x1d160c03, 0x1df01400,
+    0x02ede706, 0xfbfe1d19, 0xff1203f7, 0x38d001f3, 0xf9142c00, 0xea13f21b, 0x0ef1e0e4, 0xeeed06f7,
+    0x000cfd02, 0x2b000c19, 0xe6eb0af4, 0xed06e804, 0x1bf50df5, 0x12001608, 0x2401f6e1, 0xebf4150d,
+    0x00f7fee9, 0x0900f9fb, 0x1209f9f2, 0x04d21b00, 0xf1fcebfc, 0xfb0dfe06, 0xf801f0f7, 0x13fa040d,
+    0xf1062100, 0xf60bf100, 0x0912ff04, 0xffecf705, 0xfad90308, 0xf5fdee2f, 0xc80708e7, 0x0208f602,
+    0x0efe0ef0, 0x10000ced, 0xfeebfbea, 0xede619fe, 0x07051306, 0x050004f0, 0xe6ea01fa, 0x13100200,
+    0x07e6f600, 0xfd0cf3f6, 0x00f7f90e, 0x0014fa08, 0x03fa1b00, 0x0010e9ec, 0xfb16fe03, 0xfeda0310,
+    0xfdf00d0a, 0xe519f516, 0xe9081609, 0x0f1feaff, 0x0af80910, 0xf900e6fe, 0xf9e6fff8, 0xfc0123f8,
+    0xecfd04fe, 0x0e00f9f7, 0xede705ed, 0xf4fd0300, 0x04010dee, 0x0010ebf6, 0x12effa08, 0xff080c00,
+    0x0ef4fc00, 0x17fd0b07, 0xf3030ffd, 0x0df41108, 0xf5f014f4, 0xedfbfff1, 0x03fa131c, 0x010af207,
+    0x0b1ffbfd, 0x01001507, 0x05f70af9, 0xfef41808, 0xeefafe17, 0xe900071c, 0xf3280ffa, 0xf311f900,
+    0x14f60e0a, 0x0000ea13, 0x0ff90d0d, 0xfffc0203, 0x04e7fb00, 0x0306070a, 0xfa170c00, 0xfe151804,
+    0xee050dfa, 0x0d11fefd, 0xfa0ef4fd, 0xd70be109, 0x131808f7, 0xfb00160b, 0x01f4ed06, 0xef020804,
+    0xf9fcf5ff, 0xed00021d, 0x122711f7, 0xf816f900, 0x11080809, 0xfdfffffa, 0x010307fe, 0xf2f709fd,
+    0xf8f7fb00, 0x0815f9fc, 0x00150e03, 0xf90a0c03, 0xf802f9f7, 0x03090006, 0x0cfd010a, 0xea16df05,
+    0x09f9fbfc, 0x00000a04, 0xeef1eb03, 0xf40910fc, 0x0afce907, 0xf6000401, 0x0c0618f6, 0x0415fe00,
+    0xf9f8fcf1, 0xfb0501f8, 0x06f903f9, 0xf2d5f109, 0xf9ee0500, 0x0008fcf8, 0x031d1bfb, 0x10fe0710,
+    0xf801f5f3, 0x1407090b, 0x1afd1206, 0xe31be6f1, 0x02f0ef01, 0xfd00f8ff, 0x0feedafc, 0xf6070c06,
+    0x07eee10c, 0xff00fbf5, 0x0efa14fb, 0xeafffe00, 0xfbede9e2, 0x1f15e906, 0xfffff2ef, 0xf6cff11a,
+    0x0be60300, 0xf50e01e9, 0x081e15e3, 0x050b100b, 0xf91225e2, 0x0f020c11, 0x1b030c0a, 0xf00a0d01,
+    0x1301f009, 0xf800ffe8, 0x06efe013, 0xfefff90c, 0x010214eb, 0x1d00e8ff, 0xfafed900, 0xf9d80800,
+    0x07f617f4, 0x1d0a1c09, 0xf2f1fcdf, 0xe5112f06, 0x0206ea00, 0x070307ff, 0xfb13fee9, 0x3215f70c,
+    0x0afcf40b, 0x001c2df1, 0x181b0801, 0xf1fbe2fe, 0x001aea0f, 0xf6000cec, 0x02fdf40c, 0x070d0508,
+    0x08060504, 0x0a00fd0f, 0xfa13e5ff, 0xf4daed00, 0x07020af3, 0x06090210, 0xe3fdf4ee, 0xf5f72009,
+    0x0cfef200, 0x0e02f805, 0xe4200003, 0x1d1feb12, 0x0edefe0a, 0xf80614f6, 0x100b0e0d, 0xe600e4fe,
+    0xfd06f61a, 0xea0003f9, 0xfdfff416, 0xf90004f6, 0x0704fff7, 0x0d00f302, 0xfb1df507, 0x05fee700,
+    0x00fefff9, 0x0002030d, 0xf1fd05ea, 0xfdf01108, 0xf9efe700, 0x0a0007f2, 0x0c11f7f6, 0x0c12ea08,
+    0x05ea04fd, 0xf70f1502, 0x04f4f90a, 0xf70e0204, 0x06f903fd, 0x00000dec, 0x0ff9f30d, 0x01f502ff,
+    0x0df301f2, 0x06000ff5, 0x0305f301, 0xf8040500, 0x00000afc, 0x050ffafd, 0xfa03ffe4, 0x06fafc1c,
+    0xfb00f400, 0x12f408f9, 0x17fdfff5, 0xfcfcd5fa, 0xff06f7ee, 0x071c20f8, 0xfd0fe9ec, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe617f60c,
+    0x05ec0707, 0xe500d510, 0xe4f7fe1a, 0xe30bee06, 0x1cf0e510, 0x0100111e, 0x060710ff, 0x06070b00,
+    0x0824023f, 0x0cfe04f1, 0x09f8fdfe, 0xf3fff909, 0xf7101100, 0xf8241001, 0xef0812e7, 0x064ff00d,
+    0xfd0101f2, 0xd6fafdec, 0x06fc0818, 0xebf1e8e8, 0x11fe011f, 0xf300f0fe, 0x01f7fc0a, 0xff12fef7,
+    0x10f4e903, 0xe900271f, 0xdd1503fc, 0x0afffe00, 0x040a0c0e, 0x09f5faf8, 0xf0fae9e2, 0xf3040603,
+    0xf0041700, 0xf60808f7, 0x02f61ce9, 0xf93a0306, 0xfafe080b, 0xf1ecf6e3, 0x0af9030b, 0x0505efda,
+    0x23f9fb05, 0xff0003fe, 0xed03e4f0, 0x08080af0, 0x0eea1af9, 0xf5000205, 0xdd0c0af8, 0x10000000,
+    0xf4ff08f2, 0x10f9fc01, 0xea02f9f8, 0xfbf00a01, 0xf60a1400, 0xe9f515f6, 0x020f05f5, 0x04090ff3,
+    0xf6feff19, 0xffecfdf4, 0x0beaf105, 0xf1fbfce6, 0x17ecf3ed, 0x1000ffee, 0xebf8e709, 0x0a07fe0b,
+    0x0a032907, 0x0000ee0d, 0xf9f715f7, 0x04f70000, 0x0bf9e8f7, 0x09fcf7e6, 0x1422f026, 0x00fc09ff,
+    0xed020e00, 0xedda1704, 0x1103e907, 0x01e728ff, 0xf4e00709, 0x02fd1608, 0xfedeea0a, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xcf00f61a,
+    0xfcd60c19, 0xf600f51f, 0x043d1807, 0x1f0605e9, 0x09fad004, 0xe500dbfa, 0x10fc08f8, 0xe9030c00,
+    0xe70bd80f, 0xf2051df5, 0x3703fc45, 0x28e6e9e3, 0xf820f000, 0xf51a0d31, 0x06e709dd, 0xea0af7ff,
+    0x1a040ee9, 0xf300fe05, 0xece81bf5, 0xef1bdded, 0x1dd109e7, 0xea001013, 0xcbf7f9fe, 0xf106fff3,
+    0xf60ff40b, 0xff00e7fc, 0xfdd609ff, 0xec173700, 0xe0eeff04, 0xf3e80fed, 0x0cfffcd3, 0x1b05fb0a,
+    0xfc063100, 0x02e006d7, 0xfbf30fe2, 0xf7e505f6, 0x100c0ce0, 0xfcdfde18, 0xf3fcd3b8, 0xf212e7df,
+    0x050f0ee1, 0xfb00f403, 0xfceaf2fe, 0xfc1005f6, 0x040d0b08, 0x00000012, 0xe800ebf9, 0xff09f500,
+    0xe2f414fe, 0xedf5ecfd, 0x01f4f7fb, 0xf6faee0f, 0xfbf70c00, 0xeef3f7fc, 0xfe070de4, 0xeffd07fd,
+    0x0c1709e2, 0x0ff40905, 0x0af8d6fb, 0xf00506eb, 0xfff517fb, 0x0700f7ee, 0xeb06e703, 0x0c11fffe,
+    0x07fc0b02, 0xfc002614, 0xd207efe6, 0x0001e800, 0xf2f6e7f5, 0xf9f1f71c, 0x06fe0fea, 0x1af7df08,
+    0xf1fded00, 0xd8ffecf8, 0x05fff7e7, 0xe90bfa13, 0x0206090a, 0x18faf0f6, 0x17f2ebf4, 0xf5feea10,
+    0xf7f90917, 0xd2000bfa, 0xe1040cec, 0x0107f0f2, 0xfffd04f0, 0x0e002a10, 0xe3dcf7f1, 0xee061300,
+    0x121709fe, 0xfaf700fb, 0x03f6032c, 0x0efbf300, 0xf10dc300, 0x23fb09f6, 0x0c051107, 0xf416030a,
+    0xf5eae507, 0xebfff4f3, 0xf6f30106, 0xf607ca0a, 0x08f9090a, 0xe00002f6, 0xde0be3f6, 0x03f41ad8,
+    0x0ff60eff, 0x0000260e, 0xdaf2f10b, 0xe0f70f00, 0xf4040411, 0x01fbfbee, 0xfbe3ed19, 0x2013fde7,
+    0xfbfeee00, 0x000016e6, 0x09f304ec, 0xf60312ff, 0x19d5f70d, 0xedf1010e, 0xfbf0000c, 0xf90816f4,
+    0xfb130919, 0xd80007f5, 0xa807e1f6, 0x0cf408f0, 0x0ef22103, 0x1000f2f5, 0xf1fef104, 0x16151600,
+    0xf1ece3f8, 0x1000e3dc, 0xfa02e5fc, 0xf902f401, 0x0407f900, 0xe4ff14f0, 0x04f80ae6, 0x01f103f5,
+    0x1ad506ee, 0x0be20418, 0x0c0e0c0a, 0x09ee2606, 0xf81c0aef, 0x2200ebb2, 0xd114f0f8, 0x1e06f0f7,
+    0x08f016ef, 0x2800180c, 0xd50e0512, 0x16020200, 0xcc0fe2f1, 0x0efbfcf7, 0xe61cf919, 0x29f300fc,
+    0x02ea0400, 0xca061b11, 0x02f20103, 0xf0e709f5, 0x2afb09e4, 0x08fcff2e, 0x050be11b, 0xf1daee0c,
+    0xf004fb18, 0x0600e901, 0xe6fc0fe1, 0xfdf6fefe, 0x14f81214, 0x00000900, 0x18f1f5f9, 0x05f30300,
+    0x00f9e944, 0x0bfe0f08, 0xf80aff2b, 0x0ee7f203, 0xf01e3700, 0xe5f22107, 0xfdfbfa1c, 0xebd8fe06,
+    0x0beffcd6, 0x06edf5cc, 0x01e5fbfd, 0x0403f20f, 0xfb0cf8ff, 0x1000e6f1, 0x1dffe5e0, 0xf815e4ff,
+    0xf5f8fdef, 0xfd00030f, 0xe7d311f6, 0xfc100300, 0x1022fa44, 0xfff603ff, 0x01e6fbf6, 0x0aedfc12,
+    0xe8ff1200, 0x000313e4, 0xf41ce913, 0xfd1308fc, 0x12d50517, 0xf905e6e0, 0x02fe0102, 0x05fdf716,
+    0x0a02fdea, 0xfb0004fc, 0x250bcbf2, 0xfdeefa08, 0xfbfceee8, 0xea00f3f5, 0xe9f812fb, 0xfb1c1700,
+    0x0708190d, 0xfeff02f7, 0x12edfdd7, 0xebf9e1fc, 0x0cfed000, 0xfe0411ef, 0xfc130212, 0x040113fb,
+    0x00f00b28, 0xf403f8f8, 0x06040526, 0xf107030f, 0x07f9f3eb, 0x0700fdd0, 0xf80deafd, 0x01cc1c03,
+    0xe508e7f4, 0xe500f610, 0xe2fd1807, 0x100d1400, 0xf22306e8, 0xeaf40e06, 0x0f0efdfe, 0xfceb09ec,
+    0xfa0bef00, 0xed0413f3, 0xfaef1f0c, 0xf3f503ef, 0x05cd1101, 0xe608fc11, 0xe805f624, 0xed031520,
+    0xe0e42307, 0x0400f71a, 0xdf21fafa, 0x0c0a0412, 0x16f81214, 0x04001e0a, 0xfa090ef3, 0xe4010600,
+    0x07120a13, 0x01061fea, 0xfff9ef18, 0x1f03e21e, 0xe7081800, 0xfeea080b, 0x04fe0e14, 0xf800fc06,
+    0xedfef5f7, 0x0be71cf0, 0xf0f8e405, 0xdb02f40c, 0x06e51b00, 0xf10013fd, 0xe517eb04, 0x050c190c,
+    0x01041907, 0x12000109, 0xeaf402f6, 0xf2041d00, 0xfcf9fbf6, 0xf50af7fb, 0x0bf5f709, 0xf7eef11e,
+    0xf7f71000, 0xf20aef09, 0x04120ee8, 0xfcf0fe0a, 0xfa2105f7, 0x04e50afa, 0xfffffa00, 0xf00f01fe,
+    0x0bed13ee, 0xff0015f9, 0xf4e9eb0c, 0x0b0c130b, 0xf6111502, 0x0700e1fb, 0xe8f403fe, 0xf0091b00,
+    0xfcececee, 0xf8fbf3f9, 0x060c1802, 0xdbe3f0ff, 0xfafa1000, 0xf9f5f70e, 0xfd0511f1, 0x0dfd16ff,
+    0xfe0607f9, 0x0700faf4, 0xf905eefb, 0xebfb11f3, 0xfcde0f03, 0xf000fbfd, 0x0601061b, 0x0a0a15fa,
+    0x050400fc, 0x0700d9e7, 0x210d05f2, 0xf9fb1200, 0x0918f708, 0xfcf1f910, 0xfbf3fbee, 0xe7edec01,
+    0xe5160e00, 0xf9f0e121, 0x080a0dee, 0xef0903fb, 0x00e1fef8, 0x0c0afcdd, 0xf81202f6, 0x001c0e06,
+    0x04cd1005, 0x000010fe, 0xff13fc1b, 0x0b22e7eb, 0x0af00912, 0xf800e703, 0x07fcfc02, 0xfef0f900,
+    0xedfdedf1, 0x07070719, 0x17f1fc06, 0xf6fc00de, 0x0e12fe00, 0xfb0e12fe, 0xfa0404e4, 0x021be408,
+    0xf5e8f4d5, 0x00d306f9, 0x0af70226, 0xf6030512, 0xe6df0b03, 0xfd00f0f6, 0xf2fae829, 0xe40de702,
+    0x08020314, 0xf200d70c, 0x001a0213, 0x0ccf0d00, 0x00020305, 0x02f50600, 0x10fd09fe, 0xdaf6ecf7,
+    0x0af9ed00, 0x021effe8, 0xf608f8f7, 0xcc040400, 0x07ef04fb, 0xfbe1ffff, 0xfe0910f2, 0xe9fd1510,
+    0x0f13fcf5, 0x010007df, 0xf5fae610, 0x12fcfdfe, 0x0ffc0102, 0xf500eadc, 0xfc040a16, 0x11d41500,
+    0xf50dfe0f, 0x08010e1a, 0xf30ef4e8, 0x17eecbfb, 0xe704fa00, 0xf924f6df, 0xe21003fd, 0xfe050203,
+    0x10e6fcfd, 0xecfef1fa, 0x08e7fae8, 0xf2fd050f, 0x0e08fde5, 0xf60004f6, 0xfe04ecff, 0xff0006f6,
+    0x04f6d9d2, 0x0600f3ed, 0xf8eafd0b, 0x15e81a00, 0xf8f8e7ea, 0x102f0010, 0x09f6f4e2, 0x1918ed09,
+    0xf702f100, 0xf2080cf4, 0x04030701, 0xf8140200, 0x2ef71ef1, 0x1518f0e5, 0x10fef1f6, 0xfffed21c,
+    0xfc271bff, 0x2400f6f2, 0xf21f20fe, 0xf602f80a, 0x08eff7e9, 0xff00f31a, 0xf6d3100b, 0x123cfa00,
+    0xfb23ec0c, 0x16fc03f7, 0x0dfce911, 0x14de0206, 0xfa22f600, 0xea1e13f4, 0x06eff8f8, 0xeffcf3f2,
+    0xe9fa0cea, 0xe9f5f5fe, 0xf5fceb19, 0xf206d206, 0xeeeb1bfd, 0xe900ef08, 0xea0609f6, 0xfeff00ed,
+    0xf4040109, 0xee00e8f2, 0xf5c70610, 0xf7c4ef00, 0xde380ff9, 0x0a0e0707, 0x04f3fa05, 0xfffefedc,
+    0xf7fbd800, 0x090507fc, 0x02000ade, 0xf906d903, 0x1303fde9, 0xfcf7f21c, 0xfc0f15d0, 0xf40902f3,
+    0x1cfbf8de, 0xf000f3e9, 0xf1e6f1e2, 0xf4eb2efb, 0xfa0506fb, 0xf500f7fc, 0xfdefe709, 0x02d5f500,
+    0xecfdfadb, 0x0c1402e6, 0x0905f4e8, 0x001105fe, 0xff01dd00, 0x01e6f0fc, 0xf3e81012, 0xfde2e002,
+    0x13e10e06, 0x0deefc13, 0x00e116c0, 0xedebf9fe, 0x1319d210, 0xfd0008ee, 0x0503e0f7, 0x0bf22100,
+    0xec071b03, 0x0000f034, 0x0feaf702, 0x13cffe00, 0xffdf05f6, 0x030406e3, 0x0e02f4ff, 0xdaf90209,
+    0xf6fcf300, 0x07eef7e1, 0x0afdf50c, 0x0000f108, 0x1ce41208, 0xf2fe0506, 0xeaf8ead8, 0xf8f008f0,
+    0xe7fff4e5, 0x0b00fcec, 0x3ef8e51c, 0x04f8e5f7, 0x26f611fc, 0xed0002f5, 0x2309fdfe, 0x04f7f100,
+    0xf41f05f2, 0x02f0180f, 0xfffae1e4, 0x11f7ef07, 0xfb0c1700, 0xda2f0104, 0xedf71b3d, 0xd1faeaf3,
+    0xfde6021b, 0x0df7fb3d, 0x2d0bfc0e, 0xf303fde9, 0xe1fae305, 0x1000ecec, 0xfcf5ef04, 0x07fbf312,
+    0x0007e705, 0xed00090a, 0xf5eef60a, 0xf9e80600, 0x0e0804fd, 0x0501040e, 0xf721e0e7, 0xf2fc020c,
+    0xe3f91600, 0xe619eef6, 0xe9ec1a27, 0xf0f7f909, 0xfad80808, 0xf7f20b11, 0x1412de01, 0xf8f4f8eb,
+    0xe906f2fc, 0x0d00f900, 0x0cfae8f7, 0x060dec08, 0xfd06d309, 0xe400fd03, 0xe5df0402, 0xe7000600,
+    0x19f0fa07, 0x08f8f8ff, 0xe806fdfc, 0x08000d06, 0xe7f91400, 0x0102f406, 0xfffa042c, 0xec090f0b,
+    0xf4ef0ed3, 0xfa1a02f6, 0xd202e9ff, 0xfd00e9fb, 0x14f10be2, 0x1300180f, 0x2dfbedf7, 0xec100315,
+    0xf607e80c, 0xeb00f8e6, 0xe5e61ed3, 0xfbf20000, 0x1b010b09, 0xeeddfa0b, 0xfde2fa14, 0x12030207,
+    0xee010800, 0x0d0608db, 0x0309eb20, 0xee0916f5, 0xef1e0408, 0xdf0c00fb, 0xd7d9fc1a, 0x06fb0ffc,
+    0xfff7fbe7, 0x030009fc, 0x1ff8f516, 0x18ff1708, 0x02e3e3ea, 0x0d00f3f6, 0xfe10f70e, 0x0ef70400,
+    0xf112fef5, 0x0e0b07e6, 0xf718fbec, 0x06fcf50e, 0xfb0a0000, 0xe711f50d, 0xedfb08dd, 0xf00208f9,
+    0x0df2fdf7, 0xf9eefe01, 0xf9ff1dff, 0x050212f3, 0xf8fef102, 0x0200fbf6, 0x0af1ef00, 0x131108f1,
+    0x0ffa02ed, 0xfe0018fc, 0xf8fc09ff, 0xe800fa00, 0xf306f5f3, 0x03faf7f3, 0xfc0af2ef, 0x11f501fd,
+    0xfafcee00, 0xd40d0818, 0xf5ea0b03, 0x09080afb, 0xedfdf70f, 0x07f8f01f, 0xf40614ea, 0xfefe01fe,
+    0xf50ae3f4, 0x1d00e5f0, 0xf0fdf5ea, 0x0e01ed03, 0x0f040307, 0x040016eb, 0xffe00409, 0x0708ff00,
+    0xf205f600, 0x06eaff10, 0xf7fd0302, 0xfdf313fa, 0xfffdf700, 0xf10c0602, 0xf809fd0c, 0xf51604fe,
+    0xfde404fd, 0x0912fe11, 0x02fafcee, 0xf5fdc8eb, 0xfe1bfcf9, 0x19000dfd, 0xf5f3f1f3, 0xfcfafb1c,
+    0x0605d609, 0x0f002aec, 0x0c1528fb, 0x060ff200, 0xe9e7fd0c, 0x01de0f15, 0xf9f00ee4, 0x02db06fd,
+    0x0703eb00, 0xe8101cdd, 0xf214e409, 0xee12d50f, 0xfeea1be3, 0xff151218, 0xf6eddeed, 0xf1f8c900,
+    0xfcfbf8ed, 0x17001a02, 0x080217f7, 0x00081cfd, 0xfe060c10, 0xfc00fdfa, 0x28060afd, 0xfb02fe00,
+    0xe517ec0b, 0xf5f3ee0d, 0x05f5fcf4, 0xfbf612fe, 0x02080100, 0x01fa07f2, 0x0cec03f9, 0xef07f2f7,
+    0xf7ef00f8, 0xf3f1fe15, 0xef00f0ee, 0xf8fff3f9, 0xf2faf6e7, 0x080006fe, 0x02fe05fe, 0xfa021bff,
+    0xfefe0903, 0xfb0009f6, 0x14ff0c07, 0xf6f9fe00, 0xf80ff5fa, 0xfbfaef09, 0x05fd04fe, 0x0bf513f2,
+    0x0ff50800, 0x140500f2, 0x17e70202, 0xfe07ebe3, 0xfa0803fb, 0xf5fefa18, 0xf8f00501, 0xfc010d00,
+    0xfff902fd, 0x060011fb, 0x00150c02, 0xff0b1a04, 0x040205fd, 0xfc00fdea, 0x10040005, 0x08fe0000,
+    0x0305eefd, 0xf6fff0fd, 0x06f703e2, 0x09ff07f9, 0x09fc0300, 0x15f209f3, 0x06e7f7f9, 0xfe08fde2,
+    0xf407f806, 0xfc010c0b, 0xfff607f3, 0x110a1101, 0x0b0a1a0a, 0x010017f8, 0x1b1e0ff9, 0x070b1805,
+    0x0003faf6, 0x0e0003e8, 0x1211ef14, 0x15070300, 0xfe09f202, 0xf002f1fe, 0xfdf90af5, 0xfc100df0,
+    0x0b0ef600, 0x15f611ec, 0x03de00f6, 0xf31208dd, 0xfc07fc14, 0xf9100f0e, 0xef0b07f6, 0xd70dea00,
+    0xe7f506f8, 0xf200fb08, 0x0d03cef8, 0x00110a08, 0x0d07070b, 0x05001204, 0x1217060a, 0x01fc0100,
+    0x07eec717, 0xfdf8fc06, 0xf7f2f3fb, 0x08dcec14, 0xfa0c0600, 0x070d0af2, 0x043b080e, 0xebf6ff12,
+    0xf916120f, 0xedecfa09, 0xf102fd08, 0xec0afd09, 0xf5f703f6, 0xf700fa01, 0x0bffe4f6, 0xf805090e,
+    0x0a08f602, 0x00001203, 0x0911ff07, 0xfcfc0800, 0x07f6d213, 0xf4f1fe11, 0x01fcf1fd, 0x0cf8fa0c,
+    0xfd080600, 0x04050cf1, 0xff310803, 0xf8feff07, 0x02020c02, 0xf3f8fd06, 0x01fef9f5, 0xf00afd03,
+    0xf8ff02f5, 0xf800f7f9, 0x120203fa, 0xf80b02f9, 0x0b09ee03, 0xfe0010fd, 0x0dfef1fc, 0x02fe0100,
+    0xfcf1cc08, 0xf3f70401, 0x08f4f5f8, 0x0df2000f, 0x030d0800, 0x03010af1, 0x021e03ff, 0xee02f502,
+    0xf6fd0903, 0xfff8f807, 0xf1faf6fc, 0xe91edcfc, 0xfffa0cf2, 0xfb00f1ec, 0x0801f4f1, 0xfc0407fe,
+    0x0f05f216, 0xf60009fb, 0xf805f90b, 0x06f90100, 0xf5edb403, 0x161bfc05, 0x07fafcf8, 0xfed1f815,
+    0x15ff0d00, 0xee080cdd, 0x092f0dfb, 0xed02f40e, 0xebfd1b00, 0xfbe5ee0e, 0xebe800fb, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ef2205,
+    0xf6ff2308, 0x1c00e20b, 0xfef5f8f1, 0xe7130606, 0x03ebeafb, 0x02001bf8, 0x1607f0fc, 0xf9fc0a00,
+    0x1d190105, 0x10042712, 0x0d0cff12, 0xfe08d4f9, 0xff0a0200, 0xe205f1f0, 0xf9ea0e15, 0xf0fa1806,
+    0x0edfef11, 0xf0210103, 0xf70806ea, 0xf5ed0900, 0xf6111804, 0x010004fe, 0x0300f7ed, 0xeee708f5,
+    0x0c01f503, 0x03001a00, 0xfbff070a, 0x0afffc00, 0xfa0aed04, 0xfbf70206, 0xfffe001c, 0xf801d8e5,
+    0x12f7e300, 0xe1fde2f0, 0xffdf000e, 0xeded1907, 0x02ee0518, 0x14fafcfc, 0xf11008f7, 0xf1fdebff,
+    0xed08fef6, 0xef0004eb, 0x07ff13eb, 0xf9f614ef, 0xff03e0fd, 0x01001af9, 0x01f4000d, 0x0e02e700,
+    0xf50cf818, 0xf6040408, 0x07fbf61f, 0x03f906f4, 0x04fc0a00, 0xf1190b07, 0xfdf2fbf2, 0x0fef0afe,
+    0xf2fb04fb, 0x1cfdeef7, 0xef040104, 0xf609f407, 0xfff1f1f5, 0x050004d4, 0x050cdcec, 0xf81afff9,
+    0x01f4f8ef, 0xf9001218, 0x0505f7fd, 0x0501f600, 0xfd1915f8, 0xf6070710, 0xfa17f008, 0xfefa17e1,
+    0x00162200, 0xfb01f4f3, 0xf3f41704, 0x0222f3e8, 0xf4e6fdfb, 0xfae4f3f8, 0x190c0a0f, 0x00e93afc,
+    0x150c0809, 0x15001dde, 0x0c0d0a07, 0x05fc0803, 0x16defe01, 0xf400f802, 0xfcd6f0f2, 0xfcf51e00,
+    0xfa370604, 0x2307210c, 0xf413f705, 0x0b2ef9f0, 0xfc310100, 0xf4f40cfb, 0xe6e30b0a, 0x0ff816e6,
+    0x01d2f702, 0xf2f3fef2, 0xf30e0801, 0xf8f7faf3, 0x110703fc, 0x02000bfc, 0x0908fe0e, 0xf7fd0d02,
+    0x06fdf9f5, 0xf400f3f6, 0xf2f700f8, 0x06fb0a00, 0x021c02fd, 0x04f2fdff, 0xf20c030f, 0x040a03fe,
+    0x0101f900, 0xff0805fa, 0xf3f00001, 0x01fb0fff, 0x03ef00fa, 0xf3f4fefc, 0xf7070a14, 0xedfffb03,
+    0x04130300, 0x0600ed0a, 0x15050f08, 0xf6051109, 0x010303ff, 0xfd00f2f6, 0xf8f9000a, 0x06030f00,
+    0x030a08f9, 0x02fd0604, 0x02fa0312, 0xfce504ff, 0xf8fa0800, 0x0a0806fe, 0x0118080f, 0xedfeff11,
+    0xfef20cf6, 0xf2f6f6f9, 0x06f11003, 0xf103f2f2, 0xf40901f1, 0xf000f903, 0x1a0100fa, 0xf604f003,
+    0x0cf5f314, 0xf500ebf0, 0xfefff7f0, 0xf2060400, 0xfadef9f1, 0x250d02fc, 0x07f1ff03, 0x06cafc07,
+    0xf4011900, 0xf10a05e4, 0x1122fc07, 0x03f1f015, 0xfeeb1b09, 0xfc0de9fe, 0x0be91efd, 0xde0102ff,
+    0xeffe0221, 0xfc00f2ee, 0xfa01f0f7, 0xfe081008, 0xf2fb0d1b, 0xf800f1fb, 0x0cf8fbfd, 0x08f40700,
+    0xebf7fe03, 0x06050011, 0x090305e7, 0xf3f2040c, 0xf2f0f100, 0x11e6eced, 0x03f218fe, 0x2addd8fe,
+    0x0217ffe1, 0xf605f8f8, 0x100ff41e, 0xe2fe0300, 0xf317ed00, 0xff000306, 0xfe08ea02, 0xf0fc1e0b,
+    0x0c020e13, 0x0000f0f2, 0xdbf30500, 0x02df0d00, 0xec0c0200, 0x03eefe07, 0xfbf8fff0, 0xf708f7fa,
+    0x09eb0500, 0x10e305fb, 0xf0f10006, 0x0000fff4, 0x050a00ee, 0xf019faf5, 0xf810fc11, 0xe2f9f1fa,
+    0xfc21f9ff, 0x0500150a, 0xedfddc09, 0xf3011d0c, 0xfd0416fd, 0x000002e1, 0xf7050af5, 0x0bf40700,
+    0xeb00000d, 0x07f200f9, 0x03fafaf5, 0x0005fa0b, 0x0cf01100, 0x03f401f1, 0xe700fcfc, 0x050402fd,
+    0x190d02ec, 0xfd0d05f5, 0xfc0bfcff, 0xd905e2f8, 0x09130b0c, 0x0700080c, 0x02f0ef0b, 0x09111b0f,
+    0x020c0c13, 0xf2000ce4, 0xfb1024f8, 0x0209f900, 0xefdff30f, 0x1815ff0d, 0x07feffef, 0xfce1ef13,
+    0x0aedfe00, 0xf9f900f0, 0x0015f906, 0x1ee7fe1f, 0x0f051406, 0x0004fd05, 0x00ff0205, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x040c1803,
+    0x000d13fd, 0x0300fbf7, 0x050cfd0c, 0x0bf4fa01, 0xede1fcf6, 0x0200fc04, 0xfceb12fb, 0xfd040d00,
+    0x0b0fe8f9, 0x24010d01, 0xf6010d02, 0x0006f0fe, 0xfc110e00, 0xf70a0ef7, 0x0ffe0a02, 0x0ffbfc05,
+    0x00fefcfb, 0x01fffafa, 0x09fbfffa, 0xf80b19f1, 0xf6150002, 0x0300fbf3, 0xfe0af409, 0x0bf6f403,
+    0xf5f80104, 0xfb000cff, 0x05ed00ee, 0xe7fdfb00, 0xfb0bfff8, 0x08f10601, 0xfbfaf9f9, 0xfdfeec02,
+    0xf40a0000, 0xea090a03, 0xf1020703, 0x0efee9fd, 0xfce9fbff, 0xfb0702fe, 0x0708fef6, 0xedff04e6,
+    0xe101f9fb, 0xef00f8f0, 0xf007e30e, 0xf9fcf405, 0xfff2f900, 0x06001317, 0xeefe0005, 0xfde8fe00,
+    0x0af0fbfb, 0x09f90209, 0xfb0dff06, 0x0bf701fe, 0xfdfcf700, 0xf011fbf2, 0xf60000f9, 0x0d0006fe,
+    0xfbe704ff, 0xfafd0204, 0xfb01f40a, 0xe701e9f8, 0x02f20d1e, 0xee00facc, 0x010bd2f7, 0x0cfdd408,
+    0xfee60fd9, 0x14001d1d, 0xf0011723, 0x230d0400, 0x29eae405, 0x270bf50e, 0x0d1e0824, 0xfdfd0b0a,
+    0x0efa0c00, 0x1b19f4f2, 0x212809f5, 0xf913300b, 0x02082610, 0x00f500f8, 0x10fafc29, 0xf9fafa03,
+    0x020f1220, 0x0300dc08, 0x03f70014, 0x10f912fe, 0x10df0505, 0xe300e5f8, 0xffd0ef03, 0x03fb1000,
+    0x08f8dcfd, 0x141506ff, 0x1dd8f41e, 0xfdf00515, 0xf21af300, 0x050a01f6, 0x0c1b0ae7, 0x010900fd,
+    0x03f5010a, 0xe300f3fd, 0x0b001208, 0xff13fffd, 0xda05f8ff, 0xff00e614, 0x0605e317, 0x07f70708,
+    0x0f05f217, 0xe500fafb, 0xddf80b19, 0xfb09fc00, 0x07edfdf1, 0xf1f9ee08, 0x0ff301e9, 0xedfffd01,
+    0x0bf9cd00, 0x0105f3f9, 0xeb190df7, 0x07f1fe05, 0x00fd06ff, 0xf6efe7ff, 0x210cfd1b, 0x10fefdd9,
+    0xd90afafd, 0x0f00f6fc, 0x130ef100, 0xfafc0502, 0x1104f603, 0xf6000ffe, 0xe014060c, 0x040af100,
+    0x0e06eef4, 0xfcfdec0c, 0xebfefe08, 0x01f8f704, 0x050bcb00, 0x07020409, 0xf30901f9, 0x01141208,
+    0xf3080a0d, 0xf5fee3f4, 0x080aeb1a, 0xfb10f2f8, 0xfbf70beb, 0x0a00ece9, 0x020be9f8, 0x03040501,
+    0x23e90a1b, 0xf000180d, 0xed02fb19, 0xfd081100, 0x05fbedf3, 0x1104f60d, 0x0e00ec0f, 0x21ecef01,
+    0xf813ff00, 0xff020004, 0xfef909fb, 0xf60b0b02, 0x04ef060b, 0xf8fafa00, 0xf1040d16, 0xe5fbdff7,
+    0xfbeae6fa, 0xe80025fa, 0x06e8f909, 0xeb0608ea, 0x1ff40cf8, 0xff001aec, 0x424bf5e6, 0x1fe4ef00,
+    0xeef703eb, 0x1c0b0c1d, 0x03fcfceb, 0x16f205f8, 0xf60ef800, 0xf20009f7, 0xdde404f0, 0xfe04f6e1,
+    0xf203fadf, 0x0fdb0a16, 0xfcf6e4e9, 0xf6f8fedc, 0xec02e30d, 0x19001efd, 0xdae8e402, 0xf2dafeff,
+    0xf50bd5f0, 0x0a0006f2, 0x232f02ec, 0x28e8ef00, 0x1704100b, 0x0ff8ec02, 0xe908d9f8, 0xc908f90d,
+    0x01ea0d00, 0xe30ff6e3, 0xe1ee05f4, 0xf402f60b, 0x06e900e3, 0xf0ed0803, 0xf30b02dd, 0xf9ec1ae7,
+    0xf8011009, 0x0600f8f0, 0x1200cafa, 0xfe1c0cfc, 0xf3031805, 0x0900fc10, 0xea010601, 0x0bf21700,
+    0x111a0817, 0x0af3f908, 0xec1ef1f9, 0x0703fcf7, 0xf1eb2d00, 0xf70af207, 0x00e50304, 0x0c07fc1c,
+    0x14edfb06, 0xf810eb03, 0x05f7fbf3, 0x0701f7ea, 0x23140afc, 0x0d00ffe5, 0x1403fbee, 0xf4f72af8,
+    0xf8f5300c, 0x0b000603, 0xe9e00df1, 0xf6f41200, 0x14fbec21, 0xf7eef709, 0xeffff31a, 0xfcfff1fa,
+    0x0cfb2800, 0x091801fd, 0x05012705, 0x04f71002, 0x20dd0228, 0xd407e6f1, 0xe4f60f13, 0xe5ef210a,
+    0x1cf2ff10, 0xfd00f503, 0xed1d2013, 0x08f8f2fe, 0x03cdfeec, 0x05000704, 0x080cfe0b, 0xfd180d00,
+    0x0514ea04, 0x17201e03, 0xe1151107, 0xf414e3f5, 0x182b1900, 0x0cf91af2, 0xfdceff08, 0xf62eefeb,
+    0xeff9eefc, 0xfdf2fdf2, 0xf719e814, 0xeefcd4ee, 0x0bf60e1a, 0x0600f310, 0x050a1b0f, 0x0403f211,
+    0xf8eff4f6, 0xfe00faf0, 0x09fe03fb, 0xf108fb00, 0xf20cfa03, 0xfe07f808, 0xf60cfd0e, 0x0001f9f6,
+    0x15161300, 0x0a070802, 0x0dd10415, 0xf51df3fb, 0xf60efbfc, 0xfff5f6f1, 0xff02fd0b, 0x09fac7f9,
+    0x1310040a, 0xf300fa06, 0x0e0afa00, 0xed041b18, 0xfc01f808, 0xf700eee5, 0x05050af3, 0xedf50200,
+    0xec04fef9, 0xfe00fcfa, 0xfc12f4ff, 0x040203fb, 0x11150e00, 0x0906fffd, 0xfee00519, 0xf613ed01,
+    0xf8feff0e, 0x00f3f9f9, 0x07020707, 0x06e3d9f1, 0x200910fa, 0xf600f6f4, 0x1007fbf0, 0xf1f80409,
+    0xfa090800, 0xf700f6fe, 0xfbfb0beb, 0xeef80500, 0xf6f5fd00, 0x02f2faf5, 0xfe0bfffa, 0xf50c1ae6,
+    0xf605f600, 0xfee8f1f2, 0xf9e0f417, 0xe901def2, 0x15ee0414, 0xf6fafa04, 0xf8000806, 0xe41ce608,
+    0x0bf70ad5, 0x0100f9f8, 0xfbe60c02, 0xda08e808, 0xf9db13fc, 0x09000c09, 0x05fae601, 0x1507fe00,
+    0x0f0406ed, 0x101b0500, 0xfd0203f2, 0xfdecf1f2, 0xfb060000, 0xf303fa08, 0xfe0c0efe, 0xe90e040d,
+    0xfd0fff17, 0x011ceff8, 0xf6e81a04, 0xd81ae6fa, 0x0f0605ee, 0x0700ef0a, 0x02def0f8, 0xf413f0fc,
+    0x0ce33b01, 0x12000117, 0x0de8ef07, 0x00f5f600, 0x0ef80ffe, 0x0b0bfb02, 0x07ebfa1e, 0x13010e02,
+    0xfe0c0300, 0xd5ff0ffb, 0x070a0ff1, 0x0ff8f713, 0x04f30b08, 0xf712edf2, 0xedef17fd, 0xfbf5e7e7,
+    0x020becfc, 0x190001ef, 0xf4f0e0e3, 0x1009f200, 0x10f93ff5, 0x1400e6fd, 0x11f00912, 0x08fcfc00,
+    0x07ed0cf0, 0x0efdf704, 0x06efeb2d, 0x070317ee, 0x1a051e00, 0xeef70ee4, 0xfe090902, 0x14f1fc06,
+    0x07db0705, 0xf0faf9f7, 0xf303f4fd, 0x0ae8f403, 0xe9fa04f0, 0x2000050a, 0xe30015f6, 0x1dfde900,
+    0xf1112011, 0x1400e7fc, 0xe4df15f1, 0x0df4f600, 0xdb0201fe, 0xf1d9fef7, 0xea14000f, 0xfaec14f6,
+    0x25f92300, 0xe703f4f3, 0xd9e6f1f4, 0x00e3f4ed, 0xf3f70fe9, 0xff05efea, 0xf6f906e1, 0x02d1010a,
+    0x10e51fe7, 0x10000702, 0x1b0107e6, 0x11eff1e4, 0x18bf0105, 0x090006e3, 0x13fae5ef, 0xfa161400,
+    0x0f0cfcf6, 0x04ff0ff4, 0x1cf40408, 0xe8fcebf8, 0xf20c0700, 0xf005070e, 0x1fe009ed, 0xef05fafb,
+    0x1419f80d, 0x0702f528, 0x16042a1b, 0xebf6e814, 0x00fcf809, 0x05000df2, 0x14f7fff4, 0x1af3fce5,
+    0x02f2f90f, 0xe800061a, 0x23f1f6e0, 0xfa110700, 0xfd0b0819, 0x07ff0223, 0x1600ecf8, 0x35fde9ed,
+    0xf803ed00, 0x0ef8030b, 0x0cf50adf, 0x16fafb06, 0x01fa04f6, 0x0500fe00, 0x20f9f724, 0xf207eced,
+    0xd1fcf1f8, 0xd2000f1e, 0xf7eee408, 0x081d0dec, 0xf004e700, 0x1400ee19, 0x18e80214, 0xff02f400,
+    0xf8f3fdf0, 0x09f4f804, 0x15f3f6ea, 0x1b0a1304, 0xfe0efa00, 0x0805fce7, 0x0808fbf3, 0x110100fa,
+    0xe9f302f7, 0xf6f2f4f7, 0x0bffef4d, 0x0b0df0e5, 0xdcdaceff, 0xde00faf7, 0x07ebbaf2, 0xf50edb08,
+    0x09f9eee8, 0x04001814, 0xf9f3fef3, 0x03f80200, 0xea08080b, 0x07e1f9fb, 0xfafcf9d2, 0x072b0604,
+    0x120f0900, 0xfb06dcf6, 0xbf090302, 0x0feae105, 0xf1fa0507, 0xeef0ef07, 0xf504f9f2, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32f8110c,
+    0xf20505de, 0x0200f60f, 0xfc0a080f, 0xfa0e0f08, 0x04050b12, 0x0c0017ed, 0xee18ee0a, 0xf309f800,
+    0xfb02060b, 0x08ecff04, 0xfc02f0ea, 0xf416f909, 0x13feec00, 0x2e15f60d, 0x1ae9e511, 0x03fef405,
+    0x07f7fc13, 0x151e0e1a, 0x0f0a0efa, 0x1ffdfd04, 0xfa090fe4, 0x08000103, 0x0009020c, 0xfd081e04,
+    0x01f80607, 0x100006f7, 0xee160104, 0x00f90900, 0xecfbf3fc, 0xfdf3fe06, 0xff0107ee, 0xe40501f7,
+    0x04080500, 0x1207f607, 0x10f4ec0f, 0xfdf8f204, 0xf5f3f9fe, 0xf9010305, 0xfaf815f6, 0x1806fd0d,
+    0xf7eb01e8, 0x0d00fb02, 0xfcfdff0a, 0x110117ff, 0x0cf7110f, 0xfa0006f4, 0x09060704, 0xfb150f00,
+    0xfbf8f8fe, 0xff08fef9, 0x0301ffeb, 0xeaf7ec01, 0xf7fefb00, 0x08eff4fa, 0xfbfbf804, 0xf5fc0005,
+    0x0404f802, 0xf7fffaff, 0x0bf1030b, 0x220cf40c, 0x05e1f8eb, 0xf200fb03, 0x15020e0f, 0x1007060c,
+    0xfdf70320, 0x0600fcf8, 0x1714130f, 0xf4080500, 0x0ae7ed04, 0x1410f9fb, 0x07faf3df, 0xf7feebf6,
+    0x07ebfa00, 0x15faef02, 0x0ad8ecfa, 0x0305dffe, 0xf9361206, 0x070bff04, 0xfaff0af9, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15f42bcd,
+    0xf60feb0a, 0x2600ff13, 0xe3052918, 0x02e613fe, 0x14cce00a, 0x08000af3, 0xfad6fefb, 0x0e1ffd00,
+    0x1601e6df, 0x02f90209, 0xf0fe16f2, 0x1bf2d8f9, 0xff12ee00, 0x0aef040b, 0xfff1fdef, 0x0314150d,
+    0x0810061e, 0x0b1d1ffe, 0x03fff503, 0xffd518fd, 0x03fa1c04, 0x0a000304, 0xf014f008, 0xf2eb0b05,
+    0x14f3f2fb, 0xfd001be8, 0x19f71009, 0xec08f800, 0x16fde4df, 0x04ee0405, 0x0a0afd24, 0x17f8de05,
+    0xf4f90200, 0xf0fc1102, 0x04edf2fe, 0xf00510fc, 0xfc0807ec, 0xf81b0cfb, 0xf511f8f3, 0xe5e8ed08,
+    0xe9eb1603, 0xf90016e2, 0xf9f1edf6, 0xe2deeffe, 0xe0f6eff1, 0xf2001906, 0x07f8140e, 0xfa0fff00,
+    0x1f16cffe, 0x0ffff7fb, 0x1c16ef2b, 0x0fefca18, 0xf8031200, 0xeafe03ff, 0xe5f2f8fa, 0xf3051803,
+    0xffef09f1, 0xedf7fdd5, 0x0ddff113, 0xe7fba30e, 0x05f00f37, 0xeb000cfa, 0xe709f8ec, 0xf5e7f2dc,
+    0xd30904fe, 0xf400fc0e, 0xf3f510ff, 0xf8192700, 0x01ebec07, 0xf5fcf300, 0x1ff80b27, 0x0d0dfa05,
+    0xf71d0600, 0xf9e5f7ef, 0x06162802, 0x2103d914, 0xfafc04f0, 0xcdcae6e3, 0xfbd6ed01, 0xf2180604,
+    0x10ff1317, 0x0d00fe17, 0xf71bef11, 0x0403d612, 0x17ea07f0, 0xfb001b0c, 0xf21e1f05, 0xf61be500,
+    0x0efdfa1f, 0x0dec11fe, 0xf203150a, 0x06fffd1a, 0x17eef500, 0x0cf71402, 0x061df1ea, 0xe636f201,
+    0xfa0bf61c, 0x052618ee, 0xf70b0607, 0xf20df508, 0x0004070f, 0x0700fe10, 0x0609f10d, 0xf7fcf9fa,
+    0x0df7f609, 0x0700180e, 0xf91605f1, 0x04fefb00, 0x0ef2fc07, 0x01e7fcfe, 0xf9f40106, 0x030a1efe,
+    0x06f80a00, 0x04fb0d0b, 0x180bf1e3, 0x0225ff11, 0x1508010b, 0xfe100b00, 0xebfc0c06, 0xea04eb05,
+    0x0cf908fd, 0x11000c08, 0xf901f7f5, 0x01f8f6fe, 0xfb02f7f3, 0xee00f7fe, 0x0700100e, 0x17eff300,
+    0x0302f208, 0xf8f2ed01, 0xf3eded0f, 0x00f71cfc, 0x0af40500, 0x0912fe02, 0x0b0ef1f3, 0xf9060603,
+    0x0a0207fb, 0x07fc1302, 0xf4ef01fc, 0xf308ecfa, 0x0bf4fefa, 0x00000907, 0x0417fbfb, 0xfef207f9,
+    0xf3eef401, 0xfb000509, 0x0bed0707, 0x17f7fb00, 0xfbf2de03, 0x04f5f1fb, 0x0708f707, 0xfceb050a,
+    0x05ec1600, 0xef01fae9, 0xfd1dfcfd, 0xf806fafe, 0xfe1b09f4, 0xfa16fcfc, 0xfdeb13e8, 0xfa110d0d,
+    0x03e40d2a, 0xe400ff09, 0xefd40fee, 0x12144df7, 0x17efeefd, 0xf7000800, 0x0bf91eee, 0xf210dd00,
+    0xf8f5e42b, 0xf9fd110f, 0xf4fcfbf4, 0x13f20dfa, 0xfd2e1400, 0xfcfd06e1, 0x0bdf1604, 0x14defc01,
+    0xe20cf4f2, 0x060cf602, 0xf2d2e811, 0xed01fd1d, 0xfbf6fdde, 0xf000dd03, 0xe107fe00, 0x100637f9,
+    0x19effcf6, 0xe6000bfd, 0xf4f11cfd, 0x040ef400, 0x04100521, 0xfaecf913, 0x0be80105, 0xf7f7f5f0,
+    0x01021d00, 0xf8cfffe0, 0xf8f80402, 0xaae30c07, 0x04f7f3ee, 0xfb0ef7e5, 0xfbf3e818, 0xe2ea010e,
+    0x17280af5, 0x0600f9f5, 0xfe0afb0f, 0x04ef37fe, 0x13fa0cf9, 0xde00070e, 0x19eb00e6, 0x14141300,
+    0x0f141016, 0x00faf507, 0xe8eade03, 0x19e9e900, 0xfef0ec00, 0xf80909ed, 0xf5f30e0f, 0xe6040701,
+    0x02f6fef1, 0xf001f5e2, 0x0aeef909, 0xdee70d05, 0x1f3319fc, 0xf50003fd, 0x0ce70203, 0x0dfc48e9,
+    0x15f8f9ed, 0xd70017f3, 0x160016f1, 0x0c150e00, 0x07000c01, 0xfe11fef5, 0xf5d6f003, 0x14f8feca,
+    0x04f6e800, 0xf2fb12da, 0xf60c0e02, 0xe6eaf9ee, 0x03f1fefd, 0xe00302f8, 0xffee0f14, 0xdd11ece7,
+    0x09ffebf6, 0x17001c06, 0x0704d114, 0xfefb11f7, 0xfa26f6fe, 0xf200fa16, 0x00e30af8, 0x0cdd1200,
+    0xf6f4ecef, 0xfc06040a, 0xdd0beee6, 0xfeef1c03, 0xf907f800, 0xfbf8f4f7, 0xf71c0f06, 0x17f0f903,
+    0x0bc40b07, 0xf8f7e4f2, 0xf10bd4f8, 0x0305fddf, 0xdaeeeb01, 0x07000709, 0xfafff4fc, 0xfcfb11f8,
+    0x0512f5fd, 0xfa00eef3, 0xe1f1fa05, 0xf6f9fb00, 0x0c10fa02, 0xf6f205f0, 0xf00cfbf1, 0x0af401e6,
+    0xf30ef300, 0xf905f8ff, 0x07000303, 0xe803fafe, 0x12f60a07, 0x0a0bef11, 0xfa0ae603, 0xfb02faf8,
+    0xfed0fbf3, 0xf200da04, 0xe6f7f1f9, 0xdaf903fc, 0x1b09eefb, 0xfd00f9ee, 0x00fbfef0, 0xffeef900,
+    0x000c060a, 0x05fe0efa, 0xffe3f7f4, 0x091402f8, 0xec110b00, 0x0702eb0d, 0x0308f108, 0x01faeb0f,
+    0x12f006ed, 0x01f5ff08, 0xfc02fbf1, 0xf7f523f2, 0x01d1f4ed, 0xf900d5e2, 0x19f5e3f3, 0xe802e017,
+    0x130bef02, 0xf900e8fc, 0x0409faf0, 0x08d8fe00, 0x0fedf60b, 0x1c061bfa, 0x11e4f1e5, 0xe70af810,
+    0xe205ff00, 0xfe0ce508, 0xee0beb0d, 0xfbe5f31a, 0x0800030e, 0x021704fa, 0xf810ffeb, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf604ddea,
+    0x0e0af1f5, 0xfc00ffdb, 0xfc08ebf3, 0x04fb1401, 0x16050103, 0x000010f2, 0x1a01f108, 0x00f1f100,
+    0x07d7d5f1, 0x000d0c09, 0x12eaefff, 0xefd0ef1b, 0x03090e00, 0xf80208fc, 0xfd4d0000, 0xf0f3f625,
+    0xf40b12fe, 0x1602ec00, 0xfffcf7fa, 0xfef7f8f8, 0x00fffc01, 0x040003f1, 0xfff900f1, 0x04f410ff,
+    0x080304fa, 0x0600fffa, 0xf8effe05, 0x09f6f200, 0x03e9e1fc, 0xf905060a, 0xffeef7ff, 0xe8e9f317,
+    0xfb0bf900, 0xf9ef0b04, 0xfa32fd02, 0xfbecf314, 0xf5f90708, 0x0af9fc10, 0xfdfe01fd, 0xfcf5fe00,
+    0x04fefc05, 0xfd0005ff, 0xfc040605, 0x08f71002, 0x03ff0dfe, 0x0000fdf3, 0xf3f2fe0a, 0x04000000,
+    0x10f1e9fa, 0x02050307, 0xfcf400fa, 0xf9e3fc16, 0xf905f700, 0xf1fc0801, 0x0522f9fd, 0xe7f4f306,
+    0x00f80b01, 0x0ae7fe06, 0xfbf40001, 0xe803e6e9, 0x0dfffcf1, 0xff00fef8, 0xfe0f07fe, 0x100c0e03,
+    0x0c052011, 0x0a000eff, 0xf6081c18, 0x09130b00, 0x0ddbcafc, 0x1d170800, 0x07f806fb, 0x04b6fd26,
+    0x05030b00, 0xf90cff04, 0x033ef9e6, 0x02fb0210, 0x06fa2006, 0x17f8f303, 0xf7eaf6fc, 0x1efaf607,
+    0xf511e903, 0xef00fe0c, 0xe9f210eb, 0x0bf6100a, 0xe0f2ff0a, 0xff0003f1, 0x18010104, 0xdc260000,
+    0xfdf70e0d, 0xe102f6fd, 0xfd0aeeee, 0x05f8e4df, 0x0a10f200, 0xef12f709, 0x05c9ebf6, 0xe009ff05,
+    0xff00fcf7, 0x13fdfa0e, 0x10fff708, 0x1aebff0d, 0x110ff110, 0xda00ee0d, 0xf2fa13ff, 0x0d001d13,
+    0xeaf8ff01, 0xf90014fd, 0x0ef50502, 0xe7160300, 0xf7f8fb0a, 0xe8f6f401, 0x04e902ed, 0x08f80907,
+    0x0b320000, 0xf10b0501, 0xebc3df05, 0xd7060009, 0xeeeefee6, 0x0be0f013, 0x0eebfd00, 0x1ae5fffd,
+    0xfefde8fd, 0xf000ff04, 0xf3eb1409, 0x0afe2008, 0xedf6f7f5, 0x150004eb, 0x000a07fd, 0xf1f71a00,
+    0xf4f6f601, 0xfbf3f900, 0x02e618ef, 0xfdfffe0d, 0x0c0d0100, 0x09f41f09, 0x05c0e90a, 0xfc0c000e,
+    0xf9fc04f8, 0xfcfb0202, 0x17f0f6f5, 0x1409f615, 0x13fbf8f5, 0xfa000202, 0xf5f712f3, 0x09f71a00,
+    0xedf4f8ef, 0x0500fef7, 0xff010c00, 0xfd160b00, 0x01f6fe09, 0xf905f100, 0xedfa03ed, 0xf102e2e5,
+    0x120afe00, 0x0a050700, 0xf2c3e90b, 0x0009010b, 0xf60d06f5, 0x01fc071f, 0x07f40105, 0xfbe129fb,
+    0xf413e705, 0x030009f7, 0xe5110af1, 0xfdfc0807, 0x09ea0be9, 0x09000306, 0x0700f8fc, 0x04171200,
+    0x0705011f, 0x150625ef, 0xf211090e, 0x161700f4, 0x0d170900, 0x15f91012, 0x09fcf7fd, 0xefebeb02,
+    0x0c0df8ff, 0x0019feef, 0x0803d714, 0xffe3fafb, 0xfd0e0306, 0x0200fd0d, 0xf51912f0, 0x00020105,
+    0x1cf90d05, 0xf100f904, 0x01f10b03, 0x040ef800, 0xfa0301fc, 0xfdfd10f8, 0x020903fa, 0x0afff7f7,
+    0x000b0600, 0x00030e02, 0x11fffcf8, 0xe8fafd06, 0x130ffd05, 0x060f0203, 0x08f6fe14, 0xedf0f4ff,
+    0xfdf501f7, 0x01000d0d, 0x051103ea, 0xf10cfbfa, 0x0803f905, 0xff00eef8, 0xf1f607fc, 0xfc10ec00,
+    0xe5f0f2fb, 0x010104f3, 0x050af5ea, 0x06feee03, 0x0bf80b00, 0xec000605, 0x04fafeed, 0xfbeff907,
+    0x11050806, 0x0bf9f402, 0x00f60902, 0xde09f7f8, 0x01fbfff2, 0x070007d4, 0xfd0adfef, 0xedffe2f1,
+    0xf5f4d9f2, 0x0000f00b, 0x09ecf109, 0x081c0200, 0xf4f8ddfe, 0x2012f113, 0x0008fddd, 0x10f3030f,
+    0x1a000900, 0x00f1f302, 0xebfd03f9, 0xf9daf0fd, 0x0a0f24f9, 0x0301ee00, 0x0303fbfb, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0fafa08,
+    0x02e703e7, 0xf1000804, 0xfeece2fb, 0x0610f206, 0x14faf81c, 0x0d00f7f9, 0xf81a07f3, 0xf91ef600,
+    0xf2fd2507, 0xe4f90a09, 0x09f2eaf2, 0x09bef225, 0xf9d8f900, 0x0201ee0c, 0xf213fd06, 0x28f6fe09,
+    0x054207f2, 0x140d1f14, 0x03060d03, 0xc702e508, 0x05f205ff, 0xf90006ff, 0x0b00e402, 0x0b0bff01,
+    0x0902ff00, 0x0900ff08, 0x090e0ffa, 0xff1ffc00, 0xfe0210fe, 0xf0030511, 0x0800f7fa, 0x06e10210,
+    0xf0ed0400, 0x0708fdef, 0xec120103, 0x13f90406, 0xfd2cfefb, 0xfa1a1606, 0x01f91101, 0xc703e50f,
+    0x01f6fafe, 0xf90006ff, 0x1101ef0b, 0x0c0200fe, 0x05fe12f4, 0xff000601, 0x020e0f00, 0xfb16ff00,
+    0xf70e0b02, 0xf602ff11, 0x020bfa01, 0x04f60603, 0xf5f70100, 0x0d09fef0, 0x07f4f80a, 0x0bf50e05,
+    0x0313010b, 0xff150e03, 0x070517f8, 0xc508e90f, 0x0be30101, 0xf1000cf2, 0x0704eb01, 0x0df602f7,
+    0xfcfe01f8, 0xf70004f6, 0x12010e04, 0x091ffc00, 0xfbf60a02, 0xfbf5fd10, 0xf704f005, 0x11e506f9,
+    0x04f51300, 0x060ff9ed, 0x12f3f404, 0x02fafcfb, 0x04f8040b, 0x0f30040a, 0x100b14ff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe9ece9ec,
+    0x16eee3eb, 0x180007e5, 0xf309dd03, 0x14041aff, 0x1804fd13, 0x0800e922, 0x2b070cf7, 0x1fe7f900,
+    0xeefbec1a, 0x08f90614, 0xf904e5fe, 0x24fa1706, 0xfb0b1300, 0xe7fbecee, 0xfdf2f8ef, 0x1816d909,
+    0xdcf301e3, 0x00f2f1cd, 0x02fa0de4, 0xed0510f5, 0xd7ede4fa, 0xe700fbf7, 0xede2e9fc, 0xf1e60e09,
+    0xe9ffe6e8, 0x1500fb18, 0xebedfdfa, 0x081d1500, 0xe6ffe205, 0x05e5f4e7, 0xfb01fd03, 0x04f93908,
+    0xfb000300, 0x0dfdf6f5, 0xe3fbf508, 0x2bf3fb07, 0xf0110aec, 0xfa20edfa, 0x07fbfa01, 0xfbf8ff0e,
+    0x0704ea09, 0xef00e109, 0x0e00f8fd, 0x09d419fe, 0x1402d6ee, 0xe90005f2, 0xf8c9effb, 0x06ee0300,
+    0xecfbf7ec, 0x050ef2fa, 0xf1f1d600, 0xfe041803, 0x0d010100, 0xf80bf303, 0xde110029, 0xe91a1f04,
+    0x001903f5, 0xf2f01107, 0xf6f10c06, 0xf60ef3ed, 0x0301ea14, 0xfe00eded, 0x07d90f05, 0x17fcf1fa,
+    0x1602f113, 0xda0008e8, 0x00eb1313, 0x2aeef100, 0xf9f50a09, 0xff26190a, 0x1f01dd23, 0x10ebe20f,
+    0xfb090900, 0x051a0aeb, 0x13100805, 0xe8e44802, 0xed1c03fd, 0xe0f41e14, 0x0ff4f30a, 0x090b0bfa,
+    0xfcea0ee7, 0x0f00f904, 0xd8efc8ef, 0xfdfac9fd, 0xfff50409, 0xfe00faf6, 0xfbf1f303, 0x00060a00,
+    0x08faf9f1, 0x0303100a, 0x01e712f5, 0xf4ea0401, 0xf9120200, 0xee03f908, 0x0a02f4fa, 0xebe1ef07,
+    0xfbf800ea, 0x00bbf5dc, 0xe2f4f8f6, 0xf8fb10f7, 0xe40804f6, 0x0900f409, 0xc6f7db0a, 0x00f5ef0b,
+    0x03fe0900, 0x0c00f201, 0xfde40309, 0xfcf71700, 0x0c0df6fa, 0x010205fb, 0x03e50ff4, 0xfe04ecf2,
+    0x07030800, 0x010cf601, 0x08c30a07, 0xf216f3ef, 0x1af305e0, 0x03dff4c3, 0x0804eff6, 0x02120dee,
+    0x1e2200f1, 0x0f000104, 0xe7f0d907, 0x07f804fe, 0x00fee700, 0x0d00f807, 0x06fe06fb, 0x0604ff00,
+    0x03f8de04, 0xfd140404, 0xf3fa11f7, 0x0309f304, 0x0400fe00, 0xf5edfa02, 0xfcef021b, 0xebfd01f0,
+    0x15ff03de, 0x02e801d6, 0xfeebedf0, 0xee20fcf0, 0xff0bffff, 0x0d000b04, 0xe9e605fe, 0x1917e606,
+    0x0510e6fe, 0x09000900, 0x0e0b1204, 0x0015fb00, 0xf8e0fd11, 0xfb0f02fb, 0x04fe0fe4, 0x09f2050d,
+    0xfc12ed00, 0xf8fb0600, 0xf40a050d, 0xdc11fb03, 0x10060aeb, 0xf8dbfc04, 0x00f6e0e5, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3e271124,
+    0x506472f9, 0xfe3e42d5, 0x41fc6246, 0xfcf8432a, 0x4af85848, 0xf8cdf633, 0x053afa14, 0x53fc5555,
+    0x43134649, 0x205453f4, 0x77eff7fa, 0x4231283e, 0xf4f89df7, 0x78560c45, 0x35c457f8, 0xf7eaf9f8,
+    0xf8fb5754, 0x0a10eafd, 0xf50d0500, 0xf407f610, 0xef00eb0b, 0x00000705, 0x0f00fb0a, 0x00f0f808,
+    0x0e140001, 0x00f5f13c, 0x1dff0602, 0x00f9f600, 0xefe30000, 0x03f60511, 0x0000f300, 0x101d0103,
+    0xff0e1000, 0x00170000, 0x00000a0e, 0xfd1ef4f1, 0xe901f700, 0xfa11fb09, 0xde00f114, 0x0000e110,
+    0x07000f02, 0x0002f80c, 0x10080019, 0xf9eadf4f, 0x0cf8edfe, 0xff05fa00, 0xeeef0000, 0x02f8f6fe,
+    0x0000fc00, 0x000e01fb, 0x03160c00, 0x000d0000, 0x0000fe15, 0x0b0201fa, 0x02f7ef00, 0x0d080efb,
+    0xf4000617, 0x0000f40f, 0xfc001a07, 0x000503f7, 0xf7030020, 0x0eefe927, 0xfdf3f503, 0xff0b0100,
+    0xf6040000, 0x0d000000, 0x0000f700, 0xfafe03fb, 0x09070400, 0x00130000, 0x0000ec0b, 0x1305eb19,
+    0x130bed00, 0x080c05ed, 0x0c00e4ed, 0x0000daea, 0x0d00f405, 0x00ff18f1, 0x11eb00fd, 0xdcf503f3,
+    0x15ecf002, 0xff052400, 0xfd040000, 0xf50b1513, 0x00000200, 0xd5f11003, 0x02230400, 0x00010000,
+    0x0000f4f1, 0x1e0cf40f, 0x4607f100, 0x060309ed, 0xf900cf39, 0x0000dfed, 0x2c000014, 0x00f217fa,
+    0x31e40009, 0xe7eafeef, 0x0ff701fc, 0x0c0a0b00, 0xf5f20000, 0xf8331202, 0x0000fd00, 0xe1f611ee,
+    0xeb21f500, 0x00fc0000, 0x0000f71c, 0x0f0104f6, 0x23060300, 0xf1fb14fd, 0x02000624, 0x000001f9,
+    0x230008fe, 0x00e2fe06, 0x2ee10025, 0xf7fcdcf6, 0xfa09f707, 0x1204e300, 0xe6010000, 0xfb460df0,
+    0x0000fd00, 0xe7f1f3ff, 0xef2ef900, 0x00fa0000, 0x00001323, 0x2505effa, 0x091fff00, 0x0706f9df,
+    0xf6001aee, 0x0000ffe7, 0xf000e10b, 0x0013fe02, 0x0e0e00fe, 0x09110de9, 0xfd1306fc, 0xf8220d00,
+    0x16f60000, 0xfbf50d01, 0x00000100, 0x0c0eff05, 0x08fefd00, 0x00f50000, 0x0000ef16, 0x1c07f308,
+    0x04040700, 0x0c16f3f9, 0x000036de, 0x0000ffb9, 0xe300ed08, 0x000500f5, 0x110a00f6, 0xf3170ef6,
+    0xf90b0205, 0xfc111200, 0x09fb0000, 0x1101f7fc, 0x00000000, 0x12100800, 0xff0df800, 0x00010000,
+    0x0000f414, 0x0703effe, 0x03090500, 0x10fcf6f7, 0x030021f7, 0x0000f9dc, 0xe9000603, 0x00fdf6ed,
+    0x130300ff, 0xf7021204, 0xf9000f07, 0x02070700, 0xfdf40000, 0x1708f603, 0x0000f900, 0x002505fb,
+    0xfd15fb00, 0x00ff0000, 0x0000f803, 0x0b1607f9, 0x17f6fd00, 0x11f1f90d, 0x0800f500, 0x0000000d,
+    0xf5000407, 0x000dfe15, 0xfb2e0001, 0xfbec0bfb, 0x0be8fffa, 0x06fdff00, 0x13f90000, 0x02faf9e6,
+    0x0000fb00, 0x09ee07f7, 0xff0e0d00, 0x001c0000, 0x0000120d, 0x0e1602f6, 0x1af90600, 0x1201f902,
+    0x0300e5f6, 0x0000f9f4, 0xf10004fb, 0x0009fc02, 0xfb2f0002, 0x0bf8fef7, 0x0de312f4, 0x120bf600,
+    0x0ffc0000, 0xf401efdc, 0x00000200, 0x02ef10ea, 0x060e1200, 0x00190000, 0x00001c0d, 0x070cfdf8,
+    0x11f10f00, 0x1efb0b02, 0x0b0000eb, 0x000009fc, 0xf2000ffc, 0x00fe0e08, 0x0a1600f3, 0x0cfff802,
+    0x17ec00f6, 0x1a15ec00, 0x06010000, 0xf1fef4f2, 0x00000300, 0xf8020ee9, 0x100a1100, 0x00110000,
+    0x000010f5, 0x18f302fe, 0xf41def00, 0xffe5001a, 0x1700ebf8, 0x00000f03, 0xf1001e15, 0x000d1309,
+    0x10d70004, 0x0c26d911, 0x05ecf3de, 0x3021f300, 0x05f90000, 0x3ef2fbfa, 0x0000fd00, 0xff35d6da,
+    0xecf30400, 0x00fa0000, 0x0000102a, 0x06eb12f1, 0xa2ffea00, 0xf2d2fe16, 0x2f001aed, 0x000028d7,
+    0x0600f510, 0x00f610f5, 0x19dc00f4, 0x1614da0c, 0xf801f7de, 0x0d12ee00, 0x02eb0000, 0x3af70bfa,
+    0x0000fa00, 0x1332e8e8, 0xebf10600, 0x00ec0000, 0x0000200f, 0xf1faf1f3, 0xc2dd0800, 0xfadd030b,
+    0x1e0020f4, 0x000027d3, 0x3300f302, 0x00e70f06, 0x1afa00fe, 0x0fe0eefb, 0xe815efff, 0xfaf4f200,
+    0xfbd00000, 0x0bf210fc, 0x0000f900, 0x1800fee7, 0xdcf3fa00, 0x00df0000, 0x00000cf1, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x051cfee5, 0x17022400, 0x0805dff7, 0x0300ee0c, 0x00000918, 0x1900f927, 0x0000fe10,
+    0x2010000d, 0x0af21725, 0x0914eb04, 0xff0c0500, 0x0e080000, 0x0e091919, 0x00000b00, 0xeb0b0a06,
+    0x02d7ee00, 0x00030000, 0x0000f6e2, 0xee26eddc, 0x10ec1700, 0xfe0ffdef, 0xe800f90a, 0x00000f1d,
+    0x22001e1a, 0x00e9fd0d, 0x1b0a00f8, 0x03fdf43a, 0x0c12e604, 0xfe001400, 0x110d0000, 0x01011a21,
+    0x0000f500, 0xd5180803, 0x07d3f300, 0x00f50000, 0x0000d9d6, 0x041af0e3, 0x01fafe00, 0xeeff09ee,
+    0xe9000718, 0x00002116, 0xfa002c02, 0x00dbfe02, 0x090100f5, 0x07e4e21b, 0x040ef411, 0xe2fb0100,
+    0x010b0000, 0xf60a1515, 0x0000ef00, 0xd61306fe, 0x0bd6f700, 0x00f40000, 0x0000e1f7, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x3309efe2, 0xf3f7f300, 0x140b00ee, 0x050048e7, 0x0000f1f7,
+    0xd20009fb, 0x00ff0101, 0xe51a00fc, 0xfa20f2fb, 0xedffffed, 0x0e140300, 0x1dfe0000, 0x2f0b1ff2,
+    0x0000e800, 0xefff0d26, 0x04f20500, 0x00ec0000, 0x0000000e, 0x2af6f4ef, 0x02010400, 0x0106faf8,
+    0x04005cc2, 0x000008ff, 0xd2000cf4, 0x00f414f3, 0x0f15000c, 0xf71edbf9, 0xf8ea0a0c, 0x06fe0200,
+    0x1afd0000, 0x28f419f7, 0x0000ef00, 0xeb180d1a, 0x02fb0900, 0x00fd0000, 0x0000ea16, 0x1907ecee,
+    0x09ff0900, 0xf5dd0def, 0x0c004ddc, 0x00003113, 0xf5000600, 0x00dd02f3, 0x15f60008, 0xff11c90e,
+    0x06d32313, 0xf8ede800, 0x09e80000, 0x0a05070b, 0x0000e200, 0xe018fa02, 0xe5f30a00, 0x00050000,
+    0x0000fd16, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2cffea11, 0x31080d00, 0x041bebe8,
+    0xe600d217, 0x00001810, 0xfd00fd0b, 0x00eb1809, 0x382500e0, 0xf3e40f1b, 0xf6eef304, 0xf611f800,
+    0x0a020000, 0x0ef91400, 0x0000e800, 0xe6f3fb11, 0x11ee0400, 0x000a0000, 0x0000ed0f, 0x22eaed16,
+    0x45fa0700, 0xfb21f0eb, 0xf000dfff, 0x0000260c, 0xf3000700, 0x00ee0cf5, 0x492400cb, 0xf2e5f41d,
+    0xfcf10026, 0x0503ed00, 0x06f40000, 0x0ce80106, 0x0000ea00, 0xe3fcf710, 0xfff30e00, 0x00000000,
+    0x0000ea1c, 0x11ecf30d, 0x20fa0000, 0x021305fd, 0x060006f3, 0x000031f6, 0xf6000fff, 0x00f0e6e4,
+    0x331700db, 0xfae6ec0c, 0xf1f41829, 0x11f6e400, 0x02eb0000, 0x01e9fc0e, 0x0000f200, 0xe40d02fd,
+    0xeb0f0f00, 0x00fe0000, 0x00000f13, 0xf80df9df, 0x01171800, 0x09f3f6ff, 0x0a00020a, 0x00001509,
+    0x0800cc21, 0x00f1040f, 0xe2f60007, 0xdbf3112e, 0x04032af9, 0xee09ff00, 0x10020000, 0xfa050cf6,
+    0x0000fc00, 0xe8f60afe, 0xf6caff00, 0x00f80000, 0x000009f2, 0xfcfb01e9, 0x0a101300, 0xf902f405,
+    0x0b00ff0a, 0x000021f2, 0x1900ee17, 0x00f70415, 0xe8e4000b, 0xd3fd0c2a, 0x061d22f4, 0x01fa0000,
+    0x06fe0000, 0xefff040b, 0x0000ec00, 0xf113fdfa, 0xf2e80700, 0x00f80000, 0x00000009, 0x0eef0eea,
+    0x18030200, 0xeaf20711, 0x0700100b, 0x00001efd, 0x2400020c, 0x0001090d, 0xf4f10021, 0xe8090509,
+    0xf61806ff, 0x04edf200, 0xfff70000, 0xf4e60610, 0x0000ec00, 0x031e02f1, 0xe4edf600, 0x00f80000,
+    0x00000efb, 0x27e61a01, 0x3d0e0500, 0xfced1112, 0xf000da19, 0x00002a04, 0x0400e32a, 0x00ef10f5,
+    0x0c110022, 0x2e15eeea, 0xf4200ffe, 0xeb14c900, 0xe7fc0000, 0xd4fa2608, 0x0000f800, 0xe801ea14,
+    0xec030400, 0x00f70000, 0x00001312, 0x1de81cf7, 0x40050200, 0x04d3021b, 0xf400e106, 0x00002f21,
+    0xf800021c, 0x00fafce8, 0x0d120012, 0x2611e0f0, 0xf11703f2, 0xef01cb00, 0xedec0000, 0xe7ef1303,
+    0x0000f400, 0x0607e706, 0xdff20000, 0x00ff0000, 0x00001104, 0x09ec13f2, 0x04f6fc00, 0xf4e4f516,
+    0x0600f113, 0x0000150e, 0xfd0012f8, 0x00fbd5e7, 0x181400f6, 0x01faf0ff, 0xe910faf4, 0xeee8df00,
+    0xfbe70000, 0x05fdf303, 0x00000100, 0x130af00f, 0xe4f00d00, 0x000c0000, 0x0000fb03, 0xdff50a0c,
+    0x0c11ec00, 0x10fd0109, 0x1100f1fe, 0x0000f920, 0xfc001afb, 0x00090208, 0x02ef0003, 0x0dfb07f5,
+    0x11f102fb, 0x10fe0800, 0x20f10000, 0xf218f9ec, 0x0000ec00, 0x0702f7fd, 0x070e1f00, 0x000e0000,
+    0x000020f5, 0xd3f70404, 0x010ed900, 0x070bf50c, 0x0d00f7e6, 0x00000f30, 0xf60002fa, 0x0013000d,
+    0xfcfa00f7, 0x210212f0, 0x0afc00f5, 0x1602fc00, 0x2eed0000, 0xf00ff9e9, 0x0000f200, 0x0d02f7f3,
+    0xfb201000, 0x00020000, 0x000015fe, 0xfef20310, 0xf423e800, 0xe404f406, 0x02000aeb, 0x00001526,
+    0xf7000601, 0x0009e908, 0xfbf000f6, 0x1f00120b, 0xe21cf8ff, 0x07ec0200, 0x12ee0000, 0xef0a050a,
+    0x0000e800, 0xfa25f2e4, 0xfefdf100, 0x00fe0000, 0x00000a0a, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x08f50000, 0x0217fb00, 0xf80a10e3, 0x0200ea23, 0x0000051a, 0xf900280c, 0x001202dd,
+    0xf4fc0007, 0x10f1f504, 0xf3080d08, 0x07221100, 0x12110000, 0x06091ef9, 0x00000100, 0xff1f05f8,
+    0x0807e300, 0x00e00000, 0x000001f8, 0xf4f90f07, 0xfbf2fe00, 0xf80a08f7, 0xf900cb2f, 0x00000a1d,
+    0x0e001a01, 0x00f116e1, 0xfefa000a, 0x09f6fcf6, 0x01ff0e0f, 0x06070400, 0x09000000, 0x000103ea,
+    0x0000fa00, 0xf80004f0, 0xfd0ef200, 0x00fc0000, 0x00000201, 0xfb050e01, 0xfbea0100, 0x22ffff01,
+    0x0500de13, 0x00000c00, 0x03001a0c, 0x00ee2efd, 0x07ff0007, 0x0206fd00, 0x26e70c05, 0x150af300,
+    0x08090000, 0xfb00fbf5, 0x0000fb00, 0xebe207f6, 0x040c1100, 0x00050000, 0x0000150d, 0x38031af1,
+    0xdc11ed00, 0x0c0604e8, 0xee00db01, 0x000008e7, 0xf500dbcc, 0x000e06ea, 0x0f1900fd, 0x14fd0b0e,
+    0xedfc08f0, 0x07030100, 0x15f70000, 0x00f30e0d, 0x0000f900, 0xf51e0b0a, 0x12f71000, 0x00f40000,
+    0x0000130b, 0x5ef30601, 0xe1fd0300, 0x0616faef, 0xeb00eb06, 0x0000faea, 0xee00e6e7, 0x00fb16e6,
+    0x0e2200f9, 0x1502fc22, 0xfde90ee5, 0xf2070b00, 0x09f90000, 0x02fe0615, 0x0000f500, 0xfd0a14fc,
+    0xf9e51100, 0x00020000, 0x00000d08, 0x26e611ff, 0xffff0100, 0xfc11fcf1, 0xfb00f608, 0x0000e3f7,
+    0xf900eff4, 0x000415e8, 0x0a060003, 0x10f8fb12, 0x06e210fa, 0xf5020400, 0x0af70000, 0xfc0c080f,
+    0x0000e400, 0x0af70ff3, 0xecf20b00, 0x00fc0000, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01f6f61b, 0x000b1600, 0xfc17f102, 0x100010e1, 0x00001407,
+    0xfe00fffa, 0x000210f6, 0x160300f2, 0x0918ef09, 0x060f1732, 0x0408fb00, 0x1c080000, 0x0201fa00,
+    0x00000000, 0xde0ffd01, 0x0ce50c00, 0x000a0000, 0x0000f20a, 0xf8f3f81c, 0xe20c1400, 0xf547ef01,
+    0x1800f4e3, 0x00002219, 0x0700ebfb, 0x00ef04ed, 0x2efb00dd, 0x0602ee11, 0xf4191941, 0x03fdfe00,
+    0x09fc0000, 0x03f1fbff, 0x00000600, 0xe315fc00, 0x12e00800, 0x00ff0000, 0x0000ea0e, 0xf9f70d14,
+    0xde000800, 0x022d050b, 0x1000ea05, 0x00000813, 0x0900f800, 0x00e0fef9, 0x19ff00f4, 0xfceefe03,
+    0xec0d1623, 0x0af4ef00, 0xedf80000, 0x06fa0106, 0x00000a00, 0x01f5fd04, 0x0bea0100, 0x00fc0000,
+    0x0000f8fe, 0x3b03e9fd, 0xeeff1200, 0xfa090001, 0xdc00e9e6, 0x0000fdff, 0xe6000ef0, 0x00edf704,
+    0x111f001a, 0x04110ef3, 0x0307ea07, 0x1b020200, 0x19fc0000, 0x20edebf6, 0x0000ec00, 0xec1dfa17,
+    0x00f80e00, 0x00040000, 0x0000f9f3, 0x2c02ec01, 0xe60a1100, 0xeff205ff, 0xfa00d8e8, 0x0000f901,
+    0xe7000301, 0x00efef05, 0x09100006, 0xf3100008, 0x04eced03, 0x1607ff00, 0x21050000, 0x20fee1eb,
+    0x0000eb00, 0xf203f029, 0xfcf80200, 0x00060000, 0x0000f206, 0x170f07ee, 0xf2fa2700, 0xf2dffe09,
+    0x0200fe13, 0x000007f3, 0xfe00f312, 0x00e8fefa, 0xf6e900fb, 0xfb0a000e, 0x04e6f211, 0x11fef700,
+    0x06070000, 0x0606f1fc, 0x0000f300, 0xf5fffc38, 0xf4f9fd00, 0x00070000, 0x00000024, 0x30fe0517,
+    0xe50cf400, 0x04f034f8, 0x0300f112, 0x00000ccf, 0x11002302, 0x00f823f6, 0x0b3000e4, 0xed00ee04,
+    0xf8131fe6, 0xf9fa1e00, 0xf1fb0000, 0xfefbdb0d, 0x0000f200, 0xe6daf4f6, 0xf3f01000, 0x000a0000,
+    0x0000ed16, 0x0bf60703, 0xf201e000, 0xfddc24fd, 0x21001f27, 0x00000ae2, 0x19001408, 0x00fb02f8,
+    0x002300ee, 0xf8f3fb03, 0xfb142ee9, 0xeef42900, 0xfdf10000, 0x04f2f91c, 0x0000ed00, 0xfef8f800,
+    0xe7081000, 0x00000000, 0x0000e413, 0xe6f309f1, 0x14fcf600, 0xf6d70606, 0x1b00321f, 0x000012f6,
+    0xff00100b, 0x00f9f413, 0x0aff000d, 0x11e80100, 0x030a0bf4, 0x09ec1000, 0xfefe0000, 0xf2f01116,
+    0x0000ee00, 0xf10bfce5, 0xd3df1000, 0x00fc0000, 0x00000907, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0217f9fd, 0x27080800, 0x0211f711, 0x1b00fc00, 0x0000f3e3,
+    0x0000f92c, 0x00f7fc08, 0xe110000d, 0xefedf1f4, 0x0a170211, 0xf207ff00, 0x12fb0000, 0xfee91419,
+    0x0000f600, 0xfecf07f7, 0xf0e11100, 0x000c0000, 0x0000f304, 0xeffa01fa, 0x3000ef00, 0xfb0afcff,
+    0x1a00031f, 0x0000f5e5, 0x1e00df28, 0x0000e9f3, 0xe4ef001f, 0xededfcf3, 0x0f060705, 0xfe03fd00,
+    0x23030000, 0xe8ea1008, 0x0000e400, 0x03fa10f1, 0xf7ec0b00, 0x00fc0000, 0x0000ff03, 0xedd5fef2,
+    0x1702ed00, 0xf7f503fb, 0x0a000329, 0x0000f806, 0x18000213, 0x00f6dfed, 0xe0db0018, 0xf5f0eefe,
+    0x0bf50601, 0x02fbfc00, 0x14f90000, 0xf1e8fffc, 0x0000da00, 0xfb1302ed, 0xfcf20600, 0x00fa0000,
+    0x00001722, 0x01fd0500, 0xd90ee700, 0xfdfb050d, 0x0900f0f6, 0x0000e506, 0xf300ee01, 0x00f7ed06,
+    0x0c060003, 0x01f40b2b, 0x0bfc03fa, 0x04fd0300, 0xfb020000, 0xf30ef9fb, 0x00000300, 0x090d19f8,
+    0x0c010200, 0x00f60000, 0x000004f0, 0xf7fa02fa, 0xc9fde700, 0xfa05ff02, 0x0d00e0f6, 0x0000dc1c,
+    0xef00e600, 0x00f602fc, 0x0eeb0001, 0x27e90926, 0x0602f7fe, 0xfe0b0700, 0xfcfe0000, 0xf01dfeef,
+    0x0000f400, 0xfe1313f6, 0x1100f700, 0x00eb0000, 0x000001ea, 0x00f8f5f4, 0xf4fcfd00, 0x0bf8faf3,
+    0x0900f80f, 0x0000ef1b, 0xe200f516, 0x00dc0d00, 0x03e6000b, 0x1bfd010c, 0x0ef5ff02, 0x0d0cf400,
+    0x02fd0000, 0xef21f208, 0x0000f200, 0xffe3fef5, 0x08001900, 0x00f00000, 0x0000fafa, 0x0b0ace14,
+    0xe0f9fd00, 0xf40e250c, 0x24005e0d, 0x00000618, 0x01000615, 0x00d6fa22, 0xf7010009, 0x04040b0f,
+    0x0a1a0c07, 0x0318f000, 0xf9000000, 0x05fb04f1, 0x0000fb00, 0x15e6f018, 0x0edcf200, 0x00f50000,
+    0x00000b1c, 0xfc01bd0e, 0xe4fcef00, 0xfa1a2e0a, 0x11005be1, 0x0000f502, 0xff000216, 0x00eefc23,
+    0xfbe80007, 0xf805f9fc, 0x04080b10, 0x0712e300, 0xe9ec0000, 0x120403e5, 0x0000f400, 0x1c09f816,
+    0xf2e4f200, 0x00030000, 0x00000827, 0xe30ae0f6, 0x0602f200, 0x02151312, 0xf30026e7, 0x0000f4f2,
+    0x0a000c0a, 0x00020b06, 0xf5ea00fb, 0x0103f1ee, 0x000af80c, 0xef01f400, 0xf9d70000, 0x07ec09e1,
+    0x0000f800, 0x1b10f5ee, 0xe502e200, 0x00fc0000, 0x0000ff19, 0x2d330f16, 0xfffdee00, 0xfb0c0c04,
+    0x1e0005f2, 0x0000e31c, 0xfd00e727, 0x00e80d1c, 0x0811000c, 0x2605fb06, 0x0dff04f4, 0xee17fd00,
+    0x03fd0000, 0xfb1112f6, 0x00000300, 0xe217ff11, 0x03d7f000, 0x00160000, 0x000009ff, 0x210b1107,
+    0x2002da00, 0x02f905f1, 0x1d00422d, 0x0000c920, 0xce00f10e, 0x00f11330, 0x02010015, 0x27fa0100,
+    0x10f8eef4, 0xec0aed00, 0xe6f70000, 0xf30d0edd, 0x0000f200, 0xf8fa060e, 0xfbdeec00, 0x00020000,
+    0x0000ef28, 0x04dd0df7, 0x1804e200, 0x04d5ece9, 0xff00241e, 0x0000e00e, 0xda0010f3, 0x00011d0e,
+    0x0cee0013, 0x0504eb01, 0x06f0ea0c, 0xe9fcff00, 0xf50d0000, 0xdadefbe3, 0x0000e200, 0xfde1f4ee,
+    0xf1e80100, 0x00f00000, 0x0000f637, 0x190609e7, 0xfe061800, 0xfff031ef, 0x1500f735, 0x000014ee,
+    0x3100f915, 0x00fffadf, 0x260f0018, 0x27040803, 0xfd02f5fb, 0xf806f000, 0xfe040000, 0x1207021e,
+    0x0000f800, 0xd417ff16, 0x02e21500, 0x00070000, 0x000004cc, 0xfaeefbfc, 0xf6f51a00, 0xf8cb2af1,
+    0x15000a3f, 0x000010f9, 0x2a00f20a, 0x00fbf8eb, 0x1c120020, 0x12f910f7, 0xeb180cfc, 0x06f7de00,
+    0x04fe0000, 0xf220fd0a, 0x0000f800, 0xeb16fd0f, 0xfccb1200, 0x00090000, 0x0000f3c2, 0xeef7ec11,
+    0x0bf70d00, 0xeac922f9, 0x1c000a22, 0x00000a09, 0xf100e207, 0x00f5e3fa, 0xfd16001a, 0xefe70f10,
+    0xd4fe2000, 0x10f6e300, 0x06ed0000, 0x0233eb11, 0x0000f500, 0xfbf2e804, 0xe0d20b00, 0x00180000,
+    0x0000ecd1, 0x2006111b, 0x1016f800, 0x12e51af7, 0x08003845, 0x00000620, 0x27000910, 0x0003fff0,
+    0xc1ec00f4, 0x1be81905, 0xfbff0cfb, 0x000f0900, 0x19fa0000, 0x211d2a02, 0x0000f200, 0xf912040a,
+    0x04cd0c00, 0x00050000, 0x00000a14, 0x0ff02201, 0xf4e5fb00, 0xfcde16fb, 0x02003c54, 0x00000c13,
+    0x300000fc, 0x00f0fbe8, 0xeff400e2, 0x17cbeffa, 0xe9fa0cf6, 0xf2f71200, 0x09f90000, 0x1623250a,
+    0x0000ed00, 0xf6fcfdf1, 0xf0c80200, 0x00f90000, 0x00000615, 0x18011c04, 0xe8f30f00, 0xe3e504f4,
+    0xf3001c2a, 0x00000f22, 0x0500fbfc, 0x00e4d5ff, 0xf80200f0, 0x08cbedfa, 0xdef904f8, 0xebed0a00,
+    0xecf60000, 0xf20b0602, 0x0000ec00, 0xf600fcfd, 0xcbb30400, 0x000c0000, 0x0000f214, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x06fd191f, 0xff05e100, 0xfcf903f7, 0xf200e6ea, 0x0000151f,
+    0x070021e8, 0x000605f7, 0xedf500da, 0x0b1605f9, 0xeaf90df5, 0xf5fd0d00, 0x0cf60000, 0x02010bfb,
+    0x0000fc00, 0x00e21a0d, 0x16fe0b00, 0x00080000, 0x0000ea0b, 0x0f011a20, 0xef0adf00, 0xfcf102f9,
+    0xdb00c20a, 0x0000240c, 0xfe003cef, 0x00f8050e, 0xfdf000cd, 0x04120406, 0xfef80cd5, 0x01f80800,
+    0x01fd0000, 0x1f17f528, 0x00000600, 0xd5ea03f8, 0x0ef71d00, 0x00090000, 0x0000f809, 0x080614fa,
+    0xe10ff500, 0xeceff8fb, 0xed00e01f, 0x00001908, 0xf80011f1, 0x00fbfb0e, 0x07ec00f0, 0x00f7eb0f,
+    0x06ee12cf, 0x06fe0900, 0xf7110000, 0x1619ee20, 0x00000c00, 0xdcfafafa, 0x18f31200, 0x00090000,
+    0x00000410, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xec38f4e8,
+    0x18d62600, 0xe7f2060a, 0x080004f3, 0x000002e7, 0x100037f7, 0x00fb0d20, 0x011e00d8, 0xe9ebdf1f,
+    0xed1ce8cd, 0xed051300, 0x23f90000, 0x00f800cb, 0x0000c600, 0x030adc07, 0xeec5ff00, 0x00ed0000,
+    0x0000ecd8, 0xfe0aec07, 0x1bf51e00, 0xfb021507, 0x00000fe5, 0x0000f5dd, 0x01000d0c, 0x000705fb,
+    0xee1200ec, 0x04eff0e2, 0xe81cdce6, 0x01090600, 0x28d10000, 0x10fe04d9, 0x0000eb00, 0x1b03ec21,
+    0xf6df1000, 0x00020000, 0x0000f4eb, 0xffe3ec18, 0x100af600, 0xfe08200f, 0x0b000cf5, 0x0000eef1,
+    0xc600ea1b, 0x000004e9, 0xfaf80004, 0x07ff07f2, 0xfc0be300, 0x0c09fd00, 0x1da40000, 0x102007e3,
+    0x0000f100, 0x28fbf1d0, 0x0504fe00, 0x00ff0000, 0x0000f3fc, 0xf1dffaff, 0x08f7fd00, 0x040cfef7,
+    0xfd00e4fe, 0x0000d01a, 0x02002dd4, 0x0000040e, 0xf8f6001a, 0xeee40d17, 0xf2270911, 0x0113fa00,
+    0x110a0000, 0x2c1607e7, 0x0000f700, 0xffcb01fb, 0x06fa0400, 0x00fc0000, 0x000007f7, 0x0ede0d13,
+    0xfa04dd00, 0x02e6ffeb, 0xf600f41d, 0x0000d1f6, 0xe6002bc8, 0x00010dff, 0xdecd00ff, 0xf20bfc25,
+    0x081b17ed, 0x0a10fb00, 0x17040000, 0x482f02ee, 0x0000ec00, 0xf90ffb02, 0xfffb0600, 0x00040000,
+    0x0000f715, 0x07e4150f, 0xea0ff300, 0xfde906dd, 0xee00fc16, 0x0000f6e1, 0xe90015f3, 0x00ff02fb,
+    0xeee700f3, 0x0317f81f, 0x170418ed, 0x05f8fd00, 0x07080000, 0x2d1bf80e, 0x0000db00, 0xf623fa03,
+    0xfad81000, 0x00080000, 0x0000041b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x170bf910, 0xf0050200, 0x070f1b08, 0x01000a17, 0x0000060d, 0xfa00f207, 0x0013f4fa,
+    0xf80b000e, 0xf8070afd, 0xf4eafc0e, 0xfe071400, 0xfb140000, 0xf6f9f808, 0x00000f00, 0x0be91cfe,
+    0xf824f900, 0x000b0000, 0x00001419, 0x0d16f114, 0xecfb0600, 0x020e14ff, 0x0c0018f5, 0x0000ea0e,
+    0xeb00faf7, 0x00120af7, 0xf61b00f3, 0xe40603ed, 0x09d40617, 0x010e1200, 0xfd1d0000, 0xebe7e8e4,
+    0x00001700, 0xfdd51bf8, 0x03161000, 0x00130000, 0x00001223, 0xf90bee05, 0xf2f81100, 0xfcf612f3,
+    0x030016fa, 0x0000f4fb, 0xf00002f2, 0x00080cfe, 0x050200f1, 0xf311f809, 0x04e90b0c, 0xfc0a0300,
+    0xf6170000, 0xf6f6f1e5, 0x00000c00, 0xf0f70cf5, 0x05060b00, 0x00030000, 0x0000040f, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x14100e05, 0x03043900, 0x03e4e707, 0x00000f29, 0x0000faeb,
+    0xe500e4fb, 0x0003f4fc, 0x232600e5, 0xf7e1fcdb, 0x0609fef8, 0x080efa00, 0xfb050000, 0xe90001e2,
+    0x0000f700, 0x0dfaf2e2, 0xf61eff00, 0x00f10000, 0x0000f41b, 0xf517fb12, 0x02015800, 0xfdfde30e,
+    0x030002de, 0x0000eafa, 0xea00dcf9, 0x0009ebdf, 0x141800f3, 0xf6f604ec, 0xfeff0aec, 0x04040200,
+    0x00e50000, 0xfeef00f0, 0x00000000, 0x11e5f115, 0xf1150600, 0x00fd0000, 0x000003fa, 0xee19d416,
+    0x1b103700, 0xfc0e0809, 0x010019c3, 0x0000ee13, 0x1700f800, 0x0011e2f9, 0xed0900f8, 0x0704140e,
+    0xf7030fec, 0x0f01f800, 0xf2bb0000, 0xf2f1090b, 0x00000300, 0x0804fa0a, 0x011c0000, 0x000a0000,
+    0x00001aea, 0xfa060504, 0xf314ea00, 0xf7f4f301, 0x0300e211, 0x0000f70b, 0xeb00fcf1, 0x000904f9,
+    0x05fd0000, 0xdd070df5, 0x18130318, 0x17f7f300, 0xe5080000, 0xebe7ee12, 0x00001300, 0x090cf7f3,
+    0x0df10300, 0x00000000, 0x00000604, 0xe8fffc02, 0xf811ee00, 0xf503effd, 0x0200dcfc, 0x000001fc,
+    0x0b00f601, 0x0007ff05, 0xff0600e5, 0xce101817, 0x09180d05, 0x1c06f600, 0xe9020000, 0xf7f0e539,
+    0x00000600, 0x0a0c00ea, 0x0bef0300, 0x00f30000, 0x000011f6, 0xe312f603, 0xffeffc00, 0x0610faf2,
+    0xfa00e700, 0x0000f003, 0x1700fbff, 0x000b08ee, 0xfa0c00f0, 0xeb07faf5, 0x1dfb1007, 0x1f10fd00,
+    0xf4130000, 0xeff6f119, 0x00000e00, 0x0dee10ef, 0x10f40a00, 0x00f00000, 0x00000afa, 0x03fde006,
+    0xe10bf900, 0x071bec11, 0xfb00f4ed, 0x00000909, 0xf80004f8, 0x00f917f8, 0xfa0b0011, 0x0d04ec0c,
+    0x111107fc, 0x04ff0f00, 0xea010000, 0xfaeeed0c, 0x0000f800, 0x07eb060e, 0xfe03fc00, 0x00f60000,
+    0x000013f0, 0x0413fafc, 0xef0a0800, 0x0716f00b, 0xf200f5f1, 0x0000081f, 0xe700feee, 0x00f41bec,
+    0xd5fa0009, 0x260cf10a, 0x0105fc03, 0x01120400, 0xf00a0000, 0x05eb021f, 0x0000f800, 0x0ee0f810,
+    0xfef50800, 0x00fa0000, 0x000006f8, 0x04140005, 0xf50df900, 0x07020500, 0xf800fef3, 0x0000161d,
+    0xf4000101, 0x00f61cf1, 0xdbee00f6, 0x17270014, 0xf7effaf3, 0xf109f600, 0xf70b0000, 0xfbf91518,
+    0x0000fb00, 0x07d8e902, 0x0bf9fd00, 0x00ff0000, 0x00000eed, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x120f0cfb, 0xf30d1500, 0xf40ae4f6, 0x0f0009ed, 0x00001d12, 0x0f00100b, 0x0006041a,
+    0x16f100f9, 0xfd04fc1e, 0x05f1ee06, 0xf90b0300, 0x14f90000, 0xf5eff837, 0x0000e500, 0xddff021a,
+    0xffeb0e00, 0x000b0000, 0x00000606, 0xfb21ee00, 0xf0f00d00, 0x021bfce7, 0xfe0018fa, 0x000001ee,
+    0x2d001603, 0x00fbfd1a, 0x27e900fa, 0xef00f815, 0x0ee3f009, 0xf7071000, 0x0ef70000, 0xeffeef3c,
+    0x0000e600, 0xcfc70a15, 0xfae21900, 0x000d0000, 0x000013ef, 0xf718ecfe, 0xf5ea0000, 0x170f0be6,
+    0xfc00110f, 0x000000ec, 0x190018f3, 0x00fcfbfe, 0x25f000f6, 0xfdf7f3fa, 0x0ee50209, 0xf30d0300,
+    0xfbfb0000, 0xee0aee18, 0x0000ea00, 0xbae31008, 0xfcd71400, 0x000a0000, 0x00001101, 0xfff80ffb,
+    0x191d0500, 0xe8f5eaed, 0x040007d7, 0x0000f5fc, 0xf7000700, 0x0024e706, 0x10200009, 0x06fb0b0f,
+    0xeefdfdee, 0x0b2f0800, 0xfc0d0000, 0xf6fff6ec, 0x00001100, 0xef110104, 0x17efef00, 0x00df0000,
+    0x000000fc, 0xf8f2f6f8, 0x360b0200, 0xf1f1ec06, 0x040002c6, 0x0000ee0d, 0xee00040d, 0x0009f811,
+    0xf71d00fd, 0x1a000606, 0xf00504e7, 0x0b21fa00, 0xfb120000, 0xf4fdfde2, 0x00000d00, 0xf2060215,
+    0x18f1fe00, 0x00010000, 0x0000fef7, 0xfcf5f9f9, 0x1a070800, 0x09fe010d, 0xfa0013f9, 0x0000001e,
+    0xf000fd03, 0x00fb0c0d, 0xef0f00f8, 0x0ffbf6fd, 0x0903f9f3, 0x1013f100, 0x041b0000, 0x01f40003,
+    0x00001900, 0xfde30614, 0x15f01200, 0x000e0000, 0x00000a01, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0009fcfe, 0x10f4fe00, 0x0e0f0915, 0xfe0006fd, 0x0000f70c,
+    0x0300f709, 0x00f90d03, 0xf6f6000b, 0xf40afcf0, 0x0dedfefa, 0x0af4f600, 0x0b040000, 0x020ef4f6,
+    0x00000300, 0x09cb0612, 0xf8181b00, 0x001e0000, 0x00001603, 0xf907fb02, 0x10faf400, 0x0afc0708,
+    0x000018f4, 0x00000710, 0xfe00fa07, 0x0000fa0b, 0xf6fe0004, 0xfa0afcec, 0x05f203f4, 0x0e02fc00,
+    0x10030000, 0xeffdf6f4, 0x00000300, 0x0be50010, 0xf6151100, 0x00140000, 0x00001b05, 0xfe0202fb,
+    0x05e7fb00, 0x2bfb0304, 0xf900070c, 0x00000507, 0xfc000e08, 0x00fa0b08, 0xf50c0005, 0x0306f8f7,
+    0x1ee517ff, 0x1b12ed00, 0x110a0000, 0xf9f8f7fa, 0x00000d00, 0x05d4ff11, 0xf9131b00, 0x00080000,
+    0x00001a0a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x031604fc,
+    0xf610fe00, 0xeaf1091b, 0xfc0019fc, 0x0000f51e, 0xe4001bf3, 0x00f9f6ff, 0xfc060006, 0xff05fd27,
+    0xfc07f904, 0xfa060500, 0x0e050000, 0xff0100eb, 0x00000a00, 0xfa0c0af4, 0x02fce500, 0x00fb0000,
+    0x00000005, 0x071d0806, 0xf508f600, 0xf9e81414, 0xed00f806, 0x0000ff02, 0xe20020fc, 0x0002f0f8,
+    0x01040007, 0x03fdfb0d, 0xf9071104, 0xeff50500, 0x0b080000, 0xf002f1eb, 0x00000c00, 0x01f807ed,
+    0xfef4ef00, 0x00000000, 0x0000f704, 0x082d0605, 0x0d131800, 0xe9f00d0b, 0x0300051e, 0x000011ed,
+    0xee000b14, 0x0010ea00, 0x181400f3, 0xfbfcfbea, 0xef11040f, 0xeee90000, 0x0e080000, 0xf10100fe,
+    0x00000500, 0xf9da00ed, 0x00f5e100, 0x00090000, 0x0000f505, 0xc40d00fd, 0xfa0a0f00, 0xf3f1f908,
+    0xf800201a, 0x00000c37, 0xf300f606, 0x00dbee0d, 0x0a0900fb, 0x46070108, 0x14fd061a, 0x00fbf400,
+    0x07090000, 0xedf3fcf4, 0x0000f300, 0xebf808fd, 0x0903fd00, 0x000d0000, 0x00000e07, 0xdd0806f3,
+    0xeb080b00, 0xfcdcf6ff, 0xf2002f1e, 0x00001f30, 0xfe00fb01, 0x00f0fcfa, 0xfb0300f8, 0x2d10edf5,
+    0x12f60b16, 0xf9eef000, 0x070c0000, 0xece3f7f1, 0x0000f800, 0xf9dc01ed, 0x09020800, 0x00050000,
+    0x0000fe1c, 0xfc110ae7, 0xfdfc1300, 0x10d809fe, 0x02002c11, 0x00003112, 0xfb00fcff, 0x00f907ff,
+    0x040400ff, 0x00fdf5e9, 0x12ef1e14, 0x04ecf800, 0xfe0c0000, 0xf7ed0115, 0x0000fb00, 0xfcf102e9,
+    0xf80e1800, 0x00f70000, 0x0000111f, 0xd9fa15fc, 0xfc080600, 0x11edc8db, 0xfc00fdec, 0x0000161d,
+    0x1200f1fc, 0x0017ee02, 0xfdf600f9, 0x1ce90a1a, 0xfbfa15ef, 0xec040400, 0x1df40000, 0xfef806fa,
+    0x0000fa00, 0xe53c030b, 0x08090400, 0x00090000, 0x0000faeb, 0xbefa0005, 0xf0f8f600, 0x13fef5ed,
+    0x0c0018fe, 0x0000083e, 0xfd00f9f6, 0x000af5ff, 0xefdc0010, 0x21e7fb11, 0x05fcff01, 0x00f30a00,
+    0x16020000, 0xff0702e6, 0x0000f700, 0x00310f0f, 0x04f81300, 0x00fc0000, 0x000009ea, 0xe1f70309,
+    0xf2fcfa00, 0x121213f6, 0x0600161a, 0x0000f12c, 0xf0000de2, 0x000cf302, 0xf5d40007, 0x18f2fb03,
+    0xf601fcf1, 0x03f90100, 0x04090000, 0x09fefaf3, 0x0000e700, 0x09281413, 0x06e50700, 0x00050000,
+    0x00000d08, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14e91ffe,
+    0xd8080300, 0x03eff1f7, 0x1100fd1d, 0x0000f81e, 0xbf000dee, 0x001b1f13, 0xf4ed0014, 0x0af40b05,
+    0x0b09fd0a, 0xfa08ff00, 0xf5eb0000, 0x0702fdf6, 0x0000e800, 0xee01fe1f, 0xf6cf0600, 0x00030000,
+    0x00000a3c, 0x07f518f1, 0xd4032a00, 0xfcf7cff8, 0x0c00061b, 0x000008ec, 0xc200ffe5, 0x00050e03,
+    0x020b0021, 0xfeecfaf0, 0x011be804, 0xfdfefc00, 0xfbfa0000, 0x10dff5f6, 0x0000e400, 0xf703f13a,
+    0xf5d50300, 0x00f90000, 0x0000112d, 0xf0fb04f5, 0xfbf12f00, 0xee14e704, 0x0b000804, 0x000022ec,
+    0x0600f9fd, 0x00e5f7ed, 0xfd16001d, 0x0fe0f8ee, 0xe50eee10, 0x0afbfb00, 0x08030000, 0x15e2f518,
+    0x0000f200, 0xfcfedf5b, 0xdec00500, 0x00090000, 0x000006fe, 0x1a08fc06, 0x28030400, 0x001007f3,
+    0xde00ed1d, 0x0000ff18, 0xf600ec3b, 0x00f5fbfa, 0xd71d00f0, 0x0ff0fe12, 0x0207f305, 0xe7021300,
+    0x06050000, 0xd6f4e8ed, 0x0000ff00, 0xe8fe0dee, 0x03fb1100, 0x00030000, 0x0000f110, 0x1df3fe1e,
+    0x370ff300, 0x03100df7, 0xe500c035, 0x0000f338, 0x0400f122, 0x00f6fdf7, 0xe31f00ec, 0x0af8031e,
+    0x0609f90e, 0xf314ff00, 0x02060000, 0xcaf9f3e7, 0x00000700, 0xe5fa0fe8, 0x0bf21400, 0x00fe0000,
+    0x0000f417, 0x01ed0414, 0x1a13fc00, 0xfd0b10f4, 0xe400ce2a, 0x0000f432, 0x0800ea03, 0x00faf403,
+    0xfefe0002, 0x0e08061e, 0xf9020410, 0xfe0ef300, 0xfc0d0000, 0xd7fafdf6, 0x00000000, 0xe00005fa,
+    0x05eb0a00, 0x00f80000, 0x00000c07, 0x40fbef01, 0x2a1d0600, 0x04f60bd0, 0x02001a09, 0x0000f2f0,
+    0xfe002c0b, 0x00fa0a36, 0xfcf800d7, 0xd7e2fdfe, 0xf20d19fc, 0xef02f500, 0xe6e50000, 0x0d1e0948,
+    0x0000e900, 0x04ed0807, 0x03eb1100, 0x00060000, 0x00000520, 0x1a23f1ef, 0x2f0d0200, 0x0bd0f1ef,
+    0xf5002608, 0x0000e302, 0xf40009fe, 0x00f7062b, 0xf9eb00db, 0xefeff411, 0x0b070605, 0xfef7f400,
+    0xdfea0000, 0xfc100b46, 0x0000e300, 0xfbed0c0a, 0xf0031400, 0x00040000, 0x00000724, 0x0d27f4ee,
+    0x1a0af800, 0x0ce200fb, 0xf9000c14, 0x0000f80a, 0xe7000e02, 0x00eff40f, 0xf4060002, 0x0a03f01d,
+    0x100c0113, 0x0ef9ea00, 0xf5f20000, 0xfd0f101f, 0x0000f200, 0xeaf2070a, 0xdefb0900, 0x00fa0000,
+    0x00000b0d, 0xff42ff38, 0xfcfbfa46, 0x2cfcfa35, 0x3d26f9fd, 0xfbfb555b, 0x0efd4b4f, 0x26fb5754,
+    0x1a1b614d, 0x13fdfd10, 0xf83f64fd, 0x21fcf9c9, 0xfbfc1921, 0x04fd2b64, 0x5a4241f9, 0xfafafdfc,
+    0x510f67fd, 0x0c3ee6de, 0x000000dd, 0x160000ed, 0x14d60000, 0x00001fa9, 0x020011fa, 0xee0032fc,
+    0x010f0a3a, 0xff000011, 0x00dccf00, 0xf7000006, 0x0000e903, 0x01000ee4, 0x0b122000, 0x00000000,
+    0xd815f700, 0xfc13f3e3, 0x000000f2, 0xf50000dd, 0xfcdb0000, 0x000012cf, 0xe7002001, 0xd9003205,
+    0x020bfe35, 0xfc000011, 0x0010bb00, 0x19000016, 0x00000101, 0xdd0013f5, 0x36faf900, 0x00000000,
+    0x16e81f00, 0xebfce6e2, 0x000000d8, 0xff0000ee, 0x02e90000, 0x0000fce4, 0x07001ce4, 0xc5002bfa,
+    0x1df5f22c, 0x16000001, 0x0015d200, 0xfb000017, 0x0000290e, 0xf0000400, 0x35111000, 0x00000000,
+    0xfbc3f200, 0xfdf3f607, 0x000000dd, 0xfd0000d5, 0x07db0000, 0x0000f4f7, 0xf50019eb, 0x0b0012eb,
+    0x1122eb20, 0x0700001d, 0x0024e600, 0xf20000f3, 0x00002d1d, 0xeb000316, 0x1e0eff00, 0x00000000,
+    0x1dcbf000, 0xfb0818f3, 0x000000e3, 0x0f0000f9, 0x11c90000, 0x0000d9f6, 0x06000dfb, 0x09000ce8,
+    0xff40eefd, 0xf4000021, 0x0016fe00, 0xf1000015, 0x000011f7, 0xf600fe32, 0xfe2f0400, 0x00000000,
+    0xf2d9f800, 0xe8f30ff7, 0x000000d8, 0x11000014, 0x0cd00000, 0x0000d1f0, 0x0c0010fe, 0x0b00ede6,
+    0x0f2a0307, 0xfb000016, 0x00e41b00, 0x0b000011, 0x0000e8f0, 0x0400ef3f, 0xf51bf600, 0x00000000,
+    0xf5eb0600, 0xed0b1201, 0x000000e0, 0x270000fc, 0x04dd0000, 0x0000e2f2, 0x0c00f31a, 0x0c00f2ff,
+    0x01140804, 0xe4000026, 0x00fc1c00, 0x070000e5, 0x000002f4, 0x04000c22, 0xfe00e700, 0x00000000,
+    0xffebfd00, 0xf2f323fd, 0x000000e2, 0x3f00000e, 0xf9d50000, 0x0000edf5, 0x2100011b, 0x1c00f319,
+    0x14120304, 0xf9000029, 0x00ec1700, 0x070000e3, 0x000005d6, 0xe7000311, 0xece1ea00, 0x00000000,
+    0x00f21f00, 0x26f70129, 0x00000020, 0xef0000f4, 0x0d1a0000, 0x0000f2d8, 0xe8000ce0, 0x16000425,
+    0xced51105, 0xef0000f0, 0x00f82100, 0x04000001, 0x0000d9f0, 0x1d00e22e, 0xf6ffd500, 0x00000000,
+    0xf6260300, 0xf2fcff2b, 0x0000001c, 0x2e0000fb, 0x06110000, 0x000011e6, 0xcd0015de, 0x0900ff0e,
+    0xdae818c6, 0x000000ee, 0x00e42400, 0xdb0000ed, 0x0000ffee, 0x090006fc, 0xfd08ed00, 0x00000000,
+    0x020eff00, 0x03f8dd01, 0x00000005, 0x27000018, 0xe6100000, 0x0000f4c5, 0xf400f41b, 0xf400130d,
+    0xfdd20102, 0xfa0000de, 0x00201300, 0xee000016, 0x0000f2e4, 0x1e00011a, 0x06fdf300, 0x00000000,
+    0x03eaf600, 0x1d19d31a, 0x000000f7, 0x1b000001, 0xe8180000, 0x000005fc, 0xf900fa13, 0xe70003fd,
+    0x0bcaff05, 0xfe0000cf, 0x0017dc00, 0xfb00001d, 0x0000f21a, 0x01000bfc, 0x0decfc00, 0x00000000,
+    0xfeffc500, 0x1b120c0d, 0x000000fd, 0xf80000d4, 0x04220000, 0x0000f0fe, 0xfd000afe, 0x0700fcf9,
+    0xf1e9e209, 0xf40000e9, 0x001ae100, 0x040000f2, 0x0000f325, 0xf800f8de, 0x19ec0e00, 0x00000000,
+    0xfd1dc500, 0x090f081b, 0x0000000f, 0x020000ff, 0x071e0000, 0x0000f920, 0x02000917, 0xef0014eb,
+    0xdaefeff3, 0x080000f6, 0x0016fb00, 0x100000f6, 0x0000e209, 0x0300ebf0, 0x00e6fc00, 0x00000000,
+    0xf025f700, 0x0ff91309, 0x00000024, 0xe8000007, 0x0f270000, 0x0000fb0d, 0xf800ff0e, 0xff00ff01,
+    0xd3fdeced, 0x140000ec, 0x00150b00, 0x340000fb, 0x000004f9, 0xec0006f9, 0x0fefee00, 0x00000000,
+    0x03161700, 0x11fd08f5, 0x00000013, 0xe2000011, 0x191d0000, 0x0000fc18, 0xe500191b, 0x2200e40f,
+    0xb2fad508, 0xf50000e9, 0x000b1100, 0x2e0000e8, 0x0000e900, 0x1000f006, 0x0908cc00, 0x00000000,
+    0x1c012c00, 0x0ed5e200, 0x00000041, 0xfc000019, 0xf5000000, 0x00001e13, 0xe300e955, 0xd100f83a,
+    0x46e611ed, 0xf8000039, 0x00401e00, 0xe80000d6, 0x00001bd5, 0xe4000610, 0x17150000, 0x00000000,
+    0xe9fef200, 0xecf1e709, 0x0000002b, 0xef000010, 0xfef90000, 0x00001a1b, 0xfa00ed11, 0xfd00f43a,
+    0x15cd102b, 0x1100000f, 0x00380300, 0xff0000d2, 0x0000fad3, 0x1a00fdf9, 0x0bfddb00, 0x00000000,
+    0xd2d3cf00, 0xe8f30002, 0x0000001c, 0xf00000ef, 0xf8ea0000, 0x0000fa01, 0xf0000efa, 0x01000407,
+    0x23e4131b, 0x230000ea, 0x002dfc00, 0x220000e5, 0x0000f9d6, 0x1300f512, 0xd9eff600, 0x00000000,
+    0xd3d3c400, 0xee0e082a, 0x00000017, 0x11000001, 0x07e60000, 0x000014fc, 0xeb00fdde, 0x06001904,
+    0x153419f7, 0x0c0000f7, 0x0012ea00, 0x000000f3, 0x0000e90c, 0xe900ffef, 0xe4ffd800, 0x00000000,
+    0xeff5de00, 0x120ce802, 0x000000f6, 0xdc0000fe, 0x0d000000, 0x000022e6, 0xe5000def, 0xf1000cd2,
+    0x262efc05, 0x000000fc, 0x00ebdd00, 0x1400000e, 0x0000d5fa, 0xf8000202, 0x08fff900, 0x00000000,
+    0x11ffec00, 0xfe1adfff, 0x000000f1, 0xe80000e0, 0x05050000, 0x000005e2, 0xdd00f6e0, 0x0500fff9,
+    0x1316ebf1, 0xf500000a, 0x00fef400, 0xf8000009, 0x000008fb, 0xfd0001f3, 0x1df30e00, 0x00000000,
+    0x22050400, 0x071a08e1, 0x000000e1, 0xfb0000ea, 0x14fd0000, 0x0000f9fe, 0xe7000bf0, 0xf700f8fa,
+    0x093fee03, 0xf5000024, 0x0012f200, 0xf300000d, 0x0000f405, 0x080017f4, 0x33fbf600, 0x00000000,
+    0x081a0500, 0x02190ee8, 0x000000f3, 0xfa0000ff, 0x04ed0000, 0x00001200, 0xfa00fbf8, 0x0300ea1b,
+    0x092dee08, 0xe7000033, 0x0007fa00, 0xfc0000e5, 0x00001af4, 0xf60006ef, 0x1808db00, 0x00000000,
+    0x10082c00, 0xfa0f0005, 0x00000017, 0x1300000b, 0xfd080000, 0x0000e7c9, 0xe0002301, 0x03000a3d,
+    0xe923d80d, 0x010000de, 0x00010600, 0xf3000025, 0x0000f6f2, 0x00000a09, 0x02011800, 0x00000000,
+    0xecfa1600, 0x0e1b0a07, 0x00000015, 0xfe000013, 0x0c000000, 0x0000fad9, 0xe2000a26, 0x1500f626,
+    0xe106ea1f, 0xf70000ed, 0x00151400, 0x19000004, 0x0000fed7, 0xd800ebfb, 0xef17fc00, 0x00000000,
+    0xede92400, 0xfd0afdee, 0x000000f7, 0xf600001f, 0x0d010000, 0x0000e7d3, 0xfd001314, 0x110004f3,
+    0xfe0fe307, 0x03000004, 0x001cfa00, 0xef0000f5, 0x0000dd09, 0x0400e5ea, 0x0c13ff00, 0x00000000,
+    0xf1f13300, 0xe9fdf1fb, 0x000000e8, 0xfa000010, 0x10fc0000, 0x0000fccd, 0x1c00ee05, 0xeb00d508,
+    0x1717f21b, 0xf20000f1, 0x00f7e200, 0xef0000f0, 0x0000e11c, 0xd6000102, 0x18400600, 0x00000000,
+    0x0be83700, 0xdae50df1, 0x000000ec, 0xe6000021, 0x110d0000, 0x00001ddd, 0x2000dd0d, 0xd700f10c,
+    0x0bf8050f, 0xfa0000d9, 0x0000de00, 0xd40000fa, 0x000001fd, 0x07001afe, 0x201cf300, 0x00000000,
+    0x0412f500, 0xf508ef03, 0x00000005, 0x0d000000, 0x03f80000, 0x00001b01, 0x3400e6f2, 0xd500f2ef,
+    0xeaeb1105, 0x020000cc, 0x0001c900, 0xe900000a, 0x000000f7, 0xf2001229, 0x10221900, 0x00000000,
+    0xececf500, 0xedf3de13, 0x00000004, 0x1d0000f9, 0x03f70000, 0x00000202, 0x2a00edfb, 0xec000804,
+    0xe0060e07, 0x0b0000c3, 0x00f2d800, 0xce00001a, 0x00000414, 0x10001b1c, 0x19151e00, 0x00000000,
+    0xf6020100, 0x0ff5c4f6, 0x00000008, 0x19000006, 0x132b0000, 0x000015e6, 0x3200e3f1, 0xf2000c1a,
+    0xec140c06, 0xe10000c5, 0x00faf200, 0xe7000000, 0x000003fa, 0xec00e419, 0x04172700, 0x00000000,
+    0xfedd0100, 0x0c19e119, 0x0000000c, 0x16000002, 0xf81b0000, 0x0000f719, 0xdf000e02, 0xe500dfec,
+    0xe2f8f600, 0xf00000e8, 0x000d0f00, 0xe60000e9, 0x0000ec03, 0xda00200c, 0xfa17fc00, 0x00000000,
+    0x09e0da00, 0x1d11f817, 0x000000f5, 0x05000004, 0x0f090000, 0x00000e17, 0x1600ffea, 0xf000d4f2,
+    0xe4e9eaf9, 0xee0000ec, 0x00f6f400, 0xea0000ec, 0x00000a26, 0xe70027ee, 0xeb0ff500, 0x00000000,
+    0x080ef700, 0x0003e208, 0x000000fe, 0x28000020, 0x0a1d0000, 0x0000062d, 0x2000db0d, 0x0700e1f1,
+    0xeaedda17, 0xf50000f1, 0x00030200, 0xf50000fc, 0x00001a05, 0xe70034d9, 0x0308fb00, 0x00000000,
+    0x09310800, 0xe7f90102, 0x00000003, 0x03000010, 0x22f50000, 0x00000009, 0x2200fc03, 0x0d0029fb,
+    0xf807d514, 0x0a000021, 0x00de0a00, 0xff0000f1, 0x0000090f, 0xfc0026d5, 0xf8100100, 0x00000000,
+    0x0f2b0b00, 0xe7dbf6ec, 0x0000000c, 0xff000025, 0x10fb0000, 0x0000ef06, 0xf3000e23, 0xf3002cea,
+    0xddf6cc15, 0x12000037, 0x00e90d00, 0x1a000001, 0x000005f5, 0xf3000ed0, 0xff0a0400, 0x00000000,
+    0x161e0b00, 0xe0dc06fa, 0x00000000, 0xf300000c, 0x12f50000, 0x0000f7fe, 0xd400f620, 0xe8001aea,
+    0x0a1adc06, 0x1000002e, 0x00ef0a00, 0x2a000002, 0x0000f6f0, 0x0100e9df, 0x1d031500, 0x00000000,
+    0xfc020c00, 0xfce901ea, 0x000000f8, 0xf20000fb, 0xfaed0000, 0x0000e8f7, 0xf1000701, 0x04000004,
+    0x08fbe5f3, 0x11000025, 0x001c0000, 0x32000007, 0x0000fff8, 0xeb000907, 0x0102f300, 0x00000000,
+    0x03ed2800, 0xcbfc27f4, 0x000000ed, 0xd5000008, 0xffe90000, 0x0000f903, 0xda000ff3, 0xf200df31,
+    0xf501ebe4, 0x18000021, 0x00ff0800, 0x0a00001b, 0x0000fae9, 0xe30019dc, 0x07f10100, 0x00000000,
+    0x00021b00, 0x2e04fd1a, 0x00000061, 0x000000fc, 0x07fe0000, 0x00000af1, 0x0a00f4d4, 0xfc001030,
+    0xfdf640f6, 0x230000eb, 0x00f9c300, 0xd00000f6, 0x000000cd, 0xf200fef7, 0xd404da00, 0x00000000,
+    0x0926fe00, 0x2918030a, 0x0000003b, 0x190000e8, 0x1bf10000, 0x0000e900, 0xfd001dd4, 0xef001625,
+    0xf8002ffc, 0x290000fd, 0x0000a900, 0xf0000001, 0x0000e6f0, 0x12001de6, 0xe20d0500, 0x00000000,
+    0xec1ffb00, 0x2cf30631, 0x0000000b, 0x030000ef, 0x08f00000, 0x000000e5, 0x080019e7, 0xee000eeb,
+    0xfd2b0a20, 0xf6000003, 0x00eac900, 0x0a000018, 0x0000f9d0, 0xeb000edc, 0xf6280600, 0x00000000,
+    0x030dfa00, 0xf9f7e8fb, 0x000000da, 0x090000d4, 0xffe80000, 0x000011d0, 0x05001d03, 0xfe0004cf,
+    0x083ce702, 0xf1000015, 0x0001b900, 0x2c000009, 0x000003f4, 0xe600fecf, 0x011f0e00, 0x00000000,
+    0x121f2a00, 0x0ddef7f1, 0x000000b9, 0x120000ea, 0x08090000, 0x0000e0c4, 0x1900f30e, 0xfc0009e9,
+    0x0743cdee, 0xf4000011, 0x0019fa00, 0x43000001, 0x000004f0, 0xf900f9ef, 0x181efa00, 0x00000000,
+    0x01231c00, 0x06fee914, 0x000000ba, 0x0e0000dd, 0x0f100000, 0x0000ecda, 0x1b00f40d, 0xf600f412,
+    0x0914df06, 0xeb000003, 0x00151200, 0x1d0000f5, 0x000013fe, 0x1400041c, 0x0f0df000, 0x00000000,
+    0xf8282c00, 0x02e6f411, 0x000000e6, 0x0a000000, 0x13340000, 0x0000e9fd, 0x0f00f4ef, 0xdd00ef19,
+    0x09f1f804, 0xec0000fd, 0x00160b00, 0x17000008, 0x00000911, 0xf700f430, 0xfd01e500, 0x00000000,
+    0xf8f82200, 0x05f4d205, 0x000000f7, 0xef0000f0, 0x05380000, 0x0000f9fb, 0x2300010e, 0xe9001bfd,
+    0x09d2f6fb, 0x210000d7, 0x00091100, 0xfd0000fe, 0x00000017, 0x330016fe, 0xfa02fb00, 0x00000000,
+    0xe7081a00, 0xfc1419cc, 0x000000fc, 0x3a0000d7, 0xcded0000, 0x00000107, 0xf000f50a, 0x1300312a,
+    0x30ec1004, 0x07000004, 0x0015ff00, 0x08000034, 0x000013c8, 0xf1000ff5, 0xc1c8f000, 0x00000000,
+    0xdffaca00, 0x0e2415e0, 0x000000ec, 0x0b0000f1, 0x03e90000, 0x0000ecfc, 0xef0012fc, 0x0f001827,
+    0x2cf409e7, 0x1b00001d, 0x001cce00, 0x100000fa, 0x0000f9f4, 0x1500f60f, 0xe5ebfe00, 0x00000000,
+    0xf0e90b00, 0xf00228e4, 0x000000f6, 0xfa0000eb, 0x0ee80000, 0x0000030b, 0xf900e916, 0x0c0013de,
+    0x1ce014f8, 0x0f000014, 0x0012bc00, 0xff0000fd, 0x0000d617, 0x1000f917, 0xeeeee900, 0x00000000,
+    0xe5fe0000, 0x02f31afc, 0x00000001, 0xf60000fb, 0x27f20000, 0x0000082d, 0x1e00f31b, 0x2c0010d1,
+    0x36da0aeb, 0x08000028, 0x00f9cc00, 0xfb000003, 0x00000708, 0x0f000e01, 0xfaef0600, 0x00000000,
+    0xd912fd00, 0x08f21829, 0x00000004, 0xe60000de, 0x1bdb0000, 0x00000011, 0x10001220, 0x10000ae5,
+    0x2cf3f3ff, 0xef000032, 0x00eaec00, 0x05000000, 0x0000ff22, 0xef00ebf2, 0x16ff0c00, 0x00000000,
+    0xdc06e800, 0x02fef81e, 0x000000ec, 0xd80000ea, 0x00dc0000, 0x0000ee09, 0x12001011, 0x21000d09,
+    0x45f40117, 0x03000023, 0x00f3f800, 0x23000003, 0x0000fcf7, 0xeb00e3fc, 0xfbe91400, 0x00000000,
+    0xd5070b00, 0xe0041b1d, 0x000000d4, 0xca0000fb, 0xe8fa0000, 0x0000e307, 0xf9000c06, 0x080037fd,
+    0x24f1021a, 0xf6000016, 0x0001f400, 0x1200001b, 0x0000f3e0, 0x1200f614, 0x01ea0500, 0x00000000,
+    0xecd4f900, 0x00191b1b, 0x000000d3, 0xb60000e9, 0xe3e00000, 0x0000e1f0, 0xed001ae1, 0x07000a1b,
+    0x0c04f4f7, 0xe100000a, 0x001afb00, 0x0600001c, 0x0000fc05, 0xed00f800, 0x0bd92000, 0x00000000,
+    0xf8ea1500, 0xfbe80dd5, 0x000000dc, 0xe60000fa, 0x15f50000, 0x0000e5ec, 0x2100efdb, 0x1b001f00,
+    0x0f05380d, 0xf3000031, 0x00f80700, 0x210000ee, 0x0000e6f8, 0xef00080f, 0xf62cf300, 0x00000000,
+    0x171fe300, 0xe8eef811, 0x000000e7, 0x0e000003, 0xf9f30000, 0x0000fbeb, 0x2300e8f9, 0x080015f9,
+    0x15182c0b, 0x06000027, 0x00ce0400, 0x060000ef, 0x0000fcdd, 0x03000b0e, 0xe319fb00, 0x00000000,
+    0x0218fa00, 0xe00cf6ed, 0x000000f1, 0xfb00000a, 0xf9060000, 0x0000f6f2, 0x0200ebdf, 0x0f001efc,
+    0x112446f4, 0x0a000017, 0x00e01900, 0x0e0000ed, 0x0000eb02, 0x0100de27, 0x10220c00, 0x00000000,
+    0x1601f100, 0xda0af40d, 0x000000fd, 0x160000e4, 0xd8020000, 0x00000fed, 0x1000f5d6, 0xe70001fc,
+    0x12fd4227, 0xf90000d9, 0x00d50900, 0x140000fc, 0x0000f5ef, 0x0e00ef09, 0x06fcff00, 0x00000000,
+    0x07ffde00, 0x101ff602, 0x000000f4, 0x260000f5, 0xde030000, 0x00000cf6, 0x1b00f5ea, 0x0a00fc26,
+    0x43001e1f, 0xd90000d5, 0x00f6f300, 0x1b000008, 0x0000fe11, 0x0a00eef9, 0xf5f72500, 0x00000000,
+    0x1420da00, 0x0d19ee24, 0x000000e4, 0xfd0000f3, 0xe6ea0000, 0x000037f7, 0xf300f4f5, 0x0f00fcf5,
+    0x41fefb31, 0xf70000e5, 0x0014f100, 0xfa0000f3, 0x0000f618, 0x0200fceb, 0x1efd2100, 0x00000000,
+    0xfef1e400, 0x18fcec19, 0x000000e9, 0xef0000fb, 0xfe0a0000, 0x000018f7, 0xe00009f0, 0xeb00fd1b,
+    0x1feee90a, 0xfb0000fa, 0x002bf100, 0x0f0000f9, 0x0000e931, 0x06002400, 0x0b0b0d00, 0x00000000,
+    0xfb14fa00, 0x170e06f2, 0x000000f0, 0xf3000010, 0xebf50000, 0x0000e7f6, 0xeb001406, 0xf500df10,
+    0x03dbec03, 0x0f000000, 0x0018f300, 0x02000007, 0x00000519, 0xde000c02, 0x0bf80200, 0x00000000,
+    0xe811f800, 0x0ae00bee, 0x0000000b, 0x050000f0, 0x2ae40000, 0x000024f4, 0x0b00091b, 0xe60001f1,
+    0xd104db01, 0xf9000003, 0x00261600, 0xf7000007, 0x00002409, 0xfd00e5f3, 0x04fcf600, 0x00000000,
+    0x2eee3300, 0xf6f61302, 0x000000f4, 0xdc0000d6, 0x0ae30000, 0x00000909, 0xee00f90b, 0xe7000004,
+    0xed0fcdf3, 0x16000001, 0x003a2600, 0x260000ef, 0x00001124, 0xff00eee3, 0x15320c00, 0x00000000,
+    0x22ef2f00, 0xf8f51802, 0x000000f1, 0xf80000db, 0xe6f10000, 0x0000f806, 0x1d00f109, 0xee00f6fb,
+    0xd9f4c4f2, 0xf900000f, 0x00193c00, 0x2d0000fe, 0x0000241e, 0xe900cff6, 0x13141100, 0x00000000,
+    0x02c41100, 0xf70be71a, 0x000000d3, 0xef000015, 0xf4150000, 0x0000e1fd, 0x1e0005fe, 0xf0000620,
+    0xe3d3dbf2, 0x0d00001d, 0x00115500, 0x370000f5, 0x00002001, 0xe800e80a, 0xf5fdf000, 0x00000000,
+    0xfafe1300, 0x11160b11, 0x000000d4, 0xfb00000a, 0x05f90000, 0x0000e4f9, 0xf7000a06, 0xf3001216,
+    0xfceb0006, 0x12000014, 0x000d3800, 0x1c0000e3, 0x0000ffee, 0xf300eb27, 0x06d70000, 0x00000000,
+    0x03f7fa00, 0x171f131b, 0x00000004, 0xe5000016, 0xf00d0000, 0x00000a19, 0xe7001610, 0xec0004fb,
+    0x1fee13f7, 0x00000005, 0x00f60000, 0xef0000e9, 0x0000dfe6, 0x0a00e61d, 0xf2cd0100, 0x00000000,
+    0x0309f100, 0x22251f03, 0x00000011, 0xfc0000ef, 0xe7f00000, 0x00001419, 0xef001f0a, 0x0e00fcf6,
+    0x1add0eec, 0x0d00000c, 0x0004e900, 0xf50000f9, 0x0000fe02, 0xfb000107, 0xe8ec0200, 0x00000000,
+    0x08fff000, 0x122c1415, 0x0000000d, 0xe80000e0, 0x0a170000, 0x0000280b, 0xfa003010, 0xfa000fd5,
+    0x21cc0501, 0xef0000ed, 0x00fbd100, 0x040000ea, 0x0000fb0d, 0x0400f20c, 0xf2ec1e00, 0x00000000,
+    0x0500e500, 0x0dbff510, 0x000000ea, 0xd5000019, 0x0cdb0000, 0x0000fbbb, 0x0e0005e5, 0xc50012e3,
+    0xe81eed1d, 0x1b0000f1, 0x00fcfa00, 0xdc0000f5, 0x0000dc21, 0x0500fbfe, 0x03233000, 0x00000000,
+    0xf2011e00, 0xf4d7e127, 0x000000f8, 0xe7000000, 0x28da0000, 0x0000f9e7, 0x0d00f8f5, 0xde00fbfa,
+    0xe8feea2f, 0xfa0000f8, 0x0010e800, 0xfd0000f1, 0x00000710, 0x050002f7, 0x26060400, 0x00000000,
+    0x11011a00, 0xfddce51d, 0x000000fe, 0x08000008, 0x12fd0000, 0x0000fbda, 0x1600faf9, 0xe200e701,
+    0x0123ee15, 0x080000f1, 0x0008f100, 0xf10000cf, 0x00003602, 0xff0019ff, 0x0a31f800, 0x00000000,
+    0x200b0d00, 0x0af4d514, 0x00000001, 0xf800001e, 0xfb040000, 0x00000b1a, 0x1c00f40e, 0xfb00f6f8,
+    0xe806e4e9, 0xf30000ee, 0x00f6fe00, 0xf20000fa, 0x00002812, 0x0800f9f3, 0x193a0e00, 0x00000000,
+    0x12e91800, 0x00e0e716, 0x00000012, 0xe300001a, 0x06d90000, 0x0000e516, 0x1100eb04, 0xee000002,
+    0xede2eced, 0xf80000d3, 0x00f10e00, 0xe20000eb, 0x00002e0f, 0x2000e8eb, 0x06210500, 0x00000000,
+    0xefdc1e00, 0xeaefe8eb, 0x0000000c, 0x0700001c, 0xeef90000, 0x00000402, 0xf2000218, 0xfb000d02,
+    0xf8e5f507, 0x070000d2, 0x00fa0c00, 0xf30000fa, 0x0000f8f7, 0x06000512, 0xfcf71d00, 0x00000000,
+    0xf2e31b00, 0xf6e7e710, 0x0000000f, 0xf000002f, 0x00e30000, 0x000004ee, 0xeb00e9f8, 0x06001b16,
+    0x12e0f9ea, 0x260000e3, 0x00fb0500, 0xef00001c, 0x0000faee, 0xfe00ff05, 0x1b061000, 0x00000000,
+    0xe3e41600, 0x24fdfc08, 0x0000000f, 0xe800001b, 0xeed40000, 0x0000e010, 0x0d00e01d, 0xee00fe00,
+    0x12f201d9, 0x0b0000f2, 0x00e50c00, 0xea000004, 0x00000bfd, 0x1600f60c, 0x01130700, 0x00000000,
+    0xf9fbe500, 0x06ebf806, 0x0000002d, 0x130000ef, 0xe20b0000, 0x0000031d, 0xed00ff19, 0xe3000a2e,
+    0x05ddd7fb, 0x0c000008, 0x0011da00, 0xfa0000ef, 0x000025e1, 0x0500d4e7, 0x08260200, 0x00000000,
+    0xc803d500, 0xe804fcfe, 0x00000021, 0xff0000dd, 0xed000000, 0x00001b03, 0x14000cf8, 0xe7000621,
+    0xf6fbf011, 0x170000fd, 0x0033c500, 0x2600000a, 0x0000ff13, 0x2100f9d3, 0x1528f200, 0x00000000,
+    0xe41aeb00, 0x0ff21be9, 0x00000015, 0x180000e6, 0xdd160000, 0x0000f606, 0x0f001a17, 0xff001f0f,
+    0xf707e9ff, 0x11000001, 0x0037e700, 0x3f000020, 0x00000dfc, 0x0300d2ba, 0x1005e400, 0x00000000,
+    0xe8f40b00, 0x16fd12f7, 0x000000f0, 0xf60000cf, 0xed0d0000, 0x0000d907, 0x1a00231a, 0x2700fa0c,
+    0xdcfdd5fc, 0x1600000b, 0x0030f400, 0x44000003, 0x0000000b, 0xfa00fef3, 0xeedff800, 0x00000000,
+    0xe6db0500, 0xff140b05, 0x000000df, 0xe90000ec, 0x1c140000, 0x0000f7fb, 0x0c001d0b, 0x2e00d70b,
+    0xf7e8e0fa, 0x02000001, 0x002a0700, 0x1f000010, 0x0000ea16, 0x0e000c0e, 0x02dbe800, 0x00000000,
+    0xe5202000, 0x12fd2a04, 0x000000df, 0xda000010, 0x09180000, 0x0000edf6, 0x0500f514, 0x1e00de14,
+    0xe7dae5f6, 0xe30000ee, 0x00031300, 0x0b0000f7, 0x0000f9ff, 0xf200f41c, 0x10020c00, 0x00000000,
+    0x0715ff00, 0xeff711fe, 0x000000f9, 0xe300001f, 0xf72c0000, 0x00000bfe, 0x05000321, 0x17001313,
+    0x07dafbf3, 0xf10000e9, 0x00f9f300, 0xf40000fa, 0x0000e816, 0xfd00f61f, 0xea070100, 0x00000000,
+    0xda010a00, 0xfafbf613, 0x00000008, 0xd6000034, 0xf73b0000, 0x0000f0f0, 0x0500091d, 0x0d00fc11,
+    0xe1e3f713, 0x1d0000dc, 0x00f6ff00, 0xe00000f5, 0x0000e1e5, 0x18002236, 0xd629dd00, 0x00000000,
+    0xe1030100, 0xeee2f320, 0x000000fc, 0xf80000f9, 0x01cf0000, 0x0000fb00, 0xe500efed, 0x0c001003,
+    0xef02f4fa, 0xf40000fb, 0x000c0800, 0xf20000f8, 0x0000f42f, 0x1e00ecfe, 0x042c3400, 0x00000000,
+    0x01fbfe00, 0xf0131217, 0x000000fe, 0x050000f7, 0x14d50000, 0x0000d8f6, 0xd500eae8, 0xf70003ed,
+    0xf3050518, 0x06000008, 0x000c1300, 0x1d0000f7, 0x00002305, 0x070000f5, 0xdf0efb00, 0x00000000,
+    0x29e7f000, 0xe8280f26, 0x00000017, 0xdf000012, 0x26cf0000, 0x00000901, 0x040010d8, 0xf90018fd,
+    0xe50d0107, 0x070000f4, 0x00fd0200, 0x0e000008, 0x0000f820, 0x0b00ff13, 0xe6070500, 0x00000000,
+    0x32110d00, 0x0820001c, 0x0000000e, 0xf60000de, 0x08da0000, 0x0000e8ed, 0xe300fdfd, 0xec001006,
+    0xd522f914, 0x0d0000fb, 0x00121800, 0x0b000007, 0x00000d05, 0xf60008f4, 0x0df02600, 0x00000000,
+    0x1b150100, 0x1900fe1f, 0x00000005, 0xd80000f8, 0x16cd0000, 0x0000fed2, 0xe7002af0, 0xe400110c,
+    0xde29e703, 0x1b0000fc, 0x000a1900, 0x16000001, 0x00000c0a, 0xed00fdf2, 0xf3031d00, 0x00000000,
+    0x16131300, 0xfc12f915, 0x000000e4, 0xd700001e, 0xe7cb0000, 0x0000f2cd, 0xe0000404, 0xff00021d,
+    0xcc1be301, 0x12000009, 0x001c2300, 0x1c000016, 0x00000a16, 0xfc0002f5, 0x0e130b00, 0x00000000,
+    0x03192000, 0x0c0e1607, 0x000000ee, 0xbd00000e, 0xe9dd0000, 0x0000ebdb, 0xed001804, 0xdd000e12,
+    0xe4ffedf7, 0x17000022, 0x00022400, 0x170000f7, 0x00000b05, 0x0a00e01d, 0x05131c00, 0x00000000,
+    0xfb160d00, 0xeaf41903, 0x000000e4, 0xc3000035, 0xd0c60000, 0x0000e5e5, 0xf300210e, 0xd8000322,
+    0xf900f4e3, 0x04000020, 0x00171f00, 0x1100000e, 0x00000b0f, 0x18000309, 0xe2151400, 0x00000000,
+    0xfb062300, 0xf0db0819, 0x000000b7, 0x0d000015, 0x3cf90000, 0x000010bf, 0xf900de0a, 0x1200c6e6,
+    0xfaf3fae5, 0xce000001, 0x00e70d00, 0x060000ee, 0x0000f90a, 0xfc001122, 0x16070d00, 0x00000000,
+    0xf6eb1a00, 0xfbf1dd19, 0x000000d9, 0x1e00002e, 0x0af40000, 0x00000ea0, 0xf500fd01, 0xf700080d,
+    0xfbcdf42c, 0xe70000f6, 0x00d50d00, 0xec000014, 0x0000fcf5, 0xfd000612, 0x06051b00, 0x00000000,
+    0xe6fbf300, 0xf7f3ee27, 0x000000e5, 0x1d00000c, 0xce130000, 0x000003ab, 0xd5001309, 0xe700022f,
+    0xfbf6e41f, 0x1a000004, 0x002f1e00, 0xf6000019, 0x0000fbea, 0x0500e914, 0x13f50f00, 0x00000000,
+    0xf1f9f600, 0xf1120516, 0x0000000a, 0x190000f8, 0xe6fd0000, 0x0000e3e6, 0xf000151a, 0xb4000821,
+    0xe3f2fdea, 0x0d00000c, 0x004a1900, 0x0f000016, 0x000007fb, 0xfe00e40b, 0xdd07fd00, 0x00000000,
+    0x05e1ed00, 0xfc09d80a, 0x0000001e, 0x1e0000f2, 0xdfe90000, 0x0000e6f3, 0xe1001108, 0xd800fa13,
+    0xf80c06e4, 0x250000fc, 0x00392300, 0x28000002, 0x00000801, 0xfa00f904, 0xf703df00, 0x00000000,
+    0x09c91e00, 0x1304ecfe, 0x00000004, 0x170000f6, 0x07f60000, 0x0000d709, 0x0700defb, 0xf300012c,
+    0xf3ed07f5, 0x14000001, 0x002c0d00, 0x0c0000f8, 0x00000feb, 0x0f000e11, 0x0b02f600, 0x00000000,
+    0x04e80000, 0xff04eb0b, 0x0000000d, 0x25000012, 0xfafb0000, 0x0000d009, 0xfc00e5fb, 0xfd00010b,
+    0x10ee08fe, 0x08000013, 0x00330800, 0xfc0000f6, 0x0000ec01, 0xe700f522, 0x04eb0900, 0x00000000,
+    0x0df3fe00, 0x0c0522ef, 0x00000006, 0x4600001d, 0x130d0000, 0x0000fc09, 0xff001e08, 0xee000805,
+    0x0cf7050b, 0x12000011, 0x000b0700, 0xf40000ec, 0x00000702, 0x0000e5f4, 0x07f6fb00, 0x00000000,
+    0xf8fd0400, 0xe7ea1f08, 0x000000df, 0xb80000dd, 0x22060000, 0x000014df, 0x0500d616, 0x0b00e6d6,
+    0x22e0e204, 0x050000f3, 0x00190000, 0x0a00000b, 0x00000808, 0x1d00d9e5, 0xffdbe200, 0x00000000,
+    0xf7d02a00, 0x0d1cfe0f, 0x000000d9, 0xe6000003, 0xfd110000, 0x000026f2, 0x1c0001fe, 0x1400e91f,
+    0x24eaec03, 0x010000d6, 0x00f12200, 0x160000db, 0x0000fa20, 0xf200e3f6, 0x0dfbf600, 0x00000000,
+    0x0316f400, 0x1d141b2b, 0x000000f4, 0xd7000016, 0xfe280000, 0x0000e3fb, 0x1f001515, 0x2d00db2a,
+    0xfbeef5e5, 0x070000db, 0x00e31d00, 0x050000ea, 0x0000ee27, 0x01000212, 0xeff10c00, 0x00000000,
+    0xff32fc00, 0x16f5102d, 0x00000023, 0xc800000b, 0x11270000, 0x0000fde0, 0x0e001ef1, 0x0600d627,
+    0xd1031b15, 0xfc0000e7, 0x00d11700, 0x0400001e, 0x0000100b, 0xeb00f50a, 0xf6dd0b00, 0x00000000,
+    0xf8392300, 0xf414f3f7, 0x00000010, 0xe4000008, 0xe6420000, 0x0000f3e2, 0x130015f8, 0xe800ee35,
+    0xee2b1603, 0xd90000ed, 0x00ebf700, 0xf200000b, 0x00001fce, 0xf100f405, 0x1e201500, 0x00000000,
+    0xf5123800, 0xfaf7fef1, 0x00000015, 0xfb000013, 0x051b0000, 0x0000f4fc, 0x23001e02, 0xee00051e,
+    0xe31907fa, 0x090000f4, 0x0003e400, 0xfa0000ee, 0x000004e1, 0x07000018, 0x14160e00, 0x00000000,
+    0xe0ef1c00, 0x06fffce8, 0x0000000b, 0x080000e3, 0x07120000, 0x000005f6, 0xf9000701, 0xf900f815,
+    0xf910f8f6, 0xf10000e9, 0x0013dc00, 0xf60000f2, 0x00000904, 0xf90014fa, 0xe51bf800, 0x00000000,
+    0x05f91b00, 0x26fafae1, 0x00000006, 0x360000f9, 0xf21b0000, 0x0000f904, 0xf600fd03, 0xf2001406,
+    0x0400f61c, 0x0f0000e3, 0x0011fa00, 0xe20000ff, 0x0000f9fe, 0x0a000be4, 0xf80ce400, 0x00000000,
+    0xfde61800, 0xd5040bff, 0x000000de, 0xe50000f7, 0x1fe00000, 0x00000617, 0x00000a1c, 0x0e00b8f3,
+    0xcb1f2eea, 0xe60000ef, 0x0011ff00, 0xf10000e1, 0x0000dd22, 0xf400140d, 0x2df92500, 0x00000000,
+    0x08d50b00, 0xde05fb15, 0x000000e5, 0x05000012, 0x22dd0000, 0x0000f701, 0x2400ddfb, 0xfb00cced,
+    0xd3291414, 0xe50000f3, 0x000b1600, 0xd10000ea, 0x00000309, 0xff001bff, 0x2124f800, 0x00000000,
+    0x14d72900, 0xcfeeef16, 0x000000d3, 0x20000026, 0x14fa0000, 0x0000e50a, 0x1000dee3, 0x0500dae3,
+    0xfa0aef1b, 0xd70000f0, 0x00e21b00, 0xda0000f1, 0x00001511, 0x03000afc, 0x441ffe00, 0x00000000,
+    0x1fd21600, 0xe3e804fb, 0x000000d4, 0x05000037, 0x03130000, 0x0000dc02, 0x1000eafc, 0x0000f200,
+    0x06fcef15, 0xe10000ed, 0x00fb1500, 0x000000f6, 0x000003eb, 0xec00ee05, 0x17290a00, 0x00000000,
+    0x0308e700, 0xe5060102, 0x000000e4, 0x12000026, 0xe2190000, 0x00001300, 0xf7000c00, 0x2400ee0e,
+    0x0000f8fe, 0xe40000e3, 0x00ea0d00, 0xf10000f1, 0x0000f9f7, 0x0e00fa08, 0x1b021c00, 0x00000000,
+    0xf20c0900, 0x131a1d08, 0x00000000, 0xea00002b, 0xfd040000, 0x00000b0f, 0x0600ed03, 0x10000016,
+    0xf107f210, 0xee0000e0, 0x00f81200, 0x030000e5, 0x0000ff07, 0xeb0007f6, 0x00f31400, 0x00000000,
+    0x0920f900, 0x051125fd, 0x00000015, 0xc4000027, 0x041f0000, 0x00000425, 0xf200001e, 0x0600fd00,
+    0xe308f704, 0x010000ea, 0x00f01000, 0x000000f0, 0x0000110c, 0xfb00e2eb, 0xf7e5f600, 0x00000000,
+    0x120b1100, 0xf8121900, 0x00000007, 0xb40000ff, 0xec140000, 0x00001c25, 0xdb00f5e8, 0xfb00ec20,
+    0xf705f8e0, 0x140000fd, 0x00130c00, 0x080000fc, 0x00000304, 0xe400fffb, 0xf6d30e00, 0x00000000,
+    0x05172200, 0x1103f3fc, 0x000000f8, 0xe10000e3, 0xdd060000, 0x00001399, 0x0e0000f8, 0x06000904,
+    0xe10011fa, 0x0b000030, 0x0008f500, 0x140000f1, 0x0000d40a, 0x1800e4ea, 0x05070800, 0x00000000,
+    0xf5eb1400, 0xff020ad2, 0x000000ec, 0xf200000d, 0x14080000, 0x000011a3, 0x0f00dc09, 0xeb00fe2c,
+    0x1dff2001, 0x16000013, 0x00f50000, 0x28000009, 0x00000109, 0xf100f811, 0xe70ae500, 0x00000000,
+    0x03fe0d00, 0x24e6f4d6, 0x000000f4, 0xf10000ec, 0xfc0c0000, 0x0000f6c2, 0x02000ee9, 0xe300e907,
+    0x1ff047fe, 0x0d0000ec, 0x00f31d00, 0x0800000f, 0x0000fcf6, 0xf700f92d, 0xf7eedc00, 0x00000000,
+    0x1bf6df00, 0x090df807, 0x00000021, 0x1a00000b, 0xf60e0000, 0x00000ae4, 0xfd0007e3, 0xcc00fd0a,
+    0x070a530e, 0x150000e6, 0x000c1500, 0x010000fb, 0x00000f0f, 0xfe00120d, 0xf7e1f400, 0x00000000,
+    0x2915ee00, 0x0c0cf919, 0x0000002a, 0x0d0000eb, 0xf0060000, 0x00002dfd, 0xf70005e5, 0xcb0004eb,
+    0xe3153507, 0x0f000002, 0x002ae700, 0xe50000ff, 0x0000061e, 0xf0001dfc, 0x0ff31800, 0x00000000,
+    0x2b03d300, 0x190de809, 0x0000002d, 0x100000eb, 0x15240000, 0x00001409, 0x0300f400, 0xd500f8e2,
+    0xe4380206, 0x2400000f, 0x0016e600, 0xf30000fd, 0x00000f26, 0xf500fcf1, 0x17152300, 0x00000000,
+    0x370e0e00, 0xfb12cff9, 0x00000012, 0x380000fa, 0x0d0b0000, 0x0000fcfe, 0xff00ecef, 0xf1000de4,
+    0xd237eafe, 0x0e000016, 0x000c0000, 0xf10000fb, 0x00002201, 0xe300e1f8, 0xf61f1700, 0x00000000,
+    0x31f60a00, 0x13f4b711, 0x000000fa, 0x1d000002, 0xf1fd0000, 0x0000e7f4, 0x0500eb0d, 0xf800040b,
+    0xa648e9f5, 0x20000019, 0x00030000, 0xf80000f2, 0x00000700, 0xf90001ea, 0xf60b0f00, 0x00000000,
+    0x20111b00, 0x1ddd0bea, 0x00000004, 0x070000f7, 0x34050000, 0x0000cc1c, 0x040012e5, 0x1e0001d4,
+    0xf7ee0f11, 0xf7000009, 0x00fd0b00, 0x0c0000fe, 0x0000ebfd, 0x19001818, 0x2016e700, 0x00000000,
+    0x23ffea00, 0xf9eb1417, 0x00000011, 0xdb00000b, 0x1bf70000, 0x0000ffee, 0x0c00e6f9, 0x1100f9f8,
+    0xfafdfa00, 0x2000000d, 0x00e20b00, 0x060000db, 0x0000f914, 0x11000cfb, 0x232bf700, 0x00000000,
+    0x33090000, 0xdeccf51d, 0x00000012, 0xef0000f9, 0x10040000, 0x000012dc, 0x1a00dcfc, 0xf000f4f7,
+    0xec0ef31d, 0x2300000e, 0x00f70100, 0xfd0000e3, 0x00001511, 0xf600e0ee, 0xf22d0b00, 0x00000000,
+    0xfd012000, 0x1a00d50d, 0x0000000c, 0xd60000ff, 0xfe020000, 0x000008e8, 0x0e000bf3, 0xf1001508,
+    0xfa000118, 0xee0000e9, 0x00f70700, 0x310000ec, 0x00000aec, 0x1200e1ea, 0xfb0d1500, 0x00000000,
+    0xf8f42f00, 0xef040821, 0x000000fd, 0xe8000003, 0xf4fe0000, 0x00000300, 0x0f0001f2, 0xdc001b20,
+    0xed000ee7, 0xf10000d4, 0x00073700, 0x22000018, 0x00000b02, 0xf900df19, 0xeb031900, 0x00000000,
+    0xf6ef2400, 0xf710f510, 0x000000ef, 0xfa000000, 0xdd030000, 0x0000f7ea, 0xf700ffe7, 0xe5001f16,
+    0x0afcffe4, 0x160000d2, 0x00e90b00, 0x1e000020, 0x00000ff3, 0x1200db1d, 0xefee1400, 0x00000000,
+    0xd9020b00, 0x0031eae6, 0x000000f5, 0xf60000f9, 0xd90b0000, 0x00000df4, 0x0f00fbf7, 0xea001a14,
+    0xf102f7ec, 0xfc0000ed, 0x000bec00, 0xec00000e, 0x0000f6f7, 0x120009ff, 0xe0e70500, 0x00000000,
+    0xfd04f800, 0x1125dae7, 0x000000eb, 0xec0000da, 0xdfff0000, 0x0000e0e9, 0x12000a00, 0xe8000ed4,
+    0x0f06fb04, 0xf70000ef, 0x002fec00, 0xf600001f, 0x0000d908, 0x07001611, 0x000bf300, 0x00000000,
+    0xf913e500, 0xedfefe01, 0x000000fb, 0xdc0000f7, 0x0d110000, 0x00002bdf, 0xee00ed21, 0xe700a4f5,
+    0xecf9f030, 0xfc000000, 0x00fed500, 0xf40000de, 0x0000f91b, 0xfb00f6ff, 0x16181200, 0x00000000,
+    0xc5fd2600, 0x10ff00fc, 0x0000000e, 0xec0000f8, 0x08e80000, 0x000009fa, 0x0e00110f, 0xeb00d619,
+    0x11f30127, 0x050000f7, 0x00ecd100, 0x2f0000fd, 0x00000eef, 0xe60014e4, 0x1f080e00, 0x00000000,
+    0xcc29ff00, 0xfcfd00e8, 0x00000013, 0x0e0000d5, 0x06f30000, 0x00000f15, 0x02004103, 0xee00021a,
+    0x11270b27, 0xe30000f4, 0x00070400, 0x4b000025, 0x000010e0, 0xf30016ca, 0x0ee00f00, 0x00000000,
+    0xcc051200, 0x222ce6dd, 0x000000ff, 0x160000e3, 0xeffd0000, 0x000003f6, 0xf8002bf6, 0x000018fb,
+    0x1019f9fe, 0xf2000026, 0x00fff300, 0x1f000016, 0x0000eec1, 0x0a000bdd, 0x1214ed00, 0x00000000,
+    0xfee52000, 0xf2fdedd3, 0x000000da, 0x180000d5, 0x0bfe0000, 0x0000e800, 0xf60015f0, 0x03002bf1,
+    0x3a34f5e2, 0xe400003e, 0x00eedd00, 0x17000003, 0x000001d3, 0xff000508, 0x1dfff200, 0x00000000,
+    0x16fe0700, 0xe80c18fb, 0x000000eb, 0x350000d1, 0x18f80000, 0x000004ed, 0x000028f4, 0x00002cee,
+    0x2e21f8da, 0x03000038, 0x000fe800, 0x0d000003, 0x000009ff, 0xf600fa14, 0x28f0f000, 0x00000000,
+    0x0f01fa00, 0xfd0123e9, 0x00000001, 0x250000f7, 0x0ef30000, 0x00000bf5, 0x02000b10, 0xec000ff7,
+    0x4402fdf0, 0xf9000030, 0x00fbe900, 0x0b0000f2, 0x00000407, 0xe5000f03, 0x24010500, 0x00000000,
+    0x2700fc00, 0xe4ef4d0e, 0x0000000a, 0x0b0000ec, 0x0f050000, 0x00000fdd, 0x0200fbec, 0x01000405,
+    0x1af9001b, 0xfa00001e, 0x001a0000, 0x0b0000da, 0x00000404, 0xe600dc18, 0x011af800, 0x00000000,
+    0x29ea0500, 0x1ade0ceb, 0x00000014, 0x4c0000e8, 0xbee40000, 0x0000f916, 0xe90005fa, 0xe8000c22,
+    0x31140812, 0x0e0000c9, 0x0010df00, 0xf30000e5, 0x0000f6db, 0x070000f8, 0x1be70700, 0x00000000,
+    0xcbd00900, 0xfbf7f2f2, 0x000000fb, 0x150000ea, 0xf4de0000, 0x00000a4b, 0x0b0000ee, 0x0c00f20b,
+    0x07f7ffdd, 0x000000df, 0x0009c300, 0xfe0000f9, 0x000013fe, 0x01001802, 0xfcfdf300, 0x00000000,
+    0xf901e400, 0x180f1807, 0x00000004, 0x150000e8, 0x09060000, 0x0000ee48, 0xd80009d1, 0x1a001a0c,
+    0xff1ae7e7, 0xff0000ee, 0x00e2d500, 0xdb0000e1, 0x0000ec14, 0x2300fdec, 0xe912ee00, 0x00000000,
+    0xef0adf00, 0x020c1a09, 0x00000029, 0xef000004, 0x25040000, 0x00001c0b, 0xd000e3f7, 0x220007ec,
+    0xf8ebf4ed, 0xe30000de, 0x00eff900, 0xf300000f, 0x000001f9, 0x110022fe, 0xdbf40b00, 0x00000000,
+    0x21fae500, 0x1914fe15, 0x00000033, 0x02000000, 0xf9fa0000, 0x0000fbed, 0xe000e902, 0xee00f8f5,
+    0xeb0501e6, 0xe00000e3, 0x00f30f00, 0xd400001d, 0x0000fcf8, 0x0a000b01, 0xd2fa1900, 0x00000000,
+    0x19090a00, 0x1e25fa12, 0x0000002d, 0x220000e7, 0xef0c0000, 0x00000118, 0xef0009e7, 0xf700032f,
+    0x02fefe01, 0xe80000d5, 0x00f9f900, 0xe0000004, 0x000001e4, 0x1b00fbfd, 0xe1140200, 0x00000000,
+    0x05fcf700, 0xfc06f002, 0x00000021, 0x150000f0, 0xe2e60000, 0x0000f909, 0xf400f3fc, 0x0a00f012,
+    0xf2f8fff2, 0x040000dc, 0x00121500, 0xf60000f1, 0x00000ae4, 0x09001a01, 0xf006fb00, 0x00000000,
+    0x0dfc2300, 0x1d03eaf3, 0x0000001f, 0x1d0000ee, 0x01ed0000, 0x0000ea17, 0xfd000810, 0xf2000506,
+    0xede90501, 0x080000d0, 0x00f10b00, 0xff0000ea, 0x000003fe, 0x210001fc, 0xf807e500, 0x00000000,
+    0x08f30100, 0xe10de0fb, 0x00000014, 0x1f000019, 0x113a0000, 0x0000dcfd, 0xf600f412, 0x1300b704,
+    0x05c62cf4, 0x04000004, 0x00dc0100, 0xf000001e, 0x00002d05, 0xe600f9ec, 0x18edf300, 0x00000000,
+    0xf1050100, 0xe50e0400, 0x00000024, 0x06000014, 0x092e0000, 0x00000811, 0x2200f7fe, 0xea00e60a,
+    0xf9c935d9, 0xf90000f0, 0x00ed0d00, 0xee000013, 0x0000250e, 0x1600040c, 0xfcf50200, 0x00000000,
+    0x040ddd00, 0xe5221a24, 0x00000026, 0x0a00001a, 0x1b1c0000, 0x0000fbe3, 0x1800fd02, 0xfa00fe0d,
+    0xd2cd38ee, 0x000000ff, 0x00ef0800, 0xd800001c, 0x0000151e, 0xf100ee0b, 0xd2d8f800, 0x00000000,
+    0xfb11da00, 0xe3f2eb31, 0x0000000c, 0x0b00001e, 0xd9210000, 0x0000f4f2, 0x1b000a1d, 0x07001d14,
+    0xebd34309, 0x07000001, 0x001b0a00, 0xf4000019, 0x00000601, 0xec00fa11, 0xe3de1400, 0x00000000,
+    0xeeeeeb00, 0xf9f3f4fe, 0x000000fa, 0x0a00002e, 0xd6080000, 0x0000f6f2, 0x0400f704, 0x090030ea,
+    0xfcd82709, 0x12000014, 0x0032fd00, 0xe900000e, 0x0000000b, 0xea0000fa, 0x11f10e00, 0x00000000,
+    0xf7fdca00, 0xe6fc02e2, 0x000000f4, 0x1900000b, 0xe3ea0000, 0x0000f9eb, 0x0300f800, 0x0a00fffe,
+    0xfef81308, 0x1e000026, 0x002dee00, 0x030000f6, 0x0000f7fe, 0xe30006db, 0x16eefd00, 0x00000000,
+    0xd9ead400, 0xeb08f0fd, 0x000000f7, 0x140000e7, 0x0dfb0000, 0x00000df9, 0xfe000a13, 0xe6000703,
+    0xfff6051f, 0x1000002c, 0x0027f500, 0x100000ff, 0x0000f908, 0xfc001cd1, 0x0001ef00, 0x00000000,
+    0xea10e200, 0xe6f7fff1, 0x000000fb, 0x0a000007, 0x01ea0000, 0x00000803, 0x0900f90a, 0xec00f2f7,
+    0x0ceafd14, 0x1500001a, 0x0027f100, 0xfe0000f2, 0x0000e61b, 0xe5000ee3, 0xff10fc00, 0x00000000,
+    0xdc0fde00, 0x260e0fc4, 0x000000ca, 0xfe000033, 0x21370000, 0x0000012b, 0xf40013e9, 0x2800e809,
+    0x1a1e0309, 0xda000019, 0x00b7e000, 0x22000010, 0x000003f7, 0xfb0021e5, 0x0219df00, 0x00000000,
+    0xcb4fe200, 0x0d070fb7, 0x00000018, 0x030000ff, 0xff2a0000, 0x0000e908, 0xfd0035fa, 0xe1001402,
+    0x04fd0ee4, 0x0c000001, 0x00d2f100, 0x18000017, 0x00000add, 0x0a000ee5, 0xe0fbcb00, 0x00000000,
+    0xfc330700, 0xf90d0ee0, 0x00000037, 0x040000f4, 0x182b0000, 0x0000e4f8, 0xe50024ec, 0xcd00f637,
+    0xfacb35dd, 0x090000e4, 0x00dfe900, 0xf800000a, 0x000003ec, 0xfe000e07, 0xedd5ea00, 0x00000000,
+    0x0e270c00, 0xe91f1d0f, 0x00000046, 0x1b0000f3, 0x12040000, 0x0000010a, 0x060015f7, 0xe8001010,
+    0xf9053500, 0x0e0000eb, 0x00ffe800, 0xe6000000, 0x000013f6, 0xe7000514, 0xd8ec0100, 0x00000000,
+    0x04eb0000, 0xfb091528, 0x00000025, 0x170000f6, 0x16120000, 0x0000e709, 0xfa0012f4, 0x0800fd0f,
+    0x033914ed, 0x0e0000f4, 0x00efce00, 0xd50000ff, 0x0000e9f6, 0xf900f4f8, 0xf6ef0f00, 0x00000000,
+    0xfcc0e800, 0xfffc09fc, 0x00000000, 0x48000017, 0x0d030000, 0x0000e50a, 0xf6000b0e, 0x0b0013fd,
+    0xf831fef5, 0xd50000fe, 0x00ecde00, 0xe70000f5, 0x0000edfc, 0xff0004f5, 0x0f131e00, 0x00000000,
+    0xfbfffa00, 0xec12ee05, 0x000000e0, 0x36000020, 0x1efa0000, 0x0000f5f7, 0x06000e18, 0x2200e401,
+    0x0f39ef0c, 0xf9000001, 0x00eee700, 0xdd00000d, 0x00001000, 0x000001eb, 0x0e161900, 0x00000000,
+    0xf5f20a00, 0xfa190dee, 0x000000da, 0x1e000007, 0x34d30000, 0x00001903, 0x0400f715, 0xfd000a05,
+    0x0d28f70e, 0xde0000f5, 0x00d8f800, 0xec0000ea, 0x0000e708, 0xfe000be8, 0x0b110e00, 0x00000000,
+    0xec101800, 0xdb1bf523, 0x00000036, 0xf90000df, 0xf1f60000, 0x0000e942, 0x0f00f70f, 0xfa0026fd,
+    0xfffa0bea, 0x11000037, 0x00180400, 0x260000f7, 0x0000f3da, 0xde000afa, 0xeaf3fa00, 0x00000000,
+    0x3cf8f100, 0xe718161d, 0x000000fd, 0xe20000fc, 0x0b0f0000, 0x0000f20b, 0xfc00f510, 0xee000beb,
+    0xf705f0d8, 0x0c000020, 0x00e50600, 0x0e0000e9, 0x0000e20d, 0xf900e010, 0xdb08e700, 0x00000000,
+    0x0f1bec00, 0x02f1e700, 0x000000f3, 0x04000009, 0x062d0000, 0x000004de, 0x0100fd12, 0xeb000ee5,
+    0x18e0effa, 0xf3000008, 0x00dc0f00, 0x0e000000, 0x0000130f, 0x020000fb, 0xde141700, 0x00000000,
+    0xf3080f00, 0xf902e306, 0x000000d8, 0xf00000f5, 0xf3010000, 0x00002ee2, 0xf600000a, 0xe0002901,
+    0x13cf0b18, 0x05000000, 0x00c60400, 0x23000010, 0x0000ef06, 0xdf001104, 0x0fd22500, 0x00000000,
+    0xf70ff100, 0xf01ae0ff, 0x000000e1, 0xdc0000ea, 0xfaf40000, 0x000025ef, 0x0000240d, 0xdc002705,
+    0x0cda081d, 0x0d000010, 0x0000f600, 0xee000017, 0x0000ea02, 0xe0001c0e, 0x01c30400, 0x00000000,
+    0xf9f7f700, 0x1c170c07, 0x000000f1, 0xda000000, 0xfbea0000, 0x0000f5f4, 0x10002405, 0xec0024ed,
+    0x1df51816, 0x1d000029, 0x0012de00, 0x0a000021, 0x0000d7fb, 0x02000f05, 0xe4c3f300, 0x00000000,
+    0x0213e200, 0x00051af9, 0x00000002, 0xd10000ff, 0xedf20000, 0x000002e4, 0x0700160c, 0x0d000611,
+    0x140523f1, 0x0d00003a, 0x00f6da00, 0xee0000fe, 0x0000050d, 0x03002128, 0xdbed0b00, 0x00000000,
+    0x0600df00, 0xeb0337f3, 0x000000ff, 0x12000003, 0xf3030000, 0x00000d07, 0x12000df9, 0x0800140a,
+    0x10001306, 0x10000034, 0x0007e800, 0xff0000e5, 0x000010f8, 0xec00fe11, 0xe3f30e00, 0x00000000,
+    0x05100c00, 0xf1e4f315, 0x0000004d, 0x07000007, 0xee380000, 0x00000fbe, 0x1700beec, 0x0c00c02b,
+    0xecebe9e1, 0x0d0000dd, 0x00120900, 0xcc0000f8, 0x0000f307, 0xf800f9f7, 0x1b0e0500, 0x00000000,
+    0xfb10ee00, 0xf100fa15, 0x00000059, 0xdb00000c, 0x07120000, 0x00001600, 0xfa00e20e, 0xf500d913,
+    0xd9d90305, 0x310000e5, 0x0006f300, 0x04000004, 0x0000f726, 0x170004dd, 0xec151700, 0x00000000,
+    0x03110700, 0x0a14e123, 0x00000047, 0xe90000ed, 0x090f0000, 0x00001405, 0xfd00de03, 0xe900ce19,
+    0xd5d2f3fa, 0x150000f1, 0x00170000, 0xfd000010, 0x0000111a, 0x1700fe06, 0xd904fd00, 0x00000000,
+    0xfc2ffd00, 0x0a00d717, 0x00000035, 0xf40000dc, 0xf60e0000, 0x0000fbe7, 0x0600e2ec, 0xd200f013,
+    0xe8d7160a, 0x200000de, 0x00130d00, 0x04000025, 0x00001c08, 0xfc001ff8, 0xf8060d00, 0x00000000,
+    0xee171800, 0x0df6c020, 0x0000001e, 0x1100000b, 0xe5040000, 0x0000e0f7, 0x0e0011ef, 0xe1000913,
+    0xe9ec20e9, 0x260000f5, 0x00130700, 0x0200000f, 0x0000f609, 0xf900fee8, 0xf112fe00, 0x00000000,
+    0xe200f700, 0x11f8d310, 0x00000010, 0x19000017, 0xe2f90000, 0x0000e7f0, 0x1600ffe7, 0xea002700,
+    0xf4011402, 0x09000007, 0x001aeb00, 0xfe000026, 0x0000ed19, 0xfc00f3d9, 0xf0120500, 0x00000000,
+    0x071d0000, 0xfeebe10b, 0x00000012, 0x1300000d, 0xff0b0000, 0x0000e1fd, 0x0600daf5, 0xe50028eb,
+    0xf0160af3, 0x1300001d, 0x0001eb00, 0xe2000013, 0x0000ea0d, 0x0100ecf0, 0xfb110700, 0x00000000,
+    0x08020100, 0x04dcd203, 0x00000010, 0x37000003, 0xf1030000, 0x0000e0fd, 0x1c00f9f7, 0xe6001cd2,
+    0xfe17fb0e, 0x0600000f, 0x00fcf300, 0xf1000013, 0x0000031c, 0xf2000808, 0xee082100, 0x00000000,
+    0xfe0ec500, 0x02d2e521, 0x000000f5, 0x06000005, 0x00010000, 0x000027e5, 0x1000f7ea, 0x0c00caee,
+    0x12f01400, 0x0d0000ea, 0x00fd0300, 0xe20000e0, 0x00000cfe, 0xff00f816, 0x08420000, 0x00000000,
+    0x09f0f200, 0xe7ffde0a, 0x000000f8, 0xf3000004, 0xfe060000, 0x0000fb1d, 0xfa00dd02, 0x1400d604,
+    0x26da0b08, 0xe80000f0, 0x00fee900, 0xef0000e8, 0x00001bfe, 0x24001bfd, 0x0d2b0500, 0x00000000,
+    0xe915e500, 0x00fdfc08, 0x00000001, 0xe000000a, 0xf7f80000, 0x00000a09, 0xee00e203, 0x0000dd16,
+    0x32c8f9f7, 0x110000fb, 0x00ebd300, 0xf40000f1, 0x00000ef2, 0x2600ec14, 0xff0af900, 0x00000000,
+    0xda1ace00, 0x17f71020, 0x00000022, 0xdb0000f9, 0x14eb0000, 0x00002219, 0x0500f504, 0x0f00ed1d,
+    0x1eebf804, 0x060000fc, 0x00f3d000, 0x0a0000fd, 0x0000f5e0, 0x1f00ea00, 0xf9f41000, 0x00000000,
+    0xfe0ad800, 0x1e0a00fa, 0x00000018, 0xed0000ee, 0x0cf00000, 0x00001c09, 0xfe00f211, 0x0b00f1ee,
+    0x04e4ecf2, 0x0b0000e3, 0x0002d200, 0x100000ee, 0x0000fceb, 0x1a00f302, 0xfff9fb00, 0x00000000,
+    0xd0070700, 0x120bfe24, 0x000000fd, 0xe00000ec, 0x0fe60000, 0x0000f413, 0xe5000c26, 0x0d00e2f4,
+    0x0ff5e9ee, 0xf40000d9, 0x000ce100, 0x1c000018, 0x0000e911, 0x1e00ff03, 0x1702eb00, 0x00000000,
+    0xf5f30200, 0x0f19f0f9, 0x000000f9, 0xf00000f4, 0xfdeb0000, 0x000012fe, 0xe9000f04, 0x220008f6,
+    0xfe07fa06, 0xe00000fe, 0x000ae300, 0x060000f4, 0x00000afa, 0x0300031f, 0x1b13fe00, 0x00000000,
+    0xf9f01c00, 0x21080ef7, 0x00000009, 0x030000e0, 0x05040000, 0x0000f2f0, 0xfd00fe21, 0x10001310,
+    0x121a04fe, 0xe10000ff, 0x000ffc00, 0xf8000019, 0x0000f70c, 0x0f00fb21, 0x0e0afa00, 0x00000000,
+    0xfefff800, 0x29f7e3fe, 0x000000fe, 0xfc00000b, 0x0ef20000, 0x00002318, 0xeb00f0dd, 0x2900e0e7,
+    0x0af90be9, 0x0a000004, 0x00f70500, 0x0500000f, 0x0000d40a, 0x3900e514, 0x0726f700, 0x00000000,
+    0xe806fe00, 0x23fdffe7, 0x000000fe, 0xef00000d, 0x0ffb0000, 0x00001df6, 0xed00e307, 0xf400e5e9,
+    0xf1050cfd, 0xf10000f4, 0x00eb0200, 0x060000f5, 0x000002ff, 0xf8000710, 0xeb1cef00, 0x00000000,
+    0x21eff200, 0x10f701e4, 0x000000ff, 0xeb0000fc, 0xe6f00000, 0x000008e7, 0xe50000ed, 0x0500f3f0,
+    0xfd0510f4, 0xe70000f3, 0x00f4e800, 0xf700000c, 0x0000fb0f, 0x12000af1, 0x1b08f800, 0x00000000,
+    0x2109fa00, 0x24ffebea, 0x00000002, 0xf80000eb, 0x0bfd0000, 0x000004f5, 0xe900e8ed, 0x0600fb02,
+    0x0ff8f814, 0xf20000e4, 0x00f8e200, 0xed0000ff, 0x00001011, 0x1d00111a, 0x04f1ef00, 0x00000000,
+    0x1a00e900, 0x1d01f8ed, 0x00000007, 0xe600000a, 0x05de0000, 0x00001cfb, 0xeb00fb11, 0x0800f002,
+    0xfddef922, 0xf30000f0, 0x00fbe600, 0xeb0000f0, 0x0000ffff, 0x16000b11, 0x1b0ee100, 0x00000000,
+    0x13f6f200, 0x09e80ff1, 0x00000012, 0xf10000e3, 0x08ff0000, 0x0000210c, 0x1600e313, 0xfd0007f8,
+    0x09da070f, 0xf80000e4, 0x0020fd00, 0xf1000002, 0x000002f7, 0x1800fbf8, 0x1ff50a00, 0x00000000,
+    0xfefedb00, 0x27f311fe, 0x00000009, 0xff000008, 0x10e80000, 0x00000609, 0x0500f023, 0x0b00f1fe,
+    0x0aee0c0d, 0xf80000e1, 0x00080400, 0x060000f5, 0x0000f804, 0xf500f920, 0x13fcf500, 0x00000000,
+    0x0210f400, 0x21f4f10c, 0x0000000c, 0xfa00000b, 0xfff70000, 0x0000fdf1, 0xf000f235, 0x0c000012,
+    0xecf3032d, 0xff0000ed, 0x00030500, 0xf7000001, 0x0000fd06, 0x3500ec18, 0x2011c800, 0x00000000,
+    0xf804e200, 0xfe211aea, 0x000000cb, 0xec0000fb, 0x24030000, 0x00001d16, 0x1600140a, 0x0a000fd0,
+    0xde38f2f9, 0xe4000011, 0x00ddff00, 0x1f0000ee, 0x000008f0, 0x010009f1, 0x2131f300, 0x00000000,
+    0x28fe3900, 0x18200ae9, 0x000000ce, 0x1b000013, 0x16050000, 0x000019ef, 0x1a0028ec, 0x180008d4,
+    0xef24d711, 0xfb000011, 0x00f0ed00, 0x1000000e, 0x0000eb15, 0xf70005e7, 0x041c0000, 0x00000000,
+    0x0f191c00, 0xfd0a21d5, 0x000000db, 0x080000f0, 0x1d160000, 0x0000e4e9, 0xe9000ef8, 0x30001be5,
+    0xfd0ac707, 0x14000034, 0x00dddd00, 0xf700001b, 0x0000dc13, 0xfa000d00, 0x0013e600, 0x00000000,
+    0x30291f00, 0xfdfa0ef1, 0x000000dd, 0xef0000e5, 0x27040000, 0x0000e2e8, 0xf800120a, 0x06000cf5,
+    0xe8fad8f7, 0x0f000033, 0x00f80300, 0xfb000026, 0x000004e4, 0x09000236, 0xf6f3fb00, 0x00000000,
+    0x23133a00, 0x0c0e0803, 0x000000f0, 0xe80000ed, 0xf3120000, 0x0000efd2, 0x0e001bf4, 0x060006ff,
+    0x0fe0f6f7, 0xfd000017, 0x00ed0d00, 0xff000017, 0x0000faea, 0xec00eb34, 0x07d10400, 0x00000000,
+    0x09f42f00, 0x0806f202, 0x000000ed, 0x080000f8, 0xf9150000, 0x0000efe4, 0x1600ed09, 0xfd000c1b,
+    0xeadb09ed, 0x04000004, 0x00f80600, 0x0a000018, 0x0000fcef, 0xdb00e42d, 0xfedd0e00, 0x00000000,
+    0xebe70100, 0xfae6edff, 0x000000ef, 0x0f000001, 0xe6250000, 0x00000ae1, 0x1900090e, 0xfd002607,
+    0xf9eb1005, 0xe9000003, 0x00050200, 0x0200000d, 0x0000f3f5, 0xf200e41d, 0x00c70d00, 0x00000000,
+    0xe9fb1700, 0x0e06f30e, 0x000000f0, 0x240000f3, 0xff1d0000, 0x00001cdd, 0x1b00ffe9, 0x00002603,
+    0xf3f70b15, 0xf0000000, 0x000b0100, 0xf7000007, 0x0000e9e5, 0xf100f129, 0x05daf100, 0x00000000,
+    0xda03f900, 0xe90315fc, 0x000000ca, 0xed0000fd, 0x19fc0000, 0x0000e72e, 0x1400df06, 0x2c000c09,
+    0x0e161212, 0xe3000027, 0x00df2500, 0x3b00001d, 0x000032da, 0xe40015fa, 0xd018e400, 0x00000000,
+    0xcb421a00, 0xe7071eee, 0x000000e6, 0xd40000ee, 0x0cfc0000, 0x0000cef3, 0xfb00ef19, 0x0c000ef9,
+    0xf80605e9, 0xe4000015, 0x00d72a00, 0x350000e4, 0x0000fdf0, 0xf4000414, 0xde04fa00, 0x00000000,
+    0xd7522400, 0xe8f115f6, 0x00000002, 0xb50000ee, 0xf1000000, 0x0000f0fc, 0xf600e008, 0xe600030b,
+    0xeb1a19f2, 0xf500000c, 0x00004400, 0x370000ff, 0x0000f1fc, 0x0300e709, 0xeefdef00, 0x00000000,
+    0xf8103f00, 0xdefef2fd, 0x00000011, 0x020000de, 0xf5ff0000, 0x000004f4, 0x1600e501, 0xf2002628,
+    0xe60d18c8, 0xfb0000de, 0x00043d00, 0x320000e5, 0x00001b0a, 0xfe00f1f7, 0xca0a0a00, 0x00000000,
+    0x00094200, 0xdefbd100, 0x000000ee, 0x27000002, 0x1def0000, 0x0000260f, 0xf600edf2, 0x0c00fe13,
+    0xf9dfeed9, 0xf40000cf, 0x00061c00, 0x280000e9, 0x00001212, 0x1500f601, 0x02f91b00, 0x00000000,
+    0xf4db1d00, 0x0906cd17, 0x000000df, 0x1c0000f7, 0x0df50000, 0x0000221d, 0xf700f9e9, 0xfc000b20,
+    0xfdd6d7fd, 0xe30000f0, 0x00fbf500, 0x07000022, 0x00000706, 0x1900eae9, 0x37032100, 0x00000000,
+    0xf0f70a00, 0x1115ff0e, 0x000000f2, 0xdc0000fe, 0x0be10000, 0x00000300, 0xd40007f6, 0x21000eff,
+    0x22eaec04, 0xe60000fc, 0x00ffe900, 0x0300000d, 0x0000f813, 0xef00e6f7, 0x1deb3b00, 0x00000000,
+    0x02101200, 0xfe2ef70b, 0x000000ed, 0xe70000ff, 0xf0d90000, 0x00000bf9, 0xd400070c, 0x1c0009fd,
+    0x09f0f3dd, 0xda00000b, 0x00e8ef00, 0x09000018, 0x0000f224, 0x040005f6, 0x10eb1600, 0x00000000,
+    0x0d1ffd00, 0x0e25f01c, 0x0000002c, 0x21000002, 0xd3110000, 0x0000fdf8, 0xdb0035ea, 0xe900213a,
+    0x0d18da11, 0x000000e2, 0x00fa0c00, 0xfc0000f0, 0x0000e122, 0x1500ee1c, 0x04fc1500, 0x00000000,
+    0x0bdf0100, 0x13060424, 0x00000019, 0xf00000fb, 0xfa210000, 0x0000fb0c, 0xfc00faed, 0xf100012a,
+    0xf2f0d001, 0x020000eb, 0x00fb2800, 0x07000004, 0x00001918, 0xe500d608, 0x05160400, 0x00000000,
+    0x12e10b00, 0x1a040328, 0x00000005, 0xd80000f6, 0x18130000, 0x0000f4e9, 0xeb000ae7, 0xef00cffb,
+    0xd6f3d507, 0x170000e9, 0x001e1700, 0x12000002, 0x0000fae5, 0xee00f809, 0x1b041400, 0x00000000,
+    0xfdda2500, 0x1b24dd00, 0x000000e5, 0xf90000f1, 0x0e120000, 0x0000eec1, 0x000012f9, 0x1100fa08,
+    0xdd33ffee, 0xfd0000f6, 0x000a1300, 0xf000000f, 0x0000f3d7, 0x0600e5f6, 0xee13fb00, 0x00000000,
+    0xe7eb3200, 0x0719cae3, 0x000000c7, 0x19000008, 0x0a2a0000, 0x0000f5e8, 0x14001a01, 0xf000e8fc,
+    0xd30706eb, 0xd10000e4, 0x00ebf900, 0xea000013, 0x0000fad7, 0x10000122, 0x0926e000, 0x00000000,
+    0xe8170700, 0xf00fc907, 0x000000d6, 0x230000ea, 0x07210000, 0x0000ebfd, 0x2c001118, 0x0a00ffea,
+    0x050f0606, 0xd80000d5, 0x00e6dc00, 0xf400001f, 0x0000f6da, 0x23000d12, 0xff17d500, 0x00000000,
+    0xed040500, 0xf70fc8e5, 0x000000ee, 0x310000fe, 0x0f180000, 0x00000be9, 0x23000b06, 0x1c0018e6,
+    0xfa081e0a, 0xef0000de, 0x00f9ed00, 0xf200000c, 0x0000ebe9, 0x1e00fbf9, 0x1af7d700, 0x00000000,
+    0xf4230600, 0x2026f4ee, 0x000000ef, 0x210000d6, 0x162c0000, 0x0000f8fc, 0xfe000f2d, 0x150016fa,
+    0x0ade153b, 0xe70000d2, 0x00edf700, 0xe50000fe, 0x0000d6fc, 0x11000c09, 0x21ecbc00, 0x00000000,
+    0xf9fbf500, 0x2aedee10, 0x000000dc, 0xec00000c, 0x12eb0000, 0x0000002b, 0x0100e8dd, 0x0100e41b,
+    0x2222f4e0, 0xf80000ef, 0x00e20c00, 0x19000003, 0x00000007, 0x3600e7fb, 0xf10b1c00, 0x00000000,
+    0xc10f0100, 0x1b01010e, 0x000000e3, 0xf100000f, 0x04e00000, 0x00000efd, 0xf100e3f6, 0x1a00fd18,
+    0xf5f6ed09, 0xd20000ef, 0x00e50100, 0xff000002, 0x0000e803, 0x130020f0, 0x1b090600, 0x00000000,
+    0xeb01f900, 0x22eafeea, 0x000000f1, 0x03000006, 0xe8030000, 0x00000b12, 0x0500d908, 0x390005ec,
+    0xe6f4f20d, 0xce000001, 0x00fbf500, 0x0d000015, 0x0000f315, 0x2c0004dd, 0x081ff900, 0x00000000,
+    0x06ef0100, 0xff15f2eb, 0x00000004, 0x05000002, 0x02000000, 0x000002fa, 0xea00f212, 0x1100eef3,
+    0x0b02fa0a, 0xfd00000a, 0x0008f100, 0xf3000019, 0x00000a0e, 0x1200f1e6, 0x201af100, 0x00000000,
+    0xf70aee00, 0x05061cff, 0x00000014, 0xef0000d8, 0x01e00000, 0x0000f0f4, 0xf30002f6, 0xe800fbfa,
+    0x08f1030d, 0x080000fd, 0x0019fa00, 0xfa0000f7, 0x00000b20, 0x22000003, 0xff1a0000, 0x00000000,
+    0x0bfee500, 0x23fb0ffb, 0x00000013, 0xfb0000f5, 0x05e50000, 0x0000e4e9, 0x0100f904, 0xf500e7f1,
+    0xe6fa0e17, 0x1c0000fa, 0x001af500, 0x0300000a, 0x00001cee, 0x18000cf8, 0xf816fb00, 0x00000000,
+    0x0c12f100, 0xefeaec05, 0x00000000, 0x040000dd, 0xf5f20000, 0x0000f1ed, 0x0700ff18, 0x0300fff0,
+    0x02e20d19, 0x1d0000f7, 0x00070900, 0x0000001d, 0x00000208, 0x070012f7, 0xe51fe700, 0x00000000,
+    0x0902f300, 0x230a0a11, 0x00000006, 0x080000d9, 0xd2040000, 0x0000d7d8, 0x19000b15, 0xda0027ec,
+    0x06e1131e, 0x1f0000f6, 0x00100100, 0xfc0000ed, 0x0000f61a, 0x20001527, 0x1306e700, 0x00000000,
+    0x1f030600, 0x1a19fa02, 0x0000001f, 0x160000e6, 0xd61f0000, 0x0000fcd5, 0x1a0022ea, 0xed0005f8,
+    0xce263e0e, 0xf4000012, 0x00f62d00, 0x04000011, 0x0000f9f9, 0xc7000104, 0x0e090c00, 0x00000000,
+    0x1e154200, 0xfb03dc0e, 0x00000016, 0xf40000d3, 0xe80c0000, 0x0000f1f0, 0x2b00f7f2, 0xff00ff00,
+    0xca3e1e10, 0x0a000011, 0x001ff500, 0x1600000e, 0x00002505, 0xfd0004f4, 0xed06fc00, 0x00000000,
+    0x22fa1e00, 0xf204e82c, 0x000000f5, 0xf80000ff, 0xe5050000, 0x0000ff13, 0x1c00f3fc, 0x0c00e3cf,
+    0xbd200dd9, 0xdd000008, 0x00f5fe00, 0x0e0000f8, 0x0000f604, 0xe100fef8, 0xe42f0100, 0x00000000,
+    0x1f152300, 0xede7c8f0, 0x000000f6, 0x08000009, 0x19160000, 0x0000f80c, 0x0200d608, 0xfd00e3e1,
+    0xf010f7c6, 0xca0000fa, 0x00e4f600, 0x090000ed, 0x00001203, 0x14000919, 0x1215f400, 0x00000000,
+    0xfc010700, 0xe90fd6df, 0x000000f4, 0xfe000012, 0x1c140000, 0x00000b01, 0x0700eaf4, 0x0600fb07,
+    0xf812fb01, 0xe4000007, 0x00c9f400, 0xf70000e6, 0x0000010f, 0x0f00ec0b, 0x233d0100, 0x00000000,
+    0xf20e0400, 0xfe00eae7, 0x000000fe, 0x180000f4, 0x1e0d0000, 0x00000f0a, 0xf50000f5, 0x0d0015ef,
+    0xe2f0f615, 0xf10000fe, 0x00c00000, 0xf40000ee, 0x0000f6fe, 0xfc00f9c7, 0x0a15ff00, 0x00000000,
+    0xff182200, 0x060af6e3, 0x00000007, 0x150000e9, 0x08f00000, 0x00000d06, 0xed00e6f6, 0x1b000be1,
+    0xfdfeff0f, 0xf3000001, 0x00eb0e00, 0xf00000fe, 0x0000040a, 0x050013f2, 0x2ff31300, 0x00000000,
+    0xea150200, 0x070b09f6, 0x0000000a, 0xf800000e, 0x10e50000, 0x00000317, 0xe90001ec, 0x0200e70e,
+    0xe11f05eb, 0xfe000015, 0x00f0f600, 0xfa0000e7, 0x000007ed, 0xea00fedf, 0x23060100, 0x00000000,
+    0xfcfe0b00, 0xfa04e2ec, 0x000000c8, 0x2b00002c, 0xce3f0000, 0x0000f6cc, 0x1f000503, 0xe2002a19,
+    0x0d36f4f7, 0x0a00000e, 0x00012500, 0x030000d9, 0x000012e6, 0xd7002aea, 0x171df900, 0x00000000,
+    0x190a2700, 0x0cf4e907, 0x000000aa, 0x3b000023, 0xfe290000, 0x0000faf8, 0x20000900, 0xe3001b02,
+    0xfc15b70e, 0xfd000002, 0x000bfc00, 0xfb0000f9, 0x000010ed, 0xd2000e0d, 0x0412fa00, 0x00000000,
+    0x0004fd00, 0xfef9e3ec, 0x000000d5, 0xfa0000ff, 0xda170000, 0x00001103, 0x1f00e5fb, 0xe8001b11,
+    0x00e9b1f2, 0xeb000008, 0x000ef800, 0xff0000d5, 0x00000e05, 0xe80000fc, 0xf9f0f600, 0x00000000,
+    0x0f1bdf00, 0xef010def, 0x000000f7, 0xf400000f, 0x0ffb0000, 0x00001c06, 0xf500defa, 0xe8000e19,
+    0x14cdd3e3, 0x0d0000f3, 0x00000200, 0xf30000e5, 0x0000efff, 0x0800ed12, 0xe4d81900, 0x00000000,
+    0x020afe00, 0x000936f9, 0x00000029, 0xea00001d, 0x120c0000, 0x00000613, 0x0800e317, 0xe9002120,
+    0xfeb6f0fd, 0x110000eb, 0x00000500, 0xd40000db, 0x0000040f, 0x0c00ff2a, 0xdadf1400, 0x00000000,
+    0xf3f6e200, 0xf9061c04, 0x0000003a, 0xfe00000c, 0xfc190000, 0x00000824, 0xfb00ff23, 0xf1000401,
+    0x00b9f50f, 0x2b0000da, 0x000ff300, 0xd80000ef, 0x0000f6ff, 0xec000603, 0xd1f61200, 0x00000000,
+    0xe7fdfe00, 0x07fb1eea, 0x00000027, 0xd600001f, 0x160e0000, 0x0000f908, 0xf2002512, 0x11000412,
+    0x00defa19, 0x2f0000ec, 0x0006f900, 0xd70000e6, 0x0000fef8, 0x04001202, 0xd7010600, 0x00000000,
+    0xf0f8ff00, 0x18f438eb, 0x00000021, 0xf400000c, 0x280a0000, 0x00001f02, 0xe7001905, 0x0700fdf2,
+    0x23f30507, 0x260000e8, 0x00020700, 0xe70000f1, 0x00001af6, 0xdd0028fe, 0xf7f30e00, 0x00000000,
+    0xefe2fa00, 0xf6060e1d, 0x0000001c, 0xdf000016, 0x21f00000, 0x0000e106, 0xeb00fcfb, 0x00000eed,
+    0xd90cc8f0, 0xfe000018, 0x00131000, 0x25000021, 0x000013e9, 0x1e00dbf8, 0xe3190b00, 0x00000000,
+    0x12f10000, 0x0efaff39, 0x00000039, 0xf700001c, 0x17dc0000, 0x00000e04, 0xe700ec12, 0xd600f203,
+    0xe2e4d7f1, 0x23000003, 0x00fe4300, 0x270000fd, 0x0000fd05, 0x0400e40f, 0x0a0a3800, 0x00000000,
+    0xebf8f900, 0xf204002b, 0x00000022, 0xeb00000e, 0x05d00000, 0x00000709, 0xf900f616, 0xe300f21a,
+    0x07d8f913, 0x2900000e, 0x00081200, 0x060000f8, 0x0000f2e9, 0x0900e727, 0xfef91500, 0x00000000,
+    0xcdebe100, 0xfe180111, 0x00000015, 0xda000019, 0xd8b90000, 0x0000f016, 0xcc00f311, 0x04000d0f,
+    0x2de9150c, 0x17000026, 0x00fee200, 0x0100000e, 0x0000f2f1, 0xf400e627, 0x030c1200, 0x00000000,
+    0xcfd9c600, 0xfdfb1d03, 0x0000000b, 0xe6000007, 0xebc60000, 0x0000e70a, 0xfc00f128, 0x160011f8,
+    0x43071a1c, 0x0d000017, 0x0004bb00, 0x09000016, 0x0000fad8, 0xef0005f7, 0xe9e91000, 0x00000000,
+    0xc9f7cc00, 0x1af434e9, 0x000000f5, 0x060000eb, 0xffe40000, 0x0000f00d, 0x0d000623, 0x13001ced,
+    0x261f2222, 0xe8000039, 0x0000da00, 0x4200001f, 0x0000e3e2, 0x0f0006d2, 0xcffbf600, 0x00000000,
+    0xd0030100, 0x0df81606, 0x000000e1, 0xf80000c0, 0x07de0000, 0x0000ebfc, 0x1d000c08, 0x200001f7,
+    0x3a390afb, 0xea000031, 0x0007ff00, 0x4700001b, 0x00000700, 0x050012e4, 0xdf17f500, 0x00000000,
+    0xef0a0e00, 0xfaf02800, 0x000000d6, 0xf80000e3, 0xf5d60000, 0x0000e401, 0x1c00f51e, 0xfd00e40a,
+    0x0a3003f2, 0xfd00003d, 0x00040600, 0x5500001a, 0x00001afa, 0x190024cd, 0x0d18e600, 0x00000000,
+    0xfd0c1d00, 0x08da1a22, 0x000000ea, 0x02000000, 0xef090000, 0x0000d41c, 0x2100ead8, 0x1800faf8,
+    0x0f030b02, 0x120000ee, 0x00e6e300, 0x0f000009, 0x00001804, 0x2200e3f7, 0xd012f900, 0x00000000,
+    0x02fbd000, 0xfcee0d19, 0x000000e7, 0xda000022, 0x19de0000, 0x00000d02, 0x1f00f717, 0x2400f3fa,
+    0x150904f0, 0xdf0000fc, 0x00e5c900, 0xeb000002, 0x000011ff, 0x0000fdfe, 0xf0080500, 0x00000000,
+    0xe8fc0000, 0xe7e7e9fa, 0x000000dc, 0xee0000ef, 0x0ad70000, 0x0000ffd3, 0x0900030b, 0x0400f9f5,
+    0x0aebff15, 0xd7000002, 0x00f3dc00, 0xe6000016, 0x0000f9f8, 0x1b000300, 0x01fa1600, 0x00000000,
+    0xda240400, 0xf9ebeaff, 0x000000de, 0xf9000011, 0x15d70000, 0x0000f4db, 0x1500f41f, 0xf500140c,
+    0x0318fa0a, 0xfb0000fb, 0x00ffcd00, 0xf7000026, 0x0000eb06, 0xf7000a0e, 0x0f33fd00, 0x00000000,
+    0xf008f000, 0x0bfed800, 0x000000f2, 0xfc000012, 0x06ed0000, 0x00000e00, 0x0600f004, 0xe3002822,
+    0xf11bf421, 0xf10000e1, 0x00e9eb00, 0x0000002b, 0x000002ef, 0x0200f2f8, 0x1338fb00, 0x00000000,
+    0x160f0100, 0xf60ef412, 0x000000f6, 0xe10000ec, 0xf00f0000, 0x0000ee02, 0xe900f6e5, 0xfe00211b,
+    0x001af211, 0xf50000f5, 0x00eff000, 0xff000009, 0x000007fe, 0x17002af7, 0x0d230a00, 0x00000000,
+    0x1cfffb00, 0x1c0f0bdb, 0x000000ff, 0x040000e9, 0xf9e40000, 0x0000f20e, 0xf000feeb, 0x03000a15,
+    0xfe15f7fd, 0x080000f9, 0x0000fd00, 0xf000000e, 0x0000f3fe, 0xf40015f1, 0x05030200, 0x00000000,
+    0x12fd0a00, 0x28f6f905, 0x00000006, 0xe6000005, 0x01e70000, 0x0000defc, 0xfe00f9fa, 0xec00fe11,
+    0xfc0f0318, 0x0f0000f9, 0x00f9fe00, 0xee0000f6, 0x0000ec26, 0x2a002703, 0xe904f100, 0x00000000,
+    0x1607fd00, 0x0215ee01, 0x0000001e, 0xfa00000f, 0xd30e0000, 0x0000d4d2, 0xf6000e02, 0xe300f80a,
+    0xf9f41bfb, 0x1f000031, 0x000b1300, 0x1a0000ec, 0x0000ac07, 0xe7000017, 0xf3f8f800, 0x00000000,
+    0x35fb2700, 0xf7f20506, 0x00000023, 0x200000e9, 0xef000000, 0x0000f3e2, 0xde00f8e7, 0xc00007f3,
+    0xfcfd1a03, 0x100000fe, 0x00201a00, 0x1a000007, 0x00000900, 0xe4000400, 0x1b0cf900, 0x00000000,
+    0x29d32300, 0x2f18fdf6, 0x0000002b, 0x0a0000cb, 0xe0f70000, 0x00001e0f, 0xeb000ef1, 0xd200e10b,
+    0xe40b1dfa, 0x040000e1, 0x00400b00, 0x020000ef, 0x0000110a, 0x1500fedf, 0x07fe2200, 0x00000000,
+    0x1ebf2700, 0xf407f7ee, 0x00000023, 0x260000e8, 0x10ee0000, 0x0000042d, 0x1b0002d3, 0x0600d2fc,
+    0xe9f200ef, 0x1f0000d2, 0x003b0100, 0x030000ec, 0x000013fd, 0x230008df, 0x010d0800, 0x00000000,
+    0xfec7f800, 0xf002ee04, 0x000000fd, 0x280000f9, 0x25f50000, 0x00001b1e, 0x1100fe01, 0x1200dafe,
+    0xe8f5eadc, 0x090000f8, 0x00f70700, 0xf80000f2, 0x0000102a, 0x040017f2, 0xfa162000, 0x00000000,
+    0x0f2e1400, 0x0f0b180e, 0x00000016, 0x2000001a, 0x130d0000, 0x000019fa, 0x1200faf9, 0xef0000e8,
+    0xcbf0e9fb, 0xf000000f, 0x00f20f00, 0xff0000ec, 0x00002704, 0x050005f3, 0x1cf43400, 0x00000000,
+    0xfa1c0900, 0xfafeebe6, 0x00000021, 0xfb000001, 0x03080000, 0x0000f2e8, 0xfa001201, 0x0a0004f1,
+    0xefed01f4, 0x0b000018, 0x00fe1300, 0xf70000fe, 0x00000202, 0x1100fdee, 0xdcdd1900, 0x00000000,
+    0xfb100900, 0xfcea0efe, 0x00000019, 0xf700001d, 0xf9ff0000, 0x000023fd, 0xff00ecf0, 0xf50011fb,
+    0xe4f0fc01, 0xfa00002e, 0x00f01500, 0x01000012, 0x0000f5fe, 0xda00e108, 0x030a0c00, 0x00000000,
+    0xf50bd200, 0x1def0a0c, 0x00000036, 0xce0000d7, 0xd1fd0000, 0x0000efc5, 0x270005d8, 0xf100170f,
+    0xe6ff2109, 0x340000e7, 0x00fffc00, 0x0000001b, 0x000008ff, 0x1700dd1f, 0xfa06d700, 0x00000000,
+    0x28fd1b00, 0x0bfbe3e8, 0x00000029, 0xf80000c8, 0xe9ed0000, 0x00000de5, 0x23001bdf, 0xf200f7f0,
+    0xdf0a2c02, 0x15000005, 0x00f6fe00, 0xf40000fd, 0x0000171c, 0x0d00fd05, 0x08fcf000, 0x00000000,
+    0x07052200, 0x15fb02ed, 0x00000008, 0x210000f4, 0xd9ff0000, 0x000013f7, 0x12000fde, 0xf3000cdf,
+    0xe90844f3, 0x0e000005, 0x00dff300, 0xf80000fb, 0x00000c13, 0xf2000808, 0xf420dd00, 0x00000000,
+    0x1de40e00, 0xe9e008dd, 0x000000df, 0x090000f6, 0x0c030000, 0x000001fe, 0x050001fa, 0xf9001305,
+    0x13021bf6, 0xfc00001d, 0x00c3e100, 0xf000000a, 0x0000dfdf, 0x1800ea3b, 0x0d09eb00, 0x00000000,
+    0xf70ce500, 0x0bf8ffe4, 0x000000dd, 0x0e0000ef, 0xfce90000, 0x00000fcb, 0xeb000df3, 0x160001f7,
+    0x31f81df2, 0xf4000029, 0x00ffd400, 0xe400001a, 0x0000dbe5, 0x1e00f735, 0xfde3f200, 0x00000000,
+    0xf626df00, 0x1d072b07, 0x000000ef, 0x1c0000f7, 0xe5dc0000, 0x00000ae6, 0xf90019fc, 0x00001706,
+    0x17e60a07, 0xf300000d, 0x00fddd00, 0xd3000010, 0x0000d307, 0x1000ea1b, 0xf8fcff00, 0x00000000,
+    0x1101c500, 0x1703300d, 0x00000000, 0x090000e5, 0xedf10000, 0x0000f7f6, 0xe600210d, 0x04000705,
+    0x03000201, 0x160000ed, 0x0002de00, 0xf0000010, 0x0000dcfd, 0xed00f70f, 0xe7040500, 0x00000000,
+    0x0c02de00, 0x45052716, 0x0000000c, 0xef0000f2, 0xff0d0000, 0x0000fe03, 0xe0000933, 0x0c001211,
+    0x22fdfb1e, 0x090000dd, 0x001ee000, 0xe80000e2, 0x0000ee20, 0x0d000214, 0xee25fc00, 0x00000000,
+    0x09e6bf00, 0x101aecde, 0x00000015, 0xc70000fe, 0x110e0000, 0x00000755, 0xdc002d04, 0x1d0002d4,
+    0x1e0ecaea, 0x070000fc, 0x000aeb00, 0x230000ea, 0x0000cd20, 0xec0034fa, 0x12f5f300, 0x00000000,
+    0x3821f400, 0x120115fa, 0x0000000d, 0xd50000f9, 0x2dee0000, 0x0000de23, 0xdf003600, 0x2600f1ed,
+    0xf9f9edf6, 0x050000f1, 0x00ee3000, 0xf40000f1, 0x00000509, 0x00001ed4, 0xffe9f700, 0x00000000,
+    0x2731fc00, 0x03ff1307, 0x00000014, 0xe30000e9, 0x0c010000, 0x0000fefe, 0xf3001df5, 0x2500e6fb,
+    0xe90e09ff, 0xf30000e8, 0x00da1e00, 0xdc0000e9, 0x0000ed1d, 0xfa0008f6, 0x0cd3d800, 0x00000000,
+    0x2c2cfc00, 0x0505f7fe, 0x00000013, 0xf6000002, 0xff030000, 0x0000e405, 0xeb0008f1, 0x0e00e902,
+    0x17131000, 0xf40000f1, 0x00cd1800, 0xe90000de, 0x00001ef8, 0xdf001714, 0x10f6f200, 0x00000000,
+    0x18fc1200, 0xf5eff806, 0x00000017, 0xe9000015, 0x00f70000, 0x00001b09, 0xe4000409, 0xf100ff0d,
+    0x120a161a, 0xd80000f8, 0x00ec1f00, 0xea0000e0, 0x000016f8, 0xdc001213, 0x06070200, 0x00000000,
+    0xf805f100, 0xefef0100, 0x0000000f, 0x0000001a, 0xfbeb0000, 0x0000fcff, 0xf000f604, 0x1f000106,
+    0x11fe0e13, 0xf6000000, 0x00fe1e00, 0xe00000d9, 0x0000fce6, 0xfe00ed12, 0x0df60000, 0x00000000,
+    0x00f2f700, 0xe1101304, 0x0000000b, 0x170000fe, 0xfedc0000, 0x00000305, 0x0000f509, 0x2000ff11,
+    0x0b0f08e9, 0x0a0000f6, 0x00e60800, 0xf30000e3, 0x0000f3fe, 0x0f00daf3, 0x01060500, 0x00000000,
+    0x07120700, 0xf81a221d, 0x0000000b, 0x18000004, 0xf8f20000, 0x00002012, 0xe900fd13, 0x210007ff,
+    0x06e203ff, 0xec000002, 0x00f40200, 0x060000cb, 0x00001ed6, 0xe100d2ff, 0x17f40000, 0x00000000,
+    0xe6f9e100, 0xf135fff3, 0x000000fb, 0x310000d3, 0xf3fb0000, 0x0000f4fd, 0xec0018db, 0x1a002ef3,
+    0xf90ae3ea, 0xf70000c1, 0x00f1c800, 0xf9000022, 0x00001618, 0xfa00f1cc, 0xd1d7fe00, 0x00000000,
+    0x13e2ec00, 0xfc11feed, 0x000000ff, 0x250000fe, 0xdefa0000, 0x0000201d, 0x04001b0f, 0xfa0001f1,
+    0xfff5f006, 0x070000e6, 0x00ffb400, 0xdf00000d, 0x0000f029, 0x09000b08, 0x06041d00, 0x00000000,
+    0x00ebfa00, 0xf8fbefcf, 0x00000007, 0x10000017, 0x10e20000, 0x00002a2a, 0xf900220a, 0xf200dff6,
+    0x18e1e114, 0x210000e7, 0x0010df00, 0xd90000f3, 0x0000fe07, 0xfc0040f4, 0x25faf800, 0x00000000,
+    0x02eaee00, 0x0f0a0bcd, 0x00000030, 0xfe0000ff, 0x11f50000, 0x00000d1e, 0xfb001f07, 0xfb00ff17,
+    0x00c1034a, 0xfb0000f0, 0x000df200, 0xe1000012, 0x00000b2b, 0xf800410b, 0x24effc00, 0x00000000,
+    0xfef8dd00, 0x1b0a21df, 0x00000040, 0x090000f1, 0x010a0000, 0x0000db0e, 0xed002e03, 0xfe00ed2c,
+    0xd8031307, 0x07000007, 0x001c0500, 0x00000002, 0x00000029, 0xf9001ce9, 0xffebdb00, 0x00000000,
+    0xf8180e00, 0xf0f50706, 0x00000026, 0x190000f2, 0xf6090000, 0x0000cb10, 0xf000230f, 0xe800de15,
+    0xee120ef3, 0x11000000, 0x0008f800, 0xf9000003, 0x0000ff09, 0xf2001de7, 0xdd10ee00, 0x00000000,
+    0x07f2f000, 0xf30e19e9, 0x0000000e, 0x27000004, 0xeb220000, 0x0000f301, 0xee001410, 0x0a00e81d,
+    0xdd1efbe7, 0x2b0000ec, 0x0000fc00, 0xff000005, 0x000004f9, 0xe9002102, 0xd1f9e900, 0x00000000,
+    0xf5f0f400, 0xd5e409ee, 0x000000fe, 0x3d0000f2, 0x0a1a0000, 0x0000fb13, 0x1f00f5f8, 0xfa00fe28,
+    0xd80702fe, 0x140000ed, 0x0008fc00, 0xf80000ef, 0x00001af2, 0xfa0015e3, 0xfc1efb00, 0x00000000,
+    0x02f91600, 0x0d2923ee, 0x0000001a, 0x0c0000fe, 0x0e0c0000, 0x0000f0fd, 0xde001bf2, 0x1c0002f4,
+    0xc9f6e7f7, 0xf300000a, 0x001a1c00, 0x310000f8, 0x0000c4e2, 0x0f001213, 0xe2bee800, 0x00000000,
+    0x32201e00, 0x130821f2, 0x00000018, 0x170000ff, 0x37120000, 0x0000fe1b, 0xf600f7f1, 0xff00fbfe,
+    0xdb19ebf0, 0xf80000f9, 0x00fd4400, 0xff0000eb, 0x0000fcfd, 0x010015ea, 0x00d60400, 0x00000000,
+    0x260f3a00, 0x130810fa, 0x0000001b, 0xdb00001b, 0x27e20000, 0x000017e8, 0xe600e506, 0xdd00f1f4,
+    0xf909e515, 0x22000004, 0x00fe4800, 0xea0000de, 0x0000eee5, 0xec002711, 0x0ef81000, 0x00000000,
+    0x22002900, 0xe7f1e903, 0x00000008, 0x0000001b, 0x05df0000, 0x000010ef, 0xda00011c, 0xe000170b,
+    0x0d12f221, 0x11000000, 0x001a2700, 0xe60000e4, 0x00000ef9, 0x020004f6, 0x14190700, 0x00000000,
+    0x02f30300, 0xf412eff2, 0x00000001, 0xfd0000ec, 0x07c90000, 0x0000f2f2, 0xe000e0ef, 0xec001404,
+    0x0efcfd07, 0x090000f4, 0x001e1500, 0x110000fd, 0x00001a01, 0x080009ef, 0x1d171800, 0x00000000,
+    0xf4d71400, 0xd909f8e0, 0x000000f9, 0x20000002, 0x23c70000, 0x000003f1, 0xf500d60f, 0xea000a13,
+    0x0ef001f3, 0xfc00000a, 0x00120200, 0x0b0000f7, 0x0000100a, 0xff00f518, 0xe91a0000, 0x00000000,
+    0xe7e10500, 0x09140af6, 0x00000000, 0x3f0000f4, 0x01bc0000, 0x00000c12, 0xf300ecf4, 0xe400160e,
+    0x2104060d, 0x080000fa, 0x0011fd00, 0xfe000008, 0x000018f2, 0xf8001810, 0x00fe1500, 0x00000000,
+    0xedd50000, 0xf706021c, 0x00000006, 0x5600000c, 0x08f30000, 0x00000b07, 0xfe00fbed, 0x000002f3,
+    0x1b0804fd, 0x1a00000e, 0x0005f300, 0xf7000006, 0x00000201, 0xdf00faf8, 0xfce81300, 0x00000000,
+    0xfee42000, 0xf1fecf22, 0x0000002d, 0x1e0000fb, 0x06ff0000, 0x0000d104, 0x0a0002e0, 0xec000b1c,
+    0x1be81ff9, 0xe90000e7, 0x0002e500, 0xce0000f7, 0x000009f4, 0xea00f412, 0x09001900, 0x00000000,
+    0x0f03d100, 0xe3e30318, 0x00000020, 0x1a000004, 0xf8060000, 0x00000120, 0x030007d6, 0xe4003c21,
+    0x25ca290b, 0xec0000f9, 0x0010e000, 0xe20000f7, 0x00001ee9, 0xf9000209, 0xf6fa1c00, 0x00000000,
+    0x09f4c700, 0xe60f0d0b, 0x0000001f, 0x03000013, 0xf1d90000, 0x0000fc2b, 0x0300fefc, 0x0d002702,
+    0x13f72e04, 0x040000fe, 0x000dc000, 0xef000005, 0x000026ff, 0x0f00f905, 0x01060400, 0x00000000,
+    0x1af2c900, 0xec05fd1b, 0x00000010, 0x03000015, 0x1bba0000, 0x0000f803, 0xec00fffe, 0x0f000af2,
+    0x03f51413, 0x0c000004, 0x00e1f600, 0xfb000000, 0x0000fe0f, 0x0c00fc11, 0xe6160400, 0x00000000,
+    0x0cfee700, 0xe6050307, 0x000000f1, 0xea00001c, 0xffef0000, 0x0000f0ef, 0xec0009ee, 0x12000a1c,
+    0x14f80926, 0xfc0000f3, 0x00e82400, 0x0b0000eb, 0x000004ef, 0xfd00fa17, 0xf8eedd00, 0x00000000,
+    0x01e5ff00, 0xe41a0113, 0x000000cb, 0xf000001d, 0x08f90000, 0x00000ae5, 0xf00007f6, 0xfe001efd,
+    0x270a1708, 0xf00000f0, 0x00e83500, 0xea000014, 0x0000e3fb, 0xe7000726, 0x0de50700, 0x00000000,
+    0x0df9f200, 0xf22fe901, 0x000000d0, 0xfd00002f, 0xdedd0000, 0x000014d2, 0x04001ee4, 0x06002906,
+    0x24102f0d, 0xe7000000, 0x00dc1800, 0xec000003, 0x0000df04, 0xfe000715, 0x11dc1900, 0x00000000,
+    0x1c050100, 0x1540e20e, 0x000000d6, 0x3e00001a, 0xdbd90000, 0x000019ce, 0xea001ee2, 0x070015d8,
+    0x27fc2af5, 0xe50000ed, 0x00dcec00, 0xda00000b, 0x0000ee19, 0xed001e22, 0x0ed02600, 0x00000000,
+    0x1e0ce300, 0x230402ff, 0x0000000b, 0x09000021, 0x18df0000, 0x0000f70e, 0xf80007fe, 0xe90018f7,
+    0xf622ec14, 0x230000dc, 0x0015eb00, 0xde0000f9, 0x0000dc00, 0xff0012fe, 0x10042300, 0x00000000,
+    0xc509fc00, 0xf6fde81c, 0x00000034, 0xf70000fd, 0x1dd70000, 0x0000f01f, 0xfb00e6f0, 0x09000e08,
+    0xfb23fa33, 0x0700001b, 0x00f8d700, 0xfc0000f9, 0x000015ef, 0x1c001af6, 0xfd052b00, 0x00000000,
+    0xed1cfb00, 0x0dfaf3f8, 0x0000001f, 0xf30000f4, 0xf8ef0000, 0x0000f607, 0xdb00e603, 0xdf001a13,
+    0x012002fc, 0x0200002a, 0x00110500, 0x130000f1, 0x0000f1eb, 0x050010f1, 0xfb3ffe00, 0x00000000,
+    0xf30b1100, 0xdbe3fbff, 0x00000028, 0xfa00000c, 0x18f10000, 0x0000d4f7, 0xc900f309, 0xd100fb16,
+    0x033919f3, 0x1c000018, 0x000b0500, 0x1f0000f1, 0x00000edc, 0xea00eded, 0xc807ee00, 0x00000000,
+    0xe7fc2800, 0xe007eff4, 0x00000027, 0x150000ef, 0x08cc0000, 0x0000d0e2, 0xec000106, 0x0700fef1,
+    0xf8391ed4, 0x130000f3, 0x002c1300, 0x2d0000e6, 0x000003c4, 0x090005d8, 0xd1fdef00, 0x00000000,
+    0x13023500, 0xe6fcfdfc, 0x00000006, 0x1a0000cb, 0x0fdf0000, 0x0000dc13, 0x0800f4ea, 0xfd00fc00,
+    0xfc0e06f8, 0x0c0000e8, 0x00190500, 0x2e0000f0, 0x00000bfa, 0xf90003da, 0xedf5fe00, 0x00000000,
+    0x07001c00, 0xff1de311, 0x000000ff, 0x060000cc, 0x05e00000, 0x0000f004, 0xeb00dc04, 0x2b0004f5,
+    0xde00ea02, 0x030000e5, 0x00140b00, 0x160000e7, 0x0000190e, 0xf500eadb, 0xe700f000, 0x00000000,
+    0xf9092500, 0xee12b205, 0x000000e7, 0xeb0000f5, 0xfdf10000, 0x0000240b, 0xf400f3e4, 0x18000aff,
+    0xe804f8e4, 0xe70000ec, 0x00330200, 0x14000008, 0x0000ff27, 0x10001beb, 0xfce01c00, 0x00000000,
+    0xee2c2b00, 0x1003e103, 0x000000e2, 0x070000d9, 0xdea00000, 0x0000f8f4, 0xeb0012ec, 0x0200d5e1,
+    0xd7172ff1, 0xfa00001d, 0x001efc00, 0x250000e4, 0x0000f4fa, 0x0d00fc04, 0x1248f100, 0x00000000,
+    0x1ae32f00, 0xee010cd7, 0x000000f8, 0x150000e9, 0xf3ea0000, 0x0000e620, 0xfb0011f5, 0x1b000410,
+    0x061c0b14, 0xe6000011, 0x0016f500, 0x030000fb, 0x0000ecf8, 0x2300fd04, 0x1438ec00, 0x00000000,
+    0x0ee9ed00, 0xf9fffefe, 0x00000008, 0x250000fd, 0x12df0000, 0x0000f3ee, 0xea0012e8, 0x1a00dc23,
+    0x1a10ef03, 0xcc000011, 0x0016f900, 0xe20000ec, 0x0000f6f7, 0x1100fae8, 0x1f04f800, 0x00000000,
+    0xe8cf1900, 0x1df31304, 0x0000000c, 0x3000001f, 0xfbd40000, 0x00002701, 0x0f0012fd, 0x0900e60f,
+    0x12e4021d, 0xea000011, 0x000a1a00, 0xf4000002, 0x00001edc, 0x11000f0a, 0x36fc1c00, 0x00000000,
+    0xe2f91100, 0x03ede51b, 0x0000000c, 0x25000020, 0xf2e90000, 0x000014ff, 0x20000b05, 0xf20000ff,
+    0xfffa0130, 0xf800001e, 0x000dff00, 0xde00001d, 0x000003fb, 0x1a00ddf2, 0x33072600, 0x00000000,
+    0xcff3d800, 0x05fce421, 0x00000015, 0x140000f8, 0xdbed0000, 0x0000feff, 0xef00130b, 0xf10008f8,
+    0xf306f82e, 0xfb000009, 0x0039e300, 0x160000ee, 0x00000c25, 0xe800cfe9, 0x33f92b00, 0x00000000,
+    0xd0f6dd00, 0x1aebe101, 0x000000fc, 0x0f0000f2, 0xd9e70000, 0x000003ef, 0x07001005, 0x130010f2,
+    0xf3ffe419, 0xeb000012, 0x001dd800, 0x16000014, 0x0000f506, 0xea00dfe0, 0x0e0dfe00, 0x00000000,
+    0xc3f1fe00, 0x1312d902, 0x000000e4, 0xe20000d5, 0xf1e70000, 0x0000efd8, 0xf200060e, 0x23000c0e,
+    0xe421dd1b, 0xf600002b, 0x0030e500, 0x0b0000f0, 0x00000307, 0x1900effe, 0x1e24e700, 0x00000000,
+    0xde1a0b00, 0x29e111de, 0x000000ce, 0xf1000007, 0x270a0000, 0x00003114, 0xf700df14, 0x0f00f5ee,
+    0xfe1edd04, 0xd40000fb, 0x00f91100, 0xf900000f, 0x000015fa, 0x1a00e4ee, 0xf524fa00, 0x00000000,
+    0xbafc0f00, 0x31f902de, 0x000000c8, 0xfd000005, 0x03f40000, 0x000022ee, 0xfe00cc19, 0x2000f8ea,
+    0xfc15d2f9, 0xd9000001, 0x00fa0100, 0x19000008, 0x0000fd11, 0x1600feee, 0x1114ff00, 0x00000000,
+    0x03141700, 0x11d417fe, 0x000000d7, 0xd1000008, 0x00100000, 0x000020ec, 0x1300fa1e, 0xed001f07,
+    0x15f3db02, 0xf0000019, 0x00ec0500, 0x0e0000f6, 0x000004ef, 0x2400f526, 0x23f7e100, 0x00000000,
+    0xff161500, 0x11dce9eb, 0x000000f4, 0xd00000ff, 0xfb060000, 0x000004da, 0x0700f2fa, 0xc50006f2,
+    0x15f8f606, 0x1b000008, 0x00f61700, 0xfd0000fc, 0x00001cfa, 0x0d00fd1b, 0x1afdfa00, 0x00000000,
+    0x0702f100, 0x07db0806, 0x00000002, 0xfa000009, 0xda0e0000, 0x000015fd, 0x0b000202, 0xd40010fc,
+    0x0ef51616, 0x27000005, 0x00f10b00, 0xfd000009, 0x00000cea, 0xf800ea25, 0xfef9e300, 0x00000000,
+    0x1410dc00, 0x05fa101b, 0x000000f8, 0xfc0000e2, 0xd6050000, 0x000007ed, 0xf9001ae2, 0xe700001e,
+    0x30ee0f36, 0x1d000002, 0x00130800, 0x020000f4, 0x0000fef6, 0xf100e307, 0xf2e3cf00, 0x00000000,
+    0x2904f400, 0x14040c15, 0x000000f3, 0xe60000e9, 0xe0f60000, 0x0000fdff, 0xef000df4, 0xe700ef0f,
+    0x23190920, 0x0a00000f, 0x00140900, 0x17000002, 0x0000eaf0, 0xed00f007, 0xfbe7f600, 0x00000000,
+    0x1bf6ff00, 0xf911f4fc, 0x000000f2, 0xea0000d6, 0xe2c30000, 0x0000df06, 0xe7000a09, 0xf600f70a,
+    0xf8000c13, 0x0200000c, 0x00100600, 0x320000fd, 0x0000edee, 0x1400f4fe, 0x03f9f000, 0x00000000,
+    0x1606fb00, 0x11050a31, 0x00000025, 0xe9000015, 0x04310000, 0x0000fbd1, 0x0900d92c, 0x1500faf4,
+    0xf8c1dbde, 0x0c000009, 0x00034700, 0x000000ea, 0x0000dbe8, 0xec00fb0e, 0xe6f1f300, 0x00000000,
+    0x0de6e100, 0x1afa0bee, 0x00000012, 0xc6000011, 0x1f4e0000, 0x000012f5, 0x1100d0fe, 0xe300f30c,
+    0x0bc2f7fc, 0x2d0000f2, 0x00193200, 0xf8000004, 0x0000e0fa, 0x0c00ee05, 0xffd71400, 0x00000000,
+    0x1b0bf800, 0x09f61ef7, 0x0000001f, 0xc30000f7, 0x18340000, 0x00001620, 0x2d00e3f1, 0xd100dbfb,
+    0x01d40106, 0x190000e0, 0x001ff700, 0x0b0000d7, 0x00001f07, 0x0f0009ff, 0x17d91300, 0x00000000,
+    0x15fe1000, 0x0bcd0503, 0x0000003e, 0xda0000dd, 0x0f3a0000, 0x0000251b, 0x0e000621, 0xd700f4eb,
+    0xe9edf718, 0x0c0000f2, 0x00fd0400, 0x170000cb, 0x00001520, 0xff0008eb, 0x03e9ef00, 0x00000000,
+    0xfe070c00, 0x07d9e1ff, 0x0000001a, 0xc30000e3, 0x251c0000, 0x00000a07, 0x12001a18, 0x1400e7e0,
+    0xeb18f714, 0x0a000004, 0x00ed0f00, 0x190000e0, 0x0000031c, 0x00000bd0, 0x12fdd400, 0x00000000,
+    0xe1fd1200, 0x06e8c811, 0x000000d9, 0xe7000005, 0x25090000, 0x0000fbed, 0xfc00090d, 0x200003cf,
+    0xe00df2fc, 0xe4000006, 0x00cc0d00, 0x220000f0, 0x00000116, 0x0d00f3de, 0x2d12ef00, 0x00000000,
+    0xfd0f1e00, 0xfa03dc09, 0x000000d6, 0xd600001b, 0xf51a0000, 0x0000fad7, 0xf100fb17, 0x0d001be5,
+    0xe401f80b, 0xe1000005, 0x00dbfc00, 0x1d00000e, 0x0000ed0b, 0xf600de1f, 0x3312db00, 0x00000000,
+    0xe9030000, 0xe811eefb, 0x000000d8, 0xfe000018, 0xff1b0000, 0x000003d6, 0xfd001106, 0x0e000a0c,
+    0xebfef8eb, 0xc5000016, 0x000bea00, 0x0800000a, 0x0000ef01, 0x1800e81a, 0x2501de00, 0x00000000,
+    0x0e161600, 0xe20a16e7, 0x000000e3, 0xfd0000e7, 0x2edb0000, 0x00000500, 0x07001409, 0xe60093e4,
+    0xdb000506, 0x1e0000f5, 0x000ed500, 0xdb00000f, 0x00001832, 0x180016f0, 0x3af50300, 0x00000000,
+    0x04d00700, 0x13ff0df1, 0x00000003, 0x120000ee, 0x15e10000, 0x000001f6, 0x23001f13, 0x1000db09,
+    0xd918122c, 0xdf0000f7, 0x0007bc00, 0xe100000f, 0x00001410, 0x050007f4, 0x22dae900, 0x00000000,
+    0x0efb0900, 0x0511ebf8, 0x000000f3, 0x2e0000e2, 0x01d90000, 0x0000efe3, 0x1e001120, 0x210003ed,
+    0xfd371b07, 0xc7000010, 0x00e7d300, 0xf600000e, 0x00000714, 0x0a000cfd, 0x1414d700, 0x00000000,
+    0x01150800, 0x01e5f6eb, 0x000000e3, 0x0900000f, 0xf70c0000, 0x0000cadd, 0x140007f0, 0x03000e01,
+    0x003c0803, 0xae000031, 0x00e3ea00, 0x02000028, 0x0000ebdd, 0xea00fef7, 0x17fdc600, 0x00000000,
+    0xf6f2f500, 0xe6fff9f0, 0x000000df, 0x0c000004, 0x041c0000, 0x0000c6dd, 0x0b00120b, 0x0e00f70e,
+    0xe91905f3, 0xd700002a, 0x00e40200, 0x0700000a, 0x0000f1fd, 0xf900090e, 0x240bf100, 0x00000000,
+    0x0ff51b00, 0xee0b15ed, 0x000000e7, 0x27000002, 0xd01e0000, 0x0000f4ed, 0xfa001b07, 0x100002eb,
+    0xee24fafe, 0xd8000015, 0x00ea1b00, 0xf200000d, 0x0000e3ef, 0xe300051f, 0x1813fc00, 0x00000000,
+    0x08f91e00, 0x1104f00c, 0x000000f2, 0x23000011, 0xe0130000, 0x0000ffe1, 0xf4000ee7, 0xf8001003,
+    0x081cfef9, 0xe800000e, 0x00f51d00, 0xe4000001, 0x0000f5ed, 0x0300011d, 0x16f9f600, 0x00000000,
+    0x07050c00, 0xebfbff0d, 0x000000ea, 0x4800001a, 0xe3ec0000, 0x000016ec, 0xea0004e3, 0x0000f433,
+    0xfd1cfa05, 0xee000013, 0x00100800, 0x040000df, 0x0000f2f6, 0xec00fcf5, 0x2403ee00, 0x00000000,
+    0x09003400, 0x041b0ae5, 0x000000b4, 0x1d000012, 0x0ee70000, 0x0000fa18, 0xf5001c13, 0xfe0035d3,
+    0x42f4e409, 0xfd000019, 0x00dbe700, 0x0400001a, 0x00002603, 0xef000e13, 0xf621f100, 0x00000000,
+    0x0e07e900, 0x050315ee, 0x000000a8, 0xea000008, 0x0bf40000, 0x00000604, 0xe8001002, 0x27002cd2,
+    0x2fedd6fd, 0xf3000015, 0x00d0f700, 0xfd0000f3, 0x0000d107, 0xf800080b, 0x0df9e400, 0x00000000,
+    0xff05d700, 0xecec31f1, 0x000000c0, 0xdb0000fa, 0x25000000, 0x000004f1, 0xf1000a02, 0xff000cdf,
+    0x16d1e3f5, 0xfd000023, 0x00d60d00, 0xfa00001e, 0x0000d914, 0xff00e72a, 0xf6dbf100, 0x00000000,
+    0x0c23e500, 0xebfd330f, 0x000000c8, 0xda000013, 0xf8050000, 0x0000ecc9, 0xee000e10, 0x08000fda,
+    0x19dfeffe, 0x1500001b, 0x00e62500, 0x1c000013, 0x0000ee0c, 0xe800de0c, 0x21d20e00, 0x00000000,
+    0x25311200, 0x08030a13, 0x000000f3, 0xd50000fc, 0xee1f0000, 0x0000e9d5, 0x0a00f705, 0xee00f100,
+    0xf7ecfa01, 0x10000012, 0x00fa2b00, 0x090000ef, 0x00001705, 0xf800d911, 0x0efc1400, 0x00000000,
+    0x27200600, 0xe9eefe34, 0x00000002, 0xda000013, 0xef250000, 0x00000d01, 0x0c001f0a, 0xeb00ecff,
+    0xe1f50900, 0x0400000f, 0x00f72500, 0x1d0000d8, 0x00000ef9, 0xdc00fc0c, 0x0aeb0700, 0x00000000,
+    0x070e3100, 0xfafbdff9, 0x00000009, 0xed000005, 0xf71b0000, 0x00000608, 0x0900fd06, 0x0700e9fc,
+    0xf305080f, 0x1200001a, 0x00041e00, 0x140000d5, 0x00001eec, 0x0100f102, 0x06e90b00, 0x00000000,
+    0xf7f1f500, 0xdaefe60e, 0x00000002, 0xe6000015, 0xfe1f0000, 0x00003320, 0xf80004fe, 0x0a00ee19,
+    0xdffc051a, 0xe900001a, 0x00f81400, 0xfd0000fe, 0x000018f5, 0xf300ef02, 0xf8ff0000, 0x00000000,
+    0x05f50400, 0x2708e902, 0x00000008, 0x410000fe, 0xe82a0000, 0x0000fdd9, 0x05001cd6, 0xe7004443,
+    0x03f902f9, 0xeb0000f2, 0x0002fb00, 0x120000f6, 0x0000fee1, 0x1000eef1, 0xd8f0ff00, 0x00000000,
+    0xedf7e100, 0x0007ef0e, 0x00000004, 0x080000e6, 0x13180000, 0x0000dde7, 0xeb000a11, 0xd300130e,
+    0x0fe6fc06, 0x09000003, 0x0020f000, 0x00000014, 0x0000f308, 0xf400f915, 0xdffbe100, 0x00000000,
+    0xea03e000, 0x06f5fa13, 0x000000fe, 0x0f00000d, 0x16fa0000, 0x0000e3d9, 0x0200e820, 0xff000515,
+    0x17dd0d07, 0xf4000011, 0x00f60a00, 0xe700000e, 0x0000f6e6, 0x0000fb20, 0xf9ea0200, 0x00000000,
+    0xe7f4e200, 0xf818f40d, 0x00000007, 0xf10000e9, 0xe21d0000, 0x0000e0d6, 0xea00fe01, 0xfb002301,
+    0x1ce5320c, 0xe60000fa, 0x00121b00, 0x03000014, 0x0000e709, 0xf800d709, 0x0ff7f800, 0x00000000,
+    0xf8fde400, 0x1e09ef26, 0x00000017, 0x0c000000, 0xd52e0000, 0x0000e6fc, 0x1100fcec, 0xe8000e10,
+    0x1de23105, 0xeb0000f5, 0x00071c00, 0x0c0000f4, 0x0000e4fd, 0xf9000f0c, 0xfff80e00, 0x00000000,
+    0x03e10c00, 0x23f6f41e, 0x00000015, 0x0c000014, 0xf21f0000, 0x000019fa, 0xe60011d3, 0xe7000108,
+    0x07fa1d16, 0xfa0000f0, 0x00fb0b00, 0xf20000e5, 0x0000eb0c, 0x15000ff4, 0xef120300, 0x00000000,
+    0x24dfe400, 0x1b0ef81a, 0x00000012, 0x05000007, 0xe8f00000, 0x00002c05, 0xd900f3e4, 0xf500f70c,
+    0x03ea0815, 0x250000ee, 0x00150800, 0xea0000f3, 0x00001011, 0x0600f2f8, 0xfff2f500, 0x00000000,
+    0x0ceae400, 0x2800f10f, 0x00000018, 0xfd0000f4, 0xf1d80000, 0x00000a12, 0xde00ff0c, 0xf6000aef,
+    0xf3e80834, 0xf50000ec, 0x00270b00, 0xf50000f3, 0x00000a0f, 0x3100e2f5, 0x03eff300, 0x00000000,
+    0x17f3c200, 0x0c1c000d, 0x0000003a, 0xfa00000a, 0xd2210000, 0x00000116, 0x0d00e204, 0xd300e301,
+    0xdf3328fa, 0x080000ea, 0x00060800, 0xe80000ff, 0x000005fd, 0xce0033f8, 0xec061b00, 0x00000000,
+    0x26fcfb00, 0xf619ffff, 0x00000025, 0xfd000009, 0xf92b0000, 0x00002421, 0x0f00f0de, 0xe500e7f8,
+    0xf0070100, 0x1d0000fe, 0x0017cf00, 0xfb0000fb, 0x00001507, 0xeb002cea, 0xf2011b00, 0x00000000,
+    0x17130900, 0xf3e90bfa, 0x00000014, 0x1e0000f5, 0x091a0000, 0x00001d14, 0x0900e208, 0x0500e504,
+    0xfaefffff, 0xfb000019, 0x0026cc00, 0xf70000f5, 0x0000000f, 0x11000eff, 0xd31f1100, 0x00000000,
+    0xfaf50800, 0xe1fdeeed, 0x000000fc, 0x0400001f, 0x08070000, 0x0000f00b, 0x0100e01d, 0x0f00020e,
+    0x03130cde, 0x16000038, 0x0011be00, 0xf70000ed, 0x000011fa, 0xe400f6ee, 0x05160a00, 0x00000000,
+    0xce21e000, 0xe8ff01f4, 0x000000fa, 0xf9000003, 0xf30f0000, 0x00000bd8, 0x1e00e924, 0xfe00fff3,
+    0x280116f5, 0xf400001e, 0x000bea00, 0x10000002, 0x0000f8e2, 0xea00f7fd, 0xf01a0300, 0x00000000,
+    0xd312e800, 0xd6fd0307, 0x000000f3, 0xda000014, 0xed0e0000, 0x0000f6f8, 0x2c00fd1c, 0xee000cfd,
+    0x1cfa1205, 0xfd0000f9, 0x0019f500, 0x050000f1, 0x0000e0e5, 0xe8000ada, 0x10ff0100, 0x00000000,
+    0xf406ea00, 0xe4fd080b, 0x000000ee, 0xed0000ea, 0xf6140000, 0x00000e0a, 0x2100e708, 0xfc00fcfa,
+    0x1bea0f1e, 0xf50000fa, 0x00140400, 0x2a0000f4, 0x0000e3f9, 0x0500fded, 0x01ee1500, 0x00000000,
+    0xf927f800, 0xdb0ae90e, 0x000000ef, 0xed0000e3, 0xf4080000, 0x00000401, 0x150009eb, 0x0a00fcfd,
+    0x1f010107, 0x000000f1, 0x00fb0800, 0x0e00001f, 0x0000f210, 0xd100f1dc, 0xf9061d00, 0x00000000,
+    0xf6f60d00, 0xddd3081f, 0x000000f8, 0xc0000014, 0xf2ed0000, 0x0000ec1f, 0xe900cbf4, 0x090001db,
+    0x04180a01, 0x2000003c, 0x000b0000, 0xfc0000e0, 0x00000fe4, 0x0900fa16, 0xe3051400, 0x00000000,
+    0x20102b00, 0xfff91ff5, 0x000000f9, 0xd1000001, 0xfee30000, 0x00002a0e, 0xd500df14, 0x0300eb00,
+    0x21150a1f, 0x13000029, 0x000dff00, 0x070000ed, 0x0000e618, 0x1c000117, 0x250b0200, 0x00000000,
+    0x04f61b00, 0xf1d129e7, 0x000000f4, 0xf8000017, 0xf4e90000, 0x0000f735, 0xcf00da06, 0x1900d0ff,
+    0x3a03052c, 0x06000000, 0x0004fc00, 0x050000fb, 0x0000fc0b, 0x13000613, 0x1c0ffd00, 0x00000000,
+    0x1eea1000, 0xf00f020a, 0x000000ff, 0x130000fd, 0xfbe70000, 0x00000b1b, 0xea001afc, 0x1500c303,
+    0x1c1304fd, 0xe8000018, 0x00e50400, 0x0f000013, 0x0000ec0d, 0x180017e1, 0x11e8ee00, 0x00000000,
+    0xf20ded00, 0xfa0719e9, 0x000000e2, 0x1a000017, 0xf0f30000, 0x0000fe24, 0x0600f1dd, 0x2800eff0,
+    0x0711faf9, 0xdb00001c, 0x00ec0800, 0x10000022, 0x00000dfa, 0x19001fc7, 0x10f70900, 0x00000000,
+    0x0814ed00, 0xf6e9140d, 0x000000e5, 0x10000013, 0x03070000, 0x0000e521, 0xec00f7ed, 0x2c00d901,
+    0x021ae5e2, 0xf4000041, 0x00fb0d00, 0xf5000028, 0x000015fc, 0xf70027f7, 0xe5210b00, 0x00000000,
+    0x0717f000, 0xede2f11b, 0x000000f3, 0xfb00002e, 0x030b0000, 0x0000f40f, 0xf400f7fc, 0xf600f20f,
+    0xfc1de2f1, 0xfa000029, 0x00020300, 0x03000019, 0x0000151f, 0x010002fa, 0xff0a0d00, 0x00000000,
+    0x0a270a00, 0x03d809f8, 0x000000fa, 0x1200001e, 0xf9010000, 0x0000ecf5, 0xf1000808, 0x09000207,
+    0xfa15f3d6, 0xfb000025, 0x00f30d00, 0xf8000003, 0x00002110, 0xf7000bf5, 0xed100700, 0x00000000,
+    0x0d17ed00, 0xf20a15bf, 0x000000ff, 0x1d0000f6, 0xe7ee0000, 0x0000fcd8, 0xfa00f312, 0xd3006d2a,
+    0x1d14ec02, 0x15000032, 0x00020900, 0x2600000f, 0x0000f4ed, 0x1200f103, 0xcee51500, 0x00000000,
+    0xebdbfc00, 0x0922ee03, 0x00000007, 0x140000f9, 0x11ed0000, 0x0000f9fd, 0x0e00fb1d, 0xd6003bfc,
+    0xfbfaf6db, 0xf5000014, 0x0035f000, 0x1e00000d, 0x0000dfdc, 0xfe00d9ea, 0xf7eefc00, 0x00000000,
+    0xe1fa0300, 0x0b03eb00, 0x000000fd, 0x200000d4, 0x0d140000, 0x0000ebf0, 0x22000bfd, 0xfa001308,
+    0xe3f903e4, 0x11000003, 0x0032f800, 0x06000010, 0x0000f701, 0xf200dce9, 0xda081800, 0x00000000,
+    0x09fa2300, 0xf809f220, 0x00000018, 0x050000d8, 0x0c1b0000, 0x0000f4f6, 0x1600f9fa, 0xd800f902,
+    0xf02e00f9, 0x2100001a, 0x0005fe00, 0xed00000a, 0x0000060f, 0xec00f311, 0x09131a00, 0x00000000,
+    0x1cee2700, 0x15f1e508, 0x00000012, 0xfb0000f3, 0xe50c0000, 0x00000606, 0x0500eaff, 0xf2000a03,
+    0xe617000d, 0x1b000012, 0x000b0300, 0xf60000ea, 0x000016fe, 0xff00e7f4, 0x1e091000, 0x00000000,
+    0xfacf3600, 0xeff1f115, 0x000000fe, 0x120000eb, 0xecf80000, 0x0000010f, 0xef00fe11, 0x12001cf5,
+    0xfb3ffe08, 0x0700001c, 0x00110d00, 0x0a0000e6, 0x0000140f, 0xf800f5e1, 0x27060000, 0x00000000,
+    0x17dc0d00, 0xfe0adf06, 0x000000e2, 0x12000009, 0x0ded0000, 0x0000140a, 0xe300ff2e, 0x1500ec0a,
+    0xf622f728, 0x08000029, 0x00f61b00, 0x2b0000d1, 0x000007e9, 0xf40007e9, 0x1003e500, 0x00000000,
+    0x10fe2b00, 0xdb05260a, 0x000000e8, 0x050000ec, 0x0ee30000, 0x0000131d, 0xef000ff9, 0x1600f72a,
+    0x0cfd0022, 0xff00004b, 0x00051e00, 0x360000d8, 0x0000fa04, 0x1e00f9f2, 0x1c07e500, 0x00000000,
+    0xf40a2900, 0x160c224c, 0x000000fa, 0xf3000017, 0xf4da0000, 0x0000e6d0, 0xec00edd7, 0x280012f4,
+    0xf800e8ef, 0xfa0000e9, 0x00e8fe00, 0xf5000014, 0x000013f6, 0xff00defb, 0xe0041300, 0x00000000,
+    0x0afbf400, 0xf70ce844, 0x000000fa, 0xea0000f7, 0xf5ef0000, 0x000009fa, 0x030011e1, 0xed000b1c,
+    0x0914e7f9, 0x0c0000e8, 0x00de0e00, 0xe8000010, 0x00000307, 0x0200fdff, 0xee0bfb00, 0x00000000,
+    0x23261300, 0x1c0ace35, 0x000000f5, 0xf40000ee, 0xeb050000, 0x000006ec, 0xd80022e2, 0x00001f08,
+    0x0c04f212, 0x130000f2, 0x00f11d00, 0x03000026, 0x000015f4, 0x1100f8f5, 0x0afd1600, 0x00000000,
+    0x15070900, 0x1efaf70d, 0x000000ec, 0xfd000009, 0x00fc0000, 0x0000ecf6, 0xd5000bee, 0x1700172a,
+    0x130af013, 0x300000f5, 0x00fa0d00, 0x19000001, 0x00000fff, 0x15001b1e, 0xfceb0b00, 0x00000000,
+    0xfd111600, 0x1feb1df2, 0x0000000f, 0xe2000003, 0xf2f00000, 0x0000eb08, 0xbf0003fc, 0x1b00e112,
+    0x0c04f407, 0x31000007, 0x00050000, 0x0600000b, 0x0000ece6, 0x17001525, 0x0cf3dc00, 0x00000000,
+    0x08020100, 0x0ef238eb, 0x0000001b, 0xec0000ed, 0xefec0000, 0x0000110b, 0xc600f902, 0x1100f6f6,
+    0x17060c0f, 0x2f00001e, 0x00fb0200, 0x0e0000fb, 0x0000010b, 0xfd003120, 0xf2f4e600, 0x00000000,
+    0xf5010400, 0xfc013ce3, 0x00000009, 0xf80000f2, 0x08080000, 0x0000f909, 0xe200f2ed, 0xfb00eb06,
+    0x1bfd0c20, 0x10000021, 0x0012f400, 0xfb000008, 0x0000ec12, 0x15001ceb, 0xde00fd00, 0x00000000,
+    0xf816e300, 0x1ceb3905, 0x00000002, 0x0f0000de, 0xe6e00000, 0x0000c9fd, 0x09001504, 0xff00cefd,
+    0x22f60b19, 0x2600000d, 0x0005fa00, 0xfe000016, 0x0000f913, 0x2f001ae9, 0xdbfde100, 0x00000000,
+    0x03ebe400, 0x16fb0ef6, 0x000000ee, 0xf10000fc, 0x040b0000, 0x00000f23, 0x0500d1d7, 0xf9001ff2,
+    0x01ed150b, 0xf40000ff, 0x00fe1200, 0x180000f2, 0x00001aea, 0x2600d529, 0xedfadf00, 0x00000000,
+    0x1ceff100, 0x060412f4, 0x000000ea, 0xce0000f9, 0xf3120000, 0x0000fc1a, 0x1a00d40e, 0x17000ff4,
+    0xeebe1bf0, 0xf10000f7, 0x00f01800, 0x13000003, 0x0000f117, 0x1f00f531, 0x07040600, 0x00000000,
+    0xf6e6f700, 0x130121f6, 0x000000fa, 0x00000000, 0x00fe0000, 0x0000190e, 0x1100cc0e, 0x0f00eaeb,
+    0xd7dd39f5, 0xf100000b, 0x00ff1e00, 0x12000011, 0x00000ffd, 0x0a00ed06, 0xea12ec00, 0x00000000,
+    0xf615e600, 0xf5002bf4, 0x00000003, 0x1300000d, 0xe1fd0000, 0x0000ff09, 0x1100df1f, 0x11000902,
+    0x04ff36ea, 0x0a00000a, 0x00061500, 0x09000006, 0x0000f00c, 0xf800f505, 0xed0a0600, 0x00000000,
+    0xeef50a00, 0xfbfe07e8, 0x000000fa, 0xef0000ef, 0x00fb0000, 0x00000e0a, 0x1300f807, 0xfb000bf7,
+    0x00f50cf0, 0x070000df, 0x00060600, 0x0700001b, 0x00000dfc, 0x020004ed, 0xee0f1400, 0x00000000,
+    0xf9eb1100, 0x021701ff, 0x000000f3, 0xed0000e8, 0x1a080000, 0x00000601, 0x0b000305, 0x0600121c,
+    0xfce3fc01, 0x070000e5, 0x00fdfb00, 0x0c000033, 0x0000fa0f, 0x10001209, 0xf3f00d00, 0x00000000,
+    0xf2061300, 0x1112e802, 0x000000ea, 0x020000fe, 0x05030000, 0x000011eb, 0xe9001ef8, 0x13001221,
+    0x09e5f6fd, 0x020000e5, 0x00fbf800, 0x00000009, 0x00001608, 0x04000a13, 0x14ef0800, 0x00000000,
+    0x05030600, 0x0d0fe214, 0x000000fa, 0xf40000ee, 0xe4d90000, 0x0000df0b, 0xe6001316, 0xfa00ec03,
+    0x11e3f50e, 0x0e0000e7, 0x000eff00, 0xf1000026, 0x0000051d, 0x2d00192f, 0xf4fe0100, 0x00000000,
+    0xf9011500, 0xfbf1fd09, 0x00000006, 0x090000ea, 0xd1000000, 0x0000e51e, 0xee0001c9, 0x0900fe11,
+    0xe020dfe8, 0xfa0000ec, 0x00020e00, 0x2f000015, 0x0000fd17, 0x4800ded6, 0x02150500, 0x00000000,
+    0xe30b0d00, 0x191e250c, 0x000000ff, 0xfa0000eb, 0xfbed0000, 0x0000eff8, 0xd8001df4, 0x0100ef1a,
+    0xeb35e9de, 0xea0000f7, 0x002f2500, 0x2700002b, 0x00001101, 0x19000fed, 0xd6f30c00, 0x00000000,
+    0xf50a0d00, 0x2e111914, 0x0000000d, 0x180000e9, 0x11f90000, 0x0000030d, 0xeb00ffe3, 0x1400011e,
+    0xcb2be2df, 0x0c0000fe, 0x00292500, 0x0500001f, 0x0000ff15, 0x030006f5, 0xdbdfdd00, 0x00000000,
+    0x260b2600, 0x1ffdf712, 0x00000003, 0xf9000019, 0xef060000, 0x0000f40d, 0xe300f1f0, 0xe900eef5,
+    0xdb1de2ee, 0xf9000017, 0x00272f00, 0x0b0000fb, 0x00001bf7, 0x110020f8, 0xe7100000, 0x00000000,
+    0x241d2000, 0x09ebc908, 0x0000000a, 0x1a000006, 0xeef70000, 0x0000f408, 0xfe00e709, 0xf600f904,
+    0xfffff2ef, 0x0f000020, 0x000e1a00, 0xfd0000e6, 0x000033f1, 0xfc0024f1, 0x012f0900, 0x00000000,
+    0x160d0d00, 0x0ccfea02, 0x00000013, 0x1200001c, 0xfeed0000, 0x0000df22, 0xe900ee1c, 0xe700eceb,
+    0x08cdfd0c, 0x2700001a, 0x00f1f800, 0xf500000f, 0x00000d15, 0xfd00f9f6, 0x0c06f600, 0x00000000,
+    0xef1bec00, 0x06d3fde7, 0x0000000b, 0xf4000008, 0xe7010000, 0x0000ef20, 0xe900f21c, 0x090008f1,
+    0x0cfb051c, 0x0d0000fd, 0x00faf600, 0x070000ff, 0x00001808, 0xef0015fe, 0x000ede00, 0x00000000,
+    0x03f5e000, 0x13ea1aeb, 0x00000005, 0x03000015, 0xf2ed0000, 0x0000d609, 0x0f00f913, 0xfc00f3fe,
+    0x14fe0318, 0x2a0000eb, 0x0001f200, 0xfa00000d, 0x00000915, 0x2b001310, 0xf21ce900, 0x00000000,
+    0xfdf9d800, 0x210acdfc, 0x000000d4, 0x2c00001a, 0x09140000, 0x00001205, 0xfc000df4, 0x0d00b921,
+    0x00161ce1, 0xe3000009, 0x00e81600, 0xc10000e6, 0x0000ef06, 0xed0010f8, 0x361bf700, 0x00000000,
+    0xf41f0100, 0x16daedf0, 0x00000000, 0x2400000e, 0xc51c0000, 0x0000091b, 0xef000a01, 0x0000e8f1,
+    0x122306f7, 0xd8000001, 0x0006d100, 0xc40000f8, 0x000004f7, 0xf80010f0, 0x1d07f700, 0x00000000,
+    0xe5fa0200, 0x05f0edcb, 0x0000000d, 0x1a000028, 0x02030000, 0x00001e28, 0xf9000702, 0xf600000b,
+    0x02f0eb20, 0xeb000003, 0x00dfc700, 0xe9000009, 0x0000f8cd, 0x0a0017eb, 0x180b1e00, 0x00000000,
+    0xe031dd00, 0xf802e7e5, 0x00000031, 0x080000ed, 0xfd120000, 0x0000051d, 0x1400f224, 0xe9001024,
+    0xdbe0e7f2, 0x1a000009, 0x0021d900, 0xf30000f5, 0x0000e90a, 0x070001d1, 0x03fbf800, 0x00000000,
+    0xd92cff00, 0x15fc07d9, 0x00000042, 0x200000d4, 0x193a0000, 0x0000f025, 0x23001306, 0xf000f914,
+    0xeaf2eff3, 0x0600000f, 0x001ae500, 0x03000012, 0x00000ffe, 0xef00ead1, 0x05f5fb00, 0x00000000,
+    0xfd121200, 0x17190ef7, 0x00000032, 0x010000f5, 0x19090000, 0x0000fd14, 0x04002200, 0x01000c0c,
+    0xe911fafd, 0xec0000fc, 0x0035f400, 0x1b0000f2, 0x000009f0, 0xf100e8f4, 0xf4f9df00, 0x00000000,
+    0x03e52400, 0x1d1a08fa, 0x00000017, 0x040000f1, 0xf5110000, 0x0000060f, 0xee0039f4, 0xf3001811,
+    0xf00cff0a, 0xfb000005, 0x000f0b00, 0x110000f7, 0x00000c0a, 0xf800ddeb, 0x08e2ea00, 0x00000000,
+    0x0df22d00, 0xee120b08, 0x00000001, 0x0f0000f6, 0xea010000, 0x0000fb01, 0xeb002108, 0x0f00f830,
+    0x0a23fcff, 0xf2000025, 0x000e0800, 0x0e0000f9, 0x0000e7ef, 0xfd00e4eb, 0xffe2f500, 0x00000000,
+    0x27e83400, 0x1812cbd9, 0x000000f4, 0x0f0000f1, 0xd6020000, 0x000011e5, 0xdf001eff, 0xfc000907,
+    0x10042d07, 0xff00000e, 0x00f00f00, 0xe60000e1, 0x0000d4eb, 0xe3001d21, 0x2d111200, 0x00000000,
+    0xffd31700, 0xfe06efef, 0x000000ea, 0x18000004, 0xf2270000, 0x000014d8, 0xe6000eee, 0x0c00f005,
+    0x13081612, 0xf2000003, 0x00e8f300, 0xef0000ed, 0x0000f5dd, 0xff001d05, 0x1dfaf900, 0x00000000,
+    0xece60800, 0x211bedd7, 0x000000fc, 0x3400001f, 0xe8fe0000, 0x000018f9, 0x2d00e9e5, 0x1f00e9ec,
+    0xea191cf6, 0x00000000, 0x00fdc700, 0xf0000004, 0x0000f8da, 0xfe0018ff, 0x0a04ff00, 0x00000000,
+    0x01f50200, 0x13fbf8ea, 0x00000018, 0x1b00001f, 0xee070000, 0x00002303, 0x23000b07, 0xed00e80b,
+    0xd91105e3, 0x01000007, 0x00e1e100, 0xd7000001, 0x0000fee1, 0x0b0023f6, 0x07170300, 0x00000000,
+    0x0704ee00, 0xf5f0e3e7, 0x0000001b, 0x040000fb, 0xfce90000, 0x00001605, 0x1d00ee09, 0xf9000609,
+    0xe1fb01f3, 0x04000017, 0x00fee500, 0xe40000f8, 0x000003fa, 0xfe0008e4, 0xe90e0600, 0x00000000,
+    0xf600ef00, 0x08f0e8e7, 0x0000001f, 0x160000f5, 0xe90c0000, 0x0000f61c, 0x2c000f04, 0xfa00fc14,
+    0x1af50ee9, 0x0b0000f7, 0x00f2da00, 0xec0000fd, 0x0000e5e3, 0xea000501, 0xf70bf100, 0x00000000,
+    0xddfde400, 0xf20afde8, 0x00000008, 0x1000000a, 0xf21b0000, 0x0000f100, 0x33000b0a, 0xf5000a0d,
+    0x280e1510, 0x010000fc, 0x00f3e000, 0xfb0000fc, 0x0000d1fa, 0xfc0002e6, 0xfde8f900, 0x00000000,
+    0xecf1e100, 0x0d19f6f6, 0x00000004, 0x3c000000, 0x10360000, 0x00001ee4, 0x1000fefc, 0x08000eed,
+    0x33e10a0d, 0x080000fc, 0x00f9ee00, 0xfe000010, 0x0000f3fa, 0xe800e402, 0xf3dfe100, 0x00000000,
+    0xfcfbea00, 0x270d12d1, 0x000000ee, 0x0d000000, 0x0ffa0000, 0x0000354c, 0x2000f1f7, 0x2200c0fb,
+    0x062705f4, 0xe1000012, 0x000cd000, 0xef0000e4, 0x0000fffe, 0x1f000bf7, 0x140ef600, 0x00000000,
+    0xf7f61900, 0xf6080102, 0x0000000b, 0x0e00000e, 0x28160000, 0x00001538, 0x0e00f8e5, 0x3800d8ea,
+    0x1016fdef, 0xda0000ed, 0x00dce200, 0x120000f4, 0x00000402, 0x1d00f7e3, 0x0a171b00, 0x00000000,
+    0xf6d81c00, 0x06f4eb05, 0x00000001, 0xf9000013, 0x38f90000, 0x00001c27, 0x240006fb, 0x1900ddfd,
+    0xfdfce0ff, 0xcb0000e0, 0x00e7fb00, 0x06000018, 0x0000fe04, 0x2d00f8f6, 0x1b032700, 0x00000000,
+    0xf3e0fe00, 0x0cf2ec1e, 0x000000e8, 0x0700000f, 0x08f60000, 0x0000fefb, 0x1b0000e8, 0x27001e00,
+    0xff01de02, 0xef0000e7, 0x00f70800, 0xe000002e, 0x000002fd, 0xff00e1f9, 0x03070d00, 0x00000000,
+    0xf203ff00, 0x11ffe50d, 0x000000c8, 0xfd000014, 0x0cfe0000, 0x0000f1e1, 0xef00fd0f, 0x1b000ffd,
+    0x06fce1f2, 0xf6000001, 0x0006f900, 0xe400002e, 0x0000fdfe, 0x0c00ec1f, 0x07070a00, 0x00000000,
+    0xe7e9e800, 0xf1ead7df, 0x000000d6, 0x17000018, 0xe00e0000, 0x0000e5ed, 0xf9000613, 0xfd0023fa,
+    0x14f8ef09, 0xe3000015, 0x00e5ff00, 0xe400002a, 0x0000f30e, 0x0600fc39, 0x1cffe800, 0x00000000,
+    0xec0f0200, 0x00fbfaf0, 0x000000f5, 0x04000028, 0x08fe0000, 0x0000e1e9, 0x0000ea0b, 0x170015fd,
+    0x06f20322, 0x29000025, 0x00f30e00, 0xe800000b, 0x000018f8, 0xe800fa24, 0x0612f200, 0x00000000,
+    0xeef9e800, 0xf4ec2aef, 0x0000001c, 0x0b000029, 0x102f0000, 0x00000500, 0x1700d619, 0x0c0002f0,
+    0x1b040614, 0xf900001e, 0x00db1800, 0x150000e8, 0x000020d8, 0x2000f90b, 0xecfde600, 0x00000000,
+    0xe7ef0a00, 0x0ee216ea, 0x0000002a, 0x2e0000ff, 0xd5e60000, 0x0000ff42, 0xcb00e41c, 0x1700e61d,
+    0xc51402d0, 0x0b000018, 0x00ff1600, 0x180000fa, 0x0000e6eb, 0xf600150b, 0xffe82c00, 0x00000000,
+    0xea010a00, 0xf6fc2af2, 0x0000002f, 0x0e0000e9, 0x150d0000, 0x00001630, 0x0200c700, 0x1a00ecfe,
+    0xe31a03ef, 0xfa00001f, 0x001ad200, 0x310000e8, 0x00000bd5, 0x17002dc8, 0xf823f200, 0x00000000,
+    0x11ef1500, 0xd7fd0bc5, 0x00000020, 0x070000dd, 0xf80e0000, 0x00000917, 0x1c00dd26, 0x0a0004fc,
+    0xeff80de5, 0x0400001d, 0x000edc00, 0x320000db, 0x0000f2f5, 0x0400f6e7, 0xf609eb00, 0x00000000,
+    0x12fbff00, 0xe81705e0, 0x00000017, 0x2d0000eb, 0x06110000, 0x000004f4, 0x1800e204, 0xec002119,
+    0x06dd30dc, 0x11000004, 0x000df200, 0x300000f0, 0x0000120c, 0x0900f1e5, 0xd403d900, 0x00000000,
+    0x23f00600, 0xe70bfa0a, 0x00000008, 0x090000db, 0xf6070000, 0x0000fdff, 0x3300fedf, 0xf4000b0f,
+    0x04eb2cff, 0x1e00000f, 0x00140700, 0xfb000014, 0x0000f1fd, 0x15000e09, 0xddebf800, 0x00000000,
+    0x1617f700, 0xf70417f1, 0x0000001a, 0x160000dc, 0x05100000, 0x00000ee6, 0x0400fadb, 0xff0032e7,
+    0x00d82515, 0x1d000014, 0x0015fb00, 0xf30000fd, 0x0000e51a, 0xf3000514, 0xebd0fc00, 0x00000000,
+    0x1d1bea00, 0x18080c09, 0x0000000f, 0x180000fc, 0xea050000, 0x0000f8ec, 0x1300fed9, 0x09001df5,
+    0xf6d5120b, 0xfb000011, 0x001f0700, 0xec000015, 0x0000ef0d, 0xe500faf5, 0xfceb2b00, 0x00000000,
+    0x3116da00, 0x1dfefbf3, 0x00000016, 0xda0000f5, 0xea020000, 0x000005f5, 0x0500f7e3, 0xf50006dd,
+    0xe0f008f2, 0x29000006, 0x001bf100, 0xf3000007, 0x000001f0, 0xd4000df9, 0xfceb1500, 0x00000000,
+    0x0e07bb00, 0x050417ff, 0x0000003d, 0xd30000e9, 0xe7240000, 0x000022f2, 0x0d00fee0, 0xfb001318,
+    0x08fbd5ef, 0x210000cc, 0x0008dd00, 0xdf00000f, 0x0000f1fe, 0x16000ad1, 0x1be0ef00, 0x00000000,
+    0x37e6df00, 0x170efffa, 0x00000027, 0xeb0000ef, 0x33ea0000, 0x00000304, 0x1b00f500, 0xfa00e603,
+    0xe9caee07, 0x050000d8, 0x0029e500, 0xde00000a, 0x00000207, 0x02001612, 0xdce3da00, 0x00000000,
+    0x2e0fdd00, 0xf218e2fb, 0x00000019, 0xf10000f4, 0x07fd0000, 0x000004f4, 0x000022fc, 0xfa00e52c,
+    0x07d90b11, 0x0c0000e1, 0x0014e200, 0xd30000f9, 0x0000182b, 0x0900211d, 0x0ad4fb00, 0x00000000,
+    0x3008ea00, 0xe8dcfa23, 0x0000001a, 0xed000028, 0x06f60000, 0x0000fbe2, 0x220007fb, 0x0900fa08,
+    0x01de1513, 0x000000ff, 0x00faef00, 0xc4000002, 0x0000191f, 0x0000070e, 0x051ae900, 0x00000000,
+    0x0600e400, 0xf4e9fe2e, 0x0000002a, 0xf900003c, 0xee030000, 0x0000e7f2, 0x1b00e909, 0xe900f604,
+    0xfe142122, 0xf500000f, 0x00dbf300, 0xcb0000ef, 0x0000fae8, 0xf200f626, 0x140fee00, 0x00000000,
+    0x1611c900, 0xebe91c07, 0x0000001c, 0xe6000056, 0xe9040000, 0x0000fdfc, 0x0500011b, 0xeb0011f9,
+    0xde131722, 0xff0000f2, 0x00ebfa00, 0xf600000c, 0x0000f2e0, 0xfc00e206, 0x080cf500, 0x00000000,
+    0xd506d700, 0x04f105ee, 0x0000000a, 0xf9000034, 0x0de80000, 0x00000506, 0x0600f107, 0x02000d02,
+    0xff16000d, 0xf40000ea, 0x00fcf400, 0x0a0000f6, 0x0000ffec, 0xfd00ed16, 0x0cfde800, 0x00000000,
+    0xe417f400, 0xfc1a13f5, 0x00000002, 0xfa0000e3, 0xfdf80000, 0x0000ea07, 0x0700f9fe, 0x06000d17,
+    0x1d2df7f3, 0xe20000f2, 0x00020100, 0x150000e6, 0x0000ddec, 0x2100140f, 0x130fed00, 0x00000000,
+    0xe60f1000, 0xf4060d26, 0x0000005b, 0xc90000d1, 0x09060000, 0x0000134f, 0x1a00131a, 0xe6002512,
+    0xffd7e421, 0x2b000007, 0x00301400, 0x2700000d, 0x00000bf2, 0xee00f4fe, 0xd1dce400, 0x00000000,
+    0x4c2bff00, 0x05f93c09, 0x0000002b, 0xca0000d9, 0x24fe0000, 0x000011e8, 0x000006e0, 0x0200df08,
+    0xdfecf0f1, 0x350000f4, 0x00ff3700, 0x0f0000ea, 0x00001505, 0x1000da0f, 0xe9e50c00, 0x00000000,
+    0x0c0b0f00, 0x0fdb041e, 0x00000027, 0xb6000005, 0x26020000, 0x0000f7f5, 0xfc00f913, 0x0900d201,
+    0x10d80519, 0xfb000006, 0x00e13900, 0x0a0000eb, 0x0000f6f8, 0x0500f51e, 0x0b19f900, 0x00000000,
+    0xf2051f00, 0xfcd909e6, 0x00000025, 0xc7000000, 0xfa1a0000, 0x00001504, 0xd100ea2d, 0xf200ca18,
+    0x0ff61225, 0xf70000d4, 0x00f91c00, 0xf50000e6, 0x0000f7d3, 0xfd00ea25, 0x0df2ec00, 0x00000000,
+    0xb8d51900, 0x110f03ff, 0x00000019, 0xdf0000f3, 0xcb0c0000, 0x00001102, 0xd600fd01, 0x1000e630,
+    0x2a001919, 0xeb0000d3, 0x0011f000, 0xff0000fd, 0x0000e9da, 0x060008ea, 0x2ceaf000, 0x00000000,
+    0xd3e40000, 0x0f2cd604, 0x00000006, 0x050000de, 0xe1e90000, 0x00002016, 0x040015ef, 0xfa00e91b,
+    0x12271dfd, 0xf10000ef, 0x0018da00, 0x03000004, 0x0000ecf8, 0x1d001ce6, 0x1dd10000, 0x00000000,
+    0xe3f10f00, 0x0715d2eb, 0x00000003, 0x3e0000e7, 0x00060000, 0x000007f8, 0x1700eff3, 0x0400e312,
+    0x09070813, 0xfd0000ec, 0x003ce100, 0x020000f8, 0x0000ea0a, 0x010006e4, 0xfbec0400, 0x00000000,
+    0x04fb0e00, 0xf80e02fa, 0x00000004, 0x510000b7, 0x06fd0000, 0x0000220a, 0xf600f4e7, 0xf300fe09,
+    0x0317f3ef, 0x07000003, 0x0030e100, 0x170000f8, 0x0000f5fc, 0xe50004fd, 0x24eed500, 0x00000000,
+    0x1ff30600, 0xfadb01e3, 0x000000ed, 0xe90000f9, 0xf0f90000, 0x0000fdc7, 0x1800ced9, 0xf500f0dc,
+    0xf4f8350a, 0x0f000025, 0x00fb1000, 0x070000e1, 0x000004ef, 0x1a00ef12, 0xf10edf00, 0x00000000,
+    0x23100300, 0x0104fee7, 0x000000e9, 0xfa0000e3, 0x01020000, 0x00001fd3, 0x0700d7ed, 0xf10003e1,
+    0x01f02305, 0xfa00001f, 0x0003e300, 0x0a000007, 0x0000fb10, 0x0400f905, 0xfd250200, 0x00000000,
+    0x16faef00, 0xf2eef6fc, 0x000000e5, 0x070000eb, 0x09f00000, 0x00002003, 0x1700edf2, 0xd7000fd8,
+    0x0b20120f, 0x07000004, 0x0009f200, 0x0c000019, 0x00000df3, 0xfa0012f3, 0x1c031500, 0x00000000,
+    0x08f1f700, 0x09ede026, 0x000000fd, 0x0c0000e3, 0x01f90000, 0x00001b06, 0x0900e6e6, 0xe100f7ff,
+    0xe510f1e9, 0x190000fc, 0x00f4f100, 0x1b000027, 0x0000030c, 0xfa00eff0, 0x021f2900, 0x00000000,
+    0x08fe1c00, 0x0b03ef19, 0x000000ff, 0xf30000ea, 0x0ae30000, 0x0000f6ef, 0xed0010e8, 0xfa00ff00,
+    0xe426e116, 0x160000fd, 0x00060500, 0x1b00001e, 0x00000e16, 0x120006d9, 0x16fb2200, 0x00000000,
+    0x10192000, 0x170ff502, 0x000000f6, 0x09000003, 0xefef0000, 0x0000db0a, 0xee0023ee, 0xe500fae0,
+    0xd91ee1e1, 0x01000005, 0x00170900, 0x1000002c, 0x000014fd, 0x0e00e8e3, 0x01001200, 0x00000000,
+    0xfc002900, 0xfa0c05f5, 0x000000fe, 0x070000ef, 0x17010000, 0x000001f8, 0x0100f2fb, 0x00000d11,
+    0xe539e706, 0xf8000016, 0x000b0800, 0x0d000000, 0x0000ff1f, 0x1e00ef00, 0x002b0f00, 0x00000000,
+    0x09061400, 0x04f1e8e8, 0x000000f1, 0x00000018, 0x00e40000, 0x0000d1f3, 0x0600fb03, 0xed00e818,
+    0xe03beae6, 0xeb00001e, 0x0017ee00, 0xf6000026, 0x00001012, 0x21002718, 0x1115e100, 0x00000000,
+    0x05013600, 0x0adb11d0, 0x00000017, 0xee00000c, 0x020d0000, 0x000020d9, 0xfa00f7f0, 0xee00effe,
+    0xf5db2421, 0xfb0000ed, 0x00f6f000, 0xbe000001, 0x0000f727, 0x0f00ff44, 0x1fe6d200, 0x00000000,
+    0x2ef2ce00, 0xfcf82ade, 0x0000001a, 0xf5000005, 0x1bcf0000, 0x0000f8eb, 0xee00f2f7, 0xdf00eaf6,
+    0x0adb2afd, 0x20000009, 0x0018fe00, 0xac000017, 0x0000fa0b, 0x07000948, 0xfdc30500, 0x00000000,
+    0x2c12c200, 0x0b001609, 0x00000016, 0x0f000004, 0x01d60000, 0x00001307, 0xeb00e00f, 0xd30002e0,
+    0xdefe29e3, 0x0c000014, 0x002ff100, 0xc10000fe, 0x00000afb, 0x07000331, 0x14dffe00, 0x00000000,
+    0x16fbdc00, 0x16fb0608, 0x000000f0, 0x170000ec, 0xe3c00000, 0x00000d00, 0xd900e907, 0xdf001acf,
+    0x032df8f7, 0x1100002e, 0x001be100, 0xba0000d9, 0x0000130c, 0xf700f802, 0x1d04fd00, 0x00000000,
+    0xf6dbfb00, 0xf7f9edf8, 0x000000f6, 0x050000fe, 0x01e90000, 0x0000160f, 0xf80007fe, 0xdc0011f5,
+    0x0e1cf0e3, 0x1000002b, 0x0031eb00, 0xf80000dd, 0x0000fc0b, 0xff00e408, 0x1221fe00, 0x00000000,
+    0xe705f600, 0x0bf0f1e9, 0x000000fb, 0x03000006, 0x1dc10000, 0x00000f15, 0xf500e918, 0xfc000cfd,
+    0x3407f2e8, 0xef00001a, 0x0021f100, 0x090000d1, 0x00000d07, 0x0d00ed19, 0x170c0200, 0x00000000,
+    0xe7e5f200, 0x03dbed03, 0x00000005, 0x0d000003, 0x24d20000, 0x00000403, 0x1100d009, 0xf100eef8,
+    0x2ef9fa19, 0x0c000007, 0x0016d700, 0xe8000000, 0x000009f8, 0x0600f40f, 0x10030800, 0x00000000,
+    0xe10dd600, 0x0407ef03, 0x00000012, 0xf3000002, 0x18da0000, 0x00002020, 0xfc00dcfa, 0x1000f8fa,
+    0x2ad7f2f7, 0x080000f7, 0x00f1f200, 0xdf0000fc, 0x000012f5, 0xfe001013, 0xe7fff600, 0x00000000,
+    0xdff0d100, 0xe00012e9, 0x000000fb, 0x0b000022, 0x02cd0000, 0x0000f313, 0xf800e831, 0x080005d0,
+    0x25e62be1, 0x12000031, 0x0010ec00, 0x13000015, 0x0000e7f8, 0xdd0017e9, 0xffed0500, 0x00000000,
+    0xd2f7f300, 0xfafdfcda, 0x000000f2, 0xef00000c, 0x20d30000, 0x000005ff, 0xff00d623, 0xfa00e9dd,
+    0x130b27f9, 0x14000028, 0x00f9f100, 0x090000f0, 0x0000dd15, 0xf30001e3, 0xfe0d0200, 0x00000000,
+    0xdce8f500, 0x00f20be6, 0x000000ee, 0x1e000024, 0x10fa0000, 0x0000eae5, 0xe700fe29, 0x0000fded,
+    0xf4422010, 0xff00001c, 0x000e0700, 0x150000f8, 0x0000f1f3, 0xe2001dd2, 0xeaf01400, 0x00000000,
+    0xfede1b00, 0xfcf0feef, 0x00000008, 0x0d0000f0, 0xe9e80000, 0x0000f9ff, 0xf000e91c, 0x16000c0e,
+    0x0a340814, 0xf9000019, 0x0022fb00, 0x1800000b, 0x0000e4ee, 0xf20019f4, 0x1dda0400, 0x00000000,
+    0xece80600, 0x0403f405, 0x000000fa, 0xff0000fe, 0x09e70000, 0x0000fc22, 0x0a00eff6, 0xe200de14,
+    0x300e061a, 0x05000011, 0x0036ef00, 0x1b0000e6, 0x000000ff, 0xe70038e7, 0x0601fd00, 0x00000000,
+    0xf4e52900, 0xeceef6ef, 0x00000006, 0x2b00000c, 0xe9090000, 0x00000b2b, 0x150003fb, 0xe5000402,
+    0x46fd0401, 0xf000002b, 0x001ee300, 0x170000f9, 0x000005f5, 0x0a0011d7, 0x08f50d00, 0x00000000,
+    0x00051100, 0xed0e03e9, 0x00000008, 0x1c00000d, 0xfd0a0000, 0x0000060f, 0x0700f0ee, 0xf7000604,
+    0x17f005ec, 0x0a00001a, 0x001cd800, 0x130000e7, 0x00001e04, 0xf9001eef, 0xfafe0c00, 0x00000000,
+    0xe603ff00, 0xe9fd0ff8, 0x00000003, 0x30000013, 0x13110000, 0x00002d12, 0x0f00e600, 0xfa00fef7,
+    0x1eec0503, 0x00000010, 0x0008e000, 0x01000003, 0x0000f703, 0xd10024f3, 0xf5012200, 0x00000000,
+    0x0414f300, 0xed1ff202, 0x00000025, 0x2a00000e, 0x1d3c0000, 0x0000f8d7, 0x0c003316, 0x1600120e,
+    0x0bdddbff, 0x190000d7, 0x00062100, 0xf9000010, 0x0000f703, 0xeb00222b, 0xebd4f200, 0x00000000,
+    0x44f6ef00, 0x0500f604, 0x00000032, 0x04000021, 0x082c0000, 0x0000d4f4, 0xf9001afc, 0xe500fc11,
+    0xfffef0fd, 0xfb0000e9, 0x00f65000, 0xc50000fb, 0x000010ff, 0xfa000a23, 0xf6fa0300, 0x00000000,
+    0x07fad400, 0x0f0c0505, 0x00000027, 0x0e00000e, 0x0e240000, 0x0000fef4, 0x000015ff, 0x0300171c,
+    0x0feae811, 0x150000e6, 0x00f42300, 0xe00000e5, 0x00000ee9, 0xed000339, 0xeaeff900, 0x00000000,
+    0x0fedd300, 0x14002225, 0x0000000b, 0x16000007, 0xfd420000, 0x0000e709, 0xf100fc11, 0x030024fe,
+    0xed20ee09, 0xf2000004, 0x00f10500, 0xe80000f2, 0x0000ed05, 0xf300e30e, 0xe6ee0800, 0x00000000,
+    0xf611cd00, 0xfefa0322, 0x0000000d, 0xec000001, 0xfe150000, 0x0000fc0e, 0x04000c04, 0x0c0028fc,
+    0xd523e3fc, 0xfc000002, 0x00100200, 0xf90000f6, 0x0000e9eb, 0x1000c9fb, 0xd2fefe00, 0x00000000,
+    0x0c060500, 0x0d070216, 0x000000fb, 0xf40000dc, 0xf62c0000, 0x0000ff19, 0xef0024f3, 0x1b00280c,
+    0xeaf7def0, 0x000000f2, 0x00f40c00, 0x1f000004, 0x000001f6, 0xf100e403, 0xd3d4f800, 0x00000000,
+    0x0fe03200, 0xe7131302, 0x000000fc, 0xf40000fb, 0x1b190000, 0x0000e4f7, 0x0600300f, 0x21001905,
+    0xf3f3de01, 0x0f0000e4, 0x00010d00, 0x140000f2, 0x00001f00, 0xfd0001f4, 0xfcf3f900, 0x00000000,
+    0x19da2a00, 0xda1ce50c, 0x000000ef, 0xd5000000, 0xf6140000, 0x00001ffa, 0x160007f9, 0x34000c14,
+    0xdffde9df, 0xf30000fa, 0x00f31900, 0x030000e6, 0x0000ffe0, 0xed00f9f8, 0xf9d11300, 0x00000000,
+    0x12183600, 0xf6f2f52b, 0x000000d6, 0x04000018, 0xfc160000, 0x0000e4a4, 0xf8000d06, 0xe40008f9,
+    0xde02f4f8, 0xf20000f4, 0x00e80f00, 0xf90000ea, 0x0000d108, 0xee000406, 0x09270800, 0x00000000,
+    0xe5f9e300, 0xea07e820, 0x000000fd, 0xf70000ee, 0xe40f0000, 0x0000fcd8, 0xf900fee9, 0xff003202,
+    0x181f100d, 0x16000008, 0x00f80700, 0x16000008, 0x000002e3, 0xf2001811, 0xf7eb0600, 0x00000000,
+    0x0af2fd00, 0x0f17ecf8, 0x000000f8, 0x000000fd, 0xf8260000, 0x00000be3, 0x050011f7, 0xfe001809,
+    0x15233008, 0x30000014, 0x0006e200, 0x0f000003, 0x0000e0ea, 0xd9000c24, 0xfbe3ff00, 0x00000000,
+    0x142ff300, 0x050f10e6, 0x0000001a, 0x1b0000f0, 0xec230000, 0x00000204, 0x1d00e2f9, 0xf50005fb,
+    0x28023300, 0x2e000012, 0x000ad600, 0x03000008, 0x0000eaf0, 0x00001727, 0xdf000500, 0x00000000,
+    0x1121e200, 0x14fe1eed, 0x00000020, 0x000000ef, 0xe4fd0000, 0x00000a03, 0x2e00fde6, 0x0a00d6e2,
+    0x291534ef, 0x05000006, 0x00e4dd00, 0x020000ec, 0x0000e5ed, 0x17001afd, 0xe411f900, 0x00000000,
+    0xe911d200, 0xf90523da, 0x00000017, 0x010000ef, 0x0ef20000, 0x00001314, 0x2d0004ef, 0x0700d5e2,
+    0x35092601, 0xec0000ef, 0x00ceed00, 0xf8000002, 0x0000e20d, 0x050029e9, 0xdff20800, 0x00000000,
+    0xe824d800, 0x13f11bfa, 0x000000ff, 0xfa0000ee, 0x1ee80000, 0x00002919, 0x1d0001ef, 0x1200fee8,
+    0x04040a12, 0xea0000e2, 0x00dee500, 0xfd0000f2, 0x0000f124, 0x040018dc, 0x0d030300, 0x00000000,
+    0xdd25d700, 0xf10e01e1, 0x000000f2, 0xd80000e3, 0x1df70000, 0x00001c10, 0x280002d4, 0xf500eccf,
+    0x39fc0af4, 0xf90000d2, 0x00dff100, 0xf1000005, 0x0000e822, 0xf7001ff8, 0xfff82300, 0x00000000,
+    0xea2cda00, 0xe6021ede, 0x000000e9, 0xf1000019, 0x28fb0000, 0x00002103, 0xd700f222, 0x3300d3d8,
+    0x04f41fd2, 0x18000012, 0x00f0e500, 0x0300000c, 0x0000ef11, 0xf8000821, 0xffebff00, 0x00000000,
+    0xfedaee00, 0xeb0ef7ed, 0x000000fa, 0x11000009, 0x13010000, 0x0000f2f0, 0xe700e0fe, 0x2b00d9f8,
+    0xf6f0260a, 0xde000004, 0x00d41200, 0xe20000f9, 0x00000a23, 0x0b000027, 0xff08fd00, 0x00000000,
+    0xf1ecfa00, 0xf9f2e2ef, 0x000000f8, 0x08000011, 0xfe050000, 0x00001804, 0x0f001aeb, 0xfa00f514,
+    0x140a311d, 0xe10000f7, 0x00e50100, 0xe600001a, 0x000002e1, 0xe7000f0d, 0x0e19f700, 0x00000000,
+    0xe4e7f500, 0xe91200e1, 0x00000000, 0x2c000004, 0xf61e0000, 0x00000403, 0x050000f3, 0x05001bf5,
+    0x010b2c0a, 0xf70000fc, 0x000dea00, 0xf200001b, 0x0000eae9, 0xda003405, 0x06002500, 0x00000000,
+    0xf002ce00, 0xe71807da, 0x000000ff, 0x1100000a, 0x0b120000, 0x0000fc01, 0x3c0008de, 0x01000fe9,
+    0xeaf91eff, 0x0a00001f, 0x0013d500, 0xe2000008, 0x0000d5e5, 0xfa0008f7, 0xff05fd00, 0x00000000,
+    0xff24d300, 0x02fff3f0, 0x00000022, 0x2f0000f6, 0x15050000, 0x00000317, 0x2a00f20b, 0xf20026e2,
+    0xfdf718e4, 0xef000026, 0x0016cc00, 0xea0000ff, 0x0000e80c, 0xfc00edf5, 0xe31b1f00, 0x00000000,
+    0x0c21d200, 0xe60aefdd, 0x00000025, 0x0c0000d5, 0x110d0000, 0x000000ff, 0x1700f108, 0x010018e5,
+    0x22fd0b0f, 0x1100001e, 0x001cd700, 0xf90000fe, 0x0000dafd, 0xf500e203, 0xd20f0e00, 0x00000000,
+    0xfa16ea00, 0x05f723e2, 0x0000001b, 0x1b0000f3, 0x14030000, 0x000022fa, 0x1e0012e5, 0x070022d5,
+    0x2ef902f5, 0x0c000013, 0x000ade00, 0x050000ef, 0x0000e7f1, 0xdf00dd07, 0xfbf81300, 0x00000000,
+    0xf0facf00, 0x43e524f8, 0x1cf012d9, 0x2d01393d, 0xf4400df8, 0xd1240845, 0x1fdfc3e5, 0x2638e41e,
+    0xd708ec0b, 0x0afedb08, 0x4f3eebd7, 0x08ea1809, 0xa9f731f7, 0xf62bfc0a, 0xdec8f7e8, 0xf41bfd1b,
+    0xd61817e5, 0x0300f2e9, 0x1f15fcf7, 0xeeeb04dd, 0xfc0af6e0, 0xf425fbfc, 0x0ee1f403, 0xe00f1d1b,
+    0xe7210808, 0xfe2efee6, 0xff0bf9ee, 0x00ef0526, 0xfd1de2f1, 0xf110d3f9, 0xfff93734, 0x0f09f9fb,
+    0xfa051c07, 0xf60720ed, 0x03e114f3, 0x06090001, 0x13ee06f4, 0xed0c0a02, 0x0900f0f6, 0x0bfff515,
+    0xfcf01010, 0x060611fe, 0x09f0f6ee, 0x030d0007, 0x05ec05f4, 0x080b000f, 0x00010411, 0x01160900,
+    0xed03fae0, 0xf61f0806, 0x091f0d03, 0x24f3fcde, 0xf6e9f6f9, 0xd6fbf51b, 0x1cefff11, 0x02ff091f,
+    0x05f5ef02, 0x21f906ed, 0x25021c03, 0xfc1efa10, 0x37ef0808, 0xecfdddf5, 0x0ae3fc1c, 0xff0b0efd,
+    0xe600170f, 0xfd052011, 0xfacb0f1b, 0xfb240415, 0xca06ff09, 0x031a2ae8, 0xcae224f9, 0x35f7eafa,
+    0xd44110fc, 0x0e1b1707, 0xd1db0823, 0x0addecf2, 0xf5d90cff, 0x0dd50f14, 0xe43019fc, 0x08e7fde9,
+    0x0ae2ef01, 0xf227f00e, 0xec22fd05, 0xfdfdeef6, 0x03d8daeb, 0xec15fcf3, 0x13e8e40c, 0x09e7ebf0,
+    0x0a050417, 0xdedb08f8, 0x200aee05, 0x012df4f2, 0xfb1afafd, 0xf20fd325, 0x15f00623, 0x180be5ef,
+    0xe40818e8, 0x16ebfcfc, 0xe90af9fc, 0xd007e519, 0xee0809f2, 0xd8f90fed, 0xf1f607e1, 0x24ce2c0d,
+    0x111cf8ff, 0x0bfef5ec, 0xddf2ee02, 0xfeed1104, 0xf305241e, 0x09e804fa, 0x0cfc2519, 0xd5d3f004,
+    0x132b0afc, 0xf90222fe, 0x032b11ed, 0xff12e108, 0xfdf9fafb, 0xf4ed02f9, 0x01e71303, 0x0f190a14,
+    0xffd3fb0b, 0xfc10fb03, 0xf4e7f9ff, 0x05fefdfc, 0x05edef06, 0x151a0907, 0x08f4feef, 0x0afb0df1,
+    0x07010301, 0xf0080eed, 0x08f900f0, 0xecffff04, 0x15f10bf9, 0x001ff000, 0x160bfb0d, 0x0bf9f218,
+    0xf7030111, 0xf625f70a, 0xe806fcf5, 0xf71108fd, 0xfbf613ea, 0x001209f8, 0x01130a05, 0xfa0c0f09,
+    0xf50801db, 0x00f41203, 0xd80eed06, 0xee01f0fc, 0xf313f1fb, 0xe70ff0ce, 0xf5e8fce2, 0x06fe1311,
+    0xfb0b0200, 0x12cefffd, 0xf7ffde08, 0xfffb1df3, 0xd80f0927, 0xeceaff18, 0xddfd0128, 0x01f0f90f,
+    0xf8ec05f1, 0xe716fa00, 0xe2f8fb19, 0x2cf6e112, 0x16f50530, 0x0fed30f7, 0x010a0d00, 0xe9f03712,
+    0x01f5e409, 0x0e04e8f0, 0x1803fbf6, 0x20f42b00, 0xfa0be523, 0x0efdfaf9, 0x2f00f71b, 0x0304d305,
+    0x1df805f3, 0x25f1fb34, 0xe70825ed, 0xef0bf7ec, 0x04f908fe, 0xcb00050d, 0xffe80510, 0x38ea5004,
+    0xf600f00a, 0x06f713d7, 0xecfcfd0c, 0xfa29df08, 0xf8fed00d, 0xdae0f7f2, 0xde2126f0, 0xdf010406,
+    0x1af11bf5, 0xfff90104, 0x08fc1907, 0xf7f61bee, 0x10fc0dfc, 0xfc05f915, 0x0b1c010d, 0xfeece50c,
+    0xf90cff0f, 0xfffefc10, 0x02f90a04, 0xf21206f7, 0xff10fde4, 0x0c080ef0, 0x020e09f9, 0x0710f51e,
+    0xfd19f8ea, 0x1e02fdf1, 0xecfc0600, 0xeefa02ec, 0x13ec1408, 0xd80ffae2, 0xf8dffbf3, 0x08e8f608,
+    0xf3210003, 0x00e604ec, 0x04e8e701, 0xeefbfcff, 0x0be5f907, 0x1ae81dff, 0xe6c712ff, 0xeee8f0ea,
+    0xff24fb0e, 0x1923e6f3, 0xe9201402, 0x0c1bf6fa, 0xe705fcf0, 0xf73bf1f5, 0x11100edc, 0x1bf410f4,
+    0xc7ed16fc, 0xfc02d310, 0x0108eb01, 0x20f0edf9, 0x03090e15, 0xfa14c5fa, 0x0f11fcf5, 0x21020c01,
+    0xf5db0a0c, 0xfdfc2a26, 0xee03351d, 0x1c0508d2, 0x06f9ee21, 0x07f60efe, 0xfff40113, 0xe6f0fdff,
+    0x0afcdafd, 0xf0c9ec0e, 0x020b0efc, 0x0f111af0, 0xc7e7031d, 0xcd00062e, 0xd1140d3d, 0x2419e205,
+    0xf7ee2904, 0x0f1831fd, 0xebf92821, 0xf00af5f5, 0xfe011a12, 0xf40408cf, 0xf5e6fbe5, 0x13eff810,
+    0xed290a05, 0x01f8f2f8, 0xf0d8f6f1, 0xecea02d9, 0x05ec113e, 0x0ae41700, 0xd5040001, 0x0adbe2e0,
+    0x00f72604, 0xeff108ee, 0xefff11fc, 0xeb14fa02, 0x00f502fd, 0xf112fcfc, 0x0a0af001, 0x0b030812,
+    0x08f60e12, 0xf002070a, 0x13d20500, 0x0202000e, 0xfafeffe5, 0x0907091e, 0x0d16011c, 0xed0d03f6,
+    0xf0f1ea01, 0x1217f506, 0x1119e3de, 0xc8ffe7fa, 0x1cdb0fee, 0xf307edf9, 0x0ddc07f2, 0xece9f712,
+    0x0b21f4f6, 0xfb09e60a, 0xfd06f8fc, 0xf7051ee3, 0xedfd1c38, 0xc10ce21c, 0x02eeebee, 0x1a010f13,
+    0xfd14fc13, 0x082de9f9, 0x040501e4, 0xd919102f, 0xfcf30feb, 0xdd290219, 0xf8000ee4, 0x160706f9,
+    0xf90019e3, 0x0f1515e7, 0x1708eedb, 0xf22708f6, 0x1e020804, 0xe4f3f01e, 0x24edd8d6, 0xe3fd29f3,
+    0xe2fcf407, 0x1115f123, 0xeb150221, 0x10f3dae9, 0x1ef519fd, 0x16d905c9, 0xea100118, 0x11e003fe,
+    0x22be0ae3, 0x11c2e3f3, 0xd2d9fa15, 0x0b322a40, 0x01fa0b26, 0x35be0345, 0xdd1004f4, 0x1cfb032f,
+    0xfaf7e609, 0x1b050a2c, 0xe90707f9, 0xfb0df324, 0x000a061f, 0x13040508, 0x08100a1c, 0x18e12c0d,
+    0x0e26e803, 0xf907f2fd, 0xeafc1104, 0x0af823f7, 0xd7fc0606, 0x04e9f809, 0x231912fd, 0xeff3d219,
+    0x0f0d0ce4, 0xfe0309e3, 0xffecf0ee, 0xf6e2f414, 0x0a03f6fb, 0x080ae904, 0x0d020c08, 0xfb00de19,
+    0xff0ff312, 0x08f804fa, 0xe708fdf6, 0xd4160206, 0xfffb1f0a, 0x00100108, 0xf905fff4, 0x0f0af605,
+    0x1c0411fb, 0xfce0ee12, 0xf112d30c, 0xfaf7192a, 0xd940eed8, 0x010cf701, 0xe4eff2ec, 0xfde602fc,
+    0x121311fd, 0x2336edfa, 0x0101f306, 0x22d40c25, 0x122702fd, 0x1203ee02, 0xf91409e8, 0x06e2fb2e,
+    0xf8f90bdf, 0xcfe3f2eb, 0x0de7dc07, 0x049af013, 0x070c2503, 0x46e3e121, 0xf50618fe, 0x141409f7,
+    0x1ddd3ae7, 0x15ffe209, 0x0dfb11e4, 0x0d051611, 0xdcfd100c, 0xfa0c2b24, 0xe102f6f1, 0xfbf41d04,
+    0x0f0318e1, 0xfffeed11, 0xf117e7f9, 0x02150124, 0xec11ff04, 0xf500f4fa, 0xfe00f0fe, 0xfc10fd0b,
+    0x05faf8fe, 0x00fb0e03, 0xe92bff0a, 0x11fd0103, 0x0ef200e3, 0x0810fe02, 0xfafefb01, 0x0a010308,
+    0xfbe7e61c, 0xf20fdb0c, 0xf8ddedf8, 0xf7161d24, 0xe103f622, 0xebef3115, 0x13f500f9, 0x0d080ffa,
+    0x061bec09, 0x1304f5fe, 0x2a0ef3e6, 0x10f601f3, 0xeff710f8, 0xf2ec28e5, 0xfbfbf507, 0xd4f207e9,
+    0xf00ff8fc, 0xf305fe1e, 0xeaee200c, 0xe522e41e, 0xc5f5f104, 0xfcfa1cf9, 0x0e020104, 0x34e10bff,
+    0x0d0df801, 0xf8f615d1, 0xffeded11, 0xf30201f2, 0xf112cadd, 0x0edc290c, 0xe9233e26, 0xf4ee02f6,
+    0x13071406, 0x04fd0ffd, 0x020606e3, 0xf804fafc, 0x0ee80100, 0xf30ffbff, 0x0703fef8, 0x12fb0e0f,
+    0x07fcfc0d, 0xf113f706, 0xfefafcf8, 0xfef60eff, 0xeff11303, 0x051300fe, 0xf60bfa05, 0x0e07ff04,
+    0xf2080ce0, 0xf1f01c0b, 0x0002e5eb, 0x1c03fa19, 0x1ffef711, 0x11f4f804, 0xedff0b06, 0xf0e9130a,
+    0xd302f8f9, 0xf11716e1, 0xe131110e, 0x17f7fc0a, 0xece2350b, 0xde05fcf3, 0x17f10e0d, 0x1506f2fc,
+    0xfdf004f2, 0xf0fc12f9, 0x0bdbf6fd, 0xfe01f90b, 0xfa0bee10, 0x0f04ec09, 0x240f1726, 0x09111415,
+    0xfd1907ff, 0xf7e503fb, 0xfd0007fd, 0xe205fcff, 0xf1000501, 0xf50e020a, 0x002d0114, 0x0011f8f3,
+    0xf5f9ebfe, 0xcd46f4fe, 0x0c25f112, 0x19f60614, 0xf71e07fb, 0x0b33fc05, 0x09010eda, 0xecedd8ef,
+    0x00e61cea, 0xef1907e9, 0x0031cbe4, 0x08110718, 0xeb0111ea, 0xec03f538, 0x070b0c00, 0xf516f200,
+    0x06f203fa, 0xfb0ce815, 0xdde2dae1, 0xd3daf6e1, 0x1fcf3822, 0xfe0c30fd, 0x0a1be044, 0x32040b00,
+    0x22eaf1fa, 0x1fd3f30a, 0x06f22b0c, 0x14fbffed, 0x08f30bea, 0x01f7ebea, 0xed1bff07, 0x18e51610,
+    0x2afc0cf3, 0xe8f6f6ed, 0xf3f302f9, 0xeb06ee0b, 0xf9e50405, 0x02093bfd, 0xf617ebfb, 0xf804fff4,
+    0xf6dd03f9, 0xfdf217f6, 0x0ce7f10e, 0x16f1fa1b, 0xed0714f5, 0x0503e806, 0x0fed073c, 0x1c1bfddf,
+    0xff06ee16, 0xe106f0f2, 0xfaf3f9f9, 0x34fd0a04, 0xf9040f11, 0x08040502, 0x0611e119, 0xf218f709,
+    0xedf3f404, 0x18d60cf1, 0x0d03f7eb, 0x070bfff5, 0x01f60c05, 0x1afae706, 0x0913edfe, 0xfaf8e309,
+    0xeaf40d04, 0xef0e34f1, 0xfff8f0fd, 0xe600e81b, 0x161c1ce6, 0x10ee2009, 0xf7031dfd, 0xf200e70c,
+    0x16d8f8fa, 0x1a1a29ee, 0xe1ca2005, 0x021dfaf8, 0x2af0f0d3, 0xf50604fe, 0x2c19e9e0, 0xe3f92406,
+    0x2aee01fd, 0xf4f8fa14, 0x0c1debed, 0xf2030119, 0x0a000309, 0xf6cd3306, 0x1aee1110, 0x041eee0d,
+    0xfbf5f401, 0x10080101, 0xf5f7f9e8, 0x03200017, 0x10d6e305, 0xea0af21e, 0xe108fff4, 0x1a0bf7f1,
+    0x2cf1f40a, 0xcc520cf5, 0x00e53f15, 0xf818d023, 0x0e0f0cf7, 0x22222406, 0x02203bf1, 0x0ee7fbf6,
+    0xf5e805ea, 0x0f061703, 0xdf0f06f5, 0x0801fe0f, 0x2710fe0f, 0xeb04feef, 0x1b32f5fb, 0x151a3405,
+    0xffa4e60f, 0xeffd2e02, 0xeec6ece8, 0xeff6e61f, 0x350d2036, 0x0b2404f1, 0xedfdf413, 0x09da0df2,
+    0xf61cf0f6, 0xf8f7ee08, 0x14c70328, 0x02cd0b00, 0x14ee2225, 0x08ce1501, 0xe6f20812, 0xf8f110f7,
+    0x07fd1f0a, 0x08f90af5, 0xf50f04e8, 0xf00ef80c, 0xf7e90cf7, 0xe814f901, 0x12faeef5, 0x13012415,
+    0x0bf7fe12, 0xf806f204, 0xf7f007f5, 0xff010a01, 0xf0f70400, 0x04110608, 0xf916f804, 0x0bff0200,
+    0xedfd0ce4, 0x0a0af608, 0xf7ec07ff, 0x0605f302, 0x410c07ec, 0xeaf0fce5, 0xe5e6e9e0, 0xf5f3ee00,
+    0xd0e81800, 0xec0317ee, 0xfbeef603, 0x230d00f3, 0x08e0ee07, 0x0700f413, 0xf5f800ed, 0xfb0ce502,
+    0xea08fb0c, 0xea06f609, 0xf506f3f9, 0xe814f712, 0xeee7f509, 0x01f20505, 0xf8f0f317, 0x1110fb02,
+    0xef1af205, 0xf8f719ce, 0x0009260b, 0xdf1bfefe, 0xfefc0ae9, 0x170d1404, 0x0501fef4, 0x09ed0df9,
+    0xdffef9ff, 0x10091bf4, 0x0d08f6f5, 0x03eaf5f3, 0xfb0bdefa, 0x2814fcfe, 0x25fff8fe, 0xfdeff610,
+    0x36fbf1ed, 0x2404dff3, 0x1f1cfdf4, 0x03ecfb07, 0xcc212403, 0xe7f1fee3, 0xf2e9f3eb, 0x12d4192a,
+    0xfd251af0, 0x012afd04, 0x1106c4e5, 0xda1fea1d, 0x23dad2fe, 0xf7d520f5, 0x03fa3232, 0xe824120e,
+    0x08212deb, 0xfc1201ee, 0xf4c3e5e1, 0xecfd1f4e, 0x09e1eaf7, 0x07d80a1b, 0x25f2f305, 0xe7fc02e6,
+    0x0003d90a, 0xf8e4d9ee, 0x09ece8fc, 0x1be91914, 0xfff007ee, 0xf0100515, 0xf71a0a02, 0x0e15250b,
+    0x02ff11fd, 0x201613be, 0x15063dde, 0xee1f1313, 0xf406d9df, 0x20fbe9fd, 0x18ff1306, 0x08fa13f1,
+    0xe503f7f4, 0x1312071c, 0xfafa1aed, 0xff07030a, 0x27fc0409, 0xf1e61307, 0x040c18f2, 0x11ebf30f,
+    0x0f12f408, 0xef10fe10, 0xfeed0408, 0x01fc0603, 0xf00608e9, 0xfd03030b, 0xe6fb0a00, 0x040a0b0f,
+    0xf5070cfd, 0xdd263f06, 0xffc6defb, 0xdf12e516, 0xfa16ed1f, 0x03bb0aee, 0x020d1b1f, 0x0d01fd19,
+    0x30df17ec, 0x180611fb, 0xe1e301ef, 0x010f0af0, 0x24e8def0, 0xe7f20e07, 0xf701ddf8, 0x030a13f0,
+    0x0c17e702, 0xeff4eefd, 0xf5df13ff, 0xf01a192c, 0xd92f10fe, 0xfb0dfc2f, 0x10fbf0ea, 0x0ff5f903,
+    0xec0b13f8, 0x19ecf3ff, 0x1bf7f9fd, 0x2011fbf1, 0xddfee605, 0x06f206eb, 0xf902f2f0, 0x13fb1b0b,
+    0xefee0e0a, 0xf40c0015, 0xee15ffed, 0xe621cdff, 0xf0d9f404, 0x091914d6, 0xffe2011e, 0x0ff506ff,
+    0x13f8ed13, 0x0e1bf3e0, 0x04edfd1f, 0xf0edff04, 0xe51207fd, 0x0609fe10, 0x0fea0d1b, 0x00d30c01,
+    0x13060207, 0xd6e918fc, 0x1404fef1, 0x13f1ec04, 0x1409000b, 0xffe9ff0e, 0xfae5000f, 0x0d0b1f05,
+    0xedd4fcf4, 0x16190de2, 0x0105e6f7, 0x1c12eb1a, 0x11ed1b36, 0xfc12fdef, 0xecdff3e2, 0x0aff0fe8,
+    0xf6002116, 0x06ed0307, 0xfbf1f40c, 0x15f11a17, 0x162c040b, 0xfdf8bd0d, 0xf1fbe9fc, 0xf6f7f71d,
+    0xee250101, 0x1ee81d01, 0xf6e11e10, 0x0507f808, 0x00fb0214, 0x1afcf809, 0xf409e501, 0x1304df1d,
+    0xfedd19f3, 0xf3f6f10d, 0xea28c50c, 0x02ef1820, 0xf00316fd, 0xdf0bda19, 0x03fefb05, 0x171d09f2,
+    0x022df9f7, 0x14ea00f2, 0x1c060c16, 0xf72a2f0b, 0xf70d0409, 0x0402fe04, 0x03ce1016, 0xecfd0514,
+    0xdf0e03ec, 0xec1202ef, 0x09f8ca05, 0xf4cee3ee, 0x060d0826, 0x03f90c02, 0x24ee41bc, 0x0e011801,
+    0x1217130b, 0x05f3230e, 0xc3081105, 0xf71efb2d, 0x18eff00c, 0xe50811f7, 0xf81b3108, 0xf10b2ddf,
+    0x1aebfef3, 0x04fc280b, 0xf712ee03, 0xf1def303, 0x0e2de8f3, 0xe909cf15, 0xde013ce3, 0x2000f0fb,
+    0x11f81cf7, 0xf40c071f, 0xfe0f2336, 0x09edff0d, 0x01f214fe, 0xdd010a0f, 0x1e05f12c, 0xd80f2608,
+    0x11c7fff5, 0x1200e202, 0xfce410f5, 0xfcf001eb, 0x17f310fe, 0x010036f1, 0xcffff024, 0x1c10f902,
+    0xfdb90211, 0x401807fa, 0x0bfcfeea, 0x2cf20cd9, 0xedf802ec, 0x0e01fcfd, 0x0cfe12ee, 0xedd1fe1d,
+    0x220500ee, 0xdb02f83c, 0xda0de21f, 0x070affe7, 0xe7faecde, 0xfa0d11c3, 0x06d7f427, 0xf7e6ff01,
+    0x06121f05, 0x0c150309, 0xe31fe91f, 0x11def8f5, 0xf506e40d, 0xf7eb091a, 0xe8190b27, 0xf5f7da1b,
+    0xe0e807cf, 0x22e9f707, 0xf40a2df8, 0xd4da0d22, 0xfd1705f6, 0xdde431fd, 0xe9fbe7dc, 0x1a08fef2,
+    0xfdd5060a, 0x0915fb06, 0x24fc22f1, 0x14fa10e8, 0x08281500, 0xe608f2fc, 0x15eff2e3, 0x1be01706,
+    0x09050305, 0x04f90c0a, 0xf622eb0d, 0x151cf61e, 0xcbf6ff12, 0x12ef15fc, 0x03e508f5, 0x01100905,
+    0x270ff706, 0xfc04e9fc, 0x01f80612, 0xf2020a12, 0xe2fb0510, 0x09030c0d, 0xf4efe7f0, 0x00e6faec,
+    0xeeecfa08, 0xfc2106cc, 0xfbd0ef15, 0x0bf7e211, 0xf00dfc10, 0x09dd0e02, 0x0f0819d7, 0x41fee2ce,
+    0x31eff1e5, 0xddf8f3f4, 0xf51611e5, 0xec16f409, 0x0a00f7ec, 0xe913fcd3, 0xedf7fd14, 0x20f933d6,
+    0x21f830f9, 0xf3faf40e, 0x0bfbf5fb, 0xfcf8f8fa, 0xfff70af8, 0x02faf206, 0x15f6fc1a, 0x0a00f418,
+    0x01f9fd11, 0xf900ff0e, 0xeb11fe13, 0xfaf90708, 0x16e8f7f4, 0x031512e5, 0xf1160a03, 0x17180405,
+    0x0d0aede9, 0x1ff6f507, 0x0bfbfcfe, 0x21f1f621, 0xfe150ef1, 0xfaf91108, 0x06eb0d14, 0xf70d0dfa,
+    0xfa13faee, 0xfcd9f9fd, 0x061d1f0b, 0xf0ecebe3, 0xe20df0ff, 0xe70defff, 0x0cf7faf3, 0xfcfd02f4,
+    0xfe0e0121, 0xf60d08f8, 0xfff3eff0, 0x08100e03, 0x14f92107, 0x0c121df6, 0x0b1bfe1b, 0xfffad610,
+    0xf7f2e004, 0x0cffffed, 0xf616ed03, 0xfc0108e6, 0xf5e9f4df, 0x0c010cf0, 0x06f9fd00, 0x06eefd11,
+    0x0c0b03fb, 0xf903160f, 0x1ef014f7, 0x10f106f1, 0x12f40301, 0xf1f60701, 0x06ec0a03, 0x0f020c08,
+    0xfffb060a, 0x0716f4fc, 0xfd0cf5ea, 0x020715f1, 0xfcf90c0b, 0xf7080e00, 0xeefe0107, 0xf3020b05,
+    0xe70c06dd, 0xef0702f9, 0x17f70402, 0x1ce4f40e, 0xf619d3f7, 0xeb0711f2, 0xf1ddecfe, 0x05f0ec17,
+    0x04ee0903, 0x0dff1dde, 0x23fd12e9, 0x03f2f126, 0x09fa21e8, 0x02fb101c, 0x060df901, 0x0008e6ea,
+    0xfc050d11, 0xd9011433, 0xde2a2925, 0x17fb18e1, 0xeb1dfefb, 0x08000fe4, 0x0fd9f018, 0x1cd7e7f2,
+    0x2fe002eb, 0x0cfe01fc, 0xfc0dfb09, 0x140ae102, 0x0116ebfa, 0x01fbfa2c, 0xc10f0d10, 0x2209f61b,
+    0xedef36fb, 0x07fcfff3, 0xfbdc00f9, 0xf60ffe09, 0xfc0d08f7, 0x0afe0308, 0x1407fc09, 0x18001614,
+    0xf1fb0116, 0x0207f908, 0xe6e7dd0a, 0x121304f4, 0xf7f909fc, 0xef14fef2, 0x0017f207, 0xe6000110,
+    0xf9f1f1f5, 0x17ee151b, 0xe3ebde09, 0xc8cc0d01, 0x120ae420, 0xf1ea10e2, 0xfadff906, 0xf4f8f81f,
+    0x0c2a0a1f, 0x05f7ea06, 0xefd91ff6, 0xebe825ed, 0xe3001001, 0x1bf52315, 0xf2f50d0d, 0x1cebebf6,
+    0x0412fc1d, 0x0d12e8f2, 0x0c0315fd, 0x01ff0708, 0xdbfd17f2, 0xf316160f, 0x15e8f308, 0x072febfd,
+    0xec150ff6, 0x14fd03fd, 0x140612dc, 0xf0fbde02, 0xd9f7fae9, 0xf410e905, 0xe4fbfffd, 0x1302fbed,
+    0xfa041707, 0x04f1f114, 0x2b1e21cd, 0xe1f9ef01, 0x04f3f1f3, 0xed0de207, 0xe2eafc00, 0x0b130fec,
+    0xfa171ce9, 0xef0205eb, 0x09170309, 0xf8fc13ed, 0x090b2ef4, 0xf4fdfe24, 0x01f1f7ee, 0xf0ff29e6,
+    0xdefc0704, 0x1111f218, 0xfc13fb02, 0x05fdfc25, 0x28f7fb06, 0xfef517f1, 0xf5fe14d4, 0x13f8edf3,
+    0x07d50a05, 0xfa0618f5, 0x090e081d, 0x06fc0d3e, 0xf7f63601, 0xf4fbf614, 0xfaec0b0e, 0xd2fe17f7,
+    0xf0ebe013, 0xfbdb1f08, 0xee0ef5eb, 0x0520fbf9, 0xfa1afa14, 0x09d7eff4, 0x0901f7ea, 0xfb02fd12,
+    0xfcdff515, 0x19df15df, 0x0ec8f913, 0xf208111f, 0x1312da13, 0x0e02f0f6, 0x0df90b08, 0x25ed0805,
+    0x19fce20e, 0xedfd2a11, 0xe6e7ee16, 0xf715d4fe, 0x311604f8, 0xf90519e0, 0xf9ebed00, 0xd8decefd,
+    0x1b14fcf0, 0xd60f1adf, 0x03bdda2b, 0x1fdeff0d, 0x14e5f6fe, 0xe5d71ada, 0xebeadf34, 0x0811fa01,
+    0x1ef614ef, 0x0404dc1d, 0xeef42013, 0x10fd19f7, 0x03f4fdfb, 0xe1effa07, 0xfde4fdfe, 0x0cf907fe,
+    0xf0e5040d, 0x27100012, 0x08eb1b0f, 0xfa2af3e8, 0x05f3f818, 0xef0204fe, 0xf0f0fbe6, 0x11012116,
+    0xfdfe1110, 0xf210010d, 0xc9e6cc06, 0xe9fcecf3, 0x19d62825, 0xf31c17d1, 0x222c1d0a, 0xfbc910f4,
+    0x19f6f8fb, 0x1fe9fdf1, 0xeb00f83b, 0x032600f3, 0x15f1df03, 0xe6bd1b0d, 0xe4151943, 0xc7f01e07,
+    0x0cfbf403, 0x01fc3919, 0x02164a1a, 0xecece904, 0xe1f0b3e6, 0x01f4ec1c, 0x120d163b, 0x1a260910,
+    0xfc144901, 0x10f61110, 0x16132802, 0xcef8e236, 0x0233081b, 0xf1f1e9e9, 0xfb34fa25, 0x0913fdf5,
+    0xe7d9fed8, 0x1102f116, 0xd303dae8, 0xfa09080a, 0x1803efed, 0xf414faef, 0xdce3f406, 0xfcee0901,
+    0xe1e8ec0d, 0x35f412f8, 0xf412ff08, 0x15fcfbe6, 0xf9ed170d, 0xf7f9e81b, 0x02060cf3, 0xf3fcfe1b,
+    0x00e6fe0b, 0x1a23160f, 0x07d8ecfb, 0xfd05160f, 0xfb260809, 0xe10009fe, 0x1312f9f9, 0x11f20619,
+    0xc60519f4, 0x38000aff, 0xef1cfaf9, 0x2a17f608, 0xf0ef1605, 0xd4e2d0f3, 0x0b021433, 0x17e1121a,
+    0x050503e8, 0xf036ffe9, 0x1214f506, 0x26f4f5f2, 0x26fa0ff3, 0x0ef70bf5, 0x060418fb, 0x1814e907,
+    0xed00f20c, 0x0ef04306, 0xdbf7e9d8, 0xf206e22b, 0x30f4f734, 0x0106e82d, 0xee121fea, 0xf8191206,
+    0x2deaeb17, 0xfce7d6fa, 0xe9f6f211, 0xf7e5fe03, 0x12092bd6, 0xe81809eb, 0x12dff610, 0xf4e72011,
+    0xf212f808, 0x1e09e701, 0xeaf2f823, 0xf7ed0504, 0xf0edeb11, 0x10fe1cfe, 0xd70c000d, 0xfef0ef0f,
+    0x0a0df6ff, 0x140501f5, 0xee1205fd, 0xe00efee5, 0xde1c23e4, 0xf30706d4, 0x22e7d8fa, 0x10f3eb04,
+    0x0afe1706, 0xfcf3f4f9, 0xfa03ee0a, 0x210bdf1e, 0x0616e4f7, 0x0402effc, 0xd10c1125, 0xf2f7fd10,
+    0x0106f900, 0xe9000120, 0x061e040c, 0x180de206, 0xedf60100, 0x17d725fb, 0xfce61d0e, 0x0b0c21ff,
+    0xf709fc0b, 0xe714eb05, 0xe30502f8, 0x23031303, 0xfcfded0b, 0x0e070808, 0xf604010c, 0x071fe4f6,
+    0xee0506ff, 0x060c10eb, 0x1a0fdc02, 0xc7fef413, 0x180f25f9, 0x19f9fb09, 0x09faeb15, 0x0820fff7,
+    0xf80729dd, 0x0c16e206, 0xedf1eee3, 0x1809100c, 0xebf5191b, 0xdc10befb, 0xea00f10e, 0x04050c0f,
+    0x03fb23ea, 0xf8fc08f8, 0x040b0cef, 0xf4f80009, 0x09f3fcf6, 0xec12ed0b, 0x0f00f405, 0x05f90012,
+    0x09fbff0d, 0xf411f90d, 0x05f606f7, 0x00fb0c12, 0xf4fe15f0, 0x0d110608, 0x0610fe0c, 0x0505f908,
+    0xeefc02df, 0x06f61ed5, 0xef0d0efa, 0x041c0e11, 0xe3f417f2, 0xe607f906, 0x2303f6f9, 0x0609f513,
+    0x18f9e00f, 0xf3fdf30e, 0xf6e0fef5, 0xe00e13e0, 0xfcfc000d, 0x0b1613fe, 0xf209e101, 0x0601fc12,
+    0xf2f51cf1, 0xe62016e2, 0x100c07f4, 0xde07ed12, 0xed1ae9e9, 0xf40bf1fd, 0x09dc0cf4, 0xf2120ffd,
+    0xd60521d2, 0x000b34fa, 0xf3edfbe2, 0x0100f134, 0xf9f9fbff, 0xd7f4de01, 0x13140609, 0x0afb26e5,
+    0x05ed0cf5, 0xe6e90c0c, 0xea190656, 0x20f70405, 0xff07f719, 0x1bfc36f3, 0x000f18f1, 0xd9df16f6,
+    0xfb09f610, 0x09210208, 0xe7d92008, 0x39fb1b4d, 0xed04f4ea, 0x25e205fd, 0x0b2b0937, 0x21f9fb0b,
+    0x30c1fafe, 0x25fce5d3, 0xfcffeede, 0xf1e8ccff, 0xe3e111e6, 0x051dec15, 0xe0e0fc27, 0x111d1912,
+    0xe2e6f41d, 0x2fd8dcfd, 0x10091f04, 0x08031a0e, 0xcff61123, 0x1215df1c, 0x1d05f207, 0xe6d732ed,
+    0xecd60407, 0x0c1a0804, 0xe308e000, 0xef101422, 0xfc18ff00, 0xf3e8f80a, 0x1701eee9, 0x0608d9f4,
+    0x191105ff, 0xe9e312e6, 0x0cf409f3, 0xf51c061e, 0xef18fce4, 0xfa07d409, 0x0b02020e, 0x03ee0f0c,
+    0xfeee1efe, 0xff2e0810, 0x040300f6, 0x2215edf2, 0x20fbeb15, 0x09f507eb, 0xf7f2e316, 0xe80e220f,
+    0xd7f9e5fe, 0xeedb24fd, 0xe430f1ed, 0xfb1d2d10, 0x1ae0fa3b, 0xf6eee9f8, 0x1c05f110, 0xef00d7f0,
+    0xf2ebe0f5, 0x09f920ff, 0x010a11dd, 0xd100e802, 0x2905fef9, 0xfd03f800, 0xe9f1f625, 0x1afede04,
+    0xea0306fc, 0xff2410e5, 0xefefe3f8, 0xfd0c0cf5, 0xe00622f4, 0xf7fce80d, 0xfee2261f, 0x1ef10a0b,
+    0x1c150cf5, 0xf409f9e9, 0xef1df10b, 0xed0c061b, 0xe2fe21f5, 0x07e410f0, 0x12e411f2, 0xf716ea05,
+    0x1618ee03, 0x17ebf1ef, 0xeeea09e9, 0xeb1f2ef0, 0xf80c0c13, 0xf9130406, 0xe203df0f, 0xfcdd1b14,
+    0xfcef0807, 0x021c0109, 0x0fded8e5, 0xfa100c27, 0xe021f825, 0xfd0d0902, 0x32ecf406, 0x18070be0,
+    0x063110ff, 0xdffb05dc, 0x0a29cce2, 0x03e30109, 0xfee80b06, 0xcbfdfffa, 0x0207031e, 0xdaebf5c1,
+    0xe70707cc, 0x1afd0006, 0x19100fdf, 0x09100dfa, 0x00e8ffee, 0xf91cd4f4, 0xfbdaf728, 0x080e00ff,
+    0xf8170bd2, 0x16110be0, 0x150015ef, 0xeef9df08, 0xd8021b0b, 0x1202f93a, 0xe7de00eb, 0x10ef0a14,
+    0xe11f0dfc, 0xeef5e604, 0xe7fc14fa, 0xfe1c00fb, 0xd5f10003, 0x1312f316, 0xf6f0ed12, 0x05f615eb,
+    0xfa00eef3, 0x03ecf1f2, 0x212af411, 0x0a1a00dc, 0xe2fb1531, 0xfb01f41a, 0xf001e507, 0x12f4f20b,
+    0xd9f62afb, 0xef05f508, 0xfc0df401, 0xfb06f60a, 0xf4f3f801, 0xe9140cf9, 0x11e7e611, 0x0805010e,
+    0x18eaf714, 0xfb09fd08, 0x09f60b06, 0x08f3081a, 0x19e707f2, 0x19181405, 0x0405070f, 0xfd06fdf3,
+    0xf902e90b, 0xef1134fe, 0x3b100303, 0x1efaebd3, 0x1c3def1a, 0x0a04e007, 0x1ce4f5f8, 0xe212f9ff,
+    0xfdfef10a, 0xe9d6fbfa, 0x13f9f002, 0xee071b3e, 0x08e92c27, 0xd40de107, 0x0a03ff31, 0xd50dd8d9,
+    0x16011ce9, 0xd6fffcea, 0x111cf726, 0xfcf70602, 0xf9e401ec, 0x14f30d19, 0x141d0e35, 0xde1d0d06,
+    0x091411f6, 0x1e15ec12, 0xfa0b0cfa, 0x01302fe6, 0xf51d1dfd, 0xf01af21a, 0x2afbf031, 0x07fb2d11,
+    0xcce705f5, 0xd30604ee, 0x140f0dee, 0xe7efeb05, 0xedf1dee8, 0x1306fd06, 0xf2fb0dfa, 0xeefbf217,
+    0x04fbfb05, 0x0307fd08, 0x06fcf1f7, 0xf4f2f5f6, 0xfb081dfd, 0x050afc1b, 0x27110906, 0x13f4f810,
+    0x26180b1e, 0x06f319f5, 0xfec2000b, 0x2215040b, 0x181e0101, 0x13f10617, 0xfa0af1f7, 0x0a00e70c,
+    0xedea170d, 0x02011ce7, 0x0716f608, 0x190efd04, 0xda07f9e7, 0x15fddb0e, 0x06e21d16, 0xd8160905,
+    0xed01ff07, 0xdd1b1ffc, 0x19fd1cf3, 0xea20ddf7, 0xdcf7f125, 0x12cf06f6, 0xf3eafdfb, 0xe712f40c,
+    0xe8dafcee, 0xf7162af2, 0xce2106f2, 0xf524c8e6, 0x17e1d9ee, 0xf40019dc, 0xdafefcf7, 0x3506f5d2,
+    0x12f21e0c, 0x00ef102a, 0xe701fafa, 0xf91f05ef, 0x02f4db1f, 0xebf23aa9, 0xfb07fe00, 0xf8fd0b09,
+    0xe9f400f7, 0x15fa1cde, 0xddfb090b, 0x182af2d4, 0x11dc06e9, 0x02d4e7ec, 0xfd21f31a, 0x1eeae9f4,
+    0x0ee4f2f5, 0x1b1ef904, 0xe9ec12e9, 0xde09040c, 0xf1150212, 0xfaf21fff, 0x06f2fefe, 0x00f60b0c,
+    0x16f6eb04, 0xf309fc06, 0xe3e41af6, 0x1dedff20, 0x2500ebe9, 0xfff7edeb, 0xf5260dfa, 0x290106fb,
+    0x0fede530, 0xe41efcec, 0x1613f6eb, 0x00f3f9f1, 0x20000402, 0x0cfbef11, 0x2cfe121c, 0xd220eef4,
+    0xf4eae0e3, 0x14eee2e9, 0x1af1fde8, 0xf44901ff, 0x23f01b2b, 0xba18cbe9, 0xe7ebcf01, 0x0d0e3ff1,
+    0xeae823f3, 0x170e0724, 0x18f403fb, 0x06ee17f2, 0x0e13fd0b, 0x0febf417, 0x00f106fb, 0xfaebf31e,
+    0xf2fa0103, 0x0b10f6f9, 0xfb21fd02, 0x05050c0c, 0xc910ffed, 0xe9fff2ec, 0xf1f00ef9, 0x29050a21,
+    0x030ef9fa, 0x081e38fa, 0x03f5db13, 0x1708ff00, 0x3c2306e8, 0x04f4fbe6, 0xf40b0f2c, 0x04060d05,
+    0x271715ec, 0x12fafef4, 0xfdb40504, 0xf2040739, 0x1b06ebec, 0x13f7f810, 0xfc1ce5fe, 0xc9fa1723,
+    0xffeb0fe7, 0x140cf1fe, 0x0d0be70b, 0x07eced1c, 0x0429fef0, 0xf7f81cfc, 0xfdf2fe08, 0xdd0ef9e8,
+    0xe50ff4e1, 0x08ce06e8, 0x061b250e, 0x09fbe8ee, 0xf22be7e9, 0xd80bf105, 0x12f0fbff, 0xebfc0602,
+    0x06172313, 0x14e7f015, 0xe40300df, 0xf820fe18, 0xddf50001, 0xf113f407, 0xe30bf909, 0x2deb2f06,
+    0xfc0beff1, 0x0af828e3, 0xe60efc06, 0x09f1de20, 0xfe07fb08, 0x0dfee711, 0x251c1ef2, 0xece0e30f,
+    0x0bfa15f7, 0x09fa3421, 0xfd0df409, 0x10f501d9, 0x26f9f607, 0xff1801ee, 0x06fb0410, 0xf8e90002,
+    0x190cf304, 0xf8041701, 0xf2e9f619, 0x0206eb2f, 0x02e5e3fb, 0xe6f8e6fa, 0xf203ff0d, 0xf500f802,
+    0x0edb35e5, 0x1915171a, 0xfd1e040f, 0xfae115ed, 0xf914f8fe, 0xf7190401, 0xf5e5131a, 0x1dfbf802,
+    0x120efde5, 0x1bd9f7fc, 0xfceb1b00, 0xf40b0be9, 0xd8e90004, 0xe3e8fa0d, 0xe10423fc, 0x0cee0804,
+    0x02f129fb, 0xfe15fbf9, 0x0e0bf705, 0xe808f11a, 0xee180904, 0xff030f0a, 0x0bdfd7fa, 0xfd0214fe,
+    0xd2f4ebe8, 0x3101f1c4, 0x13f11cee, 0x2a17041f, 0xdaeb08eb, 0xe901ed0b, 0x12fc1500, 0x21eb1517,
+    0xfb082eee, 0x05ff100c, 0x03f00df3, 0x2df9071e, 0x13030004, 0xe3f7fffe, 0xfef003f2, 0x08fe1319,
+    0x0afbf911, 0x030efd10, 0xfe0bf8ff, 0x07dd0e10, 0x0be40500, 0x140b1e0a, 0xf501f7f7, 0x080bf807,
+    0xe7eff5fa, 0xfbd00aff, 0xfddb02fa, 0xe0fd0ef6, 0x19f51c2f, 0x4107fedc, 0xee1601f1, 0xf0f52f16,
+    0xeb020d0c, 0x18f9e4e1, 0xeed61f09, 0x14dded18, 0xfb000f2b, 0x1ff2fa1d, 0xe61317fb, 0x1ff740e8,
+    0xf0dddb34, 0xe9f718e7, 0x2f1e08fd, 0x10f80b0d, 0x0224fffb, 0xf2f3f717, 0x04e812ed, 0xd01fedf3,
+    0xef070df0, 0x07071b04, 0xefecf4e6, 0xffeae438, 0x06030503, 0xf309f70d, 0x21d8f904, 0xfe15eee1,
+    0x0103fc16, 0xe6000409, 0x25e5fe10, 0x03e6280b, 0xdf4bf00e, 0xed0b1426, 0x22cff4ec, 0x0a0c0717,
+    0xf8251902, 0x0212f304, 0x1905fee6, 0x05f40c05, 0xe80af6ef, 0xcb14f1f4, 0xe7fd2423, 0x090afff9,
+    0x100b17ff, 0x04ecef01, 0x180a32e7, 0xcd04f9ee, 0xe2f305fe, 0xfd011ff8, 0xf7e9eb15, 0x04140be9,
+    0xedf205fd, 0xff19e908, 0x1410fcf7, 0x18f805eb, 0xeb0f1d0b, 0xf0fefcf9, 0xfaf6f112, 0xe1e00afd,
+    0xee1209f7, 0x06200406, 0xee051418, 0xfcf501d4, 0x0dd72a08, 0xf41f0cf5, 0x1e08e416, 0x1e0114fe,
+    0xeefae6fa, 0xfbe4e50b, 0x19de0114, 0xe408f903, 0x00f70124, 0x00fdde13, 0xe308292a, 0x0ef7e905,
+    0x240818fd, 0x12ef1200, 0xfbd01dfa, 0x17150e0c, 0x29fb1103, 0x08e6fa06, 0xfb0e03f3, 0x1ded1f0f,
+    0xe80bff0c, 0xf31d1002, 0xf4e2f509, 0xfc0df502, 0xdf130ff4, 0x00fe000a, 0xeeeffd08, 0xef110b18,
+    0xedff09fe, 0xffe608f9, 0xee180a14, 0xfbfb0624, 0x0012ff0b, 0xf6fd1df9, 0x0206e100, 0xfc060bef,
+    0xf2e0f1e8, 0x11f2f8ea, 0x310def08, 0x0c110502, 0x04210513, 0x0005e803, 0xfbc10c0d, 0x1a02ed22,
+    0x1524020f, 0xf218f70a, 0x08edeaf3, 0x26ef0b17, 0xfc230c0f, 0xe227fd13, 0x09f5f8ff, 0xfc10f204,
+    0x0b0bfaf6, 0x2900fff3, 0x111b1b0d, 0xf4e1fd05, 0x0be11bfd, 0x0bf20b0a, 0xe5e204f4, 0xfcfa1612,
+    0xefed0019, 0x13f2faf3, 0xf1123a1d, 0x08f405f7, 0xda05f9f7, 0xf1fdfa18, 0x0afbfedd, 0xf6de1700,
+    0x00f717fb, 0x12050302, 0x0f393501, 0x1c07f110, 0xed2909e7, 0x00e718df, 0xfde90920, 0x04fb180c,
+    0xd7f823dd, 0x07f5fe06, 0x0cf8f4ef, 0x10ea0b1e, 0xf31d0910, 0xf013021e, 0xfff600f1, 0x0320050e,
+    0xe3f413f8, 0x12f806fc, 0x16ff0bcd, 0x0ee90eec, 0xf4e9e016, 0x0803e3ea, 0x091b09fe, 0x0a0905e1,
+    0x09e0f612, 0x0601fd16, 0xf0f7f206, 0xf0180b07, 0x03fa0008, 0x0cf90ce2, 0x05fde309, 0x0ef9ee0f,
+    0xef2716f9, 0x022122f7, 0xdf13fc06, 0xfdf7e718, 0x0a02f7cd, 0x13fe0dda, 0xf2070b05, 0x14eff4fe,
+    0xeef7fee6, 0xff0406e1, 0x05fc1917, 0xe61e05fa, 0xf4ee0f02, 0x16fb170f, 0xfa08e820, 0x0e24f3df,
+    0xd90e2bf6, 0xf1f5f329, 0x0b0ce4d8, 0x1d10ebed, 0xd2062bd7, 0x0216e730, 0x0108021d, 0xd804f9f7,
+    0xeef415fa, 0x12181afa, 0xef011b04, 0x0908f8fd, 0xe9fac8fb, 0xfeed0ceb, 0xfcfafcf1, 0x2b1ce200,
+    0xf3fe2108, 0xfff621d8, 0x0b220dc3, 0xfa15e9e5, 0xe6060cdd, 0x1df6fdf8, 0x0df3feef, 0x0fd9fce7,
+    0xf50612d0, 0x11f707ff, 0x0bfd0afe, 0x07090307, 0xef1bf601, 0x02e3fff4, 0xedd50ced, 0x101c15eb,
+    0xe20516f6, 0x0203edfe, 0xf329f8de, 0x1606fffa, 0x01fc1112, 0x1207001f, 0xf810eae9, 0xe7faf2ff,
+    0xebec0ef0, 0xfcf412ed, 0xef0f0cf3, 0xfe050c0c, 0xf0ef05fd, 0xe111fe0c, 0x1bffefe8, 0x04fe0614,
+    0x13f4ef16, 0x020aea11, 0xf3f001f8, 0xf5011806, 0xf5ee0500, 0x0d0e13ec, 0xef080112, 0x04fd080a,
+    0xf1fa0bea, 0x13f503f4, 0xf3eedbf3, 0xe1e71ce4, 0x0d150a08, 0xf005fbf8, 0x05eeef16, 0x0cf6e02b,
+    0xde14010e, 0x19eb0c09, 0xeaf8fd19, 0x0c25f6f1, 0x00ed0bf1, 0x0001e5ef, 0xfafc1a10, 0x14edf414,
+    0x140c0315, 0x3a1402c8, 0x07dffaed, 0xedfbf1fa, 0xea11000a, 0x010cf220, 0xfeef0703, 0x0f17f3fc,
+    0xfaf4e128, 0x0fcdd520, 0x260b13f3, 0x04d31107, 0xf0ec2204, 0xec0ce9fb, 0x2804fa1a, 0xd2d129df,
+    0x0ae20824, 0x27f60220, 0x02e40be8, 0x000e2317, 0x0304071a, 0xf5d40318, 0xeef1e6ff, 0x12ff16fc,
+    0x041001f1, 0xe5fd09ff, 0x130606f4, 0x0afa0009, 0xe9070cfa, 0xf700f118, 0xe7d81003, 0x25130602,
+    0xf7071404, 0xe0161707, 0x14322c13, 0x1ef51510, 0x2a2ee729, 0xc1f42c18, 0x2a2c363a, 0x24131f28,
+    0xf90e3335, 0x2f052710, 0x1722e8b0, 0x1be82433, 0x2223c337, 0xb53a1921, 0x2ef9fd25, 0x7323f834,
+    0x2b371e26, 0x22310a2e, 0x15bc402c, 0x202002ad, 0x3a0410eb, 0x283d1f32, 0xd44d1be0, 0x46223c1c,
+    0xea2f1a3a, 0xd1cb6016, 0xf84efa32, 0x4a39316b, 0x1fca292f, 0x37fe0251, 0x451a413f, 0x3929140d,
+    0x3a2f3a1f, 0xf00008fa, 0x0907fcff, 0x05fcf5f2, 0xfcfa00ff, 0xfdf90008, 0x02fd0500, 0x08f80402,
+    0xfd000206, 0x02fb0204, 0x0109fef7, 0x01f8fa03, 0xfe00f804, 0xebf80000, 0xf0f9fef9, 0xd404fe01,
+    0xfa020603, 0x02eef803, 0x02fffa08, 0xfef2fef1, 0x000103f6, 0xdc0807f4, 0xfdfdfdfa, 0xf8fb00fe,
+    0xfe0108fc, 0xebfd000b, 0xfc03f609, 0xe1ff03b8, 0xebfe04dc, 0x0103fd02, 0x00ff04da, 0x04000103,
+    0x04fbff09, 0xfbdcfc02, 0xfd0313ee, 0xfd200804, 0x02f3f2f8, 0x00ec0afe, 0x0803020a, 0xfe10f5eb,
+    0xf0feff01, 0x0401eef3, 0x02fef5fa, 0xebfdf6fc, 0xfdf703ff, 0xfb0403fa, 0xfdecfceb, 0xfaf9f7f2,
+    0xf8cdff06, 0x0504f209, 0xf3f621f9, 0x06f1f403, 0x060802fb, 0xfe04f716, 0xf50bf9ed, 0xf5fe0a09,
+    0x14f9f3f6, 0xfb1708fc, 0xf3021502, 0xf2ff1306, 0x0103ecf6, 0x080408fc, 0xf1fada02, 0x0aed20f0,
+    0xfffa00f9, 0x1c0ff7fc, 0xf90406ff, 0xfeef110b, 0x05f3fb01, 0xfb0715f0, 0xf3f5fe14, 0x00080df6,
+    0xf3fceb04, 0x0505e5f6, 0xf9fdfb0f, 0xf7f90afa, 0x07ddef08, 0x0a08ef0d, 0x0002f3ea, 0x05fffe06,
+    0xfbf800f9, 0x0ef713e8, 0x06eff9ff, 0xd5f6f2f9, 0x0edff81c, 0x0803fd01, 0xfafaf826, 0x10050103,
+    0xfef3f9fd, 0x09f9d3fd, 0xdd0612fb, 0x0feffb00, 0x0cf003fb, 0xe8e309f0, 0x01f60802, 0xf4e9f0f4,
+    0xffeeea02, 0x1103ed08, 0x000606e9, 0xfff0ee04, 0xf3faf7ef, 0x00f806fa, 0xf31a05eb, 0xf9160507,
+    0x00ef01e5, 0x13f6f8ec, 0xedfdf7e6, 0xeff00f0a, 0x11fe04eb, 0x01f3f802, 0x0b0df306, 0x000af807,
+    0x0305f508, 0xfbf4f9f9, 0xf3eb04f0, 0xe500e8ff, 0x06050a0c, 0xf2fdfa0b, 0x130011f4, 0xf30107ef,
+    0xfa1c06fa, 0x1d15d504, 0xf9f31000, 0xeee00309, 0x00e8fc04, 0xe3f706f3, 0xfb0cfff5, 0xedeced14,
+    0xde13fc00, 0xf7f4faf1, 0xf701f503, 0xecf80f09, 0x081debff, 0xeb14fc01, 0x04faf2fd, 0x02f0fd09,
+    0xf2f6f3f4, 0xee1a010f, 0xff05fdff, 0x0f02e40c, 0x0102f900, 0x1f04efff, 0x0701ef09, 0x0bed0006,
+    0xfc01fced, 0x0c07faf6, 0xfe1301ff, 0xc706f503, 0x03e6f601, 0x0cfefdfc, 0xeff5fe17, 0x0cf900fb,
+    0xfbf6fd12, 0xf2eef4ef, 0x10e4f9f5, 0x031400ff, 0x04f90604, 0x061901f5, 0xfaeb0406, 0x0a00feef,
+    0x0eeee0fd, 0xf40700f9, 0xf107f10d, 0xf602f807, 0xf8f410f9, 0xf904f803, 0x05f5f3f3, 0xfbfdf800,
+    0xf4ee05e5, 0x0a070607, 0xf8fef1ec, 0x0019eff4, 0x010b22ed, 0x04f7f80b, 0x0816f706, 0x0503f60a,
+    0x1afcf9f4, 0xf508fcfe, 0xf91c05ea, 0xe003f803, 0x030e06f5, 0xfc03fbfd, 0xf7f317ef, 0xf1f001e6,
+    0xf8f6020a, 0x03f5f7f4, 0x09d8f6f2, 0xfa0afa02, 0x09ff0204, 0xed0204f8, 0x1005010d, 0x00f3fe05,
+    0xe910ee00, 0xf0feff02, 0x0109f4ff, 0x04fe0fe9, 0xe2ee0a00, 0xf6e8f2fc, 0xfdf4fe03, 0xfd0008ff,
+    0x1b03f203, 0xf6f81102, 0xfff715fe, 0xf8ff0efd, 0x07eaeb04, 0x1bedfefe, 0xfbf3101d, 0xf9fef1df,
+    0xfe00010a, 0xff0bf9fb, 0xef00eb05, 0x04011822, 0x0001faf3, 0x0de1fdfa, 0xf8fbfbfa, 0x0eecd807,
+    0xf402f9ef, 0xf5010305, 0xf1ffece9, 0x07f9f9fe, 0x13fe080a, 0x070905f5, 0xf7fef509, 0x090f0404,
+    0xfef8fff9, 0xe6000109, 0x00f6f705, 0x0708f1ea, 0xe4fcfdf6, 0x1cee04fd, 0xfd08f8fd, 0x01fbecf8,
+    0x140b0ef9, 0xfdf4f401, 0x09f8f3f7, 0xfffceff1, 0xf8fffe07, 0x0aeaf5eb, 0x14f20ef5, 0x0008f2e9,
+    0xf00901f2, 0x02070803, 0x18f9f312, 0x080e0e0f, 0x0400fefb, 0x01e40201, 0x0e08f8f3, 0xed0dd706,
+    0xf81601eb, 0xfffc0307, 0xeb04e608, 0xf9ebf704, 0x050bff08, 0x01f80116, 0x0ce9eeff, 0xfaf6f500,
+    0x03f003ee, 0x1a070210, 0x01f50bfe, 0xfffbfe0d, 0x14eeef18, 0xfdfbf4f8, 0xf8f304f1, 0xf9fbfaf8,
+    0xf1f20603, 0xe41001fa, 0x18f9071c, 0x16f2f7fe, 0x000412f4, 0xe91102fd, 0xf4fa05fb, 0xfefe03e9,
+    0xf3000205, 0xeb090903, 0x0313eff1, 0x010121fc, 0xf3020aee, 0x0002f7f4, 0xf2f1ffed, 0x00f0fc03,
+    0x19fbfff3, 0xfa020a04, 0xfeff0a07, 0xffebefff, 0xf4f2f60c, 0x020bf6ff, 0x0108f504, 0xedf6fdfc,
+    0xecfa0afa, 0x0705fcfc, 0x01edf915, 0x01eef0ff, 0x12f61d05, 0x000efa01, 0xef0007fb, 0xf803ef06,
+    0x021a0104, 0xf6f80101, 0xebfa1d22, 0x00f9fd0b, 0x03f7ec04, 0xe80a0ed5, 0xf4e6eff4, 0xfcff08fe,
+    0xf703ed00, 0xefff16f7, 0xf3f50a01, 0x0803f1f5, 0xe1fedf02, 0x0201fff3, 0xfd16f304, 0xf6040606,
+    0x03f7fef2, 0xf8f00403, 0xfd06f9fe, 0x0205f909, 0xf830f102, 0x00f9e0fe, 0xf9fd0300, 0xea140702,
+    0x05000dfa, 0x0dea00f1, 0xfdf5ffe3, 0xf8060704, 0xeff914fa, 0xf9eaf1ee, 0x2515070d, 0xffd6f207,
+    0xf5fcfd14, 0xf0e606ca, 0x07fdfde4, 0x02d60deb, 0xe20415fe, 0x0e081107, 0xee06040a, 0x02fd2efd,
+    0xf8f40000, 0xef03ecfe, 0xfdeefede, 0x0c18f6e8, 0xeeeb08ec, 0xeefdfc0e, 0x28fbf7eb, 0x05fdf8f3,
+    0xedf5ed07, 0x2d2706f8, 0xfa050df3, 0xfa0917fa, 0xfcef0107, 0x00ecea0b, 0xfef10fff, 0x03fff502,
+    0x00f704fa, 0xef0a00df, 0xf3f1f8f0, 0x03f4eefe, 0xf811ec03, 0x2b0ef4ff, 0xf2f6ebf4, 0xf60114f7,
+    0xf9e5fbe7, 0xfade0106, 0xf3f7fffe, 0x0223fafb, 0xe60f05fe, 0xeff608ed, 0x09f6f2f0, 0xfdf6fdfd,
+    0x15ff03fa, 0xf806f405, 0x0af5fe00, 0x0bfbf7f5, 0xf305fd1a, 0xfefdfbf6, 0x11fdee05, 0xed2104da,
+    0xfdf3fa06, 0x00e508ee, 0x2002fd01, 0x1106f500, 0x03fc0108, 0x0603070b, 0x08120205, 0x080601ed,
+    0x040c03fe, 0xd0e3c931, 0xe5c097d2, 0xfb031294,
+};
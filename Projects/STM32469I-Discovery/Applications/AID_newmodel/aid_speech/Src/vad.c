@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    AID/aid_speech/Src/vad.c
+  * @author  OPEN AI LAB Audio Team
+  * @brief   Energy and zero crossing voice activity gate in front of the mfcc
+  ******************************************************************************
+  */
+
+#include <string.h>
+
+#include "arm_math.h"
+#include "vad.h"
+
+// 10 * log10(e) = 3.01 * log2(e): dB in log2 q8
+#define DB_TO_LOG2_Q8(db) ((db) * 85)
+
+// the first frames set the noise floor to their minimum
+#define VAD_INIT_FRAMES 10
+
+// log2 in q8, with the mantissa taken as linear: at most 0.26 dB off
+static int32_t log2_q8(uint64_t v)
+{
+    uint32_t hi = (uint32_t)(v >> 32);
+    int32_t msb;
+
+    if (v == 0)
+        return 0;
+
+    msb = hi ? 63 - __CLZ(hi) : 31 - __CLZ((uint32_t)v);
+
+    return (msb << 8) + (int32_t)(((v << (63 - msb)) >> 55) & 0xff);
+}
+
+void vad_init(struct vad *v, uint32_t run_frames, uint32_t warmup_frames)
+{
+    memset(v, 0, sizeof(*v));
+    v->run_frames = run_frames;
+    v->hangover = warmup_frames;
+}
+
+static int is_speech(struct vad *v, const int16_t *samples, int num)
+{
+    int32_t sum = 0;
+    uint64_t energy = 0;
+    int zcr = 0;
+
+    for (int i = 0; i < num; i++)
+        sum += samples[i];
+
+    // around the mean: a dc offset would hide the crossings
+    int32_t mean = sum / num;
+    int32_t last = samples[0] - mean;
+
+    for (int i = 0; i < num; i++)
+    {
+        int32_t x = samples[i] - mean;
+
+        energy += (uint64_t)((int64_t)x * x);
+        zcr += (x ^ last) < 0;
+        last = x;
+    }
+
+    int32_t level = log2_q8(energy);
+    int speech = energy >= (uint64_t)VAD_MIN_RMS * VAD_MIN_RMS * num &&
+                 (level > v->noise_floor + DB_TO_LOG2_Q8(VAD_SPEECH_DB) ||
+                  (zcr * 256 / num > VAD_FRICATIVE_ZCR && level > v->noise_floor + DB_TO_LOG2_Q8(VAD_FRICATIVE_DB)));
+
+    // the floor follows a quieter room at once, and a louder one slowly, slower still during speech
+    if (v->frame_num < VAD_INIT_FRAMES)
+    {
+        if (v->frame_num == 0 || level < v->noise_floor)
+            v->noise_floor = level;
+        speech = 0;
+    }
+    else if (level < v->noise_floor)
+        v->noise_floor += (level - v->noise_floor) >> 2;
+    else
+        v->noise_floor += (level - v->noise_floor) >> (speech ? 10 : 5);
+
+    return speech;
+}
+
+int vad_push_frame(struct vad *v, const int16_t *samples, int num, int *release)
+{
+    int frames;
+
+    if (is_speech(v, samples, num))
+    {
+        if (v->hangover == 0 && v->emitted % v->run_frames == 0)
+            v->open_num++;
+        v->hangover = VAD_HANGOVER_FRAMES;
+    }
+    else if (v->hangover > 0)
+    {
+        v->hangover--;
+    }
+
+    v->frame_num++;
+
+    if (v->hangover > 0 || v->emitted % v->run_frames != 0)
+    {
+        frames = v->held + 1;
+        v->held = 0;
+        v->emitted += frames;
+        *release = frames;
+
+        return frames;
+    }
+
+    // closed: hold the frame back, and drop the oldest ones a run at a time, for the runs
+    // of the model to start on the same frames as without the gate
+    v->held++;
+    *release = 0;
+
+    if (v->held >= VAD_PREROLL_FRAMES + v->run_frames)
+    {
+        v->held -= v->run_frames;
+        v->skipped_num += v->run_frames;
+        *release = v->run_frames;
+    }
+
+    return 0;
+}
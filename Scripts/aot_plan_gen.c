@@ -0,0 +1,163 @@
+/*
+ * Generates the aot plan of the aid_speech speech model, on the host.
+ *
+ * The speech model of tiny_graph_generated.c goes through the prerun of the board, with the cmsis
+ * ops as the target has no x86 variant, and build_aot_plan() records what it decided. The plan is
+ * then bound to an arena and run side by side with the graph on run_num runs of random input,
+ * as test_tiny_aot does, and only written when every output matches: as the C array var_name,
+ * the Src/tiny_aot_plan_generated.c that command_recognition.c runs with AID_AOT_PLAN set in
+ * tengine_task.h. Generate it again whenever the model changes.
+ *
+ * Build, with the same sources as Scripts/vad_replay.c, TENGINE_LIB built with CONFIG_AOT_PLAN:
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include -I<CMSIS-NN>/Include -I$TENGINE/include \
+ *       Scripts/aot_plan_gen.c $TENGINE/tests/bin/tiny/tiny_graph_generated.c \
+ *       $TENGINE_LIB $CMSIS_NN $CMSIS_DSP -lm -lpthread -o aot_plan_gen
+ *
+ * Usage: aot_plan_gen [-o tiny_aot_plan_generated.c] [-n var_name] [-r run_num]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tengine_aot.h"
+
+extern const void *get_tiny_graph(void);
+extern void free_tiny_graph(const void *);
+
+static void fill_input(signed char *buf, int size, unsigned int *seed)
+{
+    for (int i = 0; i < size; i++)
+        buf[i] = (signed char)(rand_r(seed) & 0xff);
+}
+
+/* the graph and the plan on the same inputs: 0 when every output matches */
+static int check_plan(graph_t graph, const void *plan, int run_num)
+{
+    int arena_size = get_aot_arena_size(plan);
+    void *arena = malloc(arena_size);
+    aot_graph_t aot_graph = bind_aot_graph(plan, arena, arena_size);
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+    int input_size = get_tensor_buffer_size(input_tensor);
+    signed char *input = malloc(input_size);
+    unsigned int seed = 1;
+    int ret = -1;
+
+    if (aot_graph == NULL || input == NULL)
+    {
+        printf("cannot bind the plan to an arena of %d bytes\n", arena_size);
+        goto out;
+    }
+
+    int aot_input_size, aot_output_size;
+    signed char *aot_input = get_aot_input_buffer(aot_graph, &aot_input_size);
+
+    if (aot_input_size != input_size)
+    {
+        printf("plan input: %d bytes, the graph input has %d\n", aot_input_size, input_size);
+        goto out;
+    }
+
+    set_tensor_buffer(input_tensor, input, input_size);
+
+    for (int i = 0; i < run_num; i++)
+    {
+        fill_input(input, input_size, &seed);
+        memcpy(aot_input, input, input_size);
+
+        if (run_graph(graph, 1) < 0 || run_aot_graph(aot_graph) < 0)
+        {
+            printf("run %d failed\n", i);
+            goto out;
+        }
+
+        const signed char *output = get_tensor_buffer(output_tensor);
+        const signed char *aot_output = get_aot_output_buffer(aot_graph, &aot_output_size);
+
+        if (aot_output_size != get_tensor_buffer_size(output_tensor) || memcmp(aot_output, output, aot_output_size))
+        {
+            printf("run %d: the plan output differs from the graph one\n", i);
+            goto out;
+        }
+    }
+
+    printf("plan: %d bytes of flash, arena: %d bytes, %d runs match the graph\n", ((const struct aot_plan *)plan)->size,
+           arena_size, run_num);
+    ret = 0;
+
+out:
+    free(input);
+    free(arena);
+
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *out_name = "tiny_aot_plan_generated.c";
+    const char *var_name = "tiny_aot_plan";
+    int run_num = 100;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-o") == 0)
+            out_name = argv[arg + 1];
+        else if (strcmp(argv[arg], "-n") == 0)
+            var_name = argv[arg + 1];
+        else if (strcmp(argv[arg], "-r") == 0)
+            run_num = atoi(argv[arg + 1]);
+        else
+            break;
+    }
+
+    if (arg < argc)
+    {
+        printf("usage: %s [-o tiny_aot_plan_generated.c] [-n var_name] [-r run_num]\n", argv[0]);
+        return -1;
+    }
+
+    init_tengine();
+
+    const void *tiny_graph = get_tiny_graph();
+    graph_t graph = create_graph(NULL, "tiny", (void *)tiny_graph);
+    int cpu_isa = 0;
+
+    if (graph == NULL || set_graph_attr(graph, "cpu_isa", &cpu_isa, sizeof(int)) < 0 || prerun_graph(graph) < 0)
+    {
+        printf("cannot load the tiny graph\n");
+        return -1;
+    }
+
+    void *plan;
+    int plan_size;
+
+    /* before the first run: the plan records the streaming state as prerun left it */
+    if (build_aot_plan(graph, &plan, &plan_size) < 0)
+    {
+        printf("build aot plan failed: %d\n", get_tengine_errno());
+        return -1;
+    }
+
+    int ret = check_plan(graph, plan, run_num);
+
+    if (ret == 0 && save_aot_plan(plan, var_name, out_name) < 0)
+    {
+        printf("cannot write %s\n", out_name);
+        ret = -1;
+    }
+
+    if (ret == 0)
+        printf("%s written\n", out_name);
+
+    free_aot_plan(plan);
+    postrun_graph(graph);
+    destroy_graph(graph);
+    free_tiny_graph(tiny_graph);
+    release_tengine();
+
+    return ret;
+}
@@ -0,0 +1,327 @@
+/*
+ * Host replay of the aid_speech two stage cascade on a set of wav files.
+ *
+ * Each file goes twice through the decode task of command_recognition.c, on the q7 mfcc of
+ * every frame: once with the speech model of tiny_graph_generated.c on every run, once with
+ * the first stage of tiny_stage1_graph_generated.c on every run and the speech model only
+ * when the first stage scored cascade_threshold or more in the last CASCADE_HOLD_RUNS runs.
+ * The speech model catches up on the runs it missed from the feature history, as the decode
+ * task does, so it scores as in the ungated pass, which is checked, and the wake ups of the
+ * two passes are the same unless the first stage missed a keyword. For each file the runs of the speech model, the wake ups and the average
+ * multiply accumulates per second of audio of both passes are printed; the MACs of a run are
+ * counted from the conv and fc nodes of the tiny graphs.
+ *
+ * silence_s seconds of low noise are put before and after each file, as Scripts/vad_replay.c.
+ *
+ * Build as Scripts/vad_replay.c, with TINY the tengine-lite/tests/bin/tiny directory:
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include -I<CMSIS-NN>/Include -I$TENGINE/include -I$TINY \
+ *       Scripts/cascade_replay.c $APP/Src/mfcc.c $APP/Src/kws_score.c $TINY/tiny_graph_generated.c \
+ *       $TINY/tiny_stage1_graph_generated.c $TENGINE_LIB $CMSIS_NN $CMSIS_DSP -lm -lpthread -o cascade_replay
+ *
+ * Usage: cascade_replay [-s silence_s] [-t threshold] [-c cascade_threshold] <16 bit pcm wav> ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cnn.h"
+#include "mfcc.h"
+#include "tengine_c_api.h"
+#include "tiny_graph.h"
+#include "wav_load.h"
+#include "kws_post.h"
+
+/* as command_recognition.c */
+#define CASCADE_HOLD_RUNS 6
+#define FEATURE_HISTORY_RUNS (GRAPH_WARMUP_RUNS + 2)
+
+extern const struct tiny_graph *get_tiny_graph(void);
+extern void free_tiny_graph(const struct tiny_graph *);
+extern const struct tiny_graph *get_tiny_stage1_graph(void);
+extern void free_tiny_stage1_graph(const struct tiny_graph *);
+
+static int threshold = 90;
+static int cascade_threshold = 24;
+
+static long graph_macs(const struct tiny_graph *tiny_graph)
+{
+    long macs = 0;
+
+    for (int i = 0; i < tiny_graph->node_num; i++)
+    {
+        const struct tiny_node *node = tiny_graph->node_list[i];
+        const int *w = node->input[1] ? node->input[1]->dims : NULL;
+
+        if (node->op_type == NN_OP_CONV)
+        {
+            const struct tiny_conv_param *param = node->op_param;
+            const struct tiny_tensor *out = node->output;
+            long out_num = 1;
+
+            for (int d = 0; d < out->dim_num; d++)
+                out_num *= out->dims[d];
+
+            macs += out_num * param->kernel_h * param->kernel_w * node->input[0]->dims[3];
+        }
+        else if (node->op_type == NN_OP_FC)
+        {
+            macs += (long)w[0] * w[1];
+        }
+    }
+
+    return macs;
+}
+
+static graph_t load_graph(const struct tiny_graph *tiny_graph)
+{
+    graph_t graph = create_graph(NULL, "tiny", (void *)tiny_graph);
+
+    if (graph == NULL || prerun_graph(graph) < 0)
+    {
+        printf("cannot load the tiny graph %s\n", tiny_graph->name);
+        return NULL;
+    }
+
+    if (get_tensor_buffer_size(get_graph_input_tensor(graph, 0, 0)) != NUM_MFCC_COEFFS * CONV_DATA_LEN)
+    {
+        printf("the input of %s is not %d mfcc frames\n", tiny_graph->name, CONV_DATA_LEN);
+        return NULL;
+    }
+
+    return graph;
+}
+
+/* scores: the outputs of the speech model on every run, kept by the ungated pass and checked by the other */
+static void run_stage2(graph_t graph, const q7_t *frames, int r, int use_cascade, int exact, q7_t *scores,
+                       int *mismatch_num, struct post *p, struct pass *pass)
+{
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    const q7_t *output = get_tensor_buffer(get_graph_output_tensor(graph, 0, 0));
+
+    set_tensor_buffer(input_tensor, (void *)(frames + r * NUM_MFCC_COEFFS * CONV_DATA_LEN),
+                      NUM_MFCC_COEFFS * CONV_DATA_LEN);
+    run_graph(graph, 1);
+    pass->run_num++;
+
+    if (!exact)
+        return;
+
+    if (!use_cascade)
+        memcpy(scores + r * OUT_DIM, output, OUT_DIM);
+    else if (memcmp(scores + r * OUT_DIM, output, OUT_DIM) != 0)
+        (*mismatch_num)++;
+
+    post_process(p, output, (r + 1) * CONV_DATA_LEN - 1, pass);
+}
+
+/* frames: the q7 mfcc of the file, run_num runs of CONV_DATA_LEN of them */
+static void replay(graph_t stage1, graph_t stage2, const q7_t *frames, int run_num, int use_cascade,
+                   q7_t *scores, int *mismatch_num, struct pass *pass, int *stage1_num)
+{
+    const int run_size = NUM_MFCC_COEFFS * CONV_DATA_LEN;
+    struct post p;
+    int hold = 0;
+    int missed = run_num;
+
+    post_init(&p, threshold);
+    memset(pass, 0, sizeof(*pass));
+    *stage1_num = 0;
+    *mismatch_num = 0;
+
+    reset_graph(stage1);
+    reset_graph(stage2);
+
+    double start = get_time_us();
+
+    for (int r = 0; r < run_num; r++)
+    {
+        const q7_t *run = frames + r * run_size;
+
+        if (!use_cascade)
+        {
+            run_stage2(stage2, frames, r, 0, 1, scores, mismatch_num, &p, pass);
+            continue;
+        }
+
+        tensor_t input_tensor = get_graph_input_tensor(stage1, 0, 0);
+        const q7_t *score = get_tensor_buffer(get_graph_output_tensor(stage1, 0, 0));
+
+        set_tensor_buffer(input_tensor, (void *)run, run_size);
+        run_graph(stage1, 1);
+        (*stage1_num)++;
+
+        if (score[1] >= cascade_threshold)
+            hold = CASCADE_HOLD_RUNS;
+
+        if (hold == 0)
+        {
+            missed++;
+            continue;
+        }
+
+        hold--;
+
+        /* past the history, the first runs only refill the move nodes */
+        int history = missed < FEATURE_HISTORY_RUNS ? missed : FEATURE_HISTORY_RUNS;
+
+        if (history > r)
+            history = r;
+
+        for (int i = r - history; i <= r; i++)
+            run_stage2(stage2, frames, i, 1, missed <= FEATURE_HISTORY_RUNS || i == r, scores, mismatch_num, &p, pass);
+
+        missed = 0;
+    }
+
+    pass->time_us = get_time_us() - start;
+}
+
+int main(int argc, char *argv[])
+{
+    double silence_s = 5;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-s") == 0)
+            silence_s = atof(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-t") == 0)
+            threshold = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-c") == 0)
+            cascade_threshold = atoi(argv[arg + 1]);
+        else
+            break;
+    }
+
+    if (arg >= argc)
+    {
+        printf("usage: %s [-s silence_s] [-t threshold] [-c cascade_threshold] <16 bit pcm wav> ...\n", argv[0]);
+        return -1;
+    }
+
+    init_tengine();
+
+    const struct tiny_graph *tiny_graph = get_tiny_graph();
+    const struct tiny_graph *tiny_stage1_graph = get_tiny_stage1_graph();
+    graph_t stage2 = load_graph(tiny_graph);
+    graph_t stage1 = load_graph(tiny_stage1_graph);
+
+    if (stage1 == NULL || stage2 == NULL)
+        return -1;
+
+    long stage1_macs = graph_macs(tiny_stage1_graph);
+    long stage2_macs = graph_macs(tiny_graph);
+
+    /* the q7 format of command_recognition.c */
+    float input_scale = 1.0f;
+    int input_zero_point = 0;
+    int input_shift = 0;
+    int8_t frac_bits[NUM_MFCC_COEFFS];
+
+    if (get_tensor_quant_param(get_graph_input_tensor(stage2, 0, 0), &input_scale, &input_zero_point, 1) == 1)
+    {
+        while ((1 << input_shift) < input_scale)
+            input_shift++;
+    }
+
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        frac_bits[i] = (i == 0 ? 0 : 1) + input_shift;
+
+    MFCC_init();
+    MFCC_set_q7_format(frac_bits);
+
+    unsigned int seed = 1;
+    struct pass *all = calloc(1, sizeof(struct pass));
+    struct pass *cascade = calloc(1, sizeof(struct pass));
+    double total_macs[2] = {0, 0};
+    double total_time[2] = {0, 0};
+    long total_runs = 0, total_stage2 = 0;
+    int total_wakeups = 0, total_lost = 0, total_added = 0;
+    int ret = 0;
+
+    printf("MACs per run: stage 1 %ld, speech model %ld\n", stage1_macs, stage2_macs);
+    printf("file  runs  speech model runs  wake ups ungated/cascade  MACs/s ungated/cascade\n");
+
+    for (; arg < argc; arg++)
+    {
+        int sample_num = 0;
+        int16_t *wav = load_wav(argv[arg], SAMP_FREQ, 1.0f, &sample_num);
+
+        if (wav == NULL || sample_num < MFCC_FRAME_LEN)
+        {
+            printf("cannot load %s\n", argv[arg]);
+            free(wav);
+            ret = -1;
+            continue;
+        }
+
+        int pad_num = (int)(silence_s * SAMP_FREQ);
+        int16_t *pcm = pad_silence(wav, sample_num, pad_num, &seed);
+
+        sample_num += 2 * pad_num;
+
+        int run_num = ((sample_num - MFCC_FRAME_LEN) / MFCC_FRAME_SHIFT + 1) / CONV_DATA_LEN;
+        q7_t *frames = malloc(run_num * CONV_DATA_LEN * NUM_MFCC_COEFFS);
+        q7_t *scores = malloc(run_num * OUT_DIM);
+        int stage1_num, mismatch_num;
+
+        for (int i = 0; i < run_num * CONV_DATA_LEN; i++)
+            MFCC_mfcc_compute_q7(pcm + i * MFCC_FRAME_SHIFT, frames + i * NUM_MFCC_COEFFS);
+
+        replay(stage1, stage2, frames, run_num, 0, scores, &mismatch_num, all, &stage1_num);
+        replay(stage1, stage2, frames, run_num, 1, scores, &mismatch_num, cascade, &stage1_num);
+
+        double seconds = (double)run_num * CONV_DATA_LEN * MFCC_FRAME_SHIFT / SAMP_FREQ;
+        double macs[2] = {(double)all->run_num * stage2_macs,
+                          (double)stage1_num * stage1_macs + (double)cascade->run_num * stage2_macs};
+
+        printf("%s  %d  %d (%.1f%%)  %d/%d  %.0f/%.0f\n", argv[arg], run_num, cascade->run_num,
+               100.0 * cascade->run_num / run_num, all->wakeup_num, cascade->wakeup_num, macs[0] / seconds,
+               macs[1] / seconds);
+
+        /* the history did not cover the receptive field of the speech model */
+        if (mismatch_num)
+            printf("    %d runs of the speech model scored otherwise than ungated\n", mismatch_num);
+
+        total_lost += unmatched(all, cascade, 1, "lost");
+        total_added += unmatched(cascade, all, 1, "added");
+        total_wakeups += all->wakeup_num;
+        total_runs += run_num;
+        total_stage2 += cascade->run_num;
+        for (int i = 0; i < 2; i++)
+            total_macs[i] += macs[i];
+        total_time[0] += all->time_us;
+        total_time[1] += cascade->time_us;
+
+        free(scores);
+        free(frames);
+        free(pcm);
+        free(wav);
+    }
+
+    if (total_runs)
+    {
+        double seconds = (double)total_runs * CONV_DATA_LEN * MFCC_FRAME_SHIFT / SAMP_FREQ;
+
+        printf("speech model on %ld of %ld runs (%.1f%%), cpu saved %.1f%%\n", total_stage2, total_runs,
+               100.0 * total_stage2 / total_runs, 100.0 * (1 - total_time[1] / total_time[0]));
+        printf("average MACs/s: %.0f ungated, %.0f with the cascade (%.1f%%)\n", total_macs[0] / seconds,
+               total_macs[1] / seconds, 100.0 * total_macs[1] / total_macs[0]);
+        printf("wake ups: %d ungated, %d lost and %d added by the cascade\n", total_wakeups, total_lost, total_added);
+    }
+
+    free(cascade);
+    free(all);
+    MFCC_delete();
+    postrun_graph(stage1);
+    destroy_graph(stage1);
+    postrun_graph(stage2);
+    destroy_graph(stage2);
+    free_tiny_stage1_graph(tiny_stage1_graph);
+    free_tiny_graph(tiny_graph);
+    release_tengine();
+
+    return ret;
+}
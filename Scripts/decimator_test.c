@@ -0,0 +1,177 @@
+/*
+ * Host frequency response test and benchmark of the aid_speech mic decimator.
+ *
+ * A tone on channel 0 and a different one on channel 1 go through decimator_stereo_to_mono()
+ * in dma sized blocks. The gain of the output against channel 0 is checked in the pass band
+ * and in the stop band, where what is left is the alias the 8 kHz rate folds below 4 kHz.
+ * The sample pick it replaced is measured too, for comparison. The output must not depend
+ * on how the input is cut into blocks.
+ *
+ * Build, with APP the aid_speech directory and CMSIS_DSP a CMSIS-DSP library built for the host
+ * (only arm_math.h is needed, the host build takes the C loop):
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include Scripts/decimator_test.c $APP/Src/decimator.c -lm -o decimator_test
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "decimator.h"
+
+#define IN_RATE 16000
+#define DMA_FRAMES 2304 /* stereo frames in a dma half buffer of the board */
+#define TONE_FRAMES (DMA_FRAMES * 8)
+#define SETTLE_SAMPLES 64
+
+#define PASS_BAND 3200
+#define STOP_BAND 4800
+#define PASS_RIPPLE_DB 0.05
+#define STOP_ATTEN_DB -55
+
+static double get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void make_tone(q15_t *stereo, int frame_num, double freq, double amp)
+{
+    for (int i = 0; i < frame_num; i++)
+    {
+        stereo[2 * i] = (q15_t)lrint(amp * sin(2 * M_PI * freq * i / IN_RATE));
+        /* what must not leak from the other channel */
+        stereo[2 * i + 1] = (q15_t)lrint(amp * sin(2 * M_PI * 1234.5 * i / IN_RATE + 1));
+    }
+}
+
+/* the decimator this replaced in test.c: every other sample of channel 0 */
+static void pick_stereo_to_mono(const q15_t *stereo, int frame_num, q15_t *mono)
+{
+    for (int i = 0; i < frame_num / 2; i++)
+        mono[i] = stereo[4 * i];
+}
+
+static double rms_db(const q15_t *mono, int num, double amp)
+{
+    double sum = 0;
+
+    for (int i = SETTLE_SAMPLES; i < num; i++)
+        sum += (double)mono[i] * mono[i];
+
+    return 20 * log10(sqrt(sum / (num - SETTLE_SAMPLES)) / (amp / sqrt(2)) + 1e-12);
+}
+
+static double tone_gain(double freq, int use_pick, int block_frames)
+{
+    static q15_t stereo[TONE_FRAMES * 2];
+    static q15_t mono[TONE_FRAMES / 2];
+    struct decimator d;
+    const double amp = 16000;
+
+    make_tone(stereo, TONE_FRAMES, freq, amp);
+    decimator_init(&d);
+
+    for (int i = 0; i < TONE_FRAMES; i += block_frames)
+    {
+        int num = TONE_FRAMES - i < block_frames ? TONE_FRAMES - i : block_frames;
+
+        if (use_pick)
+            pick_stereo_to_mono(stereo + 2 * i, num, mono + i / 2);
+        else
+            decimator_stereo_to_mono(&d, stereo + 2 * i, num, mono + i / 2);
+    }
+
+    return rms_db(mono, TONE_FRAMES / 2, amp);
+}
+
+static int check_blocks(void)
+{
+    static q15_t stereo[TONE_FRAMES * 2];
+    static q15_t whole[TONE_FRAMES / 2], cut[TONE_FRAMES / 2];
+    struct decimator d;
+    unsigned int seed = 1;
+
+    for (int i = 0; i < TONE_FRAMES * 2; i++)
+        stereo[i] = (q15_t)(rand_r(&seed) - RAND_MAX / 2);
+
+    decimator_init(&d);
+    decimator_stereo_to_mono(&d, stereo, TONE_FRAMES, whole);
+
+    /* even blocks of random sizes, some below a chunk, some above */
+    decimator_init(&d);
+    for (int i = 0; i < TONE_FRAMES;)
+    {
+        int num = 2 * (1 + rand_r(&seed) % 150);
+
+        if (num > TONE_FRAMES - i)
+            num = TONE_FRAMES - i;
+
+        decimator_stereo_to_mono(&d, stereo + 2 * i, num, cut + i / 2);
+        i += num;
+    }
+
+    return memcmp(whole, cut, sizeof(whole)) ? -1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+
+    printf("freq    decimator    pick\n");
+
+    for (int freq = 250; freq < IN_RATE / 2; freq += 250)
+    {
+        double gain = tone_gain(freq, 0, DMA_FRAMES);
+        double pick = tone_gain(freq, 1, DMA_FRAMES);
+        const char *fail = "";
+
+        if (freq <= PASS_BAND && fabs(gain) > PASS_RIPPLE_DB)
+            fail = "  FAIL: pass band";
+        if (freq >= STOP_BAND && gain > STOP_ATTEN_DB)
+            fail = "  FAIL: stop band";
+        if (fail[0])
+            ret = -1;
+
+        printf("%5d  %8.2f dB %7.2f dB%s\n", freq, gain, pick, fail);
+    }
+
+    if (check_blocks() < 0)
+    {
+        printf("the output depends on the block sizes\n");
+        ret = -1;
+    }
+
+    /* throughput, in input stereo frames per second */
+    static q15_t stereo[DMA_FRAMES * 2];
+    static q15_t mono[DMA_FRAMES / 2];
+    struct decimator d;
+    int rounds = 20000;
+
+    make_tone(stereo, DMA_FRAMES, 1000, 16000);
+    decimator_init(&d);
+
+    double t0 = get_time_us();
+    for (int i = 0; i < rounds; i++)
+        decimator_stereo_to_mono(&d, stereo, DMA_FRAMES, mono);
+    double t1 = get_time_us();
+    for (int i = 0; i < rounds; i++)
+    {
+        pick_stereo_to_mono(stereo, DMA_FRAMES, mono);
+        __asm__ volatile("" : : "r"(mono) : "memory");
+    }
+    double t2 = get_time_us();
+
+    printf("decimator %.1f M frames/s, pick %.1f M frames/s (%d per second needed)\n",
+           (double)rounds * DMA_FRAMES / (t1 - t0), (double)rounds * DMA_FRAMES / (t2 - t1), IN_RATE);
+
+    if (ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
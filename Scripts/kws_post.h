@@ -0,0 +1,115 @@
+/*
+ * The wake ups of the host replay tools: the ones kws_score_push() of the app gives, as the
+ * decode task of command_recognition.c scores each run, and how two passes over the same file
+ * compare. Include after cnn.h and mfcc.h, and link $APP/Src/kws_score.c.
+ */
+
+#ifndef KWS_POST_H
+#define KWS_POST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "kws_score.h"
+
+#define NOISE_AMP 24
+#define MAX_WAKEUPS 256
+#define MATCH_FRAMES 50 /* a wake up of the other pass this close is the same one */
+
+struct wakeup
+{
+    int id;
+    int frame; /* the last frame of the run that woke up */
+};
+
+struct pass
+{
+    int mfcc_num;
+    int run_num;
+    double time_us;
+    int wakeup_num;
+    struct wakeup wakeups[MAX_WAKEUPS];
+};
+
+/* the scores of a graph taking every run, as the decode task keeps them with the default hop */
+struct post
+{
+    int threshold;
+    struct kws_score score;
+};
+
+static double get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void post_init(struct post *p, int threshold)
+{
+    p->threshold = threshold;
+    kws_score_init(&p->score, 1);
+}
+
+static void post_process(struct post *p, const q7_t *output, int frame, struct pass *pass)
+{
+    int id = kws_score_push(&p->score, output, p->threshold);
+
+    if (id != 0 && pass->wakeup_num < MAX_WAKEUPS)
+    {
+        pass->wakeups[pass->wakeup_num].id = id;
+        pass->wakeups[pass->wakeup_num].frame = frame;
+        pass->wakeup_num++;
+    }
+}
+
+/* pad_num samples of low noise before and after the file, for a room where nobody speaks most of the time */
+static int16_t *pad_silence(const int16_t *pcm, int sample_num, int pad_num, unsigned int *seed)
+{
+    int16_t *out = malloc(sizeof(int16_t) * (sample_num + 2 * pad_num));
+
+    if (out == NULL)
+        return NULL;
+
+    for (int i = 0; i < sample_num + 2 * pad_num; i++)
+        out[i] = (int16_t)(rand_r(seed) % (2 * NOISE_AMP + 1) - NOISE_AMP);
+
+    memcpy(out + pad_num, pcm, sizeof(int16_t) * sample_num);
+
+    return out;
+}
+
+/* the wake ups of a without a match in b */
+static int unmatched(const struct pass *a, const struct pass *b, int print, const char *what)
+{
+    int num = 0;
+
+    for (int i = 0; i < a->wakeup_num; i++)
+    {
+        int found = 0;
+
+        for (int j = 0; j < b->wakeup_num && !found; j++)
+        {
+            int d = a->wakeups[i].frame - b->wakeups[j].frame;
+
+            found = a->wakeups[i].id == b->wakeups[j].id && d <= MATCH_FRAMES && d >= -MATCH_FRAMES;
+        }
+
+        if (!found)
+        {
+            if (print)
+                printf("    %s: id %d at %.2f s\n", what, a->wakeups[i].id,
+                       (double)a->wakeups[i].frame * MFCC_FRAME_SHIFT / SAMP_FREQ);
+            num++;
+        }
+    }
+
+    return num;
+}
+
+#endif
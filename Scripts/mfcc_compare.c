@@ -0,0 +1,111 @@
+/*
+ * Compares the q15 and the float MFCC pipelines of aid_speech on a wav file, on the host.
+ *
+ * For every frame the two outputs are compared, as they are and in the q7 format the app feeds
+ * the model with, and the time of each pipeline per frame is measured.
+ * The cycles on target are printed by command_recognition.c with AID_PERF_STAT and MFCC_COMPARE set.
+ *
+ * Build, with APP the aid_speech directory and CMSIS_DSP a CMSIS-DSP library built for the host:
+ *
+ *   gcc -O2 -DMFCC_COMPARE=1 -I$APP/Inc -I<CMSIS-DSP>/Include Scripts/mfcc_compare.c $APP/Src/mfcc.c \
+ *       $CMSIS_DSP -lm -o mfcc_compare
+ *
+ * Usage: mfcc_compare <16 bit pcm wav> [gain]
+ *   the first channel is taken and resampled to SAMP_FREQ; gain scales the samples,
+ *   to check quiet input
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mfcc.h"
+#include "wav_load.h"
+
+static double get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(int argc, char *argv[])
+{
+    int sample_num = 0;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <16 bit pcm wav> [gain]\n", argv[0]);
+        return -1;
+    }
+
+    int16_t *pcm = load_wav(argv[1], SAMP_FREQ, argc > 2 ? atof(argv[2]) : 1.0f, &sample_num);
+
+    if (pcm == NULL || sample_num < MFCC_FRAME_LEN)
+    {
+        printf("cannot load %s\n", argv[1]);
+        return -1;
+    }
+
+    MFCC_init();
+
+    /* the format of command_recognition.c with an input tensor shift of 0 */
+    const int8_t frac_bits[NUM_MFCC_COEFFS] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    MFCC_set_q7_format(frac_bits);
+
+    float max_diff[NUM_MFCC_COEFFS] = {0};
+    double square_sum[NUM_MFCC_COEFFS] = {0};
+    int q7_mismatch[NUM_MFCC_COEFFS] = {0};
+    double f32_time = 0, q15_time = 0;
+    int frame_num = 0;
+
+    for (int start = 0; start + MFCC_FRAME_LEN <= sample_num; start += MFCC_FRAME_SHIFT)
+    {
+        float f32_out[NUM_MFCC_COEFFS], q15_out[NUM_MFCC_COEFFS];
+        q7_t f32_q7[NUM_MFCC_COEFFS], q15_q7[NUM_MFCC_COEFFS];
+
+        double t0 = get_time_us();
+        MFCC_mfcc_compute_f32(pcm + start, f32_out);
+        double t1 = get_time_us();
+        MFCC_mfcc_compute_q15(pcm + start, q15_out);
+        double t2 = get_time_us();
+
+        MFCC_quantize_q7(f32_out, f32_q7);
+        MFCC_mfcc_compute_q7(pcm + start, q15_q7);
+
+        f32_time += t1 - t0;
+        q15_time += t2 - t1;
+
+        for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        {
+            float diff = fabsf(f32_out[i] - q15_out[i]);
+
+            if (diff > max_diff[i])
+                max_diff[i] = diff;
+
+            square_sum[i] += diff * diff;
+
+            if (f32_q7[i] != q15_q7[i])
+                q7_mismatch[i]++;
+        }
+
+        frame_num++;
+    }
+
+    printf("%d frames\n", frame_num);
+    printf("coeff  max diff  rms diff  q7 mismatch\n");
+
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        printf("%5d  %8.4f  %8.4f  %5.1f%%\n", i, max_diff[i], sqrt(square_sum[i] / frame_num),
+               100.0 * q7_mismatch[i] / frame_num);
+
+    printf("time per frame: f32 %.1f us, q15 %.1f us\n", f32_time / frame_num, q15_time / frame_num);
+
+    MFCC_delete();
+    free(pcm);
+
+    return 0;
+}
@@ -0,0 +1,392 @@
+/*
+ * Host stress test and throughput benchmark of the aid_speech spsc_ring.
+ *
+ * The stress test runs a producer and a consumer thread on small rings, with random span, window
+ * and release sizes, both sides blocking on a futex, and checks every byte of every window.
+ * The benchmark moves mic pcm the way the record task reads it (a 512 byte frame every 320 bytes)
+ * through the ring and through the copy in, copy out FIFO command_recognition.c used before it.
+ *
+ * Build, with APP the aid_speech directory:
+ *
+ *   gcc -O2 -pthread -I$APP/Inc Scripts/spsc_ring_test.c $APP/Src/spsc_ring.c -o spsc_ring_test
+ *
+ * Usage: spsc_ring_test [MB to stress] [MB to benchmark]
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "spsc_ring.h"
+
+#define FRAME_BYTES 512
+#define SHIFT_BYTES 320
+#define WRITE_BYTES 2304 /* one dma half buffer of the board, in mono 8 kHz */
+
+static void futex_wake(struct spsc_ring *ring, volatile uint32_t *index)
+{
+    syscall(SYS_futex, index, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+static int futex_wait(struct spsc_ring *ring, volatile uint32_t *index, uint32_t seen, uint32_t timeout)
+{
+    struct timespec ts = {timeout / 1000, (timeout % 1000) * 1000000L};
+
+    if (syscall(SYS_futex, index, FUTEX_WAIT_PRIVATE, seen, timeout == SPSC_RING_WAIT_FOREVER ? NULL : &ts,
+                NULL, 0) < 0 && errno == ETIMEDOUT)
+        return -1;
+
+    return 0;
+}
+
+static const struct spsc_ring_notify futex_notify = {futex_wake, futex_wait};
+
+static double get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/* the byte at stream position pos */
+static inline uint8_t pattern(uint32_t pos)
+{
+    return (uint8_t)((pos * 2654435761u) >> 24);
+}
+
+struct stress
+{
+    struct spsc_ring ring;
+    uint32_t total;
+    unsigned int seed;
+    int error;
+};
+
+static void *stress_producer(void *arg)
+{
+    struct stress *s = arg;
+    unsigned int seed = s->seed;
+    uint32_t pos = 0;
+
+    while (pos < s->total)
+    {
+        uint32_t len = 1 + rand_r(&seed) % s->ring.max_span;
+
+        if (len > s->total - pos)
+            len = s->total - pos;
+
+        if (rand_r(&seed) % 4 == 0)
+        {
+            uint8_t data[len];
+
+            for (uint32_t i = 0; i < len; i++)
+                data[i] = pattern(pos + i);
+
+            if (spsc_ring_write(&s->ring, data, len) < 0)
+            {
+                sched_yield();
+                continue;
+            }
+        }
+        else
+        {
+            uint8_t *span = spsc_ring_acquire(&s->ring, len, SPSC_RING_WAIT_FOREVER);
+
+            for (uint32_t i = 0; i < len; i++)
+                span[i] = pattern(pos + i);
+
+            spsc_ring_commit(&s->ring, len);
+        }
+
+        pos += len;
+    }
+
+    return NULL;
+}
+
+static void *stress_consumer(void *arg)
+{
+    struct stress *s = arg;
+    unsigned int seed = s->seed * 31 + 7;
+    uint32_t pos = 0;
+
+    while (pos < s->total && s->error == 0)
+    {
+        uint32_t len = 1 + rand_r(&seed) % s->ring.max_span;
+        uint32_t shift = 1 + rand_r(&seed) % len;
+
+        if (len > s->total - pos)
+            len = s->total - pos;
+        if (shift > len)
+            shift = len;
+
+        const uint8_t *window = spsc_ring_peek(&s->ring, len, SPSC_RING_WAIT_FOREVER);
+
+        for (uint32_t i = 0; i < len; i++)
+        {
+            if (window[i] != pattern(pos + i))
+            {
+                printf("byte %u: %d, expected %d\n", pos + i, window[i], pattern(pos + i));
+                s->error = 1;
+                break;
+            }
+        }
+
+        spsc_ring_release(&s->ring, shift);
+        pos += shift;
+    }
+
+    return NULL;
+}
+
+static int run_stress(uint32_t size, uint32_t max_span, uint32_t total)
+{
+    struct stress s = {0};
+    pthread_t producer, consumer;
+
+    s.total = total;
+    s.seed = size * 131 + max_span;
+
+    if (spsc_ring_init(&s.ring, size, max_span, &futex_notify, NULL) < 0)
+        return -1;
+
+    /* the stream positions wrap the 32 bit indexes */
+    s.ring.head = s.ring.tail = 0u - total / 2;
+
+    pthread_create(&producer, NULL, stress_producer, &s);
+    pthread_create(&consumer, NULL, stress_consumer, &s);
+    pthread_join(consumer, NULL);
+
+    /* a consumer that stops early leaves the producer blocked on the ring */
+    if (s.error == 0)
+    {
+        pthread_join(producer, NULL);
+        spsc_ring_free(&s.ring);
+    }
+
+    printf("stress size %5u max span %5u: %s\n", size, max_span, s.error ? "FAIL" : "ok");
+
+    return s.error ? -1 : 0;
+}
+
+/* the FIFO of command_recognition.c, with the FreeRTOS counting semaphore on a pthread condition */
+struct legacy_fifo
+{
+    char *fifo_buf;
+    volatile unsigned int read_ptr;
+    volatile unsigned int write_ptr;
+    unsigned int fifo_max_len;
+    unsigned int need_len;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int sem_count;
+};
+
+static void legacy_give(struct legacy_fifo *fifo)
+{
+    pthread_mutex_lock(&fifo->lock);
+    if (fifo->sem_count < 3)
+        fifo->sem_count++;
+    pthread_cond_signal(&fifo->cond);
+    pthread_mutex_unlock(&fifo->lock);
+}
+
+static void legacy_take(struct legacy_fifo *fifo)
+{
+    pthread_mutex_lock(&fifo->lock);
+    while (fifo->sem_count == 0)
+        pthread_cond_wait(&fifo->cond, &fifo->lock);
+    fifo->sem_count--;
+    pthread_mutex_unlock(&fifo->lock);
+}
+
+static int legacy_write(struct legacy_fifo *fifo, const char *data, int len)
+{
+    unsigned int pos = fifo->write_ptr & (fifo->fifo_max_len - 1);
+    int len1 = len, len2 = 0;
+
+    if (fifo->write_ptr - fifo->read_ptr + len > fifo->fifo_max_len)
+        return -1;
+
+    if (pos + len > fifo->fifo_max_len)
+    {
+        len1 = fifo->fifo_max_len - pos;
+        len2 = len - len1;
+    }
+
+    memcpy(fifo->fifo_buf + pos, data, len1);
+    memcpy(fifo->fifo_buf, data + len1, len2);
+    __atomic_store_n(&fifo->write_ptr, fifo->write_ptr + len, __ATOMIC_RELEASE);
+
+    if (fifo->write_ptr - fifo->read_ptr >= fifo->need_len)
+        legacy_give(fifo);
+
+    return 0;
+}
+
+static void legacy_read(struct legacy_fifo *fifo, char *data, int len, int shift_len)
+{
+    fifo->need_len = len;
+
+    while (len > (int)(__atomic_load_n(&fifo->write_ptr, __ATOMIC_ACQUIRE) - fifo->read_ptr))
+        legacy_take(fifo);
+
+    unsigned int pos = fifo->read_ptr & (fifo->fifo_max_len - 1);
+    int len1 = len, len2 = 0;
+
+    if (pos + len > fifo->fifo_max_len)
+    {
+        len1 = fifo->fifo_max_len - pos;
+        len2 = len - len1;
+    }
+
+    memcpy(data, fifo->fifo_buf + pos, len1);
+    memcpy(data + len1, fifo->fifo_buf, len2);
+    __atomic_store_n(&fifo->read_ptr, fifo->read_ptr + shift_len, __ATOMIC_RELEASE);
+}
+
+struct bench
+{
+    int use_ring;
+    struct spsc_ring ring;
+    struct legacy_fifo fifo;
+    uint64_t total;
+    uint32_t checksum;
+};
+
+static void *bench_producer(void *arg)
+{
+    struct bench *b = arg;
+    static char data[WRITE_BYTES];
+
+    for (int i = 0; i < WRITE_BYTES; i++)
+        data[i] = (char)i;
+
+    for (uint64_t pos = 0; pos < b->total + FRAME_BYTES;)
+    {
+        int ret = b->use_ring ? spsc_ring_write(&b->ring, data, WRITE_BYTES) : legacy_write(&b->fifo, data, WRITE_BYTES);
+
+        /* the board drops a full buffer; here the producer retries, to measure the transfer */
+        if (ret < 0)
+            sched_yield();
+        else
+            pos += WRITE_BYTES;
+    }
+
+    return NULL;
+}
+
+static void *bench_consumer(void *arg)
+{
+    struct bench *b = arg;
+    char frame[FRAME_BYTES];
+    uint32_t checksum = 0;
+
+    for (uint64_t pos = 0; pos < b->total; pos += SHIFT_BYTES)
+    {
+        const char *window = frame;
+
+        if (b->use_ring)
+            window = spsc_ring_peek(&b->ring, FRAME_BYTES, SPSC_RING_WAIT_FOREVER);
+        else
+            legacy_read(&b->fifo, frame, FRAME_BYTES, SHIFT_BYTES);
+
+        /* what the mfcc does first: read the frame once */
+        for (int i = 0; i < FRAME_BYTES; i += 4)
+            checksum += *(const uint32_t *)(window + i);
+
+        if (b->use_ring)
+            spsc_ring_release(&b->ring, SHIFT_BYTES);
+    }
+
+    b->checksum = checksum;
+
+    return NULL;
+}
+
+static double run_bench(int use_ring, uint64_t total, uint32_t *checksum)
+{
+    struct bench b;
+    pthread_t producer, consumer;
+
+    memset(&b, 0, sizeof(b));
+    b.use_ring = use_ring;
+    b.total = total;
+
+    if (use_ring)
+    {
+        spsc_ring_init(&b.ring, 8192, FRAME_BYTES, &futex_notify, NULL);
+    }
+    else
+    {
+        b.fifo.fifo_max_len = 8192;
+        b.fifo.fifo_buf = calloc(8192, 1);
+        pthread_mutex_init(&b.fifo.lock, NULL);
+        pthread_cond_init(&b.fifo.cond, NULL);
+    }
+
+    double start = get_time_us();
+
+    pthread_create(&producer, NULL, bench_producer, &b);
+    pthread_create(&consumer, NULL, bench_consumer, &b);
+    pthread_join(consumer, NULL);
+
+    double used = get_time_us() - start;
+
+    /* its last writes fit in the room the consumer leaves */
+    pthread_join(producer, NULL);
+
+    if (use_ring)
+        spsc_ring_free(&b.ring);
+    else
+        free(b.fifo.fifo_buf);
+
+    *checksum = b.checksum;
+
+    return total / used;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t stress_mb = argc > 1 ? atoi(argv[1]) : 16;
+    uint64_t bench_mb = argc > 2 ? atoi(argv[2]) : 256;
+    int ret = 0;
+
+    /* max_span from a byte to half the ring */
+    static const uint32_t configs[][2] = {{16, 1}, {64, 7}, {64, 32}, {128, 48}, {1024, 80}, {8192, 512}};
+
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+    {
+        if (run_stress(configs[i][0], configs[i][1], stress_mb << 20) < 0)
+            ret = -1;
+    }
+
+    uint32_t fifo_sum, ring_sum;
+    double fifo_speed = run_bench(0, bench_mb << 20, &fifo_sum);
+    double ring_speed = run_bench(1, bench_mb << 20, &ring_sum);
+
+    printf("mic pattern (%d byte writes, %d byte frames every %d bytes):\n", WRITE_BYTES, FRAME_BYTES, SHIFT_BYTES);
+    printf("  fifo      %8.1f MB/s\n", fifo_speed);
+    printf("  spsc ring %8.1f MB/s\n", ring_speed);
+
+    if (fifo_sum != ring_sum)
+    {
+        printf("checksum mismatch: %08x %08x\n", fifo_sum, ring_sum);
+        ret = -1;
+    }
+
+    if (ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,489 @@
+/*
+ * Distills the first stage of the aid_speech cascade from the speech model, on the host.
+ *
+ * Each keyword wav file holds a keyword. The files are replayed in noise with gains, noise levels and
+ * frame offsets through the q7 mfcc and the speech model of tiny_graph_generated.c. When the
+ * model gives a keyword a score of at least label_score, the runs with half of their rows or
+ * more on the file are keyword runs; the runs with no row on it are the others. The first stage
+ * sees the 16 rows of a run as the first conv of the model does: the STAGE1_CONV_KERNEL_C of its
+ * filters that tell keyword runs from the others best are kept, and a logistic regression over
+ * their outputs is fitted. The speech model is late, and keeps a keyword in its history for a
+ * while: its own scores make poor labels for a model with no history.
+ * It is quantized to the fc and the 2 way softmax of tiny_stage1_graph_generated.c, and written
+ * as tiny_stage1_param_generated.h.
+ *
+ * The first stage only has to let the keywords through: the speech model behind it decides.
+ * The fraction of keyword runs and of other runs it passes at a few thresholds is printed, for
+ * cascade_threshold in command_recognition.c.
+ *
+ * Build, with the same sources as Scripts/vad_replay.c, and TINY the tengine-lite/tests/bin/tiny
+ * directory (the model weights are read from tiny_param_generated.h):
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include -I<CMSIS-NN>/Include -I$TENGINE/include -I$TINY \
+ *       Scripts/stage1_distill.c $APP/Src/mfcc.c $TINY/tiny_graph_generated.c \
+ *       $TENGINE_LIB $CMSIS_NN $CMSIS_DSP -lm -lpthread -o stage1_distill
+ *
+ * Usage: stage1_distill [-o tiny_stage1_param_generated.h] [-l label_score] [-n other wav] ... <keyword wav> ...
+ *   the wav files are 16 bit pcm; the -n ones hold speech with no keyword, for the first stage
+ *   not to take any speech for a keyword
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cnn.h"
+#include "mfcc.h"
+#include "tengine_c_api.h"
+#include "tiny_param_generated.h"
+#include "wav_load.h"
+#include "kws_score.h" /* GRAPH_WARMUP_RUNS: the runs before are not labelled */
+
+#define STAGE1_CONV_KERNEL_C 16
+#define CONV_C 96 /* the first conv of the speech model */
+#define CONV_ROWS 4
+#define CONV_KERNEL (10 * NUM_MFCC_COEFFS)
+#define FEATURE_NUM (CONV_ROWS * STAGE1_CONV_KERNEL_C)
+#define PAD_S 2.5
+#define MAX_RUNS 100000
+
+struct run
+{
+    q7_t conv[CONV_ROWS * CONV_C]; /* the outputs of the first conv after the relu, hwc */
+    int label;
+};
+
+extern const void *get_tiny_graph(void);
+
+static const float gains[] = {0.25f, 0.5f, 1.0f, 2.0f};
+static const int noise_amps[] = {8, 32, 96};
+
+static struct run *runs;
+static int run_num;
+
+/* the first conv of the speech model on 16 mfcc rows, as arm_convolve_HWC_q7_nonsquare() */
+static void first_conv(const q7_t *rows, q7_t *out)
+{
+    for (int r = 0; r < CONV_ROWS; r++)
+    {
+        for (int c = 0; c < CONV_C; c++)
+        {
+            int32_t sum = ((int32_t)conv_0_bias_data[c] << FIRST_CONV_BIAS_LSHIFT) + ((1 << FIRST_CONV_OUTPUT_RSHIFT) >> 1);
+            const q7_t *in = rows + r * 2 * NUM_MFCC_COEFFS;
+
+            for (int k = 0; k < CONV_KERNEL; k++)
+                sum += in[k] * conv_0_weight_data[c * CONV_KERNEL + k];
+
+            sum >>= FIRST_CONV_OUTPUT_RSHIFT;
+            out[r * CONV_C + c] = (q7_t)(sum > 127 ? 127 : (sum < 0 ? 0 : sum));
+        }
+    }
+}
+
+/* the words are samples [word_start, word_end) of the stream */
+static void add_stream(graph_t graph, q7_t *input, const int16_t *pcm, int sample_num, int word_start, int word_end,
+                       int label_score)
+{
+    int frame_num = (sample_num - MFCC_FRAME_LEN) / MFCC_FRAME_SHIFT + 1;
+    int stream_runs = frame_num / CONV_DATA_LEN;
+    q7_t *frames = malloc(frame_num * NUM_MFCC_COEFFS);
+    int best = 0;
+    int first = run_num;
+
+    for (int i = 0; i < frame_num; i++)
+        MFCC_mfcc_compute_q7(pcm + i * MFCC_FRAME_SHIFT, frames + i * NUM_MFCC_COEFFS);
+
+    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+    q7_t *output = get_tensor_buffer(output_tensor);
+
+    reset_graph(graph);
+
+    for (int r = 0; r < stream_runs; r++)
+    {
+        memcpy(input, frames + r * CONV_DATA_LEN * NUM_MFCC_COEFFS, CONV_DATA_LEN * NUM_MFCC_COEFFS);
+        run_graph(graph, 1);
+
+        for (int j = 1; j < OUT_DIM; j++)
+            if (output[j] > best)
+                best = output[j];
+    }
+
+    for (int r = GRAPH_WARMUP_RUNS; r < stream_runs && run_num < MAX_RUNS; r++)
+    {
+        /* the rows of the run on the words: the ones of the previous run, then its own */
+        int on_words = 0;
+
+        for (int i = (r - 1) * CONV_DATA_LEN; i < (r + 1) * CONV_DATA_LEN; i++)
+        {
+            int start = i * MFCC_FRAME_SHIFT;
+
+            on_words += start + MFCC_FRAME_LEN > word_start && start < word_end;
+        }
+
+        if (on_words > 0 && (on_words < CONV_DATA_LEN || best < label_score))
+            continue;
+
+        struct run *run = runs + run_num++;
+
+        first_conv(frames + (r - 1) * CONV_DATA_LEN * NUM_MFCC_COEFFS, run->conv);
+        run->label = on_words > 0;
+    }
+
+    int positive = 0;
+    for (int i = first; i < run_num; i++)
+        positive += runs[i].label;
+
+    printf("  best keyword score %d, %d runs, %d keyword\n", best, run_num - first, positive);
+
+    free(frames);
+}
+
+/* the streams of a file, in noise: its runs are all others when it holds no keyword */
+static int add_file(graph_t graph, q7_t *input, const char *name, int keyword, int label_score, unsigned int *seed)
+{
+    int sample_num = 0;
+    int16_t *wav = load_wav(name, SAMP_FREQ, 1.0f, &sample_num);
+
+    if (wav == NULL)
+    {
+        printf("cannot load %s\n", name);
+        return -1;
+    }
+
+    for (int g = 0; g < sizeof(gains) / sizeof(gains[0]); g++)
+    {
+        for (int n = 0; n < sizeof(noise_amps) / sizeof(noise_amps[0]); n++)
+        {
+            printf("%s, gain %.2f, noise %d\n", name, gains[g], noise_amps[n]);
+
+            /* every alignment of the runs on the words */
+            for (int offset = 0; offset < CONV_DATA_LEN; offset++)
+            {
+                int pad_num = (int)(PAD_S * SAMP_FREQ) + offset * MFCC_FRAME_SHIFT;
+                int num = sample_num + 2 * pad_num;
+                int16_t *pcm = malloc(sizeof(int16_t) * num);
+
+                for (int i = 0; i < num; i++)
+                {
+                    int v = rand_r(seed) % (2 * noise_amps[n] + 1) - noise_amps[n];
+
+                    if (i >= pad_num && i < pad_num + sample_num)
+                        v += (int)lrintf(wav[i - pad_num] * gains[g]);
+
+                    pcm[i] = (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : v));
+                }
+
+                if (keyword)
+                    add_stream(graph, input, pcm, num, pad_num, pad_num + sample_num, label_score);
+                else
+                    add_stream(graph, input, pcm, num, 0, 0, label_score);
+                free(pcm);
+            }
+        }
+    }
+
+    free(wav);
+
+    return 0;
+}
+
+/* the filters that tell the labels apart best, by the fisher score of their mean output */
+static void select_filters(int *filters)
+{
+    double fisher[CONV_C];
+
+    for (int c = 0; c < CONV_C; c++)
+    {
+        double sum[2] = {0, 0}, square_sum[2] = {0, 0};
+        int num[2] = {0, 0};
+
+        for (int i = 0; i < run_num; i++)
+        {
+            double v = 0;
+
+            for (int r = 0; r < CONV_ROWS; r++)
+                v += runs[i].conv[r * CONV_C + c];
+
+            sum[runs[i].label] += v;
+            square_sum[runs[i].label] += v * v;
+            num[runs[i].label]++;
+        }
+
+        double mean0 = sum[0] / num[0], mean1 = sum[1] / num[1];
+        double var0 = square_sum[0] / num[0] - mean0 * mean0, var1 = square_sum[1] / num[1] - mean1 * mean1;
+
+        fisher[c] = (mean1 - mean0) * (mean1 - mean0) / (var0 + var1 + 1e-6);
+    }
+
+    for (int k = 0; k < STAGE1_CONV_KERNEL_C; k++)
+    {
+        int best = -1;
+
+        for (int c = 0; c < CONV_C; c++)
+        {
+            int used = 0;
+
+            for (int j = 0; j < k; j++)
+                used |= filters[j] == c;
+
+            if (!used && (best < 0 || fisher[c] > fisher[best]))
+                best = c;
+        }
+
+        filters[k] = best;
+    }
+}
+
+static void get_features(const struct run *run, const int *filters, double *x)
+{
+    for (int r = 0; r < CONV_ROWS; r++)
+        for (int k = 0; k < STAGE1_CONV_KERNEL_C; k++)
+            x[r * STAGE1_CONV_KERNEL_C + k] = run->conv[r * CONV_C + filters[k]];
+}
+
+/* logistic regression on the raw q7 outputs, the two labels weighted the same */
+static void fit(const int *filters, double *w, double *b)
+{
+    double x[FEATURE_NUM], grad[FEATURE_NUM], grad_b;
+    double weight[2];
+    int num[2] = {0, 0};
+    const double lr = 0.5, l2 = 1e-4, in_scale = 1.0 / 64;
+
+    for (int i = 0; i < run_num; i++)
+        num[runs[i].label]++;
+
+    weight[0] = 0.5 / num[0];
+    weight[1] = 0.5 / num[1];
+
+    memset(w, 0, sizeof(double) * FEATURE_NUM);
+    *b = 0;
+
+    for (int it = 0; it < 3000; it++)
+    {
+        memset(grad, 0, sizeof(grad));
+        grad_b = 0;
+
+        for (int i = 0; i < run_num; i++)
+        {
+            double z = *b;
+
+            get_features(runs + i, filters, x);
+            for (int k = 0; k < FEATURE_NUM; k++)
+                z += w[k] * x[k] * in_scale;
+
+            double e = (1 / (1 + exp(-z)) - runs[i].label) * weight[runs[i].label];
+
+            for (int k = 0; k < FEATURE_NUM; k++)
+                grad[k] += e * x[k] * in_scale;
+            grad_b += e;
+        }
+
+        for (int k = 0; k < FEATURE_NUM; k++)
+            w[k] -= lr * (grad[k] + l2 * w[k]);
+        *b -= lr * grad_b;
+    }
+
+    for (int k = 0; k < FEATURE_NUM; k++)
+        w[k] *= in_scale;
+}
+
+/* the largest shift the values fit q7 with */
+static int fit_shift(const double *v, int num, int max_shift)
+{
+    double max = 0;
+    int shift = 0;
+
+    for (int i = 0; i < num; i++)
+        if (fabs(v[i]) > max)
+            max = fabs(v[i]);
+
+    while (shift < max_shift && max * (1 << (shift + 1)) < 127)
+        shift++;
+
+    return shift;
+}
+
+static void print_array(FILE *fp, const char *name, const int *v, int num)
+{
+    fprintf(fp, "#define %s {", name);
+    for (int i = 0; i < num; i++)
+        fprintf(fp, "%d, ", v[i]);
+    fprintf(fp, "}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *out_name = "tiny_stage1_param_generated.h";
+    const char *others[64];
+    int other_num = 0;
+    int label_score = 24;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-o") == 0)
+            out_name = argv[arg + 1];
+        else if (strcmp(argv[arg], "-l") == 0)
+            label_score = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-n") == 0 && other_num < 64)
+            others[other_num++] = argv[arg + 1];
+        else
+            break;
+    }
+
+    if (arg >= argc)
+    {
+        printf("usage: %s [-o tiny_stage1_param_generated.h] [-l label_score] [-n other wav] ... <keyword wav> ...\n",
+               argv[0]);
+        return -1;
+    }
+
+    init_tengine();
+
+    graph_t graph = create_graph(NULL, "tiny", (void *)get_tiny_graph());
+
+    if (graph == NULL || prerun_graph(graph) < 0)
+    {
+        printf("cannot load the tiny graph\n");
+        return -1;
+    }
+
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    int input_size = get_tensor_buffer_size(input_tensor);
+    q7_t *input = malloc(input_size);
+
+    set_tensor_buffer(input_tensor, input, input_size);
+
+    /* the q7 format of command_recognition.c with an input tensor shift of 0 */
+    const int8_t frac_bits[NUM_MFCC_COEFFS] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+    MFCC_init();
+    MFCC_set_q7_format(frac_bits);
+
+    runs = malloc(sizeof(struct run) * MAX_RUNS);
+    unsigned int seed = 1;
+
+    for (int i = 0; i < other_num; i++)
+    {
+        if (add_file(graph, input, others[i], 0, label_score, &seed) < 0)
+            return -1;
+    }
+
+    for (int i = arg; i < argc; i++)
+    {
+        if (add_file(graph, input, argv[i], 1, label_score, &seed) < 0)
+            return -1;
+    }
+
+    int filters[STAGE1_CONV_KERNEL_C];
+    double w[FEATURE_NUM], b;
+
+    select_filters(filters);
+    fit(filters, w, &b);
+
+    /* softmax(-z, z) with 2^(x / 2) is sigmoid(z * ln(2)): the fc gives z = logit / ln(2) */
+    double wz[FEATURE_NUM], bz = b / log(2);
+    int fc_weight[2 * FEATURE_NUM], fc_bias[2];
+
+    for (int k = 0; k < FEATURE_NUM; k++)
+        wz[k] = w[k] / log(2);
+
+    int out_shift = fit_shift(wz, FEATURE_NUM, 15);
+    int bias_shift = 0;
+
+    while (fabs(bz * (1 << out_shift) / (1 << bias_shift)) > 127)
+        bias_shift++;
+
+    for (int k = 0; k < FEATURE_NUM; k++)
+    {
+        fc_weight[FEATURE_NUM + k] = (int)lrint(wz[k] * (1 << out_shift));
+        fc_weight[k] = -fc_weight[FEATURE_NUM + k];
+    }
+    fc_bias[1] = (int)lrint(bz * (1 << out_shift) / (1 << bias_shift));
+    fc_bias[0] = -fc_bias[1];
+
+    /* the quantized first stage on the runs, as the graph computes it */
+    static const int thresholds[] = {8, 16, 24, 32, 48, 64, 96};
+    int pass[7][2] = {{0}};
+    int num[2] = {0, 0};
+
+    for (int i = 0; i < run_num; i++)
+    {
+        double x[FEATURE_NUM];
+        int32_t sum = (fc_bias[1] << bias_shift) + ((1 << out_shift) >> 1);
+
+        get_features(runs + i, filters, x);
+        for (int k = 0; k < FEATURE_NUM; k++)
+            sum += (int)x[k] * fc_weight[FEATURE_NUM + k];
+
+        int z = sum >> out_shift;
+        z = z > 127 ? 127 : (z < -128 ? -128 : z);
+        int z0 = -z > 127 ? 127 : -z;
+        int score = (int)(128 / (1 + powf(2, (z0 - z) / 2.0f)));
+
+        num[runs[i].label]++;
+        for (int t = 0; t < 7; t++)
+            pass[t][runs[i].label] += score >= thresholds[t];
+    }
+
+    printf("%d runs, %d keyword\n", run_num, num[1]);
+    printf("threshold  keyword runs passed  other runs passed\n");
+    for (int t = 0; t < 7; t++)
+        printf("%9d  %18.1f%%  %16.1f%%\n", thresholds[t], 100.0 * pass[t][1] / num[1], 100.0 * pass[t][0] / num[0]);
+
+    FILE *fp = fopen(out_name, "w");
+
+    if (fp == NULL)
+    {
+        printf("cannot write %s\n", out_name);
+        return -1;
+    }
+
+    int conv_weight[STAGE1_CONV_KERNEL_C * CONV_KERNEL], conv_bias[STAGE1_CONV_KERNEL_C];
+
+    for (int k = 0; k < STAGE1_CONV_KERNEL_C; k++)
+    {
+        for (int j = 0; j < CONV_KERNEL; j++)
+            conv_weight[k * CONV_KERNEL + j] = conv_0_weight_data[filters[k] * CONV_KERNEL + j];
+        conv_bias[k] = conv_0_bias_data[filters[k]];
+    }
+
+    fprintf(fp, "/*\n * Generated by Scripts/stage1_distill.c, label score %d, keywords from", label_score);
+    for (int i = arg; i < argc; i++)
+        fprintf(fp, " %s", strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i]);
+    if (other_num)
+        fprintf(fp, ", others from");
+    for (int i = 0; i < other_num; i++)
+        fprintf(fp, " %s", strrchr(others[i], '/') ? strrchr(others[i], '/') + 1 : others[i]);
+    fprintf(fp, "\n * conv filters of conv_0:");
+    for (int k = 0; k < STAGE1_CONV_KERNEL_C; k++)
+        fprintf(fp, " %d", filters[k]);
+    fprintf(fp, "\n */\n\n");
+    fprintf(fp, "#ifndef __TINY_STAGE1_PARAM_GENERATED_H__\n#define __TINY_STAGE1_PARAM_GENERATED_H__\n\n");
+    fprintf(fp, "#define STAGE1_CONV_KERNEL_C %d\n", STAGE1_CONV_KERNEL_C);
+    fprintf(fp, "#define STAGE1_CONV_BIAS_LSHIFT %d\n", FIRST_CONV_BIAS_LSHIFT);
+    fprintf(fp, "#define STAGE1_CONV_OUTPUT_RSHIFT %d\n", FIRST_CONV_OUTPUT_RSHIFT);
+    fprintf(fp, "#define STAGE1_FC_BIAS_LSHIFT %d\n", bias_shift);
+    fprintf(fp, "#define STAGE1_FC_OUTPUT_RSHIFT %d\n", out_shift);
+    print_array(fp, "STAGE1_CONV_W_0", conv_weight, STAGE1_CONV_KERNEL_C * CONV_KERNEL);
+    print_array(fp, "STAGE1_CONV_B_0", conv_bias, STAGE1_CONV_KERNEL_C);
+    print_array(fp, "STAGE1_FC_W_0", fc_weight, 2 * FEATURE_NUM);
+    print_array(fp, "STAGE1_FC_B_0", fc_bias, 2);
+    fprintf(fp, "\nstatic const signed char stage1_conv_0_weight_data[] = STAGE1_CONV_W_0;\n");
+    fprintf(fp, "static const signed char stage1_conv_0_bias_data[] = STAGE1_CONV_B_0;\n");
+    fprintf(fp, "static const signed char stage1_fc_1_weight_data[] = STAGE1_FC_W_0;\n");
+    fprintf(fp, "static const signed char stage1_fc_1_bias_data[] = STAGE1_FC_B_0;\n\n#endif\n");
+    fclose(fp);
+
+    printf("%s written\n", out_name);
+
+    free(runs);
+    free(input);
+    MFCC_delete();
+    postrun_graph(graph);
+    destroy_graph(graph);
+    release_tengine();
+
+    return 0;
+}
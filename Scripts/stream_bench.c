@@ -0,0 +1,695 @@
+/*
+ * Streaming replay benchmark of the aid_speech pipeline on a set of wav files.
+ *
+ * Each file, at 16 kHz, goes through the pipeline of the board in mic dma blocks: the
+ * decimator of test.c on each block, then for each frame of the block the voice activity gate
+ * of the record task (AID_VAD), the q7 mfcc, and every CONV_DATA_LEN frames the speech model of
+ * tiny_graph_generated.c and kws_score_push(), the wake up logic of the decode task, linked from
+ * $APP/Src/kws_score.c. The mfcc and its q7 quantization, the two steps of
+ * MFCC_mfcc_compute_q7() with the float pipeline, are timed as two stages; the q15 pipeline
+ * (MFCC_FIXED_POINT) rounds its DCT sums straight to q7, and its quantize stage stays empty.
+ *
+ * For each stage the time of every call is kept, and the count, mean, p99 and total are
+ * written, with the real time factor (the time of all the stages over the audio time) and the
+ * heap high water mark: the heap the pipeline holds once set up, plus the most it takes on top
+ * of that while streaming. The heap is counted by the malloc() family below, over the one of
+ * glibc.
+ *
+ * A file may be given as <wav>@<s>, s the end of its keyword in the file. A block comes when
+ * the mic has recorded it, so a wake up is called back at the end of the block that completed
+ * the run, plus the time the pipeline took on the block up to the callback. The keyword to
+ * callback latency is the one of the first wake up called back after MATCH_FRAMES before the
+ * end of the keyword; a file with none is a miss.
+ *
+ * silence_s seconds of low noise are put before and after each file, as Scripts/vad_replay.c.
+ * The results go to out_file, as json or as csv of key,value lines, to diff runs.
+ *
+ * Build as Scripts/vad_replay.c, with $APP/Src/decimator.c:
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include -I<CMSIS-NN>/Include -I$TENGINE/include \
+ *       Scripts/stream_bench.c $APP/Src/decimator.c $APP/Src/vad.c $APP/Src/mfcc.c $APP/Src/kws_score.c \
+ *       $TENGINE/tests/bin/tiny/tiny_graph_generated.c $TENGINE_LIB $CMSIS_NN $CMSIS_DSP -lm -lpthread \
+ *       -o stream_bench
+ *
+ * Usage: stream_bench [-s silence_s] [-t threshold] [-v vad] [-f json|csv] [-o out_file] <16 bit pcm wav>[@s] ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "cnn.h"
+#include "mfcc.h"
+#include "vad.h"
+#include "decimator.h"
+#include "tengine_c_api.h"
+#include "wav_load.h"
+#include "kws_post.h"
+
+#define MIC_FREQ (SAMP_FREQ * 2) /* the decimator halves the rate of the mic */
+#define MIC_BLOCK_FRAMES (4 * 2304 / 4) /* stereo frames in a half of the mic dma buffer of test.c */
+
+#define MAX_FILES 256
+
+extern const void *get_tiny_graph(void);
+extern void free_tiny_graph(const void *);
+
+/* the heap in use, counted by the malloc() family */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t num, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t align, size_t size);
+extern void __libc_free(void *ptr);
+
+static size_t heap_in_use = 0;
+static size_t heap_peak = 0;
+
+static void *heap_add(void *ptr)
+{
+    if (ptr != NULL)
+    {
+        size_t in_use = __atomic_add_fetch(&heap_in_use, malloc_usable_size(ptr), __ATOMIC_RELAXED);
+
+        if (in_use > heap_peak)
+            heap_peak = in_use;
+    }
+
+    return ptr;
+}
+
+static void heap_sub(void *ptr)
+{
+    if (ptr != NULL)
+        __atomic_sub_fetch(&heap_in_use, malloc_usable_size(ptr), __ATOMIC_RELAXED);
+}
+
+void *malloc(size_t size)
+{
+    return heap_add(__libc_malloc(size));
+}
+
+void *calloc(size_t num, size_t size)
+{
+    return heap_add(__libc_calloc(num, size));
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    size_t old_size = ptr ? malloc_usable_size(ptr) : 0;
+    void *new_ptr = __libc_realloc(ptr, size);
+
+    if (new_ptr != NULL || size == 0)
+    {
+        __atomic_sub_fetch(&heap_in_use, old_size, __ATOMIC_RELAXED);
+        heap_add(new_ptr);
+    }
+
+    return new_ptr;
+}
+
+void *memalign(size_t align, size_t size)
+{
+    return heap_add(__libc_memalign(align, size));
+}
+
+void *aligned_alloc(size_t align, size_t size)
+{
+    return heap_add(__libc_memalign(align, size));
+}
+
+int posix_memalign(void **ptr, size_t align, size_t size)
+{
+    *ptr = heap_add(__libc_memalign(align, size));
+
+    return *ptr ? 0 : 12 /* ENOMEM */;
+}
+
+void free(void *ptr)
+{
+    heap_sub(ptr);
+    __libc_free(ptr);
+}
+
+/* the time of every call of a stage, in us */
+struct stage
+{
+    const char *name;
+    double *time;
+    int num;
+    int size;
+    double total;
+};
+
+enum
+{
+    STAGE_DECIMATE,
+    STAGE_VAD,
+    STAGE_MFCC,
+    STAGE_QUANTIZE,
+    STAGE_GRAPH,
+    STAGE_POST,
+    STAGE_NUM
+};
+
+static struct stage stages[STAGE_NUM] = {
+    {.name = "decimate"}, {.name = "vad"}, {.name = "mfcc"}, {.name = "quantize"}, {.name = "graph"}, {.name = "post"},
+};
+
+/* the wake ups and the latency of a file */
+struct file_result
+{
+    const char *name;
+    double audio_s;
+    double pad_s; /* the silence before the file */
+    double keyword_end_s; /* < 0: not labelled */
+    double latency_ms;    /* < 0: no wake up for the keyword */
+    int wakeup_num;
+    int id[MAX_WAKEUPS];
+    double wakeup_s[MAX_WAKEUPS];  /* the end of the run that woke up, in the file */
+    double callback_s[MAX_WAKEUPS]; /* when PostProcess() called back, in the file */
+};
+
+static int threshold = 90;
+static int use_vad = 1;
+
+static struct file_result results[MAX_FILES];
+static int result_num = 0;
+
+static double audio_total_s = 0;
+static size_t heap_setup = 0;
+static size_t heap_stream_peak = 0;
+
+/* room for call_num more calls, taken before a file so that it does not count in its heap */
+static int stage_reserve(int stage, int call_num)
+{
+    struct stage *s = &stages[stage];
+
+    if (s->num + call_num <= s->size)
+        return 0;
+
+    double *time = realloc(s->time, sizeof(double) * (s->num + call_num));
+
+    if (time == NULL)
+        return -1;
+
+    s->time = time;
+    s->size = s->num + call_num;
+
+    return 0;
+}
+
+static void stage_add(int stage, double time_us)
+{
+    struct stage *s = &stages[stage];
+
+    if (s->num < s->size)
+        s->time[s->num++] = time_us;
+    s->total += time_us;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double d = *(const double *)a - *(const double *)b;
+
+    return d < 0 ? -1 : d > 0;
+}
+
+static double stage_p99(struct stage *s)
+{
+    if (s->num == 0)
+        return 0;
+
+    qsort(s->time, s->num, sizeof(double), cmp_double);
+
+    return s->time[(s->num * 99 + 99) / 100 - 1];
+}
+
+/* the pipeline of the board, from the mic blocks to the wake ups */
+struct pipeline
+{
+    graph_t graph;
+    q7_t *features;
+    struct decimator decimator;
+    struct vad vad;
+    struct post post;
+    struct pass pass;
+    int16_t stereo[MIC_BLOCK_FRAMES * 2];
+    int16_t *mono; /* the 8 kHz samples of the file so far */
+    int mono_num;
+    int pos; /* the oldest sample the mic ring of the record task still holds */
+};
+
+static double timed_start;
+
+static double lap(void)
+{
+    double now = get_time_us();
+    double time_us = now - timed_start;
+
+    timed_start = now;
+
+    return time_us;
+}
+
+static void push_mfcc(struct pipeline *pl, const int16_t *pcm, int frame, double block_end_s, double block_start_us,
+                      struct file_result *r)
+{
+    int row = pl->pass.mfcc_num % CONV_DATA_LEN;
+
+    lap();
+#if MFCC_FIXED_POINT
+    MFCC_mfcc_compute_q7(pcm, pl->features + row * NUM_MFCC_COEFFS);
+    stage_add(STAGE_MFCC, lap());
+#else
+    float mfcc[NUM_MFCC_COEFFS];
+
+    MFCC_mfcc_compute(pcm, mfcc);
+    stage_add(STAGE_MFCC, lap());
+    MFCC_quantize_q7(mfcc, pl->features + row * NUM_MFCC_COEFFS);
+    stage_add(STAGE_QUANTIZE, lap());
+#endif
+    pl->pass.mfcc_num++;
+
+    if (row != CONV_DATA_LEN - 1)
+        return;
+
+    int wakeup_num = pl->pass.wakeup_num;
+
+    run_graph(pl->graph, 1);
+    stage_add(STAGE_GRAPH, lap());
+    pl->pass.run_num++;
+
+    post_process(&pl->post, get_tensor_buffer(get_graph_output_tensor(pl->graph, 0, 0)), frame, &pl->pass);
+    stage_add(STAGE_POST, lap());
+
+    if (pl->pass.wakeup_num > wakeup_num && r->wakeup_num < MAX_WAKEUPS)
+    {
+        r->id[r->wakeup_num] = pl->pass.wakeups[wakeup_num].id;
+        r->wakeup_s[r->wakeup_num] = (double)(frame * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN) / SAMP_FREQ - r->pad_s;
+        r->callback_s[r->wakeup_num] = block_end_s + (get_time_us() - block_start_us) / 1e6 - r->pad_s;
+        r->wakeup_num++;
+    }
+}
+
+/* the record task on the samples the block brought, then the decode task on the rows */
+static void push_block(struct pipeline *pl, const int16_t *pcm, double block_end_s, struct file_result *r)
+{
+    double block_start_us = get_time_us();
+
+    for (int i = 0; i < MIC_BLOCK_FRAMES; i++)
+    {
+        pl->stereo[2 * i] = pcm[i];
+        pl->stereo[2 * i + 1] = pcm[i];
+    }
+
+    timed_start = get_time_us();
+    pl->mono_num += decimator_stereo_to_mono(&pl->decimator, pl->stereo, MIC_BLOCK_FRAMES, pl->mono + pl->mono_num);
+    stage_add(STAGE_DECIMATE, lap());
+
+    if (!use_vad)
+    {
+        for (; pl->pos + MFCC_FRAME_LEN <= pl->mono_num; pl->pos += MFCC_FRAME_SHIFT)
+            push_mfcc(pl, pl->mono + pl->pos, pl->pos / MFCC_FRAME_SHIFT, block_end_s, block_start_us, r);
+        return;
+    }
+
+    struct vad *v = &pl->vad;
+
+    while (pl->pos + (int)(v->held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN) <= pl->mono_num)
+    {
+        const int16_t *window = pl->mono + pl->pos;
+        int release;
+
+        lap();
+        int frame_num = vad_push_frame(v, window + v->held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN - MFCC_FRAME_SHIFT,
+                                       MFCC_FRAME_SHIFT, &release);
+        stage_add(STAGE_VAD, lap());
+
+        for (int i = 0; i < frame_num; i++)
+            push_mfcc(pl, window + i * MFCC_FRAME_SHIFT, pl->pos / MFCC_FRAME_SHIFT + i, block_end_s,
+                      block_start_us, r);
+
+        pl->pos += release * MFCC_FRAME_SHIFT;
+    }
+}
+
+static int replay(struct pipeline *pl, const int16_t *pcm, int sample_num, struct file_result *r)
+{
+    int block_num = sample_num / MIC_BLOCK_FRAMES;
+    int frame_num = block_num * MIC_BLOCK_FRAMES / 2 / MFCC_FRAME_SHIFT + 1;
+
+    pl->mono = malloc(sizeof(int16_t) * block_num * MIC_BLOCK_FRAMES / 2);
+    pl->mono_num = 0;
+    pl->pos = 0;
+
+    if (pl->mono == NULL || stage_reserve(STAGE_DECIMATE, block_num) < 0 || stage_reserve(STAGE_VAD, frame_num) < 0 ||
+        stage_reserve(STAGE_MFCC, frame_num) < 0 || stage_reserve(STAGE_QUANTIZE, frame_num) < 0 ||
+        stage_reserve(STAGE_GRAPH, frame_num / CONV_DATA_LEN) < 0 ||
+        stage_reserve(STAGE_POST, frame_num / CONV_DATA_LEN) < 0)
+    {
+        free(pl->mono);
+        return -1;
+    }
+
+    decimator_init(&pl->decimator);
+    vad_init(&pl->vad, CONV_DATA_LEN, GRAPH_WARMUP_RUNS * CONV_DATA_LEN);
+    post_init(&pl->post, threshold);
+    memset(&pl->pass, 0, sizeof(pl->pass));
+
+    /* the move nodes keep the frames of the previous runs: each file starts with none */
+    reset_graph(pl->graph);
+
+    /* the heap the pipeline takes while streaming, on top of the one it holds */
+    size_t heap_start = heap_in_use;
+
+    heap_peak = heap_in_use;
+
+    for (int i = 0; i < block_num; i++)
+        push_block(pl, pcm + i * MIC_BLOCK_FRAMES, (double)(i + 1) * MIC_BLOCK_FRAMES / MIC_FREQ, r);
+
+    if (heap_peak - heap_start > heap_stream_peak)
+        heap_stream_peak = heap_peak - heap_start;
+
+    free(pl->mono);
+
+    return 0;
+}
+
+static void match_keyword(struct file_result *r)
+{
+    double end_s = r->keyword_end_s;
+
+    r->latency_ms = -1;
+
+    if (end_s < 0)
+        return;
+
+    for (int i = 0; i < r->wakeup_num; i++)
+    {
+        if (r->callback_s[i] >= end_s - (double)MATCH_FRAMES * MFCC_FRAME_SHIFT / SAMP_FREQ)
+        {
+            r->latency_ms = (r->callback_s[i] - end_s) * 1e3;
+            return;
+        }
+    }
+}
+
+static void latency_stat(int *labelled, int *detected, double *mean, double *max)
+{
+    *labelled = *detected = 0;
+    *mean = *max = 0;
+
+    for (int i = 0; i < result_num; i++)
+    {
+        if (results[i].keyword_end_s < 0)
+            continue;
+
+        (*labelled)++;
+        if (results[i].latency_ms < 0)
+            continue;
+
+        (*detected)++;
+        *mean += results[i].latency_ms;
+        if (results[i].latency_ms > *max)
+            *max = results[i].latency_ms;
+    }
+
+    if (*detected)
+        *mean /= *detected;
+}
+
+static double total_time_us(void)
+{
+    double time_us = 0;
+
+    for (int i = 0; i < STAGE_NUM; i++)
+        time_us += stages[i].total;
+
+    return time_us;
+}
+
+static void write_json(FILE *fp)
+{
+    int labelled, detected;
+    double mean, max;
+
+    latency_stat(&labelled, &detected, &mean, &max);
+
+    fprintf(fp, "{\n  \"threshold\": %d,\n  \"vad\": %d,\n  \"hop\": %d,\n", threshold, use_vad, CONV_DATA_LEN);
+    fprintf(fp, "  \"audio_s\": %.3f,\n  \"time_s\": %.6f,\n  \"rtf\": %.6f,\n", audio_total_s,
+            total_time_us() / 1e6, total_time_us() / 1e6 / audio_total_s);
+    fprintf(fp, "  \"heap\": {\"setup_bytes\": %zu, \"stream_peak_bytes\": %zu, \"high_water_bytes\": %zu},\n",
+            heap_setup, heap_stream_peak, heap_setup + heap_stream_peak);
+
+    fprintf(fp, "  \"stages\": {\n");
+    for (int i = 0; i < STAGE_NUM; i++)
+    {
+        struct stage *s = &stages[i];
+
+        fprintf(fp, "    \"%s\": {\"count\": %d, \"mean_us\": %.3f, \"p99_us\": %.3f, \"total_us\": %.1f}%s\n", s->name,
+                s->num, s->num ? s->total / s->num : 0, stage_p99(s), s->total, i + 1 < STAGE_NUM ? "," : "");
+    }
+    fprintf(fp, "  },\n");
+
+    fprintf(fp, "  \"latency_ms\": {\"labelled\": %d, \"detected\": %d, \"mean\": %.1f, \"max\": %.1f},\n", labelled,
+            detected, mean, max);
+
+    fprintf(fp, "  \"files\": [\n");
+    for (int i = 0; i < result_num; i++)
+    {
+        struct file_result *r = &results[i];
+
+        fprintf(fp, "    {\"file\": \"%s\", \"audio_s\": %.3f, ", r->name, r->audio_s);
+        if (r->keyword_end_s >= 0)
+            fprintf(fp, "\"keyword_end_s\": %.3f, ", r->keyword_end_s);
+        else
+            fprintf(fp, "\"keyword_end_s\": null, ");
+        if (r->latency_ms >= 0)
+            fprintf(fp, "\"latency_ms\": %.1f, ", r->latency_ms);
+        else
+            fprintf(fp, "\"latency_ms\": null, ");
+
+        fprintf(fp, "\"wakeups\": [");
+        for (int j = 0; j < r->wakeup_num; j++)
+            fprintf(fp, "%s{\"id\": %d, \"run_end_s\": %.3f, \"callback_s\": %.3f}", j ? ", " : "", r->id[j],
+                    r->wakeup_s[j], r->callback_s[j]);
+        fprintf(fp, "]}%s\n", i + 1 < result_num ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+static void write_csv(FILE *fp)
+{
+    int labelled, detected;
+    double mean, max;
+
+    latency_stat(&labelled, &detected, &mean, &max);
+
+    fprintf(fp, "key,value\n");
+    fprintf(fp, "threshold,%d\nvad,%d\nhop,%d\n", threshold, use_vad, CONV_DATA_LEN);
+    fprintf(fp, "audio_s,%.3f\ntime_s,%.6f\nrtf,%.6f\n", audio_total_s, total_time_us() / 1e6,
+            total_time_us() / 1e6 / audio_total_s);
+    fprintf(fp, "heap.setup_bytes,%zu\nheap.stream_peak_bytes,%zu\nheap.high_water_bytes,%zu\n", heap_setup,
+            heap_stream_peak, heap_setup + heap_stream_peak);
+
+    for (int i = 0; i < STAGE_NUM; i++)
+    {
+        struct stage *s = &stages[i];
+
+        fprintf(fp, "stage.%s.count,%d\nstage.%s.mean_us,%.3f\nstage.%s.p99_us,%.3f\nstage.%s.total_us,%.1f\n",
+                s->name, s->num, s->name, s->num ? s->total / s->num : 0, s->name, stage_p99(s), s->name, s->total);
+    }
+
+    fprintf(fp, "latency_ms.labelled,%d\nlatency_ms.detected,%d\nlatency_ms.mean,%.1f\nlatency_ms.max,%.1f\n",
+            labelled, detected, mean, max);
+
+    for (int i = 0; i < result_num; i++)
+    {
+        struct file_result *r = &results[i];
+
+        fprintf(fp, "file.%s.wakeups,%d\n", r->name, r->wakeup_num);
+        if (r->keyword_end_s >= 0)
+        {
+            if (r->latency_ms >= 0)
+                fprintf(fp, "file.%s.latency_ms,%.1f\n", r->name, r->latency_ms);
+            else
+                fprintf(fp, "file.%s.latency_ms,miss\n", r->name);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    double silence_s = 1;
+    const char *format = "json";
+    const char *out_file = NULL;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-s") == 0)
+            silence_s = atof(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-t") == 0)
+            threshold = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-v") == 0)
+            use_vad = atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-f") == 0)
+            format = argv[arg + 1];
+        else if (strcmp(argv[arg], "-o") == 0)
+            out_file = argv[arg + 1];
+        else
+            break;
+    }
+
+    if (arg >= argc || (strcmp(format, "json") && strcmp(format, "csv")))
+    {
+        printf("usage: %s [-s silence_s] [-t threshold] [-v vad] [-f json|csv] [-o out_file] <16 bit pcm wav>[@s] ...\n",
+               argv[0]);
+        return -1;
+    }
+
+    if (out_file == NULL)
+        out_file = strcmp(format, "json") ? "stream_bench.csv" : "stream_bench.json";
+
+    size_t heap_start = heap_in_use;
+    struct pipeline *pl = calloc(1, sizeof(struct pipeline));
+
+    init_tengine();
+
+    const void *tiny_graph = get_tiny_graph();
+
+    pl->graph = create_graph(NULL, "tiny", (void *)tiny_graph);
+    if (pl->graph == NULL || prerun_graph(pl->graph) < 0)
+    {
+        printf("cannot load the tiny graph\n");
+        return -1;
+    }
+
+    tensor_t input_tensor = get_graph_input_tensor(pl->graph, 0, 0);
+    int input_size = get_tensor_buffer_size(input_tensor);
+
+    if (input_size != NUM_MFCC_COEFFS * CONV_DATA_LEN)
+    {
+        printf("input tensor size %d is not %d mfcc frames\n", input_size, CONV_DATA_LEN);
+        return -1;
+    }
+
+    /* the q7 format of command_recognition.c */
+    float input_scale = 1.0f;
+    int input_zero_point = 0;
+    int input_shift = 0;
+    int8_t frac_bits[NUM_MFCC_COEFFS];
+
+    if (get_tensor_quant_param(input_tensor, &input_scale, &input_zero_point, 1) == 1)
+    {
+        while ((1 << input_shift) < input_scale)
+            input_shift++;
+    }
+
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        frac_bits[i] = (i == 0 ? 0 : 1) + input_shift;
+
+    MFCC_init();
+    MFCC_set_q7_format(frac_bits);
+
+    pl->features = malloc(input_size);
+    set_tensor_buffer(input_tensor, pl->features, input_size);
+
+    heap_setup = heap_in_use - heap_start;
+
+    unsigned int seed = 1;
+    int ret = 0;
+
+    for (; arg < argc && result_num < MAX_FILES; arg++)
+    {
+        struct file_result *r = &results[result_num];
+        char *label = strrchr(argv[arg], '@');
+        int sample_num = 0;
+
+        r->name = argv[arg];
+        r->keyword_end_s = -1;
+        if (label != NULL)
+        {
+            *label = '\0';
+            r->keyword_end_s = atof(label + 1);
+        }
+
+        int16_t *wav = load_wav(r->name, MIC_FREQ, 1.0f, &sample_num);
+
+        if (wav == NULL || sample_num < MFCC_FRAME_LEN * 2)
+        {
+            printf("cannot load %s\n", r->name);
+            free(wav);
+            ret = -1;
+            continue;
+        }
+
+        int pad_num = (int)(silence_s * MIC_FREQ);
+        int16_t *pcm = pad_silence(wav, sample_num, pad_num, &seed);
+
+        sample_num += 2 * pad_num;
+        r->audio_s = (double)(sample_num / MIC_BLOCK_FRAMES * MIC_BLOCK_FRAMES) / MIC_FREQ;
+        r->pad_s = (double)pad_num / MIC_FREQ;
+        audio_total_s += r->audio_s;
+
+        if (pcm == NULL || replay(pl, pcm, sample_num, r) < 0)
+        {
+            printf("out of memory for %s\n", r->name);
+            free(pcm);
+            free(wav);
+            ret = -1;
+            continue;
+        }
+
+        match_keyword(r);
+        result_num++;
+
+        printf("%s: %.2f s, %d runs, %d wake ups", r->name, r->audio_s, pl->pass.run_num, r->wakeup_num);
+        if (r->keyword_end_s >= 0)
+        {
+            if (r->latency_ms >= 0)
+                printf(", keyword to callback %.1f ms", r->latency_ms);
+            else
+                printf(", keyword missed");
+        }
+        printf("\n");
+
+        free(pcm);
+        free(wav);
+    }
+
+    if (result_num)
+    {
+        FILE *fp = fopen(out_file, "w");
+
+        if (fp == NULL)
+        {
+            printf("cannot write %s\n", out_file);
+            ret = -1;
+        }
+        else
+        {
+            if (strcmp(format, "json") == 0)
+                write_json(fp);
+            else
+                write_csv(fp);
+            fclose(fp);
+
+            printf("%.2f s of audio, real time factor %.4f, heap high water %zu bytes: %s\n", audio_total_s,
+                   total_time_us() / 1e6 / audio_total_s, heap_setup + heap_stream_peak, out_file);
+        }
+    }
+
+    for (int i = 0; i < STAGE_NUM; i++)
+        free(stages[i].time);
+    free(pl->features);
+    MFCC_delete();
+    postrun_graph(pl->graph);
+    destroy_graph(pl->graph);
+    free_tiny_graph(tiny_graph);
+    free(pl);
+    release_tengine();
+
+    return ret;
+}
@@ -0,0 +1,229 @@
+/*
+ * Host replay of the aid_speech voice activity gate on a set of wav files.
+ *
+ * Each file goes twice through the pipeline of command_recognition.c: the q7 mfcc, the graph on
+ * every CONV_DATA_LEN frames, the score smoothing and the wake up logic of PostProcess(). Once
+ * with every frame, once through vad_push_frame() as the record task calls it. For each file
+ * the frames the gate skipped, the mfcc and graph runs and their time are printed, then the
+ * wake ups of the two passes: the ones the gate lost or added are the detection delta.
+ *
+ * silence_s seconds of low noise are put before and after each file, for a room where
+ * nobody speaks most of the time.
+ *
+ * The gate keeps the warm up of the model and the run alignment of the ungated pass, so the two passes
+ * only differ where frames were skipped: a wake up the gate lost in the silence was a false one.
+ *
+ * Build, with APP the aid_speech directory, TENGINE the tengine-lite directory and TENGINE_LIB
+ * its library built for the host with the tiny serializer and the cmsis ops, and CMSIS_DSP /
+ * CMSIS_NN the libraries for the host:
+ *
+ *   gcc -O2 -I$APP/Inc -I<CMSIS-DSP>/Include -I<CMSIS-NN>/Include -I$TENGINE/include \
+ *       Scripts/vad_replay.c $APP/Src/vad.c $APP/Src/mfcc.c $APP/Src/kws_score.c \
+ *       $TENGINE/tests/bin/tiny/tiny_graph_generated.c $TENGINE_LIB $CMSIS_NN $CMSIS_DSP -lm -lpthread -o vad_replay
+ *
+ * Usage: vad_replay [-s silence_s] [-t threshold] <16 bit pcm wav> ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cnn.h"
+#include "mfcc.h"
+#include "vad.h"
+#include "tengine_c_api.h"
+#include "wav_load.h"
+#include "kws_post.h"
+
+extern const void *get_tiny_graph(void);
+extern void free_tiny_graph(const void *);
+
+static int threshold = 90;
+
+/* frame is the index of the mfcc frame in the file, for the wake up times */
+static void push_mfcc(graph_t graph, q7_t *features, const int16_t *pcm, int frame, struct post *p, struct pass *pass)
+{
+    int row = pass->mfcc_num % CONV_DATA_LEN;
+
+    MFCC_mfcc_compute_q7(pcm, features + row * NUM_MFCC_COEFFS);
+    pass->mfcc_num++;
+
+    if (row == CONV_DATA_LEN - 1)
+    {
+        tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+
+        run_graph(graph, 1);
+        pass->run_num++;
+
+        post_process(p, get_tensor_buffer(output_tensor), frame, pass);
+    }
+}
+
+static void replay(graph_t graph, q7_t *features, const int16_t *pcm, int sample_num, int use_vad,
+                   struct vad *v, struct pass *pass)
+{
+    struct post p;
+
+    post_init(&p, threshold);
+    memset(pass, 0, sizeof(*pass));
+
+    /* the move nodes keep the frames of the previous runs: each pass starts with none */
+    reset_graph(graph);
+
+    double start = get_time_us();
+
+    if (!use_vad)
+    {
+        for (int pos = 0; pos + MFCC_FRAME_LEN <= sample_num; pos += MFCC_FRAME_SHIFT)
+            push_mfcc(graph, features, pcm + pos, pos / MFCC_FRAME_SHIFT, &p, pass);
+    }
+    else
+    {
+        /* pos is the oldest frame still in the mic ring, the held back ones follow it */
+        vad_init(v, CONV_DATA_LEN, GRAPH_WARMUP_RUNS * CONV_DATA_LEN);
+
+        for (int pos = 0; pos + (v->held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN) <= sample_num;)
+        {
+            const int16_t *window = pcm + pos;
+            int release;
+            int frame_num = vad_push_frame(v, window + v->held * MFCC_FRAME_SHIFT + MFCC_FRAME_LEN - MFCC_FRAME_SHIFT,
+                                           MFCC_FRAME_SHIFT, &release);
+
+            for (int i = 0; i < frame_num; i++)
+                push_mfcc(graph, features, window + i * MFCC_FRAME_SHIFT, pos / MFCC_FRAME_SHIFT + i, &p, pass);
+
+            pos += release * MFCC_FRAME_SHIFT;
+        }
+    }
+
+    pass->time_us = get_time_us() - start;
+}
+
+int main(int argc, char *argv[])
+{
+    double silence_s = 5;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-s") == 0)
+            silence_s = atof(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-t") == 0)
+            threshold = atoi(argv[arg + 1]);
+        else
+            break;
+    }
+
+    if (arg >= argc)
+    {
+        printf("usage: %s [-s silence_s] [-t threshold] <16 bit pcm wav> ...\n", argv[0]);
+        return -1;
+    }
+
+    init_tengine();
+
+    const void *tiny_graph = get_tiny_graph();
+    graph_t graph = create_graph(NULL, "tiny", (void *)tiny_graph);
+
+    if (graph == NULL || prerun_graph(graph) < 0)
+    {
+        printf("cannot load the tiny graph\n");
+        return -1;
+    }
+
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    int input_size = get_tensor_buffer_size(input_tensor);
+
+    if (input_size != NUM_MFCC_COEFFS * CONV_DATA_LEN)
+    {
+        printf("input tensor size %d is not %d mfcc frames\n", input_size, CONV_DATA_LEN);
+        return -1;
+    }
+
+    /* the q7 format of command_recognition.c */
+    float input_scale = 1.0f;
+    int input_zero_point = 0;
+    int input_shift = 0;
+    int8_t frac_bits[NUM_MFCC_COEFFS];
+
+    if (get_tensor_quant_param(input_tensor, &input_scale, &input_zero_point, 1) == 1)
+    {
+        while ((1 << input_shift) < input_scale)
+            input_shift++;
+    }
+
+    for (int i = 0; i < NUM_MFCC_COEFFS; i++)
+        frac_bits[i] = (i == 0 ? 0 : 1) + input_shift;
+
+    MFCC_init();
+    MFCC_set_q7_format(frac_bits);
+
+    q7_t *features = malloc(input_size);
+    set_tensor_buffer(input_tensor, features, input_size);
+
+    unsigned int seed = 1;
+    struct pass *all = calloc(1, sizeof(struct pass));
+    struct pass *gated = calloc(1, sizeof(struct pass));
+    double total_time[2] = {0, 0};
+    int total_frames = 0, total_skipped = 0;
+    int total_wakeups = 0, total_lost = 0, total_added = 0;
+    int ret = 0;
+
+    printf("file  frames  skipped  mfcc  runs  time (us) ungated/gated  wake ups ungated/gated\n");
+
+    for (; arg < argc; arg++)
+    {
+        int sample_num = 0;
+        int16_t *wav = load_wav(argv[arg], SAMP_FREQ, 1.0f, &sample_num);
+
+        if (wav == NULL || sample_num < MFCC_FRAME_LEN)
+        {
+            printf("cannot load %s\n", argv[arg]);
+            free(wav);
+            ret = -1;
+            continue;
+        }
+
+        int pad_num = (int)(silence_s * SAMP_FREQ);
+        int16_t *pcm = pad_silence(wav, sample_num, pad_num, &seed);
+        struct vad v;
+
+        sample_num += 2 * pad_num;
+
+        replay(graph, features, pcm, sample_num, 0, &v, all);
+        replay(graph, features, pcm, sample_num, 1, &v, gated);
+
+        printf("%s  %d  %d (%.1f%%)  %d/%d  %d/%d  %.0f/%.0f  %d/%d\n", argv[arg], v.frame_num, v.skipped_num,
+               100.0 * v.skipped_num / v.frame_num, all->mfcc_num, gated->mfcc_num, all->run_num,
+               gated->run_num, all->time_us, gated->time_us, all->wakeup_num, gated->wakeup_num);
+
+        total_lost += unmatched(all, gated, 1, "lost");
+        total_added += unmatched(gated, all, 1, "added");
+        total_wakeups += all->wakeup_num;
+        total_frames += v.frame_num;
+        total_skipped += v.skipped_num;
+        total_time[0] += all->time_us;
+        total_time[1] += gated->time_us;
+
+        free(pcm);
+        free(wav);
+    }
+
+    if (total_frames)
+    {
+        printf("skipped %d of %d frames (%.1f%%), cpu saved %.1f%%\n", total_skipped, total_frames,
+               100.0 * total_skipped / total_frames, 100.0 * (1 - total_time[1] / total_time[0]));
+        printf("wake ups: %d ungated, %d lost and %d added by the gate\n", total_wakeups, total_lost, total_added);
+    }
+
+    free(gated);
+    free(all);
+    free(features);
+    MFCC_delete();
+    postrun_graph(graph);
+    destroy_graph(graph);
+    free_tiny_graph(tiny_graph);
+    release_tengine();
+
+    return ret;
+}
@@ -0,0 +1,82 @@
+/*
+ * The wav loader of the host tools: 16 bit pcm, the first channel, resampled to out_rate
+ * by linear interpolation and scaled by gain. Return a malloc'ed buffer, NULL on failure.
+ */
+
+#ifndef WAV_LOAD_H
+#define WAV_LOAD_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int16_t *load_wav(const char *fname, int out_rate, float gain, int *sample_num)
+{
+    FILE *fp = fopen(fname, "rb");
+    char id[4];
+    uint32_t size;
+    uint16_t fmt[8];
+    int16_t *pcm = NULL;
+
+    if (fp == NULL)
+        return NULL;
+
+    /* RIFF header, then the chunks until "data" */
+    fseek(fp, 12, SEEK_SET);
+    memset(fmt, 0, sizeof(fmt));
+
+    while (fread(id, 1, 4, fp) == 4 && fread(&size, 4, 1, fp) == 1)
+    {
+        if (memcmp(id, "fmt ", 4) == 0 && size >= 16)
+        {
+            fread(fmt, 1, 16, fp);
+            fseek(fp, size - 16, SEEK_CUR);
+            continue;
+        }
+
+        if (memcmp(id, "data", 4))
+        {
+            fseek(fp, size, SEEK_CUR);
+            continue;
+        }
+
+        int channels = fmt[1];
+        uint32_t rate = fmt[2] | ((uint32_t)fmt[3] << 16);
+
+        if (fmt[0] != 1 || fmt[7] != 16 || channels == 0 || rate == 0)
+            break;
+
+        int frame_num = size / (2 * channels);
+        int16_t *raw = malloc(size);
+
+        if (raw == NULL || fread(raw, 2 * channels, frame_num, fp) != (size_t)frame_num)
+        {
+            free(raw);
+            break;
+        }
+
+        /* linear interpolation to out_rate, on the first channel */
+        *sample_num = (int)((int64_t)(frame_num - 1) * out_rate / rate);
+        pcm = malloc(sizeof(int16_t) * *sample_num);
+
+        for (int i = 0; pcm && i < *sample_num; i++)
+        {
+            double pos = (double)i * rate / out_rate;
+            int idx = (int)pos;
+            double v = raw[idx * channels] + (pos - idx) * (raw[(idx + 1) * channels] - raw[idx * channels]);
+
+            v *= gain;
+            pcm[i] = (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : v));
+        }
+
+        free(raw);
+        break;
+    }
+
+    fclose(fp);
+
+    return pcm;
+}
+
+#endif
@@ -33,8 +33,9 @@ struct exec_scheduler
 
     int (*prerun)(struct exec_scheduler*, struct ir_graph*, int num_thread);
     int (*run)(struct exec_scheduler*, struct ir_graph*, int block);
-    int (*wait)(struct exec_scheduler*, struct ir_graph*);
+    int (*wait)(struct exec_scheduler*, struct ir_graph*, int try_wait);
     int (*postrun)(struct exec_scheduler*, struct ir_graph*);
+    int (*reset)(struct exec_scheduler*, struct ir_graph*);
     void (*release)(struct exec_scheduler*);
 };
 
@@ -26,6 +26,8 @@
 #define __NN_DEVICE_H__
 
 struct subgraph;
+struct perf_info;
+struct tune_info;
 
 struct nn_device
 {
@@ -39,6 +41,12 @@ struct nn_device
     int (*async_wait)(struct nn_device* dev, struct subgraph* subgraph, int try_wait);
     int (*release)(struct nn_device* dev);
     int (*release_exec_graph)(struct nn_device* dev, void* exec_graph);
+    int (*reset)(struct nn_device* dev, struct subgraph* subgraph);
+    int (*perf_stat)(struct nn_device* dev, struct subgraph* subgraph, int action);
+    int (*get_perf_stat)(struct nn_device* dev, struct subgraph* subgraph, struct perf_info** buf, int buf_size);
+    int (*get_tune_log)(struct nn_device* dev, struct subgraph* subgraph, struct tune_info** buf, int buf_size);
+    int (*save_tune_cache)(struct nn_device* dev, void* buf, int buf_size);
+    int (*load_tune_cache)(struct nn_device* dev, const void* buf, int size);
 };
 
 extern struct nn_device* get_nn_device_by_name(const char* name);
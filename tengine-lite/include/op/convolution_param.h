@@ -41,6 +41,8 @@ struct conv_param
     int output_channel;
     int group;
     int activation;
+    int stream; /* input rows arrive in chunks: keep the history and compute the new output rows only */
+    int stream_window; /* set by infer_shape: output rows kept for a non streaming consumer, 0 for none */
 };
 
 #endif
@@ -25,16 +25,22 @@
 #ifndef __MV_PARAM_H__
 #define __MV_PARAM_H__
 
+/* a move node with flag set outputs MV_FLAG_WARMUP_ROWS rows until it has been fed
+   more than that, MV_FLAG_ROWS rows afterwards, and waits for MV_FLAG_FILL_SIZE bytes */
+#define MV_FLAG_WARMUP_ROWS 8
+#define MV_FLAG_ROWS 10
+#define MV_FLAG_FILL_SIZE 768
+
 struct mv_param
 {
     int start_mv_addr;
     int mv_size;
-    int current_buffer_size;
+    int current_buffer_size; /* bytes already in the buffer when the node is bound */
     int buffer_size;
     int buffer_out_size;
     int tmp_buffer_out_size ;
     int flag ;	
-	void* buffer ; 
+    int fed_rows; /* input rows seen by infer_shape, when flag is set */
 };
 
 #endif
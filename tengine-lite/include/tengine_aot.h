@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#ifndef __TENGINE_AOT_H__
+#define __TENGINE_AOT_H__
+
+#include <stdint.h>
+
+#include "tengine_c_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ahead-of-time execution plan
+ *
+ * build_aot_plan() takes a graph after prerun_graph() and records what prerun decided:
+ * the kernel of each node, the activation offsets, the quant shifts and the shared memory size,
+ * together with the const tensor data. The plan is position independent, so it can be saved
+ * as a const array and placed in flash.
+ *
+ * On target, bind_aot_graph() lays out one caller provided arena and run_aot_graph() executes
+ * the plan: no graph is created, and nothing is allocated from the heap.
+ */
+
+#define AOT_PLAN_MAGIC 0x544f4154 /* "TAOT" */
+#define AOT_PLAN_VERSION 4
+
+#define AOT_MAX_INPUT_NUM 3
+#define AOT_MAX_PARAM_NUM 11
+#define AOT_ALIGN_SIZE 16
+
+/* kernel ids */
+#define AOT_KERNEL_CONV_Q7 1
+#define AOT_KERNEL_FC_Q7 2
+#define AOT_KERNEL_RELU_Q7 3
+#define AOT_KERNEL_SOFTMAX_Q7 4
+#define AOT_KERNEL_MAXPOOL_Q7 5
+#define AOT_KERNEL_MOVE_Q7 6
+#define AOT_KERNEL_CONV1D_Q7 7 /* a conv whose kernel covers the input width, no im2col */
+
+/* where the tensor data lives */
+#define AOT_TENSOR_CONST 0 /* offset in the plan data section */
+#define AOT_TENSOR_VAR 1 /* offset in the activation area */
+
+/* param layout of AOT_KERNEL_CONV_Q7, AOT_KERNEL_CONV1D_Q7 and AOT_KERNEL_MAXPOOL_Q7 */
+#define AOT_PARAM_KERNEL_H 0
+#define AOT_PARAM_KERNEL_W 1
+#define AOT_PARAM_STRIDE_H 2
+#define AOT_PARAM_STRIDE_W 3
+#define AOT_PARAM_PAD_H0 4
+#define AOT_PARAM_PAD_H1 5
+#define AOT_PARAM_PAD_W0 6
+#define AOT_PARAM_PAD_W1 7
+#define AOT_PARAM_STREAM 8 /* conv only: bytes of the input row history of a stream conv, 0 if not */
+#define AOT_PARAM_STREAM_WINDOW 9 /* conv only: output rows kept for a fc */
+
+/* param of AOT_KERNEL_CONV_Q7, AOT_KERNEL_CONV1D_Q7 and AOT_KERNEL_FC_Q7 */
+#define AOT_PARAM_RELU 10 /* 1 if a relu is folded in: the output is clamped at 0 */
+
+/* param layout of AOT_KERNEL_MOVE_Q7 */
+#define AOT_PARAM_MV_START 0
+#define AOT_PARAM_MV_SIZE 1
+#define AOT_PARAM_MV_BUFFER_SIZE 2
+#define AOT_PARAM_MV_FLAG 3
+#define AOT_PARAM_MV_FILL_SIZE 4
+#define AOT_PARAM_MV_WARMUP_ROWS 5
+#define AOT_PARAM_MV_ROWS 6
+#define AOT_PARAM_MV_INIT_SIZE 7 /* current_buffer_size when bound */
+#define AOT_PARAM_MV_INIT_ROWS 8 /* fed_rows when bound */
+
+struct aot_tensor
+{
+    int32_t offset;
+    int32_t dims[4]; /* dims after prerun, NHWC */
+    uint8_t dim_num;
+    uint8_t mem_type;
+    uint16_t reserved;
+};
+
+struct aot_step
+{
+    uint8_t kernel;
+    uint8_t input_num;
+    int16_t input[AOT_MAX_INPUT_NUM];
+    int16_t output;
+    uint16_t bias_shift;
+    uint16_t out_shift;
+    int32_t state_offset; /* streaming state, move kernel and stream conv only */
+    int32_t param[AOT_MAX_PARAM_NUM];
+};
+
+/* streaming state of a move kernel, followed by its buffer */
+struct aot_move_state
+{
+    int32_t current_buffer_size;
+    int32_t fed_rows;
+};
+
+/* streaming state of a stream conv, followed by its history and its window */
+struct aot_conv_state
+{
+    int32_t history_rows;
+    int32_t window_rows;
+};
+
+struct aot_plan
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t step_num;
+    uint16_t tensor_num;
+    int16_t input_tensor;
+    int16_t output_tensor;
+    int16_t input_shift; /* fraction bits of the q7 input: log2 of the input tensor scale */
+
+    int32_t size; /* the whole plan */
+    int32_t act_size; /* activations, including the input */
+    int32_t shared_mem_size; /* the im2col and vec_buffer scratch of the conv and fc kernels */
+    int32_t state_size;
+
+    int32_t step_offset;
+    int32_t tensor_offset;
+    int32_t data_offset;
+};
+
+typedef void* aot_graph_t;
+
+/* host side: graph must be prerun and not run yet. Release the plan by free_aot_plan() */
+int build_aot_plan(graph_t graph, void** plan, int* plan_size);
+
+void free_aot_plan(void* plan);
+
+/* host side: write the plan as a C source file defining "const uint32_t <var_name>[]" */
+int save_aot_plan(const void* plan, const char* var_name, const char* fname);
+
+/* target side */
+int get_aot_arena_size(const void* plan);
+
+aot_graph_t bind_aot_graph(const void* plan, void* arena, int arena_size);
+
+void* get_aot_input_buffer(aot_graph_t graph, int* size);
+
+void* get_aot_output_buffer(aot_graph_t graph, int* size);
+
+int run_aot_graph(aot_graph_t graph);
+
+/* drop the streaming state: the next run behaves as the first one after bind_aot_graph() */
+int reset_aot_graph(aot_graph_t graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -67,6 +67,14 @@ extern "C" {
 #define GRAPH_PERF_STAT_RESET 4
 #define GRAPH_PERF_STAT_GET 5
 
+/* cpu isa features of the kernel variants, an int mask of them is the "cpu_isa" graph attr */
+#define CPU_ISA_SSE41 0x1
+#define CPU_ISA_AVX2 0x2
+#define CPU_ISA_AVX512_VNNI 0x4
+
+/* the node ops timed on one node at most, see struct tune_info */
+#define MAX_TUNE_CAND_NUM 8
+
 /* follow the std. UNIX log level definitioin */
 enum log_level
 {
@@ -127,8 +135,28 @@ struct perf_info
     uint32_t max;
     uint64_t total_time; /* us or cycle, depends on devices */
     uint32_t base; /* 1ms second time number */
+    const char* op_name;
+    int node_idx;
+    uint64_t total_bytes; /* tensor bytes read and written, including the weights */
+};
+
+/* the node ops the "cpu_tune" graph attr chose for one node, see get_graph_tune_log() */
+struct tune_info
+{
+    const char* name; /* node name */
+    const char* op_name;
+    int node_idx;
+    int cand_num; /* the node ops timed on the node, highest score first */
+    int selected; /* the fastest of them, the one the node runs */
+    int cached; /* chosen by an earlier prerun of the same model and shape, not timed again */
+    const char* cand_name[MAX_TUNE_CAND_NUM];
+    uint32_t cand_time[MAX_TUNE_CAND_NUM]; /* of the same number of runs for each, perf clock ticks */
+    uint32_t base; /* 1ms second time number */
 };
 
+/* a free running counter for the perf stats, see set_perf_clock() */
+typedef uint32_t (*perf_clock_t)(void);
+
 struct custom_kernel_tensor
 {
     int dim[MAX_SHAPE_DIM_NUM]; /* the shape dim array */
@@ -395,6 +423,7 @@ graph_t merge_graph(int graph_num, graph_t graph0, graph_t graph1, ...);
 
 /*!
  * @brief Destory the runtime graph and release allocated resource.
+ *        A graph still prerun is postrun first, waiting for a run in flight.
  *
  * @param [in] graph: The graph handle.
  * @return 0: Success, -1: Fail.
@@ -922,6 +951,13 @@ int get_tensor_quant_param(tensor_t tensor, float* scale, int* zero_point, int n
 /*!
  * @brief The interface to set some proprietary attribute items for graph.
  *        The backend device to run the graph may use the attribute item.
+ *        The cpu device takes "cpu_isa", an int of CPU_ISA_* bits: set before prerun_graph(),
+ *        the node ops may only use these of the probed features, e.g. CPU_ISA_SSE41 to time the
+ *        SSE4.1 kernels on an AVX2 cpu.
+ *        With the int "cpu_tune" set to 1, prerun_graph() times each node ops able to run a node
+ *        on its shape and keeps the fastest, see get_graph_tune_log(). The choices are cached
+ *        by model and shape, so the next prerun of the same model does not time them again;
+ *        save_tune_cache() and load_tune_cache() carry them over to a later process.
  *
  * @param [in] graph: The graph handle.
  * @param [in] attr_name: The attribute name.
@@ -986,6 +1022,8 @@ int prerun_graph(graph_t graph);
  * @param [in] block: Blocking or nonlocking.
  * @return 0: Success, -1: Fail.
  * @note  If block is 0, need to call wait_graph to get result or set GRAPH_DONE event hook.
+ *        Non block run needs the "async" scheduler, see set_context_attr. The input buffers must
+ *        be left untouched until the graph is waited.
  *
  */
 int run_graph(graph_t graph, int block);
@@ -997,10 +1035,36 @@ int run_graph(graph_t graph, int block);
  * @param [in] try_wait: If set, just check status and return.
  * @return  1: Graph is done.
  *          0: Try again.
+ *         -1: Fail, e.g. the run failed or the graph was not run.
  *
  */
 int wait_graph(graph_t graph, int try_wait);
 
+/*!
+ * @brief Drop the streaming state of a graph, e.g. the history of move nodes and stream convs.
+ *        The next run behaves as the first run after prerun_graph.
+ *
+ * @param [in] graph: The graph handle.
+ * @return 0: Success, -1: Fail.
+ * @note  The graph must be prerun and not running.
+ */
+int reset_graph(graph_t graph);
+
+/*!
+ * @brief Let the next runs of a streaming graph take several chunks of input rows at once, e.g. to catch up
+ *        with a stream after falling behind. The chunks follow each other from the buffers set to the input
+ *        tensors, each one of the size of the tensor. The nodes up to the last one keeping state, the move
+ *        nodes and the stream convs, run on each chunk in turn; the nodes after it run once, on the last
+ *        chunk. The state is the one of as many runs, the outputs the ones of the last of them.
+ *
+ * @param [in] graph: The graph handle.
+ * @param [in] chunk_num: The chunks of each run, 1 by default.
+ * @return 0: Success, -1: Fail.
+ * @note  The graph must be prerun and not running, and run on one device. The memory after the buffer of
+ *        each input tensor must hold the other chunk_num - 1 chunks.
+ */
+int set_graph_stream_chunks(graph_t graph, int chunk_num);
+
 /*!
  * @brief Release the resource for graph execution.
  * @param [in] graph: graph handle.
@@ -1015,6 +1079,7 @@ int postrun_graph(graph_t graph);
  * @param [in] graph: The graph handle.
  *
  * @return status
+ * @note  After a non block run, the status stays GRAPH_STAT_RUNNING until wait_graph sees it done.
  */
 int get_graph_exec_status(graph_t graph);
 
@@ -1106,9 +1171,13 @@ int get_node_dump_buffer(node_t node, void** buf, int buf_size);
  * @brief Start or stop the perf stats
  *
  * @param [in] graph: the graph handle
- * @param [in] action: 0 stop, 1 start, 2 reset counter
+ * @param [in] action: GRAPH_PERF_STAT_ENABLE allocates the records and starts,
+ *                     GRAPH_PERF_STAT_DISABLE releases them,
+ *                     GRAPH_PERF_STAT_STOP/START pause and resume,
+ *                     GRAPH_PERF_STAT_RESET clears the counters
  *
  * @return 0 success, -1 fail
+ * @note  The graph must be prerun. There is one record for every node run by a device.
  */
 
 int do_graph_perf_stat(graph_t graph, int action);
@@ -1127,6 +1196,78 @@ int do_graph_perf_stat(graph_t graph, int action);
 
 int get_graph_perf_stat(graph_t graph, struct perf_info** buf, int buf_size);
 
+/*!
+ * @brief dump the perf stats of a graph to the log, in run order
+ *
+ * @param [in] graph: the graph handle
+ * @param [in] csv: 0 for a text table, 1 for csv lines
+ *
+ * @return 0 success, -1 fail
+ */
+
+int dump_graph_perf_stat(graph_t graph, int csv);
+
+/*!
+ * @brief get the node ops chosen by the "cpu_tune" graph attr, one record per node which had
+ *        more than one to choose from
+ *
+ * @param [in] graph: the graph handle
+ * @param [out] buf: the pointer array to struct tune_info buffer
+ * @param [in] buf_size: the pointer array size
+ *
+ * @return the number of records, 0 when the graph was not tuned, -1 on error.
+ */
+int get_graph_tune_log(graph_t graph, struct tune_info** buf, int buf_size);
+
+/*!
+ * @brief dump the tune log of a graph to the log, see get_graph_tune_log()
+ *
+ * @param [in] graph: the graph handle
+ *
+ * @return 0: Success, -1: Fail.
+ */
+int dump_graph_tune_log(graph_t graph);
+
+/*!
+ * @brief save the node ops choices a device cached for the "cpu_tune" graph attr, so that a later
+ *        process gets them by load_tune_cache() instead of timing the nodes again
+ *
+ * @param [in] dev_name: the device name, e.g. "cpu_dev"
+ * @param [out] buf: the blob buffer, or NULL to get the blob size
+ * @param [in] buf_size: the buffer size
+ *
+ * @return the blob size, -1 on error or when buf is too small.
+ */
+int save_tune_cache(const char* dev_name, void* buf, int buf_size);
+
+/*!
+ * @brief add the choices of a blob of save_tune_cache() to the cache of a device. The entries of
+ *        node ops the device has not are skipped when a prerun looks them up.
+ *
+ * @param [in] dev_name: the device name, e.g. "cpu_dev"
+ * @param [in] buf: the blob
+ * @param [in] size: the blob size
+ *
+ * @return the number of entries added, -1 on error.
+ */
+int load_tune_cache(const char* dev_name, const void* buf, int size);
+
+/*!
+ * @brief set the clock of the perf stats
+ *
+ * @param [in] clock: returns a free running 32bit counter, NULL keeps the current one
+ *                    (the DWT cycle counter on Cortex-M, us on Linux)
+ * @param [in] base: the counts in 1ms, 0 if unknown
+ *
+ * @return 0 success, -1 fail
+ */
+
+int set_perf_clock(perf_clock_t clock, uint32_t base);
+
+uint32_t read_perf_clock(void);
+
+uint32_t get_perf_clock_base(void);
+
 /*!
  * @brief Get the device number in the system.
  *
@@ -1282,6 +1423,7 @@ int remove_context_device(context_t context, const char* dev_name);
  * @param [in] val: The buffer to hold the data to set.
  * @param [in] size: The buffer size.
  * @return 0: Success, -1: Fail.
+ * @note  "scheduler": the string "sync" (default) or "async", set before the graphs are prerun.
  */
 int set_context_attr(context_t context, const char* attr_name, const void* val, int val_size);
 
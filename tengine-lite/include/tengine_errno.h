@@ -32,6 +32,7 @@
 #define ENOENT 102
 #define EAGAIN 111
 #define EFAULT 114
+#define EBUSY 116
 #define EEXIST 117
 #define ENOSPC 128
 #define ENODATA 161
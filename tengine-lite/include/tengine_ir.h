@@ -181,6 +181,7 @@ struct ir_graph
 
     uint8_t attr_num;
     uint8_t status;
+    uint8_t stream_chunk_num; /* chunks of input rows each run takes, see set_graph_stream_chunks() */
 
     struct serializer* serializer;
     void* serializer_priv; /* serializer saved content */
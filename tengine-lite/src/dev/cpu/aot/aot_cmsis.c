@@ -0,0 +1,457 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_aot.h"
+#include "conv1d_q7.h"
+
+#define ARENA_ALIGN(size) (((size) + AOT_ALIGN_SIZE - 1) & ~(AOT_ALIGN_SIZE - 1))
+
+arm_status arm_convolve_HWC_q7_nonsquare(const q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                         const uint16_t ch_im_in, const q7_t* wt, const uint16_t ch_im_out,
+                                         const uint16_t dim_kernel_x, const uint16_t dim_kernel_y,
+                                         const uint16_t padding_x, const uint16_t padding_y, const uint16_t stride_x,
+                                         const uint16_t stride_y, const q7_t* bias, const uint16_t bias_shift,
+                                         const uint16_t out_shift, q7_t* Im_out, const uint16_t dim_im_out_x,
+                                         const uint16_t dim_im_out_y, q15_t* bufferA, q7_t* bufferB);
+
+arm_status arm_fully_connected_q7(const q7_t* pV, const q7_t* pM, const uint16_t dim_vec, const uint16_t num_of_rows,
+                                  const uint16_t bias_shift, const uint16_t out_shift, const q7_t* bias, q7_t* pOut,
+                                  q15_t* vec_buffer);
+
+void arm_maxpool_HWC_q7_nonsquare(q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                  const uint16_t ch_im_in, const uint16_t dim_kernel, const uint16_t padding,
+                                  const uint16_t stride, const uint16_t dim_im_out_x, const uint16_t dim_im_out_y,
+                                  q7_t* bufferA, q7_t* Im_out);
+
+void arm_relu_q7(q7_t* data, uint16_t size);
+
+/* the head of the arena */
+struct aot_graph
+{
+    const struct aot_plan* plan;
+    const struct aot_step* steps;
+    const struct aot_tensor* tensors;
+    const char* data;
+
+    int32_t (*dims)[4]; /* the current dims of each tensor */
+    char* state;
+    char* act;
+    void* shared_mem;
+};
+
+static int get_arena_layout(const struct aot_plan* plan, int* dims_offset, int* state_offset, int* act_offset,
+                            int* shared_offset)
+{
+    int size = ARENA_ALIGN(sizeof(struct aot_graph));
+
+    *dims_offset = size;
+    size += ARENA_ALIGN(sizeof(int32_t) * 4 * plan->tensor_num);
+
+    *state_offset = size;
+    size += ARENA_ALIGN(plan->state_size);
+
+    *act_offset = size;
+    size += ARENA_ALIGN(plan->act_size);
+
+    *shared_offset = size;
+    size += ARENA_ALIGN(plan->shared_mem_size);
+
+    /* room to align the caller's arena */
+    return size + AOT_ALIGN_SIZE;
+}
+
+static inline void* get_step_tensor_data(struct aot_graph* graph, int idx)
+{
+    const struct aot_tensor* tensor = &graph->tensors[idx];
+
+    if(tensor->mem_type == AOT_TENSOR_CONST)
+        return ( void* )(graph->data + tensor->offset);
+
+    return graph->act + tensor->offset;
+}
+
+static inline int get_step_tensor_elem_num(struct aot_graph* graph, int idx)
+{
+    const struct aot_tensor* tensor = &graph->tensors[idx];
+    int elem_num = 1;
+
+    for(int i = 0; i < tensor->dim_num; i++)
+        elem_num *= graph->dims[idx][i];
+
+    return elem_num;
+}
+
+int get_aot_arena_size(const void* plan_mem)
+{
+    const struct aot_plan* plan = ( const struct aot_plan* )plan_mem;
+    int dims_offset, state_offset, act_offset, shared_offset;
+
+    if(plan == NULL || plan->magic != AOT_PLAN_MAGIC || plan->version != AOT_PLAN_VERSION)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    return get_arena_layout(plan, &dims_offset, &state_offset, &act_offset, &shared_offset);
+}
+
+int reset_aot_graph(aot_graph_t aot_graph)
+{
+    struct aot_graph* graph = ( struct aot_graph* )aot_graph;
+
+    for(int i = 0; i < graph->plan->tensor_num; i++)
+        memcpy(graph->dims[i], graph->tensors[i].dims, sizeof(int32_t) * 4);
+
+    /* outputs are read after every run, even when a move breaks it early */
+    memset(graph->state, 0, graph->plan->state_size);
+    memset(graph->act, 0, graph->plan->act_size);
+
+    for(int i = 0; i < graph->plan->step_num; i++)
+    {
+        const struct aot_step* step = &graph->steps[i];
+
+        if(step->kernel != AOT_KERNEL_MOVE_Q7)
+            continue;
+
+        struct aot_move_state* state = ( struct aot_move_state* )(graph->state + step->state_offset);
+
+        state->current_buffer_size = step->param[AOT_PARAM_MV_INIT_SIZE];
+        state->fed_rows = step->param[AOT_PARAM_MV_INIT_ROWS];
+    }
+
+    return 0;
+}
+
+aot_graph_t bind_aot_graph(const void* plan_mem, void* arena, int arena_size)
+{
+    const struct aot_plan* plan = ( const struct aot_plan* )plan_mem;
+    int dims_offset, state_offset, act_offset, shared_offset;
+
+    if(arena == NULL || get_aot_arena_size(plan) < 0)
+    {
+        TLOG_ERR("bind aot graph: bad plan\n");
+        set_tengine_errno(EINVAL);
+        return NULL;
+    }
+
+    if(arena_size < get_arena_layout(plan, &dims_offset, &state_offset, &act_offset, &shared_offset))
+    {
+        TLOG_ERR("bind aot graph: arena is too small\n");
+        set_tengine_errno(ENOMEM);
+        return NULL;
+    }
+
+    unsigned long addr = ( unsigned long )arena;
+    char* base = ( char* )((addr + AOT_ALIGN_SIZE - 1) & ~(AOT_ALIGN_SIZE - 1));
+
+    struct aot_graph* graph = ( struct aot_graph* )base;
+
+    graph->plan = plan;
+    graph->steps = ( const struct aot_step* )(( const char* )plan + plan->step_offset);
+    graph->tensors = ( const struct aot_tensor* )(( const char* )plan + plan->tensor_offset);
+    graph->data = ( const char* )plan + plan->data_offset;
+    graph->dims = ( int32_t(*)[4] )(base + dims_offset);
+    graph->state = base + state_offset;
+    graph->act = base + act_offset;
+    graph->shared_mem = base + shared_offset;
+
+    reset_aot_graph(graph);
+
+    return graph;
+}
+
+void* get_aot_input_buffer(aot_graph_t aot_graph, int* size)
+{
+    struct aot_graph* graph = ( struct aot_graph* )aot_graph;
+    int idx = graph->plan->input_tensor;
+
+    if(size)
+        *size = get_step_tensor_elem_num(graph, idx);
+
+    return get_step_tensor_data(graph, idx);
+}
+
+void* get_aot_output_buffer(aot_graph_t aot_graph, int* size)
+{
+    struct aot_graph* graph = ( struct aot_graph* )aot_graph;
+    int idx = graph->plan->output_tensor;
+
+    if(size)
+        *size = get_step_tensor_elem_num(graph, idx);
+
+    return get_step_tensor_data(graph, idx);
+}
+
+/* the same as move_op() in mv_cmsis.c, with the state kept in the arena */
+static int run_move(struct aot_graph* graph, const struct aot_step* step)
+{
+    struct aot_move_state* state = ( struct aot_move_state* )(graph->state + step->state_offset);
+    signed char* buffer = ( signed char* )(state + 1);
+    int32_t* in_dims = graph->dims[step->input[0]];
+    int32_t* out_dims = graph->dims[step->output];
+
+    if(step->param[AOT_PARAM_MV_FLAG])
+    {
+        if(state->fed_rows > step->param[AOT_PARAM_MV_WARMUP_ROWS])
+            out_dims[1] = step->param[AOT_PARAM_MV_ROWS];
+        else
+        {
+            state->fed_rows += in_dims[1];
+            out_dims[1] = step->param[AOT_PARAM_MV_WARMUP_ROWS];
+        }
+    }
+
+    int new_size = in_dims[1] * in_dims[2] * in_dims[3];
+    int out_size = out_dims[1] * out_dims[2] * out_dims[3];
+    int start = step->param[AOT_PARAM_MV_START];
+    int move_size = step->param[AOT_PARAM_MV_SIZE];
+
+    memmove(buffer + state->current_buffer_size, get_step_tensor_data(graph, step->input[0]), new_size);
+    state->current_buffer_size += new_size;
+
+    if(step->param[AOT_PARAM_MV_FLAG])
+    {
+        if(state->current_buffer_size < step->param[AOT_PARAM_MV_FILL_SIZE])
+            return 1;
+    }
+    else if(state->current_buffer_size < out_size)
+        return 1;
+
+    memcpy(get_step_tensor_data(graph, step->output), buffer, out_size);
+
+    if(state->current_buffer_size < out_size)
+        memmove(buffer, buffer + out_size - state->current_buffer_size, move_size);
+    else
+        memmove(buffer, buffer + start, move_size);
+
+    state->current_buffer_size -= new_size;
+
+    if(step->param[AOT_PARAM_MV_FLAG])
+        state->current_buffer_size = out_size - new_size;
+
+    return 0;
+}
+
+/* the same as run_stream() in conv_cmsis.c, with the state kept in the arena */
+static int run_stream_conv(struct aot_graph* graph, const struct aot_step* step)
+{
+    const int32_t* param = step->param;
+    struct aot_conv_state* state = ( struct aot_conv_state* )(graph->state + step->state_offset);
+    int8_t* history = ( int8_t* )(state + 1);
+    int32_t* in_dims = graph->dims[step->input[0]];
+    int32_t* out_dims = graph->dims[step->output];
+    int in_row_size = in_dims[2] * in_dims[3];
+    int out_row_size = out_dims[2] * out_dims[3];
+    int kernel_h = param[AOT_PARAM_KERNEL_H];
+    int stride_h = param[AOT_PARAM_STRIDE_H];
+    int window_rows = param[AOT_PARAM_STREAM_WINDOW];
+
+    if((state->history_rows + in_dims[1]) * in_row_size > param[AOT_PARAM_STREAM])
+        return -1;
+
+    memcpy(history + state->history_rows * in_row_size, get_step_tensor_data(graph, step->input[0]),
+           in_dims[1] * in_row_size);
+    state->history_rows += in_dims[1];
+
+    if(state->history_rows < kernel_h)
+        return 1;
+
+    int out_rows = (state->history_rows - kernel_h) / stride_h + 1;
+    int8_t* output = get_step_tensor_data(graph, step->output);
+    int8_t* window = history + param[AOT_PARAM_STREAM];
+    int8_t* out = output;
+
+    if(window_rows)
+    {
+        memmove(window, window + out_rows * out_row_size, (window_rows - out_rows) * out_row_size);
+        out = window + (window_rows - out_rows) * out_row_size;
+    }
+    else
+        out_dims[1] = out_rows;
+
+    const int32_t* w_dims = graph->tensors[step->input[1]].dims;
+    q7_t* bias = step->input_num > 2 ? get_step_tensor_data(graph, step->input[2]) : NULL;
+
+    arm_status ret = arm_convolve_HWC_q7_nonsquare(
+        history, in_dims[2], state->history_rows, in_dims[3], get_step_tensor_data(graph, step->input[1]), w_dims[3],
+        param[AOT_PARAM_KERNEL_W], kernel_h, param[AOT_PARAM_PAD_W0], 0, param[AOT_PARAM_STRIDE_W], stride_h, bias,
+        step->bias_shift, step->out_shift, out, out_dims[2], out_rows, graph->shared_mem, NULL);
+
+    if(ret != ARM_MATH_SUCCESS)
+        return -1;
+
+    if(param[AOT_PARAM_RELU])
+        arm_relu_q7(out, out_rows * out_row_size);
+
+    int used_rows = out_rows * stride_h;
+
+    state->history_rows -= used_rows;
+    memmove(history, history + used_rows * in_row_size, state->history_rows * in_row_size);
+
+    if(window_rows == 0)
+        return 0;
+
+    memcpy(output, window, window_rows * out_row_size);
+
+    if(state->window_rows < window_rows)
+        state->window_rows += out_rows;
+
+    return state->window_rows < window_rows ? 1 : 0;
+}
+
+/* the same as arm_softmax_float() in softmax_cmsis.c, without the temporary buffer */
+static void run_softmax(const q7_t* input, int len, q7_t* output)
+{
+    float sum = 0;
+
+    for(int i = 0; i < len; i++)
+        sum += powf(2, ( float )(input[i]) / 2);
+
+    for(int i = 0; i < len; i++)
+        output[i] = ( q7_t )(powf(2, ( float )(input[i]) / 2) * 128 / sum);
+}
+
+int run_aot_graph(aot_graph_t aot_graph)
+{
+    struct aot_graph* graph = ( struct aot_graph* )aot_graph;
+    const struct aot_plan* plan = graph->plan;
+
+    for(int i = 0; i < plan->step_num; i++)
+    {
+        const struct aot_step* step = &graph->steps[i];
+        const int32_t* param = step->param;
+        int32_t* in_dims = graph->dims[step->input[0]];
+        int32_t* out_dims = graph->dims[step->output];
+        q7_t* input = get_step_tensor_data(graph, step->input[0]);
+        q7_t* output = get_step_tensor_data(graph, step->output);
+        q7_t* bias = step->input_num > 2 ? get_step_tensor_data(graph, step->input[2]) : NULL;
+        arm_status ret = ARM_MATH_SUCCESS;
+
+        switch(step->kernel)
+        {
+            case AOT_KERNEL_CONV_Q7:
+            {
+                const int32_t* w_dims = graph->tensors[step->input[1]].dims;
+
+                if(param[AOT_PARAM_STREAM])
+                {
+                    int stream_ret = run_stream_conv(graph, step);
+
+                    if(stream_ret < 0)
+                        ret = ARM_MATH_ARGUMENT_ERROR;
+                    else if(stream_ret > 0)
+                        return 0;
+
+                    break;
+                }
+
+                out_dims[1] = (in_dims[1] + param[AOT_PARAM_PAD_H0] + param[AOT_PARAM_PAD_H1] -
+                               param[AOT_PARAM_KERNEL_H]) / param[AOT_PARAM_STRIDE_H] + 1;
+
+                ret = arm_convolve_HWC_q7_nonsquare(
+                    input, in_dims[2], in_dims[1], in_dims[3], get_step_tensor_data(graph, step->input[1]), w_dims[3],
+                    param[AOT_PARAM_KERNEL_W], param[AOT_PARAM_KERNEL_H], param[AOT_PARAM_PAD_W0],
+                    param[AOT_PARAM_PAD_H0], param[AOT_PARAM_STRIDE_W], param[AOT_PARAM_STRIDE_H], bias,
+                    step->bias_shift, step->out_shift, output, out_dims[2], out_dims[1], graph->shared_mem, NULL);
+
+                if(ret == ARM_MATH_SUCCESS && param[AOT_PARAM_RELU])
+                    arm_relu_q7(output, get_step_tensor_elem_num(graph, step->output));
+                break;
+            }
+            case AOT_KERNEL_CONV1D_Q7:
+            {
+                const int32_t* w_dims = graph->tensors[step->input[1]].dims;
+                int row_size = in_dims[2] * in_dims[3];
+
+                /* the expanded rows of the DSP kernel, when they fit in the scratch of the other steps */
+                int buffer_size = conv1d_q7_buffer_size(in_dims[1], row_size, param[AOT_PARAM_STRIDE_H],
+                                                        param[AOT_PARAM_PAD_H0]);
+                void* buffer = buffer_size && buffer_size <= plan->shared_mem_size ? graph->shared_mem : NULL;
+
+                out_dims[1] = (in_dims[1] + param[AOT_PARAM_PAD_H0] + param[AOT_PARAM_PAD_H1] -
+                               param[AOT_PARAM_KERNEL_H]) / param[AOT_PARAM_STRIDE_H] + 1;
+
+                conv1d_q7_rows(input, in_dims[1], row_size, get_step_tensor_data(graph, step->input[1]), bias,
+                               w_dims[3], param[AOT_PARAM_KERNEL_H], param[AOT_PARAM_STRIDE_H],
+                               param[AOT_PARAM_PAD_H0], step->bias_shift, step->out_shift, param[AOT_PARAM_RELU], 0,
+                               out_dims[1], buffer, output);
+                break;
+            }
+            case AOT_KERNEL_FC_Q7:
+            {
+                const int32_t* w_dims = graph->tensors[step->input[1]].dims;
+
+                ret = arm_fully_connected_q7(input, get_step_tensor_data(graph, step->input[1]), w_dims[1], w_dims[0],
+                                             step->bias_shift, step->out_shift, bias, output, graph->shared_mem);
+
+                if(ret == ARM_MATH_SUCCESS && param[AOT_PARAM_RELU])
+                    arm_relu_q7(output, w_dims[0]);
+                break;
+            }
+            case AOT_KERNEL_RELU_Q7:
+                memcpy(out_dims, in_dims, sizeof(int32_t) * 4);
+
+                if(output != input)
+                    memcpy(output, input, get_step_tensor_elem_num(graph, step->input[0]));
+
+                arm_relu_q7(output, get_step_tensor_elem_num(graph, step->output));
+                break;
+            case AOT_KERNEL_SOFTMAX_Q7:
+                memcpy(out_dims, in_dims, sizeof(int32_t) * 4);
+                run_softmax(input, get_step_tensor_elem_num(graph, step->input[0]), output);
+                break;
+            case AOT_KERNEL_MAXPOOL_Q7:
+                out_dims[1] = (in_dims[1] + param[AOT_PARAM_PAD_H0] + param[AOT_PARAM_PAD_H1] -
+                               param[AOT_PARAM_KERNEL_H]) / param[AOT_PARAM_STRIDE_H] + 1;
+
+                arm_maxpool_HWC_q7_nonsquare(input, in_dims[2], in_dims[1], in_dims[3], param[AOT_PARAM_KERNEL_H],
+                                             param[AOT_PARAM_PAD_H0], param[AOT_PARAM_STRIDE_H], out_dims[2],
+                                             out_dims[1], NULL, output);
+                break;
+            case AOT_KERNEL_MOVE_Q7:
+                /* not enough data yet, the same as a node returning > 0 */
+                if(run_move(graph, step) > 0)
+                    return 0;
+                break;
+            default:
+                TLOG_ERR("aot step %d: unknown kernel %d\n", i, step->kernel);
+                set_tengine_errno(EINVAL);
+                return -1;
+        }
+
+        if(ret != ARM_MATH_SUCCESS)
+        {
+            TLOG_ERR("aot step %d: kernel %d failed\n", i, step->kernel);
+            set_tengine_errno(EFAULT);
+            return -1;
+        }
+    }
+
+    return 0;
+}
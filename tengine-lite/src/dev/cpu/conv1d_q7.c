@@ -0,0 +1,252 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#include "conv1d_q7.h"
+
+static inline q7_t requant(q31_t sum, int out_shift, int relu)
+{
+    q31_t out = __SSAT((sum >> out_shift), 8);
+
+    if(relu && out < 0)
+        out = 0;
+
+    return ( q7_t )out;
+}
+
+#if defined(ARM_MATH_DSP)
+static inline q31_t read_q7x4(const q7_t* p)
+{
+    q31_t val;
+
+    memcpy(&val, p, sizeof(val));
+
+    return val;
+}
+#endif
+
+/*
+ * one output row: the len inputs against the filters, weight_stride apart, of all the output
+ * channels. With the DSP extension, two channels share each sign extended word of the input.
+ */
+static void conv1d_row(const q7_t* input, int len, const q7_t* weight, int weight_stride, const q7_t* bias,
+                       int out_c, int bias_shift, int out_shift, int relu, q7_t* output)
+{
+    int c = 0;
+
+#if defined(ARM_MATH_DSP)
+    for(; c + 1 < out_c; c += 2)
+    {
+        const q7_t* w0 = weight + c * weight_stride;
+        const q7_t* w1 = w0 + weight_stride;
+        q31_t sum0 = (( q31_t )bias[c] << bias_shift) + NN_ROUND(out_shift);
+        q31_t sum1 = (( q31_t )bias[c + 1] << bias_shift) + NN_ROUND(out_shift);
+        int i = 0;
+
+        for(; i + 3 < len; i += 4)
+        {
+            q31_t in = read_q7x4(input + i);
+            q31_t in_even = __SXTB16(in);
+            q31_t in_odd = __SXTB16(__ROR(in, 8));
+            q31_t w = read_q7x4(w0 + i);
+
+            sum0 = __SMLAD(in_even, __SXTB16(w), sum0);
+            sum0 = __SMLAD(in_odd, __SXTB16(__ROR(w, 8)), sum0);
+
+            w = read_q7x4(w1 + i);
+            sum1 = __SMLAD(in_even, __SXTB16(w), sum1);
+            sum1 = __SMLAD(in_odd, __SXTB16(__ROR(w, 8)), sum1);
+        }
+
+        for(; i < len; i++)
+        {
+            sum0 += input[i] * w0[i];
+            sum1 += input[i] * w1[i];
+        }
+
+        output[c] = requant(sum0, out_shift, relu);
+        output[c + 1] = requant(sum1, out_shift, relu);
+    }
+#endif
+
+    for(; c < out_c; c++)
+    {
+        const q7_t* w = weight + c * weight_stride;
+        q31_t sum = (( q31_t )bias[c] << bias_shift) + NN_ROUND(out_shift);
+
+        for(int i = 0; i < len; i++)
+            sum += input[i] * w[i];
+
+        output[c] = requant(sum, out_shift, relu);
+    }
+}
+
+#if defined(ARM_MATH_DSP)
+/*
+ * the input rows in q15, each 4 q7 as the two words __SXTB16() makes of them, even lanes then
+ * odd lanes, as the weights are read: the windows of the output rows overlap, and the rows
+ * under two windows are expanded once. The last size % 4 are left out, the tails are read in q7.
+ */
+static void expand_rows(const q7_t* input, int size, q31_t* buffer)
+{
+    for(int i = 0; i + 3 < size; i += 4)
+    {
+        q31_t in = read_q7x4(input + i);
+
+        *buffer++ = __SXTB16(in);
+        *buffer++ = __SXTB16(__ROR(in, 8));
+    }
+}
+
+/*
+ * two output rows, from their expanded windows in0 and in1 and the q7 ones src0 and src1 for
+ * the tails: each weight word is sign extended once for both rows.
+ */
+static void conv1d_rows2(const q31_t* in0, const q31_t* in1, const q7_t* src0, const q7_t* src1, int len,
+                         const q7_t* weight, int weight_stride, const q7_t* bias, int out_c, int bias_shift,
+                         int out_shift, int relu, q7_t* output0, q7_t* output1)
+{
+    int c = 0;
+
+    for(; c + 1 < out_c; c += 2)
+    {
+        const q7_t* w0 = weight + c * weight_stride;
+        const q7_t* w1 = w0 + weight_stride;
+        q31_t sum00 = (( q31_t )bias[c] << bias_shift) + NN_ROUND(out_shift);
+        q31_t sum01 = (( q31_t )bias[c + 1] << bias_shift) + NN_ROUND(out_shift);
+        q31_t sum10 = sum00;
+        q31_t sum11 = sum01;
+        int i = 0;
+
+        for(; i + 3 < len; i += 4)
+        {
+            q31_t a_even = in0[i >> 1];
+            q31_t a_odd = in0[(i >> 1) + 1];
+            q31_t b_even = in1[i >> 1];
+            q31_t b_odd = in1[(i >> 1) + 1];
+            q31_t w = read_q7x4(w0 + i);
+            q31_t w_even = __SXTB16(w);
+            q31_t w_odd = __SXTB16(__ROR(w, 8));
+
+            sum00 = __SMLAD(a_even, w_even, sum00);
+            sum00 = __SMLAD(a_odd, w_odd, sum00);
+            sum10 = __SMLAD(b_even, w_even, sum10);
+            sum10 = __SMLAD(b_odd, w_odd, sum10);
+
+            w = read_q7x4(w1 + i);
+            w_even = __SXTB16(w);
+            w_odd = __SXTB16(__ROR(w, 8));
+
+            sum01 = __SMLAD(a_even, w_even, sum01);
+            sum01 = __SMLAD(a_odd, w_odd, sum01);
+            sum11 = __SMLAD(b_even, w_even, sum11);
+            sum11 = __SMLAD(b_odd, w_odd, sum11);
+        }
+
+        for(; i < len; i++)
+        {
+            sum00 += src0[i] * w0[i];
+            sum01 += src0[i] * w1[i];
+            sum10 += src1[i] * w0[i];
+            sum11 += src1[i] * w1[i];
+        }
+
+        output0[c] = requant(sum00, out_shift, relu);
+        output0[c + 1] = requant(sum01, out_shift, relu);
+        output1[c] = requant(sum10, out_shift, relu);
+        output1[c + 1] = requant(sum11, out_shift, relu);
+    }
+
+    if(c < out_c)
+    {
+        conv1d_row(src0, len, weight + c * weight_stride, weight_stride, bias + c, out_c - c, bias_shift, out_shift,
+                   relu, output0 + c);
+        conv1d_row(src1, len, weight + c * weight_stride, weight_stride, bias + c, out_c - c, bias_shift, out_shift,
+                   relu, output1 + c);
+    }
+}
+#endif
+
+int conv1d_q7_buffer_size(int in_h, int row_size, int stride_h, int pad_h0)
+{
+#if defined(ARM_MATH_DSP)
+    /* the rows are expanded when all the windows start on a word of 4 q7 */
+    if((stride_h * row_size) % 4 == 0 && (pad_h0 * row_size) % 4 == 0)
+        return (sizeof(q15_t) * in_h * row_size + 3) & ~3;
+#endif
+
+    return 0;
+}
+
+void conv1d_q7_rows(const int8_t* input, int in_h, int row_size, const int8_t* weight, const int8_t* bias,
+                    int out_c, int kernel_h, int stride_h, int pad_h0, int bias_shift, int out_shift, int relu,
+                    int row_start, int row_end, void* buffer, int8_t* output)
+{
+    int weight_stride = kernel_h * row_size;
+
+    if(row_start == row_end)
+        return;
+
+#if defined(ARM_MATH_DSP)
+    /* the input rows the part reads */
+    int part_top = row_start * stride_h - pad_h0;
+    int part_bottom = (row_end - 1) * stride_h - pad_h0 + kernel_h;
+    int in_start = part_top < 0 ? 0 : part_top;
+    int in_end = part_bottom < in_h ? part_bottom : in_h;
+    q31_t* rows = ( q31_t* )buffer;
+
+    if(rows)
+        expand_rows(input + in_start * row_size, (in_end - in_start) * row_size, rows);
+#endif
+
+    for(int r = row_start; r < row_end; r++)
+    {
+        int top = r * stride_h - pad_h0;
+
+#if defined(ARM_MATH_DSP)
+        /* two rows at a time, when both windows are clear of the padding */
+        int next = top + stride_h;
+
+        if(rows && r + 1 < row_end && top >= 0 && next + kernel_h <= in_h)
+        {
+            conv1d_rows2(rows + (top - in_start) * row_size / 2, rows + (next - in_start) * row_size / 2,
+                         input + top * row_size, input + next * row_size, weight_stride, weight, weight_stride,
+                         bias, out_c, bias_shift, out_shift, relu, output + r * out_c, output + (r + 1) * out_c);
+            r++;
+            continue;
+        }
+#endif
+
+        /* the kernel rows over the padding are left out of the dot product */
+        int k_start = top < 0 ? -top : 0;
+        int k_end = top + kernel_h > in_h ? in_h - top : kernel_h;
+
+        conv1d_row(input + (top + k_start) * row_size, (k_end - k_start) * row_size, weight + k_start * row_size,
+                   weight_stride, bias, out_c, bias_shift, out_shift, relu, output + r * out_c);
+    }
+}
@@ -0,0 +1,474 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sys_port.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "tengine_op.h"
+#include "tengine_utils.h"
+#include "tengine_aot.h"
+#include "cpu_device.h"
+#include "cpu_node_ops.h"
+#include "op/convolution_param.h"
+#include "op/pooling_param.h"
+#include "op/mv_param.h"
+
+#define PLAN_ALIGN(size) (((size) + 3) & ~3)
+#define ARENA_ALIGN(size) (((size) + AOT_ALIGN_SIZE - 1) & ~(AOT_ALIGN_SIZE - 1))
+
+/* the same shift the cmsis kernels derive in init_node() */
+static inline int cal_shift(int scale)
+{
+    int shift = 0;
+
+    while((1 << shift) < scale)
+        shift++;
+
+    return shift;
+}
+
+static int map_tensor(int16_t* tensor_map, int* tensor_num, int* data_size, struct ir_tensor* ir_tensor)
+{
+    if(tensor_map[ir_tensor->idx] >= 0)
+        return tensor_map[ir_tensor->idx];
+
+    if(ir_tensor->tensor_type == TENSOR_TYPE_CONST)
+        *data_size += PLAN_ALIGN(ir_tensor->elem_num * ir_tensor->elem_size);
+
+    tensor_map[ir_tensor->idx] = (*tensor_num)++;
+
+    return tensor_map[ir_tensor->idx];
+}
+
+/* a step with a folded relu writes the relu output, which shares the buffer of its own output */
+static int get_step_output(struct exec_step* exec_step)
+{
+    struct ir_node* ir_node = exec_step->fused_node ? exec_step->fused_node : exec_step->ir_node;
+
+    return ir_node->output_tensors[0];
+}
+
+/*
+ * the scratch of the aot kernel, not of the node ops prerun picked, which may need none: the q15
+ * im2col buffer of arm_convolve_HWC_q7_nonsquare() and the vec_buffer of arm_fully_connected_q7().
+ * A conv1d step reads its rows in place.
+ */
+static int get_step_shared_mem_size(struct aot_step* step, struct ir_node* ir_node)
+{
+    struct ir_graph* ir_graph = ir_node->graph;
+
+    if(step->kernel == AOT_KERNEL_CONV_Q7)
+    {
+        struct conv_param* param = ( struct conv_param* )ir_node->op.param_mem;
+        struct ir_tensor* input = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+
+        return 2 * input->dims[3] * param->kernel_h * param->kernel_w * sizeof(int16_t);
+    }
+
+    if(step->kernel == AOT_KERNEL_FC_Q7)
+    {
+        struct ir_tensor* weight = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
+
+        return weight->dims[1] * sizeof(int16_t);
+    }
+
+    return 0;
+}
+
+/*
+ * the conv1d kernel for the convs the cmsis_conv1d node ops run. Those bound at prerun, or, as a
+ * host may have bound an x86 variant over them, those among the candidates of the node
+ */
+static int takes_conv1d(struct exec_graph* exec_graph, struct exec_step* exec_step)
+{
+    struct node_ops* cand_list[MAX_TUNE_CAND_NUM];
+
+    if(!strcmp(exec_step->node_ops->name, "cmsis_conv1d"))
+        return 1;
+
+    int cand_num = get_node_ops_candidates(exec_graph, exec_step->ir_node, cand_list, MAX_TUNE_CAND_NUM);
+
+    for(int i = 0; i < cand_num; i++)
+    {
+        if(!strcmp(cand_list[i]->name, "cmsis_conv1d"))
+            return 1;
+    }
+
+    return 0;
+}
+
+static int set_step_kernel(struct aot_step* step, struct exec_graph* exec_graph, struct exec_step* exec_step,
+                           int* state_size, int* shared_mem_size)
+{
+    struct ir_node* ir_node = exec_step->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* output = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    switch(ir_node->op.op_type)
+    {
+        case OP_CONV:
+        {
+            struct conv_param* param = ( struct conv_param* )ir_node->op.param_mem;
+
+            if(param->group != 1 || param->dilation_h != 1 || param->dilation_w != 1)
+                return -1;
+
+            if(takes_conv1d(exec_graph, exec_step))
+                step->kernel = AOT_KERNEL_CONV1D_Q7;
+            else
+                step->kernel = AOT_KERNEL_CONV_Q7;
+
+            step->param[AOT_PARAM_KERNEL_H] = param->kernel_h;
+            step->param[AOT_PARAM_KERNEL_W] = param->kernel_w;
+            step->param[AOT_PARAM_STRIDE_H] = param->stride_h;
+            step->param[AOT_PARAM_STRIDE_W] = param->stride_w;
+            step->param[AOT_PARAM_PAD_H0] = param->pad_h0;
+            step->param[AOT_PARAM_PAD_H1] = param->pad_h1;
+            step->param[AOT_PARAM_PAD_W0] = param->pad_w0;
+            step->param[AOT_PARAM_PAD_W1] = param->pad_w1;
+
+            if(param->stream)
+            {
+                struct ir_tensor* input = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+                int history_size = (param->kernel_h - 1 + input->dims[1]) * input->dims[2] * input->dims[3];
+
+                step->param[AOT_PARAM_STREAM] = history_size;
+                step->param[AOT_PARAM_STREAM_WINDOW] = param->stream_window;
+                step->state_offset = *state_size;
+
+                *state_size += ARENA_ALIGN(sizeof(struct aot_conv_state) + history_size +
+                                           (param->stream_window ? output->elem_num : 0));
+            }
+            break;
+        }
+        case OP_FC:
+            step->kernel = AOT_KERNEL_FC_Q7;
+            break;
+        case OP_RELU:
+            step->kernel = AOT_KERNEL_RELU_Q7;
+            break;
+        case OP_SOFTMAX:
+            step->kernel = AOT_KERNEL_SOFTMAX_Q7;
+            break;
+        case OP_POOL:
+        {
+            struct pool_param* param = ( struct pool_param* )ir_node->op.param_mem;
+
+            if(param->pool_method != POOL_MAX)
+                return -1;
+
+            step->kernel = AOT_KERNEL_MAXPOOL_Q7;
+            step->param[AOT_PARAM_KERNEL_H] = param->kernel_h;
+            step->param[AOT_PARAM_KERNEL_W] = param->kernel_w;
+            step->param[AOT_PARAM_STRIDE_H] = param->stride_h;
+            step->param[AOT_PARAM_STRIDE_W] = param->stride_w;
+            step->param[AOT_PARAM_PAD_H0] = param->pad_h0;
+            step->param[AOT_PARAM_PAD_H1] = param->pad_h1;
+            step->param[AOT_PARAM_PAD_W0] = param->pad_w0;
+            step->param[AOT_PARAM_PAD_W1] = param->pad_w1;
+            break;
+        }
+        case OP_MOVE:
+        {
+            struct mv_param* param = ( struct mv_param* )ir_node->op.param_mem;
+
+            step->kernel = AOT_KERNEL_MOVE_Q7;
+            step->state_offset = *state_size;
+            step->param[AOT_PARAM_MV_START] = param->start_mv_addr;
+            step->param[AOT_PARAM_MV_SIZE] = param->mv_size;
+            step->param[AOT_PARAM_MV_BUFFER_SIZE] = param->buffer_size;
+            step->param[AOT_PARAM_MV_FLAG] = param->flag;
+            step->param[AOT_PARAM_MV_FILL_SIZE] = MV_FLAG_FILL_SIZE;
+            step->param[AOT_PARAM_MV_WARMUP_ROWS] = MV_FLAG_WARMUP_ROWS;
+            step->param[AOT_PARAM_MV_ROWS] = MV_FLAG_ROWS;
+            step->param[AOT_PARAM_MV_INIT_SIZE] = param->current_buffer_size;
+            step->param[AOT_PARAM_MV_INIT_ROWS] = param->fed_rows;
+
+            *state_size += ARENA_ALIGN(sizeof(struct aot_move_state) + param->buffer_size);
+            break;
+        }
+        default:
+            return -1;
+    }
+
+    /* the shifts of conv and fc */
+    if(step->kernel == AOT_KERNEL_CONV_Q7 || step->kernel == AOT_KERNEL_CONV1D_Q7 || step->kernel == AOT_KERNEL_FC_Q7)
+    {
+        if(ir_node->input_num > 2)
+        {
+            struct ir_tensor* bias = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+            int scale = bias->scale;
+
+            step->bias_shift = cal_shift(scale);
+        }
+
+        int scale = output->scale;
+
+        step->out_shift = cal_shift(scale);
+        step->param[AOT_PARAM_RELU] = exec_step->fused_node != NULL;
+
+        int step_shared_mem_size = get_step_shared_mem_size(step, ir_node);
+
+        if(step_shared_mem_size > *shared_mem_size)
+            *shared_mem_size = step_shared_mem_size;
+    }
+
+    return 0;
+}
+
+int build_aot_plan(graph_t graph, void** plan_mem, int* plan_size)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+
+    if(ir_graph->status != GRAPH_STAT_READY || get_vector_num(ir_graph->subgraph_list) != 1)
+    {
+        TLOG_ERR("aot plan: graph must be prerun on a single subgraph\n");
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, 0);
+
+    if(strcmp(subgraph->nn_dev->name, "cpu_dev") || ir_graph->graph_layout != TENGINE_LAYOUT_NHWC)
+    {
+        TLOG_ERR("aot plan: only NHWC graphs on cpu_dev are supported\n");
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    struct exec_graph* exec_graph = ( struct exec_graph* )subgraph->exec_graph;
+    struct ir_node* output_node = get_ir_graph_node(ir_graph, ir_graph->output_nodes[0]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, output_node->output_tensors[0]);
+
+    int16_t* tensor_map = ( int16_t* )sys_malloc(sizeof(int16_t) * ir_graph->tensor_num);
+
+    if(tensor_map == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    for(int i = 0; i < ir_graph->tensor_num; i++)
+        tensor_map[i] = -1;
+
+    /* count the tensors and the const data */
+    int tensor_num = 0;
+    int data_size = 0;
+
+    for(int i = 0; i < exec_graph->step_num; i++)
+    {
+        struct ir_node* ir_node = exec_graph->exec_plan[i].ir_node;
+
+        if(ir_node->input_num > AOT_MAX_INPUT_NUM || ir_node->output_num != 1)
+        {
+            TLOG_ERR("aot plan: node %d has too many inputs or outputs\n", ir_node->idx);
+            sys_free(tensor_map);
+            set_tengine_errno(ENOTSUP);
+            return -1;
+        }
+
+        for(int j = 0; j < ir_node->input_num; j++)
+            map_tensor(tensor_map, &tensor_num, &data_size, get_ir_graph_tensor(ir_graph, ir_node->input_tensors[j]));
+
+        map_tensor(tensor_map, &tensor_num, &data_size,
+                   get_ir_graph_tensor(ir_graph, get_step_output(&exec_graph->exec_plan[i])));
+    }
+
+    int step_offset = PLAN_ALIGN(sizeof(struct aot_plan));
+    int tensor_offset = step_offset + sizeof(struct aot_step) * exec_graph->step_num;
+    int data_offset = tensor_offset + sizeof(struct aot_tensor) * tensor_num;
+    int size = data_offset + data_size;
+
+    struct aot_plan* plan = ( struct aot_plan* )sys_malloc(size);
+
+    if(plan == NULL)
+    {
+        sys_free(tensor_map);
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    memset(plan, 0, size);
+
+    plan->magic = AOT_PLAN_MAGIC;
+    plan->version = AOT_PLAN_VERSION;
+    plan->step_num = exec_graph->step_num;
+    plan->tensor_num = tensor_num;
+    plan->input_tensor = -1;
+    plan->output_tensor = tensor_map[output_tensor->idx];
+    plan->size = size;
+    plan->act_size = ARENA_ALIGN(exec_graph->mem_arena_size);
+    plan->shared_mem_size = 0;
+    plan->step_offset = step_offset;
+    plan->tensor_offset = tensor_offset;
+    plan->data_offset = data_offset;
+
+    struct aot_step* steps = ( struct aot_step* )(( char* )plan + step_offset);
+    struct aot_tensor* tensors = ( struct aot_tensor* )(( char* )plan + tensor_offset);
+    char* data = ( char* )plan + data_offset;
+    int data_used = 0;
+
+    unsigned long arena_addr = ( unsigned long )exec_graph->mem_arena;
+    char* arena_base = ( char* )((arena_addr + MEM_ARENA_ALIGN_SIZE - 1) & ~(MEM_ARENA_ALIGN_SIZE - 1));
+
+    /* tensors */
+    for(int i = 0; i < ir_graph->tensor_num; i++)
+    {
+        if(tensor_map[i] < 0)
+            continue;
+
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, i);
+        struct aot_tensor* tensor = &tensors[tensor_map[i]];
+        int mem_size = ir_tensor->elem_num * ir_tensor->elem_size;
+
+        tensor->dim_num = ir_tensor->dim_num;
+
+        for(int j = 0; j < ir_tensor->dim_num; j++)
+            tensor->dims[j] = ir_tensor->dims[j];
+
+        if(ir_tensor->tensor_type == TENSOR_TYPE_CONST)
+        {
+            tensor->mem_type = AOT_TENSOR_CONST;
+            tensor->offset = data_used;
+            memcpy(data + data_used, ir_tensor->data, mem_size);
+            data_used += PLAN_ALIGN(mem_size);
+            continue;
+        }
+
+        if(ir_tensor->data_type != TENGINE_DT_INT8)
+            goto not_supported;
+
+        tensor->mem_type = AOT_TENSOR_VAR;
+
+        if(ir_tensor->tensor_type == TENSOR_TYPE_INPUT)
+        {
+            /* the input gets its own slot after the activations; the aot kernels run batch 1 only */
+            if(plan->input_tensor >= 0 || ir_tensor->dims[0] != 1)
+                goto not_supported;
+
+            plan->input_tensor = tensor_map[i];
+
+            /* the caller quantizes to it, as from the quant param of the graph input */
+            while((1 << plan->input_shift) < ir_tensor->scale)
+                plan->input_shift++;
+
+            tensor->offset = plan->act_size;
+            plan->act_size += ARENA_ALIGN(mem_size);
+            continue;
+        }
+
+        long offset = ( char* )ir_tensor->data - arena_base;
+
+        if(ir_tensor->internal_allocated != MEM_POOL_ALLOCATED || offset < 0 ||
+           offset >= exec_graph->mem_arena_size)
+            goto not_supported;
+
+        tensor->offset = offset;
+    }
+
+    if(plan->input_tensor < 0)
+        goto not_supported;
+
+    /* steps */
+    for(int i = 0; i < exec_graph->step_num; i++)
+    {
+        struct exec_step* exec_step = &exec_graph->exec_plan[i];
+        struct ir_node* ir_node = exec_step->ir_node;
+        struct aot_step* step = &steps[i];
+
+        step->input_num = ir_node->input_num;
+
+        for(int j = 0; j < ir_node->input_num; j++)
+            step->input[j] = tensor_map[ir_node->input_tensors[j]];
+
+        step->output = tensor_map[get_step_output(exec_step)];
+
+        if(set_step_kernel(step, exec_graph, exec_step, &plan->state_size, &plan->shared_mem_size) < 0)
+        {
+            TLOG_ERR("aot plan: node %d op %s is not supported\n", ir_node->idx, get_op_name(ir_node->op.op_type));
+            goto not_supported;
+        }
+    }
+
+    sys_free(tensor_map);
+
+    TLOG_INFO("aot plan: %d steps %d tensors, plan %d bytes, arena %d bytes\n", plan->step_num, plan->tensor_num,
+              plan->size, get_aot_arena_size(plan));
+
+    *plan_mem = plan;
+    *plan_size = size;
+
+    return 0;
+
+not_supported:
+    sys_free(tensor_map);
+    sys_free(plan);
+    set_tengine_errno(ENOTSUP);
+    return -1;
+}
+
+void free_aot_plan(void* plan)
+{
+    sys_free(plan);
+}
+
+int save_aot_plan(const void* plan_mem, const char* var_name, const char* fname)
+{
+    const struct aot_plan* plan = ( const struct aot_plan* )plan_mem;
+    const uint32_t* word = ( const uint32_t* )plan_mem;
+    int word_num = (plan->size + 3) / 4;
+
+    FILE* fp = fopen(fname, "w");
+
+    if(fp == NULL)
+    {
+        TLOG_ERR("cannot open %s to save aot plan\n", fname);
+        set_tengine_errno(ENOENT);
+        return -1;
+    }
+
+    fprintf(fp, "/* generated by save_aot_plan(), do not edit */\n\n");
+    fprintf(fp, "#include <stdint.h>\n\n");
+    fprintf(fp, "const int %s_size = %d;\n\n", var_name, plan->size);
+    fprintf(fp, "const uint32_t %s[%d] = {", var_name, word_num);
+
+    for(int i = 0; i < word_num; i++)
+    {
+        uint32_t val = 0;
+
+        /* the tail may be shorter than a word */
+        memcpy(&val, word + i, (i + 1) * 4 <= plan->size ? 4 : plan->size - i * 4);
+
+        fprintf(fp, "%s0x%08x,", (i % 8) ? " " : "\n    ", val);
+    }
+
+    fprintf(fp, "\n};\n");
+
+    fclose(fp);
+
+    return 0;
+}
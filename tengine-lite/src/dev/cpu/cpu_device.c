@@ -24,26 +24,39 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "sys_port.h"
+#include "tengine_c_api.h"
 #include "tengine_errno.h"
 #include "tengine_utils.h"
 #include "tengine_ir.h"
 #include "nn_device.h"
 #include "cpu_device.h"
 #include "cpu_node_ops.h"
+#include "cpu_pool.h"
+#include "cpu_probe.h"
+#include "cpu_tune.h"
 #include "tengine_log.h"
 #include "tengine_op.h"
+#include "op/mv_param.h"
+#include "op/convolution_param.h"
+#include "op/fc_param.h"
 
 #define INPLACE_BLOCK_FLAG 0x40
 static void release_mem_pool(struct mem_pool* mem_pool);
 
 struct mem_record
 {
-    struct ir_tensor* ir_tensor;
+    struct ir_tensor* ir_tensor; /* the tensor holding the buffer now */
+    struct ir_tensor* owner; /* the tensor the buffer was allocated for */
     int used;
     int block_id;
+    int size;
+    int first; /* exec node writing the buffer */
+    int last; /* last exec node reading the buffer */
+    int offset; /* offset in the activation arena */
 };
 
 static int find_tensor_mem_list(struct vector* tensor_mem_list, const struct ir_tensor* ir_tensor)
@@ -71,6 +84,7 @@ static int init_exec_node(struct exec_graph* exec_graph, struct exec_node* exec_
     exec_node->inplace_map_ptr = NULL;
     exec_node->shared_mem_size = 0;
     exec_node->output_num = ir_node->output_num;
+    exec_node->fused = 0;
 
     int8_t* block_id = exec_node->block_id;
 
@@ -118,7 +132,15 @@ static struct exec_graph* new_exec_graph(void)
 
     exec_graph->shared_mem = NULL;
     exec_graph->shared_mem_size = 0;
-    exec_graph->mem_pool = NULL;
+    exec_graph->mem_arena = NULL;
+    exec_graph->mem_arena_size = 0;
+    exec_graph->exec_plan = NULL;
+    exec_graph->cpu_pool = NULL;
+    exec_graph->step_num = 0;
+    exec_graph->perf_stat = NULL;
+    exec_graph->perf_on = 0;
+    exec_graph->tune_log = NULL;
+    exec_graph->tune_num = 0;
 
     return exec_graph;
 }
@@ -133,12 +155,29 @@ static void free_exec_graph_mem(struct exec_graph* graph)
         graph->shared_mem_size = 0;
     }
 
-    /* free the mem pool */
-    if(graph->mem_pool)
+    /* free the activation arena */
+    if(graph->mem_arena)
     {
-        release_mem_pool(graph->mem_pool);
-        graph->mem_pool = NULL;
+        sys_free(graph->mem_arena);
+        graph->mem_arena = NULL;
+        graph->mem_arena_size = 0;
     }
+
+    /* free the exec plan */
+    if(graph->exec_plan)
+    {
+        sys_free(graph->exec_plan);
+        graph->exec_plan = NULL;
+        graph->step_num = 0;
+    }
+
+    sys_free(graph->perf_stat);
+    graph->perf_stat = NULL;
+    graph->perf_on = 0;
+
+    sys_free(graph->tune_log);
+    graph->tune_log = NULL;
+    graph->tune_num = 0;
 }
 
 static void release_exec_graph(void* exec_graph)
@@ -157,11 +196,26 @@ static void release_exec_graph(void* exec_graph)
 
     free_exec_graph_mem(graph);
 
+    release_cpu_pool(graph->cpu_pool);
+
     release_vector(graph->exec_node_list);
 
     sys_free(graph);
 }
 
+/* the probed isa features, masked by the "cpu_isa" attr of the graph when it has one */
+static int get_graph_cpu_isa(struct ir_graph* ir_graph)
+{
+    int cpu_isa = get_cpu_isa();
+    int attr_isa;
+
+    if(ir_graph->attr_num > 0 &&
+       get_attr_val(ir_graph->attr_mem, ir_graph->attr_num, "cpu_isa", NULL, &attr_isa, sizeof(int)) == 0)
+        cpu_isa &= attr_isa;
+
+    return cpu_isa;
+}
+
 static struct exec_graph* create_exec_graph(struct subgraph* subgraph, int num_thread)
 {
     /* generate exec_graph */
@@ -177,7 +231,18 @@ static struct exec_graph* create_exec_graph(struct subgraph* subgraph, int num_t
     }
 
     exec_graph->dev = dev;
-    exec_graph->num_thread = num_thread;
+
+    if(num_thread > 1)
+    {
+        exec_graph->cpu_pool = create_cpu_pool(num_thread);
+
+        /* no worker threads, e.g. on bare metal: the kernels run single threaded */
+        if(exec_graph->cpu_pool == NULL)
+            num_thread = 1;
+    }
+
+    exec_graph->num_thread = num_thread < 1 ? 1 : num_thread;
+    exec_graph->cpu_isa = get_graph_cpu_isa(ir_graph);
 
     for(int i = 0; i < node_num; i++)
     {
@@ -382,24 +447,139 @@ error:
     return NULL;
 }
 
+/* streaming move nodes change their output rows at run time (see mv_op.c),
+   so reserve the whole move buffer rather than the shape seen at prerun */
+static int get_tensor_mem_size(struct ir_node* ir_node, struct ir_tensor* ir_tensor)
+{
+    int mem_size = ir_tensor->elem_size * ir_tensor->elem_num;
+
+    if(ir_node->op.op_type == OP_MOVE)
+    {
+        struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
+        int max_size = ir_tensor->elem_size * mv_param->buffer_size * ir_tensor->dims[0];
+
+        if(max_size > mem_size)
+            mem_size = max_size;
+    }
+
+    return mem_size;
+}
+
+/*
+ * assign an offset in the arena to each buffer: the largest buffers are placed first,
+ * each one into the smallest gap left by the already placed buffers whose lifetime overlaps
+ */
+static int plan_mem_arena(struct vector* buf_list)
+{
+    int buf_num = get_vector_num(buf_list);
+    int arena_size = 0;
+
+    if(buf_num == 0)
+        return 0;
+
+    int* order = ( int* )sys_malloc(sizeof(int) * buf_num * 2);
+
+    if(order == NULL)
+        return -1;
+
+    int* live = order + buf_num;
+
+    /* sort by size, the earlier producer wins on a tie */
+    for(int i = 0; i < buf_num; i++)
+    {
+        struct mem_record* r = ( struct mem_record* )get_vector_data(buf_list, i);
+        int j = i;
+
+        for(; j > 0; j--)
+        {
+            struct mem_record* prev = ( struct mem_record* )get_vector_data(buf_list, order[j - 1]);
+
+            if(prev->size >= r->size)
+                break;
+
+            order[j] = order[j - 1];
+        }
+
+        order[j] = i;
+    }
+
+    for(int i = 0; i < buf_num; i++)
+    {
+        struct mem_record* r = ( struct mem_record* )get_vector_data(buf_list, order[i]);
+        int live_num = 0;
+
+        /* collect the placed buffers alive at the same time, ordered by offset */
+        for(int j = 0; j < i; j++)
+        {
+            struct mem_record* p = ( struct mem_record* )get_vector_data(buf_list, order[j]);
+
+            if(p->last < r->first || p->first > r->last)
+                continue;
+
+            int k = live_num++;
+
+            for(; k > 0; k--)
+            {
+                struct mem_record* q = ( struct mem_record* )get_vector_data(buf_list, live[k - 1]);
+
+                if(q->offset <= p->offset)
+                    break;
+
+                live[k] = live[k - 1];
+            }
+
+            live[k] = order[j];
+        }
+
+        int best_offset = -1;
+        int best_gap = 0;
+        int cur_offset = 0;
+
+        for(int j = 0; j < live_num; j++)
+        {
+            struct mem_record* p = ( struct mem_record* )get_vector_data(buf_list, live[j]);
+            int gap = p->offset - cur_offset;
+
+            if(gap >= r->size && (best_offset < 0 || gap < best_gap))
+            {
+                best_offset = cur_offset;
+                best_gap = gap;
+            }
+
+            if(p->offset + p->size > cur_offset)
+                cur_offset = p->offset + p->size;
+        }
+
+        r->offset = best_offset < 0 ? cur_offset : best_offset;
+
+        if(r->offset + r->size > arena_size)
+            arena_size = r->offset + r->size;
+    }
+
+    sys_free(order);
+
+    return arena_size;
+}
+
 static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
 {
-    struct mem_pool* mem_pool;
+    struct mem_pool* mem_pool = NULL;
     int max_shared_mem_size = 0;
 
     int node_num = get_vector_num(exec_graph->exec_node_list);
 
+    /* buffers still waiting for consumers, and buffers whose lifetime is known */
     struct vector* tensor_mem_list = create_vector(sizeof(struct mem_record), NULL);
+    struct vector* buf_list = create_vector(sizeof(struct mem_record), NULL);
 
-    if(tensor_mem_list == NULL)
-        return -1;
+    if(tensor_mem_list == NULL || buf_list == NULL)
+        goto error;
 
+    /* the block pool is only walked to report what the arena saves */
     mem_pool = create_mem_pool();
 
     if(mem_pool == NULL)
-        return -1;
-
-    exec_graph->mem_pool = mem_pool;
+        goto error;
 
     for(int i = 0; i < node_num; i++)
     {
@@ -421,6 +601,7 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
             if(ir_tensor->data != NULL)
                 continue;
 
+            int mem_size = get_tensor_mem_size(ir_node, ir_tensor);
             int inplace_input = find_inplace_input(exec_node, j, ir_node, ir_graph);
 
             if(inplace_input >= 0)
@@ -437,18 +618,24 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
 
                 input_r->ir_tensor = ir_tensor;
                 input_r->used = ir_tensor->consumer_num;
+
+                if(input_r->size < mem_size)
+                    input_r->size = mem_size;
+
                 block_id[j] = INPLACE_BLOCK_FLAG | inplace_input;
                 continue;
             }
 
-            /* allocate mem from pool */
-            int mem_size = ir_tensor->elem_size * ir_tensor->elem_num;
-
             struct mem_record r;
 
             r.ir_tensor = ir_tensor;
+            r.owner = ir_tensor;
             r.block_id = mem_pool->allocate(mem_pool, mem_size);
             r.used = ir_tensor->consumer_num;
+            r.size = mem_size;
+            r.first = i;
+            r.last = i;
+            r.offset = 0;
 
             block_id[j] = r.block_id;
 
@@ -471,10 +658,12 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
             struct mem_record* input_r = ( struct mem_record* )get_vector_data(tensor_mem_list, idx);
 
             input_r->used--;
+            input_r->last = i;
 
             if(input_r->used == 0)
             {
                 mem_pool->free(mem_pool, input_r->block_id);
+                push_vector_data(buf_list, input_r);
                 remove_vector_by_idx(tensor_mem_list, idx);
             }
         }
@@ -486,7 +675,49 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
 
     TLOG_DEBUG("final tensor_mem_list number: %d\n", get_vector_num(tensor_mem_list));
 
-    release_vector(tensor_mem_list);
+    /*
+     * what is left are the graph outputs: the caller reads them after run_graph() returns,
+     * even when a streaming node stopped the graph early, so keep them out of reach of any other buffer
+     */
+    for(int i = 0; i < get_vector_num(tensor_mem_list); i++)
+    {
+        struct mem_record* r = ( struct mem_record* )get_vector_data(tensor_mem_list, i);
+
+        r->first = 0;
+        r->last = node_num;
+
+        push_vector_data(buf_list, r);
+    }
+
+    int buf_num = get_vector_num(buf_list);
+
+    for(int i = 0; i < buf_num; i++)
+    {
+        struct mem_record* r = ( struct mem_record* )get_vector_data(buf_list, i);
+
+        r->size = (r->size + MEM_ARENA_ALIGN_SIZE - 1) & ~(MEM_ARENA_ALIGN_SIZE - 1);
+    }
+
+    int arena_size = plan_mem_arena(buf_list);
+
+    if(arena_size < 0)
+        goto error;
+
+    int pool_size = 0;
+    int block_num = get_vector_num(mem_pool->block_list);
+
+    for(int i = 0; i < block_num; i++)
+    {
+        struct mem_block_entry* entry = ( struct mem_block_entry* )get_vector_data(mem_pool->block_list, i);
+
+        pool_size += entry->max_req_size + mem_pool->align_size + 4;
+    }
+
+    TLOG_INFO("activation arena: %d bytes for %d tensors (mem pool: %d bytes in %d blocks)\n", arena_size, buf_num,
+              pool_size, block_num);
+
+    release_mem_pool(mem_pool);
+    mem_pool = NULL;
 
     exec_graph->shared_mem_size = max_shared_mem_size;
 
@@ -497,19 +728,30 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
         if(exec_graph->shared_mem == NULL)
         {
             TLOG_ERR("cannot allocate shared memory. size=%d\n", max_shared_mem_size);
-            return -1;
+            goto error;
         }
     }
 
     TLOG_ERR("shared memory: %p size=%d\n", exec_graph->shared_mem, max_shared_mem_size);
 
-    if(mem_pool->get_backend_mem(mem_pool) < 0)
+    if(arena_size > 0)
     {
-        TLOG_ERR("cannot allocate enough memory from backend\n");
-        return -1;
+        exec_graph->mem_arena = sys_malloc(arena_size + MEM_ARENA_ALIGN_SIZE);
+
+        if(exec_graph->mem_arena == NULL)
+        {
+            TLOG_ERR("cannot allocate activation arena. size=%d\n", arena_size);
+            goto error;
+        }
+
+        exec_graph->mem_arena_size = arena_size;
+
+        /* streaming graphs may hand out outputs before the first complete pass */
+        memset(exec_graph->mem_arena, 0, arena_size + MEM_ARENA_ALIGN_SIZE);
     }
 
-    mem_pool->dump(mem_pool);
+    unsigned long arena_addr = ( unsigned long )exec_graph->mem_arena;
+    char* arena_base = ( char* )((arena_addr + MEM_ARENA_ALIGN_SIZE - 1) & ~(MEM_ARENA_ALIGN_SIZE - 1));
 
     /* now, the real allocate */
     for(int i = 0; i < node_num; i++)
@@ -517,7 +759,6 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
         struct exec_node* exec_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
         struct ir_node* ir_node = exec_node->ir_node;
         struct ir_graph* ir_graph = ir_node->graph;
-        struct mem_pool* mem_pool = exec_graph->mem_pool;
 
         int8_t* block_id;
 
@@ -539,19 +780,40 @@ static int alloc_exec_graph_mem(struct exec_graph* exec_graph)
 
                 struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[input_idx]);
                 ir_tensor->data = input_tensor->data;
-                ir_tensor->free_host_mem = 0;
-                ir_tensor->internal_allocated = MEM_POOL_ALLOCATED;
             }
             else
             {
-                ir_tensor->data = mem_pool->get_mem_block(mem_pool, block_id[j]);
-                ir_tensor->free_host_mem = 0;
-                ir_tensor->internal_allocated = MEM_POOL_ALLOCATED;
+                for(int k = 0; k < buf_num; k++)
+                {
+                    struct mem_record* r = ( struct mem_record* )get_vector_data(buf_list, k);
+
+                    if(r->owner == ir_tensor)
+                    {
+                        ir_tensor->data = arena_base + r->offset;
+                        break;
+                    }
+                }
             }
+
+            ir_tensor->free_host_mem = 0;
+            ir_tensor->internal_allocated = MEM_POOL_ALLOCATED;
         }
     }
 
+    release_vector(tensor_mem_list);
+    release_vector(buf_list);
+
     return 0;
+
+error:
+    if(mem_pool)
+        release_mem_pool(mem_pool);
+    if(tensor_mem_list)
+        release_vector(tensor_mem_list);
+    if(buf_list)
+        release_vector(buf_list);
+
+    return -1;
 }
 
 static int prerun_exec_graph(struct exec_graph* exec_graph)
@@ -573,6 +835,221 @@ static int prerun_exec_graph(struct exec_graph* exec_graph)
     return 0;
 }
 
+static int* get_activation_param(struct ir_node* ir_node)
+{
+    if(ir_node->op.op_type == OP_CONV)
+        return &(( struct conv_param* )ir_node->op.param_mem)->activation;
+
+    if(ir_node->op.op_type == OP_FC)
+        return &(( struct fc_param* )ir_node->op.param_mem)->activation;
+
+    return NULL;
+}
+
+/*
+ * a relu right after a conv or a fc, being the only consumer of its output, is folded into it:
+ * the kernel clamps while requantizing, and the relu gets no step in the exec plan.
+ * The relu exec node is kept, so the memory planner still sees its output sharing the buffer of
+ * the conv output. Runs before prerun_exec_graph(), as kernels may pick the activation there.
+ */
+static void fuse_relu_node(struct exec_graph* exec_graph)
+{
+    int node_num = get_vector_num(exec_graph->exec_node_list);
+
+    for(int i = 0; i + 1 < node_num; i++)
+    {
+        struct exec_node* exec_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
+        struct exec_node* relu_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i + 1);
+        struct ir_node* ir_node = exec_node->ir_node;
+        struct ir_node* relu_ir_node = relu_node->ir_node;
+
+        int* activation = get_activation_param(ir_node);
+
+        if(activation == NULL || *activation > 0 || ir_node->output_num != 1 ||
+           relu_ir_node->op.op_type != OP_RELU)
+            continue;
+
+        struct ir_tensor* output = get_ir_graph_tensor(ir_node->graph, ir_node->output_tensors[0]);
+        struct ir_tensor* relu_output = get_ir_graph_tensor(relu_ir_node->graph, relu_ir_node->output_tensors[0]);
+
+        if(output->consumer_num != 1 || output->consumer[0] != relu_ir_node->idx || relu_output->data != output->data)
+            continue;
+
+        *activation = 0;
+        relu_node->fused = 1;
+        i++;
+    }
+}
+
+/* move nodes with flag set emit more rows once their history is filled,
+   which only their infer_shape() keeps track of */
+static int infer_every_run(struct ir_node* ir_node)
+{
+    if(ir_node->dynamic_shape)
+        return 1;
+
+    if(ir_node->op.op_type == OP_MOVE)
+    {
+        struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
+
+        return mv_param->flag;
+    }
+
+    return 0;
+}
+
+/* move nodes and stream convs keep rows from one run to the next */
+static int keeps_state(struct ir_node* ir_node)
+{
+    if(ir_node->op.op_type == OP_MOVE)
+        return 1;
+
+    if(ir_node->op.op_type == OP_CONV)
+    {
+        struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
+
+        return conv_param->stream;
+    }
+
+    return 0;
+}
+
+/*
+ * with the "cpu_tune" attr set, the nodes get the fastest of the node ops able to run them,
+ * timed on their tensors, or cached from a previous prerun of the model. The nodes keeping
+ * state and the fused relus keep the scored choice. Runs before prerun_exec_graph().
+ */
+static int tune_exec_graph(struct exec_graph* exec_graph, struct ir_graph* ir_graph)
+{
+    int tune = 0;
+
+    if(ir_graph->attr_num == 0 ||
+       get_attr_val(ir_graph->attr_mem, ir_graph->attr_num, "cpu_tune", NULL, &tune, sizeof(int)) != 0 || !tune)
+        return 0;
+
+    int node_num = get_vector_num(exec_graph->exec_node_list);
+
+    exec_graph->tune_log = ( struct tune_info* )sys_malloc(sizeof(struct tune_info) * node_num);
+
+    if(exec_graph->tune_log == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    uint32_t model_hash = get_model_hash(ir_graph);
+    int max_shared_mem_size = 0;
+
+    for(int i = 0; i < node_num; i++)
+    {
+        struct exec_node* exec_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
+
+        if(!exec_node->fused && !keeps_state(exec_node->ir_node))
+        {
+            int ret = tune_exec_node(exec_graph, exec_node, model_hash, exec_graph->tune_log + exec_graph->tune_num);
+
+            if(ret < 0)
+            {
+                TLOG_ERR("%s: failed to tune node %d\n", exec_graph->dev->base.name, exec_node->ir_node->idx);
+                return -1;
+            }
+
+            exec_graph->tune_num += ret;
+        }
+
+        if(exec_node->shared_mem_size > max_shared_mem_size)
+            max_shared_mem_size = exec_node->shared_mem_size;
+    }
+
+    /* the runs left data behind, while streaming graphs start from a zeroed arena */
+    if(exec_graph->mem_arena)
+        memset(exec_graph->mem_arena, 0, exec_graph->mem_arena_size + MEM_ARENA_ALIGN_SIZE);
+
+    /* the timing grew the shared memory to the largest candidate, the selected may need less */
+    if(max_shared_mem_size < exec_graph->shared_mem_size)
+    {
+        sys_free(exec_graph->shared_mem);
+
+        exec_graph->shared_mem = max_shared_mem_size > 0 ? sys_malloc(max_shared_mem_size) : NULL;
+        exec_graph->shared_mem_size = exec_graph->shared_mem ? max_shared_mem_size : 0;
+
+        if(max_shared_mem_size > 0 && exec_graph->shared_mem == NULL)
+        {
+            set_tengine_errno(ENOMEM);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int create_exec_plan(struct exec_graph* exec_graph)
+{
+    int node_num = get_vector_num(exec_graph->exec_node_list);
+    int step_num = 0;
+    int tensor_num = 0;
+
+    for(int i = 0; i < node_num; i++)
+    {
+        struct exec_node* exec_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
+
+        if(exec_node->fused)
+            continue;
+
+        step_num++;
+        tensor_num += exec_node->ir_node->input_num;
+    }
+
+    /* steps and the resolved tensors share one block */
+    struct exec_step* plan =
+        ( struct exec_step* )sys_malloc(sizeof(struct exec_step) * step_num + sizeof(struct ir_tensor*) * tensor_num);
+
+    if(plan == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    struct ir_tensor** tensors = ( struct ir_tensor** )(plan + step_num);
+    struct exec_step* step = plan;
+
+    exec_graph->tail_step = 0;
+
+    for(int i = 0; i < node_num; i++)
+    {
+        struct exec_node* exec_node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
+        struct ir_node* ir_node = exec_node->ir_node;
+
+        if(exec_node->fused)
+        {
+            step[-1].fused_node = ir_node;
+            continue;
+        }
+
+        step->exec_node = exec_node;
+        step->node_ops = exec_node->node_ops;
+        step->ir_node = ir_node;
+        step->input_tensors = tensors;
+        step->fused_node = NULL;
+        step->input_num = ir_node->input_num;
+        step->infer_always = infer_every_run(ir_node);
+
+        if(keeps_state(ir_node))
+            exec_graph->tail_step = step - plan + 1;
+
+        for(int j = 0; j < ir_node->input_num; j++)
+            tensors[j] = get_ir_graph_tensor(ir_node->graph, ir_node->input_tensors[j]);
+
+        tensors += ir_node->input_num;
+        step++;
+    }
+
+    exec_graph->exec_plan = plan;
+    exec_graph->step_num = step_num;
+
+    return 0;
+}
+
 static int prerun(struct nn_device* dev, struct subgraph* subgraph, int num_thread)
 {
     struct exec_graph* exec_graph;
@@ -583,7 +1060,15 @@ static int prerun(struct nn_device* dev, struct subgraph* subgraph, int num_thre
     if(exec_graph == NULL)
         return -1;
 
-    if(alloc_exec_graph_mem(exec_graph) < 0 || prerun_exec_graph(exec_graph) < 0)
+    if(alloc_exec_graph_mem(exec_graph) < 0)
+    {
+        release_exec_graph(exec_graph);
+        return -1;
+    }
+
+    fuse_relu_node(exec_graph);
+
+    if(tune_exec_graph(exec_graph, subgraph->graph) < 0 || prerun_exec_graph(exec_graph) < 0 || create_exec_plan(exec_graph) < 0)
     {
         release_exec_graph(exec_graph);
         return -1;
@@ -594,49 +1079,246 @@ static int prerun(struct nn_device* dev, struct subgraph* subgraph, int num_thre
     return 0;
 }
 
-static int run(struct nn_device* dev, struct subgraph* subgraph)
+/* only infer the shape again when an input was reshaped since the last run */
+static int infer_step_shape(struct exec_step* step)
+{
+    int reshaped = step->infer_always;
+
+    for(int i = 0; i < step->input_num; i++)
+    {
+        struct ir_tensor* ir_tensor = step->input_tensors[i];
+
+        if(ir_tensor->reshaped)
+        {
+            ir_tensor->reshaped--;
+            reshaped = 1;
+        }
+    }
+
+    if(!reshaped)
+        return 0;
+
+    struct ir_node* ir_node = step->ir_node;
+    struct ir_op* op = &ir_node->op;
+
+    if(op->infer_shape && op->infer_shape(ir_node) < 0)
+        return -1;
+
+    return 0;
+}
+
+/* the relu folded into a step takes the new shape of its input once the step has run */
+static int infer_fused_shape(struct exec_step* step)
+{
+    struct ir_node* ir_node = step->fused_node;
+    struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_node->graph, ir_node->input_tensors[0]);
+
+    if(!ir_tensor->reshaped)
+        return 0;
+
+    ir_tensor->reshaped--;
+
+    return ir_node->op.infer_shape(ir_node);
+}
+
+static int get_tensor_bytes(struct ir_tensor* ir_tensor)
+{
+    return ir_tensor->elem_num * ir_tensor->elem_size;
+}
+
+/* a node returning "not enough data" is recorded too: the time was spent anyway */
+static void record_perf_stat(struct exec_graph* exec_graph, int step_idx, uint32_t used_time)
+{
+    struct exec_step* step = &exec_graph->exec_plan[step_idx];
+    struct perf_info* perf = &exec_graph->perf_stat[step_idx];
+    struct ir_node* ir_node = step->ir_node;
+    uint32_t bytes = 0;
+
+    for(int i = 0; i < step->input_num; i++)
+        bytes += get_tensor_bytes(step->input_tensors[i]);
+
+    for(int i = 0; i < ir_node->output_num; i++)
+        bytes += get_tensor_bytes(get_ir_graph_tensor(ir_node->graph, ir_node->output_tensors[i]));
+
+    if(perf->count == 0 || used_time < perf->min)
+        perf->min = used_time;
+
+    if(used_time > perf->max)
+        perf->max = used_time;
+
+    perf->count++;
+    perf->total_time += used_time;
+    perf->total_bytes += bytes;
+}
+
+static void clear_perf_stat(struct exec_graph* exec_graph)
+{
+    uint32_t base = get_perf_clock_base();
+
+    for(int i = 0; i < exec_graph->step_num; i++)
+    {
+        struct perf_info* perf = &exec_graph->perf_stat[i];
+
+        perf->count = 0;
+        perf->min = 0;
+        perf->max = 0;
+        perf->total_time = 0;
+        perf->total_bytes = 0;
+        perf->base = base;
+    }
+}
+
+static int perf_stat(struct nn_device* dev, struct subgraph* subgraph, int action)
 {
     struct exec_graph* exec_graph = subgraph->exec_graph;
 
-    int node_num = get_vector_num(exec_graph->exec_node_list);
-	
-    for(int i = 0; i < node_num; i++)
+    if(action == GRAPH_PERF_STAT_DISABLE)
     {
-        struct exec_node* node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
-        struct node_ops* node_ops = node->node_ops;
+        sys_free(exec_graph->perf_stat);
+        exec_graph->perf_stat = NULL;
+        exec_graph->perf_on = 0;
+
+        return 0;
+    }
 
-        /* TODO: handle the shape changed  and dynamic shape case */
+    if(exec_graph->perf_stat == NULL && (action == GRAPH_PERF_STAT_ENABLE || action == GRAPH_PERF_STAT_START))
+    {
+        int size = sizeof(struct perf_info) * exec_graph->step_num;
+
+        exec_graph->perf_stat = ( struct perf_info* )sys_malloc(size);
 
-        /* TODO: add dynamic skip feature */
-        struct ir_node *ir_node = node->ir_node ;
-        struct ir_op* op = &ir_node->op;
-               
-        if(op->infer_shape && op->infer_shape(ir_node) < 0 )
+        if(exec_graph->perf_stat == NULL)
         {
-            TLOG_ERR("%s: failed to run node %d\n", dev->name, node->ir_node->idx);
+            set_tengine_errno(ENOMEM);
+            return -1;
         }
-        
-        int ret = node_ops->run(node_ops, node, exec_graph) ; 
-				
-		if ( ret > 0 )
-			break ;
-				
-		if ( ret < 0 )
+
+        memset(exec_graph->perf_stat, 0, size);
+
+        for(int i = 0; i < exec_graph->step_num; i++)
         {
-            TLOG_ERR("%s: failed to run node %d\n", dev->name, node->ir_node->idx);
+            struct perf_info* perf = &exec_graph->perf_stat[i];
+            struct ir_node* ir_node = exec_graph->exec_plan[i].ir_node;
+
+            perf->name = ir_node->name;
+            perf->dev_name = dev->name;
+            perf->op_name = get_op_name(ir_node->op.op_type);
+            perf->node_idx = ir_node->idx;
+        }
+
+        clear_perf_stat(exec_graph);
+    }
+
+    if(exec_graph->perf_stat == NULL)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    switch(action)
+    {
+        case GRAPH_PERF_STAT_ENABLE:
+        case GRAPH_PERF_STAT_START:
+            exec_graph->perf_on = 1;
+            break;
+        case GRAPH_PERF_STAT_STOP:
+            exec_graph->perf_on = 0;
+            break;
+        case GRAPH_PERF_STAT_RESET:
+            clear_perf_stat(exec_graph);
+            break;
+        default:
+            set_tengine_errno(ENOTSUP);
+            return -1;
+    }
+
+    return 0;
+}
+
+static int get_perf_stat(struct nn_device* dev, struct subgraph* subgraph, struct perf_info** buf, int buf_size)
+{
+    struct exec_graph* exec_graph = subgraph->exec_graph;
+
+    if(exec_graph->perf_stat == NULL)
+        return 0;
+
+    int num = exec_graph->step_num < buf_size ? exec_graph->step_num : buf_size;
+
+    for(int i = 0; i < num; i++)
+        buf[i] = &exec_graph->perf_stat[i];
+
+    return num;
+}
+
+static int get_tune_log(struct nn_device* dev, struct subgraph* subgraph, struct tune_info** buf, int buf_size)
+{
+    struct exec_graph* exec_graph = subgraph->exec_graph;
+    int num = exec_graph->tune_num < buf_size ? exec_graph->tune_num : buf_size;
+
+    for(int i = 0; i < num; i++)
+        buf[i] = &exec_graph->tune_log[i];
+
+    return num;
+}
+
+static int cpu_dev_save_tune_cache(struct nn_device* dev, void* buf, int buf_size)
+{
+    return save_tune_cache_blob(buf, buf_size);
+}
+
+static int cpu_dev_load_tune_cache(struct nn_device* dev, const void* buf, int size)
+{
+    return load_tune_cache_blob(buf, size);
+}
+
+/* runs the steps before step_end, 1 when a node has not collected enough data yet */
+static int run_steps(struct nn_device* dev, struct exec_graph* exec_graph, int step_end)
+{
+    struct exec_step* plan = exec_graph->exec_plan;
+
+    for(int i = 0; i < step_end; i++)
+    {
+        struct exec_step* step = &plan[i];
+        struct node_ops* node_ops = step->node_ops;
+
+        if(infer_step_shape(step) < 0)
+        {
+            TLOG_ERR("%s: failed to infer shape of node %d\n", dev->name, step->ir_node->idx);
+            return -1;
+        }
+
+        uint32_t start_time = exec_graph->perf_on ? read_perf_clock() : 0;
+
+        int ret = node_ops->run(node_ops, step->exec_node, exec_graph);
+
+        if(exec_graph->perf_on)
+            record_perf_stat(exec_graph, i, read_perf_clock() - start_time);
+
+        /* the node has not collected enough data yet */
+        if(ret > 0)
+            return 1;
+
+        if(ret < 0)
+        {
+            TLOG_ERR("%s: failed to run node %d\n", dev->name, step->ir_node->idx);
             return -1;
         }
-				
+
+        if(step->fused_node && infer_fused_shape(step) < 0)
+        {
+            TLOG_ERR("%s: failed to infer shape of node %d\n", dev->name, step->fused_node->idx);
+            return -1;
+        }
+
 //#define DUMP_NODE_OUTPUT
 #ifdef DUMP_NODE_OUTPUT
         /* dump the node output */
-        struct ir_node* ir_node = node->ir_node;
-        struct ir_graph* ir_graph = ir_node->graph;
+        struct ir_node* ir_node = step->ir_node;
 
         for(int i = 0; i < ir_node->input_num; i++)
         {
             char fname[128];
-            struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[i]);
+            struct ir_tensor* ir_tensor = step->input_tensors[i];
 
             sprintf(fname, "/tmp/dump/node%s%d.%d", (ir_node->idx < 10 ? "0" : ""), ir_node->idx, i);
 
@@ -644,12 +1326,52 @@ static int run(struct nn_device* dev, struct subgraph* subgraph)
         }
 
 #endif
-
     }
 
     return 0;
 }
 
+/* moves the graph inputs of the subgraph from one chunk of the run to another */
+static void move_input_chunk(struct subgraph* subgraph, int chunk_delta)
+{
+    struct ir_graph* ir_graph = subgraph->graph;
+
+    for(int i = 0; i < subgraph->input_num; i++)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, subgraph->input_tensor_list[i]);
+
+        if(ir_tensor->tensor_type == TENSOR_TYPE_INPUT)
+            ir_tensor->data = ( char* )ir_tensor->data + chunk_delta * ( int )(ir_tensor->elem_num * ir_tensor->elem_size);
+    }
+}
+
+static int run(struct nn_device* dev, struct subgraph* subgraph)
+{
+    struct exec_graph* exec_graph = subgraph->exec_graph;
+    int chunk_num = subgraph->graph->stream_chunk_num;
+
+    if(chunk_num <= 1)
+        return run_steps(dev, exec_graph, exec_graph->step_num) < 0 ? -1 : 0;
+
+    /* the nodes after the last one keeping state only matter for the last chunk */
+    int ret = 0;
+    int chunk = 0;
+
+    for(; chunk < chunk_num - 1 && ret >= 0; chunk++)
+    {
+        ret = run_steps(dev, exec_graph, exec_graph->tail_step);
+
+        move_input_chunk(subgraph, 1);
+    }
+
+    if(ret >= 0)
+        ret = run_steps(dev, exec_graph, exec_graph->step_num);
+
+    move_input_chunk(subgraph, -chunk);
+
+    return ret < 0 ? -1 : 0;
+}
+
 static int postrun(struct nn_device* dev, struct subgraph* subgraph)
 {
     struct exec_graph* exec_graph = subgraph->exec_graph;
@@ -674,6 +1396,30 @@ static int postrun(struct nn_device* dev, struct subgraph* subgraph)
     return 0;
 }
 
+static int reset(struct nn_device* dev, struct subgraph* subgraph)
+{
+    struct exec_graph* exec_graph = subgraph->exec_graph;
+    int node_num = get_vector_num(exec_graph->exec_node_list);
+
+    for(int i = 0; i < node_num; i++)
+    {
+        struct exec_node* node = ( struct exec_node* )get_vector_data(exec_graph->exec_node_list, i);
+        struct node_ops* node_ops = node->node_ops;
+
+        if(node_ops->reset && node_ops->reset(node_ops, node, exec_graph) < 0)
+        {
+            TLOG_ERR("%s: failed to reset node %d\n", dev->name, node->ir_node->idx);
+            return -1;
+        }
+    }
+
+    /* outputs of a node that has not collected enough data are read as they were left */
+    if(exec_graph->mem_arena)
+        memset(exec_graph->mem_arena, 0, exec_graph->mem_arena_size + MEM_ARENA_ALIGN_SIZE);
+
+    return 0;
+}
+
 static int cpu_dev_release_exec_graph(struct nn_device* dev, void* exec_graph)
 {
     release_exec_graph(exec_graph);
@@ -688,6 +1434,12 @@ static struct cpu_device cpu_dev = {
              .async_run = NULL,
              .async_wait = NULL,
              .release_exec_graph = cpu_dev_release_exec_graph,
+             .reset = reset,
+             .perf_stat = perf_stat,
+             .get_perf_stat = get_perf_stat,
+             .get_tune_log = get_tune_log,
+             .save_tune_cache = cpu_dev_save_tune_cache,
+             .load_tune_cache = cpu_dev_load_tune_cache,
              .init = NULL,
              .release = NULL},
     .master_cpu = 0,
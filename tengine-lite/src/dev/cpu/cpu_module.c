@@ -27,10 +27,11 @@
 #include "sys_port.h"
 #include "module.h"
 #include "cpu_node_ops.h"
+#include "cpu_tune.h"
 
 static int init_cpu_module(void* arg)
 {
-    if(init_cpu_node_ops_registry() < 0)
+    if(init_cpu_node_ops_registry() < 0 || init_tune_cache() < 0)
         return -1;
 
     return 0;
@@ -39,6 +40,7 @@ static int init_cpu_module(void* arg)
 static int release_cpu_module(void* arg)
 {
     release_cpu_node_ops_registry();
+    release_tune_cache();
     return 0;
 }
 
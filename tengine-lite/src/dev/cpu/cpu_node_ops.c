@@ -127,6 +127,10 @@ static inline struct node_ops* find_builtin_node_ops(struct exec_graph* exec_gra
     {
         struct node_ops* node_ops = *( struct node_ops** )get_vector_data(ops_vector, i);
 
+        /* a variant for an isa the cpu lacks, or the graph does not allow */
+        if(node_ops->isa & ~exec_graph->cpu_isa)
+            continue;
+
         int score = node_ops->score(node_ops, exec_graph, ir_node);
 
         if(score > max_score)
@@ -139,6 +143,59 @@ static inline struct node_ops* find_builtin_node_ops(struct exec_graph* exec_gra
     return selected_ops;
 }
 
+int get_node_ops_candidates(struct exec_graph* exec_graph, struct ir_node* ir_node, struct node_ops** cand_list,
+                            int cand_size)
+{
+    int op_type = ir_node->op.op_type;
+
+    if(op_type < OP_GENERIC || op_type >= OP_BUILTIN_LAST)
+        return 0;
+
+    struct vector* ops_vector = builtin_ops_registry[op_type];
+    int num = get_vector_num(ops_vector);
+    int score_list[MAX_TUNE_CAND_NUM];
+    int cand_num = 0;
+
+    if(cand_size > MAX_TUNE_CAND_NUM)
+        cand_size = MAX_TUNE_CAND_NUM;
+
+    for(int i = 0; i < num; i++)
+    {
+        struct node_ops* node_ops = *( struct node_ops** )get_vector_data(ops_vector, i);
+
+        if(node_ops->isa & ~exec_graph->cpu_isa)
+            continue;
+
+        int score = node_ops->score(node_ops, exec_graph, ir_node);
+
+        if(score <= 0)
+            continue;
+
+        /* after the ones of the same score, as find_builtin_node_ops() takes the first of them */
+        int j = cand_num;
+
+        while(j > 0 && score_list[j - 1] < score)
+            j--;
+
+        if(j == cand_size)
+            continue;
+
+        if(cand_num < cand_size)
+            cand_num++;
+
+        for(int k = cand_num - 1; k > j; k--)
+        {
+            cand_list[k] = cand_list[k - 1];
+            score_list[k] = score_list[k - 1];
+        }
+
+        cand_list[j] = node_ops;
+        score_list[j] = score;
+    }
+
+    return cand_num;
+}
+
 static int init_custom_ops_registry(void)
 {
     custom_ops_registry = create_vector(sizeof(struct custom_reg_entry), NULL);
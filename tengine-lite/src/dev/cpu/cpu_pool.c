@@ -0,0 +1,268 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#include "sys_port.h"
+#include "tengine_c_api.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "cpu_pool.h"
+
+static int run_parts(cpu_task_t task, void* arg, int part_num)
+{
+    for(int i = 0; i < part_num; i++)
+    {
+        if(task(arg, i, part_num) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+int get_cpu_pool_part_num(int num_thread, int unit_num, int unit_macs)
+{
+    int64_t part_num = ( int64_t )unit_num * unit_macs / CPU_POOL_MIN_PART_MACS;
+
+    if(part_num > num_thread)
+        part_num = num_thread;
+
+    if(part_num > unit_num)
+        part_num = unit_num;
+
+    return part_num < 1 ? 1 : ( int )part_num;
+}
+
+#ifdef CONFIG_BAREMETAL_BUILD
+
+struct cpu_pool* create_cpu_pool(int num_thread)
+{
+    return NULL;
+}
+
+void release_cpu_pool(struct cpu_pool* pool) {}
+
+int run_cpu_pool(struct cpu_pool* pool, cpu_task_t task, void* arg, int part_num)
+{
+    return run_parts(task, arg, part_num);
+}
+
+#else
+#include <pthread.h>
+
+struct cpu_worker
+{
+    struct cpu_pool* pool;
+    pthread_t thread;
+    int part;
+};
+
+struct cpu_pool
+{
+    int worker_num; /* the calling thread is not counted */
+    struct cpu_worker* workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+
+    /* the task being run, a new one bumps seq */
+    unsigned int seq;
+    cpu_task_t task;
+    void* arg;
+    int part_num;
+    int pending;
+    int failed;
+    int quit;
+};
+
+static void* worker_loop(void* data)
+{
+    struct cpu_worker* worker = ( struct cpu_worker* )data;
+    struct cpu_pool* pool = worker->pool;
+    unsigned int seq = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while(1)
+    {
+        while(pool->seq == seq && !pool->quit)
+            pthread_cond_wait(&pool->start_cond, &pool->mutex);
+
+        if(pool->quit)
+            break;
+
+        seq = pool->seq;
+
+        if(worker->part >= pool->part_num)
+            continue;
+
+        cpu_task_t task = pool->task;
+        void* arg = pool->arg;
+        int part_num = pool->part_num;
+
+        pthread_mutex_unlock(&pool->mutex);
+
+        int ret = task(arg, worker->part, part_num);
+
+        pthread_mutex_lock(&pool->mutex);
+
+        if(ret < 0)
+            pool->failed = 1;
+
+        if(--pool->pending == 0)
+            pthread_cond_signal(&pool->done_cond);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+static void stop_workers(struct cpu_pool* pool, int started)
+{
+    pthread_mutex_lock(&pool->mutex);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for(int i = 0; i < started; i++)
+        pthread_join(pool->workers[i].thread, NULL);
+}
+
+struct cpu_pool* create_cpu_pool(int num_thread)
+{
+    if(num_thread < 2)
+        return NULL;
+
+    struct cpu_pool* pool = ( struct cpu_pool* )sys_malloc(sizeof(struct cpu_pool));
+
+    if(pool == NULL)
+        return NULL;
+
+    pool->worker_num = num_thread - 1;
+    pool->workers = ( struct cpu_worker* )sys_malloc(sizeof(struct cpu_worker) * pool->worker_num);
+
+    if(pool->workers == NULL)
+    {
+        sys_free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    pool->seq = 0;
+    pool->task = NULL;
+    pool->arg = NULL;
+    pool->part_num = 0;
+    pool->pending = 0;
+    pool->failed = 0;
+    pool->quit = 0;
+
+    for(int i = 0; i < pool->worker_num; i++)
+    {
+        struct cpu_worker* worker = &pool->workers[i];
+
+        worker->pool = pool;
+        worker->part = i + 1;
+
+        if(pthread_create(&worker->thread, NULL, worker_loop, worker) != 0)
+        {
+            TLOG_ERR("cpu pool: failed to create worker %d\n", i);
+            stop_workers(pool, i);
+            pthread_mutex_destroy(&pool->mutex);
+            pthread_cond_destroy(&pool->start_cond);
+            pthread_cond_destroy(&pool->done_cond);
+            sys_free(pool->workers);
+            sys_free(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void release_cpu_pool(struct cpu_pool* pool)
+{
+    if(pool == NULL)
+        return;
+
+    stop_workers(pool, pool->worker_num);
+
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_cond_destroy(&pool->done_cond);
+
+    sys_free(pool->workers);
+    sys_free(pool);
+}
+
+int run_cpu_pool(struct cpu_pool* pool, cpu_task_t task, void* arg, int part_num)
+{
+    if(pool == NULL || part_num < 2)
+        return run_parts(task, arg, part_num);
+
+    if(part_num > pool->worker_num + 1)
+    {
+        TLOG_ERR("cpu pool: %d parts for %d threads\n", part_num, pool->worker_num + 1);
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+
+    pool->task = task;
+    pool->arg = arg;
+    pool->part_num = part_num;
+    pool->pending = part_num - 1;
+    pool->failed = 0;
+    pool->seq++;
+
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    int ret = task(arg, 0, part_num);
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while(pool->pending > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->mutex);
+
+    int failed = pool->failed;
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    if(ret < 0)
+        return -1;
+
+    /* the errno of the failed part was set in its own thread */
+    if(failed)
+    {
+        set_tengine_errno(EFAULT);
+        return -1;
+    }
+
+    return 0;
+}
+
+#endif
@@ -292,7 +292,11 @@ static int get_cpu_model_arch(int id, struct cluster_entry* cluster)
 static int get_cpu_model_arch(int id, struct cluster_entry* cluster)
 {
     cluster->cpu_model = CPU_GENERIC;
-    cluster->cpu_arch = CPU_GENERIC;
+#if defined(__x86_64__) || defined(__i386__)
+    cluster->cpu_arch = ARCH_X86;
+#else
+    cluster->cpu_arch = ARCH_GENERIC;
+#endif
     cluster->l1_size = 32 << 10;
     cluster->l2_size = 512 << 10;
 
@@ -402,3 +406,110 @@ REGISTER_CRIT_MODULE_INIT(MOD_CORE_LEVEL, "probe_system_cpu", probe_system_cpu);
 REGISTER_MODULE_EXIT(MOD_CORE_LEVEL, "free_probed_cpu_info", free_probed_cpu_info);
 
 #endif
+
+/*
+ * the isa features for the kernel variants, see find_builtin_node_ops(): from CPUID on x86, none
+ * elsewhere yet. TENGINE_CPU_ISA=none|sse4.1|avx2|avx512_vnni caps them for the process, e.g.
+ * to time the SSE4.1 kernels on an AVX2 server; the "cpu_isa" graph attr does it for one graph.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cpuid.h>
+
+#include "tengine_c_api.h"
+
+struct isa_name
+{
+    const char* name;
+    int isa;
+};
+
+static const struct isa_name isa_names[] = {
+    {"none", 0},
+    {"sse4.1", CPU_ISA_SSE41},
+    {"avx2", CPU_ISA_SSE41 | CPU_ISA_AVX2},
+    {"avx512_vnni", CPU_ISA_SSE41 | CPU_ISA_AVX2 | CPU_ISA_AVX512_VNNI},
+};
+
+/* XCR0: the registers the OS saves at a switch */
+static uint64_t read_xcr0(void)
+{
+    uint32_t eax, edx;
+
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return (( uint64_t )edx << 32) | eax;
+}
+
+static int probe_x86_isa(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    int isa = 0;
+
+    if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    if(ecx & bit_SSE4_1)
+        isa |= CPU_ISA_SSE41;
+
+    /* the ymm registers must be saved by the OS for AVX2, and the zmm and k ones for AVX-512 */
+    if(!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX) || __get_cpuid_max(0, NULL) < 7)
+        return isa;
+
+    uint64_t xcr0 = read_xcr0();
+
+    if((xcr0 & 0x6) != 0x6)
+        return isa;
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    if(ebx & bit_AVX2)
+        isa |= CPU_ISA_AVX2;
+
+    if((xcr0 & 0xe6) == 0xe6 && (ebx & bit_AVX512F) && (ebx & bit_AVX512BW) && (ecx & bit_AVX512VNNI))
+        isa |= CPU_ISA_AVX512_VNNI;
+
+    return isa;
+}
+
+int get_cpu_isa(void)
+{
+    static int cpu_isa = -1;
+
+    if(cpu_isa >= 0)
+        return cpu_isa;
+
+    int isa = probe_x86_isa();
+    const char* env = getenv("TENGINE_CPU_ISA");
+
+    if(env != NULL)
+    {
+        int i;
+
+        for(i = 0; i < sizeof(isa_names) / sizeof(isa_names[0]); i++)
+        {
+            if(!strcmp(env, isa_names[i].name))
+                break;
+        }
+
+        if(i < sizeof(isa_names) / sizeof(isa_names[0]))
+            isa &= isa_names[i].isa;
+        else
+            TLOG_ERR("unknown TENGINE_CPU_ISA: %s\n", env);
+    }
+
+    cpu_isa = isa;
+
+    return cpu_isa;
+}
+
+#else
+
+int get_cpu_isa(void)
+{
+    return 0;
+}
+
+#endif
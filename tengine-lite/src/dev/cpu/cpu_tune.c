@@ -0,0 +1,689 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * the "cpu_tune" graph attr: at prerun, every node with more than one node ops able to run it
+ * gets the one of them running it the fastest, timed on its own tensors. The choices are
+ * cached by model, shape, isa and threads, for the later preruns of the model. The node ops are
+ * known by their name, so the cache can be saved as a blob and loaded by a later process.
+ */
+
+#include <string.h>
+
+#if defined(CONFIG_FREERTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#elif !defined(CONFIG_BAREMETAL_BUILD)
+#include <pthread.h>
+#endif
+
+#include "sys_port.h"
+#include "tengine_c_api.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_utils.h"
+#include "tengine_ir.h"
+#include "vector.h"
+#include "cpu_device.h"
+#include "cpu_node_ops.h"
+#include "cpu_tune.h"
+
+/* the timed runs of each node ops, after one to warm the caches */
+#define TUNE_RUN_NUM 5
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
+/* node ops names, longer ones are cut */
+#define TUNE_NAME_SIZE 16
+
+#define TUNE_CACHE_MAGIC 0x454e5554 /* "TUNE" */
+#define TUNE_CACHE_VERSION 1
+
+struct tune_key
+{
+    uint32_t model_hash;
+    uint32_t shape_hash; /* op, params and tensor shapes of the node */
+    uint32_t cand_hash; /* the names of the node ops able to run it */
+    int32_t cpu_isa;
+    int32_t num_thread;
+};
+
+struct tune_entry
+{
+    struct tune_key key;
+    int32_t cand_num; /* the node ops which ran on the node, highest score first */
+    int32_t selected;
+    char cand_name[MAX_TUNE_CAND_NUM][TUNE_NAME_SIZE];
+    uint32_t cand_time[MAX_TUNE_CAND_NUM];
+};
+
+/* the blob of save_tune_cache_blob(): the header, then the entries */
+struct tune_cache_header
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_size;
+    int32_t entry_num;
+};
+
+static struct vector* tune_cache;
+
+/* the preruns of two graphs may tune at the same time */
+#if defined(CONFIG_FREERTOS)
+static SemaphoreHandle_t tune_lock;
+
+static void lock_tune_cache(void)
+{
+    xSemaphoreTake(tune_lock, portMAX_DELAY);
+}
+
+static void unlock_tune_cache(void)
+{
+    xSemaphoreGive(tune_lock);
+}
+#elif defined(CONFIG_BAREMETAL_BUILD)
+static void lock_tune_cache(void) {}
+
+static void unlock_tune_cache(void) {}
+#else
+static pthread_mutex_t tune_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void lock_tune_cache(void)
+{
+    pthread_mutex_lock(&tune_lock);
+}
+
+static void unlock_tune_cache(void)
+{
+    pthread_mutex_unlock(&tune_lock);
+}
+#endif
+
+/* FNV-1a */
+static uint32_t hash_bytes(uint32_t hash, const void* data, int size)
+{
+    const uint8_t* p = ( const uint8_t* )data;
+
+    for(int i = 0; i < size; i++)
+        hash = (hash ^ p[i]) * FNV_PRIME;
+
+    return hash;
+}
+
+static uint32_t hash_tensor_shape(uint32_t hash, const struct ir_tensor* ir_tensor)
+{
+    hash = hash_bytes(hash, &ir_tensor->data_type, sizeof(ir_tensor->data_type));
+    hash = hash_bytes(hash, &ir_tensor->dim_num, sizeof(ir_tensor->dim_num));
+
+    return hash_bytes(hash, ir_tensor->dims, sizeof(int) * ir_tensor->dim_num);
+}
+
+static uint32_t hash_node(uint32_t hash, const struct ir_node* ir_node)
+{
+    hash = hash_bytes(hash, &ir_node->op.op_type, sizeof(ir_node->op.op_type));
+
+    if(ir_node->op.param_mem)
+        hash = hash_bytes(hash, ir_node->op.param_mem, ir_node->op.param_size);
+
+    return hash;
+}
+
+uint32_t get_model_hash(struct ir_graph* ir_graph)
+{
+    uint32_t hash = FNV_OFFSET;
+
+    for(int i = 0; i < ir_graph->node_num; i++)
+        hash = hash_node(hash, ir_graph->node_list[i]);
+
+    for(int i = 0; i < ir_graph->tensor_num; i++)
+    {
+        struct ir_tensor* ir_tensor = ir_graph->tensor_list[i];
+
+        hash = hash_tensor_shape(hash, ir_tensor);
+
+        if(ir_tensor->tensor_type == TENSOR_TYPE_CONST && ir_tensor->data)
+            hash = hash_bytes(hash, ir_tensor->data, ir_tensor->elem_num * ir_tensor->elem_size);
+    }
+
+    return hash;
+}
+
+static uint32_t get_shape_hash(struct ir_node* ir_node)
+{
+    struct ir_graph* ir_graph = ir_node->graph;
+    uint32_t hash = hash_node(FNV_OFFSET, ir_node);
+
+    for(int i = 0; i < ir_node->input_num; i++)
+        hash = hash_tensor_shape(hash, get_ir_graph_tensor(ir_graph, ir_node->input_tensors[i]));
+
+    for(int i = 0; i < ir_node->output_num; i++)
+        hash = hash_tensor_shape(hash, get_ir_graph_tensor(ir_graph, ir_node->output_tensors[i]));
+
+    return hash;
+}
+
+static uint32_t get_cand_hash(struct node_ops** cand_list, int cand_num)
+{
+    uint32_t hash = FNV_OFFSET;
+
+    for(int i = 0; i < cand_num; i++)
+    {
+        char name[TUNE_NAME_SIZE];
+
+        memset(name, 0, sizeof(name));
+        strncpy(name, cand_list[i]->name, TUNE_NAME_SIZE - 1);
+
+        hash = hash_bytes(hash, name, TUNE_NAME_SIZE);
+    }
+
+    return hash;
+}
+
+/* called with the lock held */
+static struct tune_entry* find_tune_entry(const struct tune_key* key)
+{
+    int num = tune_cache ? get_vector_num(tune_cache) : 0;
+
+    for(int i = 0; i < num; i++)
+    {
+        struct tune_entry* entry = ( struct tune_entry* )get_vector_data(tune_cache, i);
+
+        if(!memcmp(&entry->key, key, sizeof(struct tune_key)))
+            return entry;
+    }
+
+    return NULL;
+}
+
+/* called with the lock held, returns 1 when added */
+static int add_tune_entry(const struct tune_entry* entry)
+{
+    if(find_tune_entry(&entry->key))
+        return 0;
+
+    if(tune_cache == NULL)
+        tune_cache = create_vector(sizeof(struct tune_entry), NULL);
+
+    /* only a missed choice, the node is tuned again next time */
+    if(tune_cache == NULL || push_vector_data(tune_cache, ( void* )entry) < 0)
+        return 0;
+
+    return 1;
+}
+
+int init_tune_cache(void)
+{
+#if defined(CONFIG_FREERTOS)
+    tune_lock = xSemaphoreCreateMutex();
+
+    if(tune_lock == NULL)
+        return -1;
+#endif
+
+    return 0;
+}
+
+void release_tune_cache(void)
+{
+    if(tune_cache)
+        release_vector(tune_cache);
+
+    tune_cache = NULL;
+
+#if defined(CONFIG_FREERTOS)
+    if(tune_lock)
+        vSemaphoreDelete(tune_lock);
+
+    tune_lock = NULL;
+#endif
+}
+
+int save_tune_cache_blob(void* buf, int buf_size)
+{
+    lock_tune_cache();
+
+    int entry_num = tune_cache ? get_vector_num(tune_cache) : 0;
+    int size = sizeof(struct tune_cache_header) + sizeof(struct tune_entry) * entry_num;
+
+    if(buf == NULL)
+    {
+        unlock_tune_cache();
+        return size;
+    }
+
+    if(buf_size < size)
+    {
+        unlock_tune_cache();
+        set_tengine_errno(ENOSPC);
+        return -1;
+    }
+
+    struct tune_cache_header header;
+    char* entry_data = ( char* )buf + sizeof(header);
+
+    header.magic = TUNE_CACHE_MAGIC;
+    header.version = TUNE_CACHE_VERSION;
+    header.entry_size = sizeof(struct tune_entry);
+    header.entry_num = entry_num;
+
+    /* the blob may not be aligned */
+    memcpy(buf, &header, sizeof(header));
+
+    for(int i = 0; i < entry_num; i++)
+        memcpy(entry_data + sizeof(struct tune_entry) * i, get_vector_data(tune_cache, i), sizeof(struct tune_entry));
+
+    unlock_tune_cache();
+
+    return size;
+}
+
+int load_tune_cache_blob(const void* buf, int size)
+{
+    struct tune_cache_header header;
+
+    if(buf == NULL || size < ( int )sizeof(header))
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    /* the blob may not be aligned */
+    memcpy(&header, buf, sizeof(header));
+
+    if(header.magic != TUNE_CACHE_MAGIC || header.version != TUNE_CACHE_VERSION ||
+       header.entry_size != sizeof(struct tune_entry) || header.entry_num < 0 ||
+       (size - ( int )sizeof(header)) / ( int )sizeof(struct tune_entry) < header.entry_num)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    const char* entry_data = ( const char* )buf + sizeof(header);
+    int num = 0;
+
+    lock_tune_cache();
+
+    for(int i = 0; i < header.entry_num; i++)
+    {
+        struct tune_entry entry;
+
+        memcpy(&entry, entry_data + sizeof(struct tune_entry) * i, sizeof(struct tune_entry));
+
+        if(entry.cand_num < 1 || entry.cand_num > MAX_TUNE_CAND_NUM || entry.selected < 0 ||
+           entry.selected >= entry.cand_num)
+            continue;
+
+        num += add_tune_entry(&entry);
+    }
+
+    unlock_tune_cache();
+
+    return num;
+}
+
+/* the node ops of the node named name, NULL when none */
+static struct node_ops* find_candidate(struct node_ops** cand_list, int cand_num, const char* name)
+{
+    for(int i = 0; i < cand_num; i++)
+    {
+        if(!strncmp(cand_list[i]->name, name, TUNE_NAME_SIZE - 1))
+            return cand_list[i];
+    }
+
+    return NULL;
+}
+
+static void release_node_ops(struct exec_graph* exec_graph, struct exec_node* exec_node)
+{
+    struct node_ops* node_ops = exec_node->node_ops;
+
+    if(node_ops->release_node)
+        node_ops->release_node(node_ops, exec_node, exec_graph);
+
+    exec_node->ops_priv = NULL;
+}
+
+/*
+ * binds node_ops to the node planned for other ones: it must map the same outputs in place
+ * as them, and the shared memory grows to what it asks for.
+ */
+static int bind_node_ops(struct exec_graph* exec_graph, struct exec_node* exec_node, struct node_ops* node_ops,
+                         int inplace_map_num, const uint8_t* inplace_map)
+{
+    exec_node->node_ops = node_ops;
+    exec_node->ops_priv = NULL;
+    exec_node->inplace_map_num = 0;
+    exec_node->shared_mem_size = 0;
+
+    if(node_ops->init_node && node_ops->init_node(node_ops, exec_node, exec_graph) < 0)
+        return -1;
+
+    if(exec_node->inplace_map_num != inplace_map_num ||
+       memcmp(exec_node->inplace_map, inplace_map, 2 * inplace_map_num))
+    {
+        release_node_ops(exec_graph, exec_node);
+        return -1;
+    }
+
+    if(exec_node->shared_mem_size > exec_graph->shared_mem_size)
+    {
+        void* shared_mem = sys_malloc(exec_node->shared_mem_size);
+
+        if(shared_mem == NULL)
+        {
+            release_node_ops(exec_graph, exec_node);
+            set_tengine_errno(ENOMEM);
+            return -1;
+        }
+
+        sys_free(exec_graph->shared_mem);
+
+        exec_graph->shared_mem = shared_mem;
+        exec_graph->shared_mem_size = exec_node->shared_mem_size;
+    }
+
+    return 0;
+}
+
+/* the time of TUNE_RUN_NUM runs, 0 with no perf clock, -1 when the node ops fail on the node */
+static int64_t time_node_ops(struct exec_graph* exec_graph, struct exec_node* exec_node)
+{
+    struct node_ops* node_ops = exec_node->node_ops;
+    int64_t used_time = -1;
+
+    if(node_ops->prerun && node_ops->prerun(node_ops, exec_node, exec_graph) < 0)
+        return -1;
+
+    /* the warm-up run */
+    if(node_ops->run(node_ops, exec_node, exec_graph) == 0)
+    {
+        uint32_t start = read_perf_clock();
+        int i;
+
+        for(i = 0; i < TUNE_RUN_NUM; i++)
+        {
+            if(node_ops->run(node_ops, exec_node, exec_graph) != 0)
+                break;
+        }
+
+        if(i == TUNE_RUN_NUM)
+            used_time = read_perf_clock() - start;
+    }
+
+    if(node_ops->postrun)
+        node_ops->postrun(node_ops, exec_node, exec_graph);
+
+    return used_time;
+}
+
+/*
+ * the graph inputs are usually set after prerun: the runs read zeros from a scratch buffer
+ * of size bytes instead, and the inputs get their NULL back after.
+ */
+static void* set_scratch_inputs(struct ir_node* ir_node, int* size)
+{
+    struct ir_graph* ir_graph = ir_node->graph;
+
+    *size = 0;
+
+    for(int i = 0; i < ir_node->input_num; i++)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[i]);
+
+        if(ir_tensor->data == NULL)
+            *size += ir_tensor->elem_num * ir_tensor->elem_size;
+    }
+
+    if(*size == 0)
+        return NULL;
+
+    char* scratch = ( char* )sys_malloc(*size);
+
+    if(scratch == NULL)
+        return NULL;
+
+    memset(scratch, 0, *size);
+
+    for(int i = 0, offset = 0; i < ir_node->input_num; i++)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[i]);
+
+        if(ir_tensor->data != NULL)
+            continue;
+
+        ir_tensor->data = scratch + offset;
+        offset += ir_tensor->elem_num * ir_tensor->elem_size;
+    }
+
+    return scratch;
+}
+
+static void clear_scratch_inputs(struct ir_node* ir_node, void* scratch, int size)
+{
+    struct ir_graph* ir_graph = ir_node->graph;
+
+    for(int i = 0; i < ir_node->input_num; i++)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[i]);
+        char* data = ( char* )ir_tensor->data;
+
+        if(data >= ( char* )scratch && data < ( char* )scratch + size)
+            ir_tensor->data = NULL;
+    }
+
+    sys_free(scratch);
+}
+
+static int time_candidates(struct exec_graph* exec_graph, struct exec_node* exec_node, struct node_ops** cand_list,
+                           int cand_num, struct tune_entry* entry, struct node_ops** ran_list)
+{
+    int inplace_map_num = exec_node->inplace_map_num;
+    uint8_t inplace_map[4];
+
+    memcpy(inplace_map, exec_node->inplace_map, sizeof(inplace_map));
+
+    release_node_ops(exec_graph, exec_node);
+
+    entry->cand_num = 0;
+    entry->selected = 0;
+
+    for(int i = 0; i < cand_num; i++)
+    {
+        if(bind_node_ops(exec_graph, exec_node, cand_list[i], inplace_map_num, inplace_map) < 0)
+            continue;
+
+        int64_t used_time = time_node_ops(exec_graph, exec_node);
+
+        release_node_ops(exec_graph, exec_node);
+
+        if(used_time < 0)
+            continue;
+
+        ran_list[entry->cand_num] = cand_list[i];
+        strncpy(entry->cand_name[entry->cand_num], cand_list[i]->name, TUNE_NAME_SIZE - 1);
+        entry->cand_time[entry->cand_num] = ( uint32_t )used_time;
+
+        /* the ties to the higher score */
+        if(entry->cand_num == 0 || used_time < entry->cand_time[entry->selected])
+            entry->selected = entry->cand_num;
+
+        entry->cand_num++;
+    }
+
+    /* none ran here, e.g. on an input of the caller: the node keeps the highest score */
+    struct node_ops* node_ops = entry->cand_num ? ran_list[entry->selected] : cand_list[0];
+
+    return bind_node_ops(exec_graph, exec_node, node_ops, inplace_map_num, inplace_map);
+}
+
+/* the node ops of the node and the ones it may get instead, or 0 when it has no choice */
+static int get_candidates(struct exec_graph* exec_graph, struct exec_node* exec_node, struct node_ops** cand_list)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+
+    /* a map of more than 2 outputs lives in inplace_map_ptr, which is not kept over rebinding */
+    if(exec_node->inplace_map_num > 2)
+        return 0;
+
+    /* the runs write the outputs, which must have their buffers */
+    for(int i = 0; i < ir_node->output_num; i++)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[i]);
+
+        if(ir_tensor->data == NULL)
+            return 0;
+    }
+
+    int cand_num = get_node_ops_candidates(exec_graph, ir_node, cand_list, MAX_TUNE_CAND_NUM);
+
+    /* a custom node ops has no candidates, and is kept */
+    for(int i = 0; i < cand_num; i++)
+    {
+        if(cand_list[i] == exec_node->node_ops)
+            return cand_num > 1 ? cand_num : 0;
+    }
+
+    return 0;
+}
+
+/* ops_list: the node ops of the entry, whose names outlive it */
+static void fill_tune_info(struct exec_node* exec_node, const struct tune_entry* entry, struct node_ops** ops_list,
+                           int cached, struct tune_info* info)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+
+    info->name = ir_node->name;
+    info->op_name = get_op_name(ir_node->op.op_type);
+    info->node_idx = ir_node->idx;
+    info->cand_num = entry->cand_num;
+    info->selected = entry->selected;
+    info->cached = cached;
+    info->base = get_perf_clock_base();
+
+    for(int i = 0; i < entry->cand_num; i++)
+    {
+        info->cand_name[i] = ops_list[i]->name;
+        info->cand_time[i] = entry->cand_time[i];
+    }
+}
+
+int tune_exec_node(struct exec_graph* exec_graph, struct exec_node* exec_node, uint32_t model_hash,
+                   struct tune_info* info)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct node_ops* cand_list[MAX_TUNE_CAND_NUM];
+    int cand_num = get_candidates(exec_graph, exec_node, cand_list);
+
+    if(cand_num == 0)
+        return 0;
+
+    struct tune_key key;
+
+    memset(&key, 0, sizeof(key));
+
+    key.model_hash = model_hash;
+    key.shape_hash = get_shape_hash(ir_node);
+    key.cand_hash = get_cand_hash(cand_list, cand_num);
+    key.cpu_isa = exec_graph->cpu_isa;
+    key.num_thread = exec_graph->num_thread;
+
+    struct tune_entry entry;
+    struct node_ops* ops_list[MAX_TUNE_CAND_NUM];
+
+    /* a copy: the cache may grow meanwhile */
+    lock_tune_cache();
+
+    struct tune_entry* cached = find_tune_entry(&key);
+
+    if(cached)
+        entry = *cached;
+
+    unlock_tune_cache();
+
+    if(cached)
+    {
+        for(int i = 0; i < entry.cand_num; i++)
+        {
+            ops_list[i] = find_candidate(cand_list, cand_num, entry.cand_name[i]);
+
+            /* a loaded entry naming node ops this build has not: the node is tuned again */
+            if(ops_list[i] == NULL)
+                cached = NULL;
+        }
+    }
+
+    if(cached)
+    {
+        int inplace_map_num = exec_node->inplace_map_num;
+        uint8_t inplace_map[4];
+
+        memcpy(inplace_map, exec_node->inplace_map, sizeof(inplace_map));
+
+        release_node_ops(exec_graph, exec_node);
+
+        if(bind_node_ops(exec_graph, exec_node, ops_list[entry.selected], inplace_map_num, inplace_map) < 0)
+            return -1;
+
+        fill_tune_info(exec_node, &entry, ops_list, 1, info);
+
+        return 1;
+    }
+
+    int scratch_size;
+    void* scratch = set_scratch_inputs(ir_node, &scratch_size);
+
+    if(scratch == NULL && scratch_size > 0)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    memset(&entry, 0, sizeof(entry));
+
+    entry.key = key;
+
+    int ret = time_candidates(exec_graph, exec_node, cand_list, cand_num, &entry, ops_list);
+
+    if(scratch)
+        clear_scratch_inputs(ir_node, scratch, scratch_size);
+
+    if(ret < 0)
+        return -1;
+
+    if(entry.cand_num == 0)
+        return 0;
+
+    fill_tune_info(exec_node, &entry, ops_list, 0, info);
+
+    /* with no perf clock all are at 0, and the ties keep the scored choice */
+    if(entry.cand_num > 1)
+    {
+        lock_tune_cache();
+        add_tune_entry(&entry);
+        unlock_tune_cache();
+    }
+
+    return 1;
+}
@@ -0,0 +1,240 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * convs whose kernel covers the whole input width: the Kx1 temporal convs on a width 1 feature
+ * map, and the first conv, 10x10 over the 10 mfcc coefficients. There is one output column, and
+ * each output is a fc over a window of rows: the kernel is conv1d_q7_rows(), which the aot plan
+ * runtime shares. The output rows are split over the threads.
+ * Stream convs keep their history in conv_cmsis.c.
+ */
+
+#include "sys_port.h"
+#include "module.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "cpu_node_ops.h"
+#include "cpu_pool.h"
+#include "tengine_op.h"
+#include "op/convolution_param.h"
+#include "op/mv_param.h"
+#include "conv1d_q7.h"
+
+#include "arm_math.h"
+
+/* over the generic cmsis conv, for the convs it takes */
+#define CONV1D_SCORE (OPS_SCORE_BEST + 100)
+
+struct conv1d_param
+{
+    uint16_t bias_shift;
+    uint16_t out_shift;
+
+    int buffer_size; /* expanded rows of one thread in the shared memory, 0 if not expanded */
+};
+
+/* output rows of all the lanes, split over the threads */
+struct conv1d_task
+{
+    struct conv1d_param* param;
+    struct conv_param* conv_param;
+    const q7_t* weight;
+    const q7_t* bias;
+    const q7_t* input;
+    q7_t* output;
+    char* shared_mem;
+    int batch;
+    int in_h;
+    int in_row_size; /* in_w * in_c */
+    int out_h;
+    int out_c;
+};
+
+static inline int cal_shift(int scale)
+{
+    int shift = 0;
+
+    while((1 << shift) < scale)
+        shift++;
+
+    return shift;
+}
+
+static int conv1d_part(void* arg, int part, int part_num)
+{
+    struct conv1d_task* task = ( struct conv1d_task* )arg;
+    struct conv_param* conv_param = task->conv_param;
+    struct conv1d_param* param = task->param;
+    int row_start = task->out_h * part / part_num;
+    int row_end = task->out_h * (part + 1) / part_num;
+    void* buffer = param->buffer_size ? task->shared_mem + part * param->buffer_size : NULL;
+
+    for(int b = 0; b < task->batch; b++)
+        conv1d_q7_rows(task->input + b * task->in_h * task->in_row_size, task->in_h, task->in_row_size, task->weight,
+                       task->bias, task->out_c, conv_param->kernel_h, conv_param->stride_h, conv_param->pad_h0,
+                       param->bias_shift, param->out_shift, conv_param->activation == 0, row_start, row_end,
+                       buffer, task->output + b * task->out_h * task->out_c);
+
+    return 0;
+}
+
+static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
+    int bias_shift = 0;
+
+    if(conv_param->activation > 0)
+    {
+        TLOG_ERR("cmsis conv1d: relu6 is not supported\n");
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    if(ir_node->input_num > 2)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+        bias_shift = cal_shift(ir_tensor->scale);
+    }
+
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+    struct conv1d_param* param = ( struct conv1d_param* )sys_malloc(sizeof(struct conv1d_param));
+
+    if(param == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    param->bias_shift = bias_shift;
+    param->out_shift = cal_shift(output_tensor->scale);
+
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    int row_size = input_tensor->dims[2] * input_tensor->dims[3];
+    int in_h = input_tensor->dims[1];
+
+    /* a streaming move node feeds more rows after prerun, up to its whole buffer (see mv_op.c) */
+    if(input_tensor->producer >= 0)
+    {
+        struct ir_node* producer = get_ir_graph_node(ir_graph, input_tensor->producer);
+
+        if(producer->op.op_type == OP_MOVE)
+        {
+            struct mv_param* mv_param = ( struct mv_param* )producer->op.param_mem;
+
+            if(mv_param->buffer_size / row_size > in_h)
+                in_h = mv_param->buffer_size / row_size;
+        }
+    }
+
+    param->buffer_size = conv1d_q7_buffer_size(in_h, row_size, conv_param->stride_h, conv_param->pad_h0);
+    exec_node->shared_mem_size = param->buffer_size * exec_graph->num_thread;
+
+    exec_node->ops_priv = param;
+
+    return 0;
+}
+
+static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    sys_free(exec_node->ops_priv);
+    exec_node->ops_priv = NULL;
+
+    return 0;
+}
+
+static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
+    struct ir_tensor* bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    struct conv1d_task task;
+
+    task.param = ( struct conv1d_param* )exec_node->ops_priv;
+    task.conv_param = ( struct conv_param* )ir_node->op.param_mem;
+    task.weight = weight_tensor->data;
+    task.bias = bias_tensor->data;
+    task.input = input_tensor->data;
+    task.output = output_tensor->data;
+    task.shared_mem = exec_graph->shared_mem;
+    task.batch = input_tensor->dims[0];
+    task.in_h = input_tensor->dims[1];
+    task.in_row_size = input_tensor->dims[2] * input_tensor->dims[3];
+    task.out_h = output_tensor->dims[1];
+    task.out_c = weight_tensor->dims[3];
+
+    int row_macs = task.batch * task.out_c * task.conv_param->kernel_h * task.in_row_size;
+    int part_num = get_cpu_pool_part_num(exec_graph->num_thread, task.out_h, row_macs);
+
+    return run_cpu_pool(exec_graph->cpu_pool, conv1d_part, &task, part_num);
+}
+
+static int reshape(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    /* do not support reshape */
+    return -1;
+}
+
+static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
+{
+    struct conv_param* conv_param = ( struct conv_param* )exec_node->op.param_mem;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(exec_node->graph, exec_node->input_tensors[0]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(exec_node->graph, exec_node->output_tensors[0]);
+
+    /* the kernel covers the input width, Kx1 on width 1 included */
+    if(conv_param->stream || exec_node->input_num < 3 || conv_param->kernel_w != input_tensor->dims[2] ||
+       output_tensor->dims[2] != 1 || conv_param->pad_w0 != 0 || conv_param->pad_w1 != 0 || conv_param->group > 1 ||
+       conv_param->dilation_h > 1 || conv_param->dilation_w > 1)
+        return 0;
+
+    return CONV1D_SCORE;
+}
+
+static struct node_ops conv1d_node_ops = {.prerun = NULL,
+                                          .run = run,
+                                          .reshape = reshape,
+                                          .postrun = NULL,
+                                          .init_node = init_node,
+                                          .release_node = release_node,
+                                          .score = score,
+                                          .name = "cmsis_conv1d"};
+
+static int reg_conv1d_cmsis_ops(void* arg)
+{
+    return register_builtin_node_ops(OP_CONV, &conv1d_node_ops);
+}
+
+static int unreg_conv1d_cmsis_ops(void* arg)
+{
+    unregister_builtin_node_ops(OP_CONV, &conv1d_node_ops);
+    return 0;
+}
+
+AUTO_REGISTER_OPS(reg_conv1d_cmsis_ops);
+AUTO_UNREGISTER_OPS(unreg_conv1d_cmsis_ops);
@@ -22,12 +22,15 @@
  * Author: haitao@openailab.com
  */
 
+#include <string.h>
+
 #include "sys_port.h"
 #include "module.h"
 #include "tengine_errno.h"
 #include "tengine_log.h"
 #include "tengine_ir.h"
 #include "cpu_node_ops.h"
+#include "cpu_pool.h"
 #include "tengine_op.h"
 #include "op/convolution_param.h"
 
@@ -37,6 +40,38 @@ struct cmsis_param
 {
     uint16_t bias_shift;
     uint16_t out_shift;
+
+    /* stream mode, the history and the window are kept for each batch lane */
+    int8_t* history; /* input rows not consumed yet */
+    int history_rows;
+    int history_size; /* in rows */
+    int8_t* window; /* output rows kept for a fc, when stream_window is set */
+    int window_rows;
+    int batch;
+
+    int buffer_size; /* im2col buffer of one thread in the shared memory */
+};
+
+/* output rows of all the lanes, split over the threads */
+struct conv_task
+{
+    struct cmsis_param* cmsis_param;
+    struct conv_param* conv_param;
+    const q7_t* weight;
+    const q7_t* bias;
+    const q7_t* input;
+    q7_t* output;
+    char* shared_mem;
+    int batch;
+    int in_h;
+    int in_w;
+    int in_c;
+    int in_lane_size;
+    int pad_h; /* top padding, the rows past in_h are padding too */
+    int out_h;
+    int out_w;
+    int out_c;
+    int out_lane_size;
 };
 
 arm_status arm_convolve_HWC_q7_nonsquare(const q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
@@ -47,6 +82,8 @@ arm_status arm_convolve_HWC_q7_nonsquare(const q7_t* Im_in, const uint16_t dim_i
                                          const uint16_t out_shift, q7_t* Im_out, const uint16_t dim_im_out_x,
                                          const uint16_t dim_im_out_y, q15_t* bufferA, q7_t* bufferB);
 
+void arm_relu_q7(q7_t* data, uint16_t size);
+
 static inline int cal_shift(int scale)
 {
     int shift = 0;
@@ -57,13 +94,75 @@ static inline int cal_shift(int scale)
     return shift;
 }
 
+static void release_stream(struct cmsis_param* param)
+{
+    if(param->history)
+        sys_free(param->history);
+
+    if(param->window)
+        sys_free(param->window);
+}
+
+static int init_stream(struct cmsis_param* param, struct conv_param* conv_param, struct ir_node* ir_node)
+{
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    /* the rows left from the last run, plus the most rows one run can feed */
+    param->batch = input_tensor->dims[0];
+    param->history_size = conv_param->kernel_h - 1 + input_tensor->dims[1];
+    param->history =
+        ( int8_t* )sys_malloc(param->batch * param->history_size * input_tensor->dims[2] * input_tensor->dims[3]);
+
+    if(param->history == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    if(conv_param->stream_window == 0)
+        return 0;
+
+    int max_new_rows = (input_tensor->dims[1] + conv_param->stride_h - 1) / conv_param->stride_h;
+
+    if(max_new_rows > conv_param->stream_window)
+    {
+        TLOG_ERR("stream conv: %d new rows do not fit the window of %d rows\n", max_new_rows,
+                 conv_param->stream_window);
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    param->window = ( int8_t* )sys_malloc(output_tensor->elem_num);
+
+    if(param->window == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    memset(param->window, 0, output_tensor->elem_num);
+
+    return 0;
+}
+
 static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct ir_node* ir_node = exec_node->ir_node;
     struct ir_graph* ir_graph = ir_node->graph;
+    struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
     int bias_shift = 0;
     int out_shift = 0;
 
+    /* the q7 tensors only carry the requant shift, not where 6.0 is */
+    if(conv_param->activation > 0)
+    {
+        TLOG_ERR("cmsis conv: relu6 is not supported\n");
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
     if(ir_node->input_num > 2)
     {
         struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
@@ -79,23 +178,190 @@ static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, str
 
     param->bias_shift = bias_shift;
     param->out_shift = out_shift;
+    param->history = NULL;
+    param->history_rows = 0;
+    param->window = NULL;
+    param->window_rows = 0;
+    param->batch = 1;
 
     exec_node->ops_priv = param;
 
-    /*2*ch_im_in*dim_kernel*dim_kernel */
-    struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
-    exec_node->shared_mem_size =
-        sizeof(q15_t) * 2 * conv_param->input_channel * conv_param->kernel_h * conv_param->kernel_w;
+    if(conv_param->stream && init_stream(param, conv_param, ir_node) < 0)
+    {
+        release_stream(param);
+        sys_free(param);
+        exec_node->ops_priv = NULL;
+        return -1;
+    }
+
+    /*2*ch_im_in*dim_kernel*dim_kernel, for each thread */
+    param->buffer_size = sizeof(q15_t) * 2 * conv_param->input_channel * conv_param->kernel_h * conv_param->kernel_w;
+    exec_node->shared_mem_size = param->buffer_size * exec_graph->num_thread;
 
     return 0;
 }
 
 static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
+    release_stream(( struct cmsis_param* )exec_node->ops_priv);
     sys_free(exec_node->ops_priv);
     return 0;
 }
 
+static int conv_part(void* arg, int part, int part_num)
+{
+    struct conv_task* task = ( struct conv_task* )arg;
+    struct conv_param* conv_param = task->conv_param;
+    int row_start = task->out_h * part / part_num;
+    int row_end = task->out_h * (part + 1) / part_num;
+
+    if(row_start == row_end)
+        return 0;
+
+    /* the input rows the part reads; the ones before row 0 come as its own top padding */
+    int top = row_start * conv_param->stride_h - task->pad_h;
+    int bottom = (row_end - 1) * conv_param->stride_h - task->pad_h + conv_param->kernel_h;
+    int in_start = top < 0 ? 0 : top;
+    int in_end = bottom < task->in_h ? bottom : task->in_h;
+    q15_t* buffer = ( q15_t* )(task->shared_mem + part * task->cmsis_param->buffer_size);
+
+    int out_row_size = task->out_w * task->out_c;
+
+    for(int b = 0; b < task->batch; b++)
+    {
+        q7_t* output = task->output + b * task->out_lane_size + row_start * out_row_size;
+
+        int ret = arm_convolve_HWC_q7_nonsquare(
+            task->input + b * task->in_lane_size + in_start * task->in_w * task->in_c, task->in_w, in_end - in_start,
+            task->in_c, task->weight, task->out_c, conv_param->kernel_w, conv_param->kernel_h, conv_param->pad_w0,
+            top < 0 ? -top : 0, conv_param->stride_w, conv_param->stride_h, task->bias, task->cmsis_param->bias_shift,
+            task->cmsis_param->out_shift, output, task->out_w, row_end - row_start, buffer, NULL);
+
+        if(ret != ARM_MATH_SUCCESS)
+        {
+            TLOG_ERR("arm convolve failed\n");
+            return -1;
+        }
+
+        /* folded relu, while the rows are still in the cache */
+        if(conv_param->activation == 0)
+            arm_relu_q7(output, (row_end - row_start) * out_row_size);
+    }
+
+    return 0;
+}
+
+static int run_conv_task(struct conv_task* task, struct exec_graph* exec_graph)
+{
+    struct conv_param* conv_param = task->conv_param;
+    int row_macs = task->batch * task->out_w * task->out_c * conv_param->kernel_h * conv_param->kernel_w * task->in_c;
+    int part_num = get_cpu_pool_part_num(exec_graph->num_thread, task->out_h, row_macs);
+
+    return run_cpu_pool(exec_graph->cpu_pool, conv_part, task, part_num);
+}
+
+/*
+ * append the new input rows to the history, and compute the output rows the history can make.
+ * Returns 1 if there are no new output rows (or the window is not full yet), which stops the graph.
+ */
+static int run_stream(struct conv_task* task, struct ir_tensor* input_tensor, struct ir_tensor* output_tensor,
+                      struct exec_graph* exec_graph)
+{
+    struct cmsis_param* cmsis_param = task->cmsis_param;
+    struct conv_param* conv_param = task->conv_param;
+    int batch = input_tensor->dims[0];
+    int in_w = input_tensor->dims[2];
+    int in_c = input_tensor->dims[3];
+    int in_row_size = in_w * in_c;
+    int new_rows = input_tensor->dims[1];
+    int lane_history_size = cmsis_param->history_size * in_row_size;
+
+    if(batch != cmsis_param->batch)
+    {
+        TLOG_ERR("stream conv: batch changed from %d to %d after prerun\n", cmsis_param->batch, batch);
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    if(cmsis_param->history_rows + new_rows > cmsis_param->history_size)
+    {
+        TLOG_ERR("stream conv: %d new rows overflow the history\n", new_rows);
+        set_tengine_errno(EFAULT);
+        return -1;
+    }
+
+    for(int b = 0; b < batch; b++)
+        memcpy(cmsis_param->history + b * lane_history_size + cmsis_param->history_rows * in_row_size,
+               ( int8_t* )input_tensor->data + b * new_rows * in_row_size, new_rows * in_row_size);
+
+    cmsis_param->history_rows += new_rows;
+
+    if(cmsis_param->history_rows < conv_param->kernel_h)
+        return 1;
+
+    int out_rows = (cmsis_param->history_rows - conv_param->kernel_h) / conv_param->stride_h + 1;
+    int out_w = output_tensor->dims[2];
+    int out_row_size = out_w * output_tensor->dims[3];
+    int window_size = conv_param->stream_window * out_row_size;
+
+    /* the rows no later output row needs */
+    int used_rows = out_rows * conv_param->stride_h;
+
+    if(cmsis_param->window == NULL)
+    {
+        int dims[4] = {batch, out_rows, out_w, output_tensor->dims[3]};
+
+        set_ir_tensor_shape(output_tensor, dims, 4);
+    }
+
+    task->input = cmsis_param->history;
+    task->in_h = cmsis_param->history_rows;
+    task->in_lane_size = lane_history_size;
+    task->pad_h = 0;
+    task->out_h = out_rows;
+
+    if(cmsis_param->window)
+    {
+        /* slide the windows and compute the new rows at their bottom */
+        for(int b = 0; b < batch; b++)
+        {
+            int8_t* window = cmsis_param->window + b * window_size;
+
+            memmove(window, window + out_rows * out_row_size, window_size - out_rows * out_row_size);
+        }
+
+        task->output = cmsis_param->window + window_size - out_rows * out_row_size;
+        task->out_lane_size = window_size;
+    }
+    else
+    {
+        task->output = output_tensor->data;
+        task->out_lane_size = out_rows * out_row_size;
+    }
+
+    if(run_conv_task(task, exec_graph) < 0)
+        return -1;
+
+    for(int b = 0; b < batch; b++)
+    {
+        int8_t* history = cmsis_param->history + b * lane_history_size;
+
+        memmove(history, history + used_rows * in_row_size, (cmsis_param->history_rows - used_rows) * in_row_size);
+    }
+
+    cmsis_param->history_rows -= used_rows;
+
+    if(cmsis_param->window == NULL)
+        return 0;
+
+    memcpy(output_tensor->data, cmsis_param->window, output_tensor->elem_num);
+
+    if(cmsis_param->window_rows < conv_param->stream_window)
+        cmsis_param->window_rows += out_rows;
+
+    return cmsis_param->window_rows < conv_param->stream_window ? 1 : 0;
+}
+
 static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct ir_node* ir_node = exec_node->ir_node;
@@ -107,16 +373,46 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
     struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
     struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
 
-    int ret = arm_convolve_HWC_q7_nonsquare(
-        input_tensor->data, input_tensor->dims[2], input_tensor->dims[1], input_tensor->dims[3], weight_tensor->data,
-        weight_tensor->dims[3], conv_param->kernel_w, conv_param->kernel_h, conv_param->pad_w0, conv_param->pad_h0,
-        conv_param->stride_w, conv_param->stride_h, bias_tensor->data, cmsis_param->bias_shift, cmsis_param->out_shift,
-        output_tensor->data, output_tensor->dims[2], output_tensor->dims[1], exec_graph->shared_mem, NULL);
+    struct conv_task task;
+
+    task.cmsis_param = cmsis_param;
+    task.conv_param = conv_param;
+    task.weight = weight_tensor->data;
+    task.bias = bias_tensor->data;
+    task.shared_mem = exec_graph->shared_mem;
+    task.batch = input_tensor->dims[0];
+    task.in_w = input_tensor->dims[2];
+    task.in_c = input_tensor->dims[3];
+    task.out_w = output_tensor->dims[2];
+    task.out_c = weight_tensor->dims[3];
+
+    if(conv_param->stream)
+        return run_stream(&task, input_tensor, output_tensor, exec_graph);
+
+    task.input = input_tensor->data;
+    task.in_h = input_tensor->dims[1];
+    task.in_lane_size = input_tensor->dims[1] * input_tensor->dims[2] * input_tensor->dims[3];
+    task.pad_h = conv_param->pad_h0;
+    task.output = output_tensor->data;
+    task.out_h = output_tensor->dims[1];
+    task.out_lane_size = output_tensor->dims[1] * output_tensor->dims[2] * output_tensor->dims[3];
 
-    if(ret != ARM_MATH_SUCCESS)
+    return run_conv_task(&task, exec_graph);
+}
+
+static int reset(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct cmsis_param* param = ( struct cmsis_param* )exec_node->ops_priv;
+
+    param->history_rows = 0;
+    param->window_rows = 0;
+
+    if(param->window)
     {
-        TLOG_ERR("arm convolve failed\n");
-        return -1;
+        struct ir_node* ir_node = exec_node->ir_node;
+        struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_node->graph, ir_node->output_tensors[0]);
+
+        memset(param->window, 0, output_tensor->elem_num);
     }
 
     return 0;
@@ -139,7 +435,9 @@ static struct node_ops cmsis_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = init_node,
                                          .release_node = release_node,
-                                         .score = score};
+                                         .reset = reset,
+                                         .score = score,
+                                         .name = "cmsis"};
 
 static int reg_conv_cmsis_ops(void* arg)
 {
@@ -219,6 +219,12 @@ static int release_node(struct node_ops* node_ops, struct exec_node* exec_node,
 
 static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
 {
+    struct conv_param* conv_param = ( struct conv_param* )exec_node->op.param_mem;
+
+    /* stream mode is done by the cmsis kernel only, never pick this one */
+    if(conv_param->stream)
+        return 0;
+
     return OPS_SCORE_BEST;
 }
 
@@ -228,7 +234,8 @@ static struct node_ops hcl_node_ops = {.prerun = prerun,
                                        .postrun = postrun,
                                        .init_node = init_node,
                                        .release_node = release_node,
-                                       .score = score};
+                                       .score = score,
+                                       .name = "hcl"};
 
 static int reg_conv_hcl_ops(void* arg)
 {
@@ -0,0 +1,274 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * q7 HWC conv for x86, with the outputs of arm_convolve_HWC_q7_nonsquare(). No im2col: at an
+ * output pixel, the input under each kernel row is one run of kernel_w * in_c, or less at the
+ * padding, and so is the filter row of an output channel, so the pixel is a few x86_q7_dot()
+ * over the output channels. When the kernel covers whole input rows, its rows are one run.
+ * Stream convs keep their history in conv_cmsis.c.
+ */
+
+#include "sys_port.h"
+#include "module.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "cpu_node_ops.h"
+#include "cpu_pool.h"
+#include "tengine_op.h"
+#include "op/convolution_param.h"
+#include "x86_q7.h"
+
+/* the output channels of one pass over the input of a pixel */
+#define X86_CONV_CHANNELS 32
+
+struct x86_conv_param
+{
+    int bias_shift;
+    int out_shift;
+    int isa;
+};
+
+/* output rows of all the lanes, split over the threads */
+struct x86_conv_task
+{
+    struct x86_conv_param* param;
+    struct conv_param* conv_param;
+    const int8_t* weight;
+    const int8_t* bias;
+    const int8_t* input;
+    int8_t* output;
+    int batch;
+    int in_h;
+    int in_w;
+    int in_c;
+    int out_h;
+    int out_w;
+    int out_c;
+};
+
+static inline int cal_shift(int scale)
+{
+    int shift = 0;
+
+    while((1 << shift) < scale)
+        shift++;
+
+    return shift;
+}
+
+static void conv_pixel(struct x86_conv_task* task, const int8_t* input, int out_y, int out_x, int8_t* output)
+{
+    struct conv_param* conv_param = task->conv_param;
+    struct x86_conv_param* param = task->param;
+    int kernel_h = conv_param->kernel_h;
+    int kernel_w = conv_param->kernel_w;
+    int in_c = task->in_c;
+    int weight_stride = kernel_h * kernel_w * in_c;
+    int top = out_y * conv_param->stride_h - conv_param->pad_h0;
+    int left = out_x * conv_param->stride_w - conv_param->pad_w0;
+
+    /* the kernel rows and columns over the input, the padding adds nothing */
+    int ky_start = top < 0 ? -top : 0;
+    int ky_end = top + kernel_h > task->in_h ? task->in_h - top : kernel_h;
+    int kx_start = left < 0 ? -left : 0;
+    int kx_end = left + kernel_w > task->in_w ? task->in_w - left : kernel_w;
+    int run = (kx_end - kx_start) * in_c;
+    int whole_rows = kx_end - kx_start == task->in_w && kernel_w == task->in_w;
+
+    int32_t sums[X86_CONV_CHANNELS];
+    int32_t round = (1 << param->out_shift) >> 1;
+
+    for(int c = 0; c < task->out_c; c += X86_CONV_CHANNELS)
+    {
+        int num = task->out_c - c < X86_CONV_CHANNELS ? task->out_c - c : X86_CONV_CHANNELS;
+        const int8_t* weight = task->weight + c * weight_stride;
+
+        for(int i = 0; i < num; i++)
+            sums[i] = (( int32_t )task->bias[c + i] << param->bias_shift) + round;
+
+        if(whole_rows && ky_end > ky_start)
+        {
+            x86_q7_dot(param->isa, input + (top + ky_start) * run, 0, 1, weight + ky_start * run,
+                       (ky_end - ky_start) * run, weight_stride, num, sums);
+        }
+        else
+        {
+            for(int ky = ky_start; ky < ky_end; ky++)
+                x86_q7_dot(param->isa, input + ((top + ky) * task->in_w + left + kx_start) * in_c, 0, 1,
+                           weight + (ky * kernel_w + kx_start) * in_c, run, weight_stride, num, sums);
+        }
+
+        x86_q7_requant(param->isa, sums, num, param->out_shift, conv_param->activation == 0, output + c);
+    }
+}
+
+static int conv_part(void* arg, int part, int part_num)
+{
+    struct x86_conv_task* task = ( struct x86_conv_task* )arg;
+    int row_start = task->out_h * part / part_num;
+    int row_end = task->out_h * (part + 1) / part_num;
+    int in_lane_size = task->in_h * task->in_w * task->in_c;
+    int out_row_size = task->out_w * task->out_c;
+
+    for(int b = 0; b < task->batch; b++)
+    {
+        const int8_t* input = task->input + b * in_lane_size;
+        int8_t* output = task->output + b * task->out_h * out_row_size;
+
+        for(int y = row_start; y < row_end; y++)
+        {
+            for(int x = 0; x < task->out_w; x++)
+                conv_pixel(task, input, y, x, output + y * out_row_size + x * task->out_c);
+        }
+    }
+
+    return 0;
+}
+
+static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct conv_param* conv_param = ( struct conv_param* )ir_node->op.param_mem;
+
+    if(conv_param->activation > 0)
+    {
+        TLOG_ERR("x86 conv: relu6 is not supported\n");
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    struct ir_tensor* bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+    struct x86_conv_param* param = ( struct x86_conv_param* )sys_malloc(sizeof(struct x86_conv_param));
+
+    if(param == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    param->bias_shift = cal_shift(bias_tensor->scale);
+    param->out_shift = cal_shift(output_tensor->scale);
+    param->isa = node_ops->isa;
+
+    exec_node->ops_priv = param;
+
+    return 0;
+}
+
+static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    sys_free(exec_node->ops_priv);
+    exec_node->ops_priv = NULL;
+
+    return 0;
+}
+
+static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
+    struct ir_tensor* bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    struct x86_conv_task task;
+
+    task.param = ( struct x86_conv_param* )exec_node->ops_priv;
+    task.conv_param = ( struct conv_param* )ir_node->op.param_mem;
+    task.weight = weight_tensor->data;
+    task.bias = bias_tensor->data;
+    task.input = input_tensor->data;
+    task.output = output_tensor->data;
+    task.batch = input_tensor->dims[0];
+    task.in_h = input_tensor->dims[1];
+    task.in_w = input_tensor->dims[2];
+    task.in_c = input_tensor->dims[3];
+    task.out_h = output_tensor->dims[1];
+    task.out_w = output_tensor->dims[2];
+    task.out_c = weight_tensor->dims[3];
+
+    int row_macs =
+        task.batch * task.out_w * task.out_c * task.conv_param->kernel_h * task.conv_param->kernel_w * task.in_c;
+    int part_num = get_cpu_pool_part_num(exec_graph->num_thread, task.out_h, row_macs);
+
+    return run_cpu_pool(exec_graph->cpu_pool, conv_part, &task, part_num);
+}
+
+static int reshape(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    /* do not support reshape */
+    return -1;
+}
+
+static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
+{
+    struct conv_param* conv_param = ( struct conv_param* )exec_node->op.param_mem;
+
+    if(conv_param->stream || exec_node->input_num < 3 || conv_param->group > 1 || conv_param->dilation_h > 1 ||
+       conv_param->dilation_w > 1)
+        return 0;
+
+    return X86_Q7_SCORE(node_ops->isa);
+}
+
+static struct node_ops x86_sse41_node_ops = {.prerun = NULL,
+                                             .run = run,
+                                             .reshape = reshape,
+                                             .postrun = NULL,
+                                             .init_node = init_node,
+                                             .release_node = release_node,
+                                             .score = score,
+                                             .isa = CPU_ISA_SSE41,
+                                             .name = "x86_sse4.1"};
+
+static struct node_ops x86_avx2_node_ops = {.prerun = NULL,
+                                            .run = run,
+                                            .reshape = reshape,
+                                            .postrun = NULL,
+                                            .init_node = init_node,
+                                            .release_node = release_node,
+                                            .score = score,
+                                            .isa = CPU_ISA_SSE41 | CPU_ISA_AVX2,
+                                            .name = "x86_avx2"};
+
+static int reg_conv_x86_ops(void* arg)
+{
+    register_builtin_node_ops(OP_CONV, &x86_sse41_node_ops);
+
+    return register_builtin_node_ops(OP_CONV, &x86_avx2_node_ops);
+}
+
+static int unreg_conv_x86_ops(void* arg)
+{
+    unregister_builtin_node_ops(OP_CONV, &x86_sse41_node_ops);
+
+    return unregister_builtin_node_ops(OP_CONV, &x86_avx2_node_ops);
+}
+
+AUTO_REGISTER_OPS(reg_conv_x86_ops);
+AUTO_UNREGISTER_OPS(unreg_conv_x86_ops);
@@ -30,13 +30,16 @@
 #include "tengine_log.h"
 #include "tengine_ir.h"
 #include "cpu_node_ops.h"
+#include "cpu_pool.h"
 #include "tengine_op.h"
 #include "op/pooling_param.h"
+#include "op/fc_param.h"
 
 struct cmsis_param
 {
     uint16_t bias_shift;
     uint16_t out_shift;
+    int buffer_size; /* of one thread in the shared memory */
 };
 
 void arm_maxpool_q7_HWC_nonsquare(q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
@@ -54,6 +57,110 @@ static inline int cal_shift(int scale)
     return shift;
 }
 
+#ifndef ARM_MATH_DSP
+/* the lanes sharing one pass over the weight */
+#define FC_BATCH_LANES 4
+
+/*
+ * fc of a batch: each weight row is loaded once for up to FC_BATCH_LANES input vectors,
+ * which turns the matrix-vector products into a matrix-matrix one.
+ * Computes the rows [row_start, row_end) of every lane, with the rounding and the saturation
+ * of arm_fully_connected_q7(), and the folded relu when relu is set.
+ * Only without the DSP extension: with it, arm_fully_connected_q7() on each lane goes through
+ * __SMLAD two macs at a time, which the scalar loop here does not beat.
+ */
+static void fully_connected_q7_batch(const q7_t* pV, const q7_t* pM, const uint16_t dim_vec, const uint16_t num_of_rows,
+                                     const uint16_t bias_shift, const uint16_t out_shift, const q7_t* bias, q7_t* pOut,
+                                     int batch, int row_start, int row_end, int relu)
+{
+    for(int b = 0; b < batch; b += FC_BATCH_LANES)
+    {
+        int lanes = batch - b < FC_BATCH_LANES ? batch - b : FC_BATCH_LANES;
+        const q7_t* vec = pV + b * dim_vec;
+
+        for(int i = row_start; i < row_end; i++)
+        {
+            const q7_t* row = pM + i * dim_vec;
+            q31_t init = (bias ? (( q31_t )bias[i] << bias_shift) : 0) + NN_ROUND(out_shift);
+            q31_t sum[FC_BATCH_LANES] = {init, init, init, init};
+
+            for(int j = 0; j < dim_vec; j++)
+            {
+                q31_t w = row[j];
+
+                for(int l = 0; l < lanes; l++)
+                    sum[l] += vec[l * dim_vec + j] * w;
+            }
+
+            for(int l = 0; l < lanes; l++)
+            {
+                q31_t out = __SSAT((sum[l] >> out_shift), 8);
+
+                if(relu && out < 0)
+                    out = 0;
+
+                pOut[(b + l) * num_of_rows + i] = ( q7_t )out;
+            }
+        }
+    }
+}
+#endif
+
+/* output rows split over the threads */
+struct fc_task
+{
+    struct cmsis_param* cmsis_param;
+    const q7_t* input;
+    const q7_t* weight;
+    const q7_t* bias;
+    q7_t* output;
+    char* shared_mem;
+    int dim_vec;
+    int num_of_rows;
+    int batch;
+    int relu;
+};
+
+static int fc_part(void* arg, int part, int part_num)
+{
+    struct fc_task* task = ( struct fc_task* )arg;
+    struct cmsis_param* cmsis_param = task->cmsis_param;
+    int row_start = task->num_of_rows * part / part_num;
+    int row_end = task->num_of_rows * (part + 1) / part_num;
+
+    if(row_start == row_end)
+        return 0;
+
+#ifndef ARM_MATH_DSP
+    if(task->batch > 1)
+    {
+        fully_connected_q7_batch(task->input, task->weight, task->dim_vec, task->num_of_rows, cmsis_param->bias_shift,
+                                 cmsis_param->out_shift, task->bias, task->output, task->batch, row_start, row_end,
+                                 task->relu);
+        return 0;
+    }
+#endif
+
+    q15_t* vec_buffer = ( q15_t* )(task->shared_mem + part * cmsis_param->buffer_size);
+
+    for(int b = 0; b < task->batch; b++)
+    {
+        q7_t* output = task->output + b * task->num_of_rows + row_start;
+        int ret = arm_fully_connected_q7(task->input + b * task->dim_vec, task->weight + row_start * task->dim_vec,
+                                         task->dim_vec, row_end - row_start, cmsis_param->bias_shift,
+                                         cmsis_param->out_shift, task->bias ? task->bias + row_start : NULL, output,
+                                         vec_buffer);
+
+        if(ret != ARM_MATH_SUCCESS)
+            return -1;
+
+        if(task->relu)
+            arm_relu_q7(output, row_end - row_start);
+    }
+
+    return 0;
+}
+
 static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct ir_node* ir_node = exec_node->ir_node;
@@ -79,8 +186,10 @@ static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, str
 
     exec_node->ops_priv = param;
 
-    struct ir_tensor* weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
-    exec_node->shared_mem_size = weight_tensor->dims[1] * 2;
+    /* the vec_buffer of arm_fully_connected_q7(): the input vector widened to q15 */
+    struct ir_tensor* weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
+    param->buffer_size = weight_tensor->dims[1] * sizeof(q15_t);
+    exec_node->shared_mem_size = param->buffer_size * exec_graph->num_thread;
 
     return 0;
 }
@@ -100,6 +209,7 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
     struct ir_tensor* bias_tensor = NULL;
     struct ir_tensor* output_tensor;
     struct cmsis_param* cmsis_param = ( struct cmsis_param* )exec_node->ops_priv;
+    struct fc_param* fc_param = ( struct fc_param* )ir_node->op.param_mem;
 
     input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
     weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
@@ -108,15 +218,22 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
     if(ir_node->input_num > 2)
         bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
 
-    int ret =
-        arm_fully_connected_q7(input_tensor->data, weight_tensor->data, weight_tensor->dims[1], weight_tensor->dims[0],
-                               cmsis_param->bias_shift, cmsis_param->out_shift, bias_tensor ? bias_tensor->data : NULL,
-                               output_tensor->data, exec_graph->shared_mem);
+    struct fc_task task;
 
-    if(ret != ARM_MATH_SUCCESS)
-        return -1;
+    task.cmsis_param = cmsis_param;
+    task.input = input_tensor->data;
+    task.weight = weight_tensor->data;
+    task.bias = bias_tensor ? bias_tensor->data : NULL;
+    task.output = output_tensor->data;
+    task.shared_mem = exec_graph->shared_mem;
+    task.dim_vec = weight_tensor->dims[1];
+    task.num_of_rows = weight_tensor->dims[0];
+    task.batch = input_tensor->dims[0];
+    task.relu = fc_param->activation == 0;
 
-    return 0;
+    int part_num = get_cpu_pool_part_num(exec_graph->num_thread, task.num_of_rows, task.batch * task.dim_vec);
+
+    return run_cpu_pool(exec_graph->cpu_pool, fc_part, &task, part_num);
 }
 
 static int reshape(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
@@ -135,7 +252,8 @@ static struct node_ops cmsis_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = init_node,
                                          .release_node = release_node,
-                                         .score = score};
+                                         .score = score,
+                                         .name = "cmsis"};
 
 static int reg_fc_cmsis_ops(void* arg)
 {
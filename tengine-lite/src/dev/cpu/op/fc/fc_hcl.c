@@ -33,6 +33,7 @@
 #include "cpu_node_ops.h"
 #include "tengine_op.h"
 #include "op/pool_param.h"
+#include "op/fc_param.h"
 
 struct hcl_info
 {
@@ -92,6 +93,8 @@ static int prerun(struct node_ops* node_ops, struct exec_node* exec_node, struct
 static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct hcl_info* hcl_info = ( struct hcl_info* )exec_node->ops_priv;
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct fc_param* fc_param = ( struct fc_param* )ir_node->op.param_mem;
 
     if(hcl_fc_run(hcl_info->fc_op) < 0)
     {
@@ -100,6 +103,19 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
         return -1;
     }
 
+    /* folded relu */
+    if(fc_param->activation == 0)
+    {
+        struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_node->graph, ir_node->output_tensors[0]);
+        float* data = ( float* )ir_tensor->data;
+
+        for(int i = 0; i < ir_tensor->elem_num; i++)
+        {
+            if(data[i] < 0)
+                data[i] = 0;
+        }
+    }
+
     return 0;
 }
 
@@ -170,7 +186,8 @@ static struct node_ops hcl_node_ops = {.prerun = prerun,
                                        .postrun = postrun,
                                        .init_node = init_node,
                                        .release_node = release_node,
-                                       .score = score};
+                                       .score = score,
+                                       .name = "hcl"};
 
 static int reg_fc_hcl_ops(void* arg)
 {
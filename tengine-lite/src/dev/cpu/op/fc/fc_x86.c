@@ -0,0 +1,227 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * q7 fc for x86, with the outputs of arm_fully_connected_q7(): x86_q7_dot() of the input
+ * vectors over the weight rows, X86_FC_ROWS at a time, and X86_Q7_LANES vectors per load of a
+ * row, as fully_connected_q7_batch() of fc_cmsis.c does for a batch.
+ */
+
+#include <string.h>
+
+#include "sys_port.h"
+#include "module.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "cpu_node_ops.h"
+#include "cpu_pool.h"
+#include "tengine_op.h"
+#include "op/fc_param.h"
+#include "x86_q7.h"
+
+/* the weight rows of one pass over an input vector */
+#define X86_FC_ROWS 32
+
+struct x86_fc_param
+{
+    int bias_shift;
+    int out_shift;
+    int isa;
+};
+
+/* output rows split over the threads */
+struct x86_fc_task
+{
+    struct x86_fc_param* param;
+    const int8_t* input;
+    const int8_t* weight;
+    const int8_t* bias;
+    int8_t* output;
+    int dim_vec;
+    int num_of_rows;
+    int batch;
+    int relu;
+};
+
+static inline int cal_shift(int scale)
+{
+    int shift = 0;
+
+    while((1 << shift) < scale)
+        shift++;
+
+    return shift;
+}
+
+static int fc_part(void* arg, int part, int part_num)
+{
+    struct x86_fc_task* task = ( struct x86_fc_task* )arg;
+    struct x86_fc_param* param = task->param;
+    int row_start = task->num_of_rows * part / part_num;
+    int row_end = task->num_of_rows * (part + 1) / part_num;
+    int32_t round = (1 << param->out_shift) >> 1;
+    int32_t init[X86_FC_ROWS];
+    int32_t sums[X86_Q7_LANES * X86_FC_ROWS];
+
+    /* the lanes inner: a chunk of rows stays in cache over the batch */
+    for(int r = row_start; r < row_end; r += X86_FC_ROWS)
+    {
+        int num = row_end - r < X86_FC_ROWS ? row_end - r : X86_FC_ROWS;
+
+        for(int i = 0; i < num; i++)
+            init[i] = (task->bias ? (( int32_t )task->bias[r + i] << param->bias_shift) : 0) + round;
+
+        for(int b = 0; b < task->batch; b += X86_Q7_LANES)
+        {
+            int lanes = task->batch - b < X86_Q7_LANES ? task->batch - b : X86_Q7_LANES;
+
+            for(int l = 0; l < lanes; l++)
+                memcpy(sums + l * num, init, num * sizeof(int32_t));
+
+            x86_q7_dot(param->isa, task->input + b * task->dim_vec, task->dim_vec, lanes,
+                       task->weight + r * task->dim_vec, task->dim_vec, task->dim_vec, num, sums);
+
+            for(int l = 0; l < lanes; l++)
+                x86_q7_requant(param->isa, sums + l * num, num, param->out_shift, task->relu,
+                               task->output + (b + l) * task->num_of_rows + r);
+        }
+    }
+
+    return 0;
+}
+
+static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct x86_fc_param* param = ( struct x86_fc_param* )sys_malloc(sizeof(struct x86_fc_param));
+
+    if(param == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    param->bias_shift = 0;
+
+    if(ir_node->input_num > 2)
+    {
+        struct ir_tensor* bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+        param->bias_shift = cal_shift(bias_tensor->scale);
+    }
+
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    param->out_shift = cal_shift(output_tensor->scale);
+    param->isa = node_ops->isa;
+
+    exec_node->ops_priv = param;
+
+    return 0;
+}
+
+static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    sys_free(exec_node->ops_priv);
+    exec_node->ops_priv = NULL;
+
+    return 0;
+}
+
+static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* weight_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[1]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+    struct ir_tensor* bias_tensor = NULL;
+    struct fc_param* fc_param = ( struct fc_param* )ir_node->op.param_mem;
+
+    if(ir_node->input_num > 2)
+        bias_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[2]);
+
+    struct x86_fc_task task;
+
+    task.param = ( struct x86_fc_param* )exec_node->ops_priv;
+    task.input = input_tensor->data;
+    task.weight = weight_tensor->data;
+    task.bias = bias_tensor ? bias_tensor->data : NULL;
+    task.output = output_tensor->data;
+    task.dim_vec = weight_tensor->dims[1];
+    task.num_of_rows = weight_tensor->dims[0];
+    task.batch = input_tensor->dims[0];
+    task.relu = fc_param->activation == 0;
+
+    int part_num = get_cpu_pool_part_num(exec_graph->num_thread, task.num_of_rows, task.batch * task.dim_vec);
+
+    return run_cpu_pool(exec_graph->cpu_pool, fc_part, &task, part_num);
+}
+
+static int reshape(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    return -1;
+}
+
+static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
+{
+    return X86_Q7_SCORE(node_ops->isa);
+}
+
+static struct node_ops x86_sse41_node_ops = {.prerun = NULL,
+                                             .run = run,
+                                             .reshape = reshape,
+                                             .postrun = NULL,
+                                             .init_node = init_node,
+                                             .release_node = release_node,
+                                             .score = score,
+                                             .isa = CPU_ISA_SSE41,
+                                             .name = "x86_sse4.1"};
+
+static struct node_ops x86_avx2_node_ops = {.prerun = NULL,
+                                            .run = run,
+                                            .reshape = reshape,
+                                            .postrun = NULL,
+                                            .init_node = init_node,
+                                            .release_node = release_node,
+                                            .score = score,
+                                            .isa = CPU_ISA_SSE41 | CPU_ISA_AVX2,
+                                            .name = "x86_avx2"};
+
+static int reg_fc_x86_ops(void* arg)
+{
+    register_builtin_node_ops(OP_FC, &x86_sse41_node_ops);
+
+    return register_builtin_node_ops(OP_FC, &x86_avx2_node_ops);
+}
+
+static int unreg_fc_x86_ops(void* arg)
+{
+    unregister_builtin_node_ops(OP_FC, &x86_sse41_node_ops);
+
+    return unregister_builtin_node_ops(OP_FC, &x86_avx2_node_ops);
+}
+
+AUTO_REGISTER_OPS(reg_fc_x86_ops);
+AUTO_UNREGISTER_OPS(unreg_fc_x86_ops);
@@ -49,7 +49,7 @@ static int move_op(const signed char *new_buffer ,  \
     *current_buffer_size += new_buffer_size ;
         
     if(flag){
-        if( *current_buffer_size < 768 ){
+        if( *current_buffer_size < MV_FLAG_FILL_SIZE ){
             return *current_buffer_size ;
             }
         }else{
@@ -78,26 +78,73 @@ static int move_op(const signed char *new_buffer ,  \
 }	
 
 
+/*
+ * the history of a move node belongs to the exec_node, so graphs of the same model do not share it.
+ * Each batch lane has its own buffer; all lanes are fed the same rows, so they share the fill level.
+ */
+struct mv_priv
+{
+    signed char* buffer;
+    int current_buffer_size;
+    int batch;
+};
+
+static void reset_mv_priv(struct mv_priv* mv_priv, struct mv_param* mv_param)
+{
+    mv_priv->current_buffer_size = mv_param->current_buffer_size;
+
+    /* the first outputs of a flag move are copied before the buffer is filled */
+    memset(mv_priv->buffer, 0, mv_param->buffer_size * mv_priv->batch);
+}
+
 static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct ir_node* ir_node = exec_node->ir_node;
-        
     struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
-    mv_param->buffer	=  (char *)sys_malloc(mv_param->buffer_size*sizeof(char));
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_node->graph, ir_node->input_tensors[0]);
+    int batch = input_tensor->dims[0];
+
+    /* the buffers follow the state */
+    struct mv_priv* mv_priv = ( struct mv_priv* )sys_malloc(sizeof(struct mv_priv) + mv_param->buffer_size * batch);
+
+    if(mv_priv == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    mv_priv->buffer = ( signed char* )(mv_priv + 1);
+    mv_priv->batch = batch;
+
+    reset_mv_priv(mv_priv, mv_param);
+
+    exec_node->ops_priv = mv_priv;
 
     return 0;
 }
 
 static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
-    struct ir_node* ir_node = exec_node->ir_node; 
-    struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
-    sys_free(mv_param->buffer);
-        
+    sys_free(exec_node->ops_priv);
+    exec_node->ops_priv = NULL;
+
     exec_node->inplace_map_num = 0;
     return 0;
 }
 
+static int reset(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
+
+    reset_mv_priv(( struct mv_priv* )exec_node->ops_priv, mv_param);
+
+    /* reset_graph() infers the shapes again, which counts the rows of prerun once more */
+    mv_param->fed_rows = 0;
+
+    return 0;
+}
+
 static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
 {
     struct ir_node* ir_node = exec_node->ir_node;
@@ -112,11 +159,30 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
     //printf("        MV:dims[0, 1, 2, 3]=[%d  %d  %d  %d ]\n",input_tensor->dims[0] , input_tensor->dims[1], input_tensor->dims[2] ,input_tensor->dims[3] );
     
     struct mv_param* mv_param = ( struct mv_param* )ir_node->op.param_mem;
+    struct mv_priv* mv_priv = ( struct mv_priv* )exec_node->ops_priv;
+
+    if(input_tensor->dims[0] != mv_priv->batch)
+    {
+        TLOG_ERR("move: batch changed from %d to %d after prerun\n", mv_priv->batch, input_tensor->dims[0]);
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    int current_buffer_size = mv_priv->current_buffer_size;
+    int ret = 0;
+
+    for(int b = 0; b < mv_priv->batch; b++)
+    {
+        current_buffer_size = mv_priv->current_buffer_size;
+
+        ret = move_op(( signed char* )input_tensor->data + b * input_ele_num, input_ele_num , \
+                                            mv_priv->buffer + b * mv_param->buffer_size , mv_param->start_mv_addr, \
+                                            mv_param->mv_size , &current_buffer_size , mv_param->flag, \
+                                            ( signed char* )output_tensor->data + b * mv_param->buffer_out_size , \
+                                            mv_param->buffer_out_size  );
+    }
 
-    int ret = move_op(input_tensor->data, input_ele_num , \
-                                            mv_param->buffer , mv_param->start_mv_addr, \
-                                            mv_param->mv_size , &mv_param->current_buffer_size , mv_param->flag, \
-                                            output_tensor->data , mv_param->buffer_out_size  );
+    mv_priv->current_buffer_size = current_buffer_size;
 
     if ( ret > 0 )
         return 1 ;
@@ -135,7 +201,9 @@ static struct node_ops mv_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = init_node,
                                          .release_node = release_node,
-                                         .score = score};
+                                         .reset = reset,
+                                         .score = score,
+                                      .name = "cmsis"};
 
 static int reg_mv_cmsis_ops(void* arg)
 {
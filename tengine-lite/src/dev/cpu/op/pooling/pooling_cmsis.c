@@ -49,9 +49,14 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
     input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
     output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
 
-    arm_maxpool_HWC_q7_nonsquare(input_tensor->data, input_tensor->dims[2], input_tensor->dims[1],
-                                 input_tensor->dims[3], pool_param->kernel_h, pool_param->pad_h0, pool_param->stride_h,
-                                 output_tensor->dims[2], output_tensor->dims[1], NULL, output_tensor->data);
+    int in_size = input_tensor->dims[1] * input_tensor->dims[2] * input_tensor->dims[3];
+    int out_size = output_tensor->dims[1] * output_tensor->dims[2] * output_tensor->dims[3];
+
+    for(int b = 0; b < input_tensor->dims[0]; b++)
+        arm_maxpool_HWC_q7_nonsquare(( q7_t* )input_tensor->data + b * in_size, input_tensor->dims[2],
+                                     input_tensor->dims[1], input_tensor->dims[3], pool_param->kernel_h,
+                                     pool_param->pad_h0, pool_param->stride_h, output_tensor->dims[2],
+                                     output_tensor->dims[1], NULL, ( q7_t* )output_tensor->data + b * out_size);
 
     return 0;
 }
@@ -72,7 +77,8 @@ static struct node_ops cmsis_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = NULL,
                                          .release_node = NULL,
-                                         .score = score};
+                                         .score = score,
+                                         .name = "cmsis"};
 
 static int reg_pooling_cmsis_ops(void* arg)
 {
@@ -179,7 +179,8 @@ static struct node_ops hcl_node_ops = {.prerun = prerun,
                                        .postrun = postrun,
                                        .init_node = init_node,
                                        .release_node = release_node,
-                                       .score = score};
+                                       .score = score,
+                                       .name = "hcl"};
 
 static int reg_pooling_hcl_ops(void* arg)
 {
@@ -0,0 +1,141 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * q7 HWC max pooling for x86, with the outputs of the reference arm_maxpool_HWC_q7_nonsquare():
+ * the max of the window pixels over the input, x86_q7_max() over the channels.
+ */
+
+#include <string.h>
+
+#include "sys_port.h"
+#include "module.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "cpu_node_ops.h"
+#include "tengine_op.h"
+#include "op/pooling_param.h"
+#include "x86_q7.h"
+
+static void pool_pixel(struct pool_param* pool_param, const int8_t* input, int in_h, int in_w, int in_c, int out_y,
+                       int out_x, int isa, int8_t* output)
+{
+    int top = out_y * pool_param->stride_h - pool_param->pad_h0;
+    int left = out_x * pool_param->stride_w - pool_param->pad_w0;
+    int y_start = top < 0 ? 0 : top;
+    int y_end = top + pool_param->kernel_h > in_h ? in_h : top + pool_param->kernel_h;
+    int x_start = left < 0 ? 0 : left;
+    int x_end = left + pool_param->kernel_w > in_w ? in_w : left + pool_param->kernel_w;
+
+    memcpy(output, input + (y_start * in_w + x_start) * in_c, in_c);
+
+    for(int y = y_start; y < y_end; y++)
+    {
+        for(int x = y == y_start ? x_start + 1 : x_start; x < x_end; x++)
+            x86_q7_max(isa, output, input + (y * in_w + x) * in_c, in_c);
+    }
+}
+
+static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+    struct pool_param* pool_param = ( struct pool_param* )ir_node->op.param_mem;
+
+    int in_h = input_tensor->dims[1];
+    int in_w = input_tensor->dims[2];
+    int in_c = input_tensor->dims[3];
+    int out_h = output_tensor->dims[1];
+    int out_w = output_tensor->dims[2];
+
+    for(int b = 0; b < input_tensor->dims[0]; b++)
+    {
+        const int8_t* input = ( const int8_t* )input_tensor->data + b * in_h * in_w * in_c;
+        int8_t* output = ( int8_t* )output_tensor->data + b * out_h * out_w * in_c;
+
+        for(int y = 0; y < out_h; y++)
+        {
+            for(int x = 0; x < out_w; x++)
+                pool_pixel(pool_param, input, in_h, in_w, in_c, y, x, node_ops->isa, output + (y * out_w + x) * in_c);
+        }
+    }
+
+    return 0;
+}
+
+static int reshape(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    return -1;
+}
+
+static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
+{
+    struct pool_param* pool_param = ( struct pool_param* )exec_node->op.param_mem;
+
+    /* a window all over the padding has no max */
+    if(pool_param->pool_method != POOL_MAX || pool_param->global || pool_param->pad_h0 >= pool_param->kernel_h ||
+       pool_param->pad_w0 >= pool_param->kernel_w)
+        return 0;
+
+    return X86_Q7_SCORE(node_ops->isa);
+}
+
+static struct node_ops x86_sse41_node_ops = {.prerun = NULL,
+                                             .run = run,
+                                             .reshape = reshape,
+                                             .postrun = NULL,
+                                             .init_node = NULL,
+                                             .release_node = NULL,
+                                             .score = score,
+                                             .isa = CPU_ISA_SSE41,
+                                             .name = "x86_sse4.1"};
+
+static struct node_ops x86_avx2_node_ops = {.prerun = NULL,
+                                            .run = run,
+                                            .reshape = reshape,
+                                            .postrun = NULL,
+                                            .init_node = NULL,
+                                            .release_node = NULL,
+                                            .score = score,
+                                            .isa = CPU_ISA_SSE41 | CPU_ISA_AVX2,
+                                            .name = "x86_avx2"};
+
+static int reg_pooling_x86_ops(void* arg)
+{
+    register_builtin_node_ops(OP_POOL, &x86_sse41_node_ops);
+
+    return register_builtin_node_ops(OP_POOL, &x86_avx2_node_ops);
+}
+
+static int unreg_pooling_x86_ops(void* arg)
+{
+    unregister_builtin_node_ops(OP_POOL, &x86_sse41_node_ops);
+
+    return unregister_builtin_node_ops(OP_POOL, &x86_avx2_node_ops);
+}
+
+AUTO_REGISTER_OPS(reg_pooling_x86_ops);
+AUTO_UNREGISTER_OPS(unreg_pooling_x86_ops);
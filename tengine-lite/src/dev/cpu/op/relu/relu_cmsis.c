@@ -94,7 +94,8 @@ static struct node_ops cmsis_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = init_node,
                                          .release_node = release_node,
-                                         .score = score};
+                                         .score = score,
+                                         .name = "cmsis"};
 
 static int reg_relu_cmsis_ops(void* arg)
 {
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * q7 relu for x86, in place as relu_cmsis.c
+ */
+
+#include "sys_port.h"
+#include "module.h"
+#include "tengine_errno.h"
+#include "tengine_log.h"
+#include "tengine_ir.h"
+#include "cpu_node_ops.h"
+#include "tengine_op.h"
+#include "x86_q7.h"
+
+static int init_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    exec_node->inplace_map[0] = 0;
+    exec_node->inplace_map[1] = 0;
+    exec_node->inplace_map_num = 1;
+
+    return 0;
+}
+
+static int release_node(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    exec_node->inplace_map_num = 0;
+
+    return 0;
+}
+
+static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct exec_graph* exec_graph)
+{
+    struct ir_node* ir_node = exec_node->ir_node;
+    struct ir_graph* ir_graph = ir_node->graph;
+    struct ir_tensor* input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
+    struct ir_tensor* output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+
+    if(input_tensor->data != output_tensor->data)
+    {
+        TLOG_ERR("input and output are not the same mem\n");
+        set_tengine_errno(EFAULT);
+        return -1;
+    }
+
+    x86_q7_relu(node_ops->isa, input_tensor->data, input_tensor->elem_num);
+
+    return 0;
+}
+
+static int score(struct node_ops* node_ops, struct exec_graph* exec_graph, struct ir_node* exec_node)
+{
+    return X86_Q7_SCORE(node_ops->isa);
+}
+
+static struct node_ops x86_sse41_node_ops = {.prerun = NULL,
+                                             .run = run,
+                                             .reshape = NULL,
+                                             .postrun = NULL,
+                                             .init_node = init_node,
+                                             .release_node = release_node,
+                                             .score = score,
+                                             .isa = CPU_ISA_SSE41,
+                                             .name = "x86_sse4.1"};
+
+static struct node_ops x86_avx2_node_ops = {.prerun = NULL,
+                                            .run = run,
+                                            .reshape = NULL,
+                                            .postrun = NULL,
+                                            .init_node = init_node,
+                                            .release_node = release_node,
+                                            .score = score,
+                                            .isa = CPU_ISA_SSE41 | CPU_ISA_AVX2,
+                                            .name = "x86_avx2"};
+
+static int reg_relu_x86_ops(void* arg)
+{
+    register_builtin_node_ops(OP_RELU, &x86_sse41_node_ops);
+
+    return register_builtin_node_ops(OP_RELU, &x86_avx2_node_ops);
+}
+
+static int unreg_relu_x86_ops(void* arg)
+{
+    unregister_builtin_node_ops(OP_RELU, &x86_sse41_node_ops);
+
+    return unregister_builtin_node_ops(OP_RELU, &x86_avx2_node_ops);
+}
+
+AUTO_REGISTER_OPS(reg_relu_x86_ops);
+AUTO_UNREGISTER_OPS(unreg_relu_x86_ops);
@@ -77,11 +77,20 @@ static int run(struct node_ops* node_ops, struct exec_node* exec_node, struct ex
 
     input_tensor = get_ir_graph_tensor(ir_graph, ir_node->input_tensors[0]);
     output_tensor = get_ir_graph_tensor(ir_graph, ir_node->output_tensors[0]);
+    /* one softmax for each batch lane */
+    int batch = input_tensor->dims[0];
+    int len = input_tensor->elem_num / batch;
+
+    for(int b = 0; b < batch; b++)
+    {
+        q7_t* input = ( q7_t* )input_tensor->data + b * len;
+        q7_t* output = ( q7_t* )output_tensor->data + b * len;
 #if USE_FLOAT_SOFTMAX
-    arm_softmax_float(input_tensor->data, input_tensor->elem_num, 1 , output_tensor->data);
+        arm_softmax_float(input, len, 1 , output);
 #else
-    arm_softmax_q7(input_tensor->data, input_tensor->elem_num, output_tensor->data);	
+        arm_softmax_q7(input, len, output);	
 #endif	
+    }
     return 0;
 }
 
@@ -96,7 +105,8 @@ static struct node_ops cmsis_node_ops = {.prerun = NULL,
                                          .postrun = NULL,
                                          .init_node = NULL,
                                          .release_node = NULL,
-                                         .score = score};
+                                         .score = score,
+                                         .name = "cmsis"};
 
 static int reg_softmax_cmsis_ops(void* arg)
 {
@@ -0,0 +1,454 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#include "x86_q7.h"
+
+/*
+ * the SSE4.1 and AVX2 functions are built for their target alone, and only called by the ops
+ * of the variant, which get_cpu_isa() found: the file needs no -msse4.1 or -mavx2, and the
+ * binary runs on any x86.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define X86_Q7_SIMD
+#include <immintrin.h>
+
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+static void dot_c(const int8_t* vec, const int8_t* rows, int len, int row_stride, int row_num, int32_t* sums)
+{
+    for(int i = 0; i < row_num; i++)
+    {
+        const int8_t* row = rows + i * row_stride;
+        int32_t sum = 0;
+
+        for(int j = 0; j < len; j++)
+            sum += vec[j] * row[j];
+
+        sums[i] += sum;
+    }
+}
+
+static void requant_c(const int32_t* sums, int num, int out_shift, int relu, int8_t* out)
+{
+    for(int i = 0; i < num; i++)
+    {
+        int32_t val = sums[i] >> out_shift;
+
+        if(val > 127)
+            val = 127;
+        else if(val < (relu ? 0 : -128))
+            val = relu ? 0 : -128;
+
+        out[i] = ( int8_t )val;
+    }
+}
+
+#ifdef X86_Q7_SIMD
+
+/* four rows share each load of the vector, the last rows go one by one */
+TARGET_SSE41 static void dot_sse41(const int8_t* vec, const int8_t* rows, int len, int row_stride, int row_num,
+                                   int32_t* sums)
+{
+    int i = 0;
+
+    for(; i + 3 < row_num; i += 4)
+    {
+        const int8_t* r0 = rows + i * row_stride;
+        const int8_t* r1 = r0 + row_stride;
+        const int8_t* r2 = r1 + row_stride;
+        const int8_t* r3 = r2 + row_stride;
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        __m128i acc2 = _mm_setzero_si128();
+        __m128i acc3 = _mm_setzero_si128();
+        int j = 0;
+
+        for(; j + 7 < len; j += 8)
+        {
+            __m128i v = _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(vec + j)));
+
+            acc0 = _mm_add_epi32(
+                acc0, _mm_madd_epi16(v, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(r0 + j)))));
+            acc1 = _mm_add_epi32(
+                acc1, _mm_madd_epi16(v, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(r1 + j)))));
+            acc2 = _mm_add_epi32(
+                acc2, _mm_madd_epi16(v, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(r2 + j)))));
+            acc3 = _mm_add_epi32(
+                acc3, _mm_madd_epi16(v, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(r3 + j)))));
+        }
+
+        /* the four sums, one per lane */
+        __m128i sum = _mm_hadd_epi32(_mm_hadd_epi32(acc0, acc1), _mm_hadd_epi32(acc2, acc3));
+
+        sum = _mm_add_epi32(sum, _mm_loadu_si128(( const __m128i* )(sums + i)));
+        _mm_storeu_si128(( __m128i* )(sums + i), sum);
+
+        for(; j < len; j++)
+        {
+            sums[i] += vec[j] * r0[j];
+            sums[i + 1] += vec[j] * r1[j];
+            sums[i + 2] += vec[j] * r2[j];
+            sums[i + 3] += vec[j] * r3[j];
+        }
+    }
+
+    for(; i < row_num; i++)
+    {
+        const int8_t* row = rows + i * row_stride;
+        __m128i acc = _mm_setzero_si128();
+        int j = 0;
+
+        for(; j + 7 < len; j += 8)
+        {
+            __m128i v = _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(vec + j)));
+
+            acc = _mm_add_epi32(
+                acc, _mm_madd_epi16(v, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(row + j)))));
+        }
+
+        acc = _mm_hadd_epi32(acc, acc);
+        acc = _mm_hadd_epi32(acc, acc);
+
+        int32_t sum = _mm_cvtsi128_si32(acc);
+
+        for(; j < len; j++)
+            sum += vec[j] * row[j];
+
+        sums[i] += sum;
+    }
+}
+
+TARGET_AVX2 static void dot_avx2(const int8_t* vec, const int8_t* rows, int len, int row_stride, int row_num,
+                                 int32_t* sums)
+{
+    int i = 0;
+
+    for(; i + 3 < row_num; i += 4)
+    {
+        const int8_t* r0 = rows + i * row_stride;
+        const int8_t* r1 = r0 + row_stride;
+        const int8_t* r2 = r1 + row_stride;
+        const int8_t* r3 = r2 + row_stride;
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256();
+        __m256i acc3 = _mm256_setzero_si256();
+        int j = 0;
+
+        for(; j + 15 < len; j += 16)
+        {
+            __m256i v = _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(vec + j)));
+
+            acc0 = _mm256_add_epi32(
+                acc0, _mm256_madd_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(r0 + j)))));
+            acc1 = _mm256_add_epi32(
+                acc1, _mm256_madd_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(r1 + j)))));
+            acc2 = _mm256_add_epi32(
+                acc2, _mm256_madd_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(r2 + j)))));
+            acc3 = _mm256_add_epi32(
+                acc3, _mm256_madd_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(r3 + j)))));
+        }
+
+        /* the four sums of each 128 bit lane, then the two lanes added */
+        __m256i h = _mm256_hadd_epi32(_mm256_hadd_epi32(acc0, acc1), _mm256_hadd_epi32(acc2, acc3));
+        __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1));
+
+        sum = _mm_add_epi32(sum, _mm_loadu_si128(( const __m128i* )(sums + i)));
+        _mm_storeu_si128(( __m128i* )(sums + i), sum);
+
+        for(; j < len; j++)
+        {
+            sums[i] += vec[j] * r0[j];
+            sums[i + 1] += vec[j] * r1[j];
+            sums[i + 2] += vec[j] * r2[j];
+            sums[i + 3] += vec[j] * r3[j];
+        }
+    }
+
+    for(; i < row_num; i++)
+    {
+        const int8_t* row = rows + i * row_stride;
+        __m256i acc = _mm256_setzero_si256();
+        int j = 0;
+
+        for(; j + 15 < len; j += 16)
+        {
+            __m256i v = _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(vec + j)));
+
+            acc = _mm256_add_epi32(
+                acc, _mm256_madd_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(row + j)))));
+        }
+
+        __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+
+        sum = _mm_hadd_epi32(sum, sum);
+        sum = _mm_hadd_epi32(sum, sum);
+
+        int32_t s = _mm_cvtsi128_si32(sum);
+
+        for(; j < len; j++)
+            s += vec[j] * row[j];
+
+        sums[i] += s;
+    }
+}
+
+/* the saturating packs are the __SSAT(sum >> out_shift, 8) of cmsis */
+/* the four vectors share each load of a row, sums of vector l at sums + l * sums_stride */
+TARGET_SSE41 static void dot_lanes_sse41(const int8_t* vec, int vec_stride, const int8_t* rows, int len,
+                                         int row_stride, int row_num, int32_t* sums, int sums_stride)
+{
+    const int8_t* v0 = vec;
+    const int8_t* v1 = v0 + vec_stride;
+    const int8_t* v2 = v1 + vec_stride;
+    const int8_t* v3 = v2 + vec_stride;
+
+    for(int i = 0; i < row_num; i++)
+    {
+        const int8_t* row = rows + i * row_stride;
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        __m128i acc2 = _mm_setzero_si128();
+        __m128i acc3 = _mm_setzero_si128();
+        int j = 0;
+
+        for(; j + 7 < len; j += 8)
+        {
+            __m128i w = _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(row + j)));
+
+            acc0 = _mm_add_epi32(
+                acc0, _mm_madd_epi16(w, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(v0 + j)))));
+            acc1 = _mm_add_epi32(
+                acc1, _mm_madd_epi16(w, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(v1 + j)))));
+            acc2 = _mm_add_epi32(
+                acc2, _mm_madd_epi16(w, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(v2 + j)))));
+            acc3 = _mm_add_epi32(
+                acc3, _mm_madd_epi16(w, _mm_cvtepi8_epi16(_mm_loadl_epi64(( const __m128i* )(v3 + j)))));
+        }
+
+        /* the four sums of the row, one per vector */
+        int32_t sum[4];
+
+        _mm_storeu_si128(( __m128i* )sum, _mm_hadd_epi32(_mm_hadd_epi32(acc0, acc1), _mm_hadd_epi32(acc2, acc3)));
+
+        for(; j < len; j++)
+        {
+            sum[0] += v0[j] * row[j];
+            sum[1] += v1[j] * row[j];
+            sum[2] += v2[j] * row[j];
+            sum[3] += v3[j] * row[j];
+        }
+
+        for(int l = 0; l < 4; l++)
+            sums[l * sums_stride + i] += sum[l];
+    }
+}
+
+TARGET_AVX2 static void dot_lanes_avx2(const int8_t* vec, int vec_stride, const int8_t* rows, int len,
+                                       int row_stride, int row_num, int32_t* sums, int sums_stride)
+{
+    const int8_t* v0 = vec;
+    const int8_t* v1 = v0 + vec_stride;
+    const int8_t* v2 = v1 + vec_stride;
+    const int8_t* v3 = v2 + vec_stride;
+
+    for(int i = 0; i < row_num; i++)
+    {
+        const int8_t* row = rows + i * row_stride;
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256();
+        __m256i acc3 = _mm256_setzero_si256();
+        int j = 0;
+
+        for(; j + 15 < len; j += 16)
+        {
+            __m256i w = _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(row + j)));
+
+            acc0 = _mm256_add_epi32(
+                acc0, _mm256_madd_epi16(w, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(v0 + j)))));
+            acc1 = _mm256_add_epi32(
+                acc1, _mm256_madd_epi16(w, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(v1 + j)))));
+            acc2 = _mm256_add_epi32(
+                acc2, _mm256_madd_epi16(w, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(v2 + j)))));
+            acc3 = _mm256_add_epi32(
+                acc3, _mm256_madd_epi16(w, _mm256_cvtepi8_epi16(_mm_loadu_si128(( const __m128i* )(v3 + j)))));
+        }
+
+        /* the four sums of each 128 bit lane, then the two lanes added */
+        __m256i h = _mm256_hadd_epi32(_mm256_hadd_epi32(acc0, acc1), _mm256_hadd_epi32(acc2, acc3));
+        int32_t sum[4];
+
+        _mm_storeu_si128(( __m128i* )sum, _mm_add_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1)));
+
+        for(; j < len; j++)
+        {
+            sum[0] += v0[j] * row[j];
+            sum[1] += v1[j] * row[j];
+            sum[2] += v2[j] * row[j];
+            sum[3] += v3[j] * row[j];
+        }
+
+        for(int l = 0; l < 4; l++)
+            sums[l * sums_stride + i] += sum[l];
+    }
+}
+
+TARGET_SSE41 static void requant_sse41(const int32_t* sums, int num, int out_shift, int relu, int8_t* out)
+{
+    __m128i shift = _mm_cvtsi32_si128(out_shift);
+    __m128i zero = _mm_setzero_si128();
+    int i = 0;
+
+    for(; i + 15 < num; i += 16)
+    {
+        __m128i x0 = _mm_sra_epi32(_mm_loadu_si128(( const __m128i* )(sums + i)), shift);
+        __m128i x1 = _mm_sra_epi32(_mm_loadu_si128(( const __m128i* )(sums + i + 4)), shift);
+        __m128i x2 = _mm_sra_epi32(_mm_loadu_si128(( const __m128i* )(sums + i + 8)), shift);
+        __m128i x3 = _mm_sra_epi32(_mm_loadu_si128(( const __m128i* )(sums + i + 12)), shift);
+        __m128i y = _mm_packs_epi16(_mm_packs_epi32(x0, x1), _mm_packs_epi32(x2, x3));
+
+        if(relu)
+            y = _mm_max_epi8(y, zero);
+
+        _mm_storeu_si128(( __m128i* )(out + i), y);
+    }
+
+    requant_c(sums + i, num - i, out_shift, relu, out + i);
+}
+
+TARGET_SSE41 static void max_sse41(int8_t* data, const int8_t* src, int num)
+{
+    int i = 0;
+
+    for(; i + 15 < num; i += 16)
+    {
+        __m128i a = _mm_loadu_si128(( const __m128i* )(data + i));
+        __m128i b = _mm_loadu_si128(( const __m128i* )(src + i));
+
+        _mm_storeu_si128(( __m128i* )(data + i), _mm_max_epi8(a, b));
+    }
+
+    for(; i < num; i++)
+    {
+        if(src[i] > data[i])
+            data[i] = src[i];
+    }
+}
+
+TARGET_AVX2 static void max_avx2(int8_t* data, const int8_t* src, int num)
+{
+    int i = 0;
+
+    for(; i + 31 < num; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256(( const __m256i* )(data + i));
+        __m256i b = _mm256_loadu_si256(( const __m256i* )(src + i));
+
+        _mm256_storeu_si256(( __m256i* )(data + i), _mm256_max_epi8(a, b));
+    }
+
+    max_sse41(data + i, src + i, num - i);
+}
+
+#endif
+
+void x86_q7_dot(int isa, const int8_t* vec, int vec_stride, int vec_num, const int8_t* rows, int len, int row_stride,
+                int row_num, int32_t* sums)
+{
+    int l = 0;
+
+#ifdef X86_Q7_SIMD
+    /* X86_Q7_LANES vectors per pass over the rows, the last vectors one by one */
+    if(isa & CPU_ISA_AVX2)
+    {
+        for(; l + X86_Q7_LANES - 1 < vec_num; l += X86_Q7_LANES)
+            dot_lanes_avx2(vec + l * vec_stride, vec_stride, rows, len, row_stride, row_num, sums + l * row_num,
+                           row_num);
+
+        for(; l < vec_num; l++)
+            dot_avx2(vec + l * vec_stride, rows, len, row_stride, row_num, sums + l * row_num);
+
+        return;
+    }
+
+    if(isa & CPU_ISA_SSE41)
+    {
+        for(; l + X86_Q7_LANES - 1 < vec_num; l += X86_Q7_LANES)
+            dot_lanes_sse41(vec + l * vec_stride, vec_stride, rows, len, row_stride, row_num, sums + l * row_num,
+                            row_num);
+
+        for(; l < vec_num; l++)
+            dot_sse41(vec + l * vec_stride, rows, len, row_stride, row_num, sums + l * row_num);
+
+        return;
+    }
+#endif
+
+    for(; l < vec_num; l++)
+        dot_c(vec + l * vec_stride, rows, len, row_stride, row_num, sums + l * row_num);
+}
+
+void x86_q7_requant(int isa, const int32_t* sums, int num, int out_shift, int relu, int8_t* out)
+{
+#ifdef X86_Q7_SIMD
+    if(isa & CPU_ISA_SSE41)
+        requant_sse41(sums, num, out_shift, relu, out);
+    else
+#endif
+        requant_c(sums, num, out_shift, relu, out);
+}
+
+void x86_q7_max(int isa, int8_t* data, const int8_t* src, int num)
+{
+#ifdef X86_Q7_SIMD
+    if(isa & CPU_ISA_AVX2)
+    {
+        max_avx2(data, src, num);
+        return;
+    }
+
+    if(isa & CPU_ISA_SSE41)
+    {
+        max_sse41(data, src, num);
+        return;
+    }
+#endif
+
+    for(int i = 0; i < num; i++)
+    {
+        if(src[i] > data[i])
+            data[i] = src[i];
+    }
+}
+
+void x86_q7_relu(int isa, int8_t* data, int num)
+{
+    static const int8_t zeros[64] = {0};
+
+    /* max against a row of zeros, 64 at a time */
+    for(int i = 0; i < num; i += 64)
+        x86_q7_max(isa, data + i, zeros, num - i < 64 ? num - i : 64);
+}
@@ -0,0 +1,49 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#ifndef __CONV1D_Q7_H__
+#define __CONV1D_Q7_H__
+
+#include <stdint.h>
+
+/*
+ * q7 kernel of the convs whose kernel covers the whole input width, shared by the cmsis_conv1d
+ * node ops and the aot plan runtime. In HWC the input rows under the kernel at an output row are
+ * contiguous, and so is the filter of an output channel: each output is one q7 dot product of
+ * kernel_h * row_size, with no im2col. The rounding and the saturation are the ones of
+ * arm_convolve_HWC_q7_nonsquare(), so are the outputs.
+ */
+
+/* bytes of the expanded input rows conv1d_q7_rows() may take, 0 if it does not expand them */
+int conv1d_q7_buffer_size(int in_h, int row_size, int stride_h, int pad_h0);
+
+/*
+ * output rows [row_start, row_end) of one input of in_h rows of row_size q7; the filter of each
+ * of the out_c channels is kernel_h rows. buffer holds conv1d_q7_buffer_size() bytes, or is NULL.
+ */
+void conv1d_q7_rows(const int8_t* input, int in_h, int row_size, const int8_t* weight, const int8_t* bias,
+                    int out_c, int kernel_h, int stride_h, int pad_h0, int bias_shift, int out_shift, int relu,
+                    int row_start, int row_end, void* buffer, int8_t* output);
+
+#endif
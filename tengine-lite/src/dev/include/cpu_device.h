@@ -28,9 +28,14 @@
 #include "nn_device.h"
 
 #define MEM_POOL_ALLOCATED 8
+#define MEM_ARENA_ALIGN_SIZE 16
 
 struct node_ops;
 struct ir_node;
+struct ir_tensor;
+struct cpu_pool;
+struct perf_info;
+struct tune_info;
 
 struct cpu_device
 {
@@ -47,6 +52,7 @@ struct exec_node
 
     int8_t inplace_map_num;
     int8_t output_num;
+    int8_t fused; /* a relu folded into the node before it, no step of its own */
 
     union
     {
@@ -63,6 +69,18 @@ struct exec_node
     int shared_mem_size;
 };
 
+/* one entry of the execution plan, resolved at prerun */
+struct exec_step
+{
+    struct exec_node* exec_node;
+    struct node_ops* node_ops;
+    struct ir_node* ir_node;
+    struct ir_tensor** input_tensors;
+    struct ir_node* fused_node; /* relu folded into this step, not run on its own */
+    uint8_t input_num;
+    uint8_t infer_always; /* the output shape may change at every run */
+};
+
 struct mem_block_entry
 {
     void* addr;
@@ -87,12 +105,26 @@ struct mem_pool
 struct exec_graph
 {
     struct vector* exec_node_list;
-    struct mem_pool* mem_pool;
     struct cpu_device* dev;
 
-    void* shared_mem;
+    void* mem_arena; /* all activations, offsets planned at prerun */
+    int mem_arena_size;
+
+    struct exec_step* exec_plan; /* exec nodes in run order */
+    int step_num;
+    int tail_step; /* the first step after the last one keeping state between runs */
+
+    void* shared_mem; /* num_thread slices for kernels split over the cpu_pool */
     int shared_mem_size;
     int num_thread;
+    struct cpu_pool* cpu_pool; /* NULL when num_thread is 1 */
+    int cpu_isa; /* the CPU_ISA_* features the node ops may use */
+
+    struct perf_info* perf_stat; /* one record per exec step, NULL when the perf stats are disabled */
+    int perf_on;
+
+    struct tune_info* tune_log; /* one record per tuned node, NULL when the graph was not tuned */
+    int tune_num;
 };
 
 #define GET_MEM_PTR_HEADER(ptr) ( struct mem_ptr_header* )(( char* )ptr - 4);
@@ -40,5 +40,6 @@
 #define ARCH_ARM_V8 1
 #define ARCH_ARM_V7 2
 #define ARCH_ARM_V8_2 3
+#define ARCH_X86 4
 
 #endif
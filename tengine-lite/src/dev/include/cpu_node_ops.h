@@ -52,8 +52,17 @@ struct node_ops
     /* release node is called after postrun() is called */
     int (*release_node)(struct node_ops*, struct exec_node*, struct exec_graph*);
 
+    /* reset is called by reset_graph(), to drop the state kept between runs */
+    int (*reset)(struct node_ops*, struct exec_node*, struct exec_graph*);
+
     /* score */
     int (*score)(struct node_ops*, struct exec_graph*, struct ir_node*);
+
+    /* the CPU_ISA_* features the ops run on, only scored when the exec graph has them all */
+    int isa;
+
+    /* the name of the variant in the tune log */
+    const char* name;
 };
 
 int init_cpu_node_ops_registry(void);
@@ -67,6 +76,10 @@ int unregister_custom_node_ops(int op_type, struct node_ops* node_ops);
 
 struct node_ops* find_node_ops(struct exec_graph* exec_graph, struct ir_node* ir_node);
 
+/* the builtin node ops able to run the node, highest score first, for the tuning at prerun */
+int get_node_ops_candidates(struct exec_graph* exec_graph, struct ir_node* ir_node, struct node_ops** cand_list,
+                            int cand_size);
+
 #define AUTO_REGISTER_OPS(reg_func) REGISTER_MODULE_INIT(MOD_OP_LEVEL, NULL, reg_func)
 #define AUTO_UNREGISTER_OPS(unreg_func) REGISTER_MODULE_EXIT(MOD_OP_LEVEL, NULL, unreg_func);
 
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#ifndef __CPU_POOL_H__
+#define __CPU_POOL_H__
+
+/*
+ * persistent worker threads of an exec_graph, created at prerun when num_thread > 1.
+ * A kernel splits its work into parts and runs them with run_cpu_pool(): the calling thread
+ * takes part 0 and worker i takes part i, so a part can use the i-th slice of the shared memory.
+ */
+
+struct cpu_pool;
+
+typedef int (*cpu_task_t)(void* arg, int part, int part_num);
+
+/* returns NULL if no thread can be created, e.g. on bare metal */
+struct cpu_pool* create_cpu_pool(int num_thread);
+
+void release_cpu_pool(struct cpu_pool* pool);
+
+/* part_num must not exceed num_thread of the pool. Without a pool, the parts run one by one */
+int run_cpu_pool(struct cpu_pool* pool, cpu_task_t task, void* arg, int part_num);
+
+/* the macs a part must get for a worker to be woken: below, the round trip costs more than the part saves */
+#define CPU_POOL_MIN_PART_MACS (64 * 1024)
+
+/*
+ * the parts to split unit_num units (output rows, fc rows) of unit_macs macs each into: at most
+ * num_thread and unit_num, each of CPU_POOL_MIN_PART_MACS at least. 1 runs the kernel inline.
+ */
+int get_cpu_pool_part_num(int num_thread, int unit_num, int unit_macs);
+
+#endif
@@ -56,4 +56,7 @@ struct probed_cpu_info
 
 struct probed_cpu_info* get_probed_cpu_info(void);
 
+/* the CPU_ISA_* features of the cpu, as capped by TENGINE_CPU_ISA in the environment */
+int get_cpu_isa(void);
+
 #endif
@@ -0,0 +1,55 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#ifndef __CPU_TUNE_H__
+#define __CPU_TUNE_H__
+
+#include <stdint.h>
+
+struct ir_graph;
+struct exec_graph;
+struct exec_node;
+struct tune_info;
+
+/* the model part of the tune cache key: the ops, their params and the tensors of the graph */
+uint32_t get_model_hash(struct ir_graph* ir_graph);
+
+/*
+ * times the node ops able to run the node on its tensors, and binds the fastest to it, or the
+ * one the cache holds for the model and the shape. The node is init but not prerun, before and
+ * after. Returns 1 and fills info when there was a choice, 0 when not, -1 on error.
+ */
+int tune_exec_node(struct exec_graph* exec_graph, struct exec_node* exec_node, uint32_t model_hash,
+                   struct tune_info* info);
+
+int init_tune_cache(void);
+
+void release_tune_cache(void);
+
+/* the cache as a blob of size bytes, returned; with buf NULL, the size only. -1 when buf is short */
+int save_tune_cache_blob(void* buf, int buf_size);
+
+/* adds the entries of a blob of save_tune_cache_blob() the cache has not, returns their number */
+int load_tune_cache_blob(const void* buf, int size);
+
+#endif
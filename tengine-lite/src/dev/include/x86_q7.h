@@ -0,0 +1,60 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+#ifndef __X86_Q7_H__
+#define __X86_Q7_H__
+
+#include <stdint.h>
+
+#include "tengine_c_api.h"
+
+/*
+ * q7 kernels of the x86 ops, in SSE4.1 or AVX2 as isa has CPU_ISA_SSE41 or CPU_ISA_AVX2. The q7
+ * are sign extended to 16 bits and multiplied by pmaddwd into 32 bits, so the sums are exact,
+ * and the requant is the one of the cmsis functions: the outputs of the x86 ops are the ones of
+ * the cmsis ops, whose plain C branches run on x86.
+ */
+
+/* each x86 op has a variant per isa, over the cmsis ops and the wider isa first */
+#define X86_Q7_SCORE(isa) (OPS_SCORE_BEST + (((isa) & CPU_ISA_AVX2) ? 300 : 200))
+
+/* the input vectors sharing each load of a row in x86_q7_dot() */
+#define X86_Q7_LANES 4
+
+/*
+ * sums[l * row_num + i] += (vec + l * vec_stride) . (rows + i * row_stride), for l in [0, vec_num)
+ * and i in [0, row_num): each row is loaded once for up to X86_Q7_LANES vectors
+ */
+void x86_q7_dot(int isa, const int8_t* vec, int vec_stride, int vec_num, const int8_t* rows, int len, int row_stride,
+                int row_num, int32_t* sums);
+
+/* out[i] = saturate(sums[i] >> out_shift), then 0 if negative when relu is set */
+void x86_q7_requant(int isa, const int32_t* sums, int num, int out_shift, int relu, int8_t* out);
+
+/* data[i] = max(data[i], src[i]) */
+void x86_q7_max(int isa, int8_t* data, const int8_t* src, int num);
+
+/* data[i] = max(data[i], 0) */
+void x86_q7_relu(int isa, int8_t* data, int num);
+
+#endif
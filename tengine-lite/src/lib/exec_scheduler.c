@@ -23,141 +23,197 @@
  */
 
 #include <stdio.h>
+#include <string.h>
+
+#if defined(CONFIG_FREERTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#elif !defined(CONFIG_BAREMETAL_BUILD)
+#include <pthread.h>
+#endif
 
 #include "sys_port.h"
 #include "tengine_ir.h"
 #include "tengine_errno.h"
 #include "tengine_log.h"
+#include "tengine_exec.h"
 #include "exec_scheduler.h"
 #include "nn_device.h"
 
-static int sched_prerun(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int num_thread)
+struct sched_worker;
+
+/* kept in exec_attr->sched_priv from prerun to postrun */
+struct sched_priv
+{
+    struct subgraph** order;
+    struct sched_worker* worker; /* async scheduler only */
+    int busy; /* async scheduler: a run was posted and not waited yet */
+};
+
+/*
+ * order the subgraphs once, so that a subgraph comes after the subgraphs producing its inputs,
+ * and keep the order in sched_priv for run_subgraphs()
+ */
+static int create_run_order(struct ir_graph* ir_graph, struct sched_priv* priv)
 {
     int subgraph_num = get_vector_num(ir_graph->subgraph_list);
 
-    for(int i = 0; i < subgraph_num; i++)
+    struct subgraph** order = ( struct subgraph** )sys_malloc(sizeof(struct subgraph*) * (subgraph_num + 1));
+    uint8_t* placed = ( uint8_t* )sys_malloc(subgraph_num + 1);
+
+    if(order == NULL || placed == NULL)
     {
-        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
-        struct nn_device* nn_dev = subgraph->nn_dev;
+        sys_free(order);
+        sys_free(placed);
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
 
-        if(nn_dev->prerun(nn_dev, subgraph, num_thread) < 0)
+    memset(placed, 0, subgraph_num + 1);
+
+    int order_num = 0;
+
+    while(order_num < subgraph_num)
+    {
+        int ready_num = 0;
+
+        for(int i = 0; i < subgraph_num; i++)
         {
-            subgraph->status = GRAPH_STAT_ERROR;
-            TLOG_ERR("subgraph %d prerun failed\n", subgraph->idx);
-            return -1;
+            struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+            int j;
+
+            if(placed[i])
+                continue;
+
+            for(j = 0; j < subgraph->input_num; j++)
+            {
+                struct ir_tensor* ir_tensor = get_ir_graph_tensor(ir_graph, subgraph->input_tensor_list[j]);
+
+                if(ir_tensor->tensor_type != TENSOR_TYPE_VAR || ir_tensor->producer < 0)
+                    continue;
+
+                struct ir_node* producer = get_ir_graph_node(ir_graph, ir_tensor->producer);
+
+                if(producer->subgraph_idx != i && !placed[producer->subgraph_idx])
+                    break;
+            }
+
+            if(j < subgraph->input_num)
+                continue;
+
+            order[order_num++] = subgraph;
+            placed[i] = 1;
+            ready_num++;
         }
 
-        subgraph->status = GRAPH_STAT_READY;
+        if(ready_num == 0)
+        {
+            TLOG_ERR("no sugraph is ready, while still %d subgraph in wait_list\n", subgraph_num - order_num);
+            sys_free(order);
+            sys_free(placed);
+            set_tengine_errno(EFAULT);
+            return -1;
+        }
     }
 
+    sys_free(placed);
+
+    priv->order = order;
+
     return 0;
 }
 
-static int sched_run(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int block)
+static void release_sched_priv(struct ir_graph* ir_graph)
 {
-    if(block == 0)
-    {
-        TLOG_DEBUG("sync scheduler does not support non block run\n");
-        set_tengine_errno(ENOTSUP);
-        return -1;
-    }
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
 
-    struct vector* wait_list = create_vector(sizeof(struct subgraph*), NULL);
+    if(priv == NULL)
+        return;
 
-    if(wait_list == NULL)
-    {
-        set_tengine_errno(ENOMEM);
-        return -1;
-    }
+    sys_free(priv->order);
+    sys_free(priv);
 
-    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
+    exec_attr->sched_priv = NULL;
+}
 
-    /* insert all subgraphs into wait list */
+static int run_subgraphs(struct ir_graph* ir_graph, struct subgraph** order)
+{
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
 
     for(int i = 0; i < subgraph_num; i++)
     {
-        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct subgraph* subgraph = order[i];
+        struct nn_device* nn_dev = subgraph->nn_dev;
 
-        push_vector_data(wait_list, &subgraph);
-    }
+        subgraph->status = GRAPH_STAT_RUNNING;
 
-    int* ready_list = sys_malloc(sizeof(int) * subgraph_num);
+        if(nn_dev->run(nn_dev, subgraph) < 0)
+        {
+            TLOG_ERR("run subgraph %d error!\n", subgraph->idx);
+            subgraph->status = GRAPH_STAT_ERROR;
+            return -1;
+        }
 
-    if(ready_list == NULL)
-    {
-        set_tengine_errno(ENOMEM);
-        return -1;
+        subgraph->status = GRAPH_STAT_READY;
     }
 
-    while(1)
-    {
-        int ready_num = 0;
-        int wait_num = get_vector_num(wait_list);
-
-        if(wait_num == 0)
-            break;
+    return 0;
+}
 
-        for(int i = 0; i < wait_num; i++)
-        {
-            struct subgraph* subgraph = *( struct subgraph** )get_vector_data(wait_list, i);
+static int sched_prerun(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int num_thread)
+{
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
 
-            if(subgraph->input_ready_count == subgraph->input_wait_count)
-                ready_list[ready_num++] = i;
-        }
+    for(int i = 0; i < subgraph_num; i++)
+    {
+        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct nn_device* nn_dev = subgraph->nn_dev;
 
-        if(ready_num == 0)
+        if(nn_dev->prerun(nn_dev, subgraph, num_thread) < 0)
         {
-            TLOG_ERR("no sugraph is ready, while still %d subgraph in wait_list\n", wait_num);
-            set_tengine_errno(EFAULT);
+            subgraph->status = GRAPH_STAT_ERROR;
+            TLOG_ERR("subgraph %d prerun failed\n", subgraph->idx);
             return -1;
         }
 
-        for(int i = 0; i < ready_num; i++)
-        {
-            struct subgraph* subgraph = *( struct subgraph** )get_vector_data(wait_list, ready_list[i]);
-            struct nn_device* nn_dev = subgraph->nn_dev;
+        subgraph->status = GRAPH_STAT_READY;
+    }
 
-            subgraph->status = GRAPH_STAT_RUNNING;
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )sys_malloc(sizeof(struct sched_priv));
 
-            if(nn_dev->run(nn_dev, subgraph) < 0)
-            {
-                TLOG_ERR("run subgraph %d error!\n", subgraph->idx);
-                sys_free(ready_list);
-                release_vector(wait_list);
-                subgraph->status = GRAPH_STAT_ERROR;
-                return -1;
-            }
+    if(priv == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
 
-            subgraph->status = GRAPH_STAT_READY;
-        }
+    memset(priv, 0, sizeof(struct sched_priv));
 
-        /* remove executed subgraph from list,
-           shoudl from higher idx to lower idx */
-        for(int i = ready_num - 1; i >= 0; i--)
-            remove_vector_by_idx(wait_list, ready_list[i]);
-#ifdef __CC_ARM
-        __memory_changed();
-#else
-        /* GNU CC*/
-        __asm__ __volatile__("" ::: "memory"); /* force to read vector->num from memory */
-#endif
-    }
+    release_sched_priv(ir_graph);
+    exec_attr->sched_priv = priv;
 
-    /* reset the ready count */
+    return create_run_order(ir_graph, priv);
+}
 
-    for(int i = 0; i < subgraph_num; i++)
+static int sched_run(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int block)
+{
+    if(block == 0)
     {
-        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
-        subgraph->input_ready_count = 0;
+        TLOG_DEBUG("sync scheduler does not support non block run\n");
+        set_tengine_errno(ENOTSUP);
+        return -1;
     }
 
-    sys_free(ready_list);
-    release_vector(wait_list);
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
 
-    return 0;
+    return run_subgraphs(ir_graph, priv->order);
 }
 
-static int sched_wait(struct exec_scheduler* scheduler, struct ir_graph* ir_graph)
+static int sched_wait(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int try_wait)
 {
     set_tengine_errno(ENOTSUP);
     return -1;
@@ -183,18 +239,45 @@ static int sched_postrun(struct exec_scheduler* scheduler, struct ir_graph* ir_g
         }
     }
 
+    release_sched_priv(ir_graph);
+
     if(has_error)
         return -1;
     else
         return 0;
 }
 
+static int sched_reset(struct exec_scheduler* scheduler, struct ir_graph* ir_graph)
+{
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
+
+    for(int i = 0; i < subgraph_num; i++)
+    {
+        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct nn_device* nn_dev = subgraph->nn_dev;
+
+        /* a device without reset keeps no state between runs */
+        if(nn_dev->reset == NULL)
+            continue;
+
+        if(nn_dev->reset(nn_dev, subgraph) < 0)
+        {
+            subgraph->status = GRAPH_STAT_ERROR;
+            TLOG_ERR("subgraph %d reset failed\n", subgraph->idx);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 static struct exec_scheduler sync_scheduler = {
     .name = "sync",
     .prerun = sched_prerun,
     .run = sched_run,
     .wait = sched_wait,
     .postrun = sched_postrun,
+    .reset = sched_reset,
     .release = NULL,
 };
 
@@ -202,3 +285,399 @@ struct exec_scheduler* get_default_scheduler(void)
 {
     return &sync_scheduler;
 }
+
+/*
+ * the async scheduler runs the subgraphs on a worker of the graph, created by prerun.
+ * run_graph(graph, 0) posts the run and returns at once, so the caller can prepare the next
+ * input while the current one infers; wait_graph() collects the result.
+ *
+ * The worker is a pthread on Linux and a task on FreeRTOS (CONFIG_FREERTOS), at the priority
+ * of the task calling prerun. Without an OS, the run is done by run_graph() itself.
+ */
+#if defined(CONFIG_FREERTOS)
+
+#ifndef SCHED_WORKER_STACK_SIZE
+#define SCHED_WORKER_STACK_SIZE (configMINIMAL_STACK_SIZE * 4)
+#endif
+
+struct sched_worker
+{
+    struct ir_graph* ir_graph;
+    struct subgraph** order;
+
+    TaskHandle_t task;
+    SemaphoreHandle_t start_sem;
+    SemaphoreHandle_t done_sem;
+    int quit;
+
+    /* of the last run, written before done_sem is given */
+    int ret;
+    int err;
+};
+
+static void worker_task(void* arg)
+{
+    struct sched_worker* worker = ( struct sched_worker* )arg;
+
+    while(1)
+    {
+        xSemaphoreTake(worker->start_sem, portMAX_DELAY);
+
+        if(worker->quit)
+            break;
+
+        worker->ret = run_subgraphs(worker->ir_graph, worker->order);
+        worker->err = worker->ret < 0 ? get_tengine_errno() : 0;
+
+        xSemaphoreGive(worker->done_sem);
+    }
+
+    xSemaphoreGive(worker->done_sem);
+    vTaskDelete(NULL);
+}
+
+static void release_sched_worker(struct sched_worker* worker)
+{
+    if(worker->task)
+    {
+        worker->quit = 1;
+        xSemaphoreGive(worker->start_sem);
+        xSemaphoreTake(worker->done_sem, portMAX_DELAY);
+    }
+
+    if(worker->start_sem)
+        vSemaphoreDelete(worker->start_sem);
+
+    if(worker->done_sem)
+        vSemaphoreDelete(worker->done_sem);
+
+    sys_free(worker);
+}
+
+static struct sched_worker* create_sched_worker(struct ir_graph* ir_graph, struct subgraph** order)
+{
+    struct sched_worker* worker = ( struct sched_worker* )sys_malloc(sizeof(struct sched_worker));
+
+    if(worker == NULL)
+        return NULL;
+
+    memset(worker, 0, sizeof(struct sched_worker));
+
+    worker->ir_graph = ir_graph;
+    worker->order = order;
+    worker->start_sem = xSemaphoreCreateBinary();
+    worker->done_sem = xSemaphoreCreateBinary();
+
+    if(worker->start_sem == NULL || worker->done_sem == NULL ||
+       xTaskCreate(worker_task, "tengine", SCHED_WORKER_STACK_SIZE, worker, uxTaskPriorityGet(NULL),
+                   &worker->task) != pdPASS)
+    {
+        worker->task = NULL;
+        release_sched_worker(worker);
+        return NULL;
+    }
+
+    return worker;
+}
+
+static int post_sched_worker(struct sched_worker* worker)
+{
+    xSemaphoreGive(worker->start_sem);
+
+    return 0;
+}
+
+/* 1: the run is done, 0: still running (try_wait only) */
+static int wait_sched_worker(struct sched_worker* worker, int try_wait)
+{
+    if(xSemaphoreTake(worker->done_sem, try_wait ? 0 : portMAX_DELAY) != pdTRUE)
+        return 0;
+
+    if(worker->ret < 0)
+    {
+        set_tengine_errno(worker->err);
+        return -1;
+    }
+
+    return 1;
+}
+
+#elif defined(CONFIG_BAREMETAL_BUILD)
+
+struct sched_worker
+{
+    struct ir_graph* ir_graph;
+    struct subgraph** order;
+
+    int ret;
+    int err;
+};
+
+static struct sched_worker* create_sched_worker(struct ir_graph* ir_graph, struct subgraph** order)
+{
+    struct sched_worker* worker = ( struct sched_worker* )sys_malloc(sizeof(struct sched_worker));
+
+    if(worker == NULL)
+        return NULL;
+
+    worker->ir_graph = ir_graph;
+    worker->order = order;
+    worker->ret = 0;
+    worker->err = 0;
+
+    return worker;
+}
+
+static void release_sched_worker(struct sched_worker* worker)
+{
+    sys_free(worker);
+}
+
+static int post_sched_worker(struct sched_worker* worker)
+{
+    worker->ret = run_subgraphs(worker->ir_graph, worker->order);
+    worker->err = worker->ret < 0 ? get_tengine_errno() : 0;
+
+    return 0;
+}
+
+static int wait_sched_worker(struct sched_worker* worker, int try_wait)
+{
+    if(worker->ret < 0)
+    {
+        set_tengine_errno(worker->err);
+        return -1;
+    }
+
+    return 1;
+}
+
+#else
+
+struct sched_worker
+{
+    struct ir_graph* ir_graph;
+    struct subgraph** order;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int start;
+    int done;
+    int quit;
+
+    /* of the last run */
+    int ret;
+    int err;
+};
+
+static void* worker_thread(void* arg)
+{
+    struct sched_worker* worker = ( struct sched_worker* )arg;
+
+    pthread_mutex_lock(&worker->mutex);
+
+    while(1)
+    {
+        while(!worker->start && !worker->quit)
+            pthread_cond_wait(&worker->cond, &worker->mutex);
+
+        if(worker->quit)
+            break;
+
+        worker->start = 0;
+        pthread_mutex_unlock(&worker->mutex);
+
+        int ret = run_subgraphs(worker->ir_graph, worker->order);
+        int err = ret < 0 ? get_tengine_errno() : 0;
+
+        pthread_mutex_lock(&worker->mutex);
+
+        worker->ret = ret;
+        worker->err = err;
+        worker->done = 1;
+
+        pthread_cond_broadcast(&worker->cond);
+    }
+
+    pthread_mutex_unlock(&worker->mutex);
+
+    return NULL;
+}
+
+static struct sched_worker* create_sched_worker(struct ir_graph* ir_graph, struct subgraph** order)
+{
+    struct sched_worker* worker = ( struct sched_worker* )sys_malloc(sizeof(struct sched_worker));
+
+    if(worker == NULL)
+        return NULL;
+
+    memset(worker, 0, sizeof(struct sched_worker));
+
+    worker->ir_graph = ir_graph;
+    worker->order = order;
+
+    pthread_mutex_init(&worker->mutex, NULL);
+    pthread_cond_init(&worker->cond, NULL);
+
+    if(pthread_create(&worker->thread, NULL, worker_thread, worker) != 0)
+    {
+        pthread_cond_destroy(&worker->cond);
+        pthread_mutex_destroy(&worker->mutex);
+        sys_free(worker);
+        return NULL;
+    }
+
+    return worker;
+}
+
+static void release_sched_worker(struct sched_worker* worker)
+{
+    pthread_mutex_lock(&worker->mutex);
+    worker->quit = 1;
+    pthread_cond_broadcast(&worker->cond);
+    pthread_mutex_unlock(&worker->mutex);
+
+    pthread_join(worker->thread, NULL);
+
+    pthread_cond_destroy(&worker->cond);
+    pthread_mutex_destroy(&worker->mutex);
+
+    sys_free(worker);
+}
+
+static int post_sched_worker(struct sched_worker* worker)
+{
+    pthread_mutex_lock(&worker->mutex);
+    worker->start = 1;
+    worker->done = 0;
+    pthread_cond_broadcast(&worker->cond);
+    pthread_mutex_unlock(&worker->mutex);
+
+    return 0;
+}
+
+/* 1: the run is done, 0: still running (try_wait only) */
+static int wait_sched_worker(struct sched_worker* worker, int try_wait)
+{
+    pthread_mutex_lock(&worker->mutex);
+
+    if(try_wait && !worker->done)
+    {
+        pthread_mutex_unlock(&worker->mutex);
+        return 0;
+    }
+
+    while(!worker->done)
+        pthread_cond_wait(&worker->cond, &worker->mutex);
+
+    int ret = worker->ret;
+    int err = worker->err;
+
+    pthread_mutex_unlock(&worker->mutex);
+
+    if(ret < 0)
+    {
+        set_tengine_errno(err);
+        return -1;
+    }
+
+    return 1;
+}
+
+#endif
+
+static int async_prerun(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int num_thread)
+{
+    if(sched_prerun(scheduler, ir_graph, num_thread) < 0)
+        return -1;
+
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
+
+    priv->worker = create_sched_worker(ir_graph, priv->order);
+
+    if(priv->worker == NULL)
+    {
+        TLOG_ERR("create the worker of the async scheduler failed\n");
+        sched_postrun(scheduler, ir_graph);
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int async_run(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int block)
+{
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
+
+    if(priv->busy)
+    {
+        TLOG_ERR("the last run has not been waited\n");
+        set_tengine_errno(EBUSY);
+        return -1;
+    }
+
+    if(block)
+        return run_subgraphs(ir_graph, priv->order);
+
+    priv->busy = 1;
+
+    return post_sched_worker(priv->worker);
+}
+
+static int async_wait(struct exec_scheduler* scheduler, struct ir_graph* ir_graph, int try_wait)
+{
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
+
+    if(!priv->busy)
+        return 1;
+
+    int ret = wait_sched_worker(priv->worker, try_wait);
+
+    if(ret != 0)
+        priv->busy = 0;
+
+    return ret;
+}
+
+static int async_postrun(struct exec_scheduler* scheduler, struct ir_graph* ir_graph)
+{
+    struct exec_attr* exec_attr = get_ir_graph_exec_attr(ir_graph);
+    struct sched_priv* priv = ( struct sched_priv* )exec_attr->sched_priv;
+
+    if(priv != NULL && priv->worker != NULL)
+    {
+        /* the result of a run nobody waited for is dropped */
+        async_wait(scheduler, ir_graph, 0);
+
+        release_sched_worker(priv->worker);
+        priv->worker = NULL;
+    }
+
+    return sched_postrun(scheduler, ir_graph);
+}
+
+static struct exec_scheduler async_scheduler = {
+    .name = "async",
+    .prerun = async_prerun,
+    .run = async_run,
+    .wait = async_wait,
+    .postrun = async_postrun,
+    .reset = sched_reset,
+    .release = NULL,
+};
+
+struct exec_scheduler* get_scheduler_by_name(const char* name)
+{
+    if(!strcmp(name, sync_scheduler.name))
+        return &sync_scheduler;
+
+    if(!strcmp(name, async_scheduler.name))
+        return &async_scheduler;
+
+    return NULL;
+}
@@ -24,7 +24,12 @@
 
 #include <string.h>
 
+#if !defined(CONFIG_BAREMETAL_BUILD)
+#include <time.h>
+#endif
+
 #include "sys_port.h"
+#include "tengine_c_api.h"
 
 #ifdef CONFIG_MEM_STAT
 
@@ -93,3 +98,79 @@ char* strdup(const char* src)
 }
 
 #endif
+
+/*
+ * the clock of the perf stats: a free running 32bit counter, so that the time of a node
+ * is end - start even if the counter wrapped in between.
+ * On Cortex-M targets, it is the DWT cycle counter, and the app tells the core clock by
+ * set_perf_clock(NULL, SystemCoreClock / 1000). On Linux, it counts us.
+ */
+#if defined(CONFIG_ARCH_CORTEX_M) && defined(CONFIG_BAREMETAL_BUILD)
+
+#define DWT_CTRL (*( volatile uint32_t* )0xE0001000)
+#define DWT_CYCCNT (*( volatile uint32_t* )0xE0001004)
+#define DEM_CR (*( volatile uint32_t* )0xE000EDFC)
+
+#define DEM_CR_TRCENA (1 << 24)
+#define DWT_CTRL_CYCCNTENA (1 << 0)
+
+static uint32_t default_perf_clock(void)
+{
+    if(!(DWT_CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        DEM_CR |= DEM_CR_TRCENA;
+        DWT_CYCCNT = 0;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    }
+
+    return DWT_CYCCNT;
+}
+
+#define DEFAULT_PERF_CLOCK_BASE 0 /* unknown until the app sets it */
+
+#elif !defined(CONFIG_BAREMETAL_BUILD)
+
+static uint32_t default_perf_clock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ( uint32_t )(( uint64_t )ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+#define DEFAULT_PERF_CLOCK_BASE 1000
+
+#else
+
+static uint32_t default_perf_clock(void)
+{
+    return 0;
+}
+
+#define DEFAULT_PERF_CLOCK_BASE 0
+
+#endif
+
+static perf_clock_t perf_clock = default_perf_clock;
+static uint32_t perf_clock_base = DEFAULT_PERF_CLOCK_BASE;
+
+int DLLEXPORT set_perf_clock(perf_clock_t clock, uint32_t base)
+{
+    if(clock)
+        perf_clock = clock;
+
+    perf_clock_base = base;
+
+    return 0;
+}
+
+uint32_t DLLEXPORT read_perf_clock(void)
+{
+    return perf_clock();
+}
+
+uint32_t DLLEXPORT get_perf_clock_base(void)
+{
+    return perf_clock_base;
+}
@@ -289,6 +289,14 @@ int DLLEXPORT destroy_graph(graph_t graph)
 {
     struct ir_graph* ir_graph = ( struct ir_graph* )graph;
 
+    /* prerun but not postrun: the scheduler releases its state, and its worker, before the graph goes */
+    if(ir_graph->exec_attr->sched_priv)
+    {
+        struct exec_scheduler* scheduler = get_ir_graph_context(ir_graph)->scheduler;
+
+        scheduler->postrun(scheduler, ir_graph);
+    }
+
     if(ir_graph->exec_attr->priv_context)
         destroy_context(ir_graph->exec_attr->exec_context);
 
@@ -931,6 +939,13 @@ int DLLEXPORT run_graph(graph_t graph, int block)
     struct exec_context* context = get_ir_graph_context(ir_graph);
     struct exec_scheduler* scheduler = context->scheduler;
 
+    /* a non block run must be waited before the next one */
+    if(ir_graph->status == GRAPH_STAT_RUNNING)
+    {
+        set_tengine_errno(EBUSY);
+        return -1;
+    }
+
     ir_graph->status = GRAPH_STAT_RUNNING;
 
     if(scheduler->run(scheduler, ir_graph, block) < 0)
@@ -953,22 +968,79 @@ int DLLEXPORT wait_graph(graph_t graph, int try_wait)
     struct exec_context* context = get_ir_graph_context(ir_graph);
     struct exec_scheduler* scheduler = context->scheduler;
 
-    if(ir_graph->status != GRAPH_STAT_RUNNING || ir_graph->status != GRAPH_STAT_READY)
+    if(ir_graph->status != GRAPH_STAT_RUNNING && ir_graph->status != GRAPH_STAT_READY)
     {
         set_tengine_errno(EINVAL);
         return -1;
     }
 
     if(ir_graph->status == GRAPH_STAT_READY)
-        return 0;
+        return 1;
+
+    int ret = scheduler->wait(scheduler, ir_graph, try_wait);
+
+    if(ret < 0)
+        ir_graph->status = GRAPH_STAT_ERROR;
+    else if(ret > 0)
+        ir_graph->status = GRAPH_STAT_READY;
+
+    return ret;
+}
+
+int DLLEXPORT reset_graph(graph_t graph)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    struct exec_context* context = get_ir_graph_context(ir_graph);
+    struct exec_scheduler* scheduler = context->scheduler;
+
+    if(ir_graph->status != GRAPH_STAT_READY)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    if(scheduler->reset == NULL)
+    {
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    if(scheduler->reset(scheduler, ir_graph) < 0)
+    {
+        ir_graph->status = GRAPH_STAT_ERROR;
+        return -1;
+    }
 
-    if(!try_wait)
+    /* the shapes of the streaming nodes go back to what prerun inferred */
+    if(infer_shape_graph(ir_graph) < 0)
     {
-        set_tengine_errno(EAGAIN);
+        ir_graph->status = GRAPH_STAT_ERROR;
         return -1;
     }
 
-    return scheduler->wait(scheduler, ir_graph);
+    return 0;
+}
+
+int DLLEXPORT set_graph_stream_chunks(graph_t graph, int chunk_num)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+
+    if(ir_graph->status != GRAPH_STAT_READY || chunk_num < 1 || chunk_num > 255)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    /* the chunks are looped by the device, over the nodes of its own subgraph */
+    if(chunk_num > 1 && get_vector_num(ir_graph->subgraph_list) != 1)
+    {
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    ir_graph->stream_chunk_num = chunk_num;
+
+    return 0;
 }
 
 int DLLEXPORT postrun_graph(graph_t graph)
@@ -988,6 +1060,243 @@ int DLLEXPORT postrun_graph(graph_t graph)
     return 0;
 }
 
+int DLLEXPORT get_graph_exec_status(graph_t graph)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+
+    return ir_graph->status;
+}
+
+int DLLEXPORT do_graph_perf_stat(graph_t graph, int action)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
+    int dev_num = 0;
+
+    if(ir_graph->status != GRAPH_STAT_READY)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    for(int i = 0; i < subgraph_num; i++)
+    {
+        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct nn_device* nn_dev = subgraph->nn_dev;
+
+        if(nn_dev->perf_stat == NULL)
+            continue;
+
+        if(nn_dev->perf_stat(nn_dev, subgraph, action) < 0)
+            return -1;
+
+        dev_num++;
+    }
+
+    if(dev_num == 0)
+    {
+        set_tengine_errno(ENOTSUP);
+        return -1;
+    }
+
+    return 0;
+}
+
+int DLLEXPORT get_graph_perf_stat(graph_t graph, struct perf_info** buf, int buf_size)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
+    int num = 0;
+
+    if(ir_graph->status != GRAPH_STAT_READY)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    for(int i = 0; i < subgraph_num && num < buf_size; i++)
+    {
+        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct nn_device* nn_dev = subgraph->nn_dev;
+
+        if(nn_dev->get_perf_stat == NULL)
+            continue;
+
+        int ret = nn_dev->get_perf_stat(nn_dev, subgraph, buf + num, buf_size - num);
+
+        if(ret < 0)
+            return -1;
+
+        num += ret;
+    }
+
+    return num;
+}
+
+/* in us if the clock base is known, in clock counts if not */
+static uint64_t perf_time(uint64_t t, uint32_t base)
+{
+    return base ? t * 1000 / base : t;
+}
+
+int DLLEXPORT dump_graph_perf_stat(graph_t graph, int csv)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    struct perf_info** buf = ( struct perf_info** )sys_malloc(sizeof(struct perf_info*) * ir_graph->node_num);
+
+    if(buf == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    int num = get_graph_perf_stat(graph, buf, ir_graph->node_num);
+
+    if(num < 0)
+    {
+        sys_free(buf);
+        return -1;
+    }
+
+    uint64_t graph_time = 0;
+
+    for(int i = 0; i < num; i++)
+        graph_time += buf[i]->total_time;
+
+    if(csv)
+        TLOG_INFO("node,name,op,dev,count,min,avg,max,total,bytes,ratio\n");
+    else
+    {
+        TLOG_INFO("perf stats of %d nodes, time in %s\n", num,
+                  (num > 0 && buf[0]->base) ? "us" : "clock counts");
+        TLOG_INFO("%4s %-20s %-16s %8s %8s %8s %8s %10s %8s %6s\n", "node", "name", "op", "count", "min", "avg",
+                  "max", "total", "bytes", "ratio");
+    }
+
+    for(int i = 0; i < num; i++)
+    {
+        struct perf_info* perf = buf[i];
+        const char* name = perf->name ? perf->name : "-";
+        const char* op_name = perf->op_name ? perf->op_name : "-";
+        uint32_t avg = perf->count ? perf->total_time / perf->count : 0;
+        uint32_t bytes = perf->count ? perf->total_bytes / perf->count : 0;
+        uint32_t ratio = graph_time ? perf->total_time * 1000 / graph_time : 0; /* per mille */
+
+        if(csv)
+            TLOG_INFO("%d,%s,%s,%s,%u,%u,%u,%u,%llu,%u,%u.%u\n", perf->node_idx, name, op_name, perf->dev_name,
+                      perf->count, ( uint32_t )perf_time(perf->min, perf->base),
+                      ( uint32_t )perf_time(avg, perf->base), ( uint32_t )perf_time(perf->max, perf->base),
+                      ( unsigned long long )perf_time(perf->total_time, perf->base), bytes, ratio / 10, ratio % 10);
+        else
+            TLOG_INFO("%4d %-20s %-16s %8u %8u %8u %8u %10llu %8u %4u.%u%%\n", perf->node_idx, name, op_name,
+                      perf->count, ( uint32_t )perf_time(perf->min, perf->base),
+                      ( uint32_t )perf_time(avg, perf->base), ( uint32_t )perf_time(perf->max, perf->base),
+                      ( unsigned long long )perf_time(perf->total_time, perf->base), bytes, ratio / 10, ratio % 10);
+    }
+
+    sys_free(buf);
+
+    return 0;
+}
+
+int DLLEXPORT get_graph_tune_log(graph_t graph, struct tune_info** buf, int buf_size)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    int subgraph_num = get_vector_num(ir_graph->subgraph_list);
+    int num = 0;
+
+    if(ir_graph->status != GRAPH_STAT_READY)
+    {
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    for(int i = 0; i < subgraph_num && num < buf_size; i++)
+    {
+        struct subgraph* subgraph = get_ir_graph_subgraph(ir_graph, i);
+        struct nn_device* nn_dev = subgraph->nn_dev;
+
+        if(nn_dev->get_tune_log == NULL)
+            continue;
+
+        int ret = nn_dev->get_tune_log(nn_dev, subgraph, buf + num, buf_size - num);
+
+        if(ret < 0)
+            return -1;
+
+        num += ret;
+    }
+
+    return num;
+}
+
+int DLLEXPORT dump_graph_tune_log(graph_t graph)
+{
+    struct ir_graph* ir_graph = ( struct ir_graph* )graph;
+    struct tune_info** buf = ( struct tune_info** )sys_malloc(sizeof(struct tune_info*) * ir_graph->node_num);
+
+    if(buf == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    int num = get_graph_tune_log(graph, buf, ir_graph->node_num);
+
+    if(num < 0)
+    {
+        sys_free(buf);
+        return -1;
+    }
+
+    TLOG_INFO("tune log of %d nodes, time in %s, * the selected\n", num,
+              (num > 0 && buf[0]->base) ? "us" : "clock counts");
+
+    for(int i = 0; i < num; i++)
+    {
+        struct tune_info* info = buf[i];
+        char line[256];
+        int len = snprintf(line, sizeof(line), "%4d %-20s %-16s", info->node_idx, info->name ? info->name : "-",
+                           info->op_name ? info->op_name : "-");
+
+        for(int j = 0; j < info->cand_num && len < sizeof(line); j++)
+            len += snprintf(line + len, sizeof(line) - len, " %s%s %u", info->cand_name[j] ? info->cand_name[j] : "-",
+                            j == info->selected ? "*" : "", ( uint32_t )perf_time(info->cand_time[j], info->base));
+
+        TLOG_INFO("%s%s\n", line, info->cached ? " (cached)" : "");
+    }
+
+    sys_free(buf);
+
+    return 0;
+}
+
+int DLLEXPORT save_tune_cache(const char* dev_name, void* buf, int buf_size)
+{
+    struct nn_device* nn_dev = get_nn_device_by_name(dev_name);
+
+    if(nn_dev == NULL || nn_dev->save_tune_cache == NULL)
+    {
+        set_tengine_errno(ENOENT);
+        return -1;
+    }
+
+    return nn_dev->save_tune_cache(nn_dev, buf, buf_size);
+}
+
+int DLLEXPORT load_tune_cache(const char* dev_name, const void* buf, int size)
+{
+    struct nn_device* nn_dev = get_nn_device_by_name(dev_name);
+
+    if(nn_dev == NULL || nn_dev->load_tune_cache == NULL)
+    {
+        set_tengine_errno(ENOENT);
+        return -1;
+    }
+
+    return nn_dev->load_tune_cache(nn_dev, buf, size);
+}
+
 void DLLEXPORT dump_graph(graph_t graph)
 {
     dump_ir_graph(graph);
@@ -1135,12 +1444,49 @@ int DLLEXPORT remove_context_device(context_t context, const char* dev_name)
 
 int DLLEXPORT set_context_attr(context_t context, const char* attr_name, const void* val, int val_size)
 {
+    struct exec_context* exec_context = ( struct exec_context* )context;
+
+    if(!strcmp(attr_name, "scheduler"))
+    {
+        struct exec_scheduler* scheduler = NULL;
+
+        if(val != NULL && val_size > 0 && memchr(val, 0, val_size) != NULL)
+            scheduler = get_scheduler_by_name(( const char* )val);
+
+        if(scheduler == NULL)
+        {
+            set_tengine_errno(EINVAL);
+            return -1;
+        }
+
+        exec_context->scheduler = scheduler;
+
+        return 0;
+    }
+
     set_tengine_errno(ENOTSUP);
     return -1;
 }
 
 int DLLEXPORT get_context_attr(context_t context, const char* attr_name, void* val, int val_size)
 {
+    struct exec_context* exec_context = ( struct exec_context* )context;
+
+    if(!strcmp(attr_name, "scheduler"))
+    {
+        const char* name = exec_context->scheduler->name;
+
+        if(val_size < ( int )strlen(name) + 1)
+        {
+            set_tengine_errno(ENOSPC);
+            return -1;
+        }
+
+        strcpy(( char* )val, name);
+
+        return 0;
+    }
+
     set_tengine_errno(ENOTSUP);
     return -1;
 }
@@ -38,6 +38,8 @@ void init_exec_attr(struct exec_attr* attr, struct exec_context* context)
     attr->fc_mt = 0;
     attr->pool_mt = 0;
     attr->exec_context = context;
+    attr->sched_priv = NULL;
+    attr->allocator_priv = NULL;
 }
 
 void destroy_exec_attr(struct ir_graph* g, struct exec_attr* attr)
@@ -87,6 +87,7 @@ void init_ir_graph(struct ir_graph* g, struct exec_context* context)
     g->serializer_priv = NULL;
     g->serializer = NULL;
     g->status = GRAPH_STAT_CREATED;
+    g->stream_chunk_num = 1;
 
     init_exec_attr(g->exec_attr, context);
 }
@@ -206,11 +207,11 @@ int infer_shape_graph(struct ir_graph* ir_graph)
 
             for(int j = 0; j < output_num; j++)
             {
-                struct ir_tensor* tensor = get_ir_graph_tensor(ir_graph, j);
+                struct ir_tensor* tensor = get_ir_graph_tensor(ir_graph, node->output_tensors[j]);
 
                 for(int l = 0; l < tensor->consumer_num; l++)
                 {
-                    struct ir_node* child_node = get_ir_graph_node(ir_graph, l);
+                    struct ir_node* child_node = get_ir_graph_node(ir_graph, tensor->consumer[l]);
                     child_node->dynamic_shape = 1;
                 }
             }
@@ -239,7 +240,7 @@ int infer_shape_graph(struct ir_graph* ir_graph)
 
         for(int j = 0; j < node->output_num; j++)
         {
-            struct ir_tensor* tensor = get_ir_graph_tensor(ir_graph, j);
+            struct ir_tensor* tensor = get_ir_graph_tensor(ir_graph, node->output_tensors[j]);
 
             tensor->reshaped = 0;
         }
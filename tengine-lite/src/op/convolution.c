@@ -34,7 +34,90 @@
 #include "op/convolution_param.h"
 
 DEFINE_PARM_PARSE_ENTRY(conv_param, kernel_h, kernel_w, stride_h, stride_w, pad_h0, pad_h1, pad_w0, pad_w1, dilation_h,
-                        dilation_w, input_channel, output_channel, group);
+                        dilation_w, input_channel, output_channel, group, stream);
+
+/*
+ * a stream conv hands its new rows to the next stream conv, through same shape nodes like relu.
+ * When the chain ends in a fc, the last stream conv keeps as many rows as the fc takes.
+ */
+static int get_stream_window(struct ir_graph* graph, struct ir_tensor* output, int row_size)
+{
+    struct ir_tensor* tensor = output;
+
+    while(tensor->consumer_num == 1)
+    {
+        struct ir_node* node = get_ir_graph_node(graph, tensor->consumer[0]);
+
+        if(node->op.op_type == OP_CONV)
+        {
+            struct conv_param* param = ( struct conv_param* )node->op.param_mem;
+
+            return param->stream ? 0 : -1;
+        }
+
+        if(node->op.op_type == OP_FC)
+        {
+            struct ir_tensor* weight = get_ir_graph_tensor(graph, node->input_tensors[1]);
+
+            if(weight->dims[1] % row_size)
+                return -1;
+
+            return weight->dims[1] / row_size;
+        }
+
+        if(!node->op.same_shape)
+            break;
+
+        tensor = get_ir_graph_tensor(graph, node->output_tensors[0]);
+    }
+
+    return -1;
+}
+
+static int infer_stream_shape(struct ir_node* node, struct ir_tensor* input, struct ir_tensor* output)
+{
+    struct ir_graph* graph = node->graph;
+    struct conv_param* conv_param = ( struct conv_param* )(node->op.param_mem);
+
+    if(graph->graph_layout != TENGINE_LAYOUT_NHWC || conv_param->pad_h0 != 0 || conv_param->pad_h1 != 0 ||
+       conv_param->dilation_h != 1 || conv_param->stride_h > conv_param->kernel_h)
+    {
+        TLOG_ERR("stream convolution: needs NHWC, no pad and dilation on h, and stride_h <= kernel_h\n");
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    int w = input->dims[2];
+    int out_w = (w - conv_param->dilation_w * (conv_param->kernel_w - 1) - 1 + conv_param->pad_w0 +
+                 conv_param->pad_w1) / conv_param->stride_w + 1;
+    int out_c = conv_param->output_channel;
+
+    int window = get_stream_window(graph, output, out_w * out_c);
+
+    if(window < 0)
+    {
+        TLOG_ERR("stream convolution: output must go to a stream convolution or a fc\n");
+        set_tengine_errno(EINVAL);
+        return -1;
+    }
+
+    conv_param->stream_window = window;
+
+    /*
+     * at most kernel_h - 1 rows are left in the history, so the new input rows
+     * never make more than ceil(in_h / stride_h) output rows
+     */
+    int dims[4];
+
+    dims[0] = input->dims[0];
+    dims[1] = window ? window : (input->dims[1] + conv_param->stride_h - 1) / conv_param->stride_h;
+    dims[2] = out_w;
+    dims[3] = out_c;
+
+    set_ir_tensor_shape(output, dims, 4);
+
+    return 0;
+}
 
 static int infer_shape(struct ir_node* node)
 {
@@ -44,6 +127,9 @@ static int infer_shape(struct ir_node* node)
 
     struct conv_param* conv_param = ( struct conv_param* )(node->op.param_mem);
 
+    if(conv_param->stream)
+        return infer_stream_shape(node, input, output);
+
     int n = input->dims[0];
     int h, w;
 
@@ -167,6 +253,8 @@ static int init_op(struct ir_op* op)
     conv_param->output_channel = 64;
     conv_param->group = 1;
     conv_param->activation = -1;
+    conv_param->stream = 0;
+    conv_param->stream_window = 0;
 
     op->param_mem = conv_param;
     op->param_size = sizeof(struct conv_param);
@@ -30,6 +30,7 @@
 #include "tengine_errno.h"
 #include "tengine_log.h"
 #include "tengine_op.h"
+#include "op/fc_param.h"
 
 static int infer_shape(struct ir_node* node)
 {
@@ -66,18 +67,36 @@ static int infer_shape(struct ir_node* node)
 
 static int init_op(struct ir_op* op)
 {
+    struct fc_param* fc_param = ( struct fc_param* )sys_malloc(sizeof(struct fc_param));
+
+    if(fc_param == NULL)
+    {
+        set_tengine_errno(ENOMEM);
+        return -1;
+    }
+
+    fc_param->activation = -1;
+
+    op->param_mem = fc_param;
+    op->param_size = sizeof(struct fc_param);
     op->same_shape = 0;
     op->infer_shape = infer_shape;
+
     return 0;
 }
 
+static void release_op(struct ir_op* op)
+{
+    sys_free(op->param_mem);
+}
+
 static int register_fc_op(void* arg)
 {
     struct op_method m;
 
     m.op_version = 1;
     m.init_op = init_op;
-    m.release_op = NULL;
+    m.release_op = release_op;
     m.access_param_entry = NULL;
 
     return register_op(OP_FC, OP_FC_NAME, &m);
@@ -23,6 +23,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 #include "sys_port.h"
@@ -64,23 +65,32 @@ static int infer_shape(struct ir_node* node)
 //        dims[3] = output->dims[3];
 //        set_ir_tensor_shape(output, dims, 4);
     
-        static int out_h = 0 ;
         int dims[4];
-        dims[0] = output->dims[0];
+        dims[0] = input->dims[0];
         dims[2] = output->dims[2];
      
-        if(out_h > 8 ){
-            dims[1] = 10;
+        if(mv_param->fed_rows > MV_FLAG_WARMUP_ROWS ){
+            dims[1] = MV_FLAG_ROWS;
         }
         else{
-            out_h += input->dims[1] ; 
-            dims[1] = 8;
+            mv_param->fed_rows += input->dims[1] ; 
+            dims[1] = MV_FLAG_WARMUP_ROWS;
         }
         
         dims[3] = output->dims[3];
         set_ir_tensor_shape(output, dims, 4);        
 
     }
+    else if(output->dims[0] != input->dims[0])
+    {
+        /* each batch lane moves its own rows */
+        int dims[MAX_SHAPE_DIM_NUM];
+
+        memcpy(dims, output->dims, sizeof(int) * output->dim_num);
+        dims[0] = input->dims[0];
+
+        set_ir_tensor_shape(output, dims, output->dim_num);
+    }
         
     int ele_num = output->dims[1]*(output->dims[2])*(output->dims[3]);
     mv_param->buffer_out_size = ele_num ;
@@ -104,9 +114,9 @@ static int init_op(struct ir_op* op)
 		mv_param->mv_size = 0 ;
 		mv_param->current_buffer_size = 0 ;
 		mv_param->buffer_out_size = 0 ;	
-		mv_param->buffer = NULL ; 
         mv_param->tmp_buffer_out_size = 0 ;
 		mv_param->flag = 0 ;
+		mv_param->fed_rows = 0 ;
 
     op->param_mem = mv_param;
     op->param_size = sizeof(struct mv_param);
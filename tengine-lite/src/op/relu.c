@@ -37,7 +37,7 @@ static int infer_shape(struct ir_node* node)
     struct ir_tensor* input = get_ir_graph_tensor(graph, node->input_tensors[0]);
     struct ir_tensor* output = get_ir_graph_tensor(graph, node->output_tensors[0]);
         
-    memcpy(output->dims, input->dims, sizeof(int16_t) * input->dim_num);
+    set_ir_tensor_shape(output, input->dims, input->dim_num);
 
     return 0;
 }
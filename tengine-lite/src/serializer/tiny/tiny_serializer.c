@@ -358,6 +358,8 @@ static int load_op_conv(struct ir_node* ir_node, struct tiny_node* tiny_node)
     conv_param->stride_w = tiny_param->stride_w;
     conv_param->pad_h0 = conv_param->pad_h1 = tiny_param->pad_h;
     conv_param->pad_w0 = conv_param->pad_w1 = tiny_param->pad_w;
+    conv_param->stream = tiny_param->stream;
+    conv_param->activation = tiny_param->activation;
 
     /* input channel and output channel */
     const struct tiny_tensor* weight = tiny_node->input[1];
@@ -41,6 +41,7 @@ const char* label_file = "./models/synset_words.txt";
 const float channel_mean[3] = {104.007, 116.669, 122.679};
 
 int repeat_count = 1;
+int num_thread = 1;
 
 unsigned long get_cur_time(void)
 {
@@ -104,13 +105,16 @@ int main(int argc, char* argv[])
 {
     int res;
 
-    while((res = getopt(argc, argv, "r:")) != -1)
+    while((res = getopt(argc, argv, "r:t:")) != -1)
     {
         switch(res)
         {
             case 'r':
                 repeat_count = strtoul(optarg, NULL, 10);
                 break;
+            case 't':
+                num_thread = strtoul(optarg, NULL, 10);
+                break;
 
             default:
                 break;
@@ -168,7 +172,7 @@ int main(int argc, char* argv[])
     std::cout << "PRERUN NOW ....\n";
 
     /* run the graph */
-    int ret_prerun = prerun_graph(graph);
+    int ret_prerun = prerun_graph_multithread(graph, num_thread);
 
     if(ret_prerun < 0)
     {
@@ -181,7 +185,7 @@ int main(int argc, char* argv[])
     run_graph(graph, 1);
 
     // benchmark start here
-    printf("REPEAT COUNT= %d\n", repeat_count);
+    printf("REPEAT COUNT= %d, THREADS= %d\n", repeat_count, num_thread);
 
     unsigned long start_time = get_cur_time();
 
@@ -125,6 +125,9 @@ struct tiny_conv_param
         6, relu6
     */
     int8_t activation;
+
+    /* 1, rows arrive in chunks along h: the engine keeps the history (no move node needed) */
+    uint8_t stream;
 };
 
 struct tiny_move_param
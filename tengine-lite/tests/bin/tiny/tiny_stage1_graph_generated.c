@@ -0,0 +1,229 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * The always-on first stage in front of the speech model of tiny_graph_generated.c: one conv
+ * and one fc, on the same q7 mfcc rows. Output 1 is the likelihood of a keyword, output 0 the
+ * rest, out of 128. The conv filters are a subset of the first conv of the speech model and
+ * the fc is fitted on the keywords it detects, see Scripts/stage1_distill.c, which writes
+ * tiny_stage1_param_generated.h.
+ */
+
+#include <stdio.h>
+
+#include "tiny_graph.h"
+#include "tiny_stage1_param_generated.h"
+
+#define STAGE1_INPUT_DIM_W      (10)
+#define STAGE1_CONV_KERNEL_DIM_H (10)
+#define STAGE1_CONV_KERNEL_STRIDE_H (2)
+#define STAGE1_CONV_OUTPUT_DIM_H (4)
+#define STAGE1_OUT_DIM          (2)
+
+/* the memmove node: the rows of the previous run, then the 8 new ones */
+static const struct tiny_tensor stage1_move_0_input = {
+    .dims = {1, 8, STAGE1_INPUT_DIM_W, 1},
+    .dim_num = 4,
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_INPUT,
+    .data = NULL,
+};
+
+static const struct tiny_tensor stage1_move_0_output = {
+    .dim_num = 4,
+    .dims = {1, 16, STAGE1_INPUT_DIM_W, 1},
+    .shift = STAGE1_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_move_param stage1_move_0_param = {
+    .start_mv_addr = (STAGE1_CONV_KERNEL_DIM_H - STAGE1_CONV_KERNEL_STRIDE_H) * STAGE1_INPUT_DIM_W,
+    .keep_size = (STAGE1_CONV_KERNEL_DIM_H - STAGE1_CONV_KERNEL_STRIDE_H) * STAGE1_INPUT_DIM_W,
+    .buffer_size = 160,
+    .current_buf_size = 0,
+    .flag = 0,
+};
+
+static const struct tiny_node stage1_move_0_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_MOVE,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &stage1_move_0_param,
+    .input = {&stage1_move_0_input, },
+    .output = &stage1_move_0_output,
+};
+
+/* the conv node, the layout of the weight is the one of conv_0 */
+static const struct tiny_tensor stage1_conv_0_weight = {
+    .dim_num = 4,
+    .dims = {STAGE1_CONV_KERNEL_DIM_H, STAGE1_INPUT_DIM_W, 1, STAGE1_CONV_KERNEL_C},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = stage1_conv_0_weight_data,
+};
+
+static const struct tiny_tensor stage1_conv_0_bias = {
+    .dim_num = 1,
+    .dims = {STAGE1_CONV_KERNEL_C},
+    .shift = STAGE1_CONV_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = stage1_conv_0_bias_data,
+};
+
+static const struct tiny_tensor stage1_conv_0_output = {
+    .dim_num = 4,
+    .dims = {1, STAGE1_CONV_OUTPUT_DIM_H, 1, STAGE1_CONV_KERNEL_C},
+    .shift = STAGE1_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_conv_param stage1_conv_0_param = {
+    .kernel_h = STAGE1_CONV_KERNEL_DIM_H,
+    .kernel_w = STAGE1_INPUT_DIM_W,
+    .stride_h = STAGE1_CONV_KERNEL_STRIDE_H,
+    .stride_w = 1,
+    .pad_h = NN_PAD_VALID,
+    .pad_w = NN_PAD_VALID,
+    .activation = -1,
+};
+
+static const struct tiny_node stage1_conv_0_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_CONV,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &stage1_conv_0_param,
+    .input = {&stage1_move_0_output, &stage1_conv_0_weight, &stage1_conv_0_bias},
+    .output = &stage1_conv_0_output,
+};
+
+/* the relu node */
+static const struct tiny_tensor stage1_relu_0_output = {
+    .dim_num = 4,
+    .dims = {1, STAGE1_CONV_OUTPUT_DIM_H, 1, STAGE1_CONV_KERNEL_C},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node stage1_relu_0_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&stage1_conv_0_output},
+    .output = &stage1_relu_0_output,
+};
+
+/* the fc node: row 1 is the keyword logit, row 0 its negation */
+static const struct tiny_tensor stage1_fc_1_weight = {
+    .dim_num = 2,
+    .dims = {STAGE1_OUT_DIM, STAGE1_CONV_OUTPUT_DIM_H * STAGE1_CONV_KERNEL_C},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = stage1_fc_1_weight_data,
+};
+
+static const struct tiny_tensor stage1_fc_1_bias = {
+    .dim_num = 1,
+    .dims = {STAGE1_OUT_DIM},
+    .shift = STAGE1_FC_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = stage1_fc_1_bias_data,
+};
+
+static const struct tiny_tensor stage1_fc_1_output = {
+    .dim_num = 2,
+    .dims = {1, STAGE1_OUT_DIM},
+    .shift = STAGE1_FC_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node stage1_fc_1_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_FC,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&stage1_relu_0_output, &stage1_fc_1_weight, &stage1_fc_1_bias},
+    .output = &stage1_fc_1_output,
+};
+
+/* SoftMax node */
+static const struct tiny_tensor stage1_softmax_2_output = {
+    .dim_num = 2,
+    .dims = {1, STAGE1_OUT_DIM},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node stage1_softmax_2_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_SOFTMAX,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&stage1_fc_1_output},
+    .output = &stage1_softmax_2_output,
+};
+
+/* the graph node list */
+static const struct tiny_node* stage1_node_list[] = {
+    &stage1_move_0_node, &stage1_conv_0_node, &stage1_relu_0_node, &stage1_fc_1_node, &stage1_softmax_2_node,
+};
+
+static const struct tiny_graph stage1_graph = {
+    .name = "speech model stage 1",
+    .tiny_version = NN_TINY_VERSION_1,
+    .nn_id = 0xdeadbeb0,
+    .create_time = 0,
+    .layout = NN_LAYOUT_NHWC,
+    .node_num = sizeof(stage1_node_list) / sizeof(void*),
+    .node_list = stage1_node_list,
+};
+
+const struct tiny_graph* get_tiny_stage1_graph(void)
+{
+    return &stage1_graph;
+}
+
+void free_tiny_stage1_graph(const struct tiny_graph* tiny_graph)
+{
+    /* NOTHING NEEDS TO DO */
+}
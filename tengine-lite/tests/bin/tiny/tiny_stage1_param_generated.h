@@ -0,0 +1,24 @@
+/*
+ * Generated by Scripts/stage1_distill.c, label score 24, keywords from wakeup.wav
+ * conv filters of conv_0: 71 60 63 40 80 78 91 28 17 77 8 74 21 51 31 25
+ */
+
+#ifndef __TINY_STAGE1_PARAM_GENERATED_H__
+#define __TINY_STAGE1_PARAM_GENERATED_H__
+
+#define STAGE1_CONV_KERNEL_C 16
+#define STAGE1_CONV_BIAS_LSHIFT 2
+#define STAGE1_CONV_OUTPUT_RSHIFT 6
+#define STAGE1_FC_BIAS_LSHIFT 4
+#define STAGE1_FC_OUTPUT_RSHIFT 10
+#define STAGE1_CONV_W_0 {-7, -3, -12, -10, -12, -17, -15, -4, 5, 1, -22, -20, 13, -3, -14, -16, 2, -19, 8, -4, -7, -20, 20, 8, -8, -13, 18, -25, 14, -5, 2, -24, 16, 21, 17, 1, 26, -11, 11, 1, 7, -10, 4, 16, 36, 6, 16, 7, 11, -5, 12, 5, -1, -2, 46, 19, 4, 25, 11, -4, 3, 13, -8, -4, 44, 26, 5, 27, 14, 17, -2, 5, -6, -13, 20, 13, 10, 17, 7, 21, 1, -3, -15, 8, 10, 4, 24, 4, 5, 34, 4, -6, 1, 33, 14, 4, 23, 15, 3, 48, -4, -11, 7, 10, 0, -13, 20, -6, 43, -2, -9, 6, 2, 12, 7, -3, 1, -6, 12, 20, -8, 11, -4, -11, -13, 8, -8, -10, -18, 69, -5, -1, 1, -31, -17, 17, -4, -10, 0, 45, 9, 1, -1, -33, 1, 26, -10, -17, 15, 8, 7, 0, -7, -27, 24, 13, -4, -39, 1, 39, 4, 0, -13, -2, 44, -17, -23, -9, 22, 40, 5, 1, -14, 5, 18, -3, -14, -6, 39, 28, 4, -1, -7, 14, 23, -20, -34, 1, 18, -10, 3, 0, 0, 25, 1, -11, -19, 17, -7, -37, 20, -1, -6, -5, -2, -2, 10, -6, -5, 4, 24, 1, 2, 3, 6, 1, 11, -9, 9, 2, 12, 0, -2, 0, 5, 5, 7, -16, 2, 0, 17, -11, 4, -2, 3, 1, 3, -9, 1, 1, 14, -9, 7, -2, -6, -3, 0, -1, 0, 0, 10, -3, 12, 5, -7, -7, 2, 4, 4, 1, -5, 4, 5, 13, -6, -8, -4, 7, -4, 5, -9, 8, -4, 3, 1, -5, -4, 6, -6, -1, -43, 8, -15, -9, 6, 4, -15, 10, -3, 7, -40, 13, -20, -13, 4, 10, -23, 13, -2, 8, -2, 1, 5, -12, -4, 14, -4, 6, 23, 10, -4, 0, 0, -5, -1, 17, -16, 13, 23, 9, 4, 9, -9, -16, 3, 15, 0, 14, 19, 2, 13, 10, -31, -26, -14, 5, 27, 28, 1, -8, 18, -9, -35, -8, 4, 10, 30, 14, -19, -11, 14, -20, -8, 4, 7, 1, 23, -9, -5, 8, 2, -2, 15, 8, 4, -5, -12, -18, 4, 13, -12, 19, 14, 13, -4, -11, -14, -23, -12, -15, -13, 5, 26, 24, 2, -15, -24, -16, -20, -25, -15, -11, 17, 27, -4, -14, -5, -14, -23, -7, 16, 2, -23, -19, -1, -2, 11, 4, 1, 4, 11, 31, -10, -16, -6, -3, -7, 10, 2, -12, -12, 31, 33, 11, -7, 7, -18, -11, -11, -25, -33, -20, 53, 29, 2, 23, 10, -12, -7, -13, -12, -56, 30, 26, 4, 13, 28, 11, 1, 9, 5, -34, -9, 13, -4, -11, 8, 23, 11, 18, 5, 4, -33, -4, 4, -21, -13, 10, 12, 14, 8, 24, -25, -15, -1, -12, -12, -4, 3, 3, 9, 17, -11, -15, -4, 1, 1, -11, 0, -3, 9, 4, -4, -12, 2, 0, -3, 0, 4, -4, 17, -14, 13, -2, -6, 9, -11, 5, -2, -3, 20, -31, 22, -10, -21, 22, -14, -8, 7, -5, 18, -22, 15, -14, -21, 23, -13, -6, 1, -10, 9, -3, -1, -9, -5, 5, -18, 7, -8, -14, 2, 15, -7, 4, -5, -4, -20, 4, -5, -8, -4, 18, -1, 24, -3, -18, -4, -5, 6, -4, -6, 16, 2, 11, 1, -19, 13, -4, 19, -11, -1, 3, -5, 11, 4, -7, 25, -1, 21, -9, -19, 4, -10, 10, 3, -4, 27, 14, 3, -2, -33, 2, -10, 2, 5, -2, 7, 16, 6, 9, -18, 4, -10, 5, -3, 1, -5, 6, 18, 6, -14, 5, -14, 10, -3, -1, -1, -4, 16, 12, -7, 8, -16, 11, -12, 5, -6, 1, -3, 21, -4, 14, -15, 15, -4, -4, -9, -1, -7, 3, 3, 3, -11, 8, -4, 2, -6, -8, -8, 11, 3, 4, -8, 10, -10, 5, -10, 4, -14, 20, 9, -4, 1, -1, -1, -3, 1, 4, -3, 5, 6, 5, -5, -7, -10, -4, -2, -6, -5, -7, 8, 13, -6, -7, -1, -9, -7, -12, -4, 4, 23, -16, 21, -9, 22, -8, 10, 7, 17, -5, 3, 20, -5, 0, -12, -4, -2, 4, -6, 4, 6, -3, -4, 3, -3, -9, -2, 9, -5, 1, 9, -53, 1, 35, 1, -2, 1, 2, -2, -4, -11, -67, 11, 59, -9, 9, 13, 7, -5, 3, -32, -13, 19, 28, -2, 1, 16, -2, 6, 10, -11, 49, 7, -31, 6, 9, 1, 1, -2, 1, 13, 46, -17, -53, 24, 17, -3, -3, -10, -10, 17, 12, -18, -34, 21, 18, -4, -3, -8, -12, 7, 1, -7, -5, 3, 0, -8, -11, 8, -10, 3, 5, 3, 10, 0, -16, -7, -4, 15, -8, -1, 15, 7, -10, 0, -7, -2, 0, 5, -8, -12, 17, 1, 9, 8, -23, -9, 5, -1, 1, -8, 5, 12, 9, 16, -32, 3, 6, 4, -1, -22, 3, 29, -7, 18, -26, -7, 9, 12, -5, -10, -2, 39, -11, 4, -6, -6, -5, 4, -9, -3, -6, 18, -1, -4, 14, -13, -7, 0, -6, 7, -16, -16, 1, -6, 39, -9, -9, -12, 3, 13, -10, -45, 7, -7, 41, 2, -12, -11, 8, 24, 0, -37, -1, -14, 22, 17, -7, -10, 4, 15, 2, -16, 0, -14, -2, 6, -6, -4, 9, -2, 10, 16, -5, -35, -15, 20, -7, -1, -5, -7, 22, 29, 0, -37, -24, 4, 3, 21, 1, -8, 10, 4, 4, 4, -6, 7, 18, 16, -6, 5, -19, -32, 4, 37, 26, 2, 12, 6, -5, 14, -36, -43, 3, 51, 40, 7, 10, -4, 1, 9, -19, -16, 2, 14, 9, -2, 7, -5, 14, -5, 14, 10, 12, -9, -22, -11, -10, -3, 5, -3, 22, 13, 10, -2, -20, 0, -4, -6, -4, 1, 8, 18, 12, -3, -12, -4, -9, -2, -8, 1, 1, 22, 9, -10, -9, -12, -5, 5, -10, -4, 7, -4, 13, -10, -14, 0, 8, 3, -8, -5, 9, -2, 11, 5, -6, -10, -2, 6, -3, -15, 8, 5, 12, 15, 8, -15, -5, 4, 11, -10, -7, 11, 10, 20, 19, 4, -10, 2, 14, -1, -46, 5, -1, 6, 19, 18, -3, -2, 11, 19, -53, -15, -25, -11, 11, 35, 11, 5, 13, 19, 3, -16, -31, -16, -15, 5, 6, 13, 2, 3, 44, -7, -4, -5, -24, -13, -15, 3, -3, -4, 35, 9, 9, 6, -12, -5, -17, 3, 2, -6, 9, -6, 5, -5, 4, 3, 0, -8, -6, 1, -5, 15, -1, -1, 2, 5, 0, -3, 7, 3, -5, 12, -3, 0, -4, 9, 13, 1, 8, -1, 1, 7, -9, 2, 11, -7, 18, 5, -9, -3, 9, 11, -16, -6, 12, 5, 18, 12, -7, -1, 7, 6, -27, -10, 10, 2, 20, 10, -8, 0, 8, 7, -20, -12, 4, -4, 19, 4, 4, 3, 6, -2, -10, -15, -14, -7, 1, 2, -9, 1, 9, -6, -13, -9, -2, -12, -2, -12, -7, 0, 15, -8, 2, -10, -1, -4, -3, -8, 13, 7, -10, -3, -10, 12, -6, 24, -13, 11, 20, 15, 2, -24, -19, -4, -2, 5, 4, -14, 5, 19, -10, -13, -28, -17, -8, 17, 14, -12, 4, 17, -20, -6, -16, -16, -5, 23, 18, 7, 11, 13, -10, -8, -15, 1, -14, 15, 2, 3, 11, -1, 18, -12, 2, 16, 1, -7, 6, 7, -8, -12, 18, 0, 11, 15, 5, -24, -9, -11, -8, -14, 6, 16, 10, 10, 3, -25, -17, -24, -10, -3, -4, 23, 14, -4, 8, -24, -10, -18, 1, -4, -15, 17, 6, 6, 6, -4, -6, -11, 12, -4, -11, 9, 0, 18, -1, 13, 15, -1, 15, -15, 4, -8, 10, 10, -1, -6, 9, 11, -7, -4, -17, -10, 19, 31, 3, -3, 7, 12, -3, 27, -35, -13, 15, 23, 5, 14, 3, 6, 7, 25, -30, -10, -1, 2, 13, 6, 3, 10, 24, -24, 3, 17, -16, -17, 14, -10, -13, 12, 19, -26, 41, 28, -23, -25, 7, -27, -15, 5, 15, 1, 41, 6, -21, -21, -11, -7, -17, -10, -5, 13, 7, -17, -1, 0, -18, 20, 0, -20, -13, 8, -6, -20, 13, 0, -18, 30, 17, -18, -4, 2, -2, -4, 9, 1, -9, 17, 17, -8, 2, -1, 31, -22, 6, -22, -4, -2, -7, 0, -8, -8, 51, -37, 12, -4, 4, -4, -6, -3, -5, -10, 13, -40, 9, 19, 24, 8, -8, 14, -10, -9, -38, -16, 1, 36, 27, 17, 7, 15, 7, 1, -51, 33, -18, 15, 10, 5, 8, 9, 10, 7, -28, 47, -29, -16, -16, -7, 2, -1, 15, 11, -3, 43, -21, -20, -25, -5, -10, -5, 0, 8, 0, 24, -2, -8, -19, -4, -3, -6, 0, 4, 1, 10, 9, -2, -15, -3, 0, -1, 3, 4, 7, -10, 9, -2, -14, -1, 11, 4, -6, -2, 9, 4, -6, -26, -8, 17, -9, -5, 0, 1, -7, 34, 12, -48, -16, -7, 1, -8, 5, -3, -12, 51, 33, -41, -17, -27, 0, 1, 2, -6, -9, 38, 24, 0, -11, -35, -9, 8, -4, -9, 2, -5, -11, 46, 0, -19, -14, 13, -10, -3, 8, -41, -43, 68, 2, 0, 7, 17, -4, 5, 10, -45, -39, 50, 12, 21, 8, -11, 3, 9, 7, -30, -16, 9, 6, 21, 9, -15, 0, 6, -2, -7, 6, -18, -3, 16, 8, -1, 6, 3, -9, 14, 14, -13, 2, 4, 7, 10, 0, }
+#define STAGE1_CONV_B_0 {1, -12, 31, 2, 8, -4, 28, -31, -19, 35, -22, 12, 11, 3, -19, 6, }
+#define STAGE1_FC_W_0 {107, -52, -92, -36, -27, -53, -22, -19, -43, -9, -13, -20, -37, -13, -26, -33, 96, -48, -83, -35, -45, -40, -24, -31, -56, -15, -20, -19, -29, -15, -33, -37, 64, -47, -74, -28, -44, -35, -25, -70, -80, -13, -24, -20, -28, -21, -47, -49, 77, -63, -58, -21, -47, -30, -36, -55, -110, -11, -43, -32, -25, -21, -48, -65, -107, 52, 92, 36, 27, 53, 22, 19, 43, 9, 13, 20, 37, 13, 26, 33, -96, 48, 83, 35, 45, 40, 24, 31, 56, 15, 20, 19, 29, 15, 33, 37, -64, 47, 74, 28, 44, 35, 25, 70, 80, 13, 24, 20, 28, 21, 47, 49, -77, 63, 58, 21, 47, 30, 36, 55, 110, 11, 43, 32, 25, 21, 48, 65, }
+#define STAGE1_FC_B_0 {122, -122, }
+
+static const signed char stage1_conv_0_weight_data[] = STAGE1_CONV_W_0;
+static const signed char stage1_conv_0_bias_data[] = STAGE1_CONV_B_0;
+static const signed char stage1_fc_1_weight_data[] = STAGE1_FC_W_0;
+static const signed char stage1_fc_1_bias_data[] = STAGE1_FC_B_0;
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * the fixture of the tiny graph tests: their inputs, the graphs they run and compare against.
+ */
+
+#ifndef __TINY_TEST__
+#define __TINY_TEST__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_graph.h"
+
+/* q7 values in [-64, 63]: the same seed gives the same stream of inputs */
+static inline void fill_input(signed char* buf, int size, unsigned int* seed)
+{
+    for(int i = 0; i < size; i++)
+    {
+        *seed = *seed * 1103515245 + 12345;
+        buf[i] = ( signed char )((*seed >> 16) & 0x7f) - 64;
+    }
+}
+
+/*
+ * creates the tiny graph in context (NULL: the default one) with batch inputs per run, preruns it
+ * on num_thread threads and binds a new input buffer of *input_size bytes to it.
+ * Released with release_tiny_graph()
+ */
+static inline graph_t create_tiny_graph(context_t context, const struct tiny_graph* tiny_graph, int batch,
+                                        int num_thread, signed char** input, int* input_size)
+{
+    graph_t graph = create_graph(context, "tiny", ( void* )tiny_graph);
+
+    if(graph == NULL)
+        return NULL;
+
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    int dims[4];
+
+    get_tensor_shape(input_tensor, dims, 4);
+    dims[0] = batch;
+
+    if(set_tensor_shape(input_tensor, dims, 4) < 0 || prerun_graph_multithread(graph, num_thread) < 0)
+    {
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    *input_size = get_tensor_buffer_size(input_tensor);
+    *input = malloc(*input_size);
+
+    set_tensor_buffer(input_tensor, *input, *input_size);
+
+    return graph;
+}
+
+static inline void release_tiny_graph(graph_t graph, signed char* input)
+{
+    postrun_graph(graph);
+    destroy_graph(graph);
+    free(input);
+}
+
+/* 0 when the output of the last run of graph is the one of output_size bytes */
+static inline int compare_output(graph_t graph, const void* output, int output_size)
+{
+    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+
+    if(get_tensor_buffer_size(output_tensor) != output_size ||
+       memcmp(get_tensor_buffer(output_tensor), output, output_size))
+        return -1;
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs the tiny graph and its aot plan side by side and compares the outputs of every run.
+ * The shared memory of the plan must hold the scratch of the aot conv and fc kernels, whatever
+ * node ops the graph ran with; the convs over the whole input width run the conv1d kernel, which
+ * needs none. The plans of the app come from Scripts/aot_plan_gen.c.
+ *
+ * test_tiny_aot [run_num]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tengine_aot.h"
+#include "tiny_test.h"
+
+/*
+ * the im2col buffer of arm_convolve_HWC_q7_nonsquare(), the vec_buffer of arm_fully_connected_q7().
+ * conv1d_num counts the convs of the conv1d kernel
+ */
+static int get_kernel_shared_mem_size(const struct tiny_graph* tiny_graph, int* conv1d_num)
+{
+    int size = 0;
+
+    *conv1d_num = 0;
+
+    for(int i = 0; i < tiny_graph->node_num; i++)
+    {
+        const struct tiny_node* node = tiny_graph->node_list[i];
+        int node_size = 0;
+
+        if(node->op_type == NN_OP_CONV)
+        {
+            const struct tiny_conv_param* param = ( const struct tiny_conv_param* )node->op_param;
+
+            if(!param->stream && param->pad_w == 0 && param->kernel_w == node->input[0]->dims[2])
+                (*conv1d_num)++;
+            else
+                node_size = 2 * node->input[0]->dims[3] * param->kernel_h * param->kernel_w * sizeof(short);
+        }
+        else if(node->op_type == NN_OP_FC)
+            node_size = node->input[1]->dims[1] * sizeof(short);
+
+        if(node_size > size)
+            size = node_size;
+    }
+
+    return size;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 40;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+    signed char* input;
+    int input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &input, &input_size);
+
+    if(graph == NULL)
+    {
+        printf("create/prerun tiny graph failed\n");
+        return -1;
+    }
+
+    void* plan;
+    int plan_size;
+
+    /* must be built before the first run: the plan records the streaming state as prerun left it */
+    if(build_aot_plan(graph, &plan, &plan_size) < 0)
+    {
+        printf("build aot plan failed: %d\n", get_tengine_errno());
+        return -1;
+    }
+
+    int conv1d_num;
+    int shared_mem_size = get_kernel_shared_mem_size(tiny_graph, &conv1d_num);
+
+    if((( struct aot_plan* )plan)->shared_mem_size != shared_mem_size)
+    {
+        printf("plan shared memory: %d bytes, the kernels need %d\n", (( struct aot_plan* )plan)->shared_mem_size,
+               shared_mem_size);
+        return -1;
+    }
+
+    const struct aot_step* steps = ( const struct aot_step* )(( char* )plan + (( struct aot_plan* )plan)->step_offset);
+
+    for(int i = 0; i < (( struct aot_plan* )plan)->step_num; i++)
+    {
+        if(steps[i].kernel == AOT_KERNEL_CONV1D_Q7)
+            conv1d_num--;
+    }
+
+    if(conv1d_num != 0)
+    {
+        printf("plan conv1d steps: %d off the convs over the whole input width\n", -conv1d_num);
+        return -1;
+    }
+
+    tensor_t input_tensor = get_graph_input_tensor(graph, 0, 0);
+    float input_scale = 1.0f;
+    int input_zero_point = 0;
+    int input_shift = 0;
+
+    if(get_tensor_quant_param(input_tensor, &input_scale, &input_zero_point, 1) == 1)
+    {
+        while((1 << input_shift) < input_scale)
+            input_shift++;
+    }
+
+    if((( struct aot_plan* )plan)->input_shift != input_shift)
+    {
+        printf("plan input shift: %d, the graph input has %d\n", (( struct aot_plan* )plan)->input_shift, input_shift);
+        return -1;
+    }
+
+    int arena_size = get_aot_arena_size(plan);
+    void* arena = malloc(arena_size);
+
+    aot_graph_t aot_graph = bind_aot_graph(plan, arena, arena_size);
+
+    if(aot_graph == NULL)
+    {
+        printf("bind aot graph failed\n");
+        return -1;
+    }
+
+    printf("plan: %d bytes, arena: %d bytes\n", plan_size, arena_size);
+
+    int aot_input_size, aot_output_size;
+    signed char* aot_input = get_aot_input_buffer(aot_graph, &aot_input_size);
+
+    if(aot_input_size != input_size)
+    {
+        printf("input size mismatch: %d vs %d\n", aot_input_size, input_size);
+        return -1;
+    }
+
+    unsigned int seed = 1;
+
+    for(int i = 0; i < run_num; i++)
+    {
+        fill_input(input, input_size, &seed);
+        memcpy(aot_input, input, input_size);
+
+        if(run_graph(graph, 1) < 0 || run_aot_graph(aot_graph) < 0)
+        {
+            printf("run %d failed\n", i);
+            ret = -1;
+            break;
+        }
+
+        signed char* aot_output = get_aot_output_buffer(aot_graph, &aot_output_size);
+
+        if(compare_output(graph, aot_output, aot_output_size) < 0)
+        {
+            printf("run %d: aot output mismatch\n", i);
+            ret = -1;
+            break;
+        }
+    }
+
+    free(arena);
+    free_aot_plan(plan);
+
+    release_tiny_graph(graph, input);
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,179 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs the tiny graph on the async scheduler with two input buffers: while one run infers,
+ * the next input is prepared in the other buffer. Every output must be the same as the one of
+ * the tiny graph on the sync scheduler, which runs the same input meanwhile.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+int main(int argc, char* argv[])
+{
+    int run_num = 100;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+
+    context_t context = create_context("async", 1);
+    char sched_name[16];
+
+    if(set_context_attr(context, "scheduler", "async", sizeof("async")) < 0 ||
+       get_context_attr(context, "scheduler", sched_name, sizeof(sched_name)) < 0 || strcmp(sched_name, "async"))
+    {
+        printf("set async scheduler failed\n");
+        return -1;
+    }
+
+    signed char* sync_buf;
+    signed char* async_buf[2];
+    int input_size, async_input_size;
+
+    graph_t sync_graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &sync_buf, &input_size);
+    graph_t async_graph = create_tiny_graph(context, tiny_graph, 1, 1, &async_buf[0], &async_input_size);
+
+    if(sync_graph == NULL || async_graph == NULL || async_input_size != input_size)
+    {
+        printf("create/prerun tiny graphs failed\n");
+        return -1;
+    }
+
+    tensor_t async_input = get_graph_input_tensor(async_graph, 0, 0);
+    tensor_t async_output = get_graph_output_tensor(async_graph, 0, 0);
+    unsigned int seed = 1;
+    int poll_num = 0;
+
+    async_buf[1] = malloc(input_size);
+
+    fill_input(async_buf[0], input_size, &seed);
+
+    for(int i = 0; i < run_num; i++)
+    {
+        signed char* cur_buf = async_buf[i & 1];
+        signed char* next_buf = async_buf[(i + 1) & 1];
+
+        set_tensor_buffer(async_input, cur_buf, input_size);
+
+        if(run_graph(async_graph, 0) < 0)
+        {
+            printf("run %d failed\n", i);
+            ret = -1;
+            break;
+        }
+
+        /* a run in flight must be waited first */
+        if(i == 0 && run_graph(async_graph, 0) == 0)
+        {
+            printf("second run before wait is not rejected\n");
+            ret = -1;
+            break;
+        }
+
+        /* meanwhile: the reference run and the next input */
+        memcpy(sync_buf, cur_buf, input_size);
+
+        if(run_graph(sync_graph, 1) < 0)
+        {
+            printf("sync run %d failed\n", i);
+            ret = -1;
+            break;
+        }
+
+        fill_input(next_buf, input_size, &seed);
+
+        int wait_ret;
+
+        if(i & 1)
+        {
+            while((wait_ret = wait_graph(async_graph, 1)) == 0)
+                poll_num++;
+        }
+        else
+            wait_ret = wait_graph(async_graph, 0);
+
+        if(wait_ret != 1 || get_graph_exec_status(async_graph) != GRAPH_STAT_READY)
+        {
+            printf("wait run %d failed: %d\n", i, wait_ret);
+            ret = -1;
+            break;
+        }
+
+        if(compare_output(sync_graph, get_tensor_buffer(async_output), get_tensor_buffer_size(async_output)) < 0)
+        {
+            printf("run %d: async output mismatch\n", i);
+            ret = -1;
+            break;
+        }
+    }
+
+    printf("%d runs, %d polls\n", run_num, poll_num);
+
+    /* postrun must also be safe with a run in flight */
+    run_graph(async_graph, 0);
+
+    release_tiny_graph(sync_graph, sync_buf);
+    postrun_graph(async_graph);
+    destroy_graph(async_graph);
+
+    /* and destroy without postrun: the worker must be stopped before the graph is freed */
+    signed char* last_buf;
+
+    async_graph = create_tiny_graph(context, tiny_graph, 1, 1, &last_buf, &async_input_size);
+
+    if(async_graph == NULL)
+    {
+        printf("create/prerun tiny graph again failed\n");
+        ret = -1;
+    }
+    else
+    {
+        memcpy(last_buf, async_buf[0], input_size);
+        run_graph(async_graph, 0);
+        destroy_graph(async_graph);
+        free(last_buf);
+    }
+
+    destroy_context(context);
+    free_tiny_graph(tiny_graph);
+
+    free(async_buf[0]);
+    free(async_buf[1]);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
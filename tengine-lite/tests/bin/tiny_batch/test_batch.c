@@ -0,0 +1,170 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * runs several input streams as the lanes of one batched graph, and checks the output of each lane
+ * against a batch 1 graph fed the same stream. Both the tiny graph with move nodes and the one with
+ * stream convs are checked, and the time of one run of all the streams is reported for both ways.
+ *
+ * test_tiny_batch [run_num] [batch]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+extern const struct tiny_graph* get_tiny_stream_graph(void);
+
+static double get_ms(clock_t start)
+{
+    return (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static int test_batch(const char* name, const struct tiny_graph* tiny_graph, int run_num, int batch)
+{
+    signed char* input;
+    signed char* batch_input;
+    int input_size, batch_input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &input, &input_size);
+    graph_t batch_graph = create_tiny_graph(NULL, tiny_graph, batch, 1, &batch_input, &batch_input_size);
+
+    if(graph == NULL || batch_graph == NULL || batch_input_size != input_size * batch)
+    {
+        printf("%s: create/prerun graphs failed\n", name);
+        return -1;
+    }
+
+    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+    int output_size = get_tensor_buffer_size(output_tensor);
+
+    /* the reference: each stream fed alone to the batch 1 graph */
+    signed char* ref = malloc(( size_t )batch * run_num * output_size);
+    clock_t start = clock();
+    int ret = 0;
+
+    for(int b = 0; b < batch && ret == 0; b++)
+    {
+        unsigned int seed = b + 1;
+
+        for(int i = 0; i < run_num; i++)
+        {
+            fill_input(input, input_size, &seed);
+
+            if(run_graph(graph, 1) < 0)
+            {
+                printf("%s: stream %d run %d failed\n", name, b, i);
+                ret = -1;
+                break;
+            }
+
+            memcpy(ref + (( size_t )b * run_num + i) * output_size, get_tensor_buffer(output_tensor), output_size);
+        }
+
+        if(reset_graph(graph) < 0)
+            ret = -1;
+    }
+
+    double single_ms = get_ms(start);
+
+    tensor_t batch_output_tensor = get_graph_output_tensor(batch_graph, 0, 0);
+    unsigned int seeds[batch];
+
+    for(int b = 0; b < batch; b++)
+        seeds[b] = b + 1;
+
+    start = clock();
+
+    for(int i = 0; i < run_num && ret == 0; i++)
+    {
+        for(int b = 0; b < batch; b++)
+            fill_input(batch_input + b * input_size, input_size, &seeds[b]);
+
+        if(run_graph(batch_graph, 1) < 0 || get_tensor_buffer_size(batch_output_tensor) != output_size * batch)
+        {
+            printf("%s: batch run %d failed\n", name, i);
+            ret = -1;
+            break;
+        }
+
+        signed char* output = get_tensor_buffer(batch_output_tensor);
+
+        for(int b = 0; b < batch; b++)
+        {
+            if(memcmp(output + b * output_size, ref + (( size_t )b * run_num + i) * output_size, output_size))
+            {
+                printf("%s: run %d lane %d output mismatch\n", name, i, b);
+                ret = -1;
+                break;
+            }
+        }
+    }
+
+    double batch_ms = get_ms(start);
+
+    if(ret == 0)
+        printf("%s: %d streams x %d runs, batch 1: %.2f ms, batch %d: %.2f ms\n", name, batch, run_num, single_ms,
+               batch, batch_ms);
+
+    release_tiny_graph(graph, input);
+    release_tiny_graph(batch_graph, batch_input);
+
+    free(ref);
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 100;
+    int batch = 8;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    if(argc > 2)
+        batch = atoi(argv[2]);
+
+    if(batch < 1)
+    {
+        printf("batch should be positive\n");
+        return -1;
+    }
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+    int ret = test_batch("move graph", tiny_graph, run_num, batch);
+
+    if(ret == 0)
+        ret = test_batch("stream graph", get_tiny_stream_graph(), run_num, batch);
+
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,136 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * feeds the same stream of rows to a graph one chunk per run and to a copy of it several chunks
+ * per run, see set_graph_stream_chunks(). After each run of the copy, its outputs must be the ones
+ * of the first graph after the last chunk of that run. Done for the tiny graph with move nodes
+ * and for the one with stream convs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+#define MAX_CHUNK_NUM 4
+
+extern const struct tiny_graph* get_tiny_stream_graph(void);
+
+static int test_chunk(const char* name, const struct tiny_graph* tiny_graph, int run_num)
+{
+    signed char* input;
+    signed char* chunk_input;
+    int input_size, chunk_input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &input, &input_size);
+    graph_t chunk_graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &chunk_input, &chunk_input_size);
+
+    if(graph == NULL || chunk_graph == NULL)
+    {
+        printf("%s: create/prerun graphs failed\n", name);
+        return -1;
+    }
+
+    tensor_t chunk_output = get_graph_output_tensor(chunk_graph, 0, 0);
+
+    /* the chunks follow the one the tensor is bound to */
+    chunk_input = realloc(chunk_input, input_size * MAX_CHUNK_NUM);
+    set_tensor_buffer(get_graph_input_tensor(chunk_graph, 0, 0), chunk_input, input_size);
+
+    unsigned int seed = 1;
+    int ret = 0;
+
+    for(int i = 0; i < run_num && ret == 0; i++)
+    {
+        int chunk_num = i % MAX_CHUNK_NUM + 1;
+
+        /* half way, both graphs start over: no row of before may be left */
+        if(i == run_num / 2 && (reset_graph(graph) < 0 || reset_graph(chunk_graph) < 0))
+        {
+            printf("%s: reset graphs failed\n", name);
+            ret = -1;
+            break;
+        }
+
+        for(int j = 0; j < chunk_num && ret == 0; j++)
+        {
+            fill_input(input, input_size, &seed);
+            memcpy(chunk_input + j * input_size, input, input_size);
+
+            if(run_graph(graph, 1) < 0)
+                ret = -1;
+        }
+
+        if(ret < 0 || set_graph_stream_chunks(chunk_graph, chunk_num) < 0 || run_graph(chunk_graph, 1) < 0)
+        {
+            printf("%s: run %d failed\n", name, i);
+            ret = -1;
+            break;
+        }
+
+        if(compare_output(graph, get_tensor_buffer(chunk_output), get_tensor_buffer_size(chunk_output)) < 0)
+        {
+            printf("%s: run %d of %d chunks: output mismatch\n", name, i, chunk_num);
+            ret = -1;
+        }
+    }
+
+    /* the graph must take one chunk again once told so */
+    if(ret == 0 && (set_graph_stream_chunks(chunk_graph, 0) == 0 || set_graph_stream_chunks(chunk_graph, 1) < 0))
+    {
+        printf("%s: chunk number check failed\n", name);
+        ret = -1;
+    }
+
+    release_tiny_graph(graph, input);
+    release_tiny_graph(chunk_graph, chunk_input);
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 100;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    if(test_chunk("move", get_tiny_graph(), run_num) < 0)
+        ret = -1;
+
+    if(test_chunk("stream", get_tiny_stream_graph(), run_num) < 0)
+        ret = -1;
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,256 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs the convs of the speech model whose kernel covers the input width, the first 10x10 one
+ * and the Kx1 ones, each as a one node graph, which takes the conv1d kernel, and checks its
+ * outputs against arm_convolve_HWC_q7_nonsquare(), the im2col path, with and without a folded
+ * relu and with padding. Then times both: the conv node from the perf stats, the im2col path
+ * around the call, and prints the clock ticks per multiply accumulate, cycles on Cortex-M.
+ *
+ * test_tiny_conv1d [run_num]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_graph.h"
+
+#define BIAS_SHIFT 3
+#define OUT_SHIFT 9
+
+typedef signed char q7_t;
+typedef short q15_t;
+
+int arm_convolve_HWC_q7_nonsquare(const q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                  const uint16_t ch_im_in, const q7_t* wt, const uint16_t ch_im_out,
+                                  const uint16_t dim_kernel_x, const uint16_t dim_kernel_y, const uint16_t padding_x,
+                                  const uint16_t padding_y, const uint16_t stride_x, const uint16_t stride_y,
+                                  const q7_t* bias, const uint16_t bias_shift, const uint16_t out_shift, q7_t* Im_out,
+                                  const uint16_t dim_im_out_x, const uint16_t dim_im_out_y, q15_t* bufferA,
+                                  q7_t* bufferB);
+
+struct layer
+{
+    const char* name;
+    int in_h;
+    int in_w;
+    int in_c;
+    int out_c;
+    int kernel_h;
+    int stride_h;
+    int pad_h;
+    int activation;
+};
+
+/* FIRST_CONV to FOURTH_CONV of cnn.h, on the rows the move nodes give them, then odd shapes */
+static const struct layer layers[] = {
+    {"conv_0", 16, 10, 1, 96, 10, 2, 0, -1},     {"conv_1", 10, 1, 96, 80, 8, 2, 0, -1},
+    {"conv_2", 5, 1, 80, 72, 4, 1, 0, -1},       {"conv_3", 3, 1, 72, 64, 3, 2, 0, -1},
+    {"conv_0 pad", 16, 10, 1, 96, 10, 2, 1, 0},  {"conv_1 relu", 10, 1, 96, 80, 8, 2, 0, 0},
+    {"conv_2 pad", 5, 1, 80, 72, 4, 1, 1, 0},    {"odd rows", 7, 1, 12, 9, 3, 1, 0, -1},
+    {"odd width", 6, 3, 5, 7, 3, 1, 1, 0},
+};
+
+static void fill_random(q7_t* buf, int size, int range, unsigned int* seed)
+{
+    for(int i = 0; i < size; i++)
+    {
+        *seed = *seed * 1103515245 + 12345;
+        buf[i] = ( q7_t )((( int )((*seed >> 16) & 0x7fff) % range) - range / 2);
+    }
+}
+
+static int test_layer(const struct layer* l, int run_num, unsigned int* seed)
+{
+    int out_h = (l->in_h + 2 * l->pad_h - l->kernel_h) / l->stride_h + 1;
+    int row_size = l->in_w * l->in_c;
+    int weight_size = l->out_c * l->kernel_h * row_size;
+    int input_size = l->in_h * row_size;
+    int output_size = out_h * l->out_c;
+    long macs = ( long )output_size * l->kernel_h * row_size;
+
+    q7_t* weight = malloc(weight_size);
+    q7_t* bias = malloc(l->out_c);
+    q7_t* input = malloc(input_size);
+    q7_t* ref = malloc(output_size);
+    q15_t* buffer = malloc(sizeof(q15_t) * 2 * row_size * l->kernel_h);
+
+    fill_random(weight, weight_size, 256, seed);
+    fill_random(bias, l->out_c, 256, seed);
+
+    struct tiny_tensor input_tensor = {
+        .dims = {1, l->in_h, l->in_w, l->in_c}, .dim_num = 4, .data_type = NN_DT_Q7, .tensor_type = NN_TENSOR_INPUT};
+    struct tiny_tensor weight_tensor = {.dims = {l->kernel_h, l->in_w, l->in_c, l->out_c},
+                                        .dim_num = 4,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_CONST,
+                                        .data = weight};
+    struct tiny_tensor bias_tensor = {.dims = {l->out_c},
+                                      .dim_num = 1,
+                                      .shift = BIAS_SHIFT,
+                                      .data_type = NN_DT_Q7,
+                                      .tensor_type = NN_TENSOR_CONST,
+                                      .data = bias};
+    struct tiny_tensor output_tensor = {.dims = {1, out_h, 1, l->out_c},
+                                        .dim_num = 4,
+                                        .shift = OUT_SHIFT,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_VAR};
+    struct tiny_conv_param conv_param = {.kernel_h = l->kernel_h,
+                                         .kernel_w = l->in_w,
+                                         .stride_h = l->stride_h,
+                                         .stride_w = 1,
+                                         .pad_h = l->pad_h,
+                                         .pad_w = NN_PAD_VALID,
+                                         .activation = l->activation};
+    struct tiny_node conv_node = {.input_num = 3,
+                                  .output_num = 1,
+                                  .op_type = NN_OP_CONV,
+                                  .op_ver = NN_OP_VERSION_1,
+                                  .op_param = &conv_param,
+                                  .input = {&input_tensor, &weight_tensor, &bias_tensor},
+                                  .output = &output_tensor};
+    const struct tiny_node* node_list[] = {&conv_node};
+    struct tiny_graph tiny_graph = {.name = ( char* )l->name,
+                                    .tiny_version = NN_TINY_VERSION_1,
+                                    .layout = NN_LAYOUT_NHWC,
+                                    .node_num = 1,
+                                    .node_list = node_list};
+
+    graph_t graph = create_graph(NULL, "tiny", ( void* )&tiny_graph);
+    int cpu_isa = 0;
+    int ret = -1;
+
+    /* no x86 variant, which would outscore the conv1d kernel on a host */
+    if(graph == NULL || set_graph_attr(graph, "cpu_isa", &cpu_isa, sizeof(int)) < 0 || prerun_graph(graph) < 0)
+    {
+        printf("%s: create/prerun graph failed\n", l->name);
+        goto out;
+    }
+
+    set_tensor_buffer(get_graph_input_tensor(graph, 0, 0), input, input_size);
+
+    const q7_t* output = get_tensor_buffer(get_graph_output_tensor(graph, 0, 0));
+
+    for(int i = 0; i < 8; i++)
+    {
+        fill_random(input, input_size, 128, seed);
+
+        if(run_graph(graph, 1) < 0 ||
+           arm_convolve_HWC_q7_nonsquare(input, l->in_w, l->in_h, l->in_c, weight, l->out_c, l->in_w, l->kernel_h, 0,
+                                         l->pad_h, 1, l->stride_h, bias, BIAS_SHIFT, OUT_SHIFT, ref, 1, out_h, buffer,
+                                         NULL) != 0)
+        {
+            printf("%s: run failed\n", l->name);
+            goto out;
+        }
+
+        for(int j = 0; j < output_size; j++)
+        {
+            q7_t expected = l->activation == 0 && ref[j] < 0 ? 0 : ref[j];
+
+            if(output[j] != expected)
+            {
+                printf("%s: output %d is %d, expected %d\n", l->name, j, output[j], expected);
+                goto out;
+            }
+        }
+    }
+
+    /* the conv node alone, from the perf stats */
+    struct perf_info* perf;
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_ENABLE) < 0)
+        goto out;
+
+    for(int i = 0; i < run_num; i++)
+        run_graph(graph, 1);
+
+    if(get_graph_perf_stat(graph, &perf, 1) != 1 || perf->count == 0)
+    {
+        printf("%s: no perf record\n", l->name);
+        goto out;
+    }
+
+    uint32_t start = read_perf_clock();
+
+    for(int i = 0; i < run_num; i++)
+        arm_convolve_HWC_q7_nonsquare(input, l->in_w, l->in_h, l->in_c, weight, l->out_c, l->in_w, l->kernel_h, 0,
+                                      l->pad_h, 1, l->stride_h, bias, BIAS_SHIFT, OUT_SHIFT, ref, 1, out_h, buffer, NULL);
+
+    double im2col = ( double )(read_perf_clock() - start) / run_num;
+    double conv1d = ( double )perf->total_time / perf->count;
+
+    printf("%-12s %dx%dx%dx%d, %d rows, %ld MACs: im2col %.1f ticks, %.4f/MAC; conv1d %.1f ticks, %.4f/MAC", l->name,
+           l->kernel_h, l->in_w, l->in_c, l->out_c, out_h, macs, im2col, im2col / macs, conv1d, conv1d / macs);
+    if(conv1d > 0)
+        printf(" (%.2fx)", im2col / conv1d);
+    printf("\n");
+
+    ret = 0;
+
+out:
+    if(graph)
+    {
+        postrun_graph(graph);
+        destroy_graph(graph);
+    }
+
+    free(weight);
+    free(bias);
+    free(input);
+    free(ref);
+    free(buffer);
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 1000;
+    unsigned int seed = 1;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    printf("perf clock: %u ticks per ms\n", get_perf_clock_base());
+
+    for(int i = 0; i < sizeof(layers) / sizeof(layers[0]); i++)
+    {
+        if(test_layer(&layers[i], run_num, &seed) < 0)
+            ret = -1;
+    }
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
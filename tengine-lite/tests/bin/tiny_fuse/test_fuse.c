@@ -0,0 +1,127 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * checks the relu nodes of the tiny graph are folded into their convs and fc:
+ * none of them shows as a step in the perf records.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tengine_c_api_ex.h"
+#include "tengine_op_name.h"
+#include "tiny_test.h"
+
+#define MAX_RECORD_NUM 64
+
+static int check_records(graph_t graph)
+{
+    struct perf_info* buf[MAX_RECORD_NUM];
+    int num = get_graph_perf_stat(graph, buf, MAX_RECORD_NUM);
+
+    if(num <= 0)
+    {
+        printf("no perf records\n");
+        return -1;
+    }
+
+    for(int i = 0; i < num; i++)
+    {
+        if(!strcmp(buf[i]->op_name, OP_RELU_NAME))
+        {
+            printf("relu node %d is not folded\n", buf[i]->node_idx);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 40;
+    int ret = -1;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+    signed char* input;
+    int input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &input, &input_size);
+
+    if(graph == NULL)
+    {
+        printf("create/prerun tiny graph failed\n");
+        return -1;
+    }
+
+    int relu_num = 0;
+
+    for(int i = 0; i < get_graph_node_num(graph); i++)
+    {
+        if(!strcmp(get_node_op(get_graph_node_by_idx(graph, i)), OP_RELU_NAME))
+            relu_num++;
+    }
+
+    unsigned int seed = 1;
+
+    /* nothing to check without a relu */
+    if(relu_num == 0 || do_graph_perf_stat(graph, GRAPH_PERF_STAT_ENABLE) < 0)
+        goto out;
+
+    for(int i = 0; i < run_num; i++)
+    {
+        fill_input(input, input_size, &seed);
+
+        if(run_graph(graph, 1) < 0)
+        {
+            printf("run %d failed\n", i);
+            goto out;
+        }
+    }
+
+    if(check_records(graph) < 0)
+        goto out;
+
+    ret = 0;
+
+out:
+    release_tiny_graph(graph, input);
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+    else
+        printf("fuse test failed\n");
+
+    return ret;
+}
@@ -0,0 +1,219 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * creates several graphs from the same tiny model and runs them interleaved, each one with its own input
+ * stream. Every output must match the one of a single graph fed the same stream alone.
+ * Then all graphs are reset and fed again in reverse order, which must give the same outputs once more.
+ *
+ * test_tiny_multi [run_num] [graph_num]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+#define MAX_GRAPH_NUM 8
+
+struct instance
+{
+    graph_t graph;
+    signed char* input;
+    int input_size;
+    unsigned int seed;
+};
+
+static int create_instance(struct instance* inst, const struct tiny_graph* tiny_graph, unsigned int seed)
+{
+    inst->graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &inst->input, &inst->input_size);
+
+    if(inst->graph == NULL)
+        return -1;
+
+    inst->seed = seed;
+
+    return 0;
+}
+
+static void release_instance(struct instance* inst)
+{
+    release_tiny_graph(inst->graph, inst->input);
+}
+
+/* feeds the next chunk of the stream of the instance, and returns its output */
+static signed char* run_instance(struct instance* inst, int* output_size)
+{
+    fill_input(inst->input, inst->input_size, &inst->seed);
+
+    if(run_graph(inst->graph, 1) < 0)
+        return NULL;
+
+    tensor_t output_tensor = get_graph_output_tensor(inst->graph, 0, 0);
+
+    *output_size = get_tensor_buffer_size(output_tensor);
+
+    return get_tensor_buffer(output_tensor);
+}
+
+static int check_interleaved(struct instance* insts, int graph_num, int run_num, signed char* ref, int ref_size,
+                             int reverse)
+{
+    for(int i = 0; i < run_num; i++)
+    {
+        for(int k = 0; k < graph_num; k++)
+        {
+            int n = reverse ? graph_num - 1 - k : k;
+            int output_size;
+            signed char* output = run_instance(&insts[n], &output_size);
+
+            if(output == NULL || output_size != ref_size)
+            {
+                printf("graph %d: run %d failed\n", n, i);
+                return -1;
+            }
+
+            if(memcmp(output, ref + (( size_t )n * run_num + i) * ref_size, ref_size))
+            {
+                printf("graph %d: run %d output mismatch\n", n, i);
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 100;
+    int graph_num = 4;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    if(argc > 2)
+        graph_num = atoi(argv[2]);
+
+    if(graph_num < 1 || graph_num > MAX_GRAPH_NUM)
+    {
+        printf("graph_num should be in [1, %d]\n", MAX_GRAPH_NUM);
+        return -1;
+    }
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+
+    /* the reference: a single graph fed each stream alone */
+    struct instance single;
+
+    if(create_instance(&single, tiny_graph, 0) < 0)
+    {
+        printf("create/prerun tiny graph failed\n");
+        return -1;
+    }
+
+    int ref_size = get_tensor_buffer_size(get_graph_output_tensor(single.graph, 0, 0));
+    signed char* ref = malloc(( size_t )graph_num * run_num * ref_size);
+
+    for(int n = 0; n < graph_num && ret == 0; n++)
+    {
+        single.seed = n + 1;
+
+        for(int i = 0; i < run_num; i++)
+        {
+            int output_size;
+            signed char* output = run_instance(&single, &output_size);
+
+            if(output == NULL)
+            {
+                printf("reference: run %d failed\n", i);
+                ret = -1;
+                break;
+            }
+
+            memcpy(ref + (( size_t )n * run_num + i) * ref_size, output, ref_size);
+        }
+
+        if(reset_graph(single.graph) < 0)
+        {
+            printf("reference: reset failed\n");
+            ret = -1;
+        }
+    }
+
+    release_instance(&single);
+
+    struct instance insts[MAX_GRAPH_NUM];
+    int created = 0;
+
+    while(created < graph_num && ret == 0)
+    {
+        if(create_instance(&insts[created], tiny_graph, created + 1) < 0)
+        {
+            printf("create/prerun graph %d failed\n", created);
+            ret = -1;
+            break;
+        }
+
+        created++;
+    }
+
+    if(ret == 0)
+        ret = check_interleaved(insts, graph_num, run_num, ref, ref_size, 0);
+
+    if(ret == 0)
+    {
+        for(int n = 0; n < graph_num; n++)
+        {
+            insts[n].seed = n + 1;
+
+            if(reset_graph(insts[n].graph) < 0)
+            {
+                printf("graph %d: reset failed\n", n);
+                ret = -1;
+                break;
+            }
+        }
+    }
+
+    if(ret == 0)
+        ret = check_interleaved(insts, graph_num, run_num, ref, ref_size, 1);
+
+    for(int n = 0; n < created; n++)
+        release_instance(&insts[n]);
+
+    free(ref);
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,168 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs the tiny graph with the perf stats on, checks the records and dumps them.
+ * The first node runs every time; the later ones are skipped while the move nodes warm up.
+ *
+ * test_tiny_perf [run_num] [csv]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+#define MAX_RECORD_NUM 64
+
+static int run_tiny_graph(graph_t graph, signed char* input, int input_size, int run_num, unsigned int* seed)
+{
+    for(int i = 0; i < run_num; i++)
+    {
+        fill_input(input, input_size, seed);
+
+        if(run_graph(graph, 1) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int check_records(graph_t graph, int run_num)
+{
+    struct perf_info* buf[MAX_RECORD_NUM];
+    int num = get_graph_perf_stat(graph, buf, MAX_RECORD_NUM);
+
+    if(num <= 0)
+    {
+        printf("no perf records\n");
+        return -1;
+    }
+
+    if(buf[0]->count != run_num)
+    {
+        printf("node %d: %u calls, expected %d\n", buf[0]->node_idx, buf[0]->count, run_num);
+        return -1;
+    }
+
+    for(int i = 0; i < num; i++)
+    {
+        struct perf_info* perf = buf[i];
+
+        if(perf->count > run_num)
+        {
+            printf("node %d: %u calls in %d runs\n", perf->node_idx, perf->count, run_num);
+            return -1;
+        }
+
+        if(perf->count == 0)
+            continue;
+
+        uint64_t avg = perf->total_time / perf->count;
+
+        if(perf->min > avg || avg > perf->max || perf->total_bytes == 0)
+        {
+            printf("node %d: bad record min %u avg %u max %u bytes %llu\n", perf->node_idx, perf->min,
+                   ( uint32_t )avg, perf->max, ( unsigned long long )perf->total_bytes);
+            return -1;
+        }
+    }
+
+    return num;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 50;
+    int csv = 0;
+    int ret = -1;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    if(argc > 2)
+        csv = atoi(argv[2]);
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+    signed char* input;
+    int input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, 1, 1, &input, &input_size);
+
+    if(graph == NULL)
+    {
+        printf("create/prerun tiny graph failed\n");
+        return -1;
+    }
+
+    unsigned int seed = 1;
+    struct perf_info* buf[MAX_RECORD_NUM];
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_ENABLE) < 0 ||
+       run_tiny_graph(graph, input, input_size, run_num, &seed) < 0 || check_records(graph, run_num) < 0)
+        goto out;
+
+    /* stopped: the runs are not counted */
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_STOP) < 0 ||
+       run_tiny_graph(graph, input, input_size, 3, &seed) < 0 || check_records(graph, run_num) < 0)
+        goto out;
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_START) < 0 ||
+       run_tiny_graph(graph, input, input_size, 2, &seed) < 0 || check_records(graph, run_num + 2) < 0)
+        goto out;
+
+    dump_graph_perf_stat(graph, csv);
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_RESET) < 0 || get_graph_perf_stat(graph, buf, MAX_RECORD_NUM) <= 0 ||
+       buf[0]->count != 0)
+    {
+        printf("reset perf stats failed\n");
+        goto out;
+    }
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_DISABLE) < 0 || get_graph_perf_stat(graph, buf, MAX_RECORD_NUM) != 0 ||
+       run_tiny_graph(graph, input, input_size, 1, &seed) < 0)
+    {
+        printf("disable perf stats failed\n");
+        goto out;
+    }
+
+    ret = 0;
+
+out:
+    release_tiny_graph(graph, input);
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+    else
+        printf("perf test failed\n");
+
+    return ret;
+}
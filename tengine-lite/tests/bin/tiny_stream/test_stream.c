@@ -0,0 +1,100 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * feeds the same chunks to the tiny graph with move nodes and to the one with stream convs.
+ * After the warmup, the outputs must be the same: the flag move of the first graph hands out
+ * a few rows before they are complete, so the two differ until those rows are out of the window.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+#define WARMUP_RUN_NUM 14
+
+extern const struct tiny_graph* get_tiny_stream_graph(void);
+
+int main(int argc, char* argv[])
+{
+    int run_num = 200;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    signed char* move_input;
+    signed char* stream_input;
+    int move_input_size, stream_input_size;
+
+    graph_t move_graph = create_tiny_graph(NULL, get_tiny_graph(), 1, 1, &move_input, &move_input_size);
+    graph_t stream_graph = create_tiny_graph(NULL, get_tiny_stream_graph(), 1, 1, &stream_input, &stream_input_size);
+
+    if(move_graph == NULL || stream_graph == NULL || move_input_size != stream_input_size)
+    {
+        printf("create/prerun tiny graphs failed\n");
+        return -1;
+    }
+
+    tensor_t stream_output = get_graph_output_tensor(stream_graph, 0, 0);
+    unsigned int seed = 1;
+
+    for(int i = 0; i < run_num; i++)
+    {
+        fill_input(move_input, move_input_size, &seed);
+
+        memcpy(stream_input, move_input, move_input_size);
+
+        if(run_graph(move_graph, 1) < 0 || run_graph(stream_graph, 1) < 0)
+        {
+            printf("run %d failed\n", i);
+            ret = -1;
+            break;
+        }
+
+        if(i < WARMUP_RUN_NUM)
+            continue;
+
+        if(compare_output(move_graph, get_tensor_buffer(stream_output), get_tensor_buffer_size(stream_output)) < 0)
+        {
+            printf("run %d: stream output mismatch\n", i);
+            ret = -1;
+            break;
+        }
+    }
+
+    release_tiny_graph(move_graph, move_input);
+    release_tiny_graph(stream_graph, stream_input);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,494 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * the model of tiny_graph_generated.c without the move nodes:
+ * the convs are in stream mode, the engine keeps the rows each of them still needs
+ */
+
+#include <stdio.h>
+
+#include "tiny_graph.h"
+#include "tiny_param_generated.h"
+
+#define INPUT_FEATURE_DIM_W (10)
+#define INPUT_FEATURE_DIM_H (8) /* rows of one chunk */
+
+#define FOURTH_CONV_OUTPUT_DIM_H (8)
+#define FOURTH_CONV_KERNEL_C (64)
+#define LINEAR_DIM (64)
+#define FIRST_FC_DIM (128)
+#define OUT_DIM (12)
+
+static const struct tiny_tensor input = {
+    .dims = {1, INPUT_FEATURE_DIM_H, INPUT_FEATURE_DIM_W, 1},
+    .dim_num = 4,
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_INPUT,
+    .data = NULL,
+};
+
+/* conv 0 */
+static const struct tiny_tensor conv_0_weight = {
+    .dim_num = 4,
+    .dims = {10, 10, 1, 96},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_0_weight_data,
+};
+
+static const struct tiny_tensor conv_0_bias = {
+    .dim_num = 1,
+    .dims = {96},
+    .shift = FIRST_CONV_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_0_bias_data,
+};
+
+static const struct tiny_tensor conv_0_output = {
+    .dim_num = 4,
+    .dims = {1, 4, 1, 96},
+    .shift = FIRST_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_conv_param conv_0_param = {
+    .kernel_h = 10,
+    .kernel_w = 10,
+    .stride_h = 2,
+    .stride_w = 1,
+    .pad_h = NN_PAD_VALID,
+    .pad_w = NN_PAD_VALID,
+    .activation = -1,
+    .stream = 1,
+};
+
+static const struct tiny_node conv_0_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_CONV,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &conv_0_param,
+    .input = {&input, &conv_0_weight, &conv_0_bias},
+    .output = &conv_0_output,
+};
+
+static const struct tiny_tensor relu_0_output = {
+    .dim_num = 4,
+    .dims = {1, 4, 1, 96},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node relu_0_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&conv_0_output},
+    .output = &relu_0_output,
+};
+
+/* conv 1 */
+static const struct tiny_tensor conv_1_weight = {
+    .dim_num = 4,
+    .dims = {8, 1, 96, 80},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_1_weight_data,
+};
+
+static const struct tiny_tensor conv_1_bias = {
+    .dim_num = 1,
+    .dims = {80},
+    .shift = SECOND_CONV_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_1_bias_data,
+};
+
+static const struct tiny_tensor conv_1_output = {
+    .dim_num = 4,
+    .dims = {1, 2, 1, 80},
+    .shift = SECOND_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_conv_param conv_1_param = {
+    .kernel_h = 8,
+    .kernel_w = 1,
+    .stride_h = 2,
+    .stride_w = 1,
+    .pad_h = NN_PAD_VALID,
+    .pad_w = NN_PAD_VALID,
+    .activation = -1,
+    .stream = 1,
+};
+
+static const struct tiny_node conv_1_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_CONV,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &conv_1_param,
+    .input = {&relu_0_output, &conv_1_weight, &conv_1_bias},
+    .output = &conv_1_output,
+};
+
+static const struct tiny_tensor relu_1_output = {
+    .dim_num = 4,
+    .dims = {1, 2, 1, 80},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node relu_1_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&conv_1_output},
+    .output = &relu_1_output,
+};
+
+/* conv 2 */
+static const struct tiny_tensor conv_2_weight = {
+    .dim_num = 4,
+    .dims = {4, 1, 80, 72},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_2_weight_data,
+};
+
+static const struct tiny_tensor conv_2_bias = {
+    .dim_num = 1,
+    .dims = {72},
+    .shift = THIRD_CONV_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_2_bias_data,
+};
+
+static const struct tiny_tensor conv_2_output = {
+    .dim_num = 4,
+    .dims = {1, 2, 1, 72},
+    .shift = THIRD_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_conv_param conv_2_param = {
+    .kernel_h = 4,
+    .kernel_w = 1,
+    .stride_h = 1,
+    .stride_w = 1,
+    .pad_h = NN_PAD_VALID,
+    .pad_w = NN_PAD_VALID,
+    .activation = -1,
+    .stream = 1,
+};
+
+static const struct tiny_node conv_2_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_CONV,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &conv_2_param,
+    .input = {&relu_1_output, &conv_2_weight, &conv_2_bias},
+    .output = &conv_2_output,
+};
+
+static const struct tiny_tensor relu_2_output = {
+    .dim_num = 4,
+    .dims = {1, 2, 1, 72},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node relu_2_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&conv_2_output},
+    .output = &relu_2_output,
+};
+
+/* conv 3 */
+static const struct tiny_tensor conv_3_weight = {
+    .dim_num = 4,
+    .dims = {3, 1, 72, 64},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_3_weight_data,
+};
+
+static const struct tiny_tensor conv_3_bias = {
+    .dim_num = 1,
+    .dims = {64},
+    .shift = FOURTH_CONV_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = conv_3_bias_data,
+};
+
+static const struct tiny_tensor conv_3_output = {
+    .dim_num = 4,
+    .dims = {1, FOURTH_CONV_OUTPUT_DIM_H, 1, 64},
+    .shift = FOURTH_CONV_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_conv_param conv_3_param = {
+    .kernel_h = 3,
+    .kernel_w = 1,
+    .stride_h = 2,
+    .stride_w = 1,
+    .pad_h = NN_PAD_VALID,
+    .pad_w = NN_PAD_VALID,
+    .activation = -1,
+    .stream = 1,
+};
+
+static const struct tiny_node conv_3_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_CONV,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = &conv_3_param,
+    .input = {&relu_2_output, &conv_3_weight, &conv_3_bias},
+    .output = &conv_3_output,
+};
+
+static const struct tiny_tensor relu_3_output = {
+    .dim_num = 4,
+    .dims = {1, FOURTH_CONV_OUTPUT_DIM_H, 1, 64},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node relu_3_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&conv_3_output},
+    .output = &relu_3_output,
+};
+
+/* fc 4 */
+static const struct tiny_tensor fc_4_weight = {
+    .dim_num = 2,
+    .dims = {LINEAR_DIM, FOURTH_CONV_OUTPUT_DIM_H * FOURTH_CONV_KERNEL_C},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_4_weight_data,
+};
+
+static const struct tiny_tensor fc_4_bias = {
+    .dim_num = 1,
+    .dims = {LINEAR_DIM},
+    .shift = LINEAR_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_4_bias_data,
+};
+
+static const struct tiny_tensor fc_4_output = {
+    .dim_num = 2,
+    .dims = {1, LINEAR_DIM},
+    .shift = LINEAR_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node fc_4_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_FC,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&relu_3_output, &fc_4_weight, &fc_4_bias},
+    .output = &fc_4_output,
+};
+
+/* fc 5 */
+static const struct tiny_tensor fc_5_weight = {
+    .dim_num = 2,
+    .dims = {FIRST_FC_DIM, LINEAR_DIM},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_5_weight_data,
+};
+
+static const struct tiny_tensor fc_5_bias = {
+    .dim_num = 1,
+    .dims = {FIRST_FC_DIM},
+    .shift = FIRST_FC_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_5_bias_data,
+};
+
+static const struct tiny_tensor fc_5_output = {
+    .dim_num = 2,
+    .dims = {1, FIRST_FC_DIM},
+    .shift = FIRST_FC_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node fc_5_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_FC,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&fc_4_output, &fc_5_weight, &fc_5_bias},
+    .output = &fc_5_output,
+};
+
+static const struct tiny_tensor relu_6_output = {
+    .dim_num = 2,
+    .dims = {1, FIRST_FC_DIM},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node relu_6_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_RELU,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&fc_5_output},
+    .output = &relu_6_output,
+};
+
+/* fc 7 */
+static const struct tiny_tensor fc_7_weight = {
+    .dim_num = 2,
+    .dims = {OUT_DIM, FIRST_FC_DIM},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_7_weight_data,
+};
+
+static const struct tiny_tensor fc_7_bias = {
+    .dim_num = 1,
+    .dims = {OUT_DIM},
+    .shift = FINAL_FC_BIAS_LSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_CONST,
+    .data = fc_7_bias_data,
+};
+
+static const struct tiny_tensor fc_7_output = {
+    .dim_num = 2,
+    .dims = {1, OUT_DIM},
+    .shift = FINAL_FC_OUTPUT_RSHIFT,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node fc_7_node = {
+    .input_num = 3,
+    .output_num = 1,
+    .op_type = NN_OP_FC,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&relu_6_output, &fc_7_weight, &fc_7_bias},
+    .output = &fc_7_output,
+};
+
+static const struct tiny_tensor softmax_8_output = {
+    .dim_num = 2,
+    .dims = {1, OUT_DIM},
+    .shift = 0,
+    .data_type = NN_DT_Q7,
+    .tensor_type = NN_TENSOR_VAR,
+    .data = NULL,
+};
+
+static const struct tiny_node softmax_8_node = {
+    .input_num = 1,
+    .output_num = 1,
+    .op_type = NN_OP_SOFTMAX,
+    .op_ver = NN_OP_VERSION_1,
+    .op_param = NULL,
+    .input = {&fc_7_output},
+    .output = &softmax_8_output,
+};
+
+static const struct tiny_node* node_list[] = {
+    &conv_0_node, &relu_0_node, &conv_1_node, &relu_1_node, &conv_2_node, &relu_2_node,
+    &conv_3_node, &relu_3_node, &fc_4_node,   &fc_5_node,   &relu_6_node, &fc_7_node,   &softmax_8_node,
+};
+
+static const struct tiny_graph tiny_graph = {
+    .name = "speech model, stream",
+    .tiny_version = NN_TINY_VERSION_1,
+    .nn_id = 0xdeadbeaf,
+    .create_time = 0,
+    .layout = NN_LAYOUT_NHWC,
+    .node_num = sizeof(node_list) / sizeof(void*),
+    .node_list = node_list,
+};
+
+const struct tiny_graph* get_tiny_stream_graph(void)
+{
+    return &tiny_graph;
+}
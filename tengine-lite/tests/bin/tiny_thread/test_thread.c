@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * runs the tiny graph prerun with 1, 2, 4 and 8 threads on the same input stream: the outputs
+ * must be the same as the single thread ones, and the time of each thread number is reported with
+ * its speedup over one thread. Nodes with less than CPU_POOL_MIN_PART_MACS per part run inline,
+ * so at batch 1 the KWS layers keep the single thread time.
+ *
+ * test_tiny_thread [run_num] [batch]: a larger batch gives the threads more work per node
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "tengine_c_api.h"
+#include "tiny_test.h"
+
+static const int thread_nums[] = {1, 2, 4, 8};
+
+static unsigned long get_cur_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return (tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+/* runs the graph run_num times, and keeps all the outputs */
+static int run_tiny_graph(const struct tiny_graph* tiny_graph, int num_thread, int run_num, int batch,
+                          signed char** outputs, int* output_size, unsigned long* used_time)
+{
+    signed char* input;
+    int input_size;
+
+    graph_t graph = create_tiny_graph(NULL, tiny_graph, batch, num_thread, &input, &input_size);
+
+    if(graph == NULL)
+        return -1;
+
+    tensor_t output_tensor = get_graph_output_tensor(graph, 0, 0);
+
+    *output_size = get_tensor_buffer_size(output_tensor);
+    *outputs = malloc(( size_t )run_num * *output_size);
+    *used_time = 0;
+
+    unsigned int seed = 1;
+    int ret = 0;
+
+    for(int i = 0; i < run_num; i++)
+    {
+        fill_input(input, input_size, &seed);
+
+        unsigned long start = get_cur_time();
+
+        if(run_graph(graph, 1) < 0)
+        {
+            ret = -1;
+            break;
+        }
+
+        *used_time += get_cur_time() - start;
+
+        memcpy(*outputs + ( size_t )i * *output_size, get_tensor_buffer(output_tensor), *output_size);
+    }
+
+    release_tiny_graph(graph, input);
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 200;
+    int batch = 1;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    if(argc > 2)
+        batch = atoi(argv[2]);
+
+    init_tengine();
+
+    const struct tiny_graph* tiny_graph = get_tiny_graph();
+    signed char* ref = NULL;
+    int ref_size = 0;
+    unsigned long ref_time = 0;
+
+    for(int i = 0; i < sizeof(thread_nums) / sizeof(thread_nums[0]); i++)
+    {
+        signed char* outputs;
+        int output_size;
+        unsigned long used_time;
+
+        if(run_tiny_graph(tiny_graph, thread_nums[i], run_num, batch, &outputs, &output_size, &used_time) < 0)
+        {
+            printf("%d threads: run failed\n", thread_nums[i]);
+            ret = -1;
+            break;
+        }
+
+        if(ref == NULL)
+            ref_time = used_time;
+
+        printf("%d threads: %.2f us per run, %.2fx\n", thread_nums[i], 1.0f * used_time / run_num,
+               used_time ? 1.0f * ref_time / used_time : 0.0f);
+
+        if(ref == NULL)
+        {
+            ref = outputs;
+            ref_size = output_size;
+            continue;
+        }
+
+        if(output_size != ref_size || memcmp(outputs, ref, ( size_t )run_num * ref_size))
+        {
+            printf("%d threads: output mismatch\n", thread_nums[i]);
+            ret = -1;
+        }
+
+        free(outputs);
+
+        if(ret < 0)
+            break;
+    }
+
+    free(ref);
+    free_tiny_graph(tiny_graph);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
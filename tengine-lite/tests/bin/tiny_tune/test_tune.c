@@ -0,0 +1,356 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs max pooling, relu and conv as one graph, without the "cpu_tune" attr and then twice with
+ * it: the tuned graphs must give the same outputs, the first times the node ops and the second
+ * takes the choices from the cache, with a faster prerun.
+ *
+ * test_tiny_tune [cache_file]: the cache is saved to cache_file, or loaded from it when it exists,
+ * and then the first tuned graph takes all its choices from the cache of the previous process
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_graph.h"
+
+#define IN_H 12
+#define IN_W 10
+#define IN_C 24
+#define POOL_KERNEL 3
+#define POOL_STRIDE 2
+#define POOL_PAD 1
+#define POOL_H ((IN_H + 2 * POOL_PAD - POOL_KERNEL) / POOL_STRIDE + 1)
+#define POOL_W ((IN_W + 2 * POOL_PAD - POOL_KERNEL) / POOL_STRIDE + 1)
+#define OUT_C 32
+#define KERNEL 3
+#define IN_SIZE (IN_H * IN_W * IN_C)
+#define OUT_SIZE (POOL_H * POOL_W * OUT_C)
+#define MAX_NODE_NUM 3
+
+typedef signed char q7_t;
+
+static q7_t weight[OUT_C * KERNEL * KERNEL * IN_C];
+static q7_t bias[OUT_C];
+
+static struct tiny_tensor input_tensor = {
+    .dims = {1, IN_H, IN_W, IN_C}, .dim_num = 4, .data_type = NN_DT_Q7, .tensor_type = NN_TENSOR_INPUT};
+static struct tiny_tensor pool_tensor = {
+    .dims = {1, POOL_H, POOL_W, IN_C}, .dim_num = 4, .data_type = NN_DT_Q7, .tensor_type = NN_TENSOR_VAR};
+static struct tiny_tensor relu_tensor = {
+    .dims = {1, POOL_H, POOL_W, IN_C}, .dim_num = 4, .data_type = NN_DT_Q7, .tensor_type = NN_TENSOR_VAR};
+static struct tiny_tensor weight_tensor = {.dims = {KERNEL, KERNEL, IN_C, OUT_C},
+                                           .dim_num = 4,
+                                           .data_type = NN_DT_Q7,
+                                           .tensor_type = NN_TENSOR_CONST,
+                                           .data = weight};
+static struct tiny_tensor bias_tensor = {.dims = {OUT_C},
+                                         .dim_num = 1,
+                                         .shift = 3,
+                                         .data_type = NN_DT_Q7,
+                                         .tensor_type = NN_TENSOR_CONST,
+                                         .data = bias};
+static struct tiny_tensor output_tensor = {.dims = {1, POOL_H, POOL_W, OUT_C},
+                                           .dim_num = 4,
+                                           .shift = 9,
+                                           .data_type = NN_DT_Q7,
+                                           .tensor_type = NN_TENSOR_VAR};
+
+static struct tiny_pool_param pool_param = {.pool_method = NN_POOL_MAX,
+                                            .kernel_h = POOL_KERNEL,
+                                            .kernel_w = POOL_KERNEL,
+                                            .pad_h = POOL_PAD,
+                                            .pad_w = POOL_PAD,
+                                            .stride_h = POOL_STRIDE,
+                                            .stride_w = POOL_STRIDE};
+static struct tiny_conv_param conv_param = {.kernel_h = KERNEL,
+                                            .kernel_w = KERNEL,
+                                            .stride_h = 1,
+                                            .stride_w = 1,
+                                            .pad_h = 1,
+                                            .pad_w = 1,
+                                            .activation = -1};
+
+static struct tiny_node pool_node = {.input_num = 1,
+                                     .output_num = 1,
+                                     .op_type = NN_OP_POOL,
+                                     .op_ver = NN_OP_VERSION_1,
+                                     .op_param = &pool_param,
+                                     .input = {&input_tensor},
+                                     .output = &pool_tensor};
+static struct tiny_node relu_node = {.input_num = 1,
+                                     .output_num = 1,
+                                     .op_type = NN_OP_RELU,
+                                     .op_ver = NN_OP_VERSION_1,
+                                     .input = {&pool_tensor},
+                                     .output = &relu_tensor};
+static struct tiny_node conv_node = {.input_num = 3,
+                                     .output_num = 1,
+                                     .op_type = NN_OP_CONV,
+                                     .op_ver = NN_OP_VERSION_1,
+                                     .op_param = &conv_param,
+                                     .input = {&relu_tensor, &weight_tensor, &bias_tensor},
+                                     .output = &output_tensor};
+
+static const struct tiny_node* node_list[] = {&pool_node, &relu_node, &conv_node};
+
+static struct tiny_graph tiny_graph = {.name = "tune",
+                                       .tiny_version = NN_TINY_VERSION_1,
+                                       .layout = NN_LAYOUT_NHWC,
+                                       .node_num = MAX_NODE_NUM,
+                                       .node_list = node_list};
+
+static unsigned int seed = 1;
+
+static void fill_random(q7_t* buf, int size)
+{
+    for(int i = 0; i < size; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = ( q7_t )((( int )((seed >> 16) & 0x7fff) % 256) - 128);
+    }
+}
+
+/* the blob of the tune cache, from a previous process: 1 when loaded, 0 when there is none */
+static int load_cache_file(const char* fname)
+{
+    FILE* fp = fopen(fname, "rb");
+
+    if(fp == NULL)
+        return 0;
+
+    fseek(fp, 0, SEEK_END);
+
+    int size = ( int )ftell(fp);
+    void* blob = malloc(size);
+
+    fseek(fp, 0, SEEK_SET);
+
+    int ret = blob && fread(blob, 1, size, fp) == size && load_tune_cache("cpu_dev", blob, size) > 0 ? 1 : -1;
+
+    if(ret < 0)
+        printf("load tune cache from %s failed\n", fname);
+
+    free(blob);
+    fclose(fp);
+
+    return ret;
+}
+
+static int save_cache_file(const char* fname, const void* blob, int size)
+{
+    FILE* fp = fopen(fname, "wb");
+
+    if(fp == NULL || fwrite(blob, 1, size, fp) != size)
+    {
+        printf("save tune cache to %s failed\n", fname);
+
+        if(fp)
+            fclose(fp);
+
+        return -1;
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/* the graph with the "cpu_tune" attr at tune, run on input into output, and the time of its prerun */
+static graph_t run_model(int tune, const q7_t* input, q7_t* output, uint32_t* prerun_time)
+{
+    graph_t graph = create_graph(NULL, "tiny", ( void* )&tiny_graph);
+
+    if(graph == NULL || set_graph_attr(graph, "cpu_tune", &tune, sizeof(int)) < 0)
+    {
+        printf("create graph failed\n");
+        return NULL;
+    }
+
+    uint32_t start = read_perf_clock();
+
+    if(prerun_graph(graph) < 0)
+    {
+        printf("prerun graph failed\n");
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    *prerun_time = read_perf_clock() - start;
+
+    set_tensor_buffer(get_graph_input_tensor(graph, 0, 0), ( void* )input, IN_SIZE);
+
+    if(run_graph(graph, 1) < 0)
+    {
+        printf("run graph failed\n");
+        postrun_graph(graph);
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    memcpy(output, get_tensor_buffer(get_graph_output_tensor(graph, 0, 0)), OUT_SIZE);
+
+    return graph;
+}
+
+static void free_model(graph_t graph)
+{
+    postrun_graph(graph);
+    destroy_graph(graph);
+}
+
+int main(int argc, char* argv[])
+{
+    static q7_t input[IN_SIZE];
+    static q7_t ref[OUT_SIZE];
+    static q7_t output[OUT_SIZE];
+    struct tune_info* log[2][MAX_NODE_NUM];
+    int log_num[2];
+    uint32_t prerun_time[3];
+    graph_t tuned[2] = {NULL, NULL};
+    void* blob = NULL;
+    const char* cache_file = argc > 1 ? argv[1] : NULL;
+    int loaded = 0;
+    int ret = -1;
+
+    init_tengine();
+
+    if(cache_file && (loaded = load_cache_file(cache_file)) < 0)
+        goto out;
+
+    fill_random(weight, sizeof(weight));
+    fill_random(bias, sizeof(bias));
+    fill_random(input, sizeof(input));
+
+    graph_t graph = run_model(0, input, ref, &prerun_time[0]);
+
+    if(graph == NULL)
+        goto out;
+
+    if(get_graph_tune_log(graph, log[0], MAX_NODE_NUM) != 0)
+    {
+        printf("untuned graph has a tune log\n");
+        free_model(graph);
+        goto out;
+    }
+
+    free_model(graph);
+
+    for(int i = 0; i < 2; i++)
+    {
+        tuned[i] = run_model(1, input, output, &prerun_time[i + 1]);
+
+        if(tuned[i] == NULL)
+            goto out;
+
+        if(memcmp(output, ref, OUT_SIZE))
+        {
+            printf("tuned graph %d: outputs differ from the untuned graph\n", i);
+            goto out;
+        }
+
+        log_num[i] = get_graph_tune_log(tuned[i], log[i], MAX_NODE_NUM);
+
+        if(log_num[i] < 0)
+            goto out;
+
+        dump_graph_tune_log(tuned[i]);
+    }
+
+    /* the second prerun of the model takes all the choices of the first, which was timed unless loaded */
+    if(log_num[1] != log_num[0])
+    {
+        printf("tune log of %d nodes, then of %d\n", log_num[0], log_num[1]);
+        goto out;
+    }
+
+    for(int i = 0; i < log_num[0]; i++)
+    {
+        struct tune_info* first = log[0][i];
+        struct tune_info* second = log[1][i];
+
+        if(first->cand_num > 1 && (first->cached != loaded || !second->cached))
+        {
+            printf("node %d: cached %d, then %d\n", first->node_idx, first->cached, second->cached);
+            goto out;
+        }
+
+        if(second->node_idx != first->node_idx ||
+           strcmp(second->cand_name[second->selected], first->cand_name[first->selected]))
+        {
+            printf("node %d: %s, then %s\n", first->node_idx, first->cand_name[first->selected],
+                   second->cand_name[second->selected]);
+            goto out;
+        }
+    }
+
+    printf("prerun: %u ticks untuned, %u tuned, %u cached\n", prerun_time[0], prerun_time[1], prerun_time[2]);
+
+    if(log_num[0] > 0 && !loaded && prerun_time[2] > prerun_time[1])
+    {
+        printf("the cached prerun is slower\n");
+        goto out;
+    }
+
+    int blob_size = save_tune_cache("cpu_dev", NULL, 0);
+
+    blob = blob_size > 0 ? malloc(blob_size) : NULL;
+
+    if(blob == NULL || save_tune_cache("cpu_dev", blob, blob_size) != blob_size ||
+       save_tune_cache("cpu_dev", blob, blob_size - 1) >= 0)
+    {
+        printf("save tune cache failed\n");
+        goto out;
+    }
+
+    /* a short blob is rejected, the entries of a good one are in the cache already */
+    if(load_tune_cache("cpu_dev", blob, blob_size - 1) >= 0 || load_tune_cache("cpu_dev", blob, blob_size) != 0)
+    {
+        printf("load tune cache failed\n");
+        goto out;
+    }
+
+    if(cache_file && !loaded && save_cache_file(cache_file, blob, blob_size) < 0)
+        goto out;
+
+    ret = 0;
+
+out:
+    for(int i = 0; i < 2; i++)
+    {
+        if(tuned[i])
+            free_model(tuned[i]);
+    }
+
+    free(blob);
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}
@@ -0,0 +1,487 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * License); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * AS IS BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*
+ * Copyright (c) 2020, OPEN AI LAB
+ */
+
+/*
+ * runs conv, fc and max pooling as one node graphs, and relu after a max pooling, as relu runs
+ * in place and the graph input is the buffer of the caller. On a cpu with SSE4.1 or AVX2 these
+ * take the x86 ops, checked against the cmsis functions. Then times both: the nodes from the
+ * perf stats, the cmsis functions around the calls. Each graph runs with the SSE4.1 variants
+ * and with the AVX2 ones, through the "cpu_isa" graph attr.
+ *
+ * test_tiny_x86 [run_num]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tengine_c_api.h"
+#include "tiny_graph.h"
+
+#define BIAS_SHIFT 3
+#define OUT_SHIFT 9
+
+typedef signed char q7_t;
+typedef short q15_t;
+
+int arm_convolve_HWC_q7_nonsquare(const q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                  const uint16_t ch_im_in, const q7_t* wt, const uint16_t ch_im_out,
+                                  const uint16_t dim_kernel_x, const uint16_t dim_kernel_y, const uint16_t padding_x,
+                                  const uint16_t padding_y, const uint16_t stride_x, const uint16_t stride_y,
+                                  const q7_t* bias, const uint16_t bias_shift, const uint16_t out_shift, q7_t* Im_out,
+                                  const uint16_t dim_im_out_x, const uint16_t dim_im_out_y, q15_t* bufferA,
+                                  q7_t* bufferB);
+int arm_fully_connected_q7(const q7_t* pV, const q7_t* pM, const uint16_t dim_vec, const uint16_t num_of_rows,
+                           const uint16_t bias_shift, const uint16_t out_shift, const q7_t* bias, q7_t* pOut,
+                           q15_t* vec_buffer);
+void arm_maxpool_HWC_q7_nonsquare(q7_t* Im_in, const uint16_t dim_im_in_x, const uint16_t dim_im_in_y,
+                                  const uint16_t ch_im_in, const uint16_t dim_kernel, const uint16_t padding,
+                                  const uint16_t stride, const uint16_t dim_im_out_x, const uint16_t dim_im_out_y,
+                                  q7_t* bufferA, q7_t* Im_out);
+void arm_relu_q7(q7_t* data, uint16_t size);
+
+struct conv_case
+{
+    const char* name;
+    int in_h, in_w, in_c, out_c;
+    int kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w;
+    int activation;
+};
+
+struct fc_case
+{
+    const char* name;
+    int batch, dim_vec, num_of_rows;
+};
+
+/* FIRST_CONV and SECOND_CONV of cnn.h, then 2D shapes with padding and tails */
+static const struct conv_case conv_cases[] = {
+    {"conv_0", 16, 10, 1, 96, 10, 10, 2, 1, 0, 0, -1},
+    {"conv_1", 10, 1, 96, 80, 8, 1, 2, 1, 0, 0, 0},
+    {"3x3 pad", 9, 7, 5, 13, 3, 3, 1, 2, 1, 1, 0},
+    {"1x1", 4, 4, 20, 33, 1, 1, 1, 1, 0, 0, -1},
+};
+
+/* the fc of the model, then batches and tails */
+static const struct fc_case fc_cases[] = {
+    {"fc_4", 1, 512, 64},
+    {"fc_5 batch", 3, 64, 128},
+    {"fc tail", 2, 37, 11},
+    {"fc lanes", 6, 45, 40},
+};
+
+static unsigned int seed = 1;
+
+static void fill_random(q7_t* buf, int size, int range)
+{
+    for(int i = 0; i < size; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = ( q7_t )((( int )((seed >> 16) & 0x7fff) % range) - range / 2);
+    }
+}
+
+/* the reference of a case, on a copy of the input */
+typedef void (*ref_func_t)(const void* arg, q7_t* input, q7_t* output);
+
+struct isa_case
+{
+    const char* name;
+    int cpu_isa;
+};
+
+/* the "cpu_isa" attr of each run, the cpu may lack the wider ones: then the graph takes the best it has */
+static const struct isa_case isa_cases[] = {
+    {"sse4.1", CPU_ISA_SSE41},
+    {"avx2", CPU_ISA_SSE41 | CPU_ISA_AVX2},
+};
+
+/*
+ * the graph of the nodes, the input tensor of the first is the input of the graph, with the
+ * cpu_isa of isa_case: runs it on input, compares its output with ref_func, and prints the
+ * times of both.
+ */
+static int check_variant(const char* name, const struct isa_case* isa_case, const struct tiny_node** node_list,
+                         int node_num, int input_size, int output_size, ref_func_t ref_func, const void* arg,
+                         int run_num)
+{
+    struct tiny_graph tiny_graph = {.name = ( char* )name,
+                                    .tiny_version = NN_TINY_VERSION_1,
+                                    .layout = NN_LAYOUT_NHWC,
+                                    .node_num = node_num,
+                                    .node_list = node_list};
+
+    q7_t* input = malloc(input_size);
+    q7_t* copy = malloc(input_size);
+    q7_t* ref = malloc(output_size);
+    graph_t graph = create_graph(NULL, "tiny", ( void* )&tiny_graph);
+    int ret = -1;
+
+    if(graph == NULL || set_graph_attr(graph, "cpu_isa", &isa_case->cpu_isa, sizeof(int)) < 0 ||
+       prerun_graph(graph) < 0)
+    {
+        printf("%s: create/prerun graph failed\n", name);
+        goto out;
+    }
+
+    set_tensor_buffer(get_graph_input_tensor(graph, 0, 0), input, input_size);
+
+    for(int i = 0; i < 4; i++)
+    {
+        fill_random(input, input_size, 256);
+        memcpy(copy, input, input_size);
+        ref_func(arg, copy, ref);
+
+        if(run_graph(graph, 1) < 0)
+        {
+            printf("%s: run failed\n", name);
+            goto out;
+        }
+
+        const q7_t* output = get_tensor_buffer(get_graph_output_tensor(graph, 0, 0));
+
+        for(int j = 0; j < output_size; j++)
+        {
+            if(output[j] != ref[j])
+            {
+                printf("%s: output %d is %d, expected %d\n", name, j, output[j], ref[j]);
+                goto out;
+            }
+        }
+    }
+
+    struct perf_info* perf[2];
+
+    if(do_graph_perf_stat(graph, GRAPH_PERF_STAT_ENABLE) < 0)
+        goto out;
+
+    for(int i = 0; i < run_num; i++)
+        run_graph(graph, 1);
+
+    if(get_graph_perf_stat(graph, perf, node_num) != node_num || perf[0]->count == 0)
+    {
+        printf("%s: no perf record\n", name);
+        goto out;
+    }
+
+    uint64_t node_total = 0;
+
+    for(int i = 0; i < node_num; i++)
+        node_total += perf[i]->total_time;
+
+    uint32_t start = read_perf_clock();
+
+    for(int i = 0; i < run_num; i++)
+        ref_func(arg, copy, ref);
+
+    double cmsis = ( double )(read_perf_clock() - start) / run_num;
+    double node_time = ( double )node_total / perf[0]->count;
+
+    printf("%-12s %-6s node %.2f ticks, cmsis %.2f ticks", name, isa_case->name, node_time, cmsis);
+    if(node_time > 0)
+        printf(" (%.2fx)", cmsis / node_time);
+    printf("\n");
+
+    ret = 0;
+
+out:
+    if(graph)
+    {
+        postrun_graph(graph);
+        destroy_graph(graph);
+    }
+
+    free(input);
+    free(copy);
+    free(ref);
+
+    return ret;
+}
+
+static int check_graph(const char* name, const struct tiny_node** node_list, int node_num, int input_size,
+                       int output_size, ref_func_t ref_func, const void* arg, int run_num)
+{
+    for(int i = 0; i < sizeof(isa_cases) / sizeof(isa_cases[0]); i++)
+    {
+        if(check_variant(name, &isa_cases[i], node_list, node_num, input_size, output_size, ref_func, arg,
+                         run_num) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+struct conv_ref
+{
+    const struct conv_case* c;
+    const q7_t* weight;
+    const q7_t* bias;
+    q15_t* buffer;
+    int out_h, out_w;
+};
+
+static void conv_ref_func(const void* arg, q7_t* input, q7_t* output)
+{
+    const struct conv_ref* r = ( const struct conv_ref* )arg;
+    const struct conv_case* c = r->c;
+
+    arm_convolve_HWC_q7_nonsquare(input, c->in_w, c->in_h, c->in_c, r->weight, c->out_c, c->kernel_w, c->kernel_h,
+                                  c->pad_w, c->pad_h, c->stride_w, c->stride_h, r->bias, BIAS_SHIFT, OUT_SHIFT, output,
+                                  r->out_w, r->out_h, r->buffer, NULL);
+
+    if(c->activation == 0)
+        arm_relu_q7(output, r->out_h * r->out_w * c->out_c);
+}
+
+static int test_conv(const struct conv_case* c, int run_num)
+{
+    struct conv_ref r = {.c = c};
+    int weight_size = c->out_c * c->kernel_h * c->kernel_w * c->in_c;
+
+    r.out_h = (c->in_h + 2 * c->pad_h - c->kernel_h) / c->stride_h + 1;
+    r.out_w = (c->in_w + 2 * c->pad_w - c->kernel_w) / c->stride_w + 1;
+
+    q7_t* weight = malloc(weight_size);
+    q7_t* bias = malloc(c->out_c);
+
+    r.buffer = malloc(sizeof(q15_t) * 2 * c->in_c * c->kernel_h * c->kernel_w);
+    r.weight = weight;
+    r.bias = bias;
+
+    fill_random(weight, weight_size, 256);
+    fill_random(bias, c->out_c, 256);
+
+    struct tiny_tensor input_tensor = {.dims = {1, c->in_h, c->in_w, c->in_c},
+                                       .dim_num = 4,
+                                       .data_type = NN_DT_Q7,
+                                       .tensor_type = NN_TENSOR_INPUT};
+    struct tiny_tensor weight_tensor = {.dims = {c->kernel_h, c->kernel_w, c->in_c, c->out_c},
+                                        .dim_num = 4,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_CONST,
+                                        .data = weight};
+    struct tiny_tensor bias_tensor = {.dims = {c->out_c},
+                                      .dim_num = 1,
+                                      .shift = BIAS_SHIFT,
+                                      .data_type = NN_DT_Q7,
+                                      .tensor_type = NN_TENSOR_CONST,
+                                      .data = bias};
+    struct tiny_tensor output_tensor = {.dims = {1, r.out_h, r.out_w, c->out_c},
+                                        .dim_num = 4,
+                                        .shift = OUT_SHIFT,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_VAR};
+    struct tiny_conv_param conv_param = {.kernel_h = c->kernel_h,
+                                         .kernel_w = c->kernel_w,
+                                         .stride_h = c->stride_h,
+                                         .stride_w = c->stride_w,
+                                         .pad_h = c->pad_h,
+                                         .pad_w = c->pad_w,
+                                         .activation = c->activation};
+    struct tiny_node node = {.input_num = 3,
+                             .output_num = 1,
+                             .op_type = NN_OP_CONV,
+                             .op_ver = NN_OP_VERSION_1,
+                             .op_param = &conv_param,
+                             .input = {&input_tensor, &weight_tensor, &bias_tensor},
+                             .output = &output_tensor};
+
+    const struct tiny_node* node_list[] = {&node};
+    int ret = check_graph(c->name, node_list, 1, c->in_h * c->in_w * c->in_c, r.out_h * r.out_w * c->out_c,
+                          conv_ref_func, &r, run_num);
+
+    free(weight);
+    free(bias);
+    free(r.buffer);
+
+    return ret;
+}
+
+struct fc_ref
+{
+    const struct fc_case* c;
+    const q7_t* weight;
+    const q7_t* bias;
+    q15_t* buffer;
+};
+
+static void fc_ref_func(const void* arg, q7_t* input, q7_t* output)
+{
+    const struct fc_ref* r = ( const struct fc_ref* )arg;
+    const struct fc_case* c = r->c;
+
+    for(int b = 0; b < c->batch; b++)
+        arm_fully_connected_q7(input + b * c->dim_vec, r->weight, c->dim_vec, c->num_of_rows, BIAS_SHIFT, OUT_SHIFT,
+                               r->bias, output + b * c->num_of_rows, r->buffer);
+}
+
+static int test_fc(const struct fc_case* c, int run_num)
+{
+    struct fc_ref r = {.c = c};
+    q7_t* weight = malloc(c->dim_vec * c->num_of_rows);
+    q7_t* bias = malloc(c->num_of_rows);
+
+    r.buffer = malloc(sizeof(q15_t) * c->dim_vec);
+    r.weight = weight;
+    r.bias = bias;
+
+    fill_random(weight, c->dim_vec * c->num_of_rows, 256);
+    fill_random(bias, c->num_of_rows, 256);
+
+    struct tiny_tensor input_tensor = {
+        .dims = {c->batch, c->dim_vec}, .dim_num = 2, .data_type = NN_DT_Q7, .tensor_type = NN_TENSOR_INPUT};
+    struct tiny_tensor weight_tensor = {.dims = {c->num_of_rows, c->dim_vec},
+                                        .dim_num = 2,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_CONST,
+                                        .data = weight};
+    struct tiny_tensor bias_tensor = {.dims = {c->num_of_rows},
+                                      .dim_num = 1,
+                                      .shift = BIAS_SHIFT,
+                                      .data_type = NN_DT_Q7,
+                                      .tensor_type = NN_TENSOR_CONST,
+                                      .data = bias};
+    struct tiny_tensor output_tensor = {.dims = {c->batch, c->num_of_rows},
+                                        .dim_num = 2,
+                                        .shift = OUT_SHIFT,
+                                        .data_type = NN_DT_Q7,
+                                        .tensor_type = NN_TENSOR_VAR};
+    struct tiny_node node = {.input_num = 3,
+                             .output_num = 1,
+                             .op_type = NN_OP_FC,
+                             .op_ver = NN_OP_VERSION_1,
+                             .input = {&input_tensor, &weight_tensor, &bias_tensor},
+                             .output = &output_tensor};
+
+    const struct tiny_node* node_list[] = {&node};
+    int ret = check_graph(c->name, node_list, 1, c->batch * c->dim_vec, c->batch * c->num_of_rows, fc_ref_func, &r,
+                          run_num);
+
+    free(weight);
+    free(bias);
+    free(r.buffer);
+
+    return ret;
+}
+
+#define POOL_IN_H 8
+#define POOL_IN_W 6
+#define POOL_IN_C 24
+#define POOL_KERNEL 3
+#define POOL_STRIDE 2
+#define POOL_PAD 1
+#define POOL_OUT_H ((POOL_IN_H + 2 * POOL_PAD - POOL_KERNEL) / POOL_STRIDE + 1)
+#define POOL_OUT_W ((POOL_IN_W + 2 * POOL_PAD - POOL_KERNEL) / POOL_STRIDE + 1)
+#define POOL_IN_SIZE (POOL_IN_H * POOL_IN_W * POOL_IN_C)
+#define POOL_OUT_SIZE (POOL_OUT_H * POOL_OUT_W * POOL_IN_C)
+
+static void pool_ref_func(const void* arg, q7_t* input, q7_t* output)
+{
+    arm_maxpool_HWC_q7_nonsquare(input, POOL_IN_W, POOL_IN_H, POOL_IN_C, POOL_KERNEL, POOL_PAD, POOL_STRIDE,
+                                 POOL_OUT_W, POOL_OUT_H, NULL, output);
+}
+
+static void pool_relu_ref_func(const void* arg, q7_t* input, q7_t* output)
+{
+    pool_ref_func(arg, input, output);
+    arm_relu_q7(output, POOL_OUT_SIZE);
+}
+
+/* max pooling, then relu on its output when relu is set */
+static int test_pool(int relu, int run_num)
+{
+    struct tiny_tensor input_tensor = {.dims = {1, POOL_IN_H, POOL_IN_W, POOL_IN_C},
+                                       .dim_num = 4,
+                                       .data_type = NN_DT_Q7,
+                                       .tensor_type = NN_TENSOR_INPUT};
+    struct tiny_tensor pool_tensor = {.dims = {1, POOL_OUT_H, POOL_OUT_W, POOL_IN_C},
+                                      .dim_num = 4,
+                                      .data_type = NN_DT_Q7,
+                                      .tensor_type = NN_TENSOR_VAR};
+    struct tiny_tensor relu_tensor = {.dims = {1, POOL_OUT_H, POOL_OUT_W, POOL_IN_C},
+                                      .dim_num = 4,
+                                      .data_type = NN_DT_Q7,
+                                      .tensor_type = NN_TENSOR_VAR};
+    struct tiny_pool_param pool_param = {.pool_method = NN_POOL_MAX,
+                                         .kernel_h = POOL_KERNEL,
+                                         .kernel_w = POOL_KERNEL,
+                                         .pad_h = POOL_PAD,
+                                         .pad_w = POOL_PAD,
+                                         .stride_h = POOL_STRIDE,
+                                         .stride_w = POOL_STRIDE};
+    struct tiny_node pool_node = {.input_num = 1,
+                                  .output_num = 1,
+                                  .op_type = NN_OP_POOL,
+                                  .op_ver = NN_OP_VERSION_1,
+                                  .op_param = &pool_param,
+                                  .input = {&input_tensor},
+                                  .output = &pool_tensor};
+    struct tiny_node relu_node = {.input_num = 1,
+                                  .output_num = 1,
+                                  .op_type = NN_OP_RELU,
+                                  .op_ver = NN_OP_VERSION_1,
+                                  .input = {&pool_tensor},
+                                  .output = &relu_tensor};
+    const struct tiny_node* node_list[] = {&pool_node, &relu_node};
+
+    if(relu)
+        return check_graph("pool relu", node_list, 2, POOL_IN_SIZE, POOL_OUT_SIZE, pool_relu_ref_func, NULL,
+                           run_num);
+
+    return check_graph("max pool", node_list, 1, POOL_IN_SIZE, POOL_OUT_SIZE, pool_ref_func, NULL, run_num);
+}
+
+int main(int argc, char* argv[])
+{
+    int run_num = 1000;
+    int ret = 0;
+
+    if(argc > 1)
+        run_num = atoi(argv[1]);
+
+    init_tengine();
+
+    printf("perf clock: %u ticks per ms\n", get_perf_clock_base());
+
+    for(int i = 0; i < sizeof(conv_cases) / sizeof(conv_cases[0]); i++)
+    {
+        if(test_conv(&conv_cases[i], run_num) < 0)
+            ret = -1;
+    }
+
+    for(int i = 0; i < sizeof(fc_cases) / sizeof(fc_cases[0]); i++)
+    {
+        if(test_fc(&fc_cases[i], run_num) < 0)
+            ret = -1;
+    }
+
+    if(test_pool(0, run_num) < 0 || test_pool(1, run_num) < 0)
+        ret = -1;
+
+    release_tengine();
+
+    if(ret == 0)
+        printf("ALL TEST DONE\n");
+
+    return ret;
+}